@@ -347,6 +347,11 @@ void can_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, c
                                    ((sbus->m_mode==CAN_MODE_LISTEN)?"Listen":"Active"));
   writer->printf("Speed:     %d\n",MAP_CAN_SPEED(sbus->m_speed));
   writer->printf("DBC:       %s\n",(sbus->GetDBC())?sbus->GetDBC()->GetName().c_str():"none");
+  if (sbus->IsAcceptanceActive())
+    writer->printf("Filter:    std %.2f%% ext %.4f%% of IDs accepted\n",
+      sbus->AcceptanceCoverage(false) * 100, sbus->AcceptanceCoverage(true) * 100);
+  else
+    writer->printf("Filter:    none%s\n", MyCan.IsPromiscuous() ? " (logging)" : "");
 
   writer->printf("\nInterrupts:%20" PRId32 "\n",sbus->m_status.interrupts);
   writer->printf("Rx pkt:    %20" PRId32 "\n",sbus->m_status.packets_rx);
@@ -386,6 +391,11 @@ void can_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, con
     }
   }
 
+void can_ring_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyCan.RingStatus(verbosity, writer);
+  }
+
 void can_clearstatus(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   const char* bus = cmd->GetParent()->GetName();
@@ -596,6 +606,10 @@ const char* GetCanLogTypeName(CAN_log_type_t type)
 
 void can::LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame)
   {
+  // Received & transmitted frames reach the loggers through the frame ring:
+  if (type == CAN_LogFrame_RX || type == CAN_LogFrame_TX)
+    return;
+
   OvmsRecMutexLock lock(&m_loggermap_mutex);
 
   for (canlog_map_t::iterator it=m_loggermap.begin(); it!=m_loggermap.end(); ++it)
@@ -701,6 +715,37 @@ const char* canbus::GetErrorStateName()
   }
 
 
+/**
+ * can::SetPromiscuous -- request all frames from all buses (disables hardware filtering)
+ */
+void can::SetPromiscuous(const char* caller, bool enable)
+  {
+    {
+    OvmsMutexLock lock(&m_promiscuous_mutex);
+    if (enable)
+      m_promiscuous.insert(caller);
+    else
+      m_promiscuous.erase(caller);
+    }
+  UpdateAcceptance();
+  }
+
+bool can::IsPromiscuous()
+  {
+  OvmsMutexLock lock(&m_promiscuous_mutex);
+  return HasLogger() || !m_promiscuous.empty();
+  }
+
+void can::UpdateAcceptance()
+  {
+  for (int i = 0; i < CAN_MAXBUSES; i++)
+    {
+    canbus* bus = GetBus(i);
+    if (bus)
+      bus->UpdateAcceptance();
+    }
+  }
+
 uint32_t can::AddLogger(canlog* logger, int filterc, const char* const* filterv)
   {
   if (filterc>0)
@@ -713,10 +758,16 @@ uint32_t can::AddLogger(canlog* logger, int filterc, const char* const* filterv)
     logger->SetFilter(filter);
     }
 
-  OvmsRecMutexLock lock(&m_loggermap_mutex);
-  uint32_t id = m_logger_id++;
-  m_loggermap[id] = logger;
+  uint32_t id;
+    {
+    OvmsRecMutexLock lock(&m_loggermap_mutex);
+    id = m_logger_id++;
+    m_loggermap[id] = logger;
+    }
+  RegisterReader(&logger->m_reader);
 
+  // loggers need all frames:
+  UpdateAcceptance();
   return id;
   }
 
@@ -743,10 +794,12 @@ bool can::RemoveLogger(uint32_t id)
   auto k = m_loggermap.find(id);
   if (k != m_loggermap.end())
     {
+    DeregisterReader(&k->second->m_reader);
     k->second->Close();
     vTaskDelay(pdMS_TO_TICKS(100)); // give logger task time to finish
     delete k->second;
     m_loggermap.erase(k);
+    UpdateAcceptance();
     return true;
     }
   return false;
@@ -758,11 +811,13 @@ void can::RemoveLoggers()
 
   for (canlog_map_t::iterator it=m_loggermap.begin(); it!=m_loggermap.end();)
     {
+    DeregisterReader(&it->second->m_reader);
     it->second->Close();
     vTaskDelay(pdMS_TO_TICKS(100)); // give logger task time to finish
     delete it->second;
     it = m_loggermap.erase(it);
     }
+  UpdateAcceptance();
   }
 
 uint32_t can::AddPlayer(canplay* player, int filterc, const char* const* filterv)
@@ -925,9 +980,11 @@ can::can()
     }
 
   cmd_can->RegisterCommand("list", "List CAN buses", can_list);
+  cmd_can->RegisterCommand("ring", "Show CAN frame ring status", can_ring_status);
 
   m_rxqueue = xQueueCreate(CONFIG_OVMS_HW_CAN_RX_QUEUE_SIZE,sizeof(CAN_queue_msg_t));
   xTaskCreatePinnedToCore(CAN_rxtask, "OVMS CanRx", 2*2048, (void*)this, 23, &m_rxtask, CORE(0));
+  m_ring.SetWriter(m_rxtask);
   }
 
 can::~can()
@@ -955,6 +1012,18 @@ canbus* can::GetBus(int busnumber)
 
 void can::IncomingFrame(CAN_frame_t* p_frame)
   {
+  // The frame ring has a single producer: frames injected by other tasks
+  // (simulation, playback) are passed through the rx task
+  if (xTaskGetCurrentTaskHandle() != m_rxtask)
+    {
+    CAN_queue_msg_t msg;
+    msg.type = CAN_frame;
+    msg.body.frame = *p_frame;
+    if (xQueueSend(m_rxqueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE)
+      p_frame->origin->m_status.rxbuf_overflow++;
+    return;
+    }
+
   p_frame->origin->m_status.packets_rx++;
   p_frame->origin->m_watchdog_timer = monotonictime;
 
@@ -977,6 +1046,8 @@ void can::DeregisterListener(QueueHandle_t queue)
 
 void can::NotifyListeners(const CAN_frame_t* frame, bool tx)
   {
+  m_ring.Write(tx ? CAN_LogFrame_TX : CAN_LogFrame_RX, frame);
+
   for (CanListenerMap_t::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
     {
     if (!tx || (tx && it->second))
@@ -1040,11 +1111,13 @@ canbus::canbus(const char* name)
   m_speed = CAN_SPEED_1000KBPS;
   m_dbcfile = NULL;
   m_tx_frame = {};
+  m_acceptance_enabled = false;
+  m_acceptance_active = false;
   ClearStatus();
 
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG, "ticker.10", std::bind(&canbus::BusTicker10, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.10", std::bind(&canbus::BusTicker10, this, _1, _2));
   }
 
 canbus::~canbus()
@@ -1134,7 +1207,7 @@ dbcfile* canbus::GetDBC()
   return m_dbcfile;
   }
 
-void canbus::BusTicker10(std::string event, void* data)
+void canbus::BusTicker10(const char* event, void* data)
   {
   if ((m_powermode==On)&&(StandardMetrics.ms_v_env_on->AsBool()))
     {
@@ -1261,6 +1334,119 @@ esp_err_t canbus::WriteStandard(uint16_t id, uint8_t length, uint8_t *data, Tick
   return this->Write(&frame, maxqueuewait);
   }
 
+/**
+ * Hardware acceptance filtering
+ *    - consumers register the ID ranges they need per caller
+ *    - filtering needs to be enabled by the bus owner (the vehicle, see
+ *      OvmsVehicle::AddCanAcceptance), as only the owner knows if all
+ *      consumers of the bus have registered
+ *    - all frames are accepted while a logger or RE session is active
+ *    - register the ranges before enabling, as the MCP2515 has to switch to
+ *      configuration mode for each update (updates resulting in the same
+ *      registers are skipped by the drivers, adding a known range is a no-op)
+ */
+void canbus::AddAcceptance(const char* caller, uint32_t id_from, uint32_t id_to, bool extended /*=false*/)
+  {
+    {
+    OvmsMutexLock lock(&m_acceptance_mutex);
+    CAN_acceptance_list_t &list = m_acceptance[caller];
+    for (auto &range : list)
+      {
+      if (range.id_from == id_from && range.id_to == id_to && range.extended == extended)
+        return;
+      }
+    list.push_back({ id_from, id_to, extended });
+    }
+  if (m_acceptance_enabled)
+    UpdateAcceptance();
+  }
+
+void canbus::SetAcceptance(const char* caller, const CAN_acceptance_list_t &list)
+  {
+    {
+    OvmsMutexLock lock(&m_acceptance_mutex);
+    if (list.empty())
+      m_acceptance.erase(caller);
+    else
+      m_acceptance[caller] = list;
+    }
+  if (m_acceptance_enabled)
+    UpdateAcceptance();
+  }
+
+void canbus::RemoveAcceptance(const char* caller)
+  {
+    {
+    OvmsMutexLock lock(&m_acceptance_mutex);
+    if (m_acceptance.erase(caller) == 0)
+      return;
+    }
+  if (m_acceptance_enabled)
+    UpdateAcceptance();
+  }
+
+void canbus::ClearAcceptance()
+  {
+    {
+    OvmsMutexLock lock(&m_acceptance_mutex);
+    m_acceptance.clear();
+    m_acceptance_enabled = false;
+    }
+  UpdateAcceptance();
+  }
+
+void canbus::EnableAcceptance(bool enable)
+  {
+  m_acceptance_enabled = enable;
+  UpdateAcceptance();
+  }
+
+/**
+ * canbus::UpdateAcceptance -- program the controller for the current ranges
+ */
+void canbus::UpdateAcceptance()
+  {
+  OvmsMutexLock lock(&m_acceptance_mutex);
+  CAN_acceptance_list_t list;
+  if (m_acceptance_enabled && !MyCan.IsPromiscuous())
+    {
+    for (auto &it : m_acceptance)
+      list.insert(list.end(), it.second.begin(), it.second.end());
+    }
+  bool active = !list.empty();
+  if (!active && !m_acceptance_active)
+    return;
+
+  esp_err_t err = SetAcceptanceFilter(active ? &list : NULL);
+  if (err == ESP_OK)
+    {
+    m_acceptance_active = active;
+    ESP_LOGI(TAG, "%s: acceptance filter %s (%d ranges)", GetName(),
+      active ? "set" : "cleared", list.size());
+    }
+  else if (err != ESP_ERR_NOT_SUPPORTED)
+    {
+    ESP_LOGW(TAG, "%s: acceptance filter update failed: %s", GetName(), esp_err_to_name(err));
+    }
+  }
+
+/**
+ * canbus::SetAcceptanceFilter -- driver: program the hardware filter
+ *    - list = NULL: accept all frames
+ */
+esp_err_t canbus::SetAcceptanceFilter(const CAN_acceptance_list_t* list)
+  {
+  return ESP_ERR_NOT_SUPPORTED;
+  }
+
+/**
+ * canbus::AcceptanceCoverage -- driver: fraction of the ID space accepted
+ */
+float canbus::AcceptanceCoverage(bool extended)
+  {
+  return 1.0f;
+  }
+
 /**
  * CAN_frame_t::Write -- main TX API
  *    - returns ESP_OK, ESP_QUEUED or ESP_FAIL
@@ -42,9 +42,14 @@
 #include <stdint.h>
 #include <functional>
 #include <list>
+#include <map>
+#include <set>
+#include <atomic>
 #include "pcp.h"
 #include <esp_err.h>
 #include "ovms_events.h"
+#include "ovms_mutex.h"
+#include "can_acceptance.h"
 
 ////////////////////////////////////////////////////////////////////////
 // Constant ESP_QUEUED to indicate a 'queued' response
@@ -277,6 +282,94 @@ typedef struct
 
 extern const char* GetCanLogTypeName(CAN_log_type_t type);
 
+////////////////////////////////////////////////////////////////////////
+// CAN frame broadcast ring
+// Received and transmitted frames are written once by the CAN rx task,
+// any number of readers consume them at their own pace.
+////////////////////////////////////////////////////////////////////////
+
+#define CANRING_MAX_READERS       8
+
+class canring;
+class OvmsWriter;
+
+/**
+ * canring_reader: consumer of the CAN frame broadcast ring
+ *
+ *  The reader is owned by the consumer and registered by MyCan.RegisterReader().
+ *  Read() & Wait() must only be called by the consumer task, which is woken by a
+ *  task notification when new frames arrive. Frames overwritten before being read
+ *  are counted as lost.
+ */
+class canring_reader
+  {
+  friend class canring;
+
+  public:
+    canring_reader(const char* name, bool txfeedback=false);
+    ~canring_reader();
+
+  public:
+    bool Read(CAN_log_message_t* msg, TickType_t timeout=portMAX_DELAY);
+    bool Wait(TickType_t timeout);
+    bool IsRegistered() { return m_ring.load() != NULL; }
+    const char* GetName() { return m_name; }
+    uint32_t GetRead() { return m_read; }
+    uint32_t GetLost() { return m_lost; }
+
+  protected:
+    const char*               m_name;
+    bool                      m_txfeedback;   // Also deliver transmitted frames
+    std::atomic<canring*>     m_ring;
+    std::atomic<TaskHandle_t> m_task;         // Consumer task, bound by Wait()
+    std::atomic<bool>         m_waiting;
+    uint32_t                  m_cursor;       // Next frame index to read
+    uint32_t                  m_read;         // Frames read
+    uint32_t                  m_lost;         // Frames overwritten before being read
+  };
+
+/**
+ * canring: single producer broadcast ring of CAN frames
+ *
+ *  Writing is lock free and done by the CAN rx task only, other tasks need to pass
+ *  frames & TX results through the rx queue. Each slot carries a sequence number
+ *  (frame index + 1, 0 = being written), readers copy the slot and check the
+ *  sequence to detect frames overwritten in the meantime. Only readers waiting
+ *  for frames get notified, so a busy consumer costs the writer nothing. The
+ *  slots are allocated on the first reader registration.
+ */
+class canring
+  {
+  public:
+    canring();
+    ~canring();
+
+  public:
+    bool AddReader(canring_reader* reader);
+    void RemoveReader(canring_reader* reader);
+    void SetWriter(TaskHandle_t task) { m_writer = task; }
+    void Write(CAN_log_type_t type, const CAN_frame_t* frame);
+    bool Fetch(canring_reader* reader, CAN_log_message_t* msg);
+    void Status(int verbosity, OvmsWriter* writer);
+    friend class canring_reader;
+
+  protected:
+    struct slot_t
+      {
+      std::atomic<uint32_t>   seq;
+      CAN_log_message_t       msg;
+      };
+    slot_t*                   m_slots;
+    uint32_t                  m_size;         // Slot count (power of 2)
+    uint32_t                  m_mask;
+    TaskHandle_t              m_writer;       // Single producer task
+    std::atomic<uint32_t>     m_head;         // Next frame index to write
+    std::atomic<canring_reader*> m_readers[CANRING_MAX_READERS];
+    std::atomic<int>          m_readercnt;
+    std::atomic<int>          m_notifying;    // Writer is accessing readers
+    OvmsMutex                 m_mutex;        // Reader registration
+  };
+
 ////////////////////////////////////////////////////////////////////////
 // canbus - the definition of a CAN bus
 ////////////////////////////////////////////////////////////////////////
@@ -315,7 +408,7 @@ class canbus : public pcp, public InternalRamAllocated
 
   protected:
     virtual esp_err_t QueueWrite(const CAN_frame_t* p_frame, TickType_t maxqueuewait=0);
-    virtual void BusTicker10(std::string event, void* data);
+    virtual void BusTicker10(const char* event, void* data);
 
   public:
     void LogFrame(CAN_log_type_t type, const CAN_frame_t* p_frame);
@@ -325,6 +418,20 @@ class canbus : public pcp, public InternalRamAllocated
     CAN_errorstate_t GetErrorState();
     const char* GetErrorStateName();
 
+  public:
+    // Hardware acceptance filtering:
+    void AddAcceptance(const char* caller, uint32_t id_from, uint32_t id_to, bool extended=false);
+    void SetAcceptance(const char* caller, const CAN_acceptance_list_t &list);
+    void RemoveAcceptance(const char* caller);
+    void ClearAcceptance();
+    void EnableAcceptance(bool enable);
+    bool IsAcceptanceActive() { return m_acceptance_active; }
+    void UpdateAcceptance();
+    virtual float AcceptanceCoverage(bool extended);
+
+  protected:
+    virtual esp_err_t SetAcceptanceFilter(const CAN_acceptance_list_t* list);
+
   public:
     CAN_speed_t m_speed;
     CAN_mode_t m_mode;
@@ -338,6 +445,13 @@ class canbus : public pcp, public InternalRamAllocated
 
   protected:
     dbcfile *m_dbcfile;
+
+  protected:
+    typedef std::map<std::string, CAN_acceptance_list_t> acceptance_map_t;
+    OvmsMutex m_acceptance_mutex;
+    acceptance_map_t m_acceptance;  // ID ranges needed per consumer
+    bool m_acceptance_enabled;      // Filtering requested by the bus owner
+    bool m_acceptance_active;       // Hardware filter programmed
   };
 
 #define CAN_M_STATE_TX_BUF_OCCUPIED   BIT(0) // transmit buffer is in use
@@ -384,11 +498,21 @@ class can : public InternalRamAllocated
     void DeregisterListener(QueueHandle_t queue);
     void NotifyListeners(const CAN_frame_t* frame, bool tx);
 
+  public:
+    bool RegisterReader(canring_reader* reader) { return m_ring.AddReader(reader); }
+    void DeregisterReader(canring_reader* reader) { m_ring.RemoveReader(reader); }
+    void RingStatus(int verbosity, OvmsWriter* writer) { m_ring.Status(verbosity, writer); }
+
   public:
     void RegisterCallback(const char* caller, CanFrameCallback callback, bool txfeedback=false);
     void DeregisterCallback(const char* caller);
     int ExecuteCallbacks(const CAN_frame_t* frame, bool tx, bool success);
 
+  public:
+    void SetPromiscuous(const char* caller, bool enable);
+    bool IsPromiscuous();
+    void UpdateAcceptance();
+
   public:
     uint32_t AddLogger(canlog* logger, int filterc=0, const char* const* filterv=NULL);
     bool HasLogger();
@@ -425,10 +549,13 @@ class can : public InternalRamAllocated
 
   private:
     canbus* m_buslist[CAN_MAXBUSES];
-    CanListenerMap_t m_listeners;
+    CanListenerMap_t m_listeners;     // Queue listeners (legacy, see RegisterReader)
+    canring m_ring;                   // Frame broadcast to readers
     CanFrameCallbackList_t m_rxcallbacks;
     CanFrameCallbackList_t m_txcallbacks;
     TaskHandle_t m_rxtask;            // Task to handle reception
+    std::set<std::string> m_promiscuous; // Consumers needing all frames (e.g. RE tools)
+    OvmsMutex m_promiscuous_mutex;
   };
 
 extern can MyCan;
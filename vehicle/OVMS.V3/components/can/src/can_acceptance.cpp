@@ -0,0 +1,462 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    CAN hardware acceptance filter calculation
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include <math.h>
+#include <algorithm>
+#include "can_acceptance.h"
+
+// The needed ID ranges are split into aligned blocks (value/care bit pairs),
+// which are then merged pairwise, always choosing the merge adding the least
+// accepted IDs, until they fit the filters of the controller.
+
+#define ACC_STD_MASK      0x7ffu
+#define ACC_EXT_MASK      0x1fffffffu
+#define ACC_MAXBLOCKS     64          // Coarse pre-merge above this (limits calculation time)
+
+typedef struct
+  {
+  uint32_t value;
+  uint32_t care;                      // 1 = bit must match
+  bool extended;
+  } acc_block_t;
+
+typedef std::vector<acc_block_t> acc_blocks_t;
+typedef float (*acc_cost_t)(const acc_block_t &block);
+
+static inline int acc_bits(uint32_t x)
+  {
+  return __builtin_popcount(x);
+  }
+
+static inline acc_block_t acc_merge(const acc_block_t &a, const acc_block_t &b)
+  {
+  acc_block_t m;
+  m.care = a.care & b.care & ~(a.value ^ b.value);
+  m.value = a.value & m.care;
+  m.extended = a.extended;
+  return m;
+  }
+
+/**
+ * acc_split: split an ID range into aligned blocks
+ */
+static void acc_split(uint32_t from, uint32_t to, bool extended, acc_blocks_t &blocks)
+  {
+  const int bits = extended ? 29 : 11;
+  const uint32_t full = extended ? ACC_EXT_MASK : ACC_STD_MASK;
+  if (from > full)
+    return;
+  if (to > full)
+    to = full;
+  uint64_t cur = from;
+  while (cur <= to)
+    {
+    int size = 0;
+    while (size < bits
+      && (cur & ((1ull << (size+1)) - 1)) == 0
+      && cur + (1ull << (size+1)) - 1 <= to)
+      size++;
+    blocks.push_back({ (uint32_t)cur, full & ~(uint32_t)((1ull << size) - 1), extended });
+    cur += (1ull << size);
+    }
+  }
+
+/**
+ * acc_reduce: merge blocks until at most max remain
+ */
+static void acc_reduce(acc_blocks_t &blocks, size_t max, acc_cost_t cost)
+  {
+  if (blocks.size() > ACC_MAXBLOCKS && max < ACC_MAXBLOCKS)
+    {
+    // Coarse pre-merge of neighbours:
+    std::sort(blocks.begin(), blocks.end(),
+      [](const acc_block_t &a, const acc_block_t &b) { return a.value < b.value; });
+    while (blocks.size() > ACC_MAXBLOCKS)
+      {
+      acc_blocks_t merged;
+      for (size_t i = 0; i < blocks.size(); i += 2)
+        {
+        if (i+1 < blocks.size())
+          merged.push_back(acc_merge(blocks[i], blocks[i+1]));
+        else
+          merged.push_back(blocks[i]);
+        }
+      blocks.swap(merged);
+      }
+    }
+
+  while (blocks.size() > max)
+    {
+    size_t best_i = 0, best_j = 1;
+    float best = INFINITY;
+    for (size_t i = 0; i < blocks.size(); i++)
+      {
+      for (size_t j = i+1; j < blocks.size(); j++)
+        {
+        float add = cost(acc_merge(blocks[i], blocks[j])) - cost(blocks[i]) - cost(blocks[j]);
+        if (add < best)
+          {
+          best = add;
+          best_i = i;
+          best_j = j;
+          }
+        }
+      }
+    blocks[best_i] = acc_merge(blocks[best_i], blocks[best_j]);
+    blocks.erase(blocks.begin() + best_j);
+    }
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// MCP2515
+////////////////////////////////////////////////////////////////////////
+
+// Blocks are kept in the 29 bit register layout, standard IDs shifted by 18:
+static float mcp_cost(const acc_block_t &b)
+  {
+  return b.extended
+    ? ldexpf(1, -acc_bits(b.care & ACC_EXT_MASK))
+    : ldexpf(1, -acc_bits((b.care >> 18) & ACC_STD_MASK));
+  }
+
+// Group cost: filters share the group mask
+static float mcp_group_cost(const acc_block_t* blocks[], int cnt, uint32_t &mask)
+  {
+  mask = ACC_EXT_MASK;
+  for (int i = 0; i < cnt; i++)
+    mask &= blocks[i]->care;
+  float cost = 0;
+  for (int i = 0; i < cnt; i++)
+    {
+    acc_block_t b = *blocks[i];
+    b.care = mask;
+    cost += mcp_cost(b);
+    }
+  return cost;
+  }
+
+static void mcp_fill_group(CAN_mcp2515_filter_t &res, int group, const acc_block_t* blocks[], int cnt, uint32_t mask)
+  {
+  int first = (group == 0) ? 0 : 2;
+  int slots = (group == 0) ? 2 : 4;
+  res.mask[group] = mask;
+  for (int i = 0; i < slots; i++)
+    {
+    // unused filters repeat the last one:
+    const acc_block_t* b = blocks[std::min(i, cnt-1)];
+    res.filter[first+i] = b->value & mask;
+    res.extended[first+i] = b->extended;
+    }
+  }
+
+bool canacceptance::CalcMCP2515(const CAN_acceptance_list_t &list, CAN_mcp2515_filter_t &res)
+  {
+  acc_blocks_t std_blocks, ext_blocks;
+  for (const CAN_acceptance_t &acc : list)
+    acc_split(acc.id_from, acc.id_to, acc.extended, acc.extended ? ext_blocks : std_blocks);
+  if (std_blocks.empty() && ext_blocks.empty())
+    return false;
+  for (acc_block_t &b : std_blocks)
+    {
+    b.value <<= 18;
+    b.care <<= 18;
+    }
+
+  // A group mask with EID bits set would also filter the first data bytes of
+  // standard frames, so standard and extended IDs need separate groups:
+  if (!std_blocks.empty() && !ext_blocks.empty())
+    {
+    float best = INFINITY;
+    for (int std_group = 0; std_group < 2; std_group++)
+      {
+      acc_blocks_t s = std_blocks, e = ext_blocks;
+      acc_reduce(s, (std_group == 0) ? 2 : 4, mcp_cost);
+      acc_reduce(e, (std_group == 0) ? 4 : 2, mcp_cost);
+      const acc_block_t* sp[4]; const acc_block_t* ep[4];
+      for (size_t i = 0; i < s.size(); i++) sp[i] = &s[i];
+      for (size_t i = 0; i < e.size(); i++) ep[i] = &e[i];
+      uint32_t smask, emask;
+      float cost = mcp_group_cost(sp, s.size(), smask) + mcp_group_cost(ep, e.size(), emask);
+      if (cost < best)
+        {
+        best = cost;
+        mcp_fill_group(res, std_group, sp, s.size(), smask);
+        mcp_fill_group(res, 1-std_group, ep, e.size(), emask);
+        }
+      }
+    return true;
+    }
+
+  // Single ID type: find the best split of up to 6 blocks into the groups:
+  acc_blocks_t &blocks = std_blocks.empty() ? ext_blocks : std_blocks;
+  acc_reduce(blocks, 6, mcp_cost);
+  int cnt = blocks.size();
+  float best = INFINITY;
+  for (uint32_t set = 0; set < (1u << cnt); set++)
+    {
+    // set bits = blocks in group 0:
+    int cnt0 = acc_bits(set), cnt1 = cnt - cnt0;
+    if (cnt0 > 2 || cnt1 > 4)
+      continue;
+    const acc_block_t* g0[2]; const acc_block_t* g1[6];
+    int n0 = 0, n1 = 0;
+    for (int i = 0; i < cnt; i++)
+      {
+      if (set & (1u << i))
+        g0[n0++] = &blocks[i];
+      else
+        g1[n1++] = &blocks[i];
+      }
+    uint32_t mask0 = 0, mask1 = 0;
+    float cost = 0;
+    if (n0) cost += mcp_group_cost(g0, n0, mask0);
+    if (n1) cost += mcp_group_cost(g1, n1, mask1);
+    if (cost < best)
+      {
+      best = cost;
+      // an empty group repeats the other one:
+      if (!n0) { g0[0] = g1[0]; n0 = 1; mask0 = mask1; }
+      if (!n1) { g1[0] = g0[0]; n1 = 1; mask1 = mask0; }
+      mcp_fill_group(res, 0, g0, n0, mask0);
+      mcp_fill_group(res, 1, g1, n1, mask1);
+      }
+    }
+  return true;
+  }
+
+bool canacceptance::MatchMCP2515(const CAN_mcp2515_filter_t &filter, uint32_t id, bool extended)
+  {
+  uint32_t value = extended ? (id & ACC_EXT_MASK) : ((id & ACC_STD_MASK) << 18);
+  for (int i = 0; i < 6; i++)
+    {
+    if (filter.extended[i] != extended)
+      continue;
+    uint32_t mask = filter.mask[(i < 2) ? 0 : 1];
+    if (!extended)
+      {
+      // EID15-0 apply to the first two data bytes: data dependent, not a safe match
+      if (mask & 0xffff)
+        continue;
+      mask &= ~0x3ffffu;
+      }
+    if (((value ^ filter.filter[i]) & mask) == 0)
+      return true;
+    }
+  return false;
+  }
+
+bool canacceptance::EqualMCP2515(const CAN_mcp2515_filter_t &a, const CAN_mcp2515_filter_t &b)
+  {
+  for (int i = 0; i < 2; i++)
+    {
+    if (a.mask[i] != b.mask[i])
+      return false;
+    }
+  for (int i = 0; i < 6; i++)
+    {
+    if (a.filter[i] != b.filter[i] || a.extended[i] != b.extended[i])
+      return false;
+    }
+  return true;
+  }
+
+void canacceptance::EncodeMCP2515(uint32_t value, bool extended, uint8_t* regs)
+  {
+  regs[0] = (value >> 21) & 0xff;                                       // SIDH: SID10-3
+  regs[1] = ((value >> 13) & 0xe0) | (extended ? 0x08 : 0) | ((value >> 16) & 0x03); // SIDL: SID2-0, EXIDE, EID17-16
+  regs[2] = (value >> 8) & 0xff;                                        // EID8: EID15-8
+  regs[3] = value & 0xff;                                               // EID0: EID7-0
+  }
+
+float canacceptance::CoverageMCP2515(const CAN_mcp2515_filter_t &filter, bool extended)
+  {
+  // upper bound, overlaps are counted multiple times:
+  float sum = 0;
+  for (int i = 0; i < 6; i++)
+    {
+    if (filter.extended[i] != extended)
+      continue;
+    int first = (i < 2) ? 0 : 2;
+    bool repeated = false;
+    for (int j = first; j < i && !repeated; j++)
+      repeated = (filter.filter[j] == filter.filter[i] && filter.extended[j] == filter.extended[i]);
+    if (repeated)
+      continue;
+    acc_block_t b = { filter.filter[i], filter.mask[(i < 2) ? 0 : 1], extended };
+    sum += mcp_cost(b);
+    }
+  return std::min(sum, 1.0f);
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// SJA1000 / ESP32
+////////////////////////////////////////////////////////////////////////
+
+// Single filter mode: one 32 bit filter applied to both frame types:
+//  standard: bits 31-21 = ID10-0, bit 20 = RTR, bits 15-0 = data bytes 1-2
+//  extended: bits 31-3 = ID28-0, bit 2 = RTR
+static float sja_single_cost(const acc_block_t &b)
+  {
+  return ldexpf(1, -acc_bits(b.care & 0xffe00000u)) + ldexpf(1, -acc_bits(b.care & 0xfffffff8u));
+  }
+
+// Dual filter mode: two 16 bit filters applied to both frame types:
+//  standard: bits 15-5 = ID10-0, bit 4 = RTR, bits 3-0 = data byte 1 (filter 1 only)
+//  extended: bits 15-0 = ID28-13
+static float sja_dual_cost(const acc_block_t &b)
+  {
+  return ldexpf(1, -acc_bits(b.care & 0xffe0u)) + ldexpf(1, -acc_bits(b.care & 0xffffu));
+  }
+
+bool canacceptance::CalcSJA1000(const CAN_acceptance_list_t &list, CAN_sja1000_filter_t &res)
+  {
+  acc_blocks_t blocks;
+  bool need_std = false;
+  for (const CAN_acceptance_t &acc : list)
+    {
+    acc_split(acc.id_from, acc.id_to, acc.extended, blocks);
+    need_std |= !acc.extended;
+    }
+  if (blocks.empty())
+    return false;
+
+  // Single filter mode:
+  acc_blocks_t single;
+  for (const acc_block_t &b : blocks)
+    {
+    if (b.extended)
+      single.push_back({ b.value << 3, b.care << 3, true });
+    else
+      single.push_back({ b.value << 21, b.care << 21, false });
+    }
+  acc_reduce(single, 1, sja_single_cost);
+  float single_cost = sja_single_cost(single[0]);
+
+  // Dual filter mode: if standard frames are needed, bits 4-0 (RTR & data
+  // byte 1, but ID17-13 for extended frames) cannot be used:
+  uint32_t dual_care = need_std ? 0xffe0u : 0xffffu;
+  acc_blocks_t dual;
+  for (const acc_block_t &b : blocks)
+    {
+    if (b.extended)
+      dual.push_back({ (b.value >> 13) & dual_care, (b.care >> 13) & dual_care, true });
+    else
+      dual.push_back({ (b.value << 5) & dual_care, (b.care << 5) & dual_care, false });
+    }
+  acc_reduce(dual, 2, sja_dual_cost);
+  if (dual.size() < 2)
+    dual.push_back(dual[0]);
+  float dual_cost = sja_dual_cost(dual[0]) + sja_dual_cost(dual[1]);
+
+  if (single_cost <= dual_cost)
+    {
+    res.dual = false;
+    uint32_t code = single[0].value, mask = ~single[0].care;
+    for (int i = 0; i < 4; i++)
+      {
+      res.code[i] = code >> (24 - 8*i);
+      res.mask[i] = mask >> (24 - 8*i);
+      }
+    }
+  else
+    {
+    res.dual = true;
+    for (int f = 0; f < 2; f++)
+      {
+      res.code[2*f]   = dual[f].value >> 8;
+      res.code[2*f+1] = dual[f].value;
+      res.mask[2*f]   = ~dual[f].care >> 8;
+      res.mask[2*f+1] = ~dual[f].care;
+      }
+    }
+  return true;
+  }
+
+bool canacceptance::MatchSJA1000(const CAN_sja1000_filter_t &filter, uint32_t id, bool extended)
+  {
+  if (!filter.dual)
+    {
+    uint32_t code = 0, care = 0;
+    for (int i = 0; i < 4; i++)
+      {
+      code = (code << 8) | filter.code[i];
+      care = (care << 8) | (uint8_t)~filter.mask[i];
+      }
+    if (extended)
+      return ((((id & ACC_EXT_MASK) << 3) ^ code) & care & 0xfffffffcu) == 0;
+    // data bytes compared: data dependent, not a safe match
+    if (care & 0xffffu)
+      return false;
+    return ((((id & ACC_STD_MASK) << 21) ^ code) & care & 0xfff00000u) == 0;
+    }
+
+  for (int f = 0; f < 2; f++)
+    {
+    uint32_t code = (filter.code[2*f] << 8) | filter.code[2*f+1];
+    uint32_t care = (uint8_t)~filter.mask[2*f] << 8 | (uint8_t)~filter.mask[2*f+1];
+    if (extended)
+      {
+      if ((((id >> 13) & 0xffff) ^ code) & care)
+        continue;
+      return true;
+      }
+    if (f == 0 && ((care & 0x0f) || ((uint8_t)~filter.mask[3] & 0x0f)))
+      continue;
+    if (((((id & ACC_STD_MASK) << 5) ^ code) & care & 0xfff0) == 0)
+      return true;
+    }
+  return false;
+  }
+
+bool canacceptance::EqualSJA1000(const CAN_sja1000_filter_t &a, const CAN_sja1000_filter_t &b)
+  {
+  if (a.dual != b.dual)
+    return false;
+  for (int i = 0; i < 4; i++)
+    {
+    if (a.code[i] != b.code[i] || a.mask[i] != b.mask[i])
+      return false;
+    }
+  return true;
+  }
+
+float canacceptance::CoverageSJA1000(const CAN_sja1000_filter_t &filter, bool extended)
+  {
+  float sum = 0;
+  if (!filter.dual)
+    {
+    uint32_t care = 0;
+    for (int i = 0; i < 4; i++)
+      care = (care << 8) | (uint8_t)~filter.mask[i];
+    return ldexpf(1, -acc_bits(care & (extended ? 0xfffffff8u : 0xffe00000u)));
+    }
+  for (int f = 0; f < 2; f++)
+    {
+    uint32_t care = (uint8_t)~filter.mask[2*f] << 8 | (uint8_t)~filter.mask[2*f+1];
+    sum += ldexpf(1, -acc_bits(care & (extended ? 0xffffu : 0xffe0u)));
+    }
+  return std::min(sum, 1.0f);
+  }
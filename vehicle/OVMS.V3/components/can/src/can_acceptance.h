@@ -0,0 +1,91 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    CAN hardware acceptance filter calculation
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __CAN_ACCEPTANCE_H__
+#define __CAN_ACCEPTANCE_H__
+
+// The acceptance filter calculation has no framework dependencies, so it
+// can be built & checked on a host against the register models.
+
+#include <stdint.h>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+// CAN hardware acceptance filtering
+// Consumers register the ID ranges they need (see canbus::AddAcceptance),
+// the drivers program their controller to accept a superset of these.
+////////////////////////////////////////////////////////////////////////
+
+typedef struct
+  {
+  uint32_t id_from;
+  uint32_t id_to;
+  bool extended;                // 29 bit IDs
+  } CAN_acceptance_t;
+
+typedef std::vector<CAN_acceptance_t> CAN_acceptance_list_t;
+
+// MCP2515 register model:
+//  RXM0 applies to RXF0-1 (RXB0), RXM1 to RXF2-5 (RXB1).
+//  IDs are in the 29 bit register layout: SID10-0 = bits 28-18, EID17-0 = bits 17-0.
+typedef struct
+  {
+  uint32_t mask[2];             // RXM0, RXM1
+  uint32_t filter[6];           // RXF0 … RXF5
+  bool extended[6];             // RXFn EXIDE
+  } CAN_mcp2515_filter_t;
+
+// SJA1000 / ESP32 register model:
+typedef struct
+  {
+  bool dual;                    // Dual filter mode (MOD.AFM = 0)
+  uint8_t code[4];              // ACR0 … ACR3
+  uint8_t mask[4];              // AMR0 … AMR3 (1 = don't care)
+  } CAN_sja1000_filter_t;
+
+class canacceptance
+  {
+  public:
+    // Calculate filters accepting at least all IDs of the list,
+    // return false if the list is empty (= no filtering):
+    static bool CalcMCP2515(const CAN_acceptance_list_t &list, CAN_mcp2515_filter_t &res);
+    static bool CalcSJA1000(const CAN_acceptance_list_t &list, CAN_sja1000_filter_t &res);
+
+    // Check if a data frame with the ID passes the filters:
+    static bool MatchMCP2515(const CAN_mcp2515_filter_t &filter, uint32_t id, bool extended);
+    static bool MatchSJA1000(const CAN_sja1000_filter_t &filter, uint32_t id, bool extended);
+
+    // Check if two filter configurations are identical (no reprogramming needed):
+    static bool EqualMCP2515(const CAN_mcp2515_filter_t &a, const CAN_mcp2515_filter_t &b);
+    static bool EqualSJA1000(const CAN_sja1000_filter_t &a, const CAN_sja1000_filter_t &b);
+
+    // MCP2515 register values (SIDH, SIDL, EID8, EID0) for a mask/filter:
+    static void EncodeMCP2515(uint32_t value, bool extended, uint8_t* regs);
+
+    // Fraction of the standard & extended ID spaces accepted:
+    static float CoverageMCP2515(const CAN_mcp2515_filter_t &filter, bool extended);
+    static float CoverageSJA1000(const CAN_sja1000_filter_t &filter, bool extended);
+  };
+
+#endif //#ifndef __CAN_ACCEPTANCE_H__
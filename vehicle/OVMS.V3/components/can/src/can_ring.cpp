@@ -0,0 +1,275 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    CAN frame broadcast ring
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "canring";
+
+#include <assert.h>
+#include <string.h>
+#include <sys/time.h>
+#include "can.h"
+#include "ovms_command.h"
+
+
+////////////////////////////////////////////////////////////////////////
+// canring_reader
+////////////////////////////////////////////////////////////////////////
+
+canring_reader::canring_reader(const char* name, bool txfeedback)
+  {
+  m_name = name;
+  m_txfeedback = txfeedback;
+  m_ring = NULL;
+  m_task = NULL;
+  m_waiting = false;
+  m_cursor = 0;
+  m_read = 0;
+  m_lost = 0;
+  }
+
+canring_reader::~canring_reader()
+  {
+  canring* ring = m_ring.load();
+  if (ring)
+    ring->RemoveReader(this);
+  }
+
+/**
+ * Read: fetch the next frame, wait up to timeout ticks if none is available
+ *  Returns false on timeout or if the reader is not registered.
+ */
+bool canring_reader::Read(CAN_log_message_t* msg, TickType_t timeout)
+  {
+  canring* ring;
+  while ((ring = m_ring.load()) == NULL || !ring->Fetch(this, msg))
+    {
+    if (timeout == 0 || !Wait(timeout))
+      return false;
+    }
+  return true;
+  }
+
+/**
+ * Wait: block the consumer task until new frames are available, the task
+ *  gets notified by another source, or the timeout expires.
+ *  Returns false on timeout.
+ */
+bool canring_reader::Wait(TickType_t timeout)
+  {
+  m_task = xTaskGetCurrentTaskHandle();
+  m_waiting.store(true);
+  canring* ring = m_ring.load();
+  if (ring && ring->m_head.load() != m_cursor)
+    {
+    m_waiting.store(false);
+    return true;
+    }
+  bool woken = (ulTaskNotifyTake(pdTRUE, timeout) != 0);
+  m_waiting.store(false);
+  return woken;
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// canring
+////////////////////////////////////////////////////////////////////////
+
+canring::canring()
+  {
+  m_slots = NULL;
+  m_size = 1;
+  while (m_size < CONFIG_OVMS_HW_CAN_RING_SIZE)
+    m_size <<= 1;
+  m_mask = m_size - 1;
+  m_writer = NULL;
+  m_head = 0;
+  for (int i = 0; i < CANRING_MAX_READERS; i++)
+    m_readers[i] = NULL;
+  m_readercnt = 0;
+  m_notifying = 0;
+  }
+
+canring::~canring()
+  {
+  }
+
+/**
+ * AddReader: register a reader, it will receive frames written from now on
+ */
+bool canring::AddReader(canring_reader* reader)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  if (reader->m_ring.load())
+    return true;
+
+  if (!m_slots)
+    {
+    m_slots = new slot_t[m_size];
+    for (uint32_t i = 0; i < m_size; i++)
+      m_slots[i].seq.store(0, std::memory_order_relaxed);
+    }
+
+  for (int i = 0; i < CANRING_MAX_READERS; i++)
+    {
+    if (m_readers[i].load() == NULL)
+      {
+      reader->m_cursor = m_head.load();
+      reader->m_ring = this;
+      m_readers[i].store(reader);
+      m_readercnt.fetch_add(1);
+      return true;
+      }
+    }
+
+  ESP_LOGE(TAG, "AddReader: no free slot for '%s'", reader->m_name);
+  return false;
+  }
+
+/**
+ * RemoveReader: deregister a reader
+ *  On return, the writer no longer accesses the reader.
+ */
+void canring::RemoveReader(canring_reader* reader)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  for (int i = 0; i < CANRING_MAX_READERS; i++)
+    {
+    if (m_readers[i].load() == reader)
+      {
+      m_readers[i].store(NULL);
+      m_readercnt.fetch_sub(1);
+      }
+    }
+  reader->m_ring = NULL;
+
+  // wait for the writer to finish a running notification pass:
+  while (m_notifying.load())
+    vTaskDelay(1);
+  }
+
+/**
+ * Write: add a frame to the ring & wake up waiting readers
+ *  Called by the writer task only (single producer, see SetWriter()).
+ */
+void canring::Write(CAN_log_type_t type, const CAN_frame_t* frame)
+  {
+  // A second producer would corrupt the head & slots:
+  assert(m_writer == NULL || xTaskGetCurrentTaskHandle() == m_writer);
+
+  if (m_readercnt.load(std::memory_order_acquire) == 0)
+    return;
+
+  uint32_t pos = m_head.load(std::memory_order_relaxed);
+  slot_t &slot = m_slots[pos & m_mask];
+  slot.seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.msg.type = type;
+  gettimeofday(&slot.msg.timestamp, NULL);
+  memcpy(&slot.msg.frame, frame, sizeof(CAN_frame_t));
+  slot.seq.store(pos + 1, std::memory_order_release);
+  m_head.store(pos + 1);
+
+  // Notify waiting readers (the head store above & the waiting flag check
+  // pair with the flag store & head check in canring_reader::Wait()):
+  m_notifying.store(1);
+  for (int i = 0; i < CANRING_MAX_READERS; i++)
+    {
+    canring_reader* reader = m_readers[i].load();
+    if (reader && reader->m_waiting.load() && reader->m_waiting.exchange(false))
+      xTaskNotifyGive(reader->m_task.load());
+    }
+  m_notifying.store(0);
+  }
+
+/**
+ * Fetch: get the next frame for a reader without waiting
+ *  Called by the reader task only.
+ */
+bool canring::Fetch(canring_reader* reader, CAN_log_message_t* msg)
+  {
+  uint32_t &cursor = reader->m_cursor;
+  while (true)
+    {
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    if (cursor == head)
+      return false;
+
+    // skip frames already overwritten:
+    if (head - cursor > m_size)
+      {
+      reader->m_lost += head - cursor - m_size;
+      cursor = head - m_size;
+      }
+
+    slot_t &slot = m_slots[cursor & m_mask];
+    uint32_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq == cursor + 1)
+      {
+      memcpy(msg, &slot.msg, sizeof(CAN_log_message_t));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != seq)
+        seq = 0;
+      }
+    cursor++;
+
+    if (seq != cursor)
+      {
+      // overwritten while reading:
+      reader->m_lost++;
+      continue;
+      }
+    if (msg->type == CAN_LogFrame_TX && !reader->m_txfeedback)
+      continue;
+
+    reader->m_read++;
+    return true;
+    }
+  }
+
+void canring::Status(int verbosity, OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  if (!m_slots)
+    {
+    writer->printf("CAN ring: %u slots, no readers registered yet\n", m_size);
+    return;
+    }
+
+  uint32_t head = m_head.load();
+  writer->printf("CAN ring: %u slots, %u frames written, %d readers\n",
+    m_size, head, m_readercnt.load());
+  for (int i = 0; i < CANRING_MAX_READERS; i++)
+    {
+    canring_reader* reader = m_readers[i].load();
+    if (!reader) continue;
+    uint32_t backlog = head - reader->m_cursor;
+    writer->printf("  %-16s read: %u  lost: %u  backlog: %u%s\n",
+      reader->m_name, reader->m_read, reader->m_lost,
+      (backlog > m_size) ? m_size : backlog,
+      reader->m_txfeedback ? "  (+tx)" : "");
+    }
+  }
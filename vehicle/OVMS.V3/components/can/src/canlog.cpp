@@ -243,6 +243,8 @@ void canlogconnection::OutputMsg(CAN_log_message_t& msg, std::string &result)
       if (m_nc->send_mbuf.len < 32768)
         {
         mg_send(m_nc, (const char*)result.c_str(), result.length());
+        // we're usually called by the logger task, let the network task send now:
+        MyNetManager.MongooseWakeup();
         }
       else
         {
@@ -266,6 +268,7 @@ void canlogconnection::TransmitCallback(uint8_t *buffer, size_t len)
   if ((m_nc != NULL)&&(m_nc->send_mbuf.len < 32768))
     {
     mg_send(m_nc, buffer, len);
+    MyNetManager.MongooseWakeup();
     }
   else
 #endif // CONFIG_OVMS_SC_GPL_MONGOOSE
@@ -338,7 +341,7 @@ std::string canlogconnection::GetStats()
 ////////////////////////////////////////////////////////////////////////
 
 canlog::canlog(const char* type, std::string format, canformat::canformat_serve_mode_t mode)
-  : m_events_filters(TAG), m_metrics_filters(TAG)
+  : m_reader(type, true), m_events_filters(TAG), m_metrics_filters(TAG)
   {
   m_type = type;
   m_format = format;
@@ -351,6 +354,7 @@ canlog::canlog(const char* type, std::string format, canformat::canformat_serve_
   m_msgcount = 0;
   m_dropcount = 0;
   m_filtercount = 0;
+  m_ringlost = 0;
 
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -369,6 +373,7 @@ canlog::~canlog()
   {
   MyEvents.DeregisterEvent(IDTAG);
   MyMetrics.DeregisterListener(IDTAG);
+  MyCan.DeregisterReader(&m_reader);
 
   if (m_task)
     {
@@ -420,7 +425,24 @@ void canlog::RxTask(void *context)
   CAN_log_message_t msg;
   while (1)
     {
-    if (xQueueReceive(me->m_queue, &msg, (portTickType)portMAX_DELAY) == pdTRUE)
+    bool idle = true;
+
+    // Frames from the CAN ring:
+    if (me->m_reader.Read(&msg, 0))
+      {
+      me->LogRingFrame(msg);
+      idle = false;
+      }
+    uint32_t lost = me->m_reader.GetLost();
+    if (lost != me->m_ringlost)
+      {
+      me->m_msgcount += lost - me->m_ringlost;
+      me->m_dropcount += lost - me->m_ringlost;
+      me->m_ringlost = lost;
+      }
+
+    // Other messages from the queue (alternating, so none of both starves):
+    if (xQueueReceive(me->m_queue, &msg, 0) == pdTRUE)
       {
       switch (msg.type)
         {
@@ -435,8 +457,41 @@ void canlog::RxTask(void *context)
           me->OutputMsg(msg);
           break;
         }
+      idle = false;
       }
+
+    // Wait for ring frames or a queue notification:
+    if (idle)
+      me->m_reader.Wait(portMAX_DELAY);
+    }
+  }
+
+/**
+ * LogRingFrame: filter & output a frame read from the CAN ring
+ */
+void canlog::LogRingFrame(CAN_log_message_t& msg)
+  {
+  if (!IsOpen()) return;
+
+  if ((m_filter == NULL)||(m_filter->IsFiltered(&msg.frame)))
+    {
+    m_msgcount++;
+    OutputMsg(msg);
     }
+  else
+    {
+    m_filtercount++;
+    }
+  }
+
+/**
+ * Notify: wake up the logger task for a queued message
+ */
+void canlog::Notify()
+  {
+  TaskHandle_t task = m_task;
+  if (task)
+    xTaskNotifyGive(task);
   }
 
 /**
@@ -625,6 +680,7 @@ void canlog::LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame
     msg.frame.origin = bus;
     m_msgcount++;
     if (xQueueSend(m_queue, &msg, 0) != pdTRUE) m_dropcount++;
+    else Notify();
     }
   else
     {
@@ -645,6 +701,7 @@ void canlog::LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* sta
     memcpy(&msg.status,status,sizeof(CAN_status_t));
     m_msgcount++;
     if (xQueueSend(m_queue, &msg, 0) != pdTRUE) m_dropcount++;
+    else Notify();
     }
   else
     {
@@ -669,6 +726,10 @@ void canlog::LogInfo(canbus* bus, CAN_log_type_t type, const char* text)
       m_dropcount++;
       free(msg.text);
       }
+    else
+      {
+      Notify();
+      }
     }
   else
     {
@@ -149,7 +149,9 @@ class canlog : public InternalRamAllocated
 
   public:
     TaskHandle_t        m_task;
-    QueueHandle_t       m_queue;
+    QueueHandle_t       m_queue;          // Status & info messages, TX queue/fail frames
+    canring_reader      m_reader;         // Received & transmitted frames
+    uint32_t            m_ringlost;       // … frames lost accounted for
     bool                m_isopen;
     uint32_t            m_msgcount;
     uint32_t            m_dropcount;
@@ -158,6 +160,8 @@ class canlog : public InternalRamAllocated
   protected:
     virtual void UpdatedConfig(std::string event, void* data);
     virtual void LoadConfig();
+    void LogRingFrame(CAN_log_message_t& msg);
+    void Notify();
 
   protected:
     IdFilter            m_events_filters;
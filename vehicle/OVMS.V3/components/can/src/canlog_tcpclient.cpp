@@ -163,6 +163,7 @@ bool canlog_tcpclient::Open()
       opts.error_string = &err;
       if (mg_connect_opt(mgr, m_path.c_str(), tcMongooseHandler, opts) != NULL)
         {
+        MyNetManager.MongooseWakeup();
         // Wait 10s max for connection establishment...
         m_connecting.Take(pdMS_TO_TICKS(10*1000));
         return m_isopen;
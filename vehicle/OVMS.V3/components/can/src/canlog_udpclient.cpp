@@ -152,6 +152,7 @@ bool canlog_udpclient::Open()
         clc->m_peer = m_path;
         m_connmap[nc] = clc;
         m_isopen = true;
+        MyNetManager.MongooseWakeup();
         return true;
         }
       else
@@ -183,7 +183,7 @@ canlog_udpserver::canlog_udpserver(std::string path, std::string format, canform
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG,"ticker.10", std::bind(&canlog_udpserver::Ticker, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.10", std::bind(&canlog_udpserver::Ticker, this, _1, _2));
   }
 
 canlog_udpserver::~canlog_udpserver()
@@ -258,7 +258,7 @@ std::string canlog_udpserver::GetInfo()
   return result;
   }
 
-void canlog_udpserver::Ticker(std::string event, void* data)
+void canlog_udpserver::Ticker(const char* event, void* data)
   {
   OvmsRecMutexLock lock(&m_cmmutex);
 
@@ -67,7 +67,7 @@ class canlog_udpserver : public canlog
 
   public:
     void MongooseHandler(struct mg_connection *nc, int ev, void *p);
-    void Ticker(std::string event, void* data);
+    void Ticker(const char* event, void* data);
 
   public:
     struct mg_connection *m_mgconn;
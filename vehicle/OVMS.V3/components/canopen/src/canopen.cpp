@@ -40,11 +40,11 @@ static const char *TAG = "canopen";
 CANopen MyCANopen __attribute__ ((init_priority (7000)));
 
 CANopen::CANopen()
+  : m_rxreader(TAG)
   {
   ESP_LOGI(TAG, "Initialising CANopen (7000)");
 
   m_rxtask = NULL;
-  m_rxqueue = NULL;
 
   for (int i=0; i < CAN_INTERFACE_CNT; i++)
     m_worker[i] = NULL;
@@ -70,8 +70,9 @@ CANopen::CANopen()
     cmd_nmt->RegisterCommand("reset", "Reset node", shell_nmt, "[nodeid=0] [timeout_ms=0]", 0, 2);
     cmd_nmt->RegisterCommand("commreset", "Reset communication layer", shell_nmt, "[nodeid=0] [timeout_ms=0]", 0, 2);
 
-    cmd_canx->RegisterCommand("readsdo", "Read SDO register", shell_readsdo, "<nodeid> <index_hex> <subindex_hex> [timeout_ms=50]", 3, 4);
-    cmd_canx->RegisterCommand("writesdo", "Write SDO register", shell_writesdo, "<nodeid> <index_hex> <subindex_hex> <value> [timeout_ms=50]", 4, 5);
+    cmd_canx->RegisterCommand("readsdo", "Read SDO register", shell_readsdo, "<nodeid> <index_hex> <subindex_hex> [timeout_ms=50] [blksize=0]", 3, 5);
+    cmd_canx->RegisterCommand("writesdo", "Write SDO register", shell_writesdo, "<nodeid> <index_hex> <subindex_hex> <value> [timeout_ms=50] [blksize=0]", 4, 6);
+    cmd_canx->RegisterCommand("tpdo", "Show TPDO configuration", shell_tpdo, "<nodeid> <pdonum> [timeout_ms=50]", 2, 3);
 
     cmd_canx->RegisterCommand("info", "Show node info", shell_info, "<nodeid> [timeout_ms=50]", 1, 2);
     cmd_canx->RegisterCommand("scan", "Scan nodes", shell_scan, "[[startid=1][-][endid=127]] [timeout_ms=50]", 0, 2);
@@ -87,7 +88,7 @@ CANopen::~CANopen()
     }
   if (m_rxtask)
     {
-    vQueueDelete(m_rxqueue);
+    MyCan.DeregisterReader(&m_rxreader);
     vTaskDelete(m_rxtask);
     }
   }
@@ -105,17 +106,17 @@ static void CANopenRxTask(void *pvParameters)
 
 void CANopen::CanRxTask()
   {
-  CAN_frame_t frame;
+  CAN_log_message_t msg;
 
   while(1)
     {
-    if (xQueueReceive(m_rxqueue, &frame, (portTickType)portMAX_DELAY) == pdTRUE)
+    if (m_rxreader.Read(&msg, portMAX_DELAY))
       {
       for (int i=0; i < CAN_INTERFACE_CNT; i++)
         {
-        if (m_worker[i] && m_worker[i]->m_bus == frame.origin)
+        if (m_worker[i] && m_worker[i]->m_bus == msg.frame.origin)
           {
-          m_worker[i]->IncomingFrame(&frame);
+          m_worker[i]->IncomingFrame(&msg.frame);
           break;
           }
         }
@@ -139,10 +140,9 @@ CANopenWorker* CANopen::Start(canbus* bus)
   // start CAN rx task:
   if (m_rxtask == NULL)
     {
-    m_rxqueue = xQueueCreate(20, sizeof(CAN_frame_t));
     xTaskCreatePinnedToCore(CANopenRxTask, "OVMS COrx",
       CONFIG_OVMS_COMP_CANOPEN_RX_STACK, (void*)this, 15, &m_rxtask, CORE(0));
-    MyCan.RegisterListener(m_rxqueue);
+    MyCan.RegisterReader(&m_rxreader);
     }
 
   // start worker:
@@ -185,10 +185,8 @@ bool CANopen::Stop(canbus* bus)
       if (--m_workercnt == 0)
         {
         // last worker stopped, stop CAN rx task:
-        MyCan.DeregisterListener(m_rxqueue);
-        vQueueDelete(m_rxqueue);
+        MyCan.DeregisterReader(&m_rxreader);
         vTaskDelete(m_rxtask);
-        m_rxqueue = NULL;
         m_rxtask = NULL;
         }
 
@@ -377,6 +375,7 @@ const std::string CANopen::GetResultString(const CANopenResult_t result)
     case COR_ERR_Timeout:               name = "Timeout"; break;
     case COR_ERR_SDO_Access:            name = "SDO access failed"; break;
     case COR_ERR_SDO_SegMismatch:       name = "SDO segment mismatch"; break;
+    case COR_ERR_SDO_CRC:               name = "SDO block CRC mismatch"; break;
 
     case COR_ERR_DeviceOffline:         name = "Device offline"; break;
     case COR_ERR_UnknownDevice:         name = "Unknown device"; break;
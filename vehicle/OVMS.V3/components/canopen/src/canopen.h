@@ -37,6 +37,13 @@
 
 #define CAN_INTERFACE_CNT         4
 
+#ifndef CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS
+#define CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS  2
+#endif
+
+#define CANopen_BlockSize         16          // default SDO block size [segments], max 127
+#define CANopen_BlockThreshold    21          // min object size [bytes] for SDO block transfers
+
 #define CANopen_GeneralError      0x08000000  // check for device specific error details
 #define CANopen_BusCollision      0xffffffff  // another master is active / non-CANopen frame received
 
@@ -57,6 +64,7 @@ typedef enum __attribute__ ((__packed__))
   COR_ERR_Timeout,
   COR_ERR_SDO_Access,
   COR_ERR_SDO_SegMismatch,
+  COR_ERR_SDO_CRC,
   
   // General purpose application level:
   COR_ERR_DeviceOffline = 0x80,
@@ -163,6 +171,7 @@ struct __attribute__ ((__packed__)) CANopenJob
       size_t                xfersize;       // byte count sent / received
       size_t                contsize;       // content size of SDO (if indicated by slave)
       uint32_t              error;          // CANopen general error code
+      uint8_t               blksize;        // block transfer: segments per block, 0 = off
       } sdo;
     };
   
@@ -208,26 +217,121 @@ typedef union __attribute__ ((__packed__))
   } CANopenFrame_t;
 
 
+/**
+ * CANopenPDOMap: TPDO communication & mapping parameters
+ *
+ * Use CANopenClient::WriteTPDO() to let a node transmit the mapped objects
+ *   by itself (cyclic or event driven), and Decode() to extract the object
+ *   values from the PDO frames received. This avoids the request/response
+ *   overhead of polling the objects via SDO.
+ *
+ * Note: most devices only accept mapping changes in pre-operational state.
+ */
+
+#define CANopen_PDOMaxObjects     8           // max objects mapped per PDO
+#define CANopen_PDOInvalid        0x80000000  // COB-ID flag: PDO disabled
+#define CANopen_PDONoRTR          0x40000000  // COB-ID flag: no RTR allowed
+
+typedef struct __attribute__ ((__packed__))
+  {
+  uint16_t              index;          // object register address
+  uint8_t               subindex;       // object subregister address
+  uint8_t               bits;           // object size in bits (1…32)
+  } CANopenPDOObject_t;
+
+struct CANopenPDOMap
+  {
+  uint16_t              pdonum;         // 1…512 → comm params 0x1800+pdonum-1, mapping 0x1A00+pdonum-1
+  uint32_t              cobid;          // COB-ID incl. flags, 0 = CiA DS301 default (TPDO 1-4 only)
+  uint8_t               transmission;   // 1…240 = every n SYNCs, 254/255 = event driven
+  uint16_t              inhibit;        // min transmission interval [100 µs], 0 = none
+  uint16_t              eventtimer;     // cyclic transmission interval [ms], 0 = off
+  uint8_t               count;          // number of objects mapped
+  CANopenPDOObject_t    object[CANopen_PDOMaxObjects];
+
+  void Init(uint16_t p_pdonum, uint32_t p_cobid=0, uint8_t p_transmission=254,
+    uint16_t p_eventtimer=0, uint16_t p_inhibit=0);
+  bool Add(uint16_t index, uint8_t subindex, uint8_t bits);
+  int GetSize() const;
+  uint32_t GetCobId(uint8_t nodeid) const;
+  bool Decode(const CAN_frame_t* frame, uint32_t* values) const;
+  };
+
+
 /**
  * A CANopenWorker processes CANopenJobs on a specific bus.
  * 
  * CANopenClients create and submit Jobs to be processed to a CANopenWorker.
  * After finish/abort, the Worker sends the Job to the clients done queue.
  * 
+ * Jobs are executed by CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS CANopenNodeWorkers,
+ * so transfers to different nodes can run concurrently.
+ * 
  * A CANopenWorker also monitors the bus for emergency and heartbeat
  * messages, and translates these into events and metrics updates.
  */
 
 typedef std::forward_list<CANopenAsyncClient*> CANopenClientList;
 
+class CANopenWorker;
+
+/**
+ * A CANopenNodeWorker executes the jobs for the nodes assigned to it.
+ * 
+ * A node is assigned to a node worker on job submission and stays assigned
+ * as long as jobs for the node are pending, so jobs for a node are processed
+ * in order, one at a time.
+ */
+class CANopenNodeWorker final
+  {
+  public:
+    CANopenNodeWorker(CANopenWorker* worker, int index);
+    ~CANopenNodeWorker();
+
+  public:
+    void JobTask();
+    void IncomingFrame(CAN_frame_t* frame);
+
+  protected:
+    CANopenResult_t ProcessSendNMTJob();
+    CANopenResult_t ProcessReceiveHBJob();
+    CANopenResult_t ProcessReadSDOJob();
+    CANopenResult_t ProcessWriteSDOJob();
+    CANopenResult_t ProcessReadSDOBlock();
+    CANopenResult_t ProcessWriteSDOBlock();
+
+  private:
+    void SendSDORequest(TickType_t maxqueuewait=0);
+    void AbortSDORequest(uint32_t reason);
+    CANopenResult_t ExecuteSDORequest();
+    bool ReceiveResponse(TickType_t maxwait);
+
+  public:
+    CANopenWorker*        m_worker;
+    canbus*               m_bus;
+
+    char                  m_taskname[16];   // "OVMS COcanX/n"
+    TaskHandle_t          m_jobtask;        // node worker task
+    QueueHandle_t         m_jobqueue;       // job rx queue
+    QueueHandle_t         m_rxqueue;        // response frame queue
+    int                   m_jobcnt;         // jobs assigned (queued + processing)
+
+    CANopenJob            m_job;            // job currently processed
+
+  private:
+    CANopenFrame_t        m_request;
+    CANopenFrame_t        m_response;
+  };
+
 class CANopenWorker final
   {
+  friend class CANopenNodeWorker;
+
   public:
     CANopenWorker(canbus* canbus);
     ~CANopenWorker();
   
   public:
-    void JobTask();
     void IncomingFrame(CAN_frame_t* frame);
     void Open(CANopenAsyncClient* client);
     void Close(CANopenAsyncClient* client);
@@ -239,24 +343,15 @@ class CANopenWorker final
     CANopenResult_t SubmitJob(CANopenJob& job, TickType_t maxqueuewait=0);
   
   protected:
-    CANopenResult_t ProcessSendNMTJob();
-    CANopenResult_t ProcessReceiveHBJob();
-    CANopenResult_t ProcessReadSDOJob();
-    CANopenResult_t ProcessWriteSDOJob();
-  
-  private:
-    void SendSDORequest();
-    void AbortSDORequest(uint32_t reason);
-    CANopenResult_t ExecuteSDORequest();
+    void JobDone(CANopenNodeWorker* nodeworker, CANopenJob& job, bool dropped=false);
 
   public:
     canbus*               m_bus;            // max one worker per bus
     int                   m_clientcnt;
     CANopenClientList     m_clients;
     
-    char                  m_taskname[12];   // "COwrk canX"
-    TaskHandle_t          m_jobtask;        // worker task
-    QueueHandle_t         m_jobqueue;       // job rx queue
+    CANopenNodeWorker*    m_nodeworker[CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS];
+    SemaphoreHandle_t     m_mutex;          // protects clients & job routing
     
     uint32_t              m_nmt_rxcnt;
     uint32_t              m_emcy_rxcnt;
@@ -264,13 +359,11 @@ class CANopenWorker final
     uint32_t              m_jobcnt_timeout;
     uint32_t              m_jobcnt_error;
     
-    CANopenJob            m_job;            // job currently processed
-    
     CANopenNodeMetricsMap m_nodemetrics;    // map: nodeid → node metrics
 
   private:
-    CANopenFrame_t        m_request;
-    CANopenFrame_t        m_response;
+    int8_t                m_noderoute[128]; // nodeid → node worker index, -1 = unassigned
+    uint8_t               m_nodejobs[128];  // nodeid → jobs pending
   };
 
 
@@ -330,9 +423,14 @@ class CANopenAsyncClient
     CANopenResult_t WriteSDO(uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
   
+  public:
+    // Block transfer:
+    void SetBlockTransfer(uint8_t blksize=CANopen_BlockSize);
+
   public:
     CANopenWorker*        m_worker;
     QueueHandle_t         m_done_queue;
+    uint8_t               m_blksize;        // SDO block size for new jobs, 0 = off
   };
 
 
@@ -365,7 +463,16 @@ class CANopenClient : public CANopenAsyncClient
       int resp_timeout_ms=100, int max_tries=3);
     CANopenResult_t WriteSDO(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
-  
+
+  public:
+    // PDO configuration:
+    CANopenResult_t ReadTPDO(CANopenJob& job, uint8_t nodeid, uint16_t pdonum, CANopenPDOMap& map,
+      int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t WriteTPDO(CANopenJob& job, uint8_t nodeid, const CANopenPDOMap& map,
+      int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t DisableTPDO(CANopenJob& job, uint8_t nodeid, uint16_t pdonum,
+      int resp_timeout_ms=100, int max_tries=3);
+
   public:
     SemaphoreHandle_t m_mutex;              // thread mutex
   };
@@ -409,11 +516,12 @@ class CANopen final
     static void shell_nmt(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_readsdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_writesdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_tpdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_info(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_scan(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
 
   public:
-    QueueHandle_t         m_rxqueue;    // CAN rx queue
+    canring_reader        m_rxreader;   // CAN frame ring reader
     TaskHandle_t          m_rxtask;     // CAN rx task
 
     CANopenWorker*        m_worker[CAN_INTERFACE_CNT];
@@ -26,6 +26,7 @@
 #include "ovms_log.h"
 static const char *TAG = "canopen";
 
+#include <algorithm>
 #include "canopen.h"
 
 
@@ -58,6 +59,7 @@ CANopenAsyncClient::CANopenAsyncClient(CANopenWorker* worker, int queuesize /*=2
   m_worker = worker;
   m_worker->Open(this);
   m_done_queue = xQueueCreate(queuesize, sizeof(CANopenJob));
+  m_blksize = 0;
   }
 
 CANopenAsyncClient::CANopenAsyncClient(canbus *bus, int queuesize /*=20*/)
@@ -65,6 +67,7 @@ CANopenAsyncClient::CANopenAsyncClient(canbus *bus, int queuesize /*=20*/)
   m_worker = MyCANopen.Start(bus);
   m_worker->Open(this);
   m_done_queue = xQueueCreate(queuesize, sizeof(CANopenJob));
+  m_blksize = 0;
   }
 
 CANopenAsyncClient::~CANopenAsyncClient()
@@ -74,6 +77,20 @@ CANopenAsyncClient::~CANopenAsyncClient()
   }
 
 
+/**
+ * SetBlockTransfer: enable SDO block transfers for ReadSDO / WriteSDO jobs
+ *    - blksize: segments per block (1…CANopen_BlockSize), 0 = disable
+ *    - only affects jobs initialized after the call
+ *    - uploads may be switched to the normal protocol by the server for small
+ *      objects, downloads use block transfer from CANopen_BlockThreshold bytes
+ *    - nodes without block support are retried using the normal protocol
+ */
+void CANopenAsyncClient::SetBlockTransfer(uint8_t blksize /*=CANopen_BlockSize*/)
+  {
+  m_blksize = std::min<uint8_t>(blksize, CANopen_BlockSize);
+  }
+
+
 /**
  * SubmitDoneCallback: called by the worker to send us a job result
  *    - this should normally not be called by the application
@@ -176,6 +193,7 @@ void CANopenAsyncClient::InitReadSDO(CANopenJob& job,
   job.sdo.subindex = subindex;
   job.sdo.buf = buf;
   job.sdo.bufsize = bufsize;
+  job.sdo.blksize = m_blksize;
   
   job.txid = 0x600 + nodeid;
   job.rxid = 0x580 + nodeid;
@@ -199,6 +217,7 @@ void CANopenAsyncClient::InitWriteSDO(CANopenJob& job,
   job.sdo.subindex = subindex;
   job.sdo.buf = buf;
   job.sdo.bufsize = bufsize;
+  job.sdo.blksize = m_blksize;
   
   job.txid = 0x600 + nodeid;
   job.rxid = 0x580 + nodeid;
@@ -0,0 +1,280 @@
+/**
+ * Project:      Open Vehicle Monitor System
+ * Module:       CANopen
+ * 
+ * (c) 2017  Michael Balzer <dexter@dexters-web.de>
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/param.h>
+
+#include "ovms_log.h"
+static const char *TAG = "canopen";
+
+#include "canopen.h"
+
+#define SDO_Abort_NoSubIndex        0x06090011
+
+
+/**
+ * CANopenPDOMap: TPDO communication & mapping parameters
+ *
+ * Example: let node 1 send two INT16 objects every 20 ms on TPDO 5:
+ *
+ *   CANopenPDOMap map;
+ *   map.Init(5, 0x4a1, 254, 20);
+ *   map.Add(0x4600, 0x0c, 16);
+ *   map.Add(0x4600, 0x0d, 16);
+ *   client.WriteTPDO(job, 1, map);
+ *
+ * …then in the CAN rx handler:
+ *
+ *   uint32_t values[CANopen_PDOMaxObjects];
+ *   if (frame->MsgID == 0x4a1 && map.Decode(frame, values))
+ *     current = (int16_t) values[0]; …
+ */
+
+void CANopenPDOMap::Init(uint16_t p_pdonum, uint32_t p_cobid /*=0*/, uint8_t p_transmission /*=254*/,
+    uint16_t p_eventtimer /*=0*/, uint16_t p_inhibit /*=0*/)
+  {
+  memset(this, 0, sizeof(*this));
+  pdonum = p_pdonum;
+  cobid = p_cobid;
+  transmission = p_transmission;
+  eventtimer = p_eventtimer;
+  inhibit = p_inhibit;
+  }
+
+/**
+ * Add: append an object to the mapping
+ *    - returns false if the object does not fit into the PDO
+ */
+bool CANopenPDOMap::Add(uint16_t index, uint8_t subindex, uint8_t bits)
+  {
+  int offset = 0;
+  for (int i=0; i < count; i++)
+    offset += object[i].bits;
+  if (count >= CANopen_PDOMaxObjects || bits < 1 || bits > 32 || offset + bits > 64)
+    return false;
+  object[count].index = index;
+  object[count].subindex = subindex;
+  object[count].bits = bits;
+  count++;
+  return true;
+  }
+
+/**
+ * GetSize: PDO data length in bytes
+ */
+int CANopenPDOMap::GetSize() const
+  {
+  int bits = 0;
+  for (int i=0; i < count; i++)
+    bits += object[i].bits;
+  return (bits + 7) / 8;
+  }
+
+/**
+ * GetCobId: get CAN ID of the PDO for a node, 0 = undefined
+ */
+uint32_t CANopenPDOMap::GetCobId(uint8_t nodeid) const
+  {
+  if (cobid & 0x7ff)
+    return cobid & 0x7ff;
+  else if (pdonum >= 1 && pdonum <= 4)
+    return 0x080 + (pdonum << 8) + nodeid;
+  else
+    return 0;
+  }
+
+/**
+ * Decode: extract the mapped object values from a PDO frame
+ *    - values receives the raw (unsigned) value of each object,
+ *      cast to the object data type to get signed values
+ *    - returns false if the frame is too short for the mapping
+ */
+bool CANopenPDOMap::Decode(const CAN_frame_t* frame, uint32_t* values) const
+  {
+  if (frame->FIR.B.DLC < GetSize())
+    return false;
+
+  // CANopen is little endian, objects are packed LSB first:
+  uint64_t data = 0;
+  for (int i=0; i < frame->FIR.B.DLC; i++)
+    data |= (uint64_t)frame->data.u8[i] << (i*8);
+
+  for (int i=0; i < count; i++)
+    {
+    uint8_t bits = object[i].bits;
+    values[i] = (bits == 32) ? (uint32_t) data : (uint32_t) data & ((1UL << bits) - 1);
+    data >>= bits;
+    }
+
+  return true;
+  }
+
+
+/**
+ * [Main API]
+ * ReadTPDO: read TPDO communication & mapping parameters of a node
+ *   - the COB-ID is returned as read, i.e. including flags
+ *   - optional parameters not supported by the node are returned as 0
+ */
+CANopenResult_t CANopenClient::ReadTPDO(CANopenJob& job,
+    uint8_t nodeid, uint16_t pdonum, CANopenPDOMap& map,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  if (pdonum < 1 || pdonum > 512)
+    return job.SetResult(COR_ERR_ParamRange);
+
+  uint16_t commidx = 0x1800 + pdonum - 1;
+  uint16_t mapidx = 0x1a00 + pdonum - 1;
+  uint32_t val;
+
+  map.Init(pdonum);
+
+  // communication parameters:
+  if (ReadSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  map.cobid = val;
+  if (ReadSDO(job, nodeid, commidx, 0x02, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  map.transmission = val;
+  if (ReadSDO(job, nodeid, commidx, 0x03, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) == COR_OK)
+    map.inhibit = val;
+  else if (job.sdo.error != SDO_Abort_NoSubIndex)
+    return job.result;
+  if (ReadSDO(job, nodeid, commidx, 0x05, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) == COR_OK)
+    map.eventtimer = val;
+  else if (job.sdo.error != SDO_Abort_NoSubIndex)
+    return job.result;
+
+  // mapping:
+  if (ReadSDO(job, nodeid, mapidx, 0x00, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  int count = MIN(val, CANopen_PDOMaxObjects);
+  for (int i=1; i <= count; i++)
+    {
+    if (ReadSDO(job, nodeid, mapidx, i, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+      return job.result;
+    // mapping entry: index << 16 | subindex << 8 | bits
+    map.object[map.count].index = val >> 16;
+    map.object[map.count].subindex = (val >> 8) & 0xff;
+    map.object[map.count].bits = val & 0xff;
+    map.count++;
+    }
+
+  return job.SetResult(COR_OK);
+  }
+
+
+/**
+ * [Main API]
+ * WriteTPDO: configure a TPDO of a node
+ *   - follows the CiA DS301 procedure: disable PDO, set communication parameters,
+ *     clear mapping, write mapping entries, set mapping count, enable PDO
+ *   - the node will normally need to be in pre-operational state
+ *   - inhibit time & event timer are skipped if not supported by the node and 0
+ *   - on failure the PDO is left disabled
+ */
+CANopenResult_t CANopenClient::WriteTPDO(CANopenJob& job,
+    uint8_t nodeid, const CANopenPDOMap& map,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  uint32_t cobid = map.GetCobId(nodeid);
+  if (map.pdonum < 1 || map.pdonum > 512 || map.count == 0 || cobid == 0)
+    return job.SetResult(COR_ERR_ParamRange);
+
+  uint16_t commidx = 0x1800 + map.pdonum - 1;
+  uint16_t mapidx = 0x1a00 + map.pdonum - 1;
+  uint32_t val;
+  uint16_t val16;
+  uint8_t val8;
+
+  ESP_LOGD(TAG, "WriteTPDO: node=%d pdo=%d cobid=0x%03" PRIx32 " objects=%d", nodeid, map.pdonum, cobid, map.count);
+
+  // disable PDO:
+  if (ReadSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  if ((val & CANopen_PDOInvalid) == 0)
+    {
+    val |= CANopen_PDOInvalid;
+    if (WriteSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+      return job.result;
+    }
+
+  // communication parameters:
+  val8 = map.transmission;
+  if (WriteSDO(job, nodeid, commidx, 0x02, &val8, 1, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  val16 = map.inhibit;
+  if (WriteSDO(job, nodeid, commidx, 0x03, (uint8_t*)&val16, 2, resp_timeout_ms, max_tries) != COR_OK
+      && (map.inhibit != 0 || job.sdo.error != SDO_Abort_NoSubIndex))
+    return job.result;
+  val16 = map.eventtimer;
+  if (WriteSDO(job, nodeid, commidx, 0x05, (uint8_t*)&val16, 2, resp_timeout_ms, max_tries) != COR_OK
+      && (map.eventtimer != 0 || job.sdo.error != SDO_Abort_NoSubIndex))
+    return job.result;
+
+  // mapping:
+  val8 = 0;
+  if (WriteSDO(job, nodeid, mapidx, 0x00, &val8, 1, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  for (int i=0; i < map.count; i++)
+    {
+    val = (uint32_t)map.object[i].index << 16 | (uint32_t)map.object[i].subindex << 8 | map.object[i].bits;
+    if (WriteSDO(job, nodeid, mapidx, i+1, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+      return job.result;
+    }
+  val8 = map.count;
+  if (WriteSDO(job, nodeid, mapidx, 0x00, &val8, 1, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+
+  // enable PDO:
+  val = (map.cobid & CANopen_PDONoRTR) | cobid;
+  if (WriteSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+
+  return job.SetResult(COR_OK);
+  }
+
+
+/**
+ * [Main API]
+ * DisableTPDO: stop transmission of a TPDO
+ *   - sets the invalid flag of the COB-ID, the mapping is kept
+ */
+CANopenResult_t CANopenClient::DisableTPDO(CANopenJob& job,
+    uint8_t nodeid, uint16_t pdonum,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  if (pdonum < 1 || pdonum > 512)
+    return job.SetResult(COR_ERR_ParamRange);
+
+  uint16_t commidx = 0x1800 + pdonum - 1;
+  uint32_t val;
+
+  if (ReadSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries) != COR_OK)
+    return job.result;
+  if (val & CANopen_PDOInvalid)
+    return job.SetResult(COR_OK);
+  val |= CANopen_PDOInvalid;
+  return WriteSDO(job, nodeid, commidx, 0x01, (uint8_t*)&val, 4, resp_timeout_ms, max_tries);
+  }
@@ -127,7 +127,7 @@ void CANopen::shell_nmt(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int
 
 
 // Shell command:
-//    co canX readsdo <nodeid> <index_hex> <subindex_hex> [timeout_ms=50]
+//    co canX readsdo <nodeid> <index_hex> <subindex_hex> [timeout_ms=50] [blksize=0]
 void CANopen::shell_readsdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   const char* busname = cmd->GetParent()->GetName();
@@ -146,6 +146,9 @@ void CANopen::shell_readsdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd,
   int timeout = 50;
   if (argc >= 4)
     timeout = strtol(argv[3], NULL, 10);
+  int blksize = 0;
+  if (argc >= 5)
+    blksize = strtol(argv[4], NULL, 10);
   
   if (nodeid < 1 || nodeid > 127)
     {
@@ -161,6 +164,7 @@ void CANopen::shell_readsdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd,
     } buffer;
   
   CANopenClient client(bus);
+  client.SetBlockTransfer(blksize);
   CANopenJob job;
   CANopenResult_t res = client.ReadSDO(job, nodeid, index, subindex, (uint8_t*)&buffer, sizeof(buffer)-1, timeout);
   
@@ -195,7 +199,7 @@ void CANopen::shell_readsdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd,
 
 
 // Shell command:
-//    co canX writesdo <nodeid> <index_hex> <subindex_hex> <value> [timeout_ms=50]
+//    co canX writesdo <nodeid> <index_hex> <subindex_hex> <value> [timeout_ms=50] [blksize=0]
 // <value>:
 // - interpreted as hexadecimal if begins with "0x"
 // - interpreted as decimal if only contains digits
@@ -264,10 +268,14 @@ void CANopen::shell_writesdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd
   int timeout = 50;
   if (argc >= 5)
     timeout = strtol(argv[4], NULL, 10);
+  int blksize = 0;
+  if (argc >= 6)
+    blksize = strtol(argv[5], NULL, 10);
   
   // execute:
   
   CANopenClient client(bus);
+  client.SetBlockTransfer(blksize);
   CANopenJob job;
   CANopenResult_t res = client.WriteSDO(job, nodeid, index, subindex, (uint8_t*)&buffer, bufsize, timeout);
   
@@ -296,6 +304,72 @@ void CANopen::shell_writesdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd
   }
 
 
+// Shell command:
+//    co canX tpdo <nodeid> <pdonum> [timeout_ms=50]
+void CANopen::shell_tpdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  const char* busname = cmd->GetParent()->GetName();
+
+  canbus* bus = (canbus*)MyPcpApp.FindDeviceByName(busname);
+  if (bus == NULL)
+    {
+    writer->puts("Error: Cannot find named CAN bus");
+    return;
+    }
+
+  // parse args:
+  uint8_t nodeid = strtol(argv[0], NULL, 10);
+  uint16_t pdonum = strtol(argv[1], NULL, 10);
+  int timeout = 50;
+  if (argc >= 3)
+    timeout = strtol(argv[2], NULL, 10);
+
+  if (nodeid < 1 || nodeid > 127)
+    {
+    writer->puts("Error: invalid nodeid, allowed range 1-127");
+    return;
+    }
+  if (pdonum < 1 || pdonum > 512)
+    {
+    writer->puts("Error: invalid pdonum, allowed range 1-512");
+    return;
+    }
+
+  // execute:
+  CANopenClient client(bus);
+  CANopenJob job;
+  CANopenPDOMap map;
+  CANopenResult_t res = client.ReadTPDO(job, nodeid, pdonum, map, timeout);
+
+  // output result:
+  if (res != COR_OK)
+    {
+    writer->printf("ReadTPDO #%d TPDO %d failed: %s\n",
+      nodeid, pdonum, CANopen::GetResultString(job).c_str());
+    return;
+    }
+
+  writer->printf(
+    "Node #%d TPDO %d:\n"
+    "  COB-ID      : 0x%03" PRIx32 " (%s)\n"
+    "  Transmission: %d\n"
+    "  Inhibit time: %.1f ms\n"
+    "  Event timer : %d ms\n"
+    "  Mapping     : %d object(s), %d bytes\n"
+    , nodeid, pdonum
+    , map.cobid & 0x1fffffff, (map.cobid & CANopen_PDOInvalid) ? "disabled" : "enabled"
+    , map.transmission
+    , map.inhibit / 10.0f
+    , map.eventtimer
+    , map.count, map.GetSize());
+  for (int i=0; i < map.count; i++)
+    {
+    writer->printf("    %d: 0x%04x.%02x, %d bits\n",
+      i+1, map.object[i].index, map.object[i].subindex, map.object[i].bits);
+    }
+  }
+
+
 // Shell utility:
 //    read and display CANopen node core attributes
 int CANopen::PrintNodeInfo(int capacity, OvmsWriter* writer, canbus* bus, int nodeid,
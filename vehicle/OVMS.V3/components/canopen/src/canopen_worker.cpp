@@ -26,6 +26,7 @@
 #include "ovms_log.h"
 static const char *TAG = "canopen";
 
+#include <algorithm>
 #include "ovms_metrics.h"
 #include "metrics_standard.h"
 #include "ovms_events.h"
@@ -55,14 +56,53 @@ static const char *TAG = "canopen";
 #define SDO_SegmentUnusedMask       0b00001110
 #define SDO_SegmentEnd              0b00000001
 
+// SDO block transfer commands:
+
+#define SDO_BlockUploadRequest      0b10100000
+#define SDO_BlockUploadResponse     0b11000000
+#define SDO_BlockDownloadRequest    0b11000000
+#define SDO_BlockDownloadResponse   0b10100000
+
+#define SDO_BlockCRC                0b00000100
+#define SDO_BlockSizeIndicated      0b00000010
+#define SDO_BlockSubCmdMask         0b00000011    // upload responses: SDO_BlockEnd only
+#define SDO_BlockInit               0b00000000
+#define SDO_BlockEnd                0b00000001
+#define SDO_BlockAck                0b00000010
+#define SDO_BlockStart              0b00000011
+#define SDO_BlockUnusedMask         0b00011100
+
+#define SDO_BlockSegmentLast        0b10000000
+#define SDO_BlockSeqNoMask          0b01111111
+
 // SDO abort reasons:
 
 #define SDO_Abort_SegMismatch       0x05030000
 #define SDO_Abort_Timeout           0x05040000
+#define SDO_Abort_InvalidCmd        0x05040001
+#define SDO_Abort_BlockSize         0x05040002
+#define SDO_Abort_SeqNo             0x05040003
+#define SDO_Abort_CRC               0x05040004
 #define SDO_Abort_OutOfMemory       0x05040005
 
 
-static void CANopenWorkerJobTask(void *pvParameters);
+static void CANopenNodeWorkerJobTask(void *pvParameters);
+
+
+/**
+ * SDOBlockCRC: CRC-16-CCITT as specified for SDO block transfers
+ *  (polynomial x^16 + x^12 + x^5 + 1, initial value 0)
+ */
+static uint16_t SDOBlockCRC(uint16_t crc, const uint8_t* data, size_t len)
+  {
+  while (len--)
+    {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (int i = 0; i < 8; i++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  return crc;
+  }
 
 
 /**
@@ -88,50 +128,67 @@ CANopenWorker::CANopenWorker(canbus* bus)
   m_jobcnt_timeout = 0;
   m_jobcnt_error = 0;
   
-  m_jobqueue = xQueueCreate(20, sizeof(CANopenJob));
-  snprintf(m_taskname, sizeof(m_taskname), "OVMS COwrk %s", bus->GetName());
-  xTaskCreatePinnedToCore(CANopenWorkerJobTask, m_taskname,
-    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_jobtask, CORE(0));
-  
-  memset(&m_job, 0, sizeof(m_job));
-  m_job.type = COJT_None;
+  memset(m_noderoute, -1, sizeof(m_noderoute));
+  memset(m_nodejobs, 0, sizeof(m_nodejobs));
+  m_mutex = xSemaphoreCreateMutex();
   
-  memset(&m_request, 0, sizeof(m_request));
-  memset(&m_response, 0, sizeof(m_response));
+  for (int i=0; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+    m_nodeworker[i] = new CANopenNodeWorker(this, i);
+
+  // Accept EMCY, SDO responses & NMT error control if the bus gets filtered:
+  m_bus->AddAcceptance(TAG, 0x080, 0x0ff);
+  m_bus->AddAcceptance(TAG, 0x580, 0x5ff);
+  m_bus->AddAcceptance(TAG, 0x700, 0x77f);
   }
 
 CANopenWorker::~CANopenWorker()
   {
-  vQueueDelete(m_jobqueue);
-  vTaskDelete(m_jobtask);
+  m_bus->RemoveAcceptance(TAG);
+  for (int i=0; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+    delete m_nodeworker[i];
+  vSemaphoreDelete(m_mutex);
   }
 
 
 void CANopenWorker::Open(CANopenAsyncClient* client)
   {
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
   m_clients.push_front(client);
   ++m_clientcnt;
+  xSemaphoreGive(m_mutex);
   }
 
 void CANopenWorker::Close(CANopenAsyncClient* client)
   {
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
   m_clients.remove(client);
   m_clientcnt ? --m_clientcnt : 0;
+  xSemaphoreGive(m_mutex);
   }
 
 bool CANopenWorker::IsClient(CANopenAsyncClient* client)
   {
+  bool found = false;
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
   for (auto c : m_clients)
     {
     if (c == client)
-      return true;
+      {
+      found = true;
+      break;
+      }
     }
-  return false;
+  xSemaphoreGive(m_mutex);
+  return found;
   }
 
 
 void CANopenWorker::StatusReport(int verbosity, OvmsWriter* writer)
   {
+  int waiting = 0;
+  for (int i=0; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+    waiting += uxQueueMessagesWaiting(m_nodeworker[i]->m_jobqueue);
+  
   writer->printf(
     "  %s:\n"
     "    Active clients: %d\n"
@@ -143,12 +200,24 @@ void CANopenWorker::StatusReport(int verbosity, OvmsWriter* writer)
     "    EMCY received : %" PRId32 "\n"
     , m_bus->GetName()
     , m_clientcnt
-    , (int)uxQueueMessagesWaiting(m_jobqueue)
+    , waiting
     , m_jobcnt
     , m_jobcnt_timeout
     , m_jobcnt_error
     , m_nmt_rxcnt
     , m_emcy_rxcnt);
+  
+  if (verbosity > COMMAND_RESULT_MINIMAL)
+    {
+    for (int i=0; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+      {
+      CANopenNodeWorker* nw = m_nodeworker[i];
+      writer->printf("    Worker %d      : %d jobs", i, nw->m_jobcnt);
+      if (nw->m_job.type != COJT_None)
+        writer->printf(", processing node %d", nw->m_job.nmt.nodeid);
+      writer->puts("");
+      }
+    }
   }
 
 
@@ -185,94 +254,93 @@ CANopenNodeMetrics *CANopenWorker::GetNodeMetrics(uint8_t nodeid)
 
 
 /**
- * SubmitJob: post a new job to the JobTask queue
+ * SubmitJob: post a new job to a node worker queue
+ *  - jobs for a node are routed to the node worker already processing
+ *    jobs for that node, so they are executed in order
+ *  - jobs for other nodes are routed to the least busy node worker
  */
 CANopenResult_t CANopenWorker::SubmitJob(CANopenJob& job, TickType_t maxqueuewait /*=0*/)
   {
-  if (xQueueSend(m_jobqueue, &job, maxqueuewait) != pdTRUE)
+  // Note: the nodeid is the first field of all job type parameter structs
+  uint8_t nodeid = job.nmt.nodeid & 0x7f;
+  
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+  int index = m_noderoute[nodeid];
+  if (index < 0)
+    {
+    index = 0;
+    for (int i=1; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+      {
+      if (m_nodeworker[i]->m_jobcnt < m_nodeworker[index]->m_jobcnt)
+        index = i;
+      }
+    m_noderoute[nodeid] = index;
+    }
+  CANopenNodeWorker* nw = m_nodeworker[index];
+  m_nodejobs[nodeid]++;
+  nw->m_jobcnt++;
+  xSemaphoreGive(m_mutex);
+  
+  job.result = COR_WAIT;
+  if (xQueueSend(nw->m_jobqueue, &job, maxqueuewait) != pdTRUE)
+    {
     job.result = COR_ERR_QueueFull;
-  else
-    job.result = COR_WAIT;
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    nw->m_jobcnt--;
+    if (--m_nodejobs[nodeid] == 0)
+      m_noderoute[nodeid] = -1;
+    xSemaphoreGive(m_mutex);
+    }
   return job.result;
   }
 
 
 /**
- * JobTask: process CANopenJobs, send results back to clients
+ * JobDone: send job result back to client, release node routing
+ *  (called by the node workers)
  */
-
-static void CANopenWorkerJobTask(void *pvParameters)
+void CANopenWorker::JobDone(CANopenNodeWorker* nodeworker, CANopenJob& job, bool dropped /*=false*/)
   {
-  CANopenWorker *me = (CANopenWorker*)pvParameters;
-  me->JobTask();
-  }
-
-void CANopenWorker::JobTask()
-  {
-  while(1)
+  uint8_t nodeid = job.nmt.nodeid & 0x7f;
+  
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+  
+  if (!dropped)
     {
-    // get next job:
-    if (xQueueReceive(m_jobqueue, &m_job, (portTickType)portMAX_DELAY) == pdTRUE)
+    // return job to client if still valid:
+    bool found = false;
+    for (auto c : m_clients)
       {
-        // check client:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job dropped: Client vanished");
-          continue;
-          }
-        
-        // process job:
-        switch (m_job.type)
-          {
-          case COJT_None:
-            m_job.result = COR_OK;
-            break;
-          case COJT_SendNMT:
-            ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
-            m_job.result = ProcessSendNMTJob();
-            ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReceiveHB:
-            ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
-            m_job.result = ProcessReceiveHBJob();
-            ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReadSDO:
-            ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessReadSDOJob();
-            ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_WriteSDO:
-            ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessWriteSDOJob();
-            ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          default:
-            ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
-            m_job.result = COR_ERR_UnknownJobType;
-          }
-        
-        // return job to client if still valid:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job result lost: Client vanished");
-          }
-        else
-          {
-          if (m_job.client->SubmitDoneCallback(m_job, 0) != COR_OK)
-            ESP_LOGW(TAG, "Job result lost: Client queue is full");
-          }
-        
-        // statistics:
-        m_jobcnt++;
-        if (m_job.result == COR_ERR_Timeout)
-          m_jobcnt_timeout++;
-        else if (m_job.result != COR_OK)
-          m_jobcnt_error++;
-        
-        m_job.type = COJT_None;
+      if (c == job.client)
+        {
+        found = true;
+        break;
+        }
+      }
+    if (!found)
+      {
+      ESP_LOGW(TAG, "Job result lost: Client vanished");
+      }
+    else
+      {
+      if (job.client->SubmitDoneCallback(job, 0) != COR_OK)
+        ESP_LOGW(TAG, "Job result lost: Client queue is full");
       }
+    
+    // statistics:
+    m_jobcnt++;
+    if (job.result == COR_ERR_Timeout)
+      m_jobcnt_timeout++;
+    else if (job.result != COR_OK)
+      m_jobcnt_error++;
     }
+  
+  // release node:
+  nodeworker->m_jobcnt--;
+  if (--m_nodejobs[nodeid] == 0)
+    m_noderoute[nodeid] = -1;
+  
+  xSemaphoreGive(m_mutex);
   }
 
 
@@ -281,18 +349,15 @@ void CANopenWorker::JobTask()
  */
 void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   {
-  // Message matching our current job?
-  if (m_job.type != COJT_None && p_frame->MsgID == m_job.rxid)
-    {
-    // copy payload into m_response:
-    int i;
-    for (i=0; i < p_frame->FIR.B.DLC; i++)
-      m_response.byte[i] = p_frame->data.u8[i];
-    for (; i < 8; i++)
-      m_response.byte[i] = 0;
-    
-    // signal job task:
-    xTaskNotifyGive(m_jobtask);
+  // Message matching a current job?
+  for (int i=0; i < CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS; i++)
+    {
+    CANopenNodeWorker* nw = m_nodeworker[i];
+    if (nw->m_job.type != COJT_None && p_frame->MsgID == nw->m_job.rxid)
+      {
+      nw->IncomingFrame(p_frame);
+      break;
+      }
     }
   
   
@@ -349,6 +414,137 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   } // IncomingFrame()
 
 
+/**
+ * CANopenNodeWorker: executes the jobs routed to it by the CANopenWorker
+ */
+
+CANopenNodeWorker::CANopenNodeWorker(CANopenWorker* worker, int index)
+  {
+  m_worker = worker;
+  m_bus = worker->m_bus;
+  m_jobcnt = 0;
+  
+  memset(&m_job, 0, sizeof(m_job));
+  m_job.type = COJT_None;
+  
+  memset(&m_request, 0, sizeof(m_request));
+  memset(&m_response, 0, sizeof(m_response));
+  
+  // the response queue needs to hold a full SDO block upload burst:
+  m_rxqueue = xQueueCreate(CANopen_BlockSize + 4, sizeof(CANopenFrame_t));
+  m_jobqueue = xQueueCreate(20, sizeof(CANopenJob));
+  snprintf(m_taskname, sizeof(m_taskname), "OVMS CO%s/%d", m_bus->GetName(), index);
+  xTaskCreatePinnedToCore(CANopenNodeWorkerJobTask, m_taskname,
+    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_jobtask, CORE(0));
+  }
+
+CANopenNodeWorker::~CANopenNodeWorker()
+  {
+  vTaskDelete(m_jobtask);
+  vQueueDelete(m_jobqueue);
+  vQueueDelete(m_rxqueue);
+  }
+
+
+/**
+ * JobTask: process CANopenJobs, send results back to clients
+ */
+
+static void CANopenNodeWorkerJobTask(void *pvParameters)
+  {
+  CANopenNodeWorker *me = (CANopenNodeWorker*)pvParameters;
+  me->JobTask();
+  }
+
+void CANopenNodeWorker::JobTask()
+  {
+  CANopenJob job;
+  
+  while(1)
+    {
+    // get next job:
+    if (xQueueReceive(m_jobqueue, &job, (portTickType)portMAX_DELAY) == pdTRUE)
+      {
+        // check client:
+        if (!m_worker->IsClient(job.client))
+          {
+          ESP_LOGW(TAG, "Job dropped: Client vanished");
+          m_worker->JobDone(this, job, true);
+          continue;
+          }
+        
+        // activate job, flush stale responses:
+        xQueueReset(m_rxqueue);
+        m_job = job;
+        
+        // process job:
+        switch (m_job.type)
+          {
+          case COJT_None:
+            m_job.result = COR_OK;
+            break;
+          case COJT_SendNMT:
+            ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
+            m_job.result = ProcessSendNMTJob();
+            ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
+            break;
+          case COJT_ReceiveHB:
+            ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
+            m_job.result = ProcessReceiveHBJob();
+            ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
+            break;
+          case COJT_ReadSDO:
+            ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+            m_job.result = ProcessReadSDOJob();
+            ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
+            break;
+          case COJT_WriteSDO:
+            ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+            m_job.result = ProcessWriteSDOJob();
+            ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
+            break;
+          default:
+            ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
+            m_job.result = COR_ERR_UnknownJobType;
+          }
+        
+        // deactivate job, return result:
+        job = m_job;
+        m_job.type = COJT_None;
+        m_worker->JobDone(this, job);
+      }
+    }
+  }
+
+
+/**
+ * IncomingFrame: queue response frame for the current job
+ *  (called by the CANopenWorker in the CAN rx task context)
+ */
+void CANopenNodeWorker::IncomingFrame(CAN_frame_t* p_frame)
+  {
+  // copy payload into response:
+  CANopenFrame_t response;
+  int i;
+  for (i=0; i < p_frame->FIR.B.DLC; i++)
+    response.byte[i] = p_frame->data.u8[i];
+  for (; i < 8; i++)
+    response.byte[i] = 0;
+  
+  // signal job task:
+  xQueueSend(m_rxqueue, &response, 0);
+  }
+
+
+/**
+ * ReceiveResponse: wait for next response frame from IncomingFrame()
+ */
+bool CANopenNodeWorker::ReceiveResponse(TickType_t maxwait)
+  {
+  return (xQueueReceive(m_rxqueue, &m_response, maxwait) == pdTRUE);
+  }
+
+
 /**
  * ProcessSendNMTJob: send NMT request and optionally wait for NMT state change
  *  a.k.a. heartbeat message.
@@ -359,7 +555,7 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
  *  even though the state has in fact changed -- there's no way to know
  *  if the node doesn't tell.
  */
-CANopenResult_t CANopenWorker::ProcessSendNMTJob()
+CANopenResult_t CANopenNodeWorker::ProcessSendNMTJob()
   {
   // check bus:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -386,14 +582,15 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
     {
     // send request:
     m_job.trycnt++;
+    xQueueReset(m_rxqueue);
     txframe.Write();
     
     // immediate return?
     if (m_job.rxid == 0)
       return COR_OK;
     
-    // wait for response signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for response from IncomingFrame():
+    if (ReceiveResponse(maxwait))
       {
       // expected response for command?
       if ( (m_job.nmt.command == CONC_Start      && m_response.hb.state >= 5)
@@ -421,7 +618,7 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
  * Use this to read the current state or synchronize to the heartbeat.
  * Note: heartbeats are optional in CANopen.
  */
-CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
+CANopenResult_t CANopenNodeWorker::ProcessReceiveHBJob()
   {
   // check parameters:
   if (m_job.hb.nodeid < 1 || m_job.hb.nodeid > 127)
@@ -433,8 +630,8 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
     {
     m_job.trycnt++;
     
-    // wait for receive signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for heartbeat from IncomingFrame():
+    if (ReceiveResponse(maxwait))
       {
       // return state received:
       m_job.hb.state = (CANopenNMTState_t) m_response.hb.state;
@@ -456,7 +653,7 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
 /**
  * SendSDORequest: asynchronous tx of prepared CANopen SDO request
  */
-void CANopenWorker::SendSDORequest()
+void CANopenNodeWorker::SendSDORequest(TickType_t maxqueuewait /*=0*/)
   {
   // init tx frame:
   CAN_frame_t txframe;
@@ -470,14 +667,14 @@ void CANopenWorker::SendSDORequest()
   memcpy(txframe.data.u8, m_request.byte, 8);
   
   // send:
-  txframe.Write();
+  txframe.Write(NULL, maxqueuewait);
   }
 
 
 /**
  * AbortSDORequest: send SDO abort command
  */
-void CANopenWorker::AbortSDORequest(uint32_t reason)
+void CANopenNodeWorker::AbortSDORequest(uint32_t reason)
   {
   // backup request:
   uint8_t control = m_request.ctl.control;
@@ -497,7 +694,7 @@ void CANopenWorker::AbortSDORequest(uint32_t reason)
 /**
  * ExecuteSDORequest: send SDO request and wait for response
  */
-CANopenResult_t CANopenWorker::ExecuteSDORequest()
+CANopenResult_t CANopenNodeWorker::ExecuteSDORequest()
   {
   TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
   m_job.trycnt = 0;
@@ -506,10 +703,11 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
     {
     // send request:
     m_job.trycnt++;
+    xQueueReset(m_rxqueue);
     SendSDORequest();
 
     // wait for reply:
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    if (ReceiveResponse(maxwait))
       return COR_OK;
 
     // timeout:
@@ -530,12 +728,14 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
  *   - remaining buffer space will be zeroed
  *   - on result COR_ERR_BufferTooSmall, the buffer has been filled up to m_job.sdo.bufsize
  *   - on abort, the CANopen error code will be written into m_job.sdo.error
+ *   - if m_job.sdo.blksize is set, a block upload is requested; the server may switch to the
+ *     normal protocol for small objects, servers without block support are retried normally
  * 
  * Note: result interpretation is up to caller (check device object dictionary for data types & sizes).
  *   As CANopen is little endian as ESP32, we don't need to check lengths on numerical results,
  *   i.e. anything from int8_t to uint32_t can simply be read into a uint32_t buffer.
  */
-CANopenResult_t CANopenWorker::ProcessReadSDOJob()
+CANopenResult_t CANopenNodeWorker::ProcessReadSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -558,13 +758,48 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
   memset(&m_request, 0, sizeof(m_request));
   m_request.exp.index = m_job.sdo.index;
   m_request.exp.subindex = m_job.sdo.subindex;
-  m_request.exp.control = SDO_InitUploadRequest;
+  if (m_job.sdo.blksize)
+    {
+    // …block, allow protocol switch for objects below the threshold:
+    m_request.exp.control = SDO_BlockUploadRequest | SDO_BlockCRC | SDO_BlockInit;
+    m_request.exp.data[0] = std::min<uint8_t>(m_job.sdo.blksize, CANopen_BlockSize);
+    m_request.exp.data[1] = CANopen_BlockThreshold;
+    }
+  else
+    {
+    m_request.exp.control = SDO_InitUploadRequest;
+    }
   if (ExecuteSDORequest() != COR_OK)
     {
     m_job.sdo.error = SDO_Abort_Timeout;
     return COR_ERR_Timeout;
     }
 
+  if (m_job.sdo.blksize)
+    {
+    // block upload accepted?
+    if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockEnd)) == (SDO_BlockUploadResponse|SDO_BlockInit)
+      && m_response.exp.index == m_request.exp.index
+      && m_response.exp.subindex == m_request.exp.subindex)
+      {
+      return ProcessReadSDOBlock();
+      }
+    // block upload not supported → retry normal upload:
+    if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort
+      && m_response.ctl.data == SDO_Abort_InvalidCmd)
+      {
+      ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: no block support, using segmented upload",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_request.exp.control = SDO_InitUploadRequest;
+      m_request.ctl.data = 0;
+      if (ExecuteSDORequest() != COR_OK)
+        {
+        m_job.sdo.error = SDO_Abort_Timeout;
+        return COR_ERR_Timeout;
+        }
+      }
+    }
+
   // check response:
   if ((m_response.exp.control & SDO_CommandMask) != SDO_InitUploadResponse
     || m_response.exp.index != m_request.exp.index
@@ -661,12 +896,14 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
  *   - … or 4 bytes from m_job.sdo.buf if bufsize is 0 (use for integer SDOs of unknown type)
  *   - returns data length sent in m_job.sdo.xfersize
  *   - on abort, the CANopen error code will be written into m_job.sdo.error
+ *   - if m_job.sdo.blksize is set and bufsize reaches CANopen_BlockThreshold, a block download
+ *     is requested, servers without block support are retried normally
  * 
  * Note: the caller needs to know data type & size of the SDO register (check device object dictionary).
  *   As CANopen servers normally are intelligent, anything from int8_t to uint32_t can simply be
  *   sent as a uint32_t with bufsize=0, the server will know how to convert it.
  */
-CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
+CANopenResult_t CANopenNodeWorker::ProcessWriteSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -702,6 +939,12 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
     for (n=0; n < m_job.sdo.bufsize; n++)
       m_request.exp.data[n] = *buf++;
     }
+  else if (m_job.sdo.blksize && m_job.sdo.bufsize >= CANopen_BlockThreshold)
+    {
+    // …block:
+    m_request.exp.control = SDO_BlockDownloadRequest | SDO_BlockCRC | SDO_BlockSizeIndicated | SDO_BlockInit;
+    m_request.ctl.data = m_job.sdo.bufsize;
+    }
   else
     {
     // …segmented:
@@ -714,6 +957,30 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
     return COR_ERR_Timeout;
     }
 
+  if ((m_request.exp.control & SDO_CommandMask) == SDO_BlockDownloadRequest)
+    {
+    // block download accepted?
+    if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockSubCmdMask)) == (SDO_BlockDownloadResponse|SDO_BlockInit)
+      && m_response.exp.index == m_request.exp.index
+      && m_response.exp.subindex == m_request.exp.subindex)
+      {
+      return ProcessWriteSDOBlock();
+      }
+    // block download not supported → retry normal download:
+    if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort
+      && m_response.ctl.data == SDO_Abort_InvalidCmd)
+      {
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: no block support, using segmented download",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_request.exp.control = SDO_InitDownloadRequest | SDO_SizeIndicated;
+      if (ExecuteSDORequest() != COR_OK)
+        {
+        m_job.sdo.error = SDO_Abort_Timeout;
+        return COR_ERR_Timeout;
+        }
+      }
+    }
+
   // check response:
   if ((m_response.exp.control & SDO_CommandMask) != SDO_InitDownloadResponse
     || m_response.exp.index != m_request.exp.index
@@ -777,3 +1044,292 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
   }
 
 
+/**
+ * ProcessReadSDOBlock: block upload after the server accepted the initiation
+ *   - m_response holds the init response, m_request the init request
+ *   - segments received in sequence are copied to the buffer, the last segment is held
+ *     back until the end frame tells the number of valid bytes
+ *   - lost or out of sequence segments are recovered by acknowledging the last segment
+ *     received in sequence, the server then repeats the remaining segments
+ */
+CANopenResult_t CANopenNodeWorker::ProcessReadSDOBlock()
+  {
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  uint8_t *buf = m_job.sdo.buf;
+  uint8_t blksize = m_request.exp.data[0];
+  bool crcmode = (m_response.exp.control & SDO_BlockCRC);
+  uint16_t crc = 0;
+  uint8_t seqno, ackseq = 0;
+  uint8_t last[7];
+  bool done = false;
+  size_t n;
+
+  if (m_response.exp.control & SDO_BlockSizeIndicated)
+    m_job.sdo.contsize = m_response.ctl.data;
+  else
+    m_job.sdo.contsize = 0; // unknown size
+
+  // start upload:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.seg.control = SDO_BlockUploadRequest | SDO_BlockStart;
+  xQueueReset(m_rxqueue);
+  SendSDORequest();
+  m_job.trycnt = 0;
+
+  // receive blocks:
+  while (!done)
+    {
+    if (!ReceiveResponse(maxwait))
+      {
+      // timeout → request retransmission after last valid segment,
+      //  or repeat start / last acknowledge if nothing was received:
+      if (++m_job.trycnt >= m_job.maxtries)
+        {
+        AbortSDORequest(SDO_Abort_Timeout);
+        m_job.sdo.error = SDO_Abort_Timeout;
+        return COR_ERR_Timeout;
+        }
+      if (ackseq > 0)
+        {
+        m_request.seg.control = SDO_BlockUploadRequest | SDO_BlockAck;
+        m_request.seg.data[0] = ackseq;
+        m_request.seg.data[1] = blksize;
+        ackseq = 0;
+        }
+      xQueueReset(m_rxqueue);
+      SendSDORequest();
+      continue;
+      }
+
+    // abort?
+    if (m_response.seg.control == SDO_Abort)
+      {
+      m_job.sdo.error = m_response.ctl.data;
+      ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: block upload aborted, CANopen error code 0x%08" PRIx32 ", readlen=%d",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error, m_job.sdo.xfersize);
+      return COR_ERR_SDO_Access;
+      }
+
+    seqno = m_response.seg.control & SDO_BlockSeqNoMask;
+    if (seqno == ackseq + 1)
+      {
+      // segment in sequence:
+      ackseq = seqno;
+      if (m_response.seg.control & SDO_BlockSegmentLast)
+        {
+        memcpy(last, m_response.seg.data, 7);
+        done = true;
+        }
+      else
+        {
+        n = std::min<size_t>(7, m_job.sdo.bufsize - m_job.sdo.xfersize);
+        memcpy(buf, m_response.seg.data, n);
+        buf += n;
+        m_job.sdo.xfersize += n;
+        if (n < 7)
+          {
+          ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+            m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+          AbortSDORequest(SDO_Abort_OutOfMemory);
+          // skip remaining segments of the block:
+          while (ReceiveResponse(pdMS_TO_TICKS(5)));
+          m_job.sdo.error = SDO_Abort_OutOfMemory;
+          return COR_ERR_BufferTooSmall;
+          }
+        crc = SDOBlockCRC(crc, m_response.seg.data, 7);
+        }
+      }
+    else if (!(m_response.seg.control & SDO_BlockSegmentLast) && seqno != blksize)
+      {
+      // segment lost, wait for end of block:
+      continue;
+      }
+
+    // end of block → acknowledge:
+    if (done || seqno == blksize || (m_response.seg.control & SDO_BlockSegmentLast))
+      {
+      if (ackseq == seqno)
+        m_job.trycnt = 0;
+      else if (++m_job.trycnt >= m_job.maxtries)
+        {
+        AbortSDORequest(SDO_Abort_SeqNo);
+        m_job.sdo.error = SDO_Abort_SeqNo;
+        return COR_ERR_SDO_SegMismatch;
+        }
+      m_request.seg.control = SDO_BlockUploadRequest | SDO_BlockAck;
+      m_request.seg.data[0] = ackseq;
+      m_request.seg.data[1] = blksize;
+      ackseq = 0;
+      xQueueReset(m_rxqueue);
+      SendSDORequest();
+      }
+    }
+
+  // receive end frame:
+  m_job.trycnt = 0;
+  while (1)
+    {
+    if (ReceiveResponse(maxwait))
+      break;
+    // timeout → repeat acknowledge:
+    if (++m_job.trycnt >= m_job.maxtries)
+      {
+      AbortSDORequest(SDO_Abort_Timeout);
+      m_job.sdo.error = SDO_Abort_Timeout;
+      return COR_ERR_Timeout;
+      }
+    SendSDORequest();
+    }
+  if (m_response.seg.control == SDO_Abort)
+    {
+    m_job.sdo.error = m_response.ctl.data;
+    return COR_ERR_SDO_Access;
+    }
+  if ((m_response.seg.control & (SDO_CommandMask|SDO_BlockEnd)) != (SDO_BlockUploadResponse|SDO_BlockEnd))
+    {
+    AbortSDORequest(SDO_Abort_InvalidCmd);
+    m_job.sdo.error = SDO_Abort_InvalidCmd;
+    return COR_ERR_SDO_SegMismatch;
+    }
+
+  // copy last segment:
+  n = 7 - ((m_response.seg.control & SDO_BlockUnusedMask) >> 2);
+  crc = SDOBlockCRC(crc, last, n);
+  if (n > m_job.sdo.bufsize - m_job.sdo.xfersize)
+    {
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.bufsize);
+    memcpy(buf, last, m_job.sdo.bufsize - m_job.sdo.xfersize);
+    m_job.sdo.xfersize = m_job.sdo.bufsize;
+    AbortSDORequest(SDO_Abort_OutOfMemory);
+    m_job.sdo.error = SDO_Abort_OutOfMemory;
+    return COR_ERR_BufferTooSmall;
+    }
+  memcpy(buf, last, n);
+  m_job.sdo.xfersize += n;
+
+  // check CRC:
+  if (crcmode && crc != (m_response.byte[1] | (m_response.byte[2] << 8)))
+    {
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: CRC mismatch, readlen=%d",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+    AbortSDORequest(SDO_Abort_CRC);
+    m_job.sdo.error = SDO_Abort_CRC;
+    return COR_ERR_SDO_CRC;
+    }
+
+  // confirm end:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.seg.control = SDO_BlockUploadRequest | SDO_BlockEnd;
+  SendSDORequest();
+  return COR_OK;
+  }
+
+
+/**
+ * ProcessWriteSDOBlock: block download after the server accepted the initiation
+ *   - m_response holds the init response with the block size requested by the server
+ *   - the server acknowledges each block with the last segment received in sequence,
+ *     the next block restarts after that segment
+ */
+CANopenResult_t CANopenNodeWorker::ProcessWriteSDOBlock()
+  {
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  bool crcmode = (m_response.exp.control & SDO_BlockCRC);
+  uint8_t blksize = m_response.exp.data[0];
+  uint8_t seqno, ackseq;
+  size_t pos, n;
+
+  m_job.trycnt = 0;
+  m_job.sdo.xfersize = 0;
+  while (m_job.sdo.xfersize < m_job.sdo.bufsize)
+    {
+    if (blksize < 1 || blksize > 127)
+      {
+      AbortSDORequest(SDO_Abort_BlockSize);
+      m_job.sdo.error = SDO_Abort_BlockSize;
+      return COR_ERR_SDO_SegMismatch;
+      }
+
+    // send block:
+    xQueueReset(m_rxqueue);
+    pos = m_job.sdo.xfersize;
+    for (seqno = 1; seqno <= blksize && pos < m_job.sdo.bufsize; seqno++)
+      {
+      n = std::min<size_t>(7, m_job.sdo.bufsize - pos);
+      memset(&m_request, 0, sizeof(m_request));
+      memcpy(m_request.seg.data, m_job.sdo.buf + pos, n);
+      pos += n;
+      m_request.seg.control = seqno | ((pos == m_job.sdo.bufsize) ? SDO_BlockSegmentLast : 0);
+      SendSDORequest(maxwait);
+      }
+    seqno--;
+
+    // wait for acknowledge:
+    if (!ReceiveResponse(maxwait))
+      {
+      if (++m_job.trycnt >= m_job.maxtries)
+        {
+        AbortSDORequest(SDO_Abort_Timeout);
+        m_job.sdo.error = SDO_Abort_Timeout;
+        return COR_ERR_Timeout;
+        }
+      continue;
+      }
+    if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+      {
+      m_job.sdo.error = m_response.ctl.data;
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block download aborted, CANopen error code 0x%08" PRIx32 ", xfersize=%d",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error, m_job.sdo.xfersize);
+      return COR_ERR_SDO_Access;
+      }
+    ackseq = m_response.byte[1];
+    if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockSubCmdMask)) != (SDO_BlockDownloadResponse|SDO_BlockAck)
+      || ackseq > seqno)
+      {
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block acknowledge mismatch, xfersize=%d",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+
+    // advance to first segment not acknowledged:
+    m_job.sdo.xfersize = std::min<size_t>(m_job.sdo.xfersize + ackseq * 7, m_job.sdo.bufsize);
+    blksize = m_response.byte[2];
+    if (ackseq == seqno)
+      m_job.trycnt = 0;
+    else if (++m_job.trycnt >= m_job.maxtries)
+      {
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+    }
+
+  // end download:
+  uint16_t crc = crcmode ? SDOBlockCRC(0, m_job.sdo.buf, m_job.sdo.bufsize) : 0;
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.seg.control = SDO_BlockDownloadRequest | SDO_BlockEnd | (((7 - m_job.sdo.bufsize % 7) % 7) << 2);
+  m_request.seg.data[0] = crc & 0xff;
+  m_request.seg.data[1] = crc >> 8;
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    m_job.sdo.error = SDO_Abort_Timeout;
+    return COR_ERR_Timeout;
+    }
+  if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+    {
+    m_job.sdo.error = m_response.ctl.data;
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block download end failed, CANopen error code 0x%08" PRIx32,
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return (m_job.sdo.error == SDO_Abort_CRC) ? COR_ERR_SDO_CRC : COR_ERR_SDO_Access;
+    }
+  if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockSubCmdMask)) != (SDO_BlockDownloadResponse|SDO_BlockEnd))
+    {
+    AbortSDORequest(SDO_Abort_InvalidCmd);
+    m_job.sdo.error = SDO_Abort_InvalidCmd;
+    return COR_ERR_SDO_SegMismatch;
+    }
+  return COR_OK;
+  }
@@ -1029,6 +1029,13 @@ ssize_t ConsoleSSH::write(const void *buf, size_t nbyte)
   return ret;
   }
 
+// Log lines are queued for output on MG_EV_POLL, so wake up the network task:
+void ConsoleSSH::Log(LogBuffers* message)
+  {
+  OvmsConsole::Log(message);
+  MyNetManager.MongooseWakeup();
+  }
+
 // Routines to be called from within WolfSSH to receive and send data from and
 // to the network socket.
 
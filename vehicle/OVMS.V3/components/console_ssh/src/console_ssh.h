@@ -77,6 +77,7 @@ class ConsoleSSH : public OvmsConsole
     int puts(const char* s);
     int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
     ssize_t write(const void *buf, size_t nbyte);
+    void Log(LogBuffers* message);
     int RecvCallback(char* buf, uint32_t size);
     bool IsDraining() { return m_drain > 0; }
 
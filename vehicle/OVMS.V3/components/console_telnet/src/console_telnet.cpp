@@ -282,6 +282,13 @@ ssize_t ConsoleTelnet::write(const void *buf, size_t nbyte)
   return nbyte;
   }
 
+// Log lines are queued for output on MG_EV_POLL, so wake up the network task:
+void ConsoleTelnet::Log(LogBuffers* message)
+  {
+  OvmsConsole::Log(message);
+  MyNetManager.MongooseWakeup();
+  }
+
 /**
  * Convert a telnet event type to its string representation.
  */
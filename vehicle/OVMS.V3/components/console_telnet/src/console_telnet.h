@@ -66,6 +66,7 @@ class ConsoleTelnet : public OvmsConsole
     int puts(const char* s);
     int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
     ssize_t write(const void *buf, size_t nbyte);
+    void Log(LogBuffers* message);
 
   protected:
     mg_connection* m_connection;
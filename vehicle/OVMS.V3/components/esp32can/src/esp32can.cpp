@@ -384,6 +384,7 @@ esp32can::esp32can(const char* name, int txpin, int rxpin)
   // after startup.
   m_powermode = Off;
   m_tx_abort = false;
+  m_filter_set = false;
   MODULE_ESP32CAN->MOD.B.RM = 1;
 
   // Launch ISR allocator task on core 0:
@@ -451,15 +452,8 @@ esp_err_t esp32can::InitController()
       ier &= ~__CAN_IER_BRP_DIV;
   MODULE_ESP32CAN->IER.U = ier;
 
-  // No acceptance filtering, as we want to fetch all messages
-  MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[0] = 0;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[1] = 0;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[2] = 0;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[3] = 0;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[0] = 0xff;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[1] = 0xff;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[2] = 0xff;
-  MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[3] = 0xff;
+  // Acceptance filtering (default: none, fetch all messages)
+  WriteAcceptanceFilter();
 
   // Set to normal mode
   MODULE_ESP32CAN->OCR.B.OCMODE=__CAN_OC_NOM;
@@ -481,6 +475,65 @@ esp_err_t esp32can::InitController()
   return ESP_OK;
   }
 
+/**
+ * WriteAcceptanceFilter: write the filter configuration (reset mode only)
+ */
+void esp32can::WriteAcceptanceFilter()
+  {
+  if (!m_filter_set)
+    {
+    MODULE_ESP32CAN->MOD.B.AFM = 1;
+    for (int i = 0; i < 4; i++)
+      {
+      MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[i] = 0;
+      MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[i] = 0xff;
+      }
+    return;
+    }
+  MODULE_ESP32CAN->MOD.B.AFM = m_filter.dual ? 0 : 1;
+  for (int i = 0; i < 4; i++)
+    {
+    MODULE_ESP32CAN->MBX_CTRL.ACC.CODE[i] = m_filter.code[i];
+    MODULE_ESP32CAN->MBX_CTRL.ACC.MASK[i] = m_filter.mask[i];
+    }
+  }
+
+/**
+ * SetAcceptanceFilter: calculate & program the acceptance filter
+ *  The filter can only be changed in reset mode, so a running bus will miss
+ *  frames for a moment. A pending transmission is given some time to finish.
+ *  Updates resulting in the same register values are skipped.
+ */
+esp_err_t esp32can::SetAcceptanceFilter(const CAN_acceptance_list_t* list)
+  {
+  OvmsMutexLock lock(&m_write_mutex);
+  CAN_sja1000_filter_t filter;
+  bool filter_set = list && canacceptance::CalcSJA1000(*list, filter);
+  // Skip the reset if the resulting registers are unchanged:
+  if (filter_set == m_filter_set && (!filter_set || canacceptance::EqualSJA1000(filter, m_filter)))
+    return ESP_OK;
+  m_filter_set = filter_set;
+  if (filter_set)
+    m_filter = filter;
+  if (m_mode == CAN_MODE_OFF)
+    return ESP_OK;
+
+  for (int i = 0; i < 10 && (m_state & CAN_M_STATE_TX_BUF_OCCUPIED); i++)
+    vTaskDelay(1);
+
+  ESP32CAN_ENTER_CRITICAL();
+  MODULE_ESP32CAN->MOD.B.RM = 1;
+  WriteAcceptanceFilter();
+  MODULE_ESP32CAN->MOD.B.RM = 0;
+  ESP32CAN_EXIT_CRITICAL();
+  return ESP_OK;
+  }
+
+float esp32can::AcceptanceCoverage(bool extended)
+  {
+  return m_filter_set ? canacceptance::CoverageSJA1000(m_filter, extended) : 1.0f;
+  }
+
 esp_err_t esp32can::Start(CAN_mode_t mode, CAN_speed_t speed)
   {
   switch (speed)
@@ -692,7 +745,7 @@ void esp32can::TxCallback(CAN_frame_t* p_frame, bool success)
   }
 
 
-void esp32can::BusTicker10(std::string event, void* data)
+void esp32can::BusTicker10(const char* event, void* data)
   {
   // Check for a stuck bus-off error state:
   // The workaround following TWAI_ERRATA_FIX_BUS_OFF_REC in ESP32CAN_isr() sometimes fails.
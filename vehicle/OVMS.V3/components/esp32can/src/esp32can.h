@@ -62,9 +62,14 @@ class esp32can : public canbus
     esp_err_t Write(const CAN_frame_t* p_frame, TickType_t maxqueuewait=0);
     void TxCallback(CAN_frame_t* p_frame, bool success);
 
+  public:
+    float AcceptanceCoverage(bool extended);
+
   protected:
     esp_err_t WriteFrame(const CAN_frame_t* p_frame);
-    void BusTicker10(std::string event, void* data);
+    void BusTicker10(const char* event, void* data);
+    esp_err_t SetAcceptanceFilter(const CAN_acceptance_list_t* list);
+    void WriteAcceptanceFilter();
 
   public:
     void SetPowerMode(PowerMode powermode);
@@ -74,6 +79,8 @@ class esp32can : public canbus
     gpio_num_t m_rxpin;               // RX pin
     OvmsMutex m_write_mutex;
     bool m_tx_abort;
+    CAN_sja1000_filter_t m_filter;
+    bool m_filter_set;
   };
 
 #endif //#ifndef __ESP32CAN_H__
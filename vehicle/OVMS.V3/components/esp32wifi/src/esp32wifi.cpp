@@ -392,7 +392,7 @@ esp32wifi::esp32wifi(const char* name)
   MyEvents.RegisterEvent(TAG,"system.wifi.sta.lostip",std::bind(&esp32wifi::EventWifiLostIp, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.wifi.sta.connected",std::bind(&esp32wifi::EventWifiStaConnected, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.wifi.sta.disconnected",std::bind(&esp32wifi::EventWifiStaDisconnected, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.1",std::bind(&esp32wifi::EventTimer1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.1",std::bind(&esp32wifi::EventTimer1, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.wifi.scan.done",std::bind(&esp32wifi::EventWifiScanDone, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.wifi.ap.start",std::bind(&esp32wifi::EventWifiApState, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.wifi.ap.stop",std::bind(&esp32wifi::EventWifiApState, this, _1, _2));
@@ -1195,7 +1195,7 @@ void esp32wifi::EventWifiApUpdate(std::string event, void* data)
     }
   }
 
-void esp32wifi::EventTimer1(std::string event, void* data)
+void esp32wifi::EventTimer1(const char* event, void* data)
   {
   UpdateNetMetrics();
 
@@ -96,7 +96,7 @@ class esp32wifi : public pcp, public InternalRamAllocated
     void EventWifiStaDisconnected(std::string event, void* data);
     void EventWifiApState(std::string event, void* data);
     void EventWifiApUpdate(std::string event, void* data);
-    void EventTimer1(std::string event, void* data);
+    void EventTimer1(const char* event, void* data);
     void EventWifiScanDone(std::string event, void* data);
     void EventSystemShuttingDown(std::string event, void* data);
     void OutputStatus(int verbosity, OvmsWriter* writer);
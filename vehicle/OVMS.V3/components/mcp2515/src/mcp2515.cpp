@@ -170,8 +170,8 @@ esp_err_t mcp2515::Start(CAN_mode_t mode, CAN_speed_t speed)
   // Set CONFIG mode (abort transmisions, one-shot mode, clkout disabled)
   WriteReg(REG_CANCTRL, CANCTRL_MODE_CONFIG | CANCTRL_ABAT | CANCTRL_OSM);
 
-  // Rx Buffer 0 control (receive all and enable buffer 1 rollover)
-  WriteRegAndVerify(REG_RXB0CTRL, 0b01100100, 0b01101101);
+  // Rx Buffer 0 control (receive all or filtered, enable buffer 1 rollover)
+  WriteAcceptanceFilter();
 
   // BFPCTRL RXnBF PIN CONTROL AND STATUS
   WriteRegAndVerify(REG_BFPCTRL, 0b00001100);
@@ -256,6 +256,73 @@ esp_err_t mcp2515::Start(CAN_mode_t mode, CAN_speed_t speed)
   }
 
 
+/**
+ * SetAcceptanceFilter: calculate & program the acceptance masks & filters
+ *  The filters can only be changed in configuration mode, so a running bus
+ *  will miss frames for a few milliseconds. Updates resulting in the same
+ *  register values are skipped.
+ */
+esp_err_t mcp2515::SetAcceptanceFilter(const CAN_acceptance_list_t* list)
+  {
+  OvmsMutexLock lock(&m_write_mutex);
+  CAN_mcp2515_filter_t filter;
+  bool filter_set = list && canacceptance::CalcMCP2515(*list, filter);
+  // Skip the mode change if the resulting registers are unchanged:
+  if (filter_set == m_filter_set && (!filter_set || canacceptance::EqualMCP2515(filter, m_filter)))
+    return ESP_OK;
+  m_filter_set = filter_set;
+  if (filter_set)
+    m_filter = filter;
+  if (m_mode == CAN_MODE_OFF)
+    return ESP_OK;
+
+  if (ChangeMode(CANCTRL_MODE_CONFIG) != ESP_OK)
+    return ESP_FAIL;
+  esp_err_t err = WriteAcceptanceFilter();
+  if (ChangeMode((m_mode == CAN_MODE_LISTEN) ? CANCTRL_MODE_LISTEN : CANCTRL_MODE_NORMAL) != ESP_OK)
+    return ESP_FAIL;
+  return err;
+  }
+
+/**
+ * WriteAcceptanceFilter: write the filter configuration (configuration mode only)
+ */
+esp_err_t mcp2515::WriteAcceptanceFilter()
+  {
+  if (!m_filter_set)
+    {
+    // Receive all, RXB1 only used for rollover:
+    WriteRegAndVerify(REG_RXB1CTRL, 0b00000000, 0b01100000);
+    return WriteRegAndVerify(REG_RXB0CTRL, 0b01100100, 0b01101101);
+    }
+
+  static const uint8_t filter_reg[6] =
+    { REG_RXF0SIDH, REG_RXF1SIDH, REG_RXF2SIDH, REG_RXF3SIDH, REG_RXF4SIDH, REG_RXF5SIDH };
+  uint8_t buf[16];
+  uint8_t regs[4];
+  for (int i = 0; i < 2; i++)
+    {
+    canacceptance::EncodeMCP2515(m_filter.mask[i], false, regs);
+    m_spibus->spi_cmd(m_spi, buf, 0, 6, CMD_WRITE, (i == 0) ? REG_RXM0SIDH : REG_RXM1SIDH,
+      regs[0], regs[1], regs[2], regs[3]);
+    }
+  for (int i = 0; i < 6; i++)
+    {
+    canacceptance::EncodeMCP2515(m_filter.filter[i], m_filter.extended[i], regs);
+    m_spibus->spi_cmd(m_spi, buf, 0, 6, CMD_WRITE, filter_reg[i],
+      regs[0], regs[1], regs[2], regs[3]);
+    }
+
+  // Receive filtered frames, enable buffer 1 rollover:
+  WriteRegAndVerify(REG_RXB1CTRL, 0b00000000, 0b01100000);
+  return WriteRegAndVerify(REG_RXB0CTRL, 0b00000100, 0b01101101);
+  }
+
+float mcp2515::AcceptanceCoverage(bool extended)
+  {
+  return m_filter_set ? canacceptance::CoverageMCP2515(m_filter, extended) : 1.0f;
+  }
+
 esp_err_t mcp2515::ChangeMode( uint8_t mode )
   {
   uint8_t buf[16];
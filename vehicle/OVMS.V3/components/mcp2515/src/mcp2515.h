@@ -56,8 +56,13 @@ class mcp2515 : public canbus
     bool AsynchronousInterruptHandler(CAN_frame_t* frame, uint32_t* framesReceived);
     void TxCallback(CAN_frame_t* p_frame, bool success);
 
+  public:
+    float AcceptanceCoverage(bool extended);
+
   protected:
     esp_err_t WriteFrame(const CAN_frame_t* p_frame);
+    esp_err_t SetAcceptanceFilter(const CAN_acceptance_list_t* list);
+    esp_err_t WriteAcceptanceFilter();
 
   public:
     void SetPowerMode(PowerMode powermode);
@@ -73,6 +78,8 @@ class mcp2515 : public canbus
     int m_intpin;
     uint8_t m_last_errflag = 0;
     OvmsMutex m_write_mutex;
+    CAN_mcp2515_filter_t m_filter;
+    bool m_filter_set = false;
   };
 
 #endif //#ifndef __MCP2515_H__
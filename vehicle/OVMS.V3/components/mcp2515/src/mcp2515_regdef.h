@@ -112,6 +112,15 @@
 #define REG_TXB1CTRL            0x40
 #define REG_TXB2CTRL            0x50
 #define REG_RXB0CTRL            0x60
+#define REG_RXB1CTRL            0x70
+#define REG_RXF0SIDH            0x00          // Acceptance filters (SIDH, SIDL, EID8, EID0)
+#define REG_RXF1SIDH            0x04
+#define REG_RXF2SIDH            0x08
+#define REG_RXF3SIDH            0x10
+#define REG_RXF4SIDH            0x14
+#define REG_RXF5SIDH            0x18
+#define REG_RXM0SIDH            0x20          // Acceptance masks (SIDH, SIDL, EID8, EID0)
+#define REG_RXM1SIDH            0x24
 
 #define MCP2515_TIMEOUT         100           // Timeout for register verification, in milliseconds
 
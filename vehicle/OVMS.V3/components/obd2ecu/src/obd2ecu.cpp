@@ -174,6 +174,12 @@ obd2ecu::obd2ecu(const char* name, canbus* can)
   xTaskCreatePinnedToCore(OBD2ECU_task, "OVMS OBDII ECU", 6144, (void*)this, 5, &m_task, CORE(1));
 
   MyCan.RegisterCallback(GetName(), std::bind(&obd2ecu::ECURxCallback, this, _1, _2));
+
+  // Accept our requests & flow control frames if the bus gets filtered:
+  m_can->AddAcceptance(GetName(), REQUEST_PID, REQUEST_PID);
+  m_can->AddAcceptance(GetName(), FLOWCONTROL_PID, FLOWCONTROL_PID);
+  m_can->AddAcceptance(GetName(), REQUEST_EXT_PID, REQUEST_EXT_PID, true);
+  m_can->AddAcceptance(GetName(), FLOWCONTROL_EXT_PID, FLOWCONTROL_EXT_PID, true);
   NotifyStartup();
   }
 
@@ -189,6 +195,7 @@ obd2ecu::~obd2ecu()
   vQueueDelete(rxqueue);
 
   MyCan.DeregisterCallback(GetName());
+  m_can->RemoveAcceptance(GetName());
 
   ClearMap();
   }
@@ -189,6 +189,25 @@ std::string OvmsBuffer::ReadLine()
   return std::string((char*)result,hl);
   }
 
+// Read a line into a caller supplied buffer, avoiding heap allocations.
+// Content exceeding size-1 is discarded, dest is NUL terminated.
+// Returns the length stored in dest, or -1 if no line is available.
+int OvmsBuffer::ReadLine(char* dest, size_t size)
+  {
+  int hl = HasLine();
+  if (hl<0 || size==0) return -1;
+
+  size_t len = Pop(((size_t)hl < size) ? (size_t)hl : size-1, (uint8_t*)dest);
+  dest[len] = 0;
+  for (size_t skip = hl - len; skip > 0; skip--)
+    Pop();
+
+  if (Peek() == '\r') Pop();
+  if (Peek() == '\n') Pop();
+
+  return len;
+  }
+
 int OvmsBuffer::PollSocket(int sock, long timeoutms)
   {
   fd_set fds;
@@ -58,6 +58,7 @@ class OvmsBuffer
   public:
     int HasLine();
     std::string ReadLine();
+    int ReadLine(char* dest, size_t size);
 
   public:
     int PollSocket(int sock, long timeoutms);
@@ -33,7 +33,9 @@
 static const char *TAG = "gsm-nmea";
 
 #include <string>
-#include <sstream>
+#include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
 
 #include "gsmnmea.h"
 #include "ovms_command.h"
@@ -42,27 +44,12 @@ static const char *TAG = "gsm-nmea";
 #include "ovms_metrics.h"
 #include "metrics_standard.h"
 #include "ovms_time.h"
+#include "ovms_utils.h"
 
 #define JDEpoch 2440588 // Julian date of the Unix epoch
 #define DIM(a) (sizeof(a)/sizeof(*(a)))
 
 
-/**
- * gps2latlon: convert NMEA degree/minute form to degrees
- */
-static float gps2latlon(const char *gpscoord)
-{
-  double f;
-  long d;
-
-  f = atof(gpscoord);
-  d = (long) (f / 100); // extract degrees
-  f = d + (f - (d * 100)) / 60; // convert to decimal format
-
-  return (float) f;
-}
-
-
 /**
  * JdFromYMD:
  *  computes the Julian date from year, month, day
@@ -99,41 +86,162 @@ static int64_t utc_to_timestamp(const char* date, const char* time)
   }
 
 
-static bool valid_nmea_cksum(const std::string line)
+/**
+ * nmea_cksum_end:
+ *  validate sentence checksum in place
+ *  returns pointer to the '*' delimiter or NULL if invalid
+ */
+static const char* nmea_cksum_end(const char* line, size_t len)
   {
-  const char *cp = line.c_str();
-  if (*cp != '$')
-    return 0;
-  ++cp;
-  const char *ep = strchr(cp, '*');
-  if (ep == NULL)
-    return 0;
+  if (len < 4 || line[0] != '$')
+    return NULL;
+  const char *ep = (const char*) memchr(line, '*', len);
+  if (ep == NULL || ep + 3 > line + len || !isxdigit((unsigned char)ep[1]) || !isxdigit((unsigned char)ep[2]))
+    return NULL;
   unsigned char chk = 0;
-  while (cp < ep)
-    chk ^= (const unsigned char)*cp++;
-  unsigned char chk2 = (unsigned char)strtoul(ep + 1, NULL, 16);
-  return (chk == chk2);
+  for (const char *cp = line + 1; cp < ep; cp++)
+    chk ^= (const unsigned char)*cp;
+  unsigned char chk2 = (unsigned char)
+    (((isdigit(ep[1]) ? ep[1]-'0' : (toupper(ep[1])-'A'+10)) << 4) |
+      (isdigit(ep[2]) ? ep[2]-'0' : (toupper(ep[2])-'A'+10)));
+  return (chk == chk2) ? ep : NULL;
   }
 
 
-void GsmNMEA::IncomingLine(const std::string line)
+/**
+ * nmea_fields: field cursor on the sentence buffer, no copies
+ *  next() advances to the next comma separated field, fields beyond
+ *  the end of the sentence are returned empty
+ */
+struct nmea_fields
   {
-  std::istringstream sentence(line);
-  std::string token;
+  const char* p;
+  const char* end;
+  const char* f;
+  size_t len;
 
-  if (!std::getline(sentence, token, ','))
-    return;
-  if (token.length() < 6 || token[0] != '$')
+  nmea_fields(const char* start, const char* stop)
+    : p(start), end(stop), f(stop), len(0) {}
+
+  bool next()
+    {
+    if (p > end)
+      {
+      f = end;
+      len = 0;
+      return false;
+      }
+    const char* e = (const char*) memchr(p, ',', end - p);
+    if (e == NULL) e = end;
+    f = p;
+    len = e - p;
+    p = e + 1;
+    return true;
+    }
+
+  char first()
+    {
+    return len ? f[0] : 0;
+    }
+  };
+
+
+/**
+ * nmea_fixed: parse decimal field into fixed point integer
+ *  with <decimals> fractional digits (excess digits are truncated)
+ *  returns false on empty or invalid field
+ */
+static bool nmea_fixed(const char* f, size_t len, int decimals, int64_t &value)
+  {
+  const char* e = f + len;
+  bool neg = false;
+  if (f < e && (*f == '-' || *f == '+'))
+    neg = (*f++ == '-');
+  if (f == e)
+    return false;
+  int64_t v = 0;
+  int frac = -1;
+  for (; f < e; f++)
+    {
+    if (*f == '.' && frac < 0)
+      {
+      frac = 0;
+      continue;
+      }
+    if (*f < '0' || *f > '9')
+      return false;
+    if (frac >= decimals)
+      continue;
+    if (v >= 100000000000LL)
+      return false;
+    v = v * 10 + (*f - '0');
+    if (frac >= 0)
+      frac++;
+    }
+  for (frac = (frac < 0) ? 0 : frac; frac < decimals; frac++)
+    v *= 10;
+  value = neg ? -v : v;
+  return true;
+  }
+
+
+/**
+ * nmea_latlon: convert NMEA degree/minute form to 1e-7 degrees
+ *  maxdeg: 90 for latitudes, 180 for longitudes
+ */
+static bool nmea_latlon(const nmea_fields &fld, int maxdeg, int32_t &e7)
+  {
+  int64_t v;
+  if (!nmea_fixed(fld.f, fld.len, 6, v) || v < 0)
+    return false;
+  int64_t deg = v / 100000000;      // ddmm.mmmmmm → dd
+  int64_t umin = v % 100000000;     // micro minutes
+  int64_t v7 = deg * 10000000 + umin / 6;
+  if (umin >= 60000000 || v7 > maxdeg * 10000000LL)
+    return false;
+  e7 = v7;
+  return true;
+  }
+
+
+/**
+ * nmea_isdigits: check field starts with <count> decimal digits
+ */
+static bool nmea_isdigits(const nmea_fields &fld, size_t count)
+  {
+  if (fld.len < count)
+    return false;
+  for (size_t i = 0; i < count; i++)
+    {
+    if (!isdigit((unsigned char)fld.f[i]))
+      return false;
+    }
+  return true;
+  }
+
+
+void GsmNMEA::IncomingLine(const char* line, size_t len)
+  {
+  if (len < 7 || line[0] != '$')
     return;
-  if (!valid_nmea_cksum(line))
+  const char* end = nmea_cksum_end(line, len);
+  if (end == NULL)
     {
-    ESP_LOGE(TAG, "IncomingLine: bad checksum: %s", line.c_str());
+    m_count_errors++;
+    ESP_LOGE(TAG, "IncomingLine: bad checksum: %.*s", (int)len, line);
     return;
     }
+  m_count_sentences++;
 
-  if (token.substr(3) == "GNS")
+  nmea_fields fld(line + 1, end);
+  if (!fld.next() || fld.len < 5)
+    return;
+  const char* type = fld.f + 2;
+  uint32_t now = esp_log_timestamp();
+
+  if (memcmp(type, "GNS", 3) == 0)
     {
-    ESP_LOGD(TAG, "Incoming GNS: %s", line.c_str());
+    ESP_LOGD(TAG, "Incoming GNS: %.*s", (int)len, line);
     // NMEA sentence type "GNS": GNSS Position Fix Data (GPS/GLONASS/… combined position data)
     //  $..GNS,<Time>,<Latitude>,<NS>,<Longitude>,<EW>,<Mode>,<SatCnt>,<HDOP>,<Altitude>,<GeoidalSep>,<DiffAge>,<Chksum>
     // Example:
@@ -145,56 +253,78 @@ void GsmNMEA::IncomingLine(const std::string line)
     //    D = Differential mode
     //    E = Estimation mode
 
-    float lat=0, lon=0, alt=0, hdop=0;
+    int32_t lat=0, lon=0;
+    int64_t alt=0, hdop=0, satcnt=0;
     char ns=0, ew=0;
     char mode[3] = {0,0,0};
-    int satcnt=0;
-
-    // Parse sentence:
-
-    if (std::getline(sentence, token, ','))
-      {;} // Time ignored here, see RMC handler
-    if (std::getline(sentence, token, ','))
-      lat = gps2latlon(token.c_str());
-    if (std::getline(sentence, token, ','))
-      ns = token[0];
-    if (std::getline(sentence, token, ','))
-      lon = gps2latlon(token.c_str());
-    if (std::getline(sentence, token, ','))
-      ew = token[0];
-    if (std::getline(sentence, token, ','))
-      {
-      mode[0] = token[0];
-      mode[1] = token[1];
-      }
-    if (std::getline(sentence, token, ','))
-      satcnt = atoi(token.c_str());
-    if (std::getline(sentence, token, ','))
-      hdop = atof(token.c_str());
-    if (std::getline(sentence, token, ','))
-      alt = atof(token.c_str());
+
+    // Parse sentence (fixed point: lat/lon 1e-7°, HDOP 1/100, altitude 1/10 m):
+
+    fld.next(); // Time ignored here, see RMC handler
+    fld.next();
+    bool latok = nmea_latlon(fld, 90, lat);
+    fld.next();
+    ns = fld.first();
+    fld.next();
+    bool lonok = nmea_latlon(fld, 180, lon);
+    fld.next();
+    ew = fld.first();
+    fld.next();
+    if (fld.len > 0) mode[0] = fld.f[0];
+    if (fld.len > 1) mode[1] = fld.f[1];
+    fld.next();
+    nmea_fixed(fld.f, fld.len, 0, satcnt);
+    fld.next();
+    nmea_fixed(fld.f, fld.len, 2, hdop);
+    fld.next();
+    nmea_fixed(fld.f, fld.len, 1, alt);
 
     // Check:
 
     if (!ns || !ew || !mode[0])
       return; // malformed/empty sentence
 
-    // Data set complete, store:
-
     if (ns == 'S')
       lat = -lat;
     if (ew == 'W')
       lon = -lon;
 
     bool gpslock = (mode[0] != 'N' || mode[1] != 'N');
+    if (gpslock && (!latok || !lonok))
+      return; // position missing or out of range
+
+    // Only publish on significant change or when the refresh interval has passed,
+    // so high fix rates do not flood the metrics listeners:
+
+    bool changed = (gpslock != StdMetrics.ms_v_pos_gpslock->AsBool())
+      || (now - m_pub_gns_time >= GSM_NMEA_REFRESH_MS)
+      || (memcmp(mode, m_pub_mode, sizeof(mode)) != 0)
+      || (satcnt != m_pub_satcnt)
+      || (llabs(hdop - m_pub_hdop) >= GSM_NMEA_DELTA_HDOP)
+      || (gpslock &&
+          ((abs(lat - m_pub_lat) >= GSM_NMEA_DELTA_LATLON) ||
+           (abs(lon - m_pub_lon) >= GSM_NMEA_DELTA_LATLON) ||
+           (llabs(alt - m_pub_alt) >= GSM_NMEA_DELTA_ALT)));
+    if (!changed)
+      {
+      m_count_skipped++;
+      return;
+      }
+
+    // Data set complete, store:
+
+    m_pub_gns_time = now;
+    memcpy(m_pub_mode, mode, sizeof(mode));
+    m_pub_satcnt = satcnt;
+    m_pub_hdop = hdop;
 
     *StdMetrics.ms_v_pos_gpsmode = (std::string) mode;
     *StdMetrics.ms_v_pos_satcount = (int) satcnt;
-    *StdMetrics.ms_v_pos_gpshdop = (float) hdop;
-    
+    *StdMetrics.ms_v_pos_gpshdop = (float) hdop / 100;
+
     // Derive signal quality from lock status, satellite count and HDOP:
     //  quality ~ satcnt / hdop
-    *StdMetrics.ms_v_pos_gpssq = (int) LIMIT_MAX(gpslock * LIMIT_MIN(satcnt-1,0) / LIMIT_MIN(hdop,0.1) * 10, 100);
+    *StdMetrics.ms_v_pos_gpssq = (int) LIMIT_MAX(gpslock * LIMIT_MIN(satcnt-1,0) * 1000 / LIMIT_MIN(hdop,10), 100);
     // Quality raises by satellite count and drops by HDOP. HDOP 1.0 = perfect.
     // The calculation is designed to get 50% as the threshold for a "good" signal.
     // GPS needs at least 4 satellites in view to get a position, but that will need
@@ -209,9 +339,12 @@ void GsmNMEA::IncomingLine(const std::string line)
 
     if (gpslock)
       {
-      *StdMetrics.ms_v_pos_latitude = (float) lat;
-      *StdMetrics.ms_v_pos_longitude = (float) lon;
-      *StdMetrics.ms_v_pos_altitude = (float) alt;
+      m_pub_lat = lat;
+      m_pub_lon = lon;
+      m_pub_alt = alt;
+      *StdMetrics.ms_v_pos_latitude = (float) ((double) lat / 10000000);
+      *StdMetrics.ms_v_pos_longitude = (float) ((double) lon / 10000000);
+      *StdMetrics.ms_v_pos_altitude = (float) alt / 10;
       *StdMetrics.ms_v_pos_gpstime = time(NULL);
       }
 
@@ -228,50 +361,38 @@ void GsmNMEA::IncomingLine(const std::string line)
     // END "GNS" handler
     }
 
-  else if (token.substr(3) == "RMC")
+  else if (memcmp(type, "RMC", 3) == 0)
     {
-    ESP_LOGD(TAG, "Incoming RMC: %s", line.c_str());
+    ESP_LOGD(TAG, "Incoming RMC: %.*s", (int)len, line);
     // NMEA sentence type "RMC": Recommended Minimum Specific GNSS Data
     //  $..RMC,<Time>,<Status>,<Latitude>,<NS>,<Longitude>,<EW>,<SpeedKnots>,<Direction>,<Date>,<MagVar>,<MagVarEW>,<Mode>,<Chksum>
     // Example:
     //  $GPRMC,085320.0,A,5118.138139,N,00723.398844,E,0.0,265.5,101217,,,A*62
 
-    char date[6] = {0}, time[6] = {0};
-    float direction=0, speed=0;
-
-    // Parse sentence:
-
-    if (std::getline(sentence, token, ','))
-      strncpy(time, token.c_str(), 6);
-    bool speedok = false, directionok = false;
-    if (std::getline(sentence, token, ','))
-      {;} // Status
-    if (std::getline(sentence, token, ','))
-      {;} // Latitude
-    if (std::getline(sentence, token, ','))
-      {;} // NS
-    if (std::getline(sentence, token, ','))
-      {;} // Longitude
-    if (std::getline(sentence, token, ','))
-      {;} // EW
-    if (std::getline(sentence, token, ','))
-      {
-        speedok = !token.empty();
-        if (speedok)
-          speed = atof(token.c_str()) * 1.852;
-      }
-    if (std::getline(sentence, token, ','))
-      {
-      directionok = !token.empty();
-      if (directionok)
-        direction = atof(token.c_str());
-      }
-    if (std::getline(sentence, token, ','))
-      strncpy(date, token.c_str(), 6);
+    const char *date, *time;
+    int64_t speed=0, direction=0;
+
+    // Parse sentence (fixed point: speed 1/1000 kn, direction 1/10°):
+
+    fld.next();
+    bool timeok = nmea_isdigits(fld, 6);
+    time = fld.f;
+    fld.next(); // Status
+    fld.next(); // Latitude
+    fld.next(); // NS
+    fld.next(); // Longitude
+    fld.next(); // EW
+    fld.next();
+    bool speedok = nmea_fixed(fld.f, fld.len, 3, speed);
+    fld.next();
+    bool directionok = nmea_fixed(fld.f, fld.len, 1, direction);
+    fld.next();
+    bool dateok = nmea_isdigits(fld, 6);
+    date = fld.f;
 
     // Check:
 
-    if (!date[0] || !time[0])
+    if (!dateok || !timeok)
       return; // malformed/empty sentence
 
     // Data complete, store:
@@ -281,14 +402,38 @@ void GsmNMEA::IncomingLine(const std::string line)
       auto tm = utc_to_timestamp(date, time);
       if (tm < 1572735600) // 2019-11-03 00:00:00
         tm += (1024*7*86400); // Nasty kludge to workaround SIM5360 week rollover
-      MyTime.Set(TAG, 2, true, tm);
+      if (tm != m_pub_gpstime)
+        {
+        m_pub_gpstime = tm;
+        MyTime.Set(TAG, 2, true, tm);
+        }
       }
 
+    bool refresh = (now - m_pub_rmc_time >= GSM_NMEA_REFRESH_MS);
+    if (refresh)
+      m_pub_rmc_time = now;
+
     if (directionok)
-      *StdMetrics.ms_v_pos_direction = (float) direction;
+      {
+      int32_t delta = abs((int32_t)direction - m_pub_direction);
+      if (delta > 1800) delta = 3600 - delta;
+      if (refresh || delta >= GSM_NMEA_DELTA_DIRECTION)
+        {
+        m_pub_direction = direction;
+        *StdMetrics.ms_v_pos_direction = (float) direction / 10;
+        }
+      }
 
     if (speedok)
-      *StdMetrics.ms_v_pos_gpsspeed = speed;
+      {
+      // knots → 1/10 km/h:
+      int32_t kph10 = speed * 1852 / 100000;
+      if (refresh || abs(kph10 - m_pub_speed) >= GSM_NMEA_DELTA_SPEED)
+        {
+        m_pub_speed = kph10;
+        *StdMetrics.ms_v_pos_gpsspeed = (float) speed * 0.001852f;
+        }
+      }
 
     // END "RMC" handler
     }
@@ -301,6 +446,7 @@ void GsmNMEA::Startup()
   ESP_LOGI(TAG, "Startup");
 
   m_gpstime_enabled = MyConfig.GetParamValueBool("modem", "enable.gpstime", false);
+  ResetPublished();
   m_connected = true;
   }
 
@@ -332,6 +478,25 @@ GsmNMEA::GsmNMEA(GsmMux* mux, int channel_nmea, int channel_cmd)
   m_channel_cmd = channel_cmd;
   m_connected = false;
   m_gpstime_enabled = false;
+  m_count_sentences = 0;
+  m_count_errors = 0;
+  m_count_skipped = 0;
+  ResetPublished();
+  }
+
+void GsmNMEA::ResetPublished()
+  {
+  m_pub_gns_time = 0;
+  m_pub_rmc_time = 0;
+  memset(m_pub_mode, 0, sizeof(m_pub_mode));
+  m_pub_satcnt = -1;
+  m_pub_hdop = -1;
+  m_pub_lat = 0;
+  m_pub_lon = 0;
+  m_pub_alt = 0;
+  m_pub_speed = -1;
+  m_pub_direction = -1;
+  m_pub_gpstime = 0;
   }
 
 GsmNMEA::~GsmNMEA()
@@ -38,6 +38,14 @@
 #include "driver/uart.h"
 #include "gsmmux.h"
 
+#define GSM_NMEA_MAXLINE            128     // max sentence length parsed
+#define GSM_NMEA_REFRESH_MS         900     // min publish interval for unchanged data (~1 Hz)
+#define GSM_NMEA_DELTA_LATLON       100     // significant position change [1e-7°] (~1 m)
+#define GSM_NMEA_DELTA_ALT          10      // significant altitude change [1/10 m]
+#define GSM_NMEA_DELTA_HDOP         10      // significant HDOP change [1/100]
+#define GSM_NMEA_DELTA_SPEED        5       // significant speed change [1/10 km/h]
+#define GSM_NMEA_DELTA_DIRECTION    10      // significant direction change [1/10°]
+
 class GsmNMEA : public InternalRamAllocated
   {
   public:
@@ -45,16 +53,38 @@ class GsmNMEA : public InternalRamAllocated
     ~GsmNMEA();
 
   public:
-    void IncomingLine(const std::string line);
+    void IncomingLine(const char* line, size_t len);
+    void IncomingLine(const std::string& line) { IncomingLine(line.data(), line.size()); }
     void Startup();
     void Shutdown(bool hard=false);
 
+  protected:
+    void ResetPublished();
+
   public:
     GsmMux*       m_mux;
     int           m_channel_nmea;
     int           m_channel_cmd;
     bool          m_connected;
     bool          m_gpstime_enabled;
+
+    uint32_t      m_count_sentences;
+    uint32_t      m_count_errors;
+    uint32_t      m_count_skipped;
+
+  protected:
+    // Last published values (fixed point) for change detection:
+    uint32_t      m_pub_gns_time;
+    uint32_t      m_pub_rmc_time;
+    char          m_pub_mode[3];
+    int64_t       m_pub_satcnt;
+    int64_t       m_pub_hdop;
+    int32_t       m_pub_lat;
+    int32_t       m_pub_lon;
+    int64_t       m_pub_alt;
+    int32_t       m_pub_speed;
+    int32_t       m_pub_direction;
+    int64_t       m_pub_gpstime;
   };
 
 #endif //#ifndef __GSM_NMEA__
@@ -32,6 +32,7 @@
 static const char *TAG = "cellular";
 
 #include <string.h>
+#include <inttypes.h>
 #include <algorithm>
 #include <functional>
 #include "ovms_cellular.h"
@@ -311,7 +312,7 @@ modem::modem(const char* name, uart_port_t uartnum, int baud, int rxpin, int txp
 
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG,"ticker.1", std::bind(&modem::Ticker, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.1", std::bind(&modem::Ticker, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "system.shuttingdown", std::bind(&modem::EventListener, this, _1, _2));
   }
 
@@ -506,6 +507,8 @@ void modem::SupportSummary(OvmsWriter* writer, bool debug /*=FALSE*/)
     if (m_nmea->m_connected)
       {
       writer->printf("  GPS: Connected on channel: #%d\n", m_nmea->m_channel_nmea);
+      writer->printf("     Sentences: %" PRIu32 " parsed, %" PRIu32 " invalid, %" PRIu32 " unchanged\n",
+        m_nmea->m_count_sentences, m_nmea->m_count_errors, m_nmea->m_count_skipped);
       }
     else
       {
@@ -988,9 +991,24 @@ bool modem::StandardIncomingHandler(int channel, OvmsBuffer* buf)
     else
       {
       // Normal line mode
-      while (buf->HasLine() >= 0)
+      int hl;
+      while ((hl = buf->HasLine()) >= 0)
         {
-        StandardLineHandler(channel, buf, buf->ReadLine());
+        // GPS NMEA URC: parse from a stack copy to avoid heap allocations
+        char nmea[GSM_NMEA_MAXLINE];
+        if (m_nmea && hl >= 2 && hl < GSM_NMEA_MAXLINE
+            && m_line_unfinished != channel
+            && !(m_cmd_running && channel == m_mux_channel_CMD)
+            && buf->Peek(2, (uint8_t*)nmea) == 2
+            && nmea[0] == '$' && nmea[1] == 'G')
+          {
+          int len = buf->ReadLine(nmea, sizeof(nmea));
+          m_nmea->IncomingLine(nmea, len);
+          }
+        else
+          {
+          StandardLineHandler(channel, buf, buf->ReadLine());
+          }
         result = true;
         }
       return result;
@@ -1486,7 +1504,7 @@ void modem::SetCellularModemDriver(const char* ModelType)
     MyEvents.SignalEvent("system.modem.installed", NULL);
   }
 
-void modem::Ticker(std::string event, void* data)
+void modem::Ticker(const char* event, void* data)
   {
   modem_or_uart_event_t ev;
 
@@ -209,7 +209,7 @@ class modem : public pcp, public InternalRamAllocated
     void StopPPP();
     void SetCellularModemDriver(const char* ModelType);
     void Task();
-    void Ticker(std::string event, void* data);
+    void Ticker(const char* event, void* data);
     void EventListener(std::string event, void* data);
     void IncomingMuxData(GsmMuxChannel* channel);
     void SendSetState1(modem_state1_t newstate);
@@ -40,26 +40,11 @@ static const char *TAG = "location";
 #include "vehicle.h"
 #include "metrics_standard.h"
 #include <math.h>
+#include <inttypes.h>
 
 const char *LOCATIONS_PARAM = "locations";
 #define LOCATION_DEFRADIUS 100
-
-#define LOCATION_R 6371
-#define LOCATION_TO_RAD (3.1415926536 / 180)
-
-// Calculate haversine distance in meters
-double OvmsLocationDistance(double th1, double ph1, double th2, double ph2)
-  {
-  double dx, dy, dz;
-
-  ph1 -= ph2;
-  ph1 *= LOCATION_TO_RAD, th1 *= LOCATION_TO_RAD, th2 *= LOCATION_TO_RAD;
-
-  dz = sin(th1) - sin(th2);
-  dx = cos(ph1) * cos(th1) - cos(th2);
-  dy = sin(ph1) * cos(th1);
-  return (asin(sqrt(dx * dx + dy * dy + dz * dz) / 2) * 2 * LOCATION_R)*1000.0;
-  }
+#define LOCATION_DEFHYSTERESIS 20
 
 OvmsLocationAction::OvmsLocationAction(bool enter, enum LocationAction action, const char* params, int len)
   : m_enter(enter), m_action(action), m_params(params, len) {}
@@ -132,22 +117,17 @@ ActionList::iterator ActionList::erase(iterator pos)
 OvmsLocation::OvmsLocation(const std::string& name)
   {
   m_name = name;
-  m_inlocation = false;
   }
 
 OvmsLocation::~OvmsLocation()
   {
   }
 
-bool OvmsLocation::IsInLocation(float latitude, float longitude)
+bool OvmsLocation::SetInLocation(bool inlocation)
   {
-  // This should check if we are in the location
-  double dist = OvmsLocationDistance((double)latitude,(double)longitude,(double)m_latitude,(double)m_longitude);
   std::string event;
 
-  // ESP_LOGI(TAG, "Location %s is %0.1fm distant",m_name.c_str(),dist);
-
-  if (fabs(dist) <= m_radius)
+  if (inlocation)
     {
     // We are in the location
     if (!m_inlocation)
@@ -343,6 +323,7 @@ void OvmsLocation::Render(std::string& buf)
 
 void location_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   OvmsConfigParam* p = MyConfig.CachedParam(LOCATIONS_PARAM);
   if (p == NULL) return;
 
@@ -438,6 +419,7 @@ void location_set(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 
 void location_radius(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   const char *name = argv[0];
   OvmsLocation* const* locp = MyLocations.m_locations.FindUniquePrefix(name);
 
@@ -479,6 +461,7 @@ void location_radius(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
 
 void location_rm(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   const char *name = argv[0];
   OvmsLocation* const* locp = MyLocations.m_locations.FindUniquePrefix(name);
 
@@ -495,6 +478,7 @@ void location_rm(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 void location_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   int n;
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   writer->printf("Currently at %0.6f,%0.6f ",MyLocations.m_latitude,MyLocations.m_longitude);
   writer->printf("(%sGPS lock", MyLocations.m_gpslock ? "" : "without ");
   n = StandardMetrics.ms_v_pos_satcount->AsInt();
@@ -528,6 +512,12 @@ void location_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
     writer->puts("");
   else
     writer->puts("No active locations");
+  const OvmsLocationIndex& index = MyLocations.m_index;
+  writer->printf("Index: %d grid cells, %d wide location%s, hysteresis %dm\n",
+    index.m_grid.size(), index.m_wide.size(),
+    index.m_wide.size() == 1 ? "" : "s", index.m_hysteresis);
+  writer->printf("Last update checked %d location%s in %" PRIu32 " us\n",
+    index.m_checked, index.m_checked == 1 ? "" : "s", index.m_time);
   }
 
 int location_validate(OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv, bool complete)
@@ -549,6 +539,7 @@ int location_radius_validate(OvmsWriter* writer, OvmsCommand* cmd, int argc, con
 
 void location_action(int verbosity, OvmsWriter* writer, enum LocationAction act, std::string& params)
   {
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   const char* const* rargv = writer->GetArgv();
   int remove = *rargv[2] == 'r' ? 1 : 0;
   bool enter = *rargv[2+remove] == 'e';
@@ -670,6 +661,7 @@ void location_all(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 
 static duk_ret_t DukOvmsLocationStatus(duk_context *ctx)
   {
+  OvmsRecMutexLock lock(&MyLocations.m_index.m_lock);
   const char *mn = duk_to_string(ctx,0);
   OvmsLocation* const* locp = MyLocations.m_locations.FindUniquePrefix(mn);
   if (locp && *locp)
@@ -705,6 +697,7 @@ OvmsLocations::OvmsLocations()
   m_valet_distance = 0;
   m_valet_invalid = true;
   m_valet_last_alarm = 0;
+  m_index.m_hysteresis = LOCATION_DEFHYSTERESIS;
 
   // Register our commands
   OvmsCommand* cmd_location = MyCommandApp.RegisterCommand("location","LOCATION framework", location_status, "", 0, 0, false);
@@ -863,6 +856,9 @@ void OvmsLocations::ReloadMap()
   OvmsConfigParam* p = MyConfig.CachedParam(LOCATIONS_PARAM);
   if (p == NULL) return;
 
+  // Locations are deleted here, so hold the index lock until it's rebuilt:
+  OvmsRecMutexLock lock(&m_index.m_lock);
+
   // Forward search, updating existing locations
   for (ConfigParamMap::iterator it=p->m_map.begin(); it!=p->m_map.end(); ++it)
     {
@@ -908,17 +904,26 @@ void OvmsLocations::ReloadMap()
       }
     }
 
+  RebuildIndex();
+
   if (m_gpsgood) UpdateLocations();
   }
 
+void OvmsLocations::RebuildIndex()
+  {
+  OvmsRecMutexLock lock(&m_index.m_lock);
+  m_index.Clear(MyConfig.GetParamValueInt("vehicle", "location.hysteresis", LOCATION_DEFHYSTERESIS));
+  for (LocationMap::iterator it=m_locations.begin(); it!=m_locations.end(); ++it)
+    m_index.Add(it->second);
+
+  ESP_LOGD(TAG, "RebuildIndex: %d locations, %d grid cells, %d wide",
+    m_locations.size(), m_index.m_grid.size(), m_index.m_wide.size());
+  }
+
 void OvmsLocations::UpdateLocations()
   {
   if ((m_latitude == 0) && (m_longitude == 0)) return;
-
-  for (LocationMap::iterator it=m_locations.begin(); it!=m_locations.end(); ++it)
-    {
-    it->second->IsInLocation(m_latitude,m_longitude);
-    }
+  m_index.Update(m_latitude, m_longitude);
   }
 
 void OvmsLocations::CheckTheft()
@@ -1098,6 +1103,12 @@ void OvmsLocations::UpdatedConfig(std::string event, void* data)
     {
     // Only reload if our parameter has changed
     OvmsConfigParam*p = (OvmsConfigParam*)data;
+    if (p->GetName().compare("vehicle")==0)
+      {
+      if (MyConfig.GetParamValueInt("vehicle", "location.hysteresis", LOCATION_DEFHYSTERESIS) != m_index.m_hysteresis)
+        RebuildIndex();
+      return;
+      }
     if (p->GetName().compare(LOCATIONS_PARAM)!=0) return;
     }
 
@@ -31,9 +31,12 @@
 #ifndef __LOCATION_H__
 #define __LOCATION_H__
 
+#include <map>
+#include <vector>
 #include "ovms_metrics.h"
 #include "ovms_utils.h"
 #include "ovms_command.h"
+#include "ovms_location_index.h"
 
 enum LocationAction {
   INVALID = 0,
@@ -63,14 +66,14 @@ class ActionList : public std::list<OvmsLocationAction*>
     iterator erase(iterator pos);
   };
 
-class OvmsLocation
+class OvmsLocation : public OvmsLocationArea
   {
   public:
     OvmsLocation(const std::string& name);
     ~OvmsLocation();
 
   public:
-    bool IsInLocation(float latitude, float longitude);
+    bool SetInLocation(bool inlocation);
     bool Parse(const std::string& value);
     void Store(std::string& buf);
     void Render(std::string& buf);
@@ -78,10 +81,6 @@ class OvmsLocation
   public:
     std::string m_name;
     std::string m_value;
-    float m_latitude;
-    float m_longitude;
-    int m_radius;
-    bool m_inlocation;
     ActionList m_actions;
   };
 
@@ -119,8 +118,11 @@ class OvmsLocations
 
     LocationMap m_locations;
 
+    OvmsLocationIndex m_index;      // m_index.m_lock also guards m_locations
+
   public:
     void ReloadMap();
+    void RebuildIndex();
     void UpdateLocations();
     void UpdateParkPosition();
     void CheckTheft();
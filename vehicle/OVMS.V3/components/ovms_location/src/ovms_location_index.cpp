@@ -0,0 +1,210 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include <math.h>
+#include "ovms_location_index.h"
+#include "esp_timer.h"
+
+#define LOCATION_R 6371
+#define LOCATION_TO_RAD (3.1415926536 / 180)
+
+// Calculate haversine distance in meters
+double OvmsLocationDistance(double th1, double ph1, double th2, double ph2)
+  {
+  double dx, dy, dz;
+
+  ph1 -= ph2;
+  ph1 *= LOCATION_TO_RAD, th1 *= LOCATION_TO_RAD, th2 *= LOCATION_TO_RAD;
+
+  dz = sin(th1) - sin(th2);
+  dx = cos(ph1) * cos(th1) - cos(th2);
+  dy = sin(ph1) * cos(th1);
+  return (asin(sqrt(dx * dx + dy * dy + dz * dz) / 2) * 2 * LOCATION_R)*1000.0;
+  }
+
+// Spatial index: locations are sorted into a grid of LOCATION_GRID_DEG cells
+// covering their radius plus hysteresis, so a position update only needs to
+// check the locations of the current cell. Locations spanning more than
+// LOCATION_GRID_MAXCELLS cells (or the date line / poles) are kept in a
+// separate list and checked on every update.
+#define LOCATION_M_PER_DEG (LOCATION_R * 1000.0 * LOCATION_TO_RAD)
+#define LOCATION_GRID_DEG 0.01
+#define LOCATION_GRID_MAXCELLS 64
+
+static inline uint32_t LocationGridRow(double latitude)
+  {
+  if (latitude < -90) latitude = -90;
+  else if (latitude > 90) latitude = 90;
+  return (uint32_t)floor((latitude + 90) / LOCATION_GRID_DEG);
+  }
+
+static inline uint32_t LocationGridCol(double longitude)
+  {
+  if (longitude < -180) longitude = -180;
+  else if (longitude > 180) longitude = 180;
+  return (uint32_t)floor((longitude + 180) / LOCATION_GRID_DEG);
+  }
+
+static inline uint32_t LocationGridKey(uint32_t row, uint32_t col)
+  {
+  return (row << 16) | col;
+  }
+
+// Cheap equirectangular pre-filter: true if the points may be within
+// the distance (meters). Includes a safety margin for the approximation.
+static bool OvmsLocationNear(double th1, double ph1, double th2, double ph2, double distance)
+  {
+  double dy = (th2 - th1) * LOCATION_M_PER_DEG;
+  double dx = (ph2 - ph1) * LOCATION_M_PER_DEG * cos((th1 + th2) / 2 * LOCATION_TO_RAD);
+  double limit = distance * 1.01 + 1;
+  return (dx * dx + dy * dy) <= (limit * limit);
+  }
+
+OvmsLocationArea::OvmsLocationArea()
+  {
+  m_latitude = 0;
+  m_longitude = 0;
+  m_radius = 0;
+  m_inlocation = false;
+  m_wide = false;
+  m_checkseq = 0;
+  }
+
+OvmsLocationArea::~OvmsLocationArea()
+  {
+  }
+
+bool OvmsLocationArea::IsInLocation(float latitude, float longitude, int hysteresis /*=0*/)
+  {
+  // This should check if we are in the location
+  double dist = OvmsLocationDistance((double)latitude,(double)longitude,(double)m_latitude,(double)m_longitude);
+
+  // Once entered, we only leave the location beyond radius + hysteresis
+  // to avoid flapping on GPS jitter at the border:
+  return SetInLocation(fabs(dist) <= (m_inlocation ? m_radius + hysteresis : m_radius));
+  }
+
+bool OvmsLocationArea::SetInLocation(bool inlocation)
+  {
+  m_inlocation = inlocation;
+  return m_inlocation;
+  }
+
+OvmsLocationIndex::OvmsLocationIndex()
+  {
+  m_hysteresis = 0;
+  m_seq = 0;
+  m_checked = 0;
+  m_time = 0;
+  }
+
+void OvmsLocationIndex::Clear(int hysteresis)
+  {
+  OvmsRecMutexLock lock(&m_lock);
+  m_hysteresis = (hysteresis < 0) ? 0 : hysteresis;
+  m_grid.clear();
+  m_wide.clear();
+  m_active.clear();
+  }
+
+void OvmsLocationIndex::Add(OvmsLocationArea* loc)
+  {
+  OvmsRecMutexLock lock(&m_lock);
+  if (loc->m_inlocation)
+    m_active.push_back(loc);
+
+  // Determine the grid cells covered by the location's bounding box:
+  double reach = loc->m_radius + m_hysteresis;
+  double dlat = reach / LOCATION_M_PER_DEG;
+  double coslat = cos(loc->m_latitude * LOCATION_TO_RAD);
+  double dlon = (coslat > 0.01) ? dlat / coslat : 360;
+  if (loc->m_latitude - dlat < -90 || loc->m_latitude + dlat > 90 ||
+      loc->m_longitude - dlon < -180 || loc->m_longitude + dlon > 180)
+    {
+    loc->m_wide = true;
+    m_wide.push_back(loc);
+    return;
+    }
+  uint32_t r0 = LocationGridRow(loc->m_latitude - dlat), r1 = LocationGridRow(loc->m_latitude + dlat);
+  uint32_t c0 = LocationGridCol(loc->m_longitude - dlon), c1 = LocationGridCol(loc->m_longitude + dlon);
+  if ((r1-r0+1) * (c1-c0+1) > LOCATION_GRID_MAXCELLS)
+    {
+    loc->m_wide = true;
+    m_wide.push_back(loc);
+    return;
+    }
+  loc->m_wide = false;
+  for (uint32_t r = r0; r <= r1; r++)
+    {
+    for (uint32_t c = c0; c <= c1; c++)
+      m_grid[LocationGridKey(r, c)].push_back(loc);
+    }
+  }
+
+void OvmsLocationIndex::Update(float latitude, float longitude)
+  {
+  OvmsRecMutexLock lock(&m_lock);
+  uint32_t t0 = esp_timer_get_time();
+  uint32_t seq = ++m_seq;
+  LocationList active;
+  int checked = 0;
+
+  auto check = [&](OvmsLocationArea* loc)
+    {
+    if (loc->m_checkseq == seq) return;
+    loc->m_checkseq = seq;
+    checked++;
+    if (!loc->m_wide && !OvmsLocationNear(latitude, longitude,
+          loc->m_latitude, loc->m_longitude, loc->m_radius + m_hysteresis))
+      loc->SetInLocation(false);
+    else
+      loc->IsInLocation(latitude, longitude, m_hysteresis);
+    if (loc->m_inlocation)
+      active.push_back(loc);
+    };
+
+  // Check active locations first, so leave events precede enter events:
+  for (OvmsLocationArea* loc : m_active)
+    check(loc);
+
+  // Check candidates from the current grid cell and the wide locations:
+  auto cell = m_grid.find(LocationGridKey(LocationGridRow(latitude), LocationGridCol(longitude)));
+  if (cell != m_grid.end())
+    {
+    for (OvmsLocationArea* loc : cell->second)
+      check(loc);
+    }
+  for (OvmsLocationArea* loc : m_wide)
+    check(loc);
+
+  m_active.swap(active);
+  m_checked = checked;
+  m_time = esp_timer_get_time() - t0;
+  }
@@ -0,0 +1,97 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __LOCATION_INDEX_H__
+#define __LOCATION_INDEX_H__
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "ovms_mutex.h"
+
+double OvmsLocationDistance(double th1, double ph1, double th2, double ph2);
+
+/**
+ * OvmsLocationArea: the geometry & state of a location as seen by the index.
+ *  SetInLocation() is called on every state check, OvmsLocation overrides it
+ *  to raise the enter/leave events & actions.
+ */
+class OvmsLocationArea
+  {
+  public:
+    OvmsLocationArea();
+    virtual ~OvmsLocationArea();
+
+  public:
+    bool IsInLocation(float latitude, float longitude, int hysteresis=0);
+    virtual bool SetInLocation(bool inlocation);
+
+  public:
+    float m_latitude;
+    float m_longitude;
+    int m_radius;
+    bool m_inlocation;
+
+    bool m_wide;                    // not in grid index, checked on every update
+    uint32_t m_checkseq;            // last index update sequence checked
+  };
+
+typedef std::vector<OvmsLocationArea*> LocationList;
+typedef std::map<uint32_t, LocationList> LocationGrid;
+
+/**
+ * OvmsLocationIndex: spatial index of the location areas.
+ *
+ * Rebuilds (config task) and updates (GPS metric listener) run on different
+ *  tasks. m_lock must be held while the indexed areas are added or deleted,
+ *  Clear(), Add() and Update() take it themselves.
+ */
+class OvmsLocationIndex
+  {
+  public:
+    OvmsLocationIndex();
+
+  public:
+    void Clear(int hysteresis);
+    void Add(OvmsLocationArea* area);
+    void Update(float latitude, float longitude);
+
+  public:
+    OvmsRecMutex m_lock;
+    int m_hysteresis;               // leave distance margin [m]
+    LocationGrid m_grid;            // spatial index: grid cell -> locations
+    LocationList m_wide;            // locations too large for the grid
+    LocationList m_active;          // locations currently entered
+    uint32_t m_seq;
+    int m_checked;                  // locations checked by last update
+    uint32_t m_time;                // last update duration [us]
+  };
+
+#endif //#ifndef __LOCATION_INDEX_H__
@@ -150,6 +150,8 @@ bool OvmsNetTcpClient::Connect(std::string dest, struct mg_connect_opts opts, do
     mg_set_timer(m_mgconn, mg_time() + timeout);
     }
   m_netstate = NetConnConnecting;
+  // let the network task add the new socket to its poll set:
+  MyNetManager.MongooseWakeup();
   return true;
   }
 
@@ -176,6 +178,7 @@ size_t OvmsNetTcpClient::SendData(uint8_t *data, size_t length)
     {
     OvmsMutexLock mg(&m_mgconn_mutex);
     mg_send(m_mgconn, data, length);
+    MyNetManager.MongooseWakeup();
     return length;
     }
   else
@@ -769,7 +769,7 @@ OvmsOTA::OvmsOTA()
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG,"ticker.600", std::bind(&OvmsOTA::Ticker600, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.600", std::bind(&OvmsOTA::Ticker600, this, _1, _2));
 
 #ifdef CONFIG_OVMS_COMP_SDCARD
   MyEvents.RegisterEvent(TAG,"sd.mounted", std::bind(&OvmsOTA::CheckFlashSD, this, _1, _2));
@@ -875,7 +875,7 @@ void OvmsOTA::GetStatus(ota_info& info, bool check_update /*=true*/)
     }
   }
 
-void OvmsOTA::Ticker600(std::string event, void* data)
+void OvmsOTA::Ticker600(const char* event, void* data)
   {
   if (MyConfig.GetParamValueBool("auto", "ota", true) == false)
     return;
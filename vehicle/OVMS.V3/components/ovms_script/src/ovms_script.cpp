@@ -76,6 +76,12 @@ static void script_meminfo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd,
   MyDuktape.DuktapeEvalNoResult("JSON.print(meminfo())", writer);
   }
 
+static void script_clearcache(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyDuktape.BytecodeCacheClear();
+  writer->puts("Javascript bytecode cache cleared");
+  }
+
 #endif // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
 OvmsScripts MyScripts __attribute__ ((init_priority (1600)));
@@ -241,6 +247,7 @@ OvmsScripts::OvmsScripts()
   cmd_script->RegisterCommand("eval","Eval some javascript code",script_eval,"<code>",1,1);
   cmd_script->RegisterCommand("compact","Compact javascript heap",script_compact);
   cmd_script->RegisterCommand("meminfo","Show heap memory status",script_meminfo);
+  cmd_script->RegisterCommand("clearcache","Clear javascript bytecode cache",script_clearcache);
 #endif // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   MyCommandApp.RegisterCommand(".","Run a script",script_run,"<path>",1,1, true, vfs_file_validate);
   }
@@ -171,6 +171,12 @@ static duk_ret_t DukOvmsMemInfo(duk_context *ctx)
     dc.Push(heapinfo.total_blocks);               dc.PutProp(obj_idx, "sysTotalBlocks");
   #endif
 
+  // Bytecode cache statistics:
+  dc.Push(MyDuktape.m_bccache_hits);              dc.PutProp(obj_idx, "bcCacheHits");
+  dc.Push(MyDuktape.m_bccache_misses);            dc.PutProp(obj_idx, "bcCacheMisses");
+  dc.Push(MyDuktape.m_bccache_writes);            dc.PutProp(obj_idx, "bcCacheWrites");
+  dc.Push(MyDuktape.m_bccache_errors);            dc.PutProp(obj_idx, "bcCacheErrors");
+
   return 1;
   }
 
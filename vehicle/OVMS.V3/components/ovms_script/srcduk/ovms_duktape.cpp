@@ -37,10 +37,13 @@ static const char *TAG = "ovms-duktape";
 #include <string.h>
 #include <stdio.h>
 #include <dirent.h>
+#include <sys/stat.h>
 #include <esp_task_wdt.h>
+#include "rom/crc.h"
 #include "ovms_malloc.h"
 #include "ovms_module.h"
 #include "ovms_duktape.h"
+#include "ovms_version.h"
 #include "ovms_config.h"
 #include "ovms_command.h"
 #include "ovms_events.h"
@@ -176,11 +179,11 @@ static duk_ret_t duk__handle_require(duk_context *ctx)
 		duk_throw(ctx);  /* rethrow */
 	  }
 
-	if (duk_is_string(ctx, -1))
+	if (duk_is_string(ctx, -1) || duk_is_buffer_data(ctx, -1))
     {
 		duk_int_t ret;
 
-		/* [ ... module source ] */
+		/* [ ... module source|bytecode ] */
 		ret = duk_safe_call(ctx, duk__eval_module_source, NULL, 2, 1);
 		if (ret != DUK_EXEC_SUCCESS)
       {
@@ -270,26 +273,42 @@ static duk_int_t duk__eval_module_source(duk_context *ctx, void *udata)
 
 	/*
 	 *  Stack: [ ... module source ]
+	 *
+	 *  "source" may also be a buffer containing the cached bytecode of the
+	 *  wrapper function (see OvmsDuktape::BytecodeCacheLoad()).
 	 */
 
 	(void) udata;
 
-	/* Wrap the module code in a function expression.  This is the simplest
-	 * way to implement CommonJS closure semantics and matches the behavior of
-	 * e.g. Node.js.
-	 */
-	duk_push_string(ctx, "(function(exports,require,module,__filename,__dirname){");
-	src = duk_require_string(ctx, -2);
-	duk_push_string(ctx, (src[0] == '#' && src[1] == '!') ? "//" : "");  /* Shebang support. */
-	duk_dup(ctx, -3);  /* source */
-	duk_push_string(ctx, "\n})");  /* Newline allows module last line to contain a // comment. */
-	duk_concat(ctx, 4);
-
-	/* [ ... module source func_src ] */
-
-	(void) duk_get_prop_string(ctx, -3, "filename");
-	duk_compile(ctx, DUK_COMPILE_EVAL);
-	duk_call(ctx, 0);
+	if (duk_is_buffer_data(ctx, -1))
+	  {
+		duk_dup(ctx, -1);
+		duk_load_function(ctx);
+	  }
+	else
+	  {
+		/* Wrap the module code in a function expression.  This is the simplest
+		 * way to implement CommonJS closure semantics and matches the behavior of
+		 * e.g. Node.js.  The wrapper is compiled directly as a function (not as
+		 * an eval returning a function), so it can be dumped to the bytecode cache.
+		 */
+		duk_push_string(ctx, "function(exports,require,module,__filename,__dirname){");
+		src = duk_require_string(ctx, -2);
+		duk_push_string(ctx, (src[0] == '#' && src[1] == '!') ? "//" : "");  /* Shebang support. */
+		duk_dup(ctx, -3);  /* source */
+		duk_push_string(ctx, "\n}");  /* Newline allows module last line to contain a // comment. */
+		duk_concat(ctx, 4);
+
+		/* [ ... module source func_src ] */
+
+		(void) duk_get_prop_string(ctx, -3, "filename");
+		duk_compile(ctx, DUK_COMPILE_FUNCTION);
+
+		/* Store the compiled function if the module was loaded from a file: */
+		if (duk_get_prop_string(ctx, -3, "\xff" "bcPath"))
+			MyDuktape.BytecodeCacheSave(ctx, -2, duk_get_string(ctx, -1));
+		duk_pop(ctx);
+	  }
 
 	/* [ ... module source func ] */
 
@@ -321,8 +340,10 @@ static duk_int_t duk__eval_module_source(duk_context *ctx, void *udata)
 	return 1;
   }
 
-/* Load a module as the 'main' module. */
-duk_ret_t duk_module_node_peval_main(duk_context *ctx, const char *path)
+/* Load a module as the 'main' module.
+ * If cachepath is given, the compiled source will be stored in the bytecode cache.
+ */
+duk_ret_t duk_module_node_peval_main(duk_context *ctx, const char *path, const char *cachepath)
   {
 	/*
 	 *  Stack: [ ... source ]
@@ -331,6 +352,12 @@ duk_ret_t duk_module_node_peval_main(duk_context *ctx, const char *path)
 	duk__push_module_object(ctx, path, 1 /*main*/);
 	/* [ ... source module ] */
 
+	if (cachepath)
+	  {
+		duk_push_string(ctx, cachepath);
+		duk_put_prop_string(ctx, -2, "\xff" "bcPath");
+	  }
+
 	duk_dup(ctx, 0);
 	/* [ ... source module source ] */
 
@@ -538,6 +565,12 @@ static duk_ret_t DukOvmsLoadModule(duk_context *ctx)
     duk_error(ctx, DUK_ERR_TYPE_ERROR, "load_cb: cannot find module: %s", module_id);
     return 0;
     }
+  else if (MyDuktape.BytecodeCacheLoad(ctx, path.c_str()))
+    {
+    fclose(sf);
+    ESP_LOGD(TAG,"load_cb: id:'%s' bytecode cache provided %s", module_id, filename);
+    MyDuktape.NotifyDuktapeModuleLoad(filename);
+    }
   else
     {
     fseek(sf,0,SEEK_END);
@@ -551,11 +584,222 @@ static duk_ret_t DukOvmsLoadModule(duk_context *ctx)
     fclose(sf);
     ESP_LOGD(TAG,"load_cb: id:'%s' vfs provided %s (%lu bytes)", module_id, filename, slen);
     MyDuktape.NotifyDuktapeModuleLoad(filename);
+    // Request bytecode cache update after compilation:
+    duk_push_string(ctx, path.c_str());
+    duk_put_prop_string(ctx, 2, "\xff" "bcPath");
     }
 
   return 1;
   }
 
+////////////////////////////////////////////////////////////////////////////////
+// Bytecode cache
+//
+// Modules loaded from the VFS are compiled into a wrapper function (see
+// duk__eval_module_source()). The compiled function is dumped into a cache
+// file in /store/.jscache, keyed by the source path, file modification time &
+// size and the firmware version. On the next load (boot or "script reload"),
+// a valid cache entry replaces reading & compiling the source. The bytecode
+// is CRC32 checked, a damaged entry is compiled from the source again.
+// The cache can be disabled by config "module duktape.bccache" = "no".
+
+#define BCCACHE_DIR       "/store/.jscache"
+#define BCCACHE_MAGIC     0x3243424f      // "OBC2"
+
+typedef struct
+  {
+  uint32_t magic;           // BCCACHE_MAGIC
+  uint32_t fwhash;          // hash of firmware version & build
+  uint32_t srcmtime;        // source file modification time
+  uint32_t srcsize;         // source file size
+  uint16_t pathlen;         // length of source path following the header
+  uint16_t reserved;
+  uint32_t bcsize;          // bytecode size following the path
+  uint32_t bccrc;           // CRC32 of the bytecode
+  } bccache_header_t;
+
+static uint32_t bccache_hash(const char* str, uint32_t hash = 2166136261u)
+  {
+  // FNV-1a
+  while (*str)
+    {
+    hash ^= (uint8_t) *str++;
+    hash *= 16777619u;
+    }
+  return hash;
+  }
+
+static uint32_t bccache_fwhash()
+  {
+  static uint32_t fwhash = 0;
+  if (!fwhash)
+    {
+    fwhash = bccache_hash(GetOVMSVersion().c_str());
+    fwhash = bccache_hash(GetOVMSBuild().c_str(), fwhash);
+    fwhash = bccache_hash(DUK_GIT_DESCRIBE, fwhash);
+    }
+  return fwhash;
+  }
+
+bool OvmsDuktape::BytecodeCacheEnabled()
+  {
+  return MyConfig.GetParamValueBool("module", "duktape.bccache", true);
+  }
+
+std::string OvmsDuktape::BytecodeCachePath(const char* path)
+  {
+  char name[20];
+  snprintf(name, sizeof(name), "/%08" PRIx32 ".jsbc", bccache_hash(path));
+  return std::string(BCCACHE_DIR) + name;
+  }
+
+/**
+ * BytecodeCacheLoad: try to load the compiled function for source file <path>
+ *  from the cache. On success, pushes the bytecode as a buffer & returns true.
+ */
+bool OvmsDuktape::BytecodeCacheLoad(duk_context *ctx, const char* path)
+  {
+  if (!BytecodeCacheEnabled())
+    return false;
+
+  struct stat st;
+  if (stat(path, &st) != 0)
+    return false;
+
+  std::string cpath = BytecodeCachePath(path);
+  FILE* cf = fopen(cpath.c_str(), "r");
+  if (!cf)
+    {
+    m_bccache_misses++;
+    return false;
+    }
+
+  bool valid = false;
+  bccache_header_t hdr;
+  size_t pathlen = strlen(path);
+  if (fread(&hdr, sizeof(hdr), 1, cf) == 1 &&
+      hdr.magic == BCCACHE_MAGIC &&
+      hdr.fwhash == bccache_fwhash() &&
+      hdr.srcmtime == (uint32_t) st.st_mtime &&
+      hdr.srcsize == (uint32_t) st.st_size &&
+      hdr.pathlen == pathlen &&
+      hdr.bcsize > 0)
+    {
+    char* cachedpath = new char[pathlen];
+    valid = (fread(cachedpath, pathlen, 1, cf) == 1 && memcmp(cachedpath, path, pathlen) == 0);
+    delete [] cachedpath;
+    }
+
+  if (valid)
+    {
+    void* bc = duk_push_fixed_buffer(ctx, hdr.bcsize);
+    if (fread(bc, hdr.bcsize, 1, cf) != 1)
+      {
+      ESP_LOGW(TAG, "BytecodeCacheLoad: %s: read error", cpath.c_str());
+      duk_pop(ctx);
+      m_bccache_errors++;
+      valid = false;
+      }
+    else if (crc32_le(0, (const uint8_t*)bc, hdr.bcsize) != hdr.bccrc)
+      {
+      ESP_LOGW(TAG, "BytecodeCacheLoad: %s: CRC mismatch, compiling source", cpath.c_str());
+      duk_pop(ctx);
+      m_bccache_errors++;
+      valid = false;
+      }
+    }
+
+  fclose(cf);
+
+  if (valid)
+    {
+    ESP_LOGD(TAG, "BytecodeCacheLoad: %s: hit (%" PRIu32 " bytes)", path, hdr.bcsize);
+    m_bccache_hits++;
+    }
+  else
+    {
+    ESP_LOGD(TAG, "BytecodeCacheLoad: %s: miss", path);
+    m_bccache_misses++;
+    }
+  return valid;
+  }
+
+/**
+ * BytecodeCacheSave: dump the compiled function at fn_idx into the cache
+ *  for source file <path>. Cache errors are not fatal, the module just
+ *  will be compiled again on the next load.
+ */
+void OvmsDuktape::BytecodeCacheSave(duk_context *ctx, duk_idx_t fn_idx, const char* path)
+  {
+  if (!BytecodeCacheEnabled())
+    return;
+
+  struct stat st;
+  if (stat(path, &st) != 0)
+    return;
+
+  bccache_header_t hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.magic = BCCACHE_MAGIC;
+  hdr.fwhash = bccache_fwhash();
+  hdr.srcmtime = st.st_mtime;
+  hdr.srcsize = st.st_size;
+  hdr.pathlen = strlen(path);
+
+  duk_dup(ctx, fn_idx);
+  duk_dump_function(ctx);
+  duk_size_t bcsize;
+  void* bc = duk_get_buffer_data(ctx, -1, &bcsize);
+  hdr.bcsize = bcsize;
+  hdr.bccrc = bc ? crc32_le(0, (const uint8_t*)bc, bcsize) : 0;
+
+  std::string cpath = BytecodeCachePath(path);
+  bool ok = false;
+  if (bc && bcsize > 0 && (path_exists(BCCACHE_DIR) || mkpath(BCCACHE_DIR) == 0))
+    {
+    FILE* cf = fopen(cpath.c_str(), "w");
+    if (cf)
+      {
+      ok = (fwrite(&hdr, sizeof(hdr), 1, cf) == 1 &&
+            fwrite(path, hdr.pathlen, 1, cf) == 1 &&
+            fwrite(bc, bcsize, 1, cf) == 1);
+      ok = (fclose(cf) == 0) && ok;
+      }
+    }
+  duk_pop(ctx);
+
+  if (ok)
+    {
+    ESP_LOGD(TAG, "BytecodeCacheSave: %s: %u bytes written to %s", path, bcsize, cpath.c_str());
+    m_bccache_writes++;
+    }
+  else
+    {
+    ESP_LOGW(TAG, "BytecodeCacheSave: %s: failed to write %s", path, cpath.c_str());
+    unlink(cpath.c_str());
+    m_bccache_errors++;
+    }
+  }
+
+/**
+ * BytecodeCacheClear: remove all cache entries
+ */
+void OvmsDuktape::BytecodeCacheClear()
+  {
+  DIR *dir = opendir(BCCACHE_DIR);
+  if (!dir)
+    return;
+  struct dirent *dp;
+  while ((dp = readdir(dir)) != NULL)
+    {
+    std::string fpath = BCCACHE_DIR "/";
+    fpath.append(dp->d_name);
+    unlink(fpath.c_str());
+    }
+  closedir(dir);
+  m_bccache_hits = m_bccache_misses = m_bccache_writes = m_bccache_errors = 0;
+  }
+
 ////////////////////////////////////////////////////////////////////////////////
 // DuktapeObject
 
@@ -938,6 +1182,10 @@ OvmsDuktape::OvmsDuktape()
   m_dukctx = NULL;
   m_duktaskid = NULL;
   m_duktaskqueue = NULL;
+  m_bccache_hits = 0;
+  m_bccache_misses = 0;
+  m_bccache_writes = 0;
+  m_bccache_errors = 0;
 
   // Register standard modules...
   extern const char mod_pubsub_js_start[]     asm("_binary_pubsub_js_start");
@@ -1387,18 +1635,23 @@ void OvmsDuktape::DukTapeInit()
   FILE* sf = fopen("/store/scripts/ovmsmain.js", "r");
   if (sf != NULL)
     {
-    fseek(sf,0,SEEK_END);
-    long slen = ftell(sf);
-    fseek(sf,0,SEEK_SET);
-    char *script = new char[slen+1];
-    memset(script,0,slen+1);
-    fread(script,1,slen,sf);
-    duk_push_string(m_dukctx, script);
-    delete [] script;
+    const char* cachepath = NULL;
+    if (!BytecodeCacheLoad(m_dukctx, "/store/scripts/ovmsmain.js"))
+      {
+      fseek(sf,0,SEEK_END);
+      long slen = ftell(sf);
+      fseek(sf,0,SEEK_SET);
+      char *script = new char[slen+1];
+      memset(script,0,slen+1);
+      fread(script,1,slen,sf);
+      duk_push_string(m_dukctx, script);
+      delete [] script;
+      cachepath = "/store/scripts/ovmsmain.js";
+      }
     fclose(sf);
     ESP_LOGI(TAG,"Duktape: Executing ovmsmain.js");
     NotifyDuktapeModuleLoad("ovmsmain.js");
-    duk_module_node_peval_main(m_dukctx, "ovmsmain.js");
+    duk_module_node_peval_main(m_dukctx, "ovmsmain.js", cachepath);
     NotifyDuktapeModuleUnload("ovmsmain.js");
     }
   }
@@ -326,6 +326,22 @@ class OvmsDuktape
     duk_context* DukTapeContext() { return m_dukctx; }
     void EventScript(std::string event, void* data);
 
+  public:
+    // Compiled module bytecode cache (/store/.jscache):
+    bool BytecodeCacheLoad(duk_context *ctx, const char* path);
+    void BytecodeCacheSave(duk_context *ctx, duk_idx_t fn_idx, const char* path);
+    void BytecodeCacheClear();
+
+  protected:
+    bool BytecodeCacheEnabled();
+    std::string BytecodeCachePath(const char* path);
+
+  public:
+    uint32_t m_bccache_hits;        // modules loaded from bytecode
+    uint32_t m_bccache_misses;      // modules compiled from source
+    uint32_t m_bccache_writes;      // cache entries written
+    uint32_t m_bccache_errors;      // cache read/write failures
+
   protected:
     duk_context* m_dukctx;
     TaskHandle_t m_duktaskid;
@@ -799,6 +799,7 @@ bool OvmsServerV2::Transmit(const std::string& message)
   base64encode((uint8_t*)s, len, (uint8_t*)buf);
   strcat(buf,"\r\n");
   mg_send(m_mgconn, buf, strlen(buf));
+  MyNetManager.MongooseWakeup();
 
   delete [] buf;
   delete [] s;
@@ -906,7 +907,7 @@ void OvmsServerV2::Connect()
     m_connretry = 60; // Try again in 60 seconds...
     return;
     }
-  return;
+  MyNetManager.MongooseWakeup();
   }
 
 void OvmsServerV2::Disconnect()
@@ -1934,20 +1935,20 @@ bool OvmsServerV2::IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* e
 /**
  * EventListener:
  */
-void OvmsServerV2::EventListener(std::string event, void* data)
+void OvmsServerV2::EventListener(const char* event, void* data)
   {
-  if (event == "system.modem.received.ussd")
+  if (strcmp(event, "system.modem.received.ussd") == 0)
     {
     // forward USSD response to server:
     std::string buf = "MP-0 c41,0,";
     buf.append(mp_encode(std::string((char*) data)));
     Transmit(buf);
     }
-  else if (event == "config.changed" || event == "config.mounted")
+  else if (strcmp(event, "config.changed") == 0 || strcmp(event, "config.mounted") == 0)
     {
     ConfigChanged((OvmsConfigParam*) data);
     }
-  else if (event == "location.alert.flatbed.moved" || event == "location.alert.valet.bounds")
+  else if (strcmp(event, "location.alert.flatbed.moved") == 0 || strcmp(event, "location.alert.valet.bounds") == 0)
     {
     m_now_gps = true;
     }
@@ -1964,7 +1965,7 @@ void OvmsServerV2::ConfigChanged(OvmsConfigParam* param)
   m_updatetime_idle = MyConfig.GetParamValueInt("server.v2", "updatetime.idle", 600);
   }
 
-void OvmsServerV2::NetUp(std::string event, void* data)
+void OvmsServerV2::NetUp(const char* event, void* data)
   {
   // workaround for wifi AP mode startup (manager up before interface)
   if ( (m_mgconn == NULL) && MyNetManager.MongooseRunning() )
@@ -1974,17 +1975,17 @@ void OvmsServerV2::NetUp(std::string event, void* data)
     }
   }
 
-void OvmsServerV2::NetDown(std::string event, void* data)
+void OvmsServerV2::NetDown(const char* event, void* data)
   {
   }
 
-void OvmsServerV2::NetReconfigured(std::string event, void* data)
+void OvmsServerV2::NetReconfigured(const char* event, void* data)
   {
   SetStatus("Network was reconfigured: disconnect and reconnect", false, ConnectWait);
   Reconnect(3);
   }
 
-void OvmsServerV2::NetmanInit(std::string event, void* data)
+void OvmsServerV2::NetmanInit(const char* event, void* data)
   {
   if ((m_mgconn == NULL)&&(MyNetManager.m_connected_any))
     {
@@ -1993,7 +1994,7 @@ void OvmsServerV2::NetmanInit(std::string event, void* data)
     }
   }
 
-void OvmsServerV2::NetmanStop(std::string event, void* data)
+void OvmsServerV2::NetmanStop(const char* event, void* data)
   {
   if (m_mgconn)
     {
@@ -2002,7 +2003,7 @@ void OvmsServerV2::NetmanStop(std::string event, void* data)
     }
   }
 
-void OvmsServerV2::Ticker1(std::string event, void* data)
+void OvmsServerV2::Ticker1(const char* event, void* data)
   {
   if (m_connretry > 0)
     {
@@ -2160,17 +2161,17 @@ OvmsServerV2::OvmsServerV2(const char* name)
     }
 
   // init event listener:
-  MyEvents.RegisterEvent(TAG,"network.up", std::bind(&OvmsServerV2::NetUp, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.down", std::bind(&OvmsServerV2::NetDown, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.reconfigured", std::bind(&OvmsServerV2::NetReconfigured, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.mgr.init", std::bind(&OvmsServerV2::NetmanInit, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.mgr.stop", std::bind(&OvmsServerV2::NetmanStop, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.1", std::bind(&OvmsServerV2::Ticker1, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"system.modem.received.ussd", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"config.changed", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"config.mounted", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"location.alert.flatbed.moved", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"location.alert.valet.bounds", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.up", std::bind(&OvmsServerV2::NetUp, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.down", std::bind(&OvmsServerV2::NetDown, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.reconfigured", std::bind(&OvmsServerV2::NetReconfigured, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.mgr.init", std::bind(&OvmsServerV2::NetmanInit, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.mgr.stop", std::bind(&OvmsServerV2::NetmanStop, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.1", std::bind(&OvmsServerV2::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"system.modem.received.ussd", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"config.changed", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"config.mounted", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"location.alert.flatbed.moved", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"location.alert.valet.bounds", std::bind(&OvmsServerV2::EventListener, this, _1, _2));
 
   // read config:
   ConfigChanged(NULL);
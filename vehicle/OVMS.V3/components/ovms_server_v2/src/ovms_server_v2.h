@@ -87,14 +87,14 @@ class OvmsServerV2 : public OvmsServer
     void MetricModified(OvmsMetric* metric);
     bool NotificationFilter(OvmsNotifyType* type, const char* subtype);
     bool IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* entry);
-    void EventListener(std::string event, void* data);
+    void EventListener(const char* event, void* data);
     void ConfigChanged(OvmsConfigParam* param);
-    void NetUp(std::string event, void* data);
-    void NetDown(std::string event, void* data);
-    void NetReconfigured(std::string event, void* data);
-    void NetmanInit(std::string event, void* data);
-    void NetmanStop(std::string event, void* data);
-    void Ticker1(std::string event, void* data);
+    void NetUp(const char* event, void* data);
+    void NetDown(const char* event, void* data);
+    void NetReconfigured(const char* event, void* data);
+    void NetmanInit(const char* event, void* data);
+    void NetmanStop(const char* event, void* data);
+    void Ticker1(const char* event, void* data);
     void RequestUpdate(bool txall);
 
   public:
@@ -230,16 +230,16 @@ OvmsServerV3::OvmsServerV3(const char* name)
     }
 
   // init event listener:
-  MyEvents.RegisterEvent(TAG,"network.up", std::bind(&OvmsServerV3::NetUp, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.down", std::bind(&OvmsServerV3::NetDown, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.reconfigured", std::bind(&OvmsServerV3::NetReconfigured, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.mgr.init", std::bind(&OvmsServerV3::NetmanInit, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"network.mgr.stop", std::bind(&OvmsServerV3::NetmanStop, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.1", std::bind(&OvmsServerV3::Ticker1, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.60", std::bind(&OvmsServerV3::Ticker60, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"system.modem.received.ussd", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"config.changed", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"config.mounted", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.up", std::bind(&OvmsServerV3::NetUp, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.down", std::bind(&OvmsServerV3::NetDown, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.reconfigured", std::bind(&OvmsServerV3::NetReconfigured, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.mgr.init", std::bind(&OvmsServerV3::NetmanInit, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"network.mgr.stop", std::bind(&OvmsServerV3::NetmanStop, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.1", std::bind(&OvmsServerV3::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.60", std::bind(&OvmsServerV3::Ticker60, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"system.modem.received.ussd", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"config.changed", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"config.mounted", std::bind(&OvmsServerV3::EventListener, this, _1, _2));
 
   // read config:
   ConfigChanged(NULL);
@@ -310,6 +310,7 @@ void OvmsServerV3::TransmitMetric(OvmsMetric* metric)
   mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
     MG_MQTT_QOS(0) | MG_MQTT_RETAIN, val.c_str(), val.length());
   ESP_LOGD(TAG,"Tx metric %s=%s",topic.c_str(),val.c_str());
+  MyNetManager.MongooseWakeup();
   }
 
 int OvmsServerV3::TransmitNotificationInfo(OvmsNotifyEntry* entry)
@@ -324,6 +325,7 @@ int OvmsServerV3::TransmitNotificationInfo(OvmsNotifyEntry* entry)
   mg_mqtt_publish(m_mgconn, topic.c_str(), id,
     MG_MQTT_QOS(1), result.c_str(), result.length());
   ESP_LOGI(TAG,"Tx notify %s=%s",topic.c_str(),result.c_str());
+  MyNetManager.MongooseWakeup();
   return id;
   }
 
@@ -339,6 +341,7 @@ int OvmsServerV3::TransmitNotificationError(OvmsNotifyEntry* entry)
   mg_mqtt_publish(m_mgconn, topic.c_str(), id,
     MG_MQTT_QOS(1), result.c_str(), result.length());
   ESP_LOGI(TAG,"Tx notify %s=%s",topic.c_str(),result.c_str());
+  MyNetManager.MongooseWakeup();
   return id;
   }
 
@@ -354,6 +357,7 @@ int OvmsServerV3::TransmitNotificationAlert(OvmsNotifyEntry* entry)
   mg_mqtt_publish(m_mgconn, topic.c_str(), id,
     MG_MQTT_QOS(1), result.c_str(), result.length());
   ESP_LOGI(TAG,"Tx notify %s=%s",topic.c_str(),result.c_str());
+  MyNetManager.MongooseWakeup();
   return id;
   }
 
@@ -381,6 +385,7 @@ int OvmsServerV3::TransmitNotificationData(OvmsNotifyEntry* entry)
   mg_mqtt_publish(m_mgconn, topic.c_str(), id,
     MG_MQTT_QOS(2), result, strlen(result));
   ESP_LOGI(TAG,"Tx notify %s=%s",topic.c_str(),result);
+  MyNetManager.MongooseWakeup();
   return id;
   }
 
@@ -522,7 +527,7 @@ void OvmsServerV3::IncomingPubRec(int id)
     }
   }
 
-void OvmsServerV3::IncomingEvent(std::string event, void* data)
+void OvmsServerV3::IncomingEvent(const char* event, void* data)
   {
   // Publish the event, if we are connected...
   if (m_mgconn == NULL) return;
@@ -533,7 +538,7 @@ void OvmsServerV3::IncomingEvent(std::string event, void* data)
   // Legacy: publish event name on fixed topic
   topic.append("event");
   mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
-    MG_MQTT_QOS(0), event.c_str(), event.length());
+    MG_MQTT_QOS(0), event, strlen(event));
 
   // Publish MQTT style event topic, payload reserved for event data serialization:
   topic.append("/");
@@ -541,7 +546,8 @@ void OvmsServerV3::IncomingEvent(std::string event, void* data)
   mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
     MG_MQTT_QOS(0), "", 0);
 
-  ESP_LOGD(TAG,"Tx event %s",event.c_str());
+  ESP_LOGD(TAG,"Tx event %s",event);
+  MyNetManager.MongooseWakeup();
   }
 
 void OvmsServerV3::RunCommand(std::string client, std::string id, std::string command)
@@ -562,6 +568,7 @@ void OvmsServerV3::RunCommand(std::string client, std::string id, std::string co
   topic.append(id);
   mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
     MG_MQTT_QOS(1), val.c_str(), val.length());
+  MyNetManager.MongooseWakeup();
   }
 
 void OvmsServerV3::AddClient(std::string id)
@@ -701,7 +708,7 @@ void OvmsServerV3::Connect()
     m_connretry = 20; // Try again in 20 seconds...
     return;
     }
-  return;
+  MyNetManager.MongooseWakeup();
   }
 
 void OvmsServerV3::Disconnect()
@@ -806,9 +813,9 @@ bool OvmsServerV3::IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* e
     return true; // Mark it read, as no interest to us
   }
 
-void OvmsServerV3::EventListener(std::string event, void* data)
+void OvmsServerV3::EventListener(const char* event, void* data)
   {
-  if (event == "config.changed" || event == "config.mounted")
+  if (strcmp(event, "config.changed") == 0 || strcmp(event, "config.mounted") == 0)
     {
     ConfigChanged((OvmsConfigParam*) data);
     }
@@ -831,7 +838,7 @@ void OvmsServerV3::ConfigChanged(OvmsConfigParam* param)
                                MyConfig.GetParamValue("server.v3", "metrics.exclude"));
   }
 
-void OvmsServerV3::NetUp(std::string event, void* data)
+void OvmsServerV3::NetUp(const char* event, void* data)
   {
   // workaround for wifi AP mode startup (manager up before interface)
   if ( (m_mgconn == NULL) && MyNetManager.MongooseRunning() )
@@ -841,7 +848,7 @@ void OvmsServerV3::NetUp(std::string event, void* data)
     }
   }
 
-void OvmsServerV3::NetDown(std::string event, void* data)
+void OvmsServerV3::NetDown(const char* event, void* data)
   {
   if (m_mgconn)
     {
@@ -850,14 +857,14 @@ void OvmsServerV3::NetDown(std::string event, void* data)
     }
   }
 
-void OvmsServerV3::NetReconfigured(std::string event, void* data)
+void OvmsServerV3::NetReconfigured(const char* event, void* data)
   {
   ESP_LOGI(TAG, "Network was reconfigured: disconnect, and reconnect in 10 seconds");
   Disconnect();
   m_connretry = 10;
   }
 
-void OvmsServerV3::NetmanInit(std::string event, void* data)
+void OvmsServerV3::NetmanInit(const char* event, void* data)
   {
   if ((m_mgconn == NULL)&&(MyNetManager.m_connected_any))
     {
@@ -866,7 +873,7 @@ void OvmsServerV3::NetmanInit(std::string event, void* data)
     }
   }
 
-void OvmsServerV3::NetmanStop(std::string event, void* data)
+void OvmsServerV3::NetmanStop(const char* event, void* data)
   {
   if (m_mgconn)
     {
@@ -875,7 +882,7 @@ void OvmsServerV3::NetmanStop(std::string event, void* data)
     }
   }
 
-void OvmsServerV3::Ticker1(std::string event, void* data)
+void OvmsServerV3::Ticker1(const char* event, void* data)
   {
   if (m_connretry > 0)
     {
@@ -961,7 +968,7 @@ void OvmsServerV3::RequestUpdate(bool txall)
     }
   }
 
-void OvmsServerV3::Ticker60(std::string event, void* data)
+void OvmsServerV3::Ticker60(const char* event, void* data)
   {
   CountClients();
   }
@@ -1080,7 +1087,7 @@ OvmsServerV3Init::OvmsServerV3Init()
 
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG, "*", std::bind(&OvmsServerV3Init::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "*", std::bind(&OvmsServerV3Init::EventListener, this, _1, _2));
 
   MyConfig.RegisterParam("server.v3", "V3 Server Configuration", true, true);
   // Our instances:
@@ -1098,11 +1105,11 @@ void OvmsServerV3Init::AutoInit()
     MyOvmsServerV3 = new OvmsServerV3("oscv3");
   }
 
-void OvmsServerV3Init::EventListener(std::string event, void* data)
+void OvmsServerV3Init::EventListener(const char* event, void* data)
   {
-  if (event.compare(0,7,"ticker.") == 0) return; // Skip ticker.* events
-  if (event.compare("system.event") == 0) return; // Skip event
-  if (event.compare("system.wifi.scan.done") == 0) return; // Skip event
+  if (strncmp(event, "ticker.", 7) == 0) return; // Skip ticker.* events
+  if (strcmp(event, "system.event") == 0) return; // Skip event
+  if (strcmp(event, "system.wifi.scan.done") == 0) return; // Skip event
 
   if (MyOvmsServerV3)
     {
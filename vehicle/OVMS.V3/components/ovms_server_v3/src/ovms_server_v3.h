@@ -55,15 +55,15 @@ class OvmsServerV3 : public OvmsServer
     void MetricModified(OvmsMetric* metric);
     bool NotificationFilter(OvmsNotifyType* type, const char* subtype);
     bool IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* entry);
-    void EventListener(std::string event, void* data);
+    void EventListener(const char* event, void* data);
     void ConfigChanged(OvmsConfigParam* param);
-    void NetUp(std::string event, void* data);
-    void NetDown(std::string event, void* data);
-    void NetReconfigured(std::string event, void* data);
-    void NetmanInit(std::string event, void* data);
-    void NetmanStop(std::string event, void* data);
-    void Ticker1(std::string event, void* data);
-    void Ticker60(std::string event, void* data);
+    void NetUp(const char* event, void* data);
+    void NetDown(const char* event, void* data);
+    void NetReconfigured(const char* event, void* data);
+    void NetmanInit(const char* event, void* data);
+    void NetmanStop(const char* event, void* data);
+    void Ticker1(const char* event, void* data);
+    void Ticker60(const char* event, void* data);
     void RequestUpdate(bool txall);
 
   public:
@@ -133,7 +133,7 @@ class OvmsServerV3 : public OvmsServer
     void TransmitPendingNotificationsData();
     void IncomingMsg(std::string topic, std::string payload);
     void IncomingPubRec(int id);
-    void IncomingEvent(std::string event, void* data);
+    void IncomingEvent(const char* event, void* data);
     void RunCommand(std::string client, std::string id, std::string command);
     void AddClient(std::string id);
     void RemoveClient(std::string id);
@@ -152,7 +152,7 @@ class OvmsServerV3Init
     void AutoInit();
 
   public:
-    void EventListener(std::string event, void* data);
+    void EventListener(const char* event, void* data);
   };
 
 extern OvmsServerV3Init MyOvmsServerV3Init;
@@ -127,6 +127,8 @@ void HttpCommandStream::CommandTask(void* object)
     me->RequestPoll();
     ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPollDone, qlen=%d done=%d sent=%d ack=%d", me->m_nc, uxQueueMessagesWaiting(me->m_writequeue), me->m_done, me->m_sent, me->m_ack);
   }
+#else
+  me->RequestPoll();
 #endif // MG_ENABLE_BROADCAST && WEBSRV_USE_MG_BROADCAST
 
   while (me->m_nc)
@@ -260,6 +262,9 @@ ssize_t HttpCommandStream::write(const void *buf, size_t nbyte)
     ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPollDone, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
   }
   else
+#else
+  if (uxQueueMessagesWaiting(m_writequeue) == 1)
+    RequestPoll();
 #endif // MG_ENABLE_BROADCAST && WEBSRV_USE_MG_BROADCAST
     ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] AddQueue, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
 
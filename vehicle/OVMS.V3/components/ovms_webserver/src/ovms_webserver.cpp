@@ -101,6 +101,7 @@ OvmsWebServer::OvmsWebServer()
   // register standard API calls:
   RegisterPage("/api/execute", "Execute command", HandleCommand, PageMenu_None, PageAuth_Cookie);
   RegisterPage("/api/file", "Load/Save file", HandleFile, PageMenu_None, PageAuth_Cookie);
+  RegisterPage("/api/history", "Metrics history", HandleHistory, PageMenu_None, PageAuth_Cookie);
 
   // register standard public pages:
   RegisterPage("/dashboard", "Dashboard", HandleDashboard, PageMenu_Main, PageAuth_None);
@@ -711,6 +712,8 @@ PageResult_t PageContext::callback(PageEntry_t& p, const std::string& hook)
  * MgHandler.RequestPoll: init transmission from other context.
  *
  * mg_broadcast() signals the mg_mgr_poll() task to send an MG_EV_POLL to all connections.
+ * Without broadcast support, the network task is woken up to do the next poll cycle
+ * (sending MG_EV_POLL to all connections) now.
  */
 void MgHandler::RequestPoll()
 {
@@ -725,6 +728,8 @@ void MgHandler::RequestPoll()
     MgHandler* origin = this;
     mg_broadcast(MyNetManager.GetMongooseMgr(), HandlePoll, &origin, sizeof(origin));
   }
+#else
+  MyNetManager.MongooseWakeup();
 #endif // MG_ENABLE_BROADCAST && WEBSRV_USE_MG_BROADCAST
 }
 
@@ -551,6 +551,7 @@ class OvmsWebServer : public ExternalRamAllocated
     static void HandleStatus(PageEntry_t& p, PageContext_t& c);
     static void HandleCommand(PageEntry_t& p, PageContext_t& c);
     static void HandleFile(PageEntry_t& p, PageContext_t& c);
+    static void HandleHistory(PageEntry_t& p, PageContext_t& c);
     static void HandleShell(PageEntry_t& p, PageContext_t& c);
     static void HandleDashboard(PageEntry_t& p, PageContext_t& c);
     static void HandleBmsCellMonitor(PageEntry_t& p, PageContext_t& c);
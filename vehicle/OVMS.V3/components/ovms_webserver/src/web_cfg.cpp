@@ -37,9 +37,11 @@ static const char *TAG = "webserver";
 #include <sstream>
 #include <fstream>
 #include <dirent.h>
+#include <math.h>
 #include "ovms_webserver.h"
 #include "ovms_config.h"
 #include "ovms_metrics.h"
+#include "ovms_metrics_history.h"
 #include "metrics_standard.h"
 #include "vehicle.h"
 #include "ovms_housekeeping.h"
@@ -4368,3 +4370,81 @@ void OvmsWebServer::HandleFile(PageEntry_t& p, PageContext_t& c)
 
   c.done();
 }
+
+
+/**
+ * HandleHistory: metrics history query API
+ *
+ *  URL: /api/history
+ *
+ *  @param metric
+ *    Metric name or comma separated list of metric names
+ *  @param from, to
+ *    UTC time range [seconds], 0 / negative = seconds before now; default: all until now
+ *  @param step
+ *    Average samples over step seconds, default 0 = raw samples
+ *
+ *  @return
+ *    Status: 200 (OK) / 400 (Error)
+ *    Body: JSON object, metric name → array of [time, value] pairs, null if not recorded
+ */
+void OvmsWebServer::HandleHistory(PageEntry_t& p, PageContext_t& c)
+{
+  std::string metrics = c.getvar("metric", 1000);
+  std::string from = c.getvar("from"), to = c.getvar("to"), step = c.getvar("step");
+
+  if (metrics.empty()) {
+    c.head(400,
+      "Content-Type: text/plain; charset=utf-8\r\n"
+      "Cache-Control: no-cache");
+    c.print("ERROR: Missing metric\n");
+    c.done();
+    return;
+  }
+
+  uint32_t tfrom = from.empty() ? 0 : OvmsMetricsHistory::ResolveTime(atol(from.c_str()));
+  uint32_t tto = to.empty() ? time(NULL) : OvmsMetricsHistory::ResolveTime(atol(to.c_str()));
+  uint32_t tstep = atol(step.c_str());
+
+  c.head(200,
+    "Content-Type: application/json; charset=utf-8\r\n"
+    "Cache-Control: no-cache");
+
+  extram::string out = "{";
+  std::istringstream list(metrics);
+  std::string name;
+  MetricsHistorySamples samples;
+  char buf[40];
+  while (std::getline(list, name, ',')) {
+    trim(name);
+    if (name.empty())
+      continue;
+    if (out.size() > 1)
+      out += ",";
+    out += "\"";
+    out += json_encode(name).c_str();
+    out += "\":";
+
+    samples.clear();
+    if (MyMetricsHistory.Query(name.c_str(), tfrom, tto, tstep, samples) < 0) {
+      out += "null";
+      continue;
+    }
+    out += "[";
+    for (size_t i = 0; i < samples.size(); i++) {
+      if (isfinite(samples[i].value))
+        snprintf(buf, sizeof(buf), "%s[%" PRIu32 ",%.7g]", i ? "," : "", samples[i].time, samples[i].value);
+      else
+        snprintf(buf, sizeof(buf), "%s[%" PRIu32 ",null]", i ? "," : "", samples[i].time);
+      out += buf;
+      if (out.size() > 2048) {
+        c.print(out);
+        out.clear();
+      }
+    }
+    out += "]";
+  }
+  out += "}";
+  c.print(out);
+  c.done();
+}
@@ -34,6 +34,7 @@ static const char *TAG = "vehicle-poll";
 #include <stdio.h>
 #include <algorithm>
 #include <ovms_command.h>
+#include <ovms_config.h>
 #include <ovms_script.h>
 #include <ovms_metrics.h>
 #include <ovms_notify.h>
@@ -44,6 +45,7 @@ static const char *TAG = "vehicle-poll";
 #include <ovms_peripherals.h>
 #include <string_writer.h>
 #include "vehicle_poller.h"
+#include "vehicle_poller_sim.h"
 #include "can.h"
 #include "ovms_boot.h"
 
@@ -82,44 +84,64 @@ OvmsPoller::OvmsPoller(canbus* can, uint8_t can_number, OvmsPollers *parent,
   m_poll_fc_septime = 25;       // response default timing: 25 milliseconds
   m_poll_ch_keepalive = 60;     // channel keepalive default: 60 seconds
   m_poll_repeat_count = 0;
+  m_poll_run_finished = true;
+  m_poll_ticked = false;
   m_poll_sent_last = 0;
   m_poll_between_success = 0;
+
+  m_poll_pipeline = 1;
+  m_poll_slot_seq = 0;
+  m_poll_scheduled = false;
+  m_responder_cnt = 0;
+  m_response_cnt = 0;
+  m_collect_end = 0;
+  for (auto &slot : m_slots)
+    {
+    slot.state = SlotFree;
+    slot.seq = 0;
+    slot.serial = false;
+    slot.collect = false;
+    slot.job = m_poll;
+    slot.tx_data = NULL;
+    slot.tx_remain = 0;
+    slot.tx_offset = 0;
+    slot.tx_frame = 0;
+    slot.txmsgid = 0;
+    slot.wait = false;
+    slot.deadline = 0;
+    slot.sent_us = 0;
+    }
   }
 
 void OvmsPoller::Incoming(CAN_frame_t &frame, bool success)
   {
 
-  // No multiframe request is active.
-  if (m_poll.type == VEHICLE_POLL_TYPE_NONE)
-    return;
-
   // Pass frame to poller protocol handlers:
   if (frame.origin == m_poll_vwtp.bus && frame.MsgID == m_poll_vwtp.rxid)
     {
+    // Channel management frames also arrive without a request:
     PollerVWTPReceive(&frame, frame.MsgID);
     }
   else if (frame.origin == m_poll.bus)
     {
-    if (m_poll.entry.txmoduleid == 0)
+    // Demultiplex ISO-TP responses by RX ID:
+    for (auto &slot : m_slots)
       {
-      IFTRACE(TXRX) ESP_LOGV(TAG, "[%" PRIu8 "]Poller: Incoming - dropped (no poll entry)", m_poll.bus_no);
-      return;
-      }
-    if (!m_poll_wait)
-      {
-      IFTRACE(TXRX) ESP_LOGV(TAG, "[%" PRIu8 "]Poller: Incoming - timed out", m_poll.bus_no);
-      return;
-      }
-    uint32_t msgid;
-    if (m_poll.protocol == ISOTP_EXTADR)
-      msgid = frame.MsgID << 8 | frame.data.u8[0];
-    else
-      msgid = frame.MsgID;
-    IFTRACE(TXRX) ESP_LOGV(TAG, "[%" PRIu8 "]Poller: FrameRx(bus=%s, msg=%" PRIx32 " )", m_poll.bus_no, frame.origin == m_poll.bus ? "Self" : "Other", msgid );
-    if (msgid >= m_poll.moduleid_low && msgid <= m_poll.moduleid_high)
-      {
-      PollerISOTPReceive(&frame, msgid);
+      if (slot.state != SlotActive)
+        continue;
+      uint32_t msgid;
+      if (slot.job.protocol == ISOTP_EXTADR)
+        msgid = frame.MsgID << 8 | frame.data.u8[0];
+      else
+        msgid = frame.MsgID;
+      if (msgid >= slot.job.moduleid_low && msgid <= slot.job.moduleid_high)
+        {
+        IFTRACE(TXRX) ESP_LOGV(TAG, "[%" PRIu8 "]Poller: FrameRx(msg=%" PRIx32 ", slot=%d)", m_poll.bus_no, msgid, int(&slot - m_slots));
+        PollerISOTPReceive(slot, &frame, msgid);
+        return;
+        }
       }
+    IFTRACE(TXRX) ESP_LOGV(TAG, "[%" PRIu8 "]Poller: Incoming - dropped (no request for msg=%" PRIx32 ")", m_poll.bus_no, frame.MsgID);
     }
   }
 
@@ -151,6 +173,36 @@ bool OvmsPoller::Ready()
   return m_parent->Ready();
   }
 
+/**
+ * poller_acceptance: add the response CAN IDs of a poll entry to an acceptance list
+ */
+static void poller_acceptance(const OvmsPoller::poll_pid_t &entry, CAN_acceptance_list_t &list)
+  {
+  uint8_t protocol = entry.protocol & ~ISOTP_COLLECT;
+  if (protocol == VWTP_20)
+    {
+    // channel IDs are negotiated at setup, accept the usual range above the base ID:
+    list.push_back({ entry.txmoduleid, entry.txmoduleid + 0x1ff, false });
+    }
+  else if (entry.rxmoduleid != 0)
+    {
+    if (protocol == ISOTP_EXTADR)
+      list.push_back({ entry.rxmoduleid >> 8, entry.rxmoduleid >> 8, false });
+    else
+      list.push_back({ entry.rxmoduleid, entry.rxmoduleid, protocol == ISOTP_EXTFRAME });
+    }
+  else if (protocol == ISOTP_EXTFRAME)
+    {
+    uint32_t sent = (entry.txmoduleid > 0x7ff) ? entry.txmoduleid : 0x18db33f1;
+    uint32_t low = 0x18da0000 | ((sent & 0xff) << 8);
+    list.push_back({ low, low | 0xff, true });
+    }
+  else
+    {
+    list.push_back({ 0x7e8, 0x7ef, false });
+    }
+  }
+
 /**
  * PollSetPidList: set the default bus and the polling list to process
  *  Call this to install a new polling list or restart the list.
@@ -175,6 +227,19 @@ void OvmsPoller::PollSetPidList(uint8_t defaultbus, const OvmsPoller::poll_pid_t
 
   m_poll_series->PollSetPidList(defaultbus, plist);
 
+  // Register the response IDs for hardware acceptance filtering:
+  if (m_poll.bus)
+    {
+    CAN_acceptance_list_t acceptance;
+    for (const poll_pid_t *entry = plist; entry && entry->txmoduleid != 0; ++entry)
+      {
+      uint8_t busno = entry->pollbus ? entry->pollbus : defaultbus;
+      if (busno == m_poll.bus_no)
+        poller_acceptance(*entry, acceptance);
+      }
+    m_poll.bus->SetAcceptance("poller", acceptance);
+    }
+
   m_poll_run_finished = true;
   m_poll.ticker = init_ticker;
   m_poll_sequence_cnt = 0;
@@ -252,6 +317,27 @@ void OvmsPoller::PollSetTimeBetweenSuccess(uint16_t time_between_ms)
   m_poll_between_success = time_between_ms / portTICK_PERIOD_MS;
   }
 
+/**
+ * PollSetPipelining: configure number of concurrent ISO-TP requests
+ *
+ *  With a value > 1, the poller sends requests to different ECUs without waiting
+ *  for the response of the previous request, i.e. it keeps up to this many requests
+ *  in flight. Requests to the same ECU (TX/RX ID pair) are still serialized, VWTP
+ *  and broadcast requests are exclusive. Responses are demultiplexed by their RX ID.
+ *  To skip over further entries for a busy ECU, the poller fetches up to
+ *  VEHICLE_POLL_MAXSLOTS entries ahead.
+ *
+ *  ATT: with pipelining, responses from different ECUs may arrive interleaved, so
+ *  IncomingPollReply() must assemble multi frame responses per job.moduleid_rec.
+ *
+ *  @param max_inflight
+ *    Max concurrent requests, 1 = no pipelining (default), max VEHICLE_POLL_MAXSLOTS
+ */
+void OvmsPoller::PollSetPipelining(uint8_t max_inflight)
+  {
+  m_poll_pipeline = LIMIT_MIN(LIMIT_MAX(max_inflight, VEHICLE_POLL_MAXSLOTS), 1);
+  }
+
 void OvmsPoller::ResetThrottle()
   {
   // Main Timer reset throttling counter,
@@ -267,6 +353,7 @@ void OvmsPoller::ResetPollEntry(bool force)
     m_polls.RestartPoll(OvmsPoller::ResetMode::PollReset);
     m_poll.entry = {};
     m_poll_txmsgid = 0;
+    PollerResetSlots();
     }
   }
 
@@ -332,6 +419,8 @@ void OvmsPoller::PollerSend(poller_source_t source)
     OvmsRecMutexLock lock(&m_poll_mutex);
     curIsBlocking = m_polls.PollIsBlocking();
   }
+  // Any send also serves due sub-second entries:
+  m_poll_scheduled = false;
   bool fromPrimaryTicker = false, fromPrimaryOrOnceOffTicker = false;
   switch (source)
     {
@@ -367,6 +456,7 @@ void OvmsPoller::PollerSend(poller_source_t source)
     // Protocol specific ticker calls:
     PollerVWTPTicker();
     }
+  PollerSlotTimeouts();
 
   if (m_poll_wait > 0)
     {
@@ -374,6 +464,14 @@ void OvmsPoller::PollerSend(poller_source_t source)
     return;
     }
 
+  // Start queued requests to ECUs that have become idle:
+  PollerStartQueued(fromPrimaryOrOnceOffTicker);
+  if (!PollerCanFetch())
+    {
+    IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Waiting for slot", m_poll.bus_no);
+    return;
+    }
+
   if (!curIsBlocking && m_poll_ticked)
     {
     if (!m_poll_run_finished && m_poll_repeat_count > 0)
@@ -381,6 +479,12 @@ void OvmsPoller::PollerSend(poller_source_t source)
       IFTRACE(Poller) ESP_LOGD(TAG, "Poller finished primary run");
       m_poll_run_finished = true;
       }
+    // Let pipelined requests of this run complete before finishing it:
+    if (m_poll_run_finished && (PollerCountSlots(SlotActive) + PollerCountSlots(SlotQueued)) > 0)
+      {
+      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Run finished, waiting for responses", m_poll.bus_no);
+      return;
+      }
     m_poll_ticked = false;
 
     // Force a reset
@@ -406,92 +510,487 @@ void OvmsPoller::PollerSend(poller_source_t source)
     return;
     }
 
-  if (! CanPoll())
+  // Fetch entries while slots are available (pipelining), at least one:
+  bool more;
+  do
     {
-    IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Throttled", m_poll.bus_no);
-    return;
-    }
+    if (! CanPoll())
+      {
+      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Throttled", m_poll.bus_no);
+      return;
+      }
 
-  OvmsPoller::OvmsNextPollResult res;
-  {
-    OvmsRecMutexLock lock(&m_poll_mutex);
-    res = m_polls.NextPollEntry(m_poll.entry, m_poll.bus_no, m_poll.ticker, m_poll_state);
-  }
-  if (res == OvmsNextPollResult::ReachedEnd && m_polls.HasRepeat())
+    OvmsPoller::OvmsNextPollResult res;
     {
-    ++m_poll_repeat_count;
-    if (m_poll_repeat_count > max_poll_repeat)
+      OvmsRecMutexLock lock(&m_poll_mutex);
+      res = m_polls.NextPollEntry(m_poll.entry, m_poll.bus_no, m_poll.ticker, m_poll_state);
+    }
+    if (res == OvmsNextPollResult::ReachedEnd && m_polls.HasRepeat())
       {
-      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Retry Exceeded - Finishing", m_poll.bus_no);
-      m_poll_run_finished = true;
-      res = OvmsNextPollResult::StillAtEnd;
+      ++m_poll_repeat_count;
+      if (m_poll_repeat_count > max_poll_repeat)
+        {
+        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Retry Exceeded - Finishing", m_poll.bus_no);
+        m_poll_run_finished = true;
+        res = OvmsNextPollResult::StillAtEnd;
+        }
+      else
+        {
+        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Reset for Repeat (%s)", m_poll.bus_no, OvmsPoller::PollerSource(source));
+        m_polls.RestartPoll(OvmsPoller::ResetMode::LoopReset);
+        // If this poll is from a ISOTP success, don't overwhelm the ECU,
+        // wait until a Secondary tick.
+        if (source == poller_source_t::Successful)
+          {
+          IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Restart: Wait for secondary", m_poll.bus_no);
+          return;
+          }
+        res = m_polls.NextPollEntry(m_poll.entry, m_poll.bus_no, m_poll.ticker, m_poll_state);
+        }
       }
-    else
+    switch (res)
       {
-      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Reset for Repeat (%s)", m_poll.bus_no, OvmsPoller::PollerSource(source));
-      m_polls.RestartPoll(OvmsPoller::ResetMode::LoopReset);
-      // If this poll is from a ISOTP success, don't overwhelm the ECU,
-      // wait until a Secondary tick.
-      if (source == poller_source_t::Successful)
+      case OvmsNextPollResult::Ignore:
+        IFTRACE(Poller) ESP_LOGD(TAG, "[%" PRIu8 "]PollerSend: Ignore", m_poll.bus_no);
+        break;
+      case OvmsNextPollResult::NotReady:
         {
-        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]Poller Restart: Wait for secondary", m_poll.bus_no);
-        return;
+        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Poller Not Ready", m_poll.bus_no);
+        m_poll_run_finished = true;
+        break;
         }
-      res = m_polls.NextPollEntry(m_poll.entry, m_poll.bus_no, m_poll.ticker, m_poll_state);
+      case OvmsNextPollResult::ReachedEnd:
+        {
+        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Poller Reached End", m_poll.bus_no);
+        m_poll_run_finished = true;
+        break;
+        }
+      case OvmsNextPollResult::StillAtEnd:
+        if (!m_poll_run_finished)
+          {
+          IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "Poller Reached End(!)", m_poll.bus_no);
+          m_poll_run_finished = true;
+          }
+        break;
+      case OvmsNextPollResult::FoundEntry:
+        {
+        ESP_LOGD(TAG, "[%" PRIu8 "]PollerSend(%s)[%" PRIu8 "]: entry at[type=%02X, pid=%X], ticker=%" PRIu32 ", wait=%u, cnt=%u/%u",
+               m_poll.bus_no, PollerSource(source), m_poll_state, m_poll.entry.type, m_poll.entry.pid,
+               m_poll.ticker, m_poll_wait, m_poll_sequence_cnt, m_poll_sequence_max);
+        // We need to poll this one...
+        m_poll_sent_last = monotonictime;
+        m_poll_sequence_cnt++;
+        PollerQueueSlot(source);
+        // Dispatch transmission start to protocol handler:
+        PollerStartQueued(fromPrimaryOrOnceOffTicker);
+        break;
+        }
+      }
+    more = (res == OvmsNextPollResult::FoundEntry) && PollerCanFetch();
+    } while (more);
+  }
+
+/**
+ * PollerQueueSlot: internal: take over the current entry (m_poll.entry) into a free slot
+ */
+OvmsPoller::poll_slot_t* OvmsPoller::PollerQueueSlot(poller_source_t source)
+  {
+  int limit = (m_poll_pipeline > 1) ? VEHICLE_POLL_MAXSLOTS : 1;
+  for (int i = 0; i < limit; i++)
+    {
+    poll_slot_t &slot = m_slots[i];
+    if (slot.state != SlotFree)
+      continue;
+    slot.state = SlotQueued;
+    slot.seq = ++m_poll_slot_seq;
+    slot.job = m_poll;
+    slot.job.protocol = m_poll.entry.protocol & ~ISOTP_COLLECT;
+    slot.collect = (m_poll.entry.protocol & ISOTP_COLLECT) && m_poll.entry.rxmoduleid == 0;
+    slot.job.type = m_poll.entry.type;
+    slot.job.pid = m_poll.entry.pid;
+      {
+      OvmsRecMutexLock lock(&m_poll_mutex);
+      slot.series = m_polls.CurrentSeries();
+      slot.serial = m_polls.PollIsBlocking() || !slot.series || !slot.series->CanPipeline();
       }
+    slot.wait = false;
+    slot.sent_us = 0;
+    slot.batch_cnt = 0;
+    if (!slot.serial && !slot.collect && PollEntryCanBatch(slot.job.entry))
+      PollerISOTPBatch(slot);
+    return &slot;
     }
-  switch (res)
+  // Should not happen, PollerSend() checks for a free slot before fetching:
+  ESP_LOGW(TAG, "[%" PRIu8 "]PollerQueueSlot(%s): no free slot, dropping entry [type=%02X, pid=%X]",
+    m_poll.bus_no, PollerSource(source), m_poll.entry.type, m_poll.entry.pid);
+  return NULL;
+  }
+
+/**
+ * PollerStartQueued: internal: start queued requests in fetch order as far as possible
+ *  Requests to an ECU are serialized, exclusive requests (VWTP / broadcast) wait
+ *  for all other requests to finish and block all requests queued after them.
+ *  Up to m_poll_pipeline requests are active at a time.
+ */
+void OvmsPoller::PollerStartQueued(bool fromTicker)
+  {
+  uint32_t after = 0;
+  while (m_poll_wait == 0)
     {
-    case OvmsNextPollResult::Ignore:
-      IFTRACE(Poller) ESP_LOGD(TAG, "[%" PRIu8 "]PollerSend: Ignore", m_poll.bus_no);
-      break;
-    case OvmsNextPollResult::NotReady:
+    // Find next queued slot in fetch order:
+    poll_slot_t* next = NULL;
+    for (auto &slot : m_slots)
       {
-      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Poller Not Ready", m_poll.bus_no);
-      m_poll_run_finished = true;
+      if (slot.state == SlotQueued && slot.seq > after && (!next || slot.seq < next->seq))
+        next = &slot;
+      }
+    if (!next)
       break;
+    after = next->seq;
+
+    // Check ECU & exclusive state of active slots:
+    int active = 0;
+    bool ecu_busy = false, exclusive_busy = false;
+    for (auto &slot : m_slots)
+      {
+      if (slot.state != SlotActive)
+        continue;
+      active++;
+      if (PollEntryIsExclusive(slot.job.entry))
+        exclusive_busy = true;
+      if (slot.job.entry.txmoduleid == next->job.entry.txmoduleid &&
+          slot.job.entry.rxmoduleid == next->job.entry.rxmoduleid)
+        ecu_busy = true;
       }
-    case OvmsNextPollResult::ReachedEnd:
+
+    if (PollEntryIsExclusive(next->job.entry))
       {
-      IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "]PollerSend: Poller Reached End", m_poll.bus_no);
-      m_poll_run_finished = true;
+      if (active == 0)
+        PollerStartSlot(*next, fromTicker);
       break;
       }
-    case OvmsNextPollResult::StillAtEnd:
-      if (!m_poll_run_finished)
+    if (exclusive_busy || active >= m_poll_pipeline)
+      break;
+    if (!ecu_busy)
+      PollerStartSlot(*next, fromTicker);
+    }
+  }
+
+/**
+ * PollerStartSlot: internal: dispatch transmission start to protocol handler
+ */
+void OvmsPoller::PollerStartSlot(poll_slot_t &slot, bool fromTicker)
+  {
+  if (slot.job.protocol == VWTP_20)
+    {
+    // VWTP uses the channel state & single job:
+    m_poll.entry = slot.job.entry;
+    m_poll.protocol = slot.job.protocol;
+    m_poll.type = slot.job.type;
+    m_poll.pid = slot.job.pid;
+    slot.state = SlotFree;
+    slot.series = nullptr;
+    PollerVWTPStart(fromTicker);
+    }
+  else
+    {
+    slot.state = SlotActive;
+    PollerISOTPStart(slot, fromTicker);
+    }
+  }
+
+/**
+ * PollerTimeMs: internal: millisecond timebase for response deadlines (wraps after 49 days)
+ */
+uint32_t OvmsPoller::PollerTimeMs()
+  {
+  return esp_timer_get_time() / 1000;
+  }
+
+/**
+ * PollerSlotTimeout: internal: get response timeout for a request in ms
+ *  Derived from the response time statistics of the ECU addressed.
+ */
+uint32_t OvmsPoller::PollerSlotTimeout(const poll_slot_t &slot)
+  {
+  if (PollJobIsBroadcast(slot.job) || slot.job.moduleid_low == 0)
+    return m_parent->ResponseTimeoutDefault();
+  return m_parent->ResponseTimeout(m_poll.bus_no, slot.job.moduleid_low);
+  }
+
+/**
+ * PollerSlotWait: internal: (re)arm response timeout for a slot
+ */
+void OvmsPoller::PollerSlotWait(poll_slot_t &slot, uint32_t timeout_ms)
+  {
+  slot.wait = true;
+  slot.deadline = PollerTimeMs() + timeout_ms;
+  }
+
+/**
+ * PollerSlotTimeouts: internal: check slot response timeouts, free finished slots
+ *  Returns the number of requests timed out.
+ */
+int OvmsPoller::PollerSlotTimeouts()
+  {
+  uint32_t now = PollerTimeMs();
+  int cnt = 0;
+  for (auto &slot : m_slots)
+    {
+    if (slot.state != SlotActive)
+      continue;
+    if (slot.wait && (int32_t)(now - slot.deadline) >= 0)
+      {
+      if (slot.collect)
         {
-        IFTRACE(Poller) ESP_LOGV(TAG, "[%" PRIu8 "Poller Reached End(!)", m_poll.bus_no);
-        m_poll_run_finished = true;
+        IFTRACE(Poller) ESP_LOGD(TAG, "[%" PRIu8 "]PollerSlotTimeouts: collected %u responses [type=%02X, pid=%X] from %u ECUs",
+          m_poll.bus_no, m_response_cnt, slot.job.type, slot.job.pid, m_responder_cnt);
         }
-      break;
-    case OvmsNextPollResult::FoundEntry:
-      {
-      ESP_LOGD(TAG, "[%" PRIu8 "]PollerSend(%s)[%" PRIu8 "]: entry at[type=%02X, pid=%X], ticker=%" PRIu32 ", wait=%u, cnt=%u/%u",
-             m_poll.bus_no, PollerSource(source), m_poll_state, m_poll.entry.type, m_poll.entry.pid,
-             m_poll.ticker, m_poll_wait, m_poll_sequence_cnt, m_poll_sequence_max);
-      // We need to poll this one...
-      m_poll.protocol = m_poll.entry.protocol;
-      m_poll.type = m_poll.entry.type;
-      m_poll.pid = m_poll.entry.pid;
-
-      m_poll_sent_last = monotonictime;
-      // Dispatch transmission start to protocol handler:
-      if (m_poll.protocol == VWTP_20)
-        PollerVWTPStart(fromPrimaryOrOnceOffTicker);
       else
-        PollerISOTPStart(fromPrimaryOrOnceOffTicker);
+        {
+        IFTRACE(Poller) ESP_LOGD(TAG, "[%" PRIu8 "]PollerSlotTimeouts: timeout [type=%02X, pid=%X] to %03" PRIx32,
+          m_poll.bus_no, slot.job.type, slot.job.pid, slot.job.moduleid_sent);
+        }
+      if (!PollJobIsBroadcast(slot.job))
+        m_parent->AddResponseTimeout(m_poll.bus_no, slot.job.moduleid_sent, slot.job.moduleid_low);
+      if (slot.batch_cnt)
+        {
+        m_parent->PollBatchFailed(slot.job.entry.txmoduleid, 0, slot.batch_entry, slot.batch_cnt);
+        // Report the timeout per DID, as for the errors of a multi DID request:
+        slot.job.mlframe = slot.job.mloffset = slot.job.mlremain = 0;
+        for (int i = 0; i < slot.batch_cnt; i++)
+          {
+          slot.job.entry = slot.batch_entry[i];
+          slot.job.pid = slot.job.entry.pid;
+          PollerSlotError(slot, (uint16_t)POLLSINGLE_TIMEOUT);
+          }
+        }
+      slot.wait = false;
+      cnt++;
+      }
+    // Free finished (broadcast) & timed out requests:
+    if (!slot.wait)
+      {
+      slot.state = SlotFree;
+      slot.series = nullptr;
+      }
+    }
+  return cnt;
+  }
 
-      m_poll_sequence_cnt++;
-      break;
+/**
+ * PollerNextDeadline: internal: get the next response deadline of active requests
+ */
+bool OvmsPoller::PollerNextDeadline(uint32_t &deadline)
+  {
+  bool found = false;
+  uint32_t now = PollerTimeMs();
+  for (auto &slot : m_slots)
+    {
+    if (slot.state != SlotActive || !slot.wait)
+      continue;
+    if (!found || (int32_t)(slot.deadline - now) < (int32_t)(deadline - now))
+      deadline = slot.deadline;
+    found = true;
+    }
+  return found;
+  }
+
+/**
+ * PollerNextDue: internal: get the next deadline of sub-second poll entries
+ *  Only reported while the poller is able to send the entry.
+ */
+bool OvmsPoller::PollerNextDue(uint32_t &due)
+  {
+  if (m_poll_wait > 0 || m_poll.ticker == init_ticker || !CanPoll() || !PollerCanFetch())
+    return false;
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  return m_polls.NextDueTime(due);
+  }
+
+/**
+ * PollerSlotDone: internal: request finished, free slot & check to send the next poll
+ */
+void OvmsPoller::PollerSlotDone(poll_slot_t &slot)
+  {
+  slot.wait = false;
+  slot.state = SlotFree;
+  slot.series = nullptr;
+  if (m_poll_wait == 0 && PollerCountSlots(SlotQueued) > 0)
+    Queue_PollerSendSuccess();
+  else
+    PollerSucceededPollNext();
+  }
+
+void OvmsPoller::PollerSlotPacket(poll_slot_t &slot, uint8_t* data, uint8_t length)
+  {
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  if (slot.collect && slot.job.mlremain == 0)
+    m_response_cnt++;
+  if (!slot.series)
+    return;
+  if (!slot.series->Reassembly())
+    {
+    slot.series->IncomingPacket(slot.job, data, length);
+    return;
+    }
+
+  // Reassemble the response, per responder when collecting:
+  OvmsPollReply* reply = &slot.reply;
+  if (slot.collect)
+    {
+    reply = NULL;
+    for (int i = 0; i < m_responder_cnt; i++)
+      {
+      if (m_responders[i].msgid == slot.job.moduleid_rec)
+        {
+        reply = &m_responders[i].reply;
+        break;
+        }
       }
+    if (!reply)
+      return;
+    }
+  if (PollerAssemble(*reply, slot.job, data, length))
+    {
+    slot.series->IncomingReply(slot.job, *reply);
+    reply->Release();
+    }
+  }
+
+/**
+ * PollerAssemble: internal: add a response fragment to the reassembly buffer
+ *  The buffer is sized by the total length known from the first frame.
+ *  Returns true when the response is complete.
+ */
+bool OvmsPoller::PollerAssemble(OvmsPollReply &reply, const poll_job_t &job, const uint8_t* data, uint8_t length)
+  {
+  if (job.mlframe == 0 && !reply.Reserve(job.mloffset + length + job.mlremain))
+    {
+    ESP_LOGW(TAG, "PollerAssemble: no buffer for %u bytes, dropping response %02X(%X)",
+      job.mloffset + length + job.mlremain, job.type, job.pid);
+    return false;
+    }
+  if (!reply.Write(job.mloffset, data, length))
+    {
+    // Missed first frame or length mismatch:
+    reply.Release();
+    return false;
+    }
+  return (job.mlremain == 0);
+  }
+
+void OvmsPoller::PollerSlotError(poll_slot_t &slot, uint16_t code)
+  {
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  if (slot.collect)
+    m_response_cnt++;
+  if (slot.series)
+    slot.series->IncomingError(slot.job, code);
+  }
+
+/**
+ * PollerResetSlots: internal: drop all queued & running requests
+ */
+void OvmsPoller::PollerResetSlots()
+  {
+  for (auto &slot : m_slots)
+    {
+    slot.state = SlotFree;
+    slot.wait = false;
+    slot.txmsgid = 0;
+    slot.series = nullptr;
+    slot.reply.Release();
     }
   }
 
+bool OvmsPoller::PollerHasFreeSlot()
+  {
+  // Pipelining: fetch ahead, PollerStartQueued() limits the active requests
+  int limit = (m_poll_pipeline > 1) ? VEHICLE_POLL_MAXSLOTS : 1;
+  for (int i = 0; i < limit; i++)
+    {
+    if (m_slots[i].state == SlotFree)
+      return true;
+    }
+  return false;
+  }
+
+int OvmsPoller::PollerCountSlots(poll_slot_state_t state)
+  {
+  int cnt = 0;
+  for (auto &slot : m_slots)
+    {
+    if (slot.state == state)
+      cnt++;
+    }
+  return cnt;
+  }
+
+/**
+ * PollerCanFetch: internal: check if another entry may be fetched while
+ *  requests are pending (pipelining).
+ */
+bool OvmsPoller::PollerCanFetch()
+  {
+  if (m_poll_wait > 0 || !PollerHasFreeSlot())
+    return false;
+  for (auto &slot : m_slots)
+    {
+    if (slot.state == SlotFree)
+      continue;
+    // Series without pipelining support & exclusive requests need to finish first:
+    if (slot.serial || PollEntryIsExclusive(slot.job.entry))
+      return false;
+    }
+  return true;
+  }
+
+/**
+ * PollerWrite: transmit a protocol frame (internal)
+ *  With the poller simulator enabled, frames on simulated buses are passed
+ *  to the virtual ECUs instead.
+ */
+void OvmsPoller::PollerWrite(canbus* bus, CAN_frame_t* frame)
+  {
+#ifdef CONFIG_OVMS_DEV_POLLER_SIM
+  if (MyPollerSim.Transmit(bus, frame))
+    return;
+#endif
+  bus->Write(frame);
+  }
+
 void OvmsPoller::Outgoing(const CAN_frame_t &frame, bool success)
   {
+  if (frame.origin != m_poll.bus)
+    return;
+
+  // ISO-TP request?
+  for (auto &slot : m_slots)
+    {
+    if (slot.state != SlotActive || !slot.wait || frame.MsgID != slot.txmsgid)
+      continue;
+    // On failure, try to speed up the current poll timeout:
+    if (!success)
+      PollerSlotError(slot, POLLSINGLE_TXFAILURE);
+    // Forward to application:
+    slot.job.moduleid_rec = 0; // Not yet received
+      {
+      OvmsRecMutexLock lock(&m_poll_mutex);
+      if (slot.series)
+        slot.series->IncomingTxReply(slot.job, success);
+      }
+    if (!success)
+      {
+      slot.wait = false;
+      slot.state = SlotFree;
+      slot.series = nullptr;
+      }
+    return;
+    }
 
   // Check for a late callback:
-  if (!m_poll_wait || !m_poll.entry.txmoduleid || frame.origin != m_poll.bus || frame.MsgID != m_poll_txmsgid)
+  if (!m_poll_wait || !m_poll.entry.txmoduleid || frame.MsgID != m_poll_txmsgid)
     return;
 
   // Forward to protocol handler:
@@ -576,6 +1075,16 @@ int OvmsPoller::PollSingleRequest(uint32_t txid, uint32_t rxid,
     poll.xargs.data = (const uint8_t*)request.data()+1;
     }
 
+  // accept the response if the bus gets filtered; the ranges are kept, so
+  // repeated requests to an ECU do not change the filter:
+  if (m_poll.bus)
+    {
+    CAN_acceptance_list_t list;
+    poller_acceptance(poll, list);
+    for (auto &range : list)
+      m_poll.bus->AddAcceptance("poller.single", range.id_from, range.id_to, range.extended);
+    }
+
   int rx_error;
   OvmsSemaphore     single_rxdone;   // … response done (ok/error)
   std::shared_ptr<BlockingOnceOffPoll> poller( new BlockingOnceOffPoll(poll, &response, &rx_error, &single_rxdone));
@@ -646,7 +1155,7 @@ void OvmsPoller::Queue_PollerSend(OvmsPoller::poller_source_t source)
 
 void OvmsPoller::DoPollerSendSuccess( void * pvParamCan, uint32_t ticker ) // Static
   {
-  uint8_t can_number = uint32_t(pvParamCan);
+  uint8_t can_number = uintptr_t(pvParamCan);
   MyPollers.QueuePollerSend(OvmsPoller::poller_source_t::Successful, can_number, ticker);
   }
 
@@ -671,7 +1180,7 @@ void OvmsPoller::Queue_PollerSendSuccess()
     m_parent->QueuePollerSend(OvmsPoller::poller_source_t::Successful, m_poll.bus_no);
   else
     {
-    xTimerPendFunctionCall(OvmsPoller::DoPollerSendSuccess,(void *)(uint32_t)m_poll.bus_no, m_poll.ticker, m_poll_between_success);
+    xTimerPendFunctionCall(OvmsPoller::DoPollerSendSuccess,(void *)(uintptr_t)m_poll.bus_no, m_poll.ticker, m_poll_between_success);
     }
   }
 
@@ -741,6 +1250,7 @@ const char *OvmsPoller::PollerSource(OvmsPoller::poller_source_t src)
     case poller_source_t::Secondary: return "SEC";
     case poller_source_t::Successful: return "SRX";
     case poller_source_t::OnceOff: return "ONE";
+    case poller_source_t::Scheduled: return "SCH";
     }
     return "XXX";
   }
@@ -756,6 +1266,7 @@ const char *OvmsPoller::PollerCommand(OvmsPollCommand src, bool brief)
     case OvmsPollCommand::SuccessSep:  return brief ? "SucSp" : "SuccSep";
     case OvmsPollCommand::Shutdown:    return brief ? "Shtdn" : "Shutdown";
     case OvmsPollCommand::ResetTimer:  return brief ? "RstTm" : "ResetTimer";
+    case OvmsPollCommand::Pipeline:    return brief ? "Pipln" : "Pipeline";
     }
   return "??";
   }
@@ -766,6 +1277,7 @@ OvmsPollers::OvmsPollers()
     m_poll_fc_septime(25),
     m_poll_ch_keepalive(60),
     m_poll_between_success(0),
+    m_poll_pipeline(1),
     m_poll_last(0),
     m_pollqueue(nullptr), m_polltask(nullptr),
     m_timer_poller(nullptr),
@@ -776,7 +1288,11 @@ OvmsPollers::OvmsPollers()
     m_ready(false),
     m_paused(false),
     m_user_paused(false),
-    m_trace(trace_Off)
+    m_trace(trace_Off),
+    m_task_deadline(0),
+    m_task_deadline_set(false),
+    m_poll_hint_gen(1),
+    m_poll_batch_any(false)
   {
   ESP_LOGI(TAG, "Initialising Poller (7000)");
   for (int idx = 0; idx < VEHICLE_MAXBUSSES; ++idx)
@@ -791,7 +1307,7 @@ OvmsPollers::OvmsPollers()
 
   m_poll_txcallback = std::bind(&OvmsPollers::PollerTxCallback, this, _1, _2);
 
-  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsPollers::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&OvmsPollers::Ticker1, this, _1, _2));
   MyCan.RegisterCallback(TAG, std::bind(&OvmsPollers::PollerRxCallback, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"system.shuttingdown",std::bind(&OvmsPollers::EventSystemShuttingDown, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsPollers::ConfigChanged, this, _1, _2));
@@ -817,6 +1333,10 @@ OvmsPollers::OvmsPollers()
   cmd_times->RegisterCommand("off","Turn off Poll-Time Tracing",poller_times);
   cmd_times->RegisterCommand("status","Show timing status",poller_times);
   cmd_times->RegisterCommand("reset","Reset Poll-Time Tracing",poller_times);
+  OvmsCommand* cmd_batch = cmd_poller->RegisterCommand("batch","OBD multi DID requests",poller_batch);
+  cmd_batch->RegisterCommand("status","Show multi DID request status",poller_batch);
+  cmd_batch->RegisterCommand("reset","Relearn multi DID response layouts",poller_batch);
+  cmd_batch->RegisterCommand("set","Set max DIDs per request for an ECU",poller_batch_set,"<txid> <maxdids>",2,2);
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   DuktapeObjectRegistration* dto = new DuktapeObjectRegistration("OvmsPoller");
@@ -909,6 +1429,8 @@ void OvmsPollers::ShuttingDown()
 void OvmsPollers::ShuttingDownVehicle()
   {
   OvmsRecMutexLock lock(&m_poller_mutex);
+  PollClearPidHints();
+  PollClearBatching();
   for (int i = 0 ; i < VEHICLE_MAXBUSSES; ++i)
     {
       // Remove All pollers starting with "!v."
@@ -967,7 +1489,7 @@ void OvmsPollers::PowerDownCanBus(int busno)
     bus->SetPowerMode(Off);
   }
 
-void OvmsPollers::Ticker1(std::string event, void* data)
+void OvmsPollers::Ticker1(const char* event, void* data)
   {
   PollerResetThrottle();
   }
@@ -981,7 +1503,7 @@ void OvmsPollers::EventSystemShuttingDown(std::string event, void* data)
   MyEvents.DeregisterEvent(TAG);
   MyBoot.ShutdownPending(TAG);
   // Register a special shut-down event to check shut-down
-  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsPollers::Ticker1_Shutdown, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&OvmsPollers::Ticker1_Shutdown, this, _1, _2));
   m_shut_down = true;
   if (Atomic_Get(m_polltask))
     {
@@ -994,7 +1516,7 @@ void OvmsPollers::EventSystemShuttingDown(std::string event, void* data)
     xQueueSendToFront(m_pollqueue, &entry, 0);
     }
   }
-void OvmsPollers::Ticker1_Shutdown(std::string event, void* data)
+void OvmsPollers::Ticker1_Shutdown(const char* event, void* data)
   {
   if (Atomic_Get(m_polltask) == nullptr)
     {
@@ -1203,54 +1725,464 @@ void OvmsPollers::average_value_t::add_time(uint32_t time_spent, uint64_t time_a
     max_time = timesum;
   }
 
-bool OvmsPollers::poller_key_less_t::operator()(const poller_key_t &lhs, const poller_key_t &rhs) const
+bool OvmsPollers::poller_key_less_t::operator()(const poller_key_t &lhs, const poller_key_t &rhs) const
+  {
+  if (lhs.entry_type != rhs.entry_type)
+    return lhs.entry_type < rhs.entry_type;
+  switch (lhs.entry_type)
+    {
+    case OvmsPoller::OvmsPollEntryType::FrameRx:
+    case OvmsPoller::OvmsPollEntryType::FrameTx:
+      {
+      if (lhs.busnumber != rhs.busnumber)
+        return lhs.busnumber < rhs.busnumber;
+      return lhs.Frame_MsgId < rhs.Frame_MsgId;
+      }
+    case OvmsPoller::OvmsPollEntryType::Poll:
+      {
+      if (lhs.busnumber != rhs.busnumber)
+        return lhs.busnumber < rhs.busnumber;
+      return lhs.Poll_src < rhs.Poll_src;
+      }
+    case OvmsPoller::OvmsPollEntryType::Command:
+      return lhs.Command_cmd < rhs.Command_cmd;
+    case OvmsPoller::OvmsPollEntryType::PollState:
+      return false;
+    default:
+      return false;
+    }
+  }
+
+OvmsPollers::poller_key_st::poller_key_st( const OvmsPoller::poll_queue_entry_t &entry)
+  {
+  busnumber = 0;
+  entry_type = entry.entry_type;
+  switch (entry.entry_type)
+    {
+    case OvmsPoller::OvmsPollEntryType::FrameRx:
+    case OvmsPoller::OvmsPollEntryType::FrameTx:
+      busnumber = entry.entry_FrameRxTx.frame.origin->m_busnumber+1;
+      Frame_MsgId = entry.entry_FrameRxTx.frame.MsgID;
+      break;
+    case OvmsPoller::OvmsPollEntryType::Poll:
+      busnumber = entry.entry_Poll.busno;
+      Poll_src = entry.entry_Poll.source;
+      break;
+    case OvmsPoller::OvmsPollEntryType::Command:
+      Command_cmd = entry.entry_Command.cmd;
+      break;
+    default:
+      ;
+    }
+  }
+
+OvmsPollers::poller_key_st::poller_key_st( OvmsPoller::OvmsPollEntryType type, uint8_t busno, uint32_t msgid)
+  {
+  entry_type = type;
+  busnumber = busno;
+  Frame_MsgId = msgid;
+  }
+
+void OvmsPollers::response_time_t::add(uint32_t rtt_us)
+  {
+  // Smoothed response time & deviation as in RFC 6298:
+  if (count == 0)
+    {
+    srtt_us = rtt_us;
+    rttvar_us = rtt_us / 2;
+    }
+  else
+    {
+    int32_t err = (int32_t)rtt_us - (int32_t)srtt_us;
+    srtt_us += err / 8;
+    rttvar_us += ((int32_t)ABS(err) - (int32_t)rttvar_us) / 4;
+    }
+  ++count;
+  if (rtt_us > max_us)
+    max_us = rtt_us;
+  backoff = 0;
+
+  // Histogram, aging by halving:
+  int bucket = 0;
+  for (uint32_t ms = rtt_us / 1000; ms > 0 && bucket < response_time_buckets-1; ms >>= 1)
+    ++bucket;
+  if (++hist_n > 256)
+    {
+    hist_n = 0;
+    for (int i = 0; i < response_time_buckets; i++)
+      {
+      hist[i] /= 2;
+      hist_n += hist[i];
+      }
+    ++hist_n;
+    }
+  ++hist[bucket];
+  }
+
+void OvmsPollers::response_time_t::timeout()
+  {
+  ++timeouts;
+  if (backoff < 4)
+    ++backoff;
+  }
+
+/**
+ * percentile: get upper bound of the response time percentile in ms
+ */
+uint32_t OvmsPollers::response_time_t::percentile(int pct) const
+  {
+  uint32_t total = 0;
+  for (int i = 0; i < response_time_buckets; i++)
+    total += hist[i];
+  if (total == 0)
+    return 0;
+  uint32_t sum = 0, limit = (total * pct + 99) / 100;
+  for (int i = 0; i < response_time_buckets-1; i++)
+    {
+    sum += hist[i];
+    if (sum >= limit)
+      return LIMIT_MAX(1u << i, (max_us + 999) / 1000);
+    }
+  return (max_us + 999) / 1000;
+  }
+
+/**
+ * timeout_ms: derive the response timeout from the statistics
+ */
+uint32_t OvmsPollers::response_time_t::timeout_ms(uint32_t default_ms) const
+  {
+  if (count < 4)
+    return default_ms;
+  uint32_t tmo = (srtt_us + 4 * rttvar_us) / 1000;
+  uint32_t p95 = percentile(95);
+  if (p95 > tmo)
+    tmo = p95;
+  tmo = (tmo + VEHICLE_POLL_TIMEOUT_MARGIN) << backoff;
+  return LIMIT_MIN(LIMIT_MAX(tmo, default_ms), VEHICLE_POLL_TIMEOUT_MIN);
+  }
+
+/**
+ * ResponseTimeoutDefault: response timeout for unknown ECUs & broadcasts
+ *  This equals the timeout of the previous tick based implementation (2 primary ticks).
+ */
+uint32_t OvmsPollers::ResponseTimeoutDefault()
+  {
+  return 2 * m_poll_tick_ms * LIMIT_MIN(m_poll_tick_secondary, 1);
+  }
+
+uint32_t OvmsPollers::ResponseTimeout(uint8_t busno, uint32_t rxid)
+  {
+  uint32_t default_ms = ResponseTimeoutDefault();
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  auto it = m_poll_response_stats.find(poller_key_t(OvmsPoller::OvmsPollEntryType::FrameRx, busno, rxid));
+  if (it == m_poll_response_stats.end())
+    return default_ms;
+  return it->second.timeout_ms(default_ms);
+  }
+
+void OvmsPollers::AddResponseTime(uint8_t busno, uint32_t txid, uint32_t rxid, uint32_t rtt_us)
+  {
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  auto &stats = m_poll_response_stats[poller_key_t(OvmsPoller::OvmsPollEntryType::FrameRx, busno, rxid)];
+  stats.txid = txid;
+  stats.add(rtt_us);
+  }
+
+void OvmsPollers::AddResponseTimeout(uint8_t busno, uint32_t txid, uint32_t rxid)
+  {
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  auto &stats = m_poll_response_stats[poller_key_t(OvmsPoller::OvmsPollEntryType::FrameRx, busno, rxid)];
+  stats.txid = txid;
+  stats.timeout();
+  }
+
+void OvmsPollers::ResponseTimesReset()
+  {
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  m_poll_response_stats.clear();
+  }
+
+/**
+ * PollSetPidHint: set scheduling hints for a poll list entry
+ *  priority: entries with higher priority are sent first when due at the same time
+ *  metrics: poll on demand, only send the entry while any of these metrics has
+ *    a listener registered by name (see OvmsMetrics::HasNamedListener).
+ *    Servers & the web UI don't count, metrics they need must not be on demand.
+ *  Priority 0 without metrics removes the hint.
+ */
+void OvmsPollers::PollSetPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t priority,
+  const std::vector<std::string> &metrics)
+  {
+  OvmsMutexLock lock(&m_hint_mutex);
+  uint64_t key = PollHintKey(txmoduleid, type, pid);
+  if (priority == 0 && metrics.empty())
+    {
+    m_poll_hints.erase(key);
+    }
+  else
+    {
+    poll_hint_t &hint = m_poll_hints[key];
+    hint.priority = priority;
+    hint.metrics = metrics;
+    }
+  m_poll_hint_gen++;
+  }
+
+void OvmsPollers::PollClearPidHints()
+  {
+  OvmsMutexLock lock(&m_hint_mutex);
+  if (m_poll_hints.empty())
+    return;
+  m_poll_hints.clear();
+  m_poll_hint_gen++;
+  }
+
+bool OvmsPollers::GetPollPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t &priority, std::vector<std::string> &metrics)
+  {
+  OvmsMutexLock lock(&m_hint_mutex);
+  auto it = m_poll_hints.find(PollHintKey(txmoduleid, type, pid));
+  if (it == m_poll_hints.end())
+    return false;
+  priority = it->second.priority;
+  metrics = it->second.metrics;
+  return true;
+  }
+
+/**
+ * PollSetBatching: combine UDS ReadDataByIdentifier (0x22) requests to an ECU
+ *  Up to maxdids consecutive due DIDs for the ECU are sent in one request, the
+ *  combined response is split into the single DID responses. The response data
+ *  length of each DID is learned from its single responses first, so a DID is
+ *  only batched after it has been polled once.
+ *  maxdids 0 or 1 disables batching for the ECU.
+ */
+void OvmsPollers::PollSetBatching(uint32_t txmoduleid, uint8_t maxdids)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  maxdids = LIMIT_MAX(maxdids, VEHICLE_POLL_MAXBATCH);
+  if (maxdids <= 1)
+    {
+    m_poll_batch.erase(txmoduleid);
+    }
+  else
+    {
+    poll_batch_t &batch = m_poll_batch[txmoduleid];
+    batch.maxdids = maxdids;
+    batch.limit = maxdids;
+    batch.failures = 0;
+    }
+  m_poll_batch_any = !m_poll_batch.empty();
+  }
+
+void OvmsPollers::PollClearBatching()
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  m_poll_batch.clear();
+  m_poll_batch_any = false;
+  }
+
+/**
+ * PollBatchReset: forget the learned response layouts & limits
+ */
+void OvmsPollers::PollBatchReset()
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  for (auto &it : m_poll_batch)
+    {
+    poll_batch_t &batch = it.second;
+    batch.limit = batch.maxdids;
+    batch.failures = 0;
+    batch.requests = 0;
+    batch.dids = 0;
+    batch.didlen.clear();
+    }
+  }
+
+/**
+ * PollBatchLimit: get the current max DIDs per request for an ECU (<= 1 = no batching)
+ */
+uint8_t OvmsPollers::PollBatchLimit(uint32_t txmoduleid)
+  {
+  if (!m_poll_batch_any)
+    return 0;
+  OvmsMutexLock lock(&m_batch_mutex);
+  auto it = m_poll_batch.find(txmoduleid);
+  if (it == m_poll_batch.end())
+    return 0;
+  return it->second.limit;
+  }
+
+bool OvmsPollers::PollBatchDidLength(uint32_t txmoduleid, uint16_t did, uint16_t &length)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  auto it = m_poll_batch.find(txmoduleid);
+  if (it == m_poll_batch.end())
+    return false;
+  auto lt = it->second.didlen.find(did);
+  if (lt == it->second.didlen.end())
+    return false;
+  length = lt->second;
+  return true;
+  }
+
+/**
+ * PollBatchLearn: record the response data length of a DID read by a single request
+ */
+void OvmsPollers::PollBatchLearn(uint32_t txmoduleid, uint16_t did, uint16_t length)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  auto it = m_poll_batch.find(txmoduleid);
+  if (it == m_poll_batch.end() || it->second.limit <= 1)
+    return;
+  it->second.didlen[did] = length;
+  }
+
+void OvmsPollers::PollBatchSucceeded(uint32_t txmoduleid, int dids)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  auto it = m_poll_batch.find(txmoduleid);
+  if (it == m_poll_batch.end())
+    return;
+  poll_batch_t &batch = it->second;
+  batch.failures = 0;
+  batch.requests++;
+  batch.dids += dids;
+  }
+
+/**
+ * PollBatchFailed: learn from a failed multi DID request
+ *  NRC 0x13 / 0x14 mean the ECU does not accept that many DIDs in one request
+ *  or the response would be too long, the limit is halved. NRC 0x31 means a
+ *  DID is not supported, the DIDs involved are read by single requests in the
+ *  next run. A timeout or a response not matching the learned layout (code 0)
+ *  discards the lengths of the DIDs involved, so they are relearned by single
+ *  requests. Batching is disabled for the ECU after VEHICLE_POLL_BATCH_MAXFAIL
+ *  consecutive failures.
+ */
+void OvmsPollers::PollBatchFailed(uint32_t txmoduleid, uint16_t code, const OvmsPoller::poll_pid_t* entries, int count)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  auto it = m_poll_batch.find(txmoduleid);
+  if (it == m_poll_batch.end())
+    return;
+  poll_batch_t &batch = it->second;
+  if (code == UDS_RESP_NRC_IMLOIF || code == UDS_RESP_NRC_RTL)
+    {
+    batch.limit = LIMIT_MIN(LIMIT_MAX(batch.limit, count) / 2, 1);
+    const char* name = OvmsPoller::PollResultCodeName(code);
+    ESP_LOGW(TAG, "Multi DID request to %03" PRIx32 " rejected, code=%02X (%s), max DIDs now %u",
+      txmoduleid, code, name ? name : "-", batch.limit);
+    }
+  else if (code)
+    {
+    for (int i = 0; i < count; i++)
+      batch.didlen.erase(entries[i].pid);
+    ESP_LOGD(TAG, "Multi DID request to %03" PRIx32 " rejected, code=%02X, reading %d DIDs singly",
+      txmoduleid, code, count);
+    }
+  else
+    {
+    for (int i = 0; i < count; i++)
+      batch.didlen.erase(entries[i].pid);
+    if (++batch.failures >= VEHICLE_POLL_BATCH_MAXFAIL)
+      {
+      batch.limit = 1;
+      ESP_LOGW(TAG, "Multi DID responses from %03" PRIx32 " don't match, batching disabled", txmoduleid);
+      }
+    }
+  }
+
+bool OvmsPollers::PollBatchTrace(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_batch_mutex);
+  if (m_poll_batch.empty())
+    return false;
+  writer->puts(  "ECU      | Max    | Limit  | DIDs   | Reqs   | Avg DIDs");
+  writer->puts(  "         |        |        | known  |        | per req");
+  writer->puts(  "---------+--------+--------+--------+--------+---------");
+  for (auto &it : m_poll_batch)
+    {
+    const poll_batch_t &batch = it.second;
+    writer->printf("%8" PRIx32 " |%8u|%8u|%8u|%8" PRIu32 "|%9.1f\n",
+      it.first, batch.maxdids, batch.limit, (unsigned)batch.didlen.size(), batch.requests,
+      batch.requests ? (float)batch.dids / batch.requests : 0.0f);
+    }
+  return true;
+  }
+
+/**
+ * PollerTaskWait: get time to wait for the next queue entry
+ *  (next response deadline or due sub-second poll entry)
+ */
+TickType_t OvmsPollers::PollerTaskWait()
   {
-  if (lhs.entry_type != rhs.entry_type)
-    return lhs.entry_type < rhs.entry_type;
-  switch (lhs.entry_type)
+  bool found = false, found_due = false;
+  uint32_t deadline = 0, due = 0, next;
+  bool paused = m_paused || m_user_paused;
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  uint32_t now = OvmsPoller::PollerTimeMs();
+  for (int i = 0 ; i < VEHICLE_MAXBUSSES; ++i)
     {
-    case OvmsPoller::OvmsPollEntryType::FrameRx:
-    case OvmsPoller::OvmsPollEntryType::FrameTx:
+    if (!m_pollers[i])
+      continue;
+    if (m_pollers[i]->PollerNextDeadline(next))
       {
-      if (lhs.busnumber != rhs.busnumber)
-        return lhs.busnumber < rhs.busnumber;
-      return lhs.Frame_MsgId < rhs.Frame_MsgId;
+      if (!found || (int32_t)(next - now) < (int32_t)(deadline - now))
+        deadline = next;
+      found = true;
       }
-    case OvmsPoller::OvmsPollEntryType::Poll:
+    if (!paused && m_pollers[i]->PollerNextDue(next))
       {
-      if (lhs.busnumber != rhs.busnumber)
-        return lhs.busnumber < rhs.busnumber;
-      return lhs.Poll_src < rhs.Poll_src;
+      if (!found_due || (int32_t)(next - now) < (int32_t)(due - now))
+        due = next;
+      found_due = true;
       }
-    case OvmsPoller::OvmsPollEntryType::Command:
-      return lhs.Command_cmd < rhs.Command_cmd;
-    case OvmsPoller::OvmsPollEntryType::PollState:
-      return false;
-    default:
-      return false;
     }
+
+  TickType_t wait = portMAX_DELAY;
+  if (found)
+    {
+    int32_t wait_ms = deadline - now;
+    wait = (wait_ms <= 0) ? 0 : pdMS_TO_TICKS(wait_ms) + 1;
+    }
+  if (found_due)
+    {
+    // Wait at least one tick for due entries, in case they cannot be sent yet:
+    int32_t wait_ms = due - now;
+    TickType_t wait_due = pdMS_TO_TICKS(LIMIT_MIN(wait_ms, 0)) + 1;
+    if (!found || (int32_t)(due - deadline) < 0)
+      deadline = due;
+    if (wait_due < wait)
+      wait = wait_due;
+    }
+  m_task_deadline = deadline;
+  m_task_deadline_set = found || found_due;
+  return wait;
   }
 
-OvmsPollers::poller_key_st::poller_key_st( const OvmsPoller::poll_queue_entry_t &entry)
+/**
+ * CheckDeadlines: free timed out requests & continue polling, send due entries
+ */
+void OvmsPollers::CheckDeadlines()
   {
-  busnumber = 0;
-  entry_type = entry.entry_type;
-  switch (entry.entry_type)
+  bool paused = m_paused || m_user_paused;
+  uint32_t now = OvmsPoller::PollerTimeMs(), due;
+  for (int i = 0 ; i < VEHICLE_MAXBUSSES; ++i)
     {
-    case OvmsPoller::OvmsPollEntryType::FrameRx:
-    case OvmsPoller::OvmsPollEntryType::FrameTx:
-      busnumber = entry.entry_FrameRxTx.frame.origin->m_busnumber+1;
-      Frame_MsgId = entry.entry_FrameRxTx.frame.MsgID;
-      break;
-    case OvmsPoller::OvmsPollEntryType::Poll:
-      busnumber = entry.entry_Poll.busno;
-      Poll_src = entry.entry_Poll.source;
-      break;
-    case OvmsPoller::OvmsPollEntryType::Command:
-      Command_cmd = entry.entry_Command.cmd;
-      break;
-    default:
-      ;
+    OvmsPoller *poller;
+      {
+      OvmsRecMutexLock lock(&m_poller_mutex);
+      poller = m_pollers[i];
+      }
+    if (!poller)
+      continue;
+    if (poller->PollerSlotTimeouts() > 0)
+      poller->Queue_PollerSendSuccess();
+    else if (!paused && !poller->m_poll_scheduled && poller->PollerNextDue(due) && (int32_t)(due - now) <= 0)
+      {
+      poller->m_poll_scheduled = true;
+      poller->Queue_PollerSend(OvmsPoller::poller_source_t::Scheduled);
+      }
     }
   }
 
@@ -1264,8 +2196,14 @@ void OvmsPollers::PollerTask()
       ShuttingDown();
       break;
       }
-    if (xQueueReceive(m_pollqueue, &entry, (portTickType)portMAX_DELAY)!=pdTRUE)
+    if (xQueueReceive(m_pollqueue, &entry, PollerTaskWait())!=pdTRUE)
+      {
+      CheckDeadlines();
       continue;
+      }
+    // Deadlines also need to be checked on a busy bus:
+    if (m_task_deadline_set && (int32_t)(OvmsPoller::PollerTimeMs() - m_task_deadline) >= 0)
+      CheckDeadlines();
 
     for (int istx = 0; istx < 2; ++istx)
       {
@@ -1305,6 +2243,8 @@ void OvmsPollers::PollerTask()
           {
           for (auto it = m_poll_time_stats.begin(); it != m_poll_time_stats.end(); ++it)
             it->second.reset();
+          if (entry.entry_Command.parameter <= 1)
+            ResponseTimesReset();
           if (entry.entry_Command.parameter == 1)
             {
             // Tracing back on.
@@ -1326,6 +2266,9 @@ void OvmsPollers::PollerTask()
           poller_key_t key(entry);
           m_poll_time_stats[key].add_time(diff, finish);
           }
+#ifdef CONFIG_OVMS_DEV_POLLER_SIM
+        MyPollerSim.AddPollerTime(poller_key_t(entry).busnumber, finish-start);
+#endif
         }
       );
 
@@ -1466,6 +2409,18 @@ void OvmsPollers::PollerTask()
                 }
               }
             break;
+          case OvmsPoller::OvmsPollCommand::Pipeline:
+            if (entry.entry_Command.parameter != m_poll_pipeline)
+              {
+              m_poll_pipeline = entry.entry_Command.parameter;
+              OvmsRecMutexLock lock(&m_poller_mutex);
+              for (int i = 0 ; i < VEHICLE_MAXBUSSES; ++i)
+                {
+                if (m_pollers[i])
+                  m_pollers[i]->PollSetPipelining(m_poll_pipeline);
+                }
+              }
+            break;
           case OvmsPoller::OvmsPollCommand::ResetTimer:
             break;//triggered above
           }
@@ -1544,6 +2499,7 @@ OvmsPoller *OvmsPollers::GetPoller(canbus *can, bool force)
     newpoller->m_poll_sequence_max = m_poll_sequence_max;
     newpoller->m_poll_fc_septime = m_poll_fc_septime;
     newpoller->m_poll_ch_keepalive = m_poll_ch_keepalive;
+    newpoller->PollSetPipelining(m_poll_pipeline);
     m_pollers[gap] = newpoller;
     }
 
@@ -1780,6 +2736,9 @@ void OvmsPollers::PollerStatus(int verbosity, OvmsWriter* writer)
     writer->printf("  List: %s\n", (has_active ? "active" : "not active") );
     if (has_active)
       writer->printf("  State: %" PRIu8 "\n", state);
+    if (poller->m_poll_pipeline > 1)
+      writer->printf("  Pipelining: %" PRIu8 " (active %d, queued %d)\n", poller->m_poll_pipeline,
+        poller->PollerCountSlots(OvmsPoller::SlotActive), poller->PollerCountSlots(OvmsPoller::SlotQueued));
 
     writer->printf("  Last Request: ");
     auto last = poller->m_poll_sent_last;
@@ -1808,6 +2767,8 @@ void OvmsPollers::PollerStatus(int verbosity, OvmsWriter* writer)
     writer->printf("Poll Queue Length: %d\n", waiting);
     }
 
+  MyPollReplyPool.Status(writer);
+
   if (IsPaused() || IsUserPaused())
     writer->printf("OBD polling is Paused %s%s\n", IsPaused() ? "[system]":"", IsUserPaused() ? "[user]" : "");
   else
@@ -1878,6 +2839,7 @@ void OvmsPollers::poller_times(int verbosity, OvmsWriter* writer, OvmsCommand* c
     writer->printf("Poller timing is: %s\n",
       (MyPollers.m_trace & trace_Times) ? "on" : "off");
     MyPollers.PollerTimesTrace(writer);
+    MyPollers.ResponseTimesTrace(writer);
     }
   else if (strcmp(cmd->GetName(), "reset") == 0)
     {
@@ -1887,6 +2849,41 @@ void OvmsPollers::poller_times(int verbosity, OvmsWriter* writer, OvmsCommand* c
       (MyPollers.m_trace & trace_Times) ? "on" : "off");
     }
   }
+void OvmsPollers::poller_batch(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (strcmp(cmd->GetName(), "reset") == 0)
+    {
+    MyPollers.PollBatchReset();
+    writer->puts("Multi DID response layouts will be relearned");
+    }
+  else if (!MyPollers.PollBatchTrace(writer))
+    {
+    writer->puts("No multi DID requests configured");
+    }
+  }
+
+void OvmsPollers::poller_batch_set(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  char* endp;
+  uint32_t txid = strtoul(argv[0], &endp, 16);
+  if (*endp || txid == 0)
+    {
+    writer->puts("ERROR: invalid TX ID");
+    return;
+    }
+  int maxdids = atoi(argv[1]);
+  if (maxdids < 0 || maxdids > VEHICLE_POLL_MAXBATCH)
+    {
+    writer->printf("ERROR: max DIDs must be 0-%d\n", VEHICLE_POLL_MAXBATCH);
+    return;
+    }
+  MyPollers.PollSetBatching(txid, maxdids);
+  if (maxdids > 1)
+    writer->printf("Multi DID requests to %" PRIx32 ": up to %d DIDs\n", txid, maxdids);
+  else
+    writer->printf("Multi DID requests to %" PRIx32 ": off\n", txid);
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 // OvmsPoller.GetPaused
 duk_ret_t OvmsPollers::DukOvmsPollerPaused(duk_context *ctx)
@@ -2146,6 +3143,27 @@ bool OvmsPollers::PollerTimesTrace( OvmsWriter* writer)
   return true;
   }
 
+bool OvmsPollers::ResponseTimesTrace( OvmsWriter* writer)
+  {
+  OvmsRecMutexLock lock(&m_poller_mutex);
+  if (m_poll_response_stats.empty())
+    return false;
+  uint32_t default_ms = ResponseTimeoutDefault();
+  writer->puts(  "ECU response    | count  | tmout  | Avg    | Dev    | p95    | Peak   | Timeout");
+  writer->puts(  "                |        |        | [ms]   | [ms]   | [ms]   | [ms]   | [ms]");
+  writer->puts(  "----------------+--------+--------+--------+--------+--------+--------+--------");
+  for (auto it = m_poll_response_stats.begin(); it != m_poll_response_stats.end(); ++it)
+    {
+    const response_time_t &cur = it->second;
+    std::string desc = string_format("Can%" PRIu8 "[%03" PRIx32 "-%03" PRIx32 "]",
+      it->first.busnumber, cur.txid, it->first.Frame_MsgId);
+    writer->printf("%-16s|%8" PRIu32 "|%8" PRIu32 "|%8.1f|%8.1f|%8" PRIu32 "|%8.1f|%8" PRIu32 "\n",
+      desc.c_str(), cur.count, cur.timeouts, cur.srtt_us / 1000.0, cur.rttvar_us / 1000.0,
+      cur.percentile(95), cur.max_us / 1000.0, cur.timeout_ms(default_ms));
+    }
+  return true;
+  }
+
 static const char *PollResStr( OvmsPoller::OvmsNextPollResult res)
   {
   switch(res)
@@ -2161,7 +3179,7 @@ static const char *PollResStr( OvmsPoller::OvmsNextPollResult res)
 // List of Poll Series
 
 OvmsPoller::PollSeriesList::PollSeriesList()
-  : m_first(nullptr), m_last(nullptr), m_iter(nullptr)
+  : m_first(nullptr), m_last(nullptr), m_iter(nullptr), m_found(nullptr)
   {
   }
 
@@ -2229,6 +3247,8 @@ void OvmsPoller::PollSeriesList::Remove( poll_series_t *iter)
 
   if (m_iter == iter)
     m_iter = iternext;
+  if (m_found == iter)
+    m_found = nullptr;
   if (m_first == iter)
     m_first = iternext;
   if (m_last == iter)
@@ -2314,7 +3334,13 @@ void OvmsPoller::PollSeriesList::IncomingPacket(const OvmsPoller::poll_job_t& jo
     {
     IFTRACE(Poller) ESP_LOGD(TAG, "Poll List:[%s] IncomingPacket TYPE:%x PID: %03x LEN: %d REM: %d ", m_iter->name.c_str(), job.type, job.pid, length, job.mlremain);
 
-    m_iter->series->IncomingPacket(job, data, length);
+    if (!m_iter->series->Reassembly())
+      m_iter->series->IncomingPacket(job, data, length);
+    else if (OvmsPoller::PollerAssemble(m_reply, job, data, length))
+      {
+      m_iter->series->IncomingReply(job, m_reply);
+      m_reply.Release();
+      }
     }
   else
     {
@@ -2360,6 +3386,16 @@ OvmsPoller::OvmsNextPollResult OvmsPoller::PollSeriesList::NextPollEntry(poll_pi
     }
   if (!m_iter)
     {
+    // Between runs: sub-second entries may be due
+    for (auto it = m_first; it != nullptr; it = it->next)
+      {
+      if (it->series != nullptr && it->series->NextDueEntry(entry, mybus, pollstate))
+        {
+        IFTRACE(Poller) ESP_LOGV(TAG, "PollSeriesList::NextPollEntry[%s]: Due", it->name.c_str());
+        m_found = it;
+        return OvmsPoller::OvmsNextPollResult::FoundEntry;
+        }
+      }
     IFTRACE(Poller) ESP_LOGV(TAG, "PollSeriesList::NextPollEntry - Not Started");
     return OvmsPoller::OvmsNextPollResult::StillAtEnd;
     }
@@ -2444,11 +3480,28 @@ OvmsPoller::OvmsNextPollResult OvmsPoller::PollSeriesList::NextPollEntry(poll_pi
         break;
         }
       default:
+        if (res == OvmsPoller::OvmsNextPollResult::FoundEntry)
+          m_found = m_iter;
         return res;
       }
     }
   }
 
+bool OvmsPoller::PollSeriesList::NextDueTime(uint32_t &due)
+  {
+  bool found = false;
+  uint32_t next, now = OvmsPoller::PollerTimeMs();
+  for (auto it = m_first; it != nullptr; it = it->next)
+    {
+    if (it->series == nullptr || !it->series->NextDueTime(next))
+      continue;
+    if (!found || (int32_t)(next - now) < (int32_t)(due - now))
+      due = next;
+    found = true;
+    }
+  return found;
+  }
+
 bool OvmsPoller::PollSeriesList::HasPollList()
   {
   for (auto it = m_first; it != nullptr; it = it->next)
@@ -2476,15 +3529,48 @@ void OvmsPoller::PollSeriesEntry::IncomingTxReply(const OvmsPoller::poll_job_t&
   // ignore
   }
 
+bool OvmsPoller::PollSeriesEntry::Reassembly()
+  {
+  return false;
+  }
+
+void OvmsPoller::PollSeriesEntry::IncomingReply(const OvmsPoller::poll_job_t& job, const OvmsPollReply &reply)
+  {
+  // ignore
+  }
+
 bool OvmsPoller::PollSeriesEntry::Ready()
   {
   return true;
   }
+
+bool OvmsPoller::PollSeriesEntry::CanPipeline()
+  {
+  return false;
+  }
+
+bool OvmsPoller::PollSeriesEntry::NextDueEntry(poll_pid_t &entry, uint8_t mybus, uint8_t pollstate)
+  {
+  return false;
+  }
+
+bool OvmsPoller::PollSeriesEntry::NextDueTime(uint32_t &due)
+  {
+  return false;
+  }
+
+bool OvmsPoller::PollSeriesEntry::NextBatchEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate,
+  const std::function<bool(const poll_pid_t&)> &accept)
+  {
+  return false;
+  }
 // Standard Poll Series - Replaces the original functionality
 
 // Standard Poll Series class
 OvmsPoller::StandardPollSeries::StandardPollSeries(OvmsPoller *poller, uint16_t stateoffset  )
-  : m_poller(poller), m_state_offset(stateoffset),  m_defaultbus(0), m_poll_plist(nullptr), m_poll_plcur(nullptr) 
+  : m_poller(poller), m_state_offset(stateoffset),  m_defaultbus(0), m_poll_plist(nullptr),
+    m_hint_gen(0), m_run_start(0), m_run_started(false), m_run_end(false),
+    m_has_ms(false), m_due_valid(false), m_due_any(false), m_next_due(0)
   {
   }
 void OvmsPoller::StandardPollSeries::SetParentPoller(OvmsPoller *poller)
@@ -2496,9 +3582,26 @@ void OvmsPoller::StandardPollSeries::SetParentPoller(OvmsPoller *poller)
 void OvmsPoller::StandardPollSeries::PollSetPidList(uint8_t defaultbus, const poll_pid_t* plist)
   {
   IFTRACE(Poller) ESP_LOGV(TAG, "Standard Poll Series: PID List set");
-  m_poll_plcur = nullptr;
   m_poll_plist = plist;
   m_defaultbus = defaultbus;
+
+  // Build scheduling state:
+  m_sched.clear();
+  m_has_ms = false;
+  size_t count = 0;
+  for (const poll_pid_t *plcur = plist; plcur && plcur->txmoduleid != 0; ++plcur, ++count)
+    {
+    for (int i = 0; i < VEHICLE_POLL_NSTATES; i++)
+      {
+      if (POLL_TIME_IS_MS(plcur->polltime[i]))
+        m_has_ms = true;
+      }
+    }
+  m_sched.resize(count, poll_sched_t{ 0, false, false, 0, {} });
+  m_hint_gen = 0;
+  m_run_started = false;
+  m_run_end = false;
+  m_due_valid = false;
   }
 
 void OvmsPoller::StandardPollSeries::ResetList(OvmsPoller::ResetMode mode)
@@ -2506,8 +3609,155 @@ void OvmsPoller::StandardPollSeries::ResetList(OvmsPoller::ResetMode mode)
   if (mode == OvmsPoller::ResetMode::PollReset)
     {
     IFTRACE(Poller) ESP_LOGV(TAG, "Standard Poll Series: List reset");
-    m_poll_plcur = NULL;
+    for (auto &sched : m_sched)
+      sched.done = false;
+    m_run_started = false;
+    m_run_end = false;
+    m_due_valid = false;
+    }
+  }
+
+/**
+ * UpdateHints: internal: apply changed priority & on demand hints (see PollSetPidHint)
+ */
+void OvmsPoller::StandardPollSeries::UpdateHints()
+  {
+  uint32_t gen = MyPollers.PollHintGeneration();
+  if (gen == m_hint_gen)
+    return;
+  m_hint_gen = gen;
+  for (size_t i = 0; i < m_sched.size(); i++)
+    {
+    poll_sched_t &sched = m_sched[i];
+    const poll_pid_t &pid = m_poll_plist[i];
+    if (!MyPollers.GetPollPidHint(pid.txmoduleid, pid.type, pid.pid, sched.priority, sched.metrics))
+      {
+      sched.priority = 0;
+      sched.metrics.clear();
+      }
+    }
+  }
+
+/**
+ * FetchDueEntry: internal: earliest deadline first selection of the next entry
+ *  Tick based entries are due once per run if the ticker matches their interval,
+ *  their deadline is the start of the run. Sub-second entries are due at their
+ *  own deadline, which advances by their interval when fetched. Entries with a
+ *  higher priority are fetched first, entries with equal deadlines in list order.
+ *  On demand entries without listeners on their metrics are skipped.
+ *  With accept, only entries passing the filter are considered.
+ *  Returns the index of the entry fetched or -1.
+ */
+int OvmsPoller::StandardPollSeries::FetchDueEntry(uint8_t mybus, uint32_t pollticker, uint8_t pollstate, bool ticked,
+  const std::function<bool(const poll_pid_t&)> *accept)
+  {
+  uint32_t now = OvmsPoller::PollerTimeMs();
+  int found = -1;
+  int8_t found_prio = 0;
+  uint32_t found_deadline = 0, found_interval = 0;
+
+  int idx = 0;
+  for (const poll_pid_t *plcur = m_poll_plist; plcur->txmoduleid != 0; ++plcur, ++idx)
+    {
+    uint8_t bus = plcur->pollbus;
+    if (bus == 0)
+      bus = m_defaultbus;
+    if (mybus != bus)
+      continue;
+    if (accept && !(*accept)(*plcur))
+      continue;
+    poll_sched_t &sched = m_sched[idx];
+    uint16_t polltime = plcur->polltime[pollstate];
+    uint32_t deadline, interval = 0;
+    if (polltime == 0)
+      {
+      sched.scheduled = false;
+      continue;
+      }
+    else if (POLL_TIME_IS_MS(polltime))
+      {
+      interval = LIMIT_MIN(POLL_TIME_MS(polltime), 10);
+      if (!sched.scheduled)
+        {
+        // Spread the first deadlines over the interval to avoid bursts:
+        uint32_t hash = (plcur->txmoduleid * 31 + plcur->pid * 7 + idx) * 2654435761u;
+        sched.due = now + (hash >> 16) % interval;
+        sched.scheduled = true;
+        }
+      if ((int32_t)(sched.due - now) > 0)
+        continue;
+      deadline = sched.due;
+      }
+    else
+      {
+      if (!ticked || sched.done || (pollticker % polltime) != 0)
+        continue;
+      deadline = m_run_start;
+      }
+
+    if (!sched.metrics.empty())
+      {
+      bool subscribed = false;
+      for (auto &name : sched.metrics)
+        {
+        if (MyMetrics.HasNamedListener(name))
+          {
+          subscribed = true;
+          break;
+          }
+        }
+      if (!subscribed)
+        {
+        if (interval)
+          sched.due = now + interval;
+        else
+          sched.done = true;
+        continue;
+        }
+      }
+
+    if (found < 0 || sched.priority > found_prio
+      || (sched.priority == found_prio && (int32_t)(deadline - found_deadline) < 0))
+      {
+      found = idx;
+      found_prio = sched.priority;
+      found_deadline = deadline;
+      found_interval = interval;
+      }
+    }
+
+  if (found >= 0)
+    {
+    poll_sched_t &sched = m_sched[found];
+    if (found_interval)
+      {
+      sched.due += found_interval;
+      // Don't try to catch up on missed deadlines:
+      if ((int32_t)(sched.due - now) <= 0)
+        sched.due = now + found_interval;
+      }
+    else
+      sched.done = true;
+    }
+
+  // Cache the next deadline of sub-second entries for the poller task:
+  m_due_any = false;
+  if (m_has_ms)
+    {
+    idx = 0;
+    for (const poll_pid_t *plcur = m_poll_plist; plcur->txmoduleid != 0; ++plcur, ++idx)
+      {
+      const poll_sched_t &sched = m_sched[idx];
+      if (!sched.scheduled || !POLL_TIME_IS_MS(plcur->polltime[pollstate]))
+        continue;
+      if (!m_due_any || (int32_t)(sched.due - m_next_due) < 0)
+        m_next_due = sched.due;
+      m_due_any = true;
+      }
     }
+  m_due_valid = true;
+
+  return found;
   }
 
 OvmsPoller::OvmsNextPollResult OvmsPoller::StandardPollSeries::NextPollEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate)
@@ -2525,33 +3775,81 @@ OvmsPoller::OvmsNextPollResult OvmsPoller::StandardPollSeries::NextPollEntry(pol
   if (pollstate >= VEHICLE_POLL_NSTATES)
     return OvmsNextPollResult::StillAtEnd;
 
-  // Restart poll list cursor:
-  if (m_poll_plcur == NULL)
-    m_poll_plcur = m_poll_plist;
-  else if (m_poll_plcur->txmoduleid == 0)
+  if (m_sched.empty() || m_run_end)
     return OvmsNextPollResult::StillAtEnd;
-  else
-    ++m_poll_plcur;
 
-  while (m_poll_plcur->txmoduleid != 0)
+  UpdateHints();
+  if (!m_run_started)
     {
-    uint8_t bus = m_poll_plcur->pollbus;
-    if (bus == 0)
-      bus = m_defaultbus;
-    if (mybus == bus)
-      {
-      uint16_t polltime = m_poll_plcur->polltime[pollstate];
-      if (( polltime > 0) && ((pollticker % polltime) == 0))
-        {
-        entry = *m_poll_plcur;
-        IFTRACE(Poller) ESP_LOGD(TAG, "Found Poll Entry for Standard Poll");
-        return OvmsNextPollResult::FoundEntry;
-        }
-      }
-    // Poll entry is not due, check next
-    ++m_poll_plcur;
+    m_run_started = true;
+    m_run_start = OvmsPoller::PollerTimeMs();
+    }
+
+  int idx = FetchDueEntry(mybus, pollticker, pollstate, true);
+  if (idx < 0)
+    {
+    m_run_end = true;
+    return OvmsNextPollResult::ReachedEnd;
+    }
+  entry = m_poll_plist[idx];
+  IFTRACE(Poller) ESP_LOGD(TAG, "Found Poll Entry for Standard Poll");
+  return OvmsNextPollResult::FoundEntry;
+  }
+
+// Fetch a due sub-second entry between runs.
+bool OvmsPoller::StandardPollSeries::NextDueEntry(poll_pid_t &entry, uint8_t mybus, uint8_t pollstate)
+  {
+  entry = {};
+  if (!m_has_ms || !Ready())
+    return false;
+  if (pollstate < m_state_offset || pollstate - m_state_offset >= VEHICLE_POLL_NSTATES)
+    {
+    m_due_valid = true;
+    m_due_any = false;
+    return false;
+    }
+  pollstate -= m_state_offset;
+
+  UpdateHints();
+  int idx = FetchDueEntry(mybus, 0, pollstate, false);
+  if (idx < 0)
+    return false;
+  entry = m_poll_plist[idx];
+  IFTRACE(Poller) ESP_LOGD(TAG, "Found Due Entry for Standard Poll");
+  return true;
+  }
+
+// Fetch another due entry for a multi DID request, in the same mode
+// (run or between runs) as the entry fetched before.
+bool OvmsPoller::StandardPollSeries::NextBatchEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate,
+  const std::function<bool(const poll_pid_t&)> &accept)
+  {
+  entry = {};
+  if (pollstate < m_state_offset || pollstate - m_state_offset >= VEHICLE_POLL_NSTATES)
+    return false;
+  pollstate -= m_state_offset;
+  bool ticked = m_run_started && !m_run_end;
+  if (!ticked && !m_has_ms)
+    return false;
+  int idx = FetchDueEntry(mybus, pollticker, pollstate, ticked, &accept);
+  if (idx < 0)
+    return false;
+  entry = m_poll_plist[idx];
+  return true;
+  }
+
+bool OvmsPoller::StandardPollSeries::NextDueTime(uint32_t &due)
+  {
+  if (!m_has_ms || !Ready())
+    return false;
+  if (!m_due_valid)
+    {
+    // Unknown: have the list scanned now
+    due = OvmsPoller::PollerTimeMs();
+    return true;
     }
-  return OvmsNextPollResult::ReachedEnd;
+  due = m_next_due;
+  return m_due_any;
   }
 
 void OvmsPoller::StandardPollSeries::IncomingPacket(const OvmsPoller::poll_job_t& job, uint8_t* data, uint8_t length)
@@ -2572,6 +3870,11 @@ void OvmsPoller::StandardPollSeries::Removing()
   m_poller = nullptr;
   }
 
+bool OvmsPoller::StandardPollSeries::CanPipeline()
+  {
+  return true;
+  }
+
 bool OvmsPoller::StandardPollSeries::HasPollList()
   {
   return (m_defaultbus != 0)
@@ -2611,6 +3914,14 @@ bool OvmsPoller::StandardVehiclePollSeries::Ready()
   return (!m_signal) || m_signal->Ready();
   }
 
+// Responses to pipelined requests may still be routed here after removal,
+// detach from the vehicle:
+void OvmsPoller::StandardVehiclePollSeries::Removing()
+  {
+  m_signal = nullptr;
+  OvmsPoller::StandardPollSeries::Removing();
+  }
+
 // Send on an imcoming TX reply
 void OvmsPoller::StandardVehiclePollSeries::IncomingTxReply(const OvmsPoller::poll_job_t& job, bool success)
   {
@@ -2618,6 +3929,18 @@ void OvmsPoller::StandardVehiclePollSeries::IncomingTxReply(const OvmsPoller::po
     m_signal->IncomingPollTxCallback(job, success);
   }
 
+bool OvmsPoller::StandardVehiclePollSeries::Reassembly()
+  {
+  return m_signal && m_signal->PollReassembly();
+  }
+
+// Process a reassembled response.
+void OvmsPoller::StandardVehiclePollSeries::IncomingReply(const OvmsPoller::poll_job_t& job, const OvmsPollReply &reply)
+  {
+  if (m_signal)
+    m_signal->IncomingPollResponse(job, reply);
+  }
+
 // StandardPacketPollSeries
 
 OvmsPoller::StandardPacketPollSeries::StandardPacketPollSeries( OvmsPoller *poller, int repeat_max, poll_success_func success, poll_fail_func fail)
@@ -2687,6 +4010,11 @@ bool OvmsPoller::StandardPacketPollSeries::HasRepeat()
   return (m_repeat_count < m_repeat_max) && HasPollList();
   }
 
+bool OvmsPoller::StandardPacketPollSeries::CanPipeline()
+  {
+  return false;
+  }
+
 // OvmsPoller::OnceOffPollBase class
 
 OvmsPoller::OnceOffPollBase::OnceOffPollBase( const poll_pid_t &pollentry, std::string *rxbuf, int *rxerr, uint8_t retry_fail)
@@ -25,8 +25,16 @@
 #define __VEHICLE_POLLER_H__
 
 #include "vehicle_common.h"
+#include "vehicle_poller_reply.h"
 
 #include <cstdint>
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/timers.h"
+#include "can.h"
+#include "ovms_metrics.h"
+#include "ovms_semaphore.h"
 
 // PollSingleRequest specific result codes:
 #define POLLSINGLE_OK                   0
@@ -38,6 +46,34 @@
 // Number of polling states supported
 #define VEHICLE_POLL_NSTATES            4
 
+// Max number of concurrent & queued requests per bus (see PollSetPipelining)
+#define VEHICLE_POLL_MAXSLOTS           8
+
+// ISO-TP response timeouts [ms]:
+//  The timeout for a request is derived from the response time statistics of
+//  the ECU, limited to [VEHICLE_POLL_TIMEOUT_MIN, 2 primary ticks].
+#define VEHICLE_POLL_TIMEOUT_MIN        50      // Lower limit for adaptive timeouts
+#define VEHICLE_POLL_TIMEOUT_MARGIN     20      // Added to the measured response time
+#define VEHICLE_POLL_TIMEOUT_ISOTP      1000    // ISO-TP N_Bs (wait for flow control)
+#define VEHICLE_POLL_TIMEOUT_PENDING    5000    // UDS P2*server (response pending)
+
+// Broadcast collect mode (ISOTP_COLLECT):
+#define VEHICLE_POLL_COLLECT_WINDOW     150     // Time to wait for responses [ms]
+#define VEHICLE_POLL_MAXRESPONDERS      16      // Max concurrent multi frame responses
+
+// Multi DID requests (UDS ReadDataByIdentifier, see PollSetBatching):
+#define VEHICLE_POLL_MAXBATCH           8       // Max DIDs per request
+#define VEHICLE_POLL_BATCH_MAXRESP      1024    // Max combined response size [bytes]
+#define VEHICLE_POLL_BATCH_MAXFAIL      3       // Disable after consecutive response mismatches
+
+// Sub-second poll intervals:
+//  poll_pid_t.polltime values with bit 15 set specify the interval in units of
+//  10 ms instead of primary ticks, e.g. { 0, POLL_MS(250), 10 }.
+#define VEHICLE_POLL_TIME_MS            0x8000
+#define POLL_MS(ms)                     (VEHICLE_POLL_TIME_MS | (((ms) + 9) / 10))
+#define POLL_TIME_IS_MS(t)              (((t) & VEHICLE_POLL_TIME_MS) != 0)
+#define POLL_TIME_MS(t)                 (((uint32_t)(t) & 0x7fff) * 10)
+
 // A note on "PID" and their sizes here:
 //  By "PID" for the service types we mean the part of the request parameters
 //  after the service type that is reflected in _every_ valid response to the request.
@@ -67,6 +103,9 @@
 
 // OBD/UDS Negative Response Code
 #define UDS_RESP_TYPE_NRC               0x7F  // see ISO 14229 Annex A.1
+#define UDS_RESP_NRC_IMLOIF             0x13  // … incorrectMessageLengthOrInvalidFormat
+#define UDS_RESP_NRC_RTL                0x14  // … responseTooLong
+#define UDS_RESP_NRC_ROOR               0x31  // … requestOutOfRange
 #define UDS_RESP_NRC_RCRRP              0x78  // … requestCorrectlyReceived-ResponsePending
 
 // Poll list PID xargs utility (see info above):
@@ -131,9 +170,9 @@ class OvmsPoller : public InternalRamAllocated {
           const uint8_t* data;                  // pointer to payload data (single/multi frame request)
           } xargs;
         };
-      uint16_t polltime[VEHICLE_POLL_NSTATES];  // poll intervals in seconds for used poll states
+      uint16_t polltime[VEHICLE_POLL_NSTATES];  // poll intervals in seconds (or POLL_MS()) for used poll states
       uint8_t  pollbus;                         // 0 = default CAN bus from PollSetPidList(), 1…4 = specific
-      uint8_t  protocol;                        // ISOTP_STD / ISOTP_EXTADR / ISOTP_EXTFRAME / VWTP_20
+      uint8_t  protocol;                        // ISOTP_STD / ISOTP_EXTADR / ISOTP_EXTFRAME / VWTP_20 (| ISOTP_COLLECT)
       } poll_pid_t;
 
     typedef struct
@@ -158,7 +197,7 @@ class OvmsPoller : public InternalRamAllocated {
     const uint32_t max_ticker = 3600;
     const uint32_t init_ticker = 9999;
 
-    typedef enum : uint8_t { Primary, Secondary, Successful, OnceOff } poller_source_t;
+    typedef enum : uint8_t { Primary, Secondary, Successful, OnceOff, Scheduled } poller_source_t;
 
 // Macro for poll_pid_t termination
 #define POLL_LIST_END                   { 0, 0, 0x00, 0x00, { 0, 0, 0 }, 0, 0 }
@@ -173,6 +212,9 @@ class OvmsPoller : public InternalRamAllocated {
         virtual void IncomingPollError(const OvmsPoller::poll_job_t &job, uint16_t code);
         virtual void IncomingPollTxCallback(const OvmsPoller::poll_job_t &job, bool success);
         virtual bool Ready() = 0;
+        // Reassembled responses (see OvmsVehicle::PollSetReassembly):
+        virtual bool PollReassembly() { return false; }
+        virtual void IncomingPollResponse(const OvmsPoller::poll_job_t &job, const OvmsPollReply &reply) { }
       };
     enum class OvmsNextPollResult
       {
@@ -217,6 +259,13 @@ class OvmsPoller : public InternalRamAllocated {
         /// Send on an imcoming TX reply
         virtual void IncomingTxReply(const OvmsPoller::poll_job_t& job, bool success);
 
+        /** Return true to receive complete responses by IncomingReply()
+          instead of the single frames by IncomingPacket().
+         */
+        virtual bool Reassembly();
+        /// Process a complete (reassembled) response.
+        virtual void IncomingReply(const OvmsPoller::poll_job_t& job, const OvmsPollReply &reply);
+
         /// Called when run is finished to determine what happens next.
         virtual SeriesStatus FinishRun() = 0;
 
@@ -234,6 +283,28 @@ class OvmsPoller : public InternalRamAllocated {
         /** Return true if this series is ok to run.
          */
         virtual bool Ready();
+
+        /** Return true if requests from this series may be kept in flight
+          concurrently to different ECUs (see PollSetPipelining).
+         */
+        virtual bool CanPipeline();
+
+        /** Get an entry with a due millisecond deadline outside of a poll run.
+          Called between runs, returns false if nothing is due.
+         */
+        virtual bool NextDueEntry(poll_pid_t &entry, uint8_t mybus, uint8_t pollstate);
+
+        /** Get the next millisecond deadline of the series (see PollerTimeMs()).
+          Returns false if the series has no sub-second entries.
+         */
+        virtual bool NextDueTime(uint32_t &due);
+
+        /** Get another due entry for a multi DID request (see PollSetBatching).
+          Called right after an entry has been fetched, only entries passing
+          accept() may be returned. Returns false if there is none.
+         */
+        virtual bool NextBatchEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate,
+          const std::function<bool(const poll_pid_t&)> &accept);
       };
 
     /// Named element in the series double-linked list.
@@ -258,6 +329,10 @@ class OvmsPoller : public InternalRamAllocated {
         poll_series_t *m_first, *m_last;
         // Current poll entry.
         poll_series_t *m_iter;
+        // Series the last entry was fetched from.
+        poll_series_t *m_found;
+        // Response reassembly buffer (VWTP)
+        OvmsPollReply m_reply;
 
         // Remove an item out of the linked list.
         void Remove( poll_series_t *iter);
@@ -299,6 +374,9 @@ class OvmsPoller : public InternalRamAllocated {
         /// Get the next poll entry
         OvmsPoller::OvmsNextPollResult NextPollEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate);
 
+        /// Get the next millisecond deadline of all series
+        bool NextDueTime(uint32_t &due);
+
         /// Are there any lists that have active entries?
         bool HasPollList();
 
@@ -309,6 +387,12 @@ class OvmsPoller : public InternalRamAllocated {
           return (m_iter != nullptr) && (m_iter->is_blocking) && (m_iter->series != nullptr);
           }
 
+        /// Get the current series (the one the last entry was fetched from)
+        std::shared_ptr<PollSeriesEntry> CurrentSeries()
+          {
+          return (m_found != nullptr) ? m_found->series : nullptr;
+          }
+
         /** Return true if this series has entries to retry/redo.
           This should mean that the list has been finished at least once,
           but also that the remaining todo don't NEED to be done before moving on.
@@ -329,7 +413,29 @@ class OvmsPoller : public InternalRamAllocated {
         uint8_t m_defaultbus;
 
         const poll_pid_t* m_poll_plist; // Head of poll list
-        const poll_pid_t* m_poll_plcur; // Poll list loop cursor
+
+        // Scheduling state per poll list entry:
+        typedef struct
+          {
+          uint32_t due;         // Next deadline [ms] of sub-second entries
+          bool scheduled;       // due is valid
+          bool done;            // Tick based entry polled in this run
+          int8_t priority;      // See OvmsPollers::PollSetPidHint()
+          std::vector<std::string> metrics; // Poll on demand: only if any of these has a named listener
+          } poll_sched_t;
+        std::vector<poll_sched_t> m_sched;
+        uint32_t m_hint_gen;    // Hint generation applied to m_sched
+        uint32_t m_run_start;   // Deadline of tick based entries
+        bool m_run_started;
+        bool m_run_end;         // ReachedEnd has been reported for this run
+        bool m_has_ms;          // List has sub-second entries
+        bool m_due_valid;       // m_next_due / m_due_any are up to date
+        bool m_due_any;         // Any sub-second entry scheduled in the current state
+        uint32_t m_next_due;
+
+        void UpdateHints();
+        int FetchDueEntry(uint8_t mybus, uint32_t pollticker, uint8_t pollstate, bool ticked,
+          const std::function<bool(const poll_pid_t&)> *accept = nullptr);
 
       public:
         StandardPollSeries(OvmsPoller *poller, uint16_t stateoffset = 0);
@@ -359,6 +465,15 @@ class OvmsPoller : public InternalRamAllocated {
         bool HasPollList() override;
 
         bool HasRepeat() override;
+
+        bool CanPipeline() override;
+
+        bool NextDueEntry(poll_pid_t &entry, uint8_t mybus, uint8_t pollstate) override;
+
+        bool NextDueTime(uint32_t &due) override;
+
+        bool NextBatchEntry(poll_pid_t &entry, uint8_t mybus, uint32_t pollticker, uint8_t pollstate,
+          const std::function<bool(const poll_pid_t&)> &accept) override;
       };
 
     // Standard Vehicle Poll series passing through various responses.
@@ -378,8 +493,14 @@ class OvmsPoller : public InternalRamAllocated {
         // Send on an imcoming TX reply
         void IncomingTxReply(const OvmsPoller::poll_job_t& job, bool success) override;
 
+        // Reassembled responses, if enabled by the vehicle
+        bool Reassembly() override;
+        void IncomingReply(const OvmsPoller::poll_job_t& job, const OvmsPollReply &reply) override;
+
         // Return true if this series is ok to run.
         bool Ready() override;
+
+        void Removing() override;
       };
 
     typedef std::function<void(uint16_t type, uint32_t module_sent, uint32_t module_rec, uint16_t pid, const std::string &data)> poll_success_func;
@@ -408,6 +529,9 @@ class OvmsPoller : public InternalRamAllocated {
 
         // Return true if this series has entries to retry/redo.
         bool HasRepeat() override;
+
+        // Responses are assembled in a single buffer, so no concurrent requests.
+        bool CanPipeline() override;
       };
 
     /** Base for Once off Poll series.
@@ -541,6 +665,41 @@ class OvmsPoller : public InternalRamAllocated {
     CanFrameCallback  m_poll_txcallback;      // Poller CAN TxCallback
     uint32_t          m_poll_txmsgid;         // Poller last TX CAN ID (frame MsgID)
 
+    // ISO-TP requests are processed in slots, so multiple requests to different ECUs
+    // can be in flight concurrently. Each slot holds its own ISO-TP state machine,
+    // responses are demultiplexed by their RX ID. Entries due for an ECU already busy
+    // are queued in a slot until the ECU becomes idle. VWTP channels and broadcast
+    // requests are exclusive and use m_poll / m_poll_wait resp. a single slot.
+    typedef enum : uint8_t { SlotFree = 0, SlotQueued, SlotActive } poll_slot_state_t;
+    typedef struct
+      {
+      poll_slot_state_t state;
+      uint32_t          seq;                  // Fetch sequence number (queue order)
+      bool              serial;               // Series does not allow pipelining
+      bool              collect;              // Broadcast collecting all responses (ISOTP_COLLECT)
+      poll_job_t        job;                  // Job state of this request
+      std::shared_ptr<PollSeriesEntry> series;// Series the entry was fetched from
+      const uint8_t*    tx_data;              // Payload data for multi frame request
+      uint16_t          tx_remain;            // Payload bytes remaining for multi frame request
+      uint16_t          tx_offset;            // Payload offset of multi frame request
+      uint16_t          tx_frame;             // Frame number for multi frame request
+      uint32_t          txmsgid;              // Last TX CAN ID (frame MsgID)
+      bool              wait;                 // Waiting for response frames
+      uint32_t          deadline;             // Response timeout [ms] (see PollerTimeMs)
+      int64_t           sent_us;              // Request TX time for response time stats, 0 = done
+      uint8_t           batch_cnt;            // DIDs in multi DID request, 0 = single request
+      poll_pid_t        batch_entry[VEHICLE_POLL_MAXBATCH]; // Entries combined (0 = job.entry before batching)
+      uint16_t          batch_len[VEHICLE_POLL_MAXBATCH];   // Expected response data length per DID
+      uint8_t           batch_txdata[2*(VEHICLE_POLL_MAXBATCH-1)]; // Request payload: DIDs 2…n
+      std::string       batch_rxbuf;          // Combined response (DID & data records)
+      OvmsPollReply     reply;                // Response reassembly (see PollSeriesEntry::Reassembly)
+      } poll_slot_t;
+
+    poll_slot_t       m_slots[VEHICLE_POLL_MAXSLOTS];
+    uint8_t           m_poll_pipeline;        // Concurrent requests allowed (to different ECUs), default 1
+    uint32_t          m_poll_slot_seq;        // Slot fetch sequence counter
+    bool              m_poll_scheduled;       // Scheduled send queued for due entries
+
 
   private:
     uint8_t           m_poll_sequence_max;    // Polls allowed to be sent in sequence per time tick (second), default 1, 0 = no limit
@@ -571,9 +730,61 @@ class OvmsPoller : public InternalRamAllocated {
     bool Ready();
   private:
     void PollerSend(poller_source_t source);
+    void PollerWrite(canbus* bus, CAN_frame_t* frame);
+
+    void PollerISOTPStart(poll_slot_t &slot, bool fromTicker);
+    bool PollerISOTPReceive(poll_slot_t &slot, CAN_frame_t* frame, uint32_t msgid);
+    bool PollerISOTPReceiveFrame(poll_slot_t &slot, CAN_frame_t* frame, uint32_t msgid);
+    static uint32_t PollerISOTPPhysicalId(const poll_job_t &job, uint32_t msgid);
+    static bool PollEntryCanBatch(const poll_pid_t &entry);
+    void PollerISOTPBatch(poll_slot_t &slot);
+    void PollerISOTPBatchResponse(poll_slot_t &slot);
+    void PollerISOTPBatchDeliver(poll_slot_t &slot, const poll_pid_t &entry, uint8_t* data, uint16_t length);
+
+    // Collect mode: ISO-TP reassembly state per responding ECU
+    // (collecting broadcasts are exclusive, so one table per bus suffices)
+    typedef struct
+      {
+      uint32_t msgid;         // Response ID
+      uint16_t mlframe;
+      uint16_t mloffset;
+      uint16_t mlremain;
+      bool aborted;           // Ignore further frames
+      bool extend;            // Response in progress or pending, extends the window
+      uint32_t deadline;      // Response frame timeout [ms] (see PollerTimeMs)
+      OvmsPollReply reply;    // Response reassembly
+      } poll_responder_t;
+    poll_responder_t  m_responders[VEHICLE_POLL_MAXRESPONDERS];
+    uint8_t           m_responder_cnt;
+    uint8_t           m_response_cnt;
+    uint32_t          m_collect_end;          // Collect window end [ms] (see PollerTimeMs)
+
+    static bool PollJobIsBroadcast(const poll_job_t &job)
+      {
+      return job.entry.rxmoduleid == 0;
+      }
 
-    void PollerISOTPStart(bool fromTicker);
-    bool PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid);
+    static bool PollEntryIsExclusive(const poll_pid_t &entry)
+      {
+      return entry.protocol == VWTP_20 || entry.rxmoduleid == 0;
+      }
+    poll_slot_t* PollerQueueSlot(poller_source_t source);
+    void PollerStartQueued(bool fromTicker);
+    void PollerStartSlot(poll_slot_t &slot, bool fromTicker);
+    static uint32_t PollerTimeMs();
+    uint32_t PollerSlotTimeout(const poll_slot_t &slot);
+    void PollerSlotWait(poll_slot_t &slot, uint32_t timeout_ms);
+    int PollerSlotTimeouts();
+    bool PollerNextDeadline(uint32_t &deadline);
+    bool PollerNextDue(uint32_t &due);
+    void PollerSlotDone(poll_slot_t &slot);
+    void PollerSlotPacket(poll_slot_t &slot, uint8_t* data, uint8_t length);
+    void PollerSlotError(poll_slot_t &slot, uint16_t code);
+    static bool PollerAssemble(OvmsPollReply &reply, const poll_job_t &job, const uint8_t* data, uint8_t length);
+    void PollerResetSlots();
+    bool PollerHasFreeSlot();
+    int PollerCountSlots(poll_slot_state_t state);
+    bool PollerCanFetch();
 
     void PollerVWTPStart(bool fromTicker);
     bool PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid);
@@ -619,7 +830,8 @@ class OvmsPoller : public InternalRamAllocated {
       Keepalive,
       SuccessSep,
       Shutdown,
-      ResetTimer
+      ResetTimer,
+      Pipeline
       };
     typedef struct {
         CAN_frame_t frame;
@@ -671,6 +883,7 @@ class OvmsPoller : public InternalRamAllocated {
     void PollSetResponseSeparationTime(uint8_t septime);
     void PollSetChannelKeepalive(uint16_t keepalive_seconds);
     void PollSetTimeBetweenSuccess(uint16_t time_between_ms);
+    void PollSetPipelining(uint8_t max_inflight);
 
     // TODO - Work out how to make sure these are protected. Reduce/eliminate mutex time.
     void PollSetPidList(uint8_t defaultbus, const poll_pid_t* plist, VehicleSignal *signal);
@@ -708,6 +921,7 @@ class OvmsPollers : public InternalRamAllocated {
     uint8_t           m_poll_fc_septime;      // Flow control separation time for multi frame responses
     uint16_t          m_poll_ch_keepalive;    // Seconds to keep an inactive channel (e.g. VWTP) alive (default: 60)
     uint16_t          m_poll_between_success;
+    uint8_t           m_poll_pipeline;        // Concurrent requests to different ECUs per bus, default 1
     uint32_t          m_poll_last;
 
     _Alignas(32 / CHAR_BIT)
@@ -731,7 +945,12 @@ class OvmsPollers : public InternalRamAllocated {
     void PollerTxCallback(const CAN_frame_t* frame, bool success);
     void PollerRxCallback(const CAN_frame_t* frame, bool success);
 
+    uint32_t          m_task_deadline;        // Next response deadline / due poll [ms]
+    bool              m_task_deadline_set;
+
     void PollerTask();
+    TickType_t PollerTaskWait();
+    void CheckDeadlines();
     static void OvmsPollerTask(void *pvParameters);
 
     void Queue_PollerFrame(const CAN_frame_t &frame, bool success, bool istx);
@@ -742,6 +961,8 @@ class OvmsPollers : public InternalRamAllocated {
     static void vehicle_pause_off(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void vehicle_poller_trace(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void poller_times(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void poller_batch(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void poller_batch_set(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     // OvmsPoller Object
@@ -805,6 +1026,8 @@ class OvmsPollers : public InternalRamAllocated {
       uint8_t busnumber;
       // Constructor to convert from the queue entry to the key.
       poller_key_st( const OvmsPoller::poll_queue_entry_t &entry);
+      // Constructor for frame keys (response time statistics).
+      poller_key_st( OvmsPoller::OvmsPollEntryType type, uint8_t busno, uint32_t msgid);
     } poller_key_t;
     static const uint32_t average_sep_s = 10;
     static const uint32_t average_sep_mic_s = average_sep_s * 1000000;//10s
@@ -842,6 +1065,96 @@ class OvmsPollers : public InternalRamAllocated {
     // Store for timing for different packet types.
     std::map<poller_key_t, average_value_t, poller_key_less_t> m_poll_time_stats;
 
+    // ECU response time statistics, used to derive the response timeouts.
+    static const int response_time_buckets = 12;
+    typedef struct response_time_st {
+      uint32_t txid;          // Last request TX ID
+      uint32_t count;         // Responses measured
+      uint32_t timeouts;      // Requests timed out
+      uint32_t srtt_us;       // Smoothed response time (EWMA 1/8)
+      uint32_t rttvar_us;     // Response time mean deviation (EWMA 1/4)
+      uint32_t max_us;        // Peak response time
+      uint8_t  backoff;       // Timeout doubling after consecutive timeouts
+      uint16_t hist_n;
+      uint16_t hist[response_time_buckets]; // log2 histogram [ms], aging
+
+      response_time_st()
+        : txid(0), count(0), timeouts(0), srtt_us(0), rttvar_us(0), max_us(0),
+          backoff(0), hist_n(0), hist{}
+        {
+        }
+
+      void add(uint32_t rtt_us);
+      void timeout();
+      uint32_t percentile(int pct) const;
+      uint32_t timeout_ms(uint32_t default_ms) const;
+    } response_time_t;
+    std::map<poller_key_t, response_time_t, poller_key_less_t> m_poll_response_stats;
+
+  public:
+    uint32_t ResponseTimeoutDefault();
+    uint32_t ResponseTimeout(uint8_t busno, uint32_t rxid);
+    void AddResponseTime(uint8_t busno, uint32_t txid, uint32_t rxid, uint32_t rtt_us);
+    void AddResponseTimeout(uint8_t busno, uint32_t txid, uint32_t rxid);
+    void ResponseTimesReset();
+    bool ResponseTimesTrace(OvmsWriter* writer);
+
+  protected:
+    // Poll scheduling hints by TX ID, type & PID:
+    typedef struct
+      {
+      int8_t priority;
+      std::vector<std::string> metrics;
+      } poll_hint_t;
+    OvmsMutex         m_hint_mutex;
+    std::map<uint64_t, poll_hint_t> m_poll_hints;
+    volatile uint32_t m_poll_hint_gen;
+
+    static uint64_t PollHintKey(uint32_t txmoduleid, uint16_t type, uint16_t pid)
+      {
+      return ((uint64_t)txmoduleid << 32) | ((uint32_t)type << 16) | pid;
+      }
+
+  public:
+    void PollSetPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t priority,
+      const std::vector<std::string> &metrics = std::vector<std::string>());
+    void PollClearPidHints();
+    uint32_t PollHintGeneration()
+      {
+      return m_poll_hint_gen;
+      }
+    bool GetPollPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t &priority, std::vector<std::string> &metrics);
+
+  protected:
+    // Multi DID request state by TX ID:
+    typedef struct
+      {
+      uint8_t maxdids;        // Configured max DIDs per request
+      uint8_t limit;          // Current max DIDs, reduced on negative responses (1 = off)
+      uint8_t failures;       // Consecutive response layout mismatches
+      uint32_t requests;      // Multi DID requests answered
+      uint32_t dids;          // DIDs read by multi DID requests
+      std::map<uint16_t, uint16_t> didlen; // Learned response data length by DID
+      } poll_batch_t;
+    OvmsMutex         m_batch_mutex;
+    std::map<uint32_t, poll_batch_t> m_poll_batch;
+    volatile bool     m_poll_batch_any;       // Batching configured for any ECU
+
+  public:
+    void PollSetBatching(uint32_t txmoduleid, uint8_t maxdids);
+    void PollClearBatching();
+    void PollBatchReset();
+    bool HasPollBatching()
+      {
+      return m_poll_batch_any;
+      }
+    uint8_t PollBatchLimit(uint32_t txmoduleid);
+    bool PollBatchDidLength(uint32_t txmoduleid, uint16_t did, uint16_t &length);
+    void PollBatchLearn(uint32_t txmoduleid, uint16_t did, uint16_t length);
+    void PollBatchSucceeded(uint32_t txmoduleid, int dids);
+    void PollBatchFailed(uint32_t txmoduleid, uint16_t code, const OvmsPoller::poll_pid_t* entries, int count);
+    bool PollBatchTrace(OvmsWriter* writer);
+
   public:
     void RegisterRunFinished(const std::string &name, PollCallback fn) { m_runfinished_callback.Register(name, fn);}
     void DeregisterRunFinished(const std::string &name) { m_runfinished_callback.Deregister(name);}
@@ -879,8 +1192,8 @@ class OvmsPollers : public InternalRamAllocated {
           });
       }
 
-    void Ticker1(std::string event, void* data);
-    void Ticker1_Shutdown(std::string event, void* data);
+    void Ticker1(const char* event, void* data);
+    void Ticker1_Shutdown(const char* event, void* data);
     void EventSystemShuttingDown(std::string event, void* data);
     void ConfigChanged(std::string event, void* data);
     void LoadPollerTimerConfig();
@@ -932,6 +1245,10 @@ class OvmsPollers : public InternalRamAllocated {
       {
       Queue_Command(OvmsPoller::OvmsPollCommand::SuccessSep, time_between_ms);
       }
+    void PollSetPipelining(uint8_t max_inflight)
+      {
+      Queue_Command(OvmsPoller::OvmsPollCommand::Pipeline, max_inflight);
+      }
     // signal poller
     void PollerResetThrottle();
 
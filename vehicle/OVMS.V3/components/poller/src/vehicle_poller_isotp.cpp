@@ -34,33 +34,49 @@ static const char *TAG = "vehicle-isotp";
 
 #include <stdio.h>
 #include <algorithm>
+#include "esp_timer.h"
 #include "vehicle.h"
 
 
 /**
  * PollerISOTPStart: start ISO-TP request
  */
-void OvmsPoller::PollerISOTPStart(bool fromTicker)
+void OvmsPoller::PollerISOTPStart(poll_slot_t &slot, bool fromTicker)
   {
-  if (m_poll.entry.rxmoduleid != 0)
+  poll_job_t &job = slot.job;
+  if (job.entry.rxmoduleid != 0)
     {
     // send to <moduleid>, listen to response from <rmoduleid>:
-    m_poll.moduleid_sent = m_poll.entry.txmoduleid;
-    m_poll.moduleid_low = m_poll.entry.rxmoduleid;
-    m_poll.moduleid_high = m_poll.entry.rxmoduleid;
+    job.moduleid_sent = job.entry.txmoduleid;
+    job.moduleid_low = job.entry.rxmoduleid;
+    job.moduleid_high = job.entry.rxmoduleid;
+    }
+  else if (job.protocol == ISOTP_EXTFRAME)
+    {
+    // broadcast with 29 bit IDs (ISO 15765-4 normal fixed addressing):
+    // send to 0x18db33f1, listen to all responses to our tester address:
+    job.moduleid_sent = (job.entry.txmoduleid > 0x7ff) ? job.entry.txmoduleid : 0x18db33f1;
+    job.moduleid_low = 0x18da0000 | ((job.moduleid_sent & 0xff) << 8);
+    job.moduleid_high = job.moduleid_low | 0xff;
     }
   else
     {
     // broadcast: send to 0x7df, listen to all responses:
-    m_poll.moduleid_sent = 0x7df;
-    m_poll.moduleid_low = 0x7e8;
-    m_poll.moduleid_high = 0x7ef;
+    job.moduleid_sent = 0x7df;
+    job.moduleid_low = 0x7e8;
+    job.moduleid_high = 0x7ef;
+    }
+
+  if (slot.collect)
+    {
+    m_responder_cnt = 0;
+    m_response_cnt = 0;
     }
 
   ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPStart(%s): send [bus=%" PRIu8 ", type=%02" PRIX16 ", pid=%X], expecting %03" PRIx32 "/%03" PRIx32 "-%03" PRIx32 "",
-           m_poll.bus_no, fromTicker ? "Yes" : "No",
-           m_poll.entry.pollbus, m_poll.type, m_poll.pid, m_poll.moduleid_sent,
-           m_poll.moduleid_low, m_poll.moduleid_high);
+           job.bus_no, fromTicker ? "Yes" : "No",
+           job.entry.pollbus, job.type, job.pid, job.moduleid_sent,
+           job.moduleid_low, job.moduleid_high);
 
   //
   // Assemble ISO-TP single/first frame
@@ -76,46 +92,46 @@ void OvmsPoller::PollerISOTPStart(bool fromTicker)
   uint16_t tx_datalen;            // Payload data length
   uint16_t tx_datasent;           // Payload data length sent with this frame
 
-  if (m_poll.entry.xargs.tag == POLL_TXDATA)
+  if (job.entry.xargs.tag == POLL_TXDATA)
     {
-    tx_data = m_poll.entry.xargs.data;
-    tx_datalen = m_poll.entry.xargs.datalen;
+    tx_data = job.entry.xargs.data;
+    tx_datalen = job.entry.xargs.datalen;
     }
   else
     {
-    tx_data = m_poll.entry.args.data;
-    tx_datalen = m_poll.entry.args.datalen;
+    tx_data = job.entry.args.data;
+    tx_datalen = job.entry.args.datalen;
     }
 
   CAN_frame_t txframe = {};
-  txframe.origin = m_poll.bus;
+  txframe.origin = job.bus;
   txframe.callback = &m_poll_txcallback;
   txframe.FIR.B.DLC = 8;
   std::fill_n(txframe.data.u8, sizeof_array(txframe.data.u8), 0x55);
 
-  if (m_poll.protocol == ISOTP_EXTFRAME)
+  if (job.protocol == ISOTP_EXTFRAME)
     txframe.FIR.B.FF = CAN_frame_ext;
   else
     txframe.FIR.B.FF = CAN_frame_std;
 
-  if (m_poll.protocol == ISOTP_EXTADR)
+  if (job.protocol == ISOTP_EXTADR)
     {
-    txframe.MsgID = m_poll.moduleid_sent >> 8;
-    txframe.data.u8[0] = m_poll.moduleid_sent & 0xff;
+    txframe.MsgID = job.moduleid_sent >> 8;
+    txframe.data.u8[0] = job.moduleid_sent & 0xff;
     fr_data = &txframe.data.u8[1];
     fr_maxlen = 7;
     }
   else
     {
-    txframe.MsgID = m_poll.moduleid_sent;
+    txframe.MsgID = job.moduleid_sent;
     fr_data = &txframe.data.u8[0];
     fr_maxlen = 8;
     }
 
   // Do we need to split this request into multiple frames?
-  if (POLL_TYPE_HAS_16BIT_PID(m_poll.entry.type))
+  if (POLL_TYPE_HAS_16BIT_PID(job.entry.type))
     tp_len = 3 + tx_datalen;
-  else if (POLL_TYPE_HAS_8BIT_PID(m_poll.entry.type))
+  else if (POLL_TYPE_HAS_8BIT_PID(job.entry.type))
     tp_len = 2 + tx_datalen;
   else
     tp_len = 1 + tx_datalen;
@@ -135,62 +151,180 @@ void OvmsPoller::PollerISOTPStart(bool fromTicker)
     }
 
   // Add TP data:
-  if (POLL_TYPE_HAS_16BIT_PID(m_poll.entry.type))
+  if (POLL_TYPE_HAS_16BIT_PID(job.entry.type))
     {
-    tp_data[0] = m_poll.type;
-    tp_data[1] = m_poll.pid >> 8;
-    tp_data[2] = m_poll.pid & 0xff;
+    tp_data[0] = job.type;
+    tp_data[1] = job.pid >> 8;
+    tp_data[2] = job.pid & 0xff;
     tx_datasent = LIMIT_MAX(tx_datalen, tp_datalen - 3);
     memcpy(&tp_data[3], tx_data, tx_datasent);
     }
-  else if (POLL_TYPE_HAS_8BIT_PID(m_poll.entry.type))
+  else if (POLL_TYPE_HAS_8BIT_PID(job.entry.type))
     {
-    tp_data[0] = m_poll.type;
-    tp_data[1] = m_poll.pid;
+    tp_data[0] = job.type;
+    tp_data[1] = job.pid;
     tx_datasent = LIMIT_MAX(tx_datalen, tp_datalen - 2);
     memcpy(&tp_data[2], tx_data, tx_datasent);
     }
   else
     {
-    tp_data[0] = m_poll.type;
+    tp_data[0] = job.type;
     tx_datasent = LIMIT_MAX(tx_datalen, tp_datalen - 1);
     memcpy(&tp_data[1], tx_data, tx_datasent);
     }
 
-  m_poll_txmsgid = txframe.MsgID;
-  m_poll_tx_frame = 0;
-  m_poll_tx_data = tx_data;
-  m_poll_tx_offset = tx_datasent;
-  m_poll_tx_remain = tx_datalen - tx_datasent;
-  m_poll.mlframe = 0;
-  m_poll.mloffset = 0;
-  m_poll.mlremain = 0;
-  m_poll_wait = 2;
+  slot.txmsgid = txframe.MsgID;
+  slot.tx_frame = 0;
+  slot.tx_data = tx_data;
+  slot.tx_offset = tx_datasent;
+  slot.tx_remain = tx_datalen - tx_datasent;
+  job.mlframe = 0;
+  job.mloffset = 0;
+  job.mlremain = 0;
+  PollerSlotWait(slot, slot.collect ? VEHICLE_POLL_COLLECT_WINDOW : PollerSlotTimeout(slot));
+  if (slot.collect)
+    m_collect_end = slot.deadline;
+  slot.sent_us = esp_timer_get_time();
+
+  PollerWrite(job.bus, &txframe);
+  }
+
 
-  m_poll.bus->Write(&txframe);
+/**
+ * PollerISOTPPhysicalId: derive the physical request ID of an ECU responding to a broadcast
+ */
+uint32_t OvmsPoller::PollerISOTPPhysicalId(const poll_job_t &job, uint32_t msgid)
+  {
+  if (job.protocol == ISOTP_EXTFRAME)
+    {
+    // 29 bit normal fixed addressing: swap target & source address
+    return (msgid & 0xffff0000) | ((msgid & 0xff) << 8) | ((msgid >> 8) & 0xff);
+    }
+  // Note: this only works for the SAE standard ID scheme
+  return msgid - 8;
   }
 
 
 /**
  * PollerISOTPReceive: process ISO-TP poll response frame
+ *  In collect mode, multiple ECUs may respond concurrently. Each responder gets
+ *  its own reassembly state, the slot waits for the collect window to end.
+ */
+bool OvmsPoller::PollerISOTPReceive(poll_slot_t &slot, CAN_frame_t* frame, uint32_t msgid)
+  {
+  poll_job_t &job = slot.job;
+  if (!slot.collect)
+    {
+    bool res = PollerISOTPReceiveFrame(slot, frame, msgid);
+    // Broadcast: only one multi frame response can be reassembled, so the
+    //  first ECU sending one gets the request:
+    if (res && job.mlremain && PollJobIsBroadcast(job) && job.moduleid_low != 0)
+      job.moduleid_low = job.moduleid_high = msgid;
+    return res;
+    }
+
+  if (!slot.wait)
+    return false;
+
+  // Get responder state:
+  poll_responder_t *responder = NULL;
+  for (int i = 0; i < m_responder_cnt; i++)
+    {
+    if (m_responders[i].msgid == msgid)
+      {
+      responder = &m_responders[i];
+      break;
+      }
+    }
+  if (!responder)
+    {
+    if (m_responder_cnt == VEHICLE_POLL_MAXRESPONDERS)
+      {
+      ESP_LOGW(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: too many responders, dropping response",
+        job.bus_no, msgid);
+      return false;
+      }
+    responder = &m_responders[m_responder_cnt++];
+    *responder = {};
+    responder->msgid = msgid;
+    }
+  else if (responder->aborted)
+    {
+    return false;
+    }
+
+  // Process frame with the responder state:
+  uint32_t moduleid_low = job.moduleid_low, moduleid_high = job.moduleid_high;
+  uint32_t deadline = slot.deadline;
+  job.mlframe = responder->mlframe;
+  job.mloffset = responder->mloffset;
+  job.mlremain = responder->mlremain;
+
+  bool res = PollerISOTPReceiveFrame(slot, frame, msgid);
+
+  if (res && job.moduleid_low == 0)
+    {
+    // Frame sequence error: ignore further frames from this ECU
+    responder->aborted = true;
+    job.moduleid_low = moduleid_low;
+    job.moduleid_high = moduleid_high;
+    job.mlremain = 0;
+    }
+  responder->mlframe = job.mlframe;
+  responder->mloffset = job.mloffset;
+  responder->mlremain = job.mlremain;
+
+  // Keep collecting until the window ends and no response is in progress or
+  //  pending. A completed response doesn't extend the window:
+  if (!slot.wait || responder->aborted)
+    responder->extend = false;
+  else if (job.mlremain > 0 || slot.deadline != deadline)
+    {
+    responder->extend = true;
+    responder->deadline = slot.deadline;
+    }
+  deadline = m_collect_end;
+  for (int i = 0; i < m_responder_cnt; i++)
+    {
+    if (m_responders[i].extend && (int32_t)(m_responders[i].deadline - deadline) > 0)
+      deadline = m_responders[i].deadline;
+    }
+  slot.wait = true;
+  slot.deadline = deadline;
+  return res;
+  }
+
+
+/**
+ * PollerISOTPReceiveFrame: process ISO-TP poll response frame
  */
-bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
+bool OvmsPoller::PollerISOTPReceiveFrame(poll_slot_t &slot, CAN_frame_t* frame, uint32_t msgid)
   {
+  poll_job_t &job = slot.job;
   // OvmsRecMutexLock lock(&m_poll_mutex);
   char *hexdump = NULL;
 
   // After locking the mutex, check again for poll expectance match:
-  if (!m_poll_wait || !m_polls.HasPollList() || frame->origin != m_poll.bus)
+  if (!slot.wait || !m_polls.HasPollList() || frame->origin != job.bus)
     {
-    ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: dropping expired poll response", m_poll.bus_no, msgid);
+    ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: dropping expired poll response", job.bus_no, msgid);
     return false;
     }
-  if (msgid < m_poll.moduleid_low || msgid > m_poll.moduleid_high)
+  if (msgid < job.moduleid_low || msgid > job.moduleid_high)
     {
     ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: dropping out-of-range poll response %03" PRIX32 "-%03" PRIX32,
-      m_poll.bus_no, msgid, m_poll.moduleid_low, m_poll.moduleid_high);
+      job.bus_no, msgid, job.moduleid_low, job.moduleid_high);
     return false;
     }
+
+  // Update ECU response time statistics on the first response frame:
+  if (slot.sent_us)
+    {
+    if (!PollJobIsBroadcast(job))
+      m_parent->AddResponseTime(job.bus_no, job.moduleid_sent, msgid, esp_timer_get_time() - slot.sent_us);
+    slot.sent_us = 0;
+    }
+
   // 
   // Get & validate ISO-TP meta data
   // 
@@ -207,7 +341,7 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
   uint8_t  tp_fc_framecnt;        // Flow control max frame count (0 = unlimited)
   uint8_t  tp_fc_septime = 0;     // Flow control frame separation time
 
-  if (m_poll.protocol == ISOTP_EXTADR)
+  if (job.protocol == ISOTP_EXTADR)
     {
     fr_data = &frame->data.u8[1];
     fr_maxlen = 7;
@@ -236,7 +370,7 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       break;
     case ISOTP_FT_CONSECUTIVE:
       tp_frameindex = fr_data[0] & 0x0f;
-      tp_len = m_poll.mlremain;
+      tp_len = job.mlremain;
       tp_data = &fr_data[1];
       tp_datalen = (tp_len > fr_maxlen-1) ? fr_maxlen-1 : tp_len;
       break;
@@ -260,7 +394,7 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
   // Handle TX flow control:
   if (tp_frametype == ISOTP_FT_FLOWCTRL)
     {
-    if (tp_fc_command > 2 || m_poll_tx_remain == 0)
+    if (tp_fc_command > 2 || slot.tx_remain == 0)
       {
       FormatHexDump(&hexdump, (const char*)frame->data.u8, 8, 8);
       ESP_LOGW(TAG, "PollerISOTPReceive[%03" PRIX32 "]: ignoring unexpected/invalid ISO TP flow control frame: %s",
@@ -272,12 +406,12 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
     if (tp_fc_command == 1)
       {
       // add some wait time:
-      m_poll_wait++;
+      PollerSlotWait(slot, VEHICLE_POLL_TIMEOUT_ISOTP);
       }
     else if (tp_fc_command == 2)
       {
       // abort TX:
-      m_poll_tx_remain = 0;
+      slot.tx_remain = 0;
       // (but still wait for response)
       }
     else
@@ -291,24 +425,23 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       tx_frame.origin = frame->origin;
       tx_frame.FIR.B.DLC = 8;
 
-      if (m_poll.protocol == ISOTP_EXTFRAME)
+      if (job.protocol == ISOTP_EXTFRAME)
         tx_frame.FIR.B.FF = CAN_frame_ext;
       else
         tx_frame.FIR.B.FF = CAN_frame_std;
 
-      if (m_poll.moduleid_sent == 0x7df)
+      if (PollJobIsBroadcast(job))
         {
         // broadcast request: derive module ID from response ID:
-        // (Note: this only works for the SAE standard ID scheme)
-        txid = frame->MsgID - 8;
+        txid = PollerISOTPPhysicalId(job, msgid);
         }
       else
         {
         // use known module ID:
-        txid = m_poll.moduleid_sent;
+        txid = job.moduleid_sent;
         }
 
-      if (m_poll.protocol == ISOTP_EXTADR)
+      if (job.protocol == ISOTP_EXTADR)
         {
         tx_frame.MsgID = txid >> 8;
         tx_frame.data.u8[0] = txid & 0xff;
@@ -323,19 +456,19 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
         }
 
       // Send next chunk of frames:
-      while (m_poll_tx_remain > 0)
+      while (slot.tx_remain > 0)
         {
-        ++m_poll_tx_frame;
-        tx_data[0] = (ISOTP_FT_CONSECUTIVE << 4) + (m_poll_tx_frame & 0x0f);
-        tx_datasent = LIMIT_MAX(m_poll_tx_remain, tx_datalen);
-        memcpy(&tx_data[1], m_poll_tx_data+m_poll_tx_offset, tx_datasent);
+        ++slot.tx_frame;
+        tx_data[0] = (ISOTP_FT_CONSECUTIVE << 4) + (slot.tx_frame & 0x0f);
+        tx_datasent = LIMIT_MAX(slot.tx_remain, tx_datalen);
+        memcpy(&tx_data[1], slot.tx_data+slot.tx_offset, tx_datasent);
         if (tx_datasent < tx_datalen)
           memset(&tx_data[1+tx_datasent], 0x55, tx_datalen-tx_datasent);
-        tx_frame.Write();
-        m_poll_tx_offset += tx_datasent;
-        m_poll_tx_remain -= tx_datasent;
+        PollerWrite(tx_frame.origin, &tx_frame);
+        slot.tx_offset += tx_datasent;
+        slot.tx_remain -= tx_datasent;
 
-        if (m_poll_tx_remain == 0)
+        if (slot.tx_remain == 0)
           break;
         if (tp_fc_framecnt > 0 && --tp_fc_framecnt == 0)
           break;
@@ -349,8 +482,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
           }
         }
 
-      if (m_poll_tx_remain > 0)
-        m_poll_wait = 2;
+      if (slot.tx_remain > 0)
+        PollerSlotWait(slot, VEHICLE_POLL_TIMEOUT_ISOTP);
       }
 
     return true;
@@ -362,15 +495,15 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
     {
     // Note: we tolerate an index less than the expected one, as some devices
     //  begin counting at the first consecutive frame
-    if (m_poll.mlremain == 0 || tp_frameindex > (m_poll.mlframe & 0x0f))
+    if (job.mlremain == 0 || tp_frameindex > (job.mlframe & 0x0f))
       {
       FormatHexDump(&hexdump, (const char*)frame->data.u8, 8, 8);
       ESP_LOGW(TAG, "PollerISOTPReceive[%03" PRIX32 "]: unexpected/out of sequence ISO TP frame (%d vs %d), aborting poll %02X(%X): %s",
-              msgid, tp_frameindex, m_poll.mlframe & 0x0f, m_poll.type, m_poll.pid,
+              msgid, tp_frameindex, job.mlframe & 0x0f, job.type, job.pid,
               hexdump ? hexdump : "-");
       if (hexdump) free(hexdump);
-      m_poll.moduleid_low = m_poll.moduleid_high = 0; // ignore further frames
-      m_poll_wait = 2; // give the bus time to let remaining frames pass
+      job.moduleid_low = job.moduleid_high = 0; // ignore further frames
+      PollerSlotWait(slot, PollerSlotTimeout(slot)); // give the bus time to let remaining frames pass
       return true;
       }
     }
@@ -389,8 +522,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
 
   if (tp_frametype == ISOTP_FT_CONSECUTIVE)
     {
-    response_type = 0x40+m_poll.type;
-    response_pid = m_poll.pid;
+    response_type = 0x40+job.type;
+    response_pid = job.pid;
     response_data = tp_data;
     response_datalen = tp_datalen;
     }
@@ -416,7 +549,7 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       }
     else
       {
-      response_pid = m_poll.pid;
+      response_pid = job.pid;
       response_data = &tp_data[1];
       response_datalen = tp_datalen - 1;
       }
@@ -427,63 +560,108 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
   // Process OBD/UDS payload
   // 
 
-  if (response_type == UDS_RESP_TYPE_NRC && error_type == m_poll.type)
+  if (response_type == UDS_RESP_TYPE_NRC && error_type == job.type)
     {
     // Negative Response Code:
     if (error_code == UDS_RESP_NRC_RCRRP)
       {
       // Info: requestCorrectlyReceived-ResponsePending (server busy processing the request)
       ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: got OBD/UDS info %02X(%X) code=%02X (pending)",
-               m_poll.bus_no, msgid, m_poll.type, m_poll.pid, error_code);
+               job.bus_no, msgid, job.type, job.pid, error_code);
       // add some wait time:
-      m_poll_wait++;
+      PollerSlotWait(slot, VEHICLE_POLL_TIMEOUT_PENDING);
       return true;
       }
     else
       {
       // Error: forward to application:
       ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: process OBD/UDS error %02X(%X) code=%02X",
-               m_poll.bus_no, msgid, m_poll.type, m_poll.pid, error_code);
+               job.bus_no, msgid, job.type, job.pid, error_code);
       // Running single poll?
+      if (slot.batch_cnt && (error_code == UDS_RESP_NRC_IMLOIF || error_code == UDS_RESP_NRC_RTL || error_code == UDS_RESP_NRC_ROOR))
+        {
+        // Multi DID request not accepted: the DIDs are read by single
+        // requests in the next run
+        m_parent->PollBatchFailed(job.entry.txmoduleid, error_code, slot.batch_entry, slot.batch_cnt);
+        }
+      else
       {
       OvmsRecMutexLock lock(&m_poll_mutex);
-      m_poll.moduleid_rec = msgid;
-      m_poll.mlframe = 0;
-      m_poll.mloffset = 0;
-      m_poll.mlremain = 0;
-      IncomingPollError(m_poll, error_code);
+      job.moduleid_rec = msgid;
+      job.mlframe = 0;
+      job.mloffset = 0;
+      job.mlremain = 0;
+      if (slot.batch_cnt)
+        {
+        // The error applies to all DIDs requested:
+        for (int i = 0; i < slot.batch_cnt; i++)
+          {
+          job.entry = slot.batch_entry[i];
+          job.pid = job.entry.pid;
+          PollerSlotError(slot, error_code);
+          }
+        }
+      else
+        {
+        PollerSlotError(slot, error_code);
+        }
       }
       // abort:
-      m_poll.mlremain = 0;
+      job.mlremain = 0;
       }
     }
-  else if (response_type == 0x40+m_poll.type && response_pid == m_poll.pid)
+  else if (response_type == 0x40+job.type && response_pid == job.pid)
     {
     // Normal matching poll response, forward to application:
-    m_poll.mlremain = tp_len - tp_datalen;
+    job.mlremain = tp_len - tp_datalen;
     ESP_LOGD(TAG, "PollerISOTPReceive[%03" PRIX32 "]: process OBD/UDS response %02" PRIX16 "(%" PRIX16 ") frm=%u len=%u off=%u rem=%u",
-             msgid, m_poll.type, m_poll.pid,
-             m_poll.mlframe, response_datalen, m_poll.mloffset, m_poll.mlremain);
+             msgid, job.type, job.pid,
+             job.mlframe, response_datalen, job.mloffset, job.mlremain);
 
+    if (slot.batch_cnt)
+      {
+      // Multi DID response: collect the DID records, split them up when complete
+      if (tp_frametype == ISOTP_FT_CONSECUTIVE)
+        {
+        slot.batch_rxbuf.append((char*)response_data, response_datalen);
+        }
+      else
+        {
+        slot.batch_rxbuf.clear();
+        slot.batch_rxbuf.reserve(tp_len - 1);
+        slot.batch_rxbuf.append((char*)response_data - 2, response_datalen + 2);
+        }
+      if (job.mlremain == 0)
+        {
+        OvmsRecMutexLock lock(&m_poll_mutex);
+        job.moduleid_rec = msgid;
+        PollerISOTPBatchResponse(slot);
+        }
+      }
+    else
       {
       OvmsRecMutexLock lock(&m_poll_mutex);
-      m_poll.moduleid_rec = msgid;
-      m_polls.IncomingPacket(m_poll, response_data, response_datalen);
+      job.moduleid_rec = msgid;
+      PollerSlotPacket(slot, response_data, response_datalen);
       }
+
+    // Learn the response length for multi DID requests:
+    if (job.mlremain == 0 && !slot.batch_cnt && m_parent->HasPollBatching() && PollEntryCanBatch(job.entry))
+      m_parent->PollBatchLearn(job.entry.txmoduleid, job.pid, job.mloffset + response_datalen);
     }
   else
     {
     // This is most likely a late response to a previous poll, log & skip:
     FormatHexDump(&hexdump, (const char*)frame->data.u8, 8, 8);
     ESP_LOGW(TAG, "PollerISOTPReceive[%03" PRIX32 "]: OBD/UDS response type/PID mismatch, got %02X(%X) vs %02X(%X) => ignoring: %s",
-             msgid, response_type, response_pid, 0x40+m_poll.type, m_poll.pid, hexdump ? hexdump : "-");
+             msgid, response_type, response_pid, 0x40+job.type, job.pid, hexdump ? hexdump : "-");
     if (hexdump) free(hexdump);
     return false;
     }
 
 
   // Do we expect more data?
-  if (m_poll.mlremain)
+  if (job.mlremain)
     {
     if (tp_frametype == ISOTP_FT_FIRST)
       {
@@ -495,24 +673,23 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       txframe.origin = frame->origin;
       txframe.FIR.B.DLC = 8;
 
-      if (m_poll.protocol == ISOTP_EXTFRAME)
+      if (job.protocol == ISOTP_EXTFRAME)
         txframe.FIR.B.FF = CAN_frame_ext;
       else
         txframe.FIR.B.FF = CAN_frame_std;
 
-      if (m_poll.moduleid_sent == 0x7df)
+      if (PollJobIsBroadcast(job))
         {
         // broadcast request: derive module ID from response ID:
-        // (Note: this only works for the SAE standard ID scheme)
-        txid = frame->MsgID - 8;
+        txid = PollerISOTPPhysicalId(job, msgid);
         }
       else
         {
         // use known module ID:
-        txid = m_poll.moduleid_sent;
+        txid = job.moduleid_sent;
         }
 
-      if (m_poll.protocol == ISOTP_EXTADR)
+      if (job.protocol == ISOTP_EXTADR)
         {
         txframe.MsgID = txid >> 8;
         txframe.data.u8[0] = txid & 0xff;
@@ -527,31 +704,237 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       txdata[0] = 0x30;                // flow control frame type
       txdata[1] = 0x00;                // request all frames available
       txdata[2] = m_poll_fc_septime;   // with configured separation timing (default 25 ms)
-      txframe.Write();
-      m_poll.mlframe = 1;
+      PollerWrite(txframe.origin, &txframe);
+      job.mlframe = 1;
       }
     else
       {
-      m_poll.mlframe++;
+      job.mlframe++;
       }
 
-    m_poll.mloffset += response_datalen; // next frame application payload offset
-    m_poll_wait = 2;
+    job.mloffset += response_datalen; // next frame application payload offset
+    PollerSlotWait(slot, PollerSlotTimeout(slot));
     }
   else
     {
     // Request response complete:
-    m_poll_wait = 0;
+    slot.wait = false;
     }
 
   //  If there are no more packets and
   //  If the poll was not a broadcast
   //  (with potential further responses from other devices)
-  if (m_poll.mlremain == 0 && m_poll.moduleid_sent != 0x7df )
+  if (job.mlremain == 0 && !PollJobIsBroadcast(job))
     {
-    // Succeeded - No more expected so check to send the next poll
-    PollerSucceededPollNext();
+    // Succeeded - No more expected so free the slot & check to send the next poll
+    PollerSlotDone(slot);
     }
 
   return true;
   }
+
+
+/**
+ * PollEntryCanBatch: check if an entry may be combined into a multi DID request
+ *  (UDS ReadDataByIdentifier to a single ECU without additional parameters)
+ */
+bool OvmsPoller::PollEntryCanBatch(const poll_pid_t &entry)
+  {
+  return entry.type == VEHICLE_POLL_TYPE_READDATA
+      && entry.rxmoduleid != 0
+      && entry.protocol <= ISOTP_EXTFRAME
+      && entry.args.datalen == 0;
+  }
+
+
+/**
+ * PollerISOTPBatch: add further due DIDs for the same ECU to a queued request
+ *  See OvmsPollers::PollSetBatching(). Only DIDs with a known response length
+ *  are combined, so the response can be split up again.
+ */
+void OvmsPoller::PollerISOTPBatch(poll_slot_t &slot)
+  {
+  const poll_pid_t &first = slot.job.entry;
+  slot.batch_cnt = 0;
+  uint8_t limit = m_parent->PollBatchLimit(first.txmoduleid);
+  if (limit <= 1)
+    return;
+  uint16_t length;
+  if (!m_parent->PollBatchDidLength(first.txmoduleid, first.pid, length))
+    return;
+
+  slot.batch_entry[0] = first;
+  slot.batch_len[0] = length;
+  slot.batch_cnt = 1;
+  uint32_t resplen = 1 + 2 + length;
+
+  auto accept = [&](const poll_pid_t &entry) -> bool
+    {
+    if (entry.txmoduleid != first.txmoduleid || entry.rxmoduleid != first.rxmoduleid
+        || entry.protocol != first.protocol || !PollEntryCanBatch(entry))
+      return false;
+    for (int i = 0; i < slot.batch_cnt; i++)
+      {
+      if (slot.batch_entry[i].pid == entry.pid)
+        return false;
+      }
+    uint16_t len;
+    return m_parent->PollBatchDidLength(entry.txmoduleid, entry.pid, len)
+        && resplen + 2 + len <= VEHICLE_POLL_BATCH_MAXRESP;
+    };
+
+  poll_pid_t entry;
+  while (slot.batch_cnt < limit)
+    {
+      {
+      OvmsRecMutexLock lock(&m_poll_mutex);
+      if (!slot.series || !slot.series->NextBatchEntry(entry, m_poll.bus_no, m_poll.ticker, m_poll_state, accept))
+        break;
+      }
+    if (!m_parent->PollBatchDidLength(entry.txmoduleid, entry.pid, length))
+      break; // reset meanwhile
+    slot.batch_entry[slot.batch_cnt] = entry;
+    slot.batch_len[slot.batch_cnt] = length;
+    slot.batch_cnt++;
+    resplen += 2 + length;
+    }
+
+  if (slot.batch_cnt == 1)
+    {
+    slot.batch_cnt = 0;
+    return;
+    }
+
+  // Request: 22 <DID 1> <DID 2> … <DID n>
+  for (int i = 1; i < slot.batch_cnt; i++)
+    {
+    slot.batch_txdata[2*(i-1)] = slot.batch_entry[i].pid >> 8;
+    slot.batch_txdata[2*(i-1)+1] = slot.batch_entry[i].pid & 0xff;
+    }
+  slot.job.entry.xargs.tag = POLL_TXDATA;
+  slot.job.entry.xargs.datalen = 2 * (slot.batch_cnt - 1);
+  slot.job.entry.xargs.data = slot.batch_txdata;
+  slot.batch_rxbuf.clear();
+
+  ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPBatch: %u DIDs to %03" PRIx32 ", response %" PRIu32 " bytes",
+    m_poll.bus_no, slot.batch_cnt, first.txmoduleid, resplen);
+  }
+
+
+/**
+ * PollerISOTPBatchResponse: split a complete multi DID response into the DID responses
+ *  The response consists of <DID> <data> records in request order, DIDs not
+ *  supported by the ECU may be missing (ISO 14229-1). A record is delivered
+ *  if it is followed by the next record or ends the response. The lengths of
+ *  DIDs not matching are discarded, so they are relearned by single requests.
+ */
+void OvmsPoller::PollerISOTPBatchResponse(poll_slot_t &slot)
+  {
+  poll_job_t &job = slot.job;
+  uint8_t* data = (uint8_t*) slot.batch_rxbuf.data();
+  uint16_t size = slot.batch_rxbuf.size();
+  uint16_t pos = 0;
+  int8_t rec_idx[VEHICLE_POLL_MAXBATCH];
+  uint16_t rec_pos[VEHICLE_POLL_MAXBATCH];
+  int cnt = 0, next = 0;
+  bool valid = true;
+
+  while (pos < size)
+    {
+    if (pos + 2 > size)
+      {
+      valid = false;
+      break;
+      }
+    uint16_t did = data[pos] << 8 | data[pos+1];
+    int j = next;
+    while (j < slot.batch_cnt && slot.batch_entry[j].pid != did)
+      j++;
+    if (j == slot.batch_cnt || pos + 2 + slot.batch_len[j] > size)
+      {
+      valid = false;
+      break;
+      }
+    rec_idx[cnt] = j;
+    rec_pos[cnt] = pos + 2;
+    cnt++;
+    pos += 2 + slot.batch_len[j];
+    next = j + 1;
+    }
+
+  // The last record before a mismatch is not confirmed:
+  if (!valid && cnt > 0)
+    cnt--;
+
+  ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPBatchResponse[%03" PRIX32 "]: %u bytes, %d/%u DIDs%s",
+    job.bus_no, job.moduleid_rec, size, cnt, slot.batch_cnt, valid ? "" : ", layout mismatch");
+
+  int j = 0;
+  for (int i = 0; i < cnt; i++)
+    {
+    // DIDs missing are not supported, as a single request would tell:
+    for (; valid && j < rec_idx[i]; j++)
+      {
+      job.entry = slot.batch_entry[j];
+      job.pid = job.entry.pid;
+      job.mlframe = job.mloffset = job.mlremain = 0;
+      PollerSlotError(slot, UDS_RESP_NRC_ROOR);
+      }
+    PollerISOTPBatchDeliver(slot, slot.batch_entry[rec_idx[i]], data + rec_pos[i], slot.batch_len[rec_idx[i]]);
+    j = rec_idx[i] + 1;
+    }
+
+  if (valid)
+    {
+    for (; j < slot.batch_cnt; j++)
+      {
+      job.entry = slot.batch_entry[j];
+      job.pid = job.entry.pid;
+      job.mlframe = job.mloffset = job.mlremain = 0;
+      PollerSlotError(slot, UDS_RESP_NRC_ROOR);
+      }
+    m_parent->PollBatchSucceeded(slot.batch_entry[0].txmoduleid, cnt);
+    }
+  else
+    {
+    m_parent->PollBatchFailed(slot.batch_entry[0].txmoduleid, 0, &slot.batch_entry[j], slot.batch_cnt - j);
+    }
+
+  job.mlframe = job.mloffset = job.mlremain = 0;
+  }
+
+
+/**
+ * PollerISOTPBatchDeliver: forward a DID response split from a multi DID response
+ *  The data is passed in the same chunks as if received by a single request,
+ *  so vehicle response handlers need not care about batching.
+ */
+void OvmsPoller::PollerISOTPBatchDeliver(poll_slot_t &slot, const poll_pid_t &entry, uint8_t* data, uint16_t length)
+  {
+  poll_job_t &job = slot.job;
+  uint8_t fr_maxlen = (job.protocol == ISOTP_EXTADR) ? 7 : 8;
+  uint16_t chunk;
+
+  job.entry = entry;
+  job.pid = entry.pid;
+  job.mlframe = 0;
+  job.mloffset = 0;
+
+  // Single frame / first frame:
+  if (3 + length <= fr_maxlen - 1)
+    chunk = length;
+  else
+    chunk = fr_maxlen - 2 - 3;
+  job.mlremain = length - chunk;
+  PollerSlotPacket(slot, data, chunk);
+
+  // Consecutive frames:
+  while (job.mlremain > 0)
+    {
+    job.mlframe++;
+    job.mloffset += chunk;
+    chunk = LIMIT_MAX(job.mlremain, fr_maxlen - 1);
+    job.mlremain -= chunk;
+    PollerSlotPacket(slot, data + job.mloffset, chunk);
+    }
+  }
@@ -0,0 +1,195 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Poll reply buffers: pooled reassembly of multi frame responses
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "poller-reply";
+
+#include <stdlib.h>
+#include <string.h>
+#include "ovms_malloc.h"
+#include "ovms_command.h"
+#include "vehicle_poller_reply.h"
+
+OvmsPollReplyPool MyPollReplyPool __attribute__ ((init_priority (6990)));
+
+static const uint16_t poll_reply_class_sizes[POLL_REPLY_CLASSES] = POLL_REPLY_CLASS_SIZES;
+
+
+////////////////////////////////////////////////////////////////////////
+// OvmsPollReplyPool
+////////////////////////////////////////////////////////////////////////
+
+OvmsPollReplyPool::OvmsPollReplyPool()
+  : m_allocs(0), m_hits(0), m_inuse(0)
+  {
+  }
+
+OvmsPollReplyPool::~OvmsPollReplyPool()
+  {
+  for (int i = 0; i < POLL_REPLY_CLASSES; i++)
+    {
+    for (uint8_t* buffer : m_free[i])
+      free(buffer);
+    }
+  }
+
+/**
+ * Alloc: get a buffer of the smallest size class fitting size
+ *  Returns NULL if size exceeds the largest class or on out of memory.
+ */
+uint8_t* OvmsPollReplyPool::Alloc(uint16_t size, uint16_t &capacity)
+  {
+  int cls = 0;
+  while (cls < POLL_REPLY_CLASSES && poll_reply_class_sizes[cls] < size)
+    cls++;
+  if (cls == POLL_REPLY_CLASSES)
+    return NULL;
+  capacity = poll_reply_class_sizes[cls];
+
+  uint8_t* buffer = NULL;
+    {
+    OvmsMutexLock lock(&m_mutex);
+    m_allocs++;
+    if (!m_free[cls].empty())
+      {
+      buffer = m_free[cls].back();
+      m_free[cls].pop_back();
+      m_hits++;
+      }
+    }
+  if (!buffer)
+    {
+    buffer = (uint8_t*) ExternalRamMalloc(capacity);
+    if (!buffer)
+      {
+      ESP_LOGE(TAG, "Alloc: out of memory for %u bytes", capacity);
+      return NULL;
+      }
+    }
+  OvmsMutexLock lock(&m_mutex);
+  m_inuse++;
+  return buffer;
+  }
+
+void OvmsPollReplyPool::Free(uint8_t* buffer, uint16_t capacity)
+  {
+  if (!buffer)
+    return;
+  int cls = 0;
+  while (cls < POLL_REPLY_CLASSES && poll_reply_class_sizes[cls] != capacity)
+    cls++;
+  bool pooled = false;
+    {
+    OvmsMutexLock lock(&m_mutex);
+    if (m_inuse)
+      m_inuse--;
+    if (cls < POLL_REPLY_CLASSES && m_free[cls].size() < POLL_REPLY_POOL_KEEP)
+      {
+      m_free[cls].push_back(buffer);
+      pooled = true;
+      }
+    }
+  if (!pooled)
+    free(buffer);
+  }
+
+void OvmsPollReplyPool::Status(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  writer->printf("Reply buffers: %" PRIu32 " in use, %" PRIu32 " requests, %.1f%% pooled, free:",
+    m_inuse, m_allocs, m_allocs ? 100.0f * m_hits / m_allocs : 0.0f);
+  for (int i = 0; i < POLL_REPLY_CLASSES; i++)
+    writer->printf(" %u*%u", (unsigned)m_free[i].size(), poll_reply_class_sizes[i]);
+  writer->puts("");
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// OvmsPollReply
+////////////////////////////////////////////////////////////////////////
+
+OvmsPollReply::OvmsPollReply(OvmsPollReply &&other)
+  : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+  {
+  other.m_data = NULL;
+  other.m_size = other.m_capacity = 0;
+  }
+
+OvmsPollReply& OvmsPollReply::operator=(OvmsPollReply &&other)
+  {
+  if (this != &other)
+    {
+    Release();
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    other.m_data = NULL;
+    other.m_size = other.m_capacity = 0;
+    }
+  return *this;
+  }
+
+/**
+ * Reserve: prepare the buffer for a reply of size bytes (drops the current content)
+ */
+bool OvmsPollReply::Reserve(uint16_t size)
+  {
+  m_size = 0;
+  if (m_data && m_capacity >= size && (m_capacity / 4 < size || m_capacity == poll_reply_class_sizes[0]))
+    {
+    m_size = size;
+    return true;
+    }
+  Release();
+  m_data = MyPollReplyPool.Alloc(size, m_capacity);
+  if (!m_data)
+    {
+    m_capacity = 0;
+    return false;
+    }
+  m_size = size;
+  return true;
+  }
+
+/**
+ * Write: copy a response fragment into the buffer
+ */
+bool OvmsPollReply::Write(uint16_t offset, const uint8_t* data, uint16_t length)
+  {
+  if (!m_data || (uint32_t)offset + length > m_size)
+    return false;
+  memcpy(m_data + offset, data, length);
+  return true;
+  }
+
+/**
+ * Release: return the buffer to the pool
+ */
+void OvmsPollReply::Release()
+  {
+  if (m_data)
+    MyPollReplyPool.Free(m_data, m_capacity);
+  m_data = NULL;
+  m_size = m_capacity = 0;
+  }
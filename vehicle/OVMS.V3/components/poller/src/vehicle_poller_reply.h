@@ -0,0 +1,131 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Poll reply buffers: pooled reassembly of multi frame responses
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_POLLER_REPLY_H__
+#define __VEHICLE_POLLER_REPLY_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ovms_mutex.h"
+#include "ovms_utils.h"
+
+// Reply buffer size classes [bytes], the largest covers the ISO-TP maximum:
+#define POLL_REPLY_CLASSES              4
+#define POLL_REPLY_CLASS_SIZES          { 64, 256, 1024, 4096 }
+#define POLL_REPLY_POOL_KEEP            4       // Free buffers kept per size class
+
+class OvmsWriter;
+
+/**
+ * OvmsPollReplyPool: size classed buffers for poll reply reassembly
+ *  Buffers are taken from external RAM and kept for reuse, so long replies
+ *  (e.g. BMS cell voltages) don't fragment the heap by repeated string growth.
+ */
+class OvmsPollReplyPool
+  {
+  public:
+    OvmsPollReplyPool();
+    ~OvmsPollReplyPool();
+
+  public:
+    uint8_t* Alloc(uint16_t size, uint16_t &capacity);
+    void Free(uint8_t* buffer, uint16_t capacity);
+    void Status(OvmsWriter* writer);
+
+  protected:
+    OvmsMutex             m_mutex;
+    std::vector<uint8_t*> m_free[POLL_REPLY_CLASSES];
+    uint32_t              m_allocs;     // Buffers requested
+    uint32_t              m_hits;       // … served from the pool
+    uint32_t              m_inuse;      // Buffers currently in use
+  };
+
+extern OvmsPollReplyPool MyPollReplyPool;
+
+
+/**
+ * OvmsPollReply: complete poll response payload (data following type & PID)
+ *  With reassembly enabled (see OvmsVehicle::PollSetReassembly), the poller
+ *  collects all frames of a response and passes the payload in one piece.
+ *  The buffer belongs to the poller and is reused after the callback returns,
+ *  copy the data (e.g. ToString()) if you need to keep it.
+ *
+ *  Big endian accessors:
+ *    GetUint<BYTES>(index, res) / GetInt<BYTES>(index, res) check the bounds,
+ *    U8/U16/U24/U32 & S8/S16/S32(index) return 0 if out of bounds.
+ */
+class OvmsPollReply
+  {
+  public:
+    OvmsPollReply() : m_data(NULL), m_size(0), m_capacity(0) {}
+    ~OvmsPollReply() { Release(); }
+    OvmsPollReply(const OvmsPollReply&) = delete;
+    OvmsPollReply& operator=(const OvmsPollReply&) = delete;
+    OvmsPollReply(OvmsPollReply &&other);
+    OvmsPollReply& operator=(OvmsPollReply &&other);
+
+  public:
+    bool Reserve(uint16_t size);
+    bool Write(uint16_t offset, const uint8_t* data, uint16_t length);
+    void Release();
+
+  public:
+    const uint8_t* data() const { return m_data; }
+    uint16_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool HasBytes(uint16_t index, uint16_t count) const
+      {
+      return (uint32_t)index + count <= m_size;
+      }
+    std::string ToString() const
+      {
+      return std::string((const char*)m_data, m_size);
+      }
+
+    template<uint8_t BYTES, typename UINT = uint32_t>
+    bool GetUint(uint16_t index, UINT &res) const
+      {
+      return get_uint_bytes_be<BYTES, UINT>(m_data, index, m_size, res);
+      }
+    template<uint8_t BYTES, typename INT = int32_t>
+    bool GetInt(uint16_t index, INT &res) const
+      {
+      return get_int_bytes_be<BYTES, INT>(m_data, index, m_size, res);
+      }
+
+    uint8_t U8(uint16_t index) const    { uint8_t v = 0; GetUint<1, uint8_t>(index, v); return v; }
+    uint16_t U16(uint16_t index) const  { uint16_t v = 0; GetUint<2, uint16_t>(index, v); return v; }
+    uint32_t U24(uint16_t index) const  { uint32_t v = 0; GetUint<3, uint32_t>(index, v); return v; }
+    uint32_t U32(uint16_t index) const  { uint32_t v = 0; GetUint<4, uint32_t>(index, v); return v; }
+    int8_t S8(uint16_t index) const     { int8_t v = 0; GetInt<1, int8_t>(index, v); return v; }
+    int16_t S16(uint16_t index) const   { int16_t v = 0; GetInt<2, int16_t>(index, v); return v; }
+    int32_t S32(uint16_t index) const   { int32_t v = 0; GetInt<4, int32_t>(index, v); return v; }
+
+  protected:
+    uint8_t*  m_data;
+    uint16_t  m_size;                   // Reply length
+    uint16_t  m_capacity;               // Buffer size class
+  };
+
+#endif // __VEHICLE_POLLER_REPLY_H__
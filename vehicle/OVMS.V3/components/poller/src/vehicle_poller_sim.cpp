@@ -0,0 +1,1183 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Poller virtual ECU simulator & benchmark (developer tool)
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "sdkconfig.h"
+#ifdef CONFIG_OVMS_DEV_POLLER_SIM
+
+#include "ovms_log.h"
+static const char *TAG = "poller-sim";
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "ovms_peripherals.h"
+#include "ovms_utils.h"
+#include "vehicle_poller_sim.h"
+
+#define BENCH_NAME      "!sim.bench"
+
+OvmsPollerSim MyPollerSim __attribute__ ((init_priority (7010)));
+
+
+////////////////////////////////////////////////////////////////////////
+// PollerSimBench: benchmark poll list
+////////////////////////////////////////////////////////////////////////
+
+PollerSimBench::PollerSimBench(OvmsPoller *poller)
+  : OvmsPoller::StandardPollSeries(poller),
+    m_reset(false), m_runs(0),
+    m_run_active(false), m_run_fetched(false), m_run_begin(0), m_run_pending(0)
+  {
+  ClearStats();
+  }
+
+void PollerSimBench::ClearStats()
+  {
+  m_sent = m_replies = m_errors = m_timeouts = m_corrupt = 0;
+  m_cycles = m_overruns = 0;
+  m_cycle_last = m_cycle_max = 0;
+  m_cycle_min = UINT32_MAX;
+  m_cycle_sum = 0;
+  }
+
+/**
+ * SetList: build the poll list: DIDs F000… of each virtual ECU on the bus
+ */
+void PollerSimBench::SetList(const std::vector<pollersim_ecu_t> &ecus, canbus* bus, uint8_t busno,
+  int pids, uint16_t interval, uint32_t runs)
+  {
+  m_runs = runs;
+  m_list.clear();
+  for (auto &ecu : ecus)
+    {
+    if (ecu.bus != bus)
+      continue;
+    for (int n = 0; n < pids; n++)
+      {
+      OvmsPoller::poll_pid_t entry = {};
+      entry.txmoduleid = ecu.txid;
+      entry.rxmoduleid = ecu.rxid;
+      entry.type = VEHICLE_POLL_TYPE_READDATA;
+      entry.pid = 0xF000 + n;
+      for (int i = 0; i < VEHICLE_POLL_NSTATES; i++)
+        entry.polltime[i] = interval;
+      entry.protocol = ecu.protocol;
+      m_list.push_back(entry);
+      }
+    }
+  OvmsPoller::poll_pid_t end = POLL_LIST_END;
+  m_list.push_back(end);
+  PollSetPidList(busno, m_list.data());
+  }
+
+OvmsPoller::OvmsNextPollResult PollerSimBench::NextPollEntry(OvmsPoller::poll_pid_t &entry,
+  uint8_t mybus, uint32_t pollticker, uint8_t pollstate)
+  {
+  // Apply a statistics reset between runs only:
+  if (m_reset && !m_run_active)
+    {
+    m_reset = false;
+    ClearStats();
+    }
+  if (m_runs && m_cycles >= m_runs && !m_run_active)
+    return OvmsPoller::OvmsNextPollResult::StillAtEnd;
+  auto res = OvmsPoller::StandardPollSeries::NextPollEntry(entry, mybus, pollticker, pollstate);
+  if (res == OvmsPoller::OvmsNextPollResult::FoundEntry)
+    {
+    if (!m_run_active)
+      {
+      m_run_active = true;
+      m_run_fetched = false;
+      m_run_begin = esp_timer_get_time();
+      m_run_pending = 0;
+      }
+    m_run_pending++;
+    m_sent++;
+    }
+  else if (res == OvmsPoller::OvmsNextPollResult::ReachedEnd && m_run_active && !m_run_fetched)
+    {
+    m_run_fetched = true;
+    if (m_run_pending == 0)
+      RunDone();
+    }
+  return res;
+  }
+
+void PollerSimBench::ResetList(OvmsPoller::ResetMode mode)
+  {
+  if (mode == OvmsPoller::ResetMode::PollReset && m_run_active)
+    {
+    // Previous run has not been finished by the poller:
+    m_overruns++;
+    m_run_active = false;
+    }
+  OvmsPoller::StandardPollSeries::ResetList(mode);
+  }
+
+/**
+ * RunFinished: the poller has finished the run (called on PollRunFinished of
+ *  the bench bus), requests neither answered nor failed have timed out
+ */
+void PollerSimBench::RunFinished()
+  {
+  if (!m_run_active || !m_run_fetched)
+    return;
+  m_timeouts += m_run_pending;
+  m_errors += m_run_pending;
+  m_run_pending = 0;
+  RunDone();
+  }
+
+/**
+ * RunDone: the last response of the run has been received or timed out
+ */
+void PollerSimBench::RunDone()
+  {
+  m_run_active = false;
+  uint32_t cycle_ms = (esp_timer_get_time() - m_run_begin) / 1000;
+  m_cycle_last = cycle_ms;
+  if (cycle_ms < m_cycle_min)
+    m_cycle_min = cycle_ms;
+  if (cycle_ms > m_cycle_max)
+    m_cycle_max = cycle_ms;
+  m_cycle_sum += cycle_ms;
+  m_cycles++;
+  }
+
+void PollerSimBench::RequestDone()
+  {
+  if (m_run_active && m_run_pending > 0)
+    {
+    m_run_pending--;
+    if (m_run_fetched && m_run_pending == 0)
+      RunDone();
+    }
+  }
+
+/**
+ * IncomingPacket: validate the response data pattern (see OvmsPollerSim::RequestReceived)
+ */
+void PollerSimBench::IncomingPacket(const OvmsPoller::poll_job_t& job, uint8_t* data, uint8_t length)
+  {
+  bool valid = true;
+  for (int i = 0; i < length; i++)
+    {
+    if (data[i] != (uint8_t)(job.pid + job.mloffset + i))
+      {
+      valid = false;
+      break;
+      }
+    }
+  if (!valid)
+    {
+    ESP_LOGW(TAG, "Bench: response %02X(%X) from %03" PRIX32 " invalid at offset %u",
+      job.type, job.pid, job.moduleid_rec, job.mloffset);
+    m_corrupt++;
+    }
+  if (job.mlremain == 0)
+    {
+    m_replies++;
+    RequestDone();
+    }
+  }
+
+void PollerSimBench::IncomingError(const OvmsPoller::poll_job_t& job, uint16_t code)
+  {
+  if (code == POLLSINGLE_OK)
+    return;
+  ESP_LOGD(TAG, "Bench: error %02X(%X) from %03" PRIX32 ": %s",
+    job.type, job.pid, job.moduleid_sent, OvmsPoller::PollResultCodeName((int16_t)code));
+  m_errors++;
+  RequestDone();
+  }
+
+void PollerSimBench::Status(OvmsWriter* writer, uint64_t cpu_us)
+  {
+  writer->printf("Benchmark: %u requests per run, %" PRIu32 " runs, %" PRIu32 " overruns\n",
+    (unsigned) (m_list.size() - 1), m_cycles, m_overruns);
+  writer->printf("  Requests: %" PRIu32 "  Replies: %" PRIu32 "  Errors: %" PRIu32
+    " (timeouts: %" PRIu32 ")  Invalid: %" PRIu32 "\n",
+    m_sent, m_replies, m_errors, m_timeouts, m_corrupt);
+  if (m_sent)
+    writer->printf("  Success rate: %.1f%%\n", (float) m_replies * 100 / m_sent);
+  if (m_cycles)
+    writer->printf("  Cycle time: last %" PRIu32 " ms, avg %" PRIu32 " ms, min %" PRIu32 " ms, max %" PRIu32 " ms\n",
+      m_cycle_last, (uint32_t) (m_cycle_sum / m_cycles), m_cycle_min, m_cycle_max);
+  writer->printf("  Poller CPU: %" PRIu64 " ms total", cpu_us / 1000);
+  if (m_replies)
+    writer->printf(", %.1f us per reply", (float) cpu_us / m_replies);
+  writer->puts("");
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// OvmsPollerSim: virtual ECUs
+////////////////////////////////////////////////////////////////////////
+
+OvmsPollerSim::OvmsPollerSim()
+  : m_busmask(0), m_queue(NULL), m_task(NULL), m_overflows(0),
+    m_bench_bus(NULL), m_bench_busno(0), m_cpu_us(0)
+  {
+  ESP_LOGI(TAG, "Initialising Poller Simulator (7010)");
+
+  OvmsCommand* cmd_poller = MyCommandApp.RegisterCommand("poller","OBD polling framework");
+  OvmsCommand* cmd_sim = cmd_poller->RegisterCommand("sim","Virtual ECU simulator & benchmark",shell_status);
+  cmd_sim->RegisterCommand("status","Show simulator & benchmark status",shell_status);
+  cmd_sim->RegisterCommand("ecu","Add virtual ECU",shell_ecu,
+    "[-e|-E|-v] [-s<size>] [-l<latency>] [-j<jitter>] [-r<loss>] [-d<dids>] [-n<nrc>] <bus> <txid> <rxid>\n"
+    "Give <bus> as 1…4, <txid> and <rxid> as hexadecimal CAN IDs as in the poll list,"
+    " add -e to use ISO-TP extended addressing, -E for ISO-TP extended frames (29 bit IDs)\n"
+    " or -v to use VW-TP 2.0 (txid=200, rxid=ECUID).\n"
+    "-s: response payload size in bytes (default 20)\n"
+    "-l: response latency in ms (default 20), -j: random additional latency in ms (default 0)\n"
+    "-r: response frame loss in percent (default 0)\n"
+    "-d: max DIDs per ReadDataByIdentifier (0x22) request (default 1),"
+    " -n: hexadecimal NRC for requests with more DIDs (default 13)\n"
+    "Note: the bus is taken over by the simulator, poller requests are no longer transmitted.",
+    3, 10);
+  cmd_sim->RegisterCommand("clear","Remove all virtual ECUs & stop benchmark",shell_clear);
+  cmd_sim->RegisterCommand("start","Start benchmark poll list",shell_start,
+    "[-n<pids>] [-i<interval>] [-r<runs>] <bus>\n"
+    "Polls <pids> DIDs (default 10) from each virtual ECU on <bus>"
+    " every <interval> primary ticks (default 1),"
+    " stops after <runs> runs (default: until stopped).",
+    1, 4);
+  cmd_sim->RegisterCommand("stop","Stop benchmark poll list",shell_stop);
+  cmd_sim->RegisterCommand("reset","Reset statistics",shell_reset);
+
+  MyPollers.RegisterRunFinished(TAG, [this](canbus* bus, void*)
+    {
+    std::shared_ptr<PollerSimBench> bench;
+      {
+      OvmsMutexLock lock(&m_mutex);
+      if (bus == m_bench_bus)
+        bench = m_bench;
+      }
+    if (bench)
+      bench->RunFinished();
+    });
+  }
+
+OvmsPollerSim::~OvmsPollerSim()
+  {
+  }
+
+void OvmsPollerSim::StartTask()
+  {
+  if (!m_queue)
+    m_queue = xQueueCreate(POLLER_SIM_QUEUE_SIZE, sizeof(CAN_frame_t));
+  if (!m_task)
+    xTaskCreatePinnedToCore(SimTask, "OVMS PollerSim", POLLER_SIM_STACK, (void*)this, 11, &m_task, CORE(1));
+  }
+
+void OvmsPollerSim::UpdateBusMask()
+  {
+  uint32_t mask = 0;
+  for (auto &ecu : m_ecus)
+    mask |= 1 << ecu.bus->m_busnumber;
+  m_busmask = mask;
+  }
+
+/**
+ * TxDone: report the TX result through the CAN rx task, like the drivers do
+ *  (the CAN frame ring must only be written by the rx task)
+ */
+void OvmsPollerSim::TxDone(CAN_frame_t &frame, bool success)
+  {
+  CAN_queue_msg_t msg;
+  msg.type = success ? CAN_txcallback : CAN_txfailedcallback;
+  msg.body.frame = frame;
+  msg.body.bus = frame.origin;
+  if (xQueueSend(MyCan.m_rxqueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE)
+    frame.origin->m_status.txbuf_overflow++;
+  }
+
+/**
+ * Transmit: take a frame from the poller (see OvmsPoller::PollerWrite)
+ *  Returns false if the bus is not simulated.
+ */
+bool OvmsPollerSim::Transmit(canbus* bus, const CAN_frame_t* frame)
+  {
+  if (!IsSimulated(bus) || !m_queue)
+    return false;
+  CAN_frame_t txframe = *frame;
+  txframe.origin = bus;
+  if (xQueueSend(m_queue, &txframe, 0) != pdTRUE)
+    {
+    m_overflows++;
+    TxDone(txframe, false);
+    }
+  return true;
+  }
+
+void OvmsPollerSim::SimTask(void *pvParameters)
+  {
+  OvmsPollerSim *me = (OvmsPollerSim*)pvParameters;
+  me->Task();
+  }
+
+void OvmsPollerSim::Task()
+  {
+  CAN_frame_t frame;
+  while (true)
+    {
+    // Wait for the next frame or ECU action:
+    TickType_t wait = portMAX_DELAY;
+      {
+      OvmsMutexLock lock(&m_mutex);
+      int64_t now = esp_timer_get_time();
+      for (auto &ecu : m_ecus)
+        {
+        if (ecu.state == SimIdle)
+          continue;
+        int64_t ms = (ecu.due > now) ? (ecu.due - now + 999) / 1000 : 0;
+        TickType_t ticks = (ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        if (ticks < wait)
+          wait = ticks;
+        }
+      }
+
+    if (xQueueReceive(m_queue, &frame, wait) == pdTRUE)
+      {
+      // TX done (as reported by the CAN driver):
+      TxDone(frame, true);
+      OvmsMutexLock lock(&m_mutex);
+      ProcessFrame(frame);
+      }
+
+    OvmsMutexLock lock(&m_mutex);
+    int64_t now = esp_timer_get_time();
+    for (auto &ecu : m_ecus)
+      {
+      if (ecu.state != SimIdle && ecu.due <= now)
+        Service(ecu, now);
+      }
+    }
+  }
+
+/**
+ * ProcessFrame: dispatch a poller frame to the virtual ECUs
+ */
+void OvmsPollerSim::ProcessFrame(CAN_frame_t &frame)
+  {
+  for (auto &ecu : m_ecus)
+    {
+    if (ecu.bus != frame.origin)
+      continue;
+    if (ecu.protocol == VWTP_20)
+      {
+      ProcessVWTP(ecu, frame);
+      }
+    else
+      {
+      bool functional;
+      if (MatchISOTP(ecu, frame, functional))
+        ProcessISOTP(ecu, frame, functional);
+      }
+    }
+  }
+
+/**
+ * MatchISOTP: check if the frame is addressed to the ECU
+ *  Functional requests (broadcasts) are answered by ECUs with response IDs
+ *  7e8…7ef resp. 18daf1xx.
+ */
+bool OvmsPollerSim::MatchISOTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame, bool &functional)
+  {
+  functional = false;
+  if ((ecu.protocol == ISOTP_EXTFRAME) != (frame.FIR.B.FF == CAN_frame_ext))
+    return false;
+  if (ecu.protocol == ISOTP_EXTADR)
+    return (frame.MsgID << 8 | frame.data.u8[0]) == ecu.txid;
+  if (frame.MsgID == ecu.txid)
+    return true;
+  if (ecu.protocol == ISOTP_STD)
+    functional = (frame.MsgID == 0x7df && ecu.rxid >= 0x7e8 && ecu.rxid <= 0x7ef);
+  else
+    functional = (frame.MsgID == 0x18db33f1 && (ecu.rxid & 0xffffff00) == 0x18daf100);
+  return functional;
+  }
+
+void OvmsPollerSim::ProcessISOTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame, bool functional)
+  {
+  const uint8_t* fr_data;
+  uint8_t fr_len;
+  if (ecu.protocol == ISOTP_EXTADR)
+    {
+    fr_data = &frame.data.u8[1];
+    fr_len = frame.FIR.B.DLC - 1;
+    }
+  else
+    {
+    fr_data = &frame.data.u8[0];
+    fr_len = frame.FIR.B.DLC;
+    }
+  int64_t now = esp_timer_get_time();
+
+  switch (fr_data[0] >> 4)
+    {
+    case ISOTP_FT_SINGLE:
+      {
+      uint8_t len = fr_data[0] & 0x0f;
+      if (len == 0 || len > fr_len - 1)
+        return;
+      ecu.request.assign((const char*)&fr_data[1], len);
+      RequestReceived(ecu);
+      break;
+      }
+    case ISOTP_FT_FIRST:
+      {
+      if (functional)
+        return;
+      ecu.request_len = (fr_data[0] & 0x0f) << 8 | fr_data[1];
+      ecu.request.assign((const char*)&fr_data[2], fr_len - 2);
+      ecu.rx_sn = 1;
+      ecu.state = SimReceive;
+      ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+      SendISOTPFlowControl(ecu);
+      break;
+      }
+    case ISOTP_FT_CONSECUTIVE:
+      {
+      if (ecu.state != SimReceive)
+        return;
+      if ((fr_data[0] & 0x0f) != (ecu.rx_sn & 0x0f))
+        {
+        ESP_LOGW(TAG, "ECU %03" PRIX32 ": request frame out of sequence", ecu.txid);
+        ecu.state = SimIdle;
+        return;
+        }
+      ecu.rx_sn++;
+      size_t remain = ecu.request_len - ecu.request.size();
+      ecu.request.append((const char*)&fr_data[1], LIMIT_MAX(remain, (size_t)(fr_len - 1)));
+      if (ecu.request.size() >= ecu.request_len)
+        RequestReceived(ecu);
+      else
+        ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+      break;
+      }
+    case ISOTP_FT_FLOWCTRL:
+      {
+      if (ecu.state != SimWaitFC)
+        return;
+      switch (fr_data[0] & 0x0f)
+        {
+        case 0:
+          {
+          // Continue to send:
+          uint8_t st = fr_data[2];
+          ecu.blocksize = fr_data[1];
+          ecu.blockcnt = 0;
+          if (st <= 0x7f)
+            ecu.septime = st * 1000;
+          else if (st >= 0xf1 && st <= 0xf9)
+            ecu.septime = (st - 0xf0) * 100;
+          else
+            ecu.septime = 127000;
+          ecu.state = SimSend;
+          ecu.due = now;
+          break;
+          }
+        case 1:
+          // Wait:
+          ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+          break;
+        default:
+          // Overflow/abort:
+          ecu.state = SimIdle;
+          break;
+        }
+      break;
+      }
+    default:
+      break;
+    }
+  }
+
+void OvmsPollerSim::ProcessVWTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame)
+  {
+  const uint8_t* data = frame.data.u8;
+  uint8_t len = frame.FIR.B.DLC;
+  if (frame.FIR.B.FF != CAN_frame_std || len == 0)
+    return;
+
+  // A1 parameters: block size 15, ACK timeout 100 ms, frame interval 1 ms:
+  static const uint8_t params[6] = { 0xA1, 0x0F, 0x8A, 0xFF, 0x0A, 0xFF };
+
+  if (frame.MsgID == ecu.txid)
+    {
+    // Channel setup request, accept with the RX ID offered by the client:
+    if (len != 7 || data[0] != ecu.rxid || data[1] != 0xC0)
+      return;
+    ecu.channel = true;
+    ecu.ch_txid = data[5] << 8 | data[4];
+    ecu.ch_rxid = 0x740 + ecu.rxid;
+    ecu.tx_sn = 0;
+    ecu.rx_sn = 0;
+    ecu.blocksize = 0x0F;
+    ecu.septime = 0;
+    ecu.state = SimIdle;
+    uint8_t reply[7] = { 0x00, 0xD0,
+      (uint8_t)(ecu.ch_txid & 0xff), (uint8_t)(ecu.ch_txid >> 8),
+      (uint8_t)(ecu.ch_rxid & 0xff), (uint8_t)(ecu.ch_rxid >> 8), 0x01 };
+    SendVWTPControl(ecu, ecu.txid + ecu.rxid, reply, sizeof(reply));
+    return;
+    }
+  if (!ecu.channel || frame.MsgID != ecu.ch_rxid)
+    return;
+
+  int64_t now = esp_timer_get_time();
+  uint8_t opcode = data[0];
+  if (opcode == 0xA0 || opcode == 0xA3)
+    {
+    // Channel parameters / ping:
+    if (opcode == 0xA0 && len >= 5)
+      {
+      const int timeunit[4] = { 100, 1000, 10000, 100000 };
+      ecu.blocksize = data[1];
+      ecu.septime = (data[4] & 0x3f) * timeunit[data[4] >> 6];
+      }
+    SendVWTPControl(ecu, ecu.ch_txid, params, sizeof(params));
+    }
+  else if (opcode == 0xA8)
+    {
+    // Channel close:
+    SendVWTPControl(ecu, ecu.ch_txid, data, 1);
+    ecu.channel = false;
+    ecu.state = SimIdle;
+    }
+  else if ((opcode & 0xf0) == 0xB0)
+    {
+    // ACK, continue:
+    if (ecu.state == SimWaitAck)
+      {
+      ecu.blockcnt = 0;
+      ecu.state = SimSend;
+      ecu.due = now;
+      }
+    }
+  else if ((opcode & 0xf0) == 0x90)
+    {
+    // ACK, abort:
+    ecu.state = SimIdle;
+    }
+  else if (opcode < 0x40)
+    {
+    // Data frame:
+    ecu.rx_sn = (opcode + 1) & 0x0f;
+    if (ecu.state != SimReceive)
+      {
+      if (len < 3)
+        return;
+      ecu.request_len = (data[1] & 0x0f) << 8 | data[2];
+      ecu.request.assign((const char*)&data[3], len - 3);
+      ecu.state = SimReceive;
+      }
+    else
+      {
+      ecu.request.append((const char*)&data[1], len - 1);
+      }
+    ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+
+    if ((opcode & 0xf0) <= 0x10)
+      {
+      uint8_t ack = 0xB0 | ecu.rx_sn;
+      SendVWTPControl(ecu, ecu.ch_txid, &ack, 1);
+      }
+    if (ecu.request.size() >= ecu.request_len)
+      {
+      ecu.request.resize(ecu.request_len);
+      RequestReceived(ecu);
+      }
+    }
+  }
+
+/**
+ * RequestReceived: schedule the response
+ *  The response data bytes are (PID + offset) & 0xff, validated by PollerSimBench.
+ */
+void OvmsPollerSim::RequestReceived(pollersim_ecu_t &ecu)
+  {
+  ecu.requests++;
+  if (ecu.request.empty())
+    {
+    ecu.state = SimIdle;
+    return;
+    }
+
+  uint8_t type = ecu.request[0];
+  uint16_t pid = 0;
+  ecu.response.assign(1, (char)(type + 0x40));
+  if (type == VEHICLE_POLL_TYPE_READDATA && ecu.request.size() >= 5)
+    {
+    // Multi DID request: one DID & data record per DID, or a negative response
+    size_t dids = (ecu.request.size() - 1) / 2;
+    if (dids > LIMIT_MIN(ecu.maxdids, 1))
+      {
+      ecu.response.assign(1, (char)UDS_RESP_TYPE_NRC);
+      ecu.response += (char)type;
+      ecu.response += (char)(ecu.batchnrc ? ecu.batchnrc : UDS_RESP_NRC_IMLOIF);
+      }
+    else
+      {
+      for (size_t n = 0; n < dids; n++)
+        {
+        ecu.response.append(ecu.request, 1 + 2*n, 2);
+        pid = (uint8_t)ecu.request[1 + 2*n] << 8 | (uint8_t)ecu.request[2 + 2*n];
+        for (int i = 0; i < ecu.size && ecu.response.size() < 4095; i++)
+          ecu.response += (char)(pid + i);
+        }
+      }
+    }
+  else
+    {
+    if (POLL_TYPE_HAS_16BIT_PID(type) && ecu.request.size() >= 3)
+      {
+      ecu.response.append(ecu.request, 1, 2);
+      pid = (uint8_t)ecu.request[1] << 8 | (uint8_t)ecu.request[2];
+      }
+    else if (POLL_TYPE_HAS_8BIT_PID(type) && ecu.request.size() >= 2)
+      {
+      ecu.response.append(ecu.request, 1, 1);
+      pid = (uint8_t)ecu.request[1];
+      }
+    for (int i = 0; i < ecu.size && ecu.response.size() < 4095; i++)
+      ecu.response += (char)(pid + i);
+    }
+
+  uint32_t latency = ecu.latency;
+  if (ecu.jitter)
+    latency += esp_random() % (ecu.jitter + 1);
+  ecu.offset = 0;
+  ecu.state = SimRespond;
+  ecu.due = esp_timer_get_time() + latency * 1000;
+  }
+
+/**
+ * Service: timed ECU action
+ */
+void OvmsPollerSim::Service(pollersim_ecu_t &ecu, int64_t now)
+  {
+  switch (ecu.state)
+    {
+    case SimRespond:
+    case SimSend:
+      if (ecu.protocol == VWTP_20)
+        SendVWTP(ecu, now);
+      else
+        SendISOTP(ecu, now);
+      break;
+    case SimReceive:
+    case SimWaitFC:
+    case SimWaitAck:
+      ESP_LOGD(TAG, "ECU %03" PRIX32 ": timeout in state %d", ecu.txid, ecu.state);
+      ecu.state = SimIdle;
+      break;
+    default:
+      break;
+    }
+  }
+
+void OvmsPollerSim::InitFrame(pollersim_ecu_t &ecu, CAN_frame_t &frame, uint8_t* &data, uint8_t &maxlen)
+  {
+  frame = {};
+  frame.origin = ecu.bus;
+  frame.FIR.B.DLC = 8;
+  frame.FIR.B.FF = (ecu.protocol == ISOTP_EXTFRAME) ? CAN_frame_ext : CAN_frame_std;
+  memset(frame.data.u8, 0x55, sizeof(frame.data.u8));
+  if (ecu.protocol == ISOTP_EXTADR)
+    {
+    frame.MsgID = ecu.rxid >> 8;
+    frame.data.u8[0] = ecu.rxid & 0xff;
+    data = &frame.data.u8[1];
+    maxlen = 7;
+    }
+  else
+    {
+    frame.MsgID = ecu.rxid;
+    data = &frame.data.u8[0];
+    maxlen = 8;
+    }
+  }
+
+void OvmsPollerSim::SendISOTPFlowControl(pollersim_ecu_t &ecu)
+  {
+  CAN_frame_t frame;
+  uint8_t* data;
+  uint8_t maxlen;
+  InitFrame(ecu, frame, data, maxlen);
+  data[0] = 0x30;   // continue to send
+  data[1] = 0x00;   // all frames
+  data[2] = 0x00;   // no separation time
+  SendFrame(ecu, frame, false);
+  }
+
+void OvmsPollerSim::SendISOTP(pollersim_ecu_t &ecu, int64_t now)
+  {
+  CAN_frame_t frame;
+  uint8_t* data;
+  uint8_t maxlen;
+  size_t len = ecu.response.size();
+
+  if (ecu.state == SimRespond)
+    {
+    ecu.responses++;
+    InitFrame(ecu, frame, data, maxlen);
+    if (len <= (size_t)(maxlen - 1))
+      {
+      data[0] = (ISOTP_FT_SINGLE << 4) | len;
+      memcpy(&data[1], ecu.response.data(), len);
+      ecu.state = SimIdle;
+      }
+    else
+      {
+      data[0] = (ISOTP_FT_FIRST << 4) | (len >> 8);
+      data[1] = len & 0xff;
+      memcpy(&data[2], ecu.response.data(), maxlen - 2);
+      ecu.offset = maxlen - 2;
+      ecu.tx_sn = 1;
+      ecu.state = SimWaitFC;
+      ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+      }
+    SendFrame(ecu, frame, true);
+    return;
+    }
+
+  // Consecutive frames, separation times below the tick period are sent in bursts:
+  for (int burst = 0; burst < POLLER_SIM_BURST; burst++)
+    {
+    InitFrame(ecu, frame, data, maxlen);
+    size_t chunk = LIMIT_MAX(len - ecu.offset, (size_t)(maxlen - 1));
+    data[0] = (ISOTP_FT_CONSECUTIVE << 4) | (ecu.tx_sn++ & 0x0f);
+    memcpy(&data[1], ecu.response.data() + ecu.offset, chunk);
+    ecu.offset += chunk;
+    SendFrame(ecu, frame, true);
+
+    if (ecu.offset >= len)
+      {
+      ecu.state = SimIdle;
+      return;
+      }
+    if (ecu.blocksize && ++ecu.blockcnt >= ecu.blocksize)
+      {
+      ecu.state = SimWaitFC;
+      ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+      return;
+      }
+    if (ecu.septime >= portTICK_PERIOD_MS * 1000)
+      {
+      ecu.due = now + ecu.septime;
+      return;
+      }
+    }
+  ecu.due = now + 1000;
+  }
+
+void OvmsPollerSim::SendVWTP(pollersim_ecu_t &ecu, int64_t now)
+  {
+  CAN_frame_t frame;
+  size_t len = ecu.response.size();
+
+  if (ecu.state == SimRespond)
+    {
+    ecu.responses++;
+    ecu.offset = 0;
+    ecu.blockcnt = 0;
+    ecu.state = SimSend;
+    }
+
+  for (int burst = 0; burst < POLLER_SIM_BURST; burst++)
+    {
+    frame = {};
+    frame.origin = ecu.bus;
+    frame.FIR.B.FF = CAN_frame_std;
+    frame.MsgID = ecu.ch_txid;
+    int i = 1;
+    if (ecu.offset == 0)
+      {
+      frame.data.u8[1] = (len >> 8) & 0x0f;
+      frame.data.u8[2] = len & 0xff;
+      i = 3;
+      }
+    while (i < 8 && ecu.offset < len)
+      frame.data.u8[i++] = ecu.response[ecu.offset++];
+    frame.FIR.B.DLC = i;
+
+    uint8_t opcode;
+    bool last = (ecu.offset >= len);
+    bool blockend = (ecu.blocksize && ++ecu.blockcnt >= ecu.blocksize);
+    if (last)
+      opcode = 0x10;    // last packet, waiting for ACK
+    else if (blockend)
+      opcode = 0x00;    // more packets following, waiting for ACK
+    else
+      opcode = 0x20;    // more packets following in this block
+    frame.data.u8[0] = opcode | (ecu.tx_sn++ & 0x0f);
+    SendFrame(ecu, frame, true);
+
+    if (last)
+      {
+      ecu.state = SimIdle;
+      return;
+      }
+    if (blockend)
+      {
+      ecu.state = SimWaitAck;
+      ecu.due = now + POLLER_SIM_TIMEOUT * 1000;
+      return;
+      }
+    if (ecu.septime >= portTICK_PERIOD_MS * 1000)
+      {
+      ecu.due = now + ecu.septime;
+      return;
+      }
+    }
+  ecu.due = now + 1000;
+  }
+
+void OvmsPollerSim::SendVWTPControl(pollersim_ecu_t &ecu, uint16_t msgid, const uint8_t* data, uint8_t len)
+  {
+  CAN_frame_t frame = {};
+  frame.origin = ecu.bus;
+  frame.FIR.B.FF = CAN_frame_std;
+  frame.FIR.B.DLC = len;
+  frame.MsgID = msgid;
+  memcpy(frame.data.u8, data, len);
+  SendFrame(ecu, frame, false);
+  }
+
+/**
+ * SendFrame: deliver an ECU frame to the poller
+ *  Response frames are subject to the configured loss rate.
+ */
+void OvmsPollerSim::SendFrame(pollersim_ecu_t &ecu, CAN_frame_t &frame, bool response)
+  {
+  if (response)
+    {
+    if (ecu.loss && (esp_random() % 100) < ecu.loss)
+      {
+      ecu.lost++;
+      return;
+      }
+    ecu.frames++;
+    }
+  MyCan.IncomingFrame(&frame);
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Control & status
+////////////////////////////////////////////////////////////////////////
+
+const char* OvmsPollerSim::AddEcu(const pollersim_ecu_t &ecu)
+  {
+  if (!ecu.bus)
+    return "CAN bus not available";
+  if (ecu.protocol == VWTP_20 && ecu.rxid > 0xff)
+    return "VWTP module ID must be 00…ff";
+
+  StartTask();
+  OvmsMutexLock lock(&m_mutex);
+  for (auto &cur : m_ecus)
+    {
+    if (cur.bus == ecu.bus && cur.txid == ecu.txid && cur.rxid == ecu.rxid)
+      {
+      cur = ecu;
+      return NULL;
+      }
+    }
+  if (m_ecus.size() >= POLLER_SIM_MAXECUS)
+    return "too many virtual ECUs";
+  m_ecus.push_back(ecu);
+  UpdateBusMask();
+  return NULL;
+  }
+
+void OvmsPollerSim::Clear()
+  {
+  StopBench();
+  OvmsMutexLock lock(&m_mutex);
+  m_ecus.clear();
+  UpdateBusMask();
+  }
+
+const char* OvmsPollerSim::StartBench(int busno, int pids, uint16_t interval, uint32_t runs)
+  {
+  if (busno < 1 || busno > VEHICLE_MAXBUSSES)
+    return "invalid bus";
+  if (pids < 1 || pids > 256)
+    return "invalid PID count (1…256)";
+
+  StopBench();
+
+  canbus* bus = MyPollers.GetBus(busno);
+  if (!bus)
+    bus = MyPollers.RegisterCanBus(busno, CAN_MODE_LISTEN, CAN_SPEED_500KBPS, NULL, false);
+  if (!bus)
+    return "CAN bus not available";
+  if (!IsSimulated(bus))
+    return "no virtual ECUs on this bus";
+  OvmsPoller* poller = MyPollers.GetPoller(bus, true);
+  if (!poller)
+    return "no poller available for this bus";
+
+  auto bench = std::make_shared<PollerSimBench>(poller);
+    {
+    OvmsMutexLock lock(&m_mutex);
+    bench->SetList(m_ecus, bus, busno, pids, interval, runs);
+    }
+
+  // Note: the poller may call back into the simulator, so don't hold the mutex here
+  MyPollers.PollRequest(bus, BENCH_NAME, bench);
+  MyPollers.CheckStartPollTask();
+
+  OvmsMutexLock lock(&m_mutex);
+  m_bench = bench;
+  m_bench_bus = bus;
+  m_bench_busno = busno;
+  m_cpu_us = 0;
+  return NULL;
+  }
+
+void OvmsPollerSim::StopBench()
+  {
+  canbus* bus;
+    {
+    OvmsMutexLock lock(&m_mutex);
+    bus = m_bench_bus;
+    m_bench_bus = NULL;
+    m_bench_busno = 0;
+    }
+  // The last benchmark results are kept for the status
+  if (bus)
+    MyPollers.PollRemove(bus, BENCH_NAME);
+  }
+
+void OvmsPollerSim::ResetStats()
+  {
+  OvmsMutexLock lock(&m_mutex);
+  for (auto &ecu : m_ecus)
+    ecu.requests = ecu.responses = ecu.frames = ecu.lost = 0;
+  m_overflows = 0;
+  m_cpu_us = 0;
+  if (m_bench)
+    m_bench->Reset();
+  }
+
+void OvmsPollerSim::Status(OvmsWriter* writer)
+  {
+  static const char* protocol_name[] = { "std", "extadr", "extframe" };
+  OvmsMutexLock lock(&m_mutex);
+
+  if (m_ecus.empty())
+    {
+    writer->puts("No virtual ECUs defined");
+    }
+  else
+    {
+    writer->puts("Bus  TxID      RxID      Proto     Size  Lat/Jit ms  Loss  Requests  Responses    Frames    Lost");
+    for (auto &ecu : m_ecus)
+      {
+      writer->printf("can%d %-8" PRIX32 "  %-8" PRIX32 "  %-8s %5u  %4u/%-4u  %3u%%  %8" PRIu32 "  %9" PRIu32 "  %8" PRIu32 "  %6" PRIu32 "\n",
+        ecu.bus->m_busnumber + 1, ecu.txid, ecu.rxid,
+        (ecu.protocol == VWTP_20) ? "vwtp" : protocol_name[ecu.protocol],
+        ecu.size, ecu.latency, ecu.jitter, ecu.loss,
+        ecu.requests, ecu.responses, ecu.frames, ecu.lost);
+      }
+    if (m_overflows)
+      writer->printf("Queue overflows: %" PRIu32 "\n", m_overflows);
+    }
+
+  if (!m_bench)
+    {
+    writer->puts("No benchmark run");
+    }
+  else
+    {
+    if (m_bench_busno)
+      writer->printf("Benchmark running on can%u\n", m_bench_busno);
+    else
+      writer->puts("Benchmark stopped");
+    m_bench->Status(writer, m_cpu_us);
+    }
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Shell commands
+////////////////////////////////////////////////////////////////////////
+
+void OvmsPollerSim::shell_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollerSim.Status(writer);
+  }
+
+void OvmsPollerSim::shell_ecu(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  pollersim_ecu_t ecu = {};
+  ecu.protocol = ISOTP_STD;
+  ecu.size = 20;
+  ecu.latency = 20;
+  int busno = 0;
+
+  int argpos = 0;
+  for (int i = 0; i < argc; i++)
+    {
+    if (argv[i][0] == '-')
+      {
+      switch (argv[i][1])
+        {
+        case 'e':
+          ecu.protocol = ISOTP_EXTADR;
+          break;
+        case 'E':
+          ecu.protocol = ISOTP_EXTFRAME;
+          break;
+        case 'v':
+          ecu.protocol = VWTP_20;
+          break;
+        case 's':
+          ecu.size = LIMIT_MIN(LIMIT_MAX(atoi(argv[i]+2), 4092), 0);
+          break;
+        case 'l':
+          ecu.latency = LIMIT_MIN(LIMIT_MAX(atoi(argv[i]+2), 10000), 0);
+          break;
+        case 'j':
+          ecu.jitter = LIMIT_MIN(LIMIT_MAX(atoi(argv[i]+2), 10000), 0);
+          break;
+        case 'r':
+          ecu.loss = LIMIT_MIN(LIMIT_MAX(atoi(argv[i]+2), 100), 0);
+          break;
+        case 'd':
+          ecu.maxdids = LIMIT_MIN(LIMIT_MAX(atoi(argv[i]+2), 255), 0);
+          break;
+        case 'n':
+          ecu.batchnrc = strtol(argv[i]+2, NULL, 16);
+          break;
+        default:
+          writer->printf("ERROR: unknown option '%s'\n", argv[i]);
+          return;
+        }
+      }
+    else
+      {
+      switch (++argpos)
+        {
+        case 1:
+          busno = atoi(argv[i]);
+          break;
+        case 2:
+          ecu.txid = strtol(argv[i], NULL, 16);
+          break;
+        case 3:
+          ecu.rxid = strtol(argv[i], NULL, 16);
+          break;
+        default:
+          writer->puts("ERROR: too many args");
+          return;
+        }
+      }
+    }
+  if (argpos < 3)
+    {
+    writer->puts("ERROR: too few args, need: bus txid rxid");
+    return;
+    }
+
+  std::string busname = string_format("can%d", busno);
+  ecu.bus = (canbus*)MyPcpApp.FindDeviceByName(busname.c_str());
+  const char* error = MyPollerSim.AddEcu(ecu);
+  if (error)
+    writer->printf("ERROR: %s\n", error);
+  else
+    writer->printf("Virtual ECU %" PRIX32 "/%" PRIX32 " on %s defined\n", ecu.txid, ecu.rxid, busname.c_str());
+  }
+
+void OvmsPollerSim::shell_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollerSim.Clear();
+  writer->puts("Virtual ECUs removed");
+  }
+
+void OvmsPollerSim::shell_start(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int pids = 10, interval = 1, runs = 0, busno = 0;
+  for (int i = 0; i < argc; i++)
+    {
+    if (argv[i][0] == '-')
+      {
+      switch (argv[i][1])
+        {
+        case 'n':
+          pids = atoi(argv[i]+2);
+          break;
+        case 'i':
+          interval = atoi(argv[i]+2);
+          break;
+        case 'r':
+          runs = atoi(argv[i]+2);
+          break;
+        default:
+          writer->printf("ERROR: unknown option '%s'\n", argv[i]);
+          return;
+        }
+      }
+    else
+      {
+      busno = atoi(argv[i]);
+      }
+    }
+  if (interval < 1 || interval > 3600)
+    {
+    writer->puts("ERROR: invalid interval (1…3600)");
+    return;
+    }
+
+  if (runs < 0)
+    {
+    writer->puts("ERROR: invalid run count");
+    return;
+    }
+
+  const char* error = MyPollerSim.StartBench(busno, pids, interval, runs);
+  if (error)
+    writer->printf("ERROR: %s\n", error);
+  else
+    writer->printf("Benchmark started on can%d\n", busno);
+  }
+
+void OvmsPollerSim::shell_stop(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollerSim.StopBench();
+  writer->puts("Benchmark stopped");
+  }
+
+void OvmsPollerSim::shell_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollerSim.ResetStats();
+  writer->puts("Simulator statistics reset");
+  }
+
+#endif // CONFIG_OVMS_DEV_POLLER_SIM
@@ -0,0 +1,236 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Poller virtual ECU simulator & benchmark (developer tool)
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_POLLER_SIM_H__
+#define __VEHICLE_POLLER_SIM_H__
+
+#include "sdkconfig.h"
+#ifdef CONFIG_OVMS_DEV_POLLER_SIM
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "ovms_mutex.h"
+#include "ovms_command.h"
+#include "can.h"
+#include "vehicle_poller.h"
+
+// The simulator answers the poller in place of the CAN bus: frames the poller
+// transmits on a simulated bus are passed to the virtual ECUs (see
+// OvmsPoller::PollerWrite), responses are injected via MyCan.IncomingFrame().
+// Timing has FreeRTOS tick resolution (10 ms on the device, 1 ms on the host,
+// see tests/host/test_poller_sim.cpp).
+
+#define POLLER_SIM_MAXECUS        16        // Max virtual ECUs
+#define POLLER_SIM_QUEUE_SIZE     40        // Frames queued from the poller
+#define POLLER_SIM_BURST          8         // Max frames sent in a row without separation time
+#define POLLER_SIM_TIMEOUT        1000      // Wait for flow control / VWTP ACK [ms]
+#define POLLER_SIM_STACK          4096
+
+// Virtual ECU protocol state:
+typedef enum : uint8_t
+  {
+  SimIdle = 0,                              // Waiting for a request
+  SimReceive,                               // Receiving a multi frame request
+  SimRespond,                               // Response due after latency
+  SimWaitFC,                                // ISO-TP: first frame sent, waiting for flow control
+  SimSend,                                  // Sending consecutive frames
+  SimWaitAck,                               // VWTP: block sent, waiting for ACK
+  } pollersim_state_t;
+
+// Virtual ECU:
+typedef struct
+  {
+  // Configuration:
+  canbus*           bus;
+  uint32_t          txid;                   // ISO-TP: request ID / VWTP: base ID (usually 0x200)
+  uint32_t          rxid;                   // ISO-TP: response ID / VWTP: module ID
+  uint8_t           protocol;               // ISOTP_STD / ISOTP_EXTADR / ISOTP_EXTFRAME / VWTP_20
+  uint16_t          size;                   // Response payload size (bytes following type & PID)
+  uint16_t          latency;                // Response latency [ms]
+  uint16_t          jitter;                 // Random additional latency [ms]
+  uint8_t           loss;                   // Response frame loss [%]
+  uint8_t           maxdids;                // UDS 0x22: max DIDs per request (0 = 1)
+  uint8_t           batchnrc;               // UDS 0x22: NRC for more DIDs (0 = 0x13)
+
+  // Protocol state:
+  pollersim_state_t state;
+  int64_t           due;                    // Time of next action [us]
+  std::string       request;                // Request (type, PID & data)
+  uint16_t          request_len;            // Expected request length
+  uint8_t           rx_sn;                  // Next RX sequence number
+  std::string       response;               // Response (type, PID & data)
+  uint16_t          offset;                 // Response bytes sent
+  uint8_t           tx_sn;                  // TX sequence number
+  uint8_t           blocksize;              // Frames per block (0 = unlimited)
+  uint8_t           blockcnt;               // Frames sent in current block
+  uint32_t          septime;                // Separation time [us]
+  bool              channel;                // VWTP channel open
+  uint16_t          ch_txid;                // VWTP channel ID we transmit on
+  uint16_t          ch_rxid;                // VWTP channel ID we listen to
+
+  // Statistics:
+  uint32_t          requests;
+  uint32_t          responses;
+  uint32_t          frames;                 // Response frames sent
+  uint32_t          lost;                   // Response frames dropped
+  } pollersim_ecu_t;
+
+
+/**
+ * PollerSimBench: benchmark poll list
+ *  Polls a range of DIDs from each virtual ECU every <interval> primary ticks,
+ *  validates the responses and measures the poll cycle time, i.e. the time
+ *  from the first request of a run until all responses have been received.
+ *  With a run limit, polling stops after <runs> runs have been measured.
+ */
+class PollerSimBench : public OvmsPoller::StandardPollSeries
+  {
+  public:
+    PollerSimBench(OvmsPoller *poller);
+
+    void SetList(const std::vector<pollersim_ecu_t> &ecus, canbus* bus, uint8_t busno,
+      int pids, uint16_t interval, uint32_t runs);
+    void Reset() { m_reset = true; }
+    void RunFinished();
+    void Status(OvmsWriter* writer, uint64_t cpu_us);
+
+    OvmsPoller::OvmsNextPollResult NextPollEntry(OvmsPoller::poll_pid_t &entry, uint8_t mybus,
+      uint32_t pollticker, uint8_t pollstate) override;
+    void ResetList(OvmsPoller::ResetMode mode) override;
+    void IncomingPacket(const OvmsPoller::poll_job_t& job, uint8_t* data, uint8_t length) override;
+    void IncomingError(const OvmsPoller::poll_job_t& job, uint16_t code) override;
+
+  protected:
+    void RequestDone();
+    void RunDone();
+    void ClearStats();
+
+  protected:
+    std::vector<OvmsPoller::poll_pid_t> m_list;
+    bool              m_reset;
+    uint32_t          m_runs;               // Run limit, 0 = unlimited
+
+    // Current run:
+    bool              m_run_active;
+    bool              m_run_fetched;        // All due entries have been sent
+    int64_t           m_run_begin;
+    uint32_t          m_run_pending;        // Requests awaiting response
+
+  public:
+    // Statistics:
+    uint32_t          m_sent;
+    uint32_t          m_replies;
+    uint32_t          m_errors;
+    uint32_t          m_timeouts;
+    uint32_t          m_corrupt;            // Response data/length mismatch
+    uint32_t          m_cycles;
+    uint32_t          m_overruns;           // Runs not finished by the next tick
+    uint32_t          m_cycle_last;         // [ms]
+    uint32_t          m_cycle_min;
+    uint32_t          m_cycle_max;
+    uint64_t          m_cycle_sum;
+  };
+
+
+class OvmsPollerSim
+  {
+  public:
+    OvmsPollerSim();
+    ~OvmsPollerSim();
+
+  public:
+    bool IsSimulated(canbus* bus)
+      {
+      return bus && (m_busmask & (1 << bus->m_busnumber)) != 0;
+      }
+    bool Transmit(canbus* bus, const CAN_frame_t* frame);
+    void AddPollerTime(uint8_t busno, uint32_t time_us)
+      {
+      if (busno && busno == m_bench_busno)
+        m_cpu_us += time_us;
+      }
+
+  public:
+    const char* AddEcu(const pollersim_ecu_t &ecu);
+    void Clear();
+    const char* StartBench(int busno, int pids, uint16_t interval, uint32_t runs=0);
+    void StopBench();
+    void ResetStats();
+    void Status(OvmsWriter* writer);
+    std::shared_ptr<PollerSimBench> GetBench()
+      {
+      OvmsMutexLock lock(&m_mutex);
+      return m_bench;
+      }
+    uint64_t GetCpuTime() { return m_cpu_us; }
+
+  protected:
+    static void SimTask(void *pvParameters);
+    void Task();
+    void StartTask();
+    void UpdateBusMask();
+    void TxDone(CAN_frame_t &frame, bool success);
+
+    void ProcessFrame(CAN_frame_t &frame);
+    bool MatchISOTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame, bool &functional);
+    void ProcessISOTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame, bool functional);
+    void ProcessVWTP(pollersim_ecu_t &ecu, const CAN_frame_t &frame);
+    void RequestReceived(pollersim_ecu_t &ecu);
+    void Service(pollersim_ecu_t &ecu, int64_t now);
+    void SendISOTP(pollersim_ecu_t &ecu, int64_t now);
+    void SendVWTP(pollersim_ecu_t &ecu, int64_t now);
+    void SendISOTPFlowControl(pollersim_ecu_t &ecu);
+    void SendVWTPControl(pollersim_ecu_t &ecu, uint16_t msgid, const uint8_t* data, uint8_t len);
+    void InitFrame(pollersim_ecu_t &ecu, CAN_frame_t &frame, uint8_t* &data, uint8_t &maxlen);
+    void SendFrame(pollersim_ecu_t &ecu, CAN_frame_t &frame, bool response);
+
+  protected:
+    OvmsMutex         m_mutex;
+    std::vector<pollersim_ecu_t> m_ecus;
+    volatile uint32_t m_busmask;            // Simulated buses (bit = canbus::m_busnumber)
+    QueueHandle_t     m_queue;
+    TaskHandle_t      m_task;
+    uint32_t          m_overflows;          // Frames dropped on queue overflow
+
+    std::shared_ptr<PollerSimBench> m_bench;
+    canbus*           m_bench_bus;
+    volatile uint8_t  m_bench_busno;
+    uint64_t          m_cpu_us;             // Poller task time spent on the bench bus
+
+  public:
+    static void shell_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_ecu(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_start(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_stop(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+  };
+
+extern OvmsPollerSim MyPollerSim;
+
+#endif // CONFIG_OVMS_DEV_POLLER_SIM
+#endif // __VEHICLE_POLLER_SIM_H__
@@ -140,7 +140,7 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
         m_poll_wait = 2;
         m_poll_vwtp.state = VWTP_ChannelSetup;
         m_poll_vwtp.lastused = monotonictime;
-        m_poll_vwtp.bus->Write(&txframe);
+        PollerWrite(m_poll_vwtp.bus, &txframe);
         }
       break;
       }
@@ -166,7 +166,7 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
       m_poll_wait = 2;
 
       m_poll_vwtp.state = VWTP_ChannelParams;
-      m_poll_vwtp.bus->Write(&txframe);
+      PollerWrite(m_poll_vwtp.bus, &txframe);
       break;
       }
 
@@ -186,7 +186,7 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
       m_poll_wait = 2;
 
       m_poll_vwtp.state = VWTP_ChannelClose;
-      m_poll_vwtp.bus->Write(&txframe);
+      PollerWrite(m_poll_vwtp.bus, &txframe);
       break;
       }
 
@@ -293,7 +293,7 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
 
         m_poll_vwtp.txseqnr++;
         m_poll_tx_frame++;
-        m_poll_vwtp.bus->Write(&txframe);
+        PollerWrite(m_poll_vwtp.bus, &txframe);
 
         if (m_poll_tx_remain == 0)
           break;
@@ -346,7 +346,7 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
       m_poll_vwtp.state = VWTP_Idle;
       m_poll_vwtp.lastused = monotonictime;
       m_poll_wait = 0;
-      m_poll_vwtp.bus->Write(&txframe);
+      PollerWrite(m_poll_vwtp.bus, &txframe);
       break;
       }
 
@@ -410,7 +410,7 @@ bool OvmsPoller::PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid)
     txframe.data.u8[3] = 0xFF;  // always ff
     txframe.data.u8[4] = 0x0A;  // interval between two packets:  0.1ms x 10 = 1 ms
     txframe.data.u8[5] = 0xFF;  // always ff
-    m_poll_vwtp.bus->Write(&txframe);
+    PollerWrite(m_poll_vwtp.bus, &txframe);
     };
 
   // Send ACK:
@@ -422,7 +422,7 @@ bool OvmsPoller::PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid)
     txframe.MsgID = m_poll_vwtp.txid;
     txframe.FIR.B.DLC = 1;
     txframe.data.u8[0] = 0xB0 | (m_poll_vwtp.rxseqnr & 0x0f); // ACK, continue
-    m_poll_vwtp.bus->Write(&txframe);
+    PollerWrite(m_poll_vwtp.bus, &txframe);
     };
 
 
@@ -546,7 +546,7 @@ bool OvmsPoller::PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid)
         txframe.MsgID = m_poll_vwtp.txid;
         txframe.FIR.B.DLC = 1;
         txframe.data.u8[0] = 0x90 | (m_poll_vwtp.rxseqnr & 0x0f); // ACK, abort
-        m_poll_vwtp.bus->Write(&txframe);
+        PollerWrite(m_poll_vwtp.bus, &txframe);
         }
       break;
       }
@@ -768,7 +768,7 @@ bool OvmsPoller::PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid)
       break;
     }
 
-  if (m_poll.mlremain == 0)
+  if (m_poll.mlremain == 0 && m_poll_vwtp.state == VWTP_Idle && m_poll.type != VEHICLE_POLL_TYPE_NONE)
     {
     // Succeeded - No more expected so check to send the next poll
     PollerSucceededPollNext();
@@ -44,7 +44,7 @@ powermgmt::powermgmt()
 
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&powermgmt::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&powermgmt::Ticker1, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&powermgmt::ConfigChanged, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&powermgmt::ConfigChanged, this, _1, _2));
 
@@ -84,7 +84,7 @@ void powermgmt::ConfigChanged(std::string event, void* data)
     }
   }
 
-void powermgmt::Ticker1(std::string event, void* data)
+void powermgmt::Ticker1(const char* event, void* data)
   {
   if (!m_charging)
     m_notcharging_timer++;
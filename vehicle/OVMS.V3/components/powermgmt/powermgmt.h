@@ -51,7 +51,7 @@ class powermgmt
     virtual ~powermgmt();
 
   public:
-    void Ticker1(std::string event, void* data);
+    void Ticker1(const char* event, void* data);
     void ConfigChanged(std::string event, void* data);
 
   private:
@@ -378,6 +378,7 @@ bool Pushover::SendMessageOpt( const std::string user_key, const std::string tok
 
   ESP_LOGV(TAG,"Msg: %s",http->str().c_str());
   mg_send(m_mgconn, http->str().c_str(), http->str().length());
+  MyNetManager.MongooseWakeup();
 
   delete http;
   delete post;
@@ -114,7 +114,7 @@ void re::Task()
 
   while(1)
     {
-    if (xQueueReceive(m_rxqueue, &message.frame, (portTickType)portMAX_DELAY)==pdTRUE)
+    if (m_reader.Read(&message, portMAX_DELAY))
       {
       if (MyRE != NULL) // Protect against MyRE not set (during init)
         {
@@ -285,7 +285,7 @@ std::string re::GetKey(CAN_frame_t* frame)
   }
 
 re::re(const char* name, canfilter* filter)
-  : pcp(name)
+  : pcp(name), m_reader(TAG, true)
   {
   m_filter = filter;
   m_obdii_std_min = 0;
@@ -295,18 +295,18 @@ re::re(const char* name, canfilter* filter)
   m_started = monotonictime;
   m_finished = monotonictime;
   m_mode = Analyse;
-  m_rxqueue = xQueueCreate(20,sizeof(CAN_frame_t));
   xTaskCreatePinnedToCore(RE_task, "OVMS RE", 4096, (void*)this, 5, &m_task, CORE(1));
-  MyCan.RegisterListener(m_rxqueue, true);
+  MyCan.RegisterReader(&m_reader);
+  MyCan.SetPromiscuous(TAG, true);
   }
 
 re::~re()
   {
   OvmsRecMutexLock lock(&m_mutex);
-  MyCan.DeregisterListener(m_rxqueue);
+  MyCan.DeregisterReader(&m_reader);
+  MyCan.SetPromiscuous(TAG, false);
 
   Clear();
-  vQueueDelete(m_rxqueue);
   vTaskDelete(m_task);
   if (m_filter)
     {
@@ -788,10 +788,10 @@ class REInit
   {
   public:
     REInit();
-    void Ticker1(std::string event, void* data);
+    void Ticker1(const char* event, void* data);
 } REInit  __attribute__ ((init_priority (8800)));
 
-void REInit::Ticker1(std::string event, void* data)
+void REInit::Ticker1(const char* event, void* data)
   {
   if (MyRE && MyNotify.HasReader("stream", "retools.status"))
     {
@@ -848,5 +848,5 @@ REInit::REInit()
 
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&REInit::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&REInit::Ticker1, this, _1, _2));
   }
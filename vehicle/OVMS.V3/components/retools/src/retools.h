@@ -89,7 +89,7 @@ class re : public pcp, public ExternalRamAllocated
 
   protected:
     TaskHandle_t m_task;
-    QueueHandle_t m_rxqueue;
+    canring_reader m_reader;
 
   public:
     OvmsRecMutex m_mutex;
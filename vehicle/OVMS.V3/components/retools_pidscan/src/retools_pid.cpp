@@ -303,15 +303,15 @@ OvmsReToolsPidScanner::OvmsReToolsPidScanner(
     m_lastResponseTime(0u),
     m_mfRemain(0u),
     m_task(nullptr),
-    m_rxqueue(nullptr),
+    m_reader(TAG, true),
     m_found(),
     m_foundMutex()
 {
-    m_rxqueue = xQueueCreate(20,sizeof(CAN_frame_t));
     xTaskCreatePinnedToCore(
         &OvmsReToolsPidScanner::Task, "OVMS RE PID", 4096, this, 5, &m_task, CORE(1)
     );
-    MyCan.RegisterListener(m_rxqueue, true);
+    MyCan.RegisterReader(&m_reader);
+    MyCan.SetPromiscuous(TAG, true);
     m_currentPid = m_startPid - m_pidStep;
     MyEvents.RegisterEvent(
         TAG, "ticker.1",
@@ -327,11 +327,11 @@ OvmsReToolsPidScanner::OvmsReToolsPidScanner(
 
 OvmsReToolsPidScanner::~OvmsReToolsPidScanner()
 {
-    if (m_rxqueue)
+    if (m_task)
     {
         MyEvents.DeregisterEvent(TAG);
-        MyCan.DeregisterListener(m_rxqueue);
-        vQueueDelete(m_rxqueue);
+        MyCan.DeregisterReader(&m_reader);
+        MyCan.SetPromiscuous(TAG, false);
         vTaskDelete(m_task);
         MyEvents.SignalEvent("retools.pidscan.stop", NULL);
     }
@@ -378,16 +378,14 @@ void OvmsReToolsPidScanner::Task(void *self)
 
 void OvmsReToolsPidScanner::Task()
 {
-    CAN_frame_t frame;
+    CAN_log_message_t msg;
     while (1)
     {
-        if (xQueueReceive(
-                    m_rxqueue, &frame, static_cast<portTickType>(portMAX_DELAY)
-                ) == pdTRUE)
+        if (m_reader.Read(&msg, portMAX_DELAY))
         {
-            if (frame.origin == m_bus)
+            if (msg.frame.origin == m_bus)
             {
-                IncomingPollFrame(&frame);
+                IncomingPollFrame(&msg.frame);
             }
         }
     }
@@ -101,8 +101,8 @@ class OvmsReToolsPidScanner
     uint16_t m_mfRemain;
     /// The handle to the CAN task handler
     TaskHandle_t m_task;
-    /// The handle to the CAN receive queue
-    QueueHandle_t m_rxqueue;
+    /// The CAN frame ring reader
+    canring_reader m_reader;
     /// The found PIDs and the current content
     std::vector<std::tuple<uint16_t, uint16_t, std::vector<uint8_t>>> m_found;
     /// A mutex over m_found
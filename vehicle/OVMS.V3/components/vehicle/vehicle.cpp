@@ -58,6 +58,93 @@ using namespace std::placeholders;
 
 OvmsVehicleFactory MyVehicleFactory __attribute__ ((init_priority (2000)));
 
+// Vehicle state events, interned by the OvmsVehicle constructor so signalling
+// them doesn't need a name lookup (see Housekeeping ticker events):
+enum vehicle_event_t
+  {
+  VEV_ALERT_12V_ON,
+  VEV_ALERT_12V_OFF,
+  VEV_ALERT_12V_LOW,
+  VEV_ALERT_12V_SHUTDOWN,
+  VEV_ALERT_12V_OPERATIONAL,
+  VEV_ALERT_TPMS,
+  VEV_ON,
+  VEV_OFF,
+  VEV_AWAKE,
+  VEV_ASLEEP,
+  VEV_CHARGE_START,
+  VEV_CHARGE_STOP,
+  VEV_CHARGE_PREPARE,
+  VEV_CHARGE_FINISH,
+  VEV_CHARGE_PILOT_ON,
+  VEV_CHARGE_PILOT_OFF,
+  VEV_CHARGE_TIMERMODE_ON,
+  VEV_CHARGE_TIMERMODE_OFF,
+  VEV_AUX_12V_ON,
+  VEV_AUX_12V_OFF,
+  VEV_CHARGE_12V_START,
+  VEV_CHARGE_12V_STOP,
+  VEV_LOCKED,
+  VEV_UNLOCKED,
+  VEV_VALET_ON,
+  VEV_VALET_OFF,
+  VEV_HEADLIGHTS_ON,
+  VEV_HEADLIGHTS_OFF,
+  VEV_ALARM_ON,
+  VEV_ALARM_OFF,
+  VEV_GEAR_REVERSE,
+  VEV_GEAR_FORWARD,
+  VEV_GEAR_NEUTRAL,
+  VEV_CHARGE_MODE,
+  VEV_CHARGE_STATE,
+  VEV_CHARGE_TYPE,
+  VEV_GEN_STATE,
+  VEV_GEN_TYPE,
+  VEV_COUNT
+  };
+static const char* const vehicle_event_name[VEV_COUNT] =
+  {
+  "vehicle.alert.12v.on",
+  "vehicle.alert.12v.off",
+  "vehicle.alert.12v.low",
+  "vehicle.alert.12v.shutdown",
+  "vehicle.alert.12v.operational",
+  "vehicle.alert.tpms",
+  "vehicle.on",
+  "vehicle.off",
+  "vehicle.awake",
+  "vehicle.asleep",
+  "vehicle.charge.start",
+  "vehicle.charge.stop",
+  "vehicle.charge.prepare",
+  "vehicle.charge.finish",
+  "vehicle.charge.pilot.on",
+  "vehicle.charge.pilot.off",
+  "vehicle.charge.timermode.on",
+  "vehicle.charge.timermode.off",
+  "vehicle.aux.12v.on",
+  "vehicle.aux.12v.off",
+  "vehicle.charge.12v.start",
+  "vehicle.charge.12v.stop",
+  "vehicle.locked",
+  "vehicle.unlocked",
+  "vehicle.valet.on",
+  "vehicle.valet.off",
+  "vehicle.headlights.on",
+  "vehicle.headlights.off",
+  "vehicle.alarm.on",
+  "vehicle.alarm.off",
+  "vehicle.gear.reverse",
+  "vehicle.gear.forward",
+  "vehicle.gear.neutral",
+  "vehicle.charge.mode",
+  "vehicle.charge.state",
+  "vehicle.charge.type",
+  "vehicle.gen.state",
+  "vehicle.gen.type"
+  };
+static event_id_t vehicle_event[VEV_COUNT];
+
 
 OvmsVehicleFactory::OvmsVehicleFactory()
   {
@@ -66,7 +153,7 @@ OvmsVehicleFactory::OvmsVehicleFactory()
   m_currentvehicle = NULL;
   m_currentvehicletype.clear();
 
-  MyEvents.RegisterEvent(TAG,"system.shuttingdown",std::bind(&OvmsVehicleFactory::EventSystemShuttingDown, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"system.shuttingdown",std::bind(&OvmsVehicleFactory::EventSystemShuttingDown, this, _1, _2));
 
   OvmsCommand* cmd_vehicle = MyCommandApp.RegisterCommand("vehicle","Vehicle framework", vehicle_status, "", 0, 0, false);
   cmd_vehicle->RegisterCommand("module","Set (or clear) vehicle module",vehicle_module,"<type>",0,1,true,vehicle_validate);
@@ -172,14 +259,14 @@ OvmsVehicleFactory::~OvmsVehicleFactory()
     }
   }
 
-void OvmsVehicleFactory::EventSystemShuttingDown(std::string event, void* data)
+void OvmsVehicleFactory::EventSystemShuttingDown(const char* event, void* data)
   {
   MyBoot.ShutdownPending(TAG);
-  MyEvents.RegisterEvent(CHECK_SHUTDOWN_TAG,"ticker.1",std::bind(&OvmsVehicleFactory::EventTicker1ShuttingDown, this, _1, _2));
+  MyEvents.RegisterEventCallback(CHECK_SHUTDOWN_TAG,"ticker.1",std::bind(&OvmsVehicleFactory::EventTicker1ShuttingDown, this, _1, _2));
   DoClearVehicle(false, false, false/*dont wait*/);
   }
 
-void OvmsVehicleFactory::EventTicker1ShuttingDown(std::string event, void* data)
+void OvmsVehicleFactory::EventTicker1ShuttingDown(const char* event, void* data)
   {
   bool iscleared = true;
   auto it = m_pending_shutdown.begin();
@@ -248,7 +335,7 @@ void OvmsVehicleFactory::DoClearVehicle( bool clearName, bool sendEvent, bool wa
       if (m_pending_shutdown.empty())
         {
         MyEvents.DeregisterEvent(CHECK_SHUTDOWN_TAG);
-        MyEvents.RegisterEvent(CHECK_SHUTDOWN_TAG,"ticker.1",std::bind(&OvmsVehicleFactory::EventTicker1ShuttingDown, this, _1, _2));
+        MyEvents.RegisterEventCallback(CHECK_SHUTDOWN_TAG,"ticker.1",std::bind(&OvmsVehicleFactory::EventTicker1ShuttingDown, this, _1, _2));
         }
       m_pending_shutdown.push_back(vehicle);
       }
@@ -307,6 +394,8 @@ const char* OvmsVehicleFactory::ActiveVehicleShortName()
 
 OvmsVehicle::OvmsVehicle()
   {
+  for (int i = 0; i < VEV_COUNT; i++)
+    vehicle_event[i] = MyEvents.GetEventId(vehicle_event_name[i]);
 
   m_is_shutdown = false;
 
@@ -314,6 +403,9 @@ OvmsVehicle::OvmsVehicle()
   m_can2 = NULL;
   m_can3 = NULL;
   m_can4 = NULL;
+  m_can_acceptance = 0;
+  m_can_acceptance_enable = false;
+  m_can_acceptance_update = false;
 
   m_last_chargetime = 0;
   m_last_drivetime = 0;
@@ -344,6 +436,7 @@ OvmsVehicle::OvmsVehicle()
 #ifdef CONFIG_OVMS_COMP_POLLER
   m_poll_state = 0;
   m_pollsignal = nullptr;
+  m_poll_reassembly = false;
 
   // Poll parameters.
   PollSetThrottling(1);
@@ -351,6 +444,8 @@ OvmsVehicle::OvmsVehicle()
   PollSetResponseSeparationTime(25);
   // channel keepalive default: 60 seconds
   PollSetChannelKeepalive(60);
+  // no concurrent requests by default
+  PollSetPipelining(1);
 #endif
 
   m_bms_voltages = NULL;
@@ -391,6 +486,9 @@ OvmsVehicle::OvmsVehicle()
   m_bms_defthr_valert     = BMS_DEFTHR_VALERT;
   m_bms_defthr_twarn      = BMS_DEFTHR_TWARN;
   m_bms_defthr_talert     = BMS_DEFTHR_TALERT;
+  BmsReadThresholds();
+  m_bms_vdirty_first = m_bms_tdirty_first = -1;
+  m_bms_vdirty_last = m_bms_tdirty_last = -1;
 
   m_bms_vlog_last = 0;
   m_bms_tlog_last = 0;
@@ -422,10 +520,10 @@ OvmsVehicle::OvmsVehicle()
   MyPollers.RegisterPollStateTicker(TAG, std::bind(&OvmsVehicle::PollerStateTickerNotify, this, _1, _2));
 #endif
 
-  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsVehicle::VehicleTicker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&OvmsVehicle::VehicleTicker1, this, _1, _2));
 
-  MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsVehicle::VehicleConfigChanged, this, _1, _2));
-  MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&OvmsVehicle::VehicleConfigChanged, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "config.changed", std::bind(&OvmsVehicle::VehicleConfigChanged, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "config.mounted", std::bind(&OvmsVehicle::VehicleConfigChanged, this, _1, _2));
   VehicleConfigChanged("config.mounted", NULL);
 
   MyMetrics.RegisterListener(TAG, "*", std::bind(&OvmsVehicle::MetricModified, this, _1));
@@ -542,6 +640,18 @@ void OvmsVehicle::ShuttingDown()
   if (m_can4) m_can4->SetPowerMode(Off);
 
 #endif
+  // Disable acceptance filtering & drop our ranges, the next vehicle may need
+  // other IDs (ranges of other consumers like CANopen are kept):
+  canbus* buses[4] = { m_can1, m_can2, m_can3, m_can4 };
+  for (int i = 0; i < 4; i++)
+    {
+    if (buses[i])
+      {
+      buses[i]->EnableAcceptance(false);
+      buses[i]->RemoveAcceptance(TAG);
+      }
+    }
+
   MyEvents.DeregisterEvent(TAG);
   MyMetrics.DeregisterListener(TAG);
   }
@@ -619,6 +729,17 @@ void OvmsVehicle::OvmsVehicleSignal::IncomingPollTxCallback(const OvmsPoller::po
     m_parent->IncomingPollTxCallback(job, success);
   }
 
+bool OvmsVehicle::OvmsVehicleSignal::PollReassembly()
+  {
+  return m_parent->m_poll_reassembly;
+  }
+
+void OvmsVehicle::OvmsVehicleSignal::IncomingPollResponse(const OvmsPoller::poll_job_t &job, const OvmsPollReply &reply)
+  {
+  if (Ready())
+    m_parent->IncomingPollResponse(job, reply);
+  }
+
 bool OvmsVehicle::OvmsVehicleSignal::Ready()
   {
   return m_parent->m_ready;
@@ -667,6 +788,47 @@ void OvmsVehicle::RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, db
     }
   }
 
+/**
+ * AddCanAcceptance: declare a CAN ID range processed by the vehicle module
+ *  Hardware acceptance filtering is opt-in: a vehicle declaring all IDs its
+ *  IncomingFrameCan*() handlers need for a bus enables filtering of that bus,
+ *  if the user also enables config vehicle can.acceptance. Poll responses
+ *  are registered by the poller, other consumers register their own ranges.
+ */
+void OvmsVehicle::AddCanAcceptance(int bus, uint32_t id_from, uint32_t id_to, bool extended /*=false*/)
+  {
+  canbus* can = NULL;
+  switch (bus)
+    {
+    case 1: can = m_can1; break;
+    case 2: can = m_can2; break;
+    case 3: can = m_can3; break;
+    case 4: can = m_can4; break;
+    }
+  if (!can)
+    {
+    ESP_LOGE(TAG, "AddCanAcceptance: bus %d not registered", bus);
+    return;
+    }
+  can->AddAcceptance(TAG, id_from, id_to, extended);
+  m_can_acceptance |= (1 << bus);
+  // apply on the next ticker, after all ranges have been declared:
+  m_can_acceptance_update = true;
+  }
+
+/**
+ * UpdateCanAcceptance: enable/disable filtering of the declared buses
+ */
+void OvmsVehicle::UpdateCanAcceptance()
+  {
+  canbus* buses[4] = { m_can1, m_can2, m_can3, m_can4 };
+  for (int i = 0; i < 4; i++)
+    {
+    if (buses[i])
+      buses[i]->EnableAcceptance(m_can_acceptance_enable && (m_can_acceptance & (1 << (i+1))));
+    }
+  }
+
 bool OvmsVehicle::PinCheck(const char* pin)
   {
   if (!MyConfig.IsDefined("password","pin")) return false;
@@ -684,11 +846,17 @@ void OvmsVehicle::PollerStateTickerNotify(canbus* bus, void *data)
   PollerStateTicker(bus);
   }
 
-void OvmsVehicle::VehicleTicker1(std::string event, void* data)
+void OvmsVehicle::VehicleTicker1(const char* event, void* data)
   {
   if (!m_ready)
     return;
 
+  if (m_can_acceptance_update)
+    {
+    m_can_acceptance_update = false;
+    UpdateCanAcceptance();
+    }
+
   m_ticker++;
 
 
@@ -752,6 +920,7 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
   if (m_vehicleoff_ticker > 0 && --m_vehicleoff_ticker == 0)
     NotifyVehicleOff();
 
+  m_bat_integrator.Publish();
   CalculateEfficiency();
 
   // 12V battery monitor:
@@ -786,13 +955,13 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
     if (!alert_on && volt > 0 && vref > 0 && vref-volt > alert_threshold)
       {
       StandardMetrics.ms_v_bat_12v_voltage_alert->SetValue(true);
-      MyEvents.SignalEvent("vehicle.alert.12v.on", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ALERT_12V_ON], NULL);
       if (m_autonotifications) Notify12vCritical();
       }
     else if (alert_on && volt > 0 && vref > 0 && vref-volt < alert_threshold*0.6)
       {
       StandardMetrics.ms_v_bat_12v_voltage_alert->SetValue(false);
-      MyEvents.SignalEvent("vehicle.alert.12v.off", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ALERT_12V_OFF], NULL);
       if (m_autonotifications) Notify12vRecovered();
       }
 
@@ -805,12 +974,12 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
         ++m_12v_low_ticker;
         if (m_12v_low_ticker == 1)
           {
-          MyEvents.SignalEvent("vehicle.alert.12v.low", NULL);
+          MyEvents.SignalEvent(vehicle_event[VEV_ALERT_12V_LOW], NULL);
           }
         int shutdown_delay = MyConfig.GetParamValueInt("vehicle", "12v.shutdown_delay", 2);
         if (m_12v_low_ticker > shutdown_delay)
           {
-          MyEvents.SignalEvent("vehicle.alert.12v.shutdown", NULL);
+          MyEvents.SignalEvent(vehicle_event[VEV_ALERT_12V_SHUTDOWN], NULL);
           if (m_autonotifications) Notify12vShutdown();
           // shutdown in 10 seconds to allow for scripts & notifications:
           m_12v_shutdown_ticker = 10;
@@ -821,7 +990,7 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
         if (m_12v_low_ticker > 0)
           {
           m_12v_low_ticker = 0;
-          MyEvents.SignalEvent("vehicle.alert.12v.operational", NULL);
+          MyEvents.SignalEvent(vehicle_event[VEV_ALERT_12V_OPERATIONAL], NULL);
           }
         }
       }
@@ -875,7 +1044,7 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
       }
     if (notify)
       {
-      MyEvents.SignalEvent("vehicle.alert.tpms", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ALERT_TPMS], NULL);
       if (m_autonotifications && MyConfig.GetParamValueBool("vehicle", "tpms.alerts.enabled", true))
         NotifyTpmsAlerts();
       }
@@ -1560,7 +1729,7 @@ OvmsVehicle::vehicle_command_t OvmsVehicle::CommandStatTrip(int verbosity, OvmsW
   return Success;
   }
 
-void OvmsVehicle::VehicleConfigChanged(std::string event, void* data)
+void OvmsVehicle::VehicleConfigChanged(const char* event, void* data)
   {
   OvmsConfigParam* param = (OvmsConfigParam*) data;
 
@@ -1586,6 +1755,17 @@ void OvmsVehicle::VehicleConfigChanged(std::string event, void* data)
     m_brakelight_basepwr = MyConfig.GetParamValueFloat("vehicle", "brakelight.basepwr", 0);
     m_brakelight_ignftbrk = MyConfig.GetParamValueBool("vehicle", "brakelight.ignftbrk", false);
     m_brakelight_start = 0;
+
+    // BMS cell deviation thresholds:
+    BmsReadThresholds();
+
+    // CAN hardware acceptance filtering (see AddCanAcceptance):
+    bool acceptance = MyConfig.GetParamValueBool("vehicle", "can.acceptance", false);
+    if (acceptance != m_can_acceptance_enable)
+      {
+      m_can_acceptance_enable = acceptance;
+      m_can_acceptance_update = true;
+      }
     }
 
   // read vehicle specific config:
@@ -1615,7 +1795,7 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
       m_inv_refpower = 0;
       m_inv_energyused = 0;
       m_inv_energyrecd = 0;
-      MyEvents.SignalEvent("vehicle.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ON], NULL);
       if (m_autonotifications)
         {
         m_vehicleon_ticker = GetNotifyVehicleStateDelay("on");
@@ -1631,7 +1811,7 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
         m_brakelight_start = 0;
         StdMetrics.ms_v_env_regenbrake->SetValue(false);
         }
-      MyEvents.SignalEvent("vehicle.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_OFF], NULL);
       if (m_autonotifications)
         {
         m_vehicleoff_ticker = GetNotifyVehicleStateDelay("off");
@@ -1644,12 +1824,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_awake->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.awake",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_AWAKE], NULL);
       NotifiedVehicleAwake();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.asleep",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ASLEEP], NULL);
       NotifiedVehicleAsleep();
       }
     }
@@ -1657,12 +1837,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_charge_inprogress->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.charge.start",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_START], NULL);
       NotifiedVehicleChargeStart();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.charge.stop",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_STOP], NULL);
       NotifiedVehicleChargeStop();
       }
     }
@@ -1670,12 +1850,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_door_chargeport->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.charge.prepare",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_PREPARE], NULL);
       NotifiedVehicleChargePrepare();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.charge.finish",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_FINISH], NULL);
       NotifiedVehicleChargeFinish();
       }
     }
@@ -1683,12 +1863,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_charge_pilot->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.charge.pilot.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_PILOT_ON], NULL);
       NotifiedVehicleChargePilotOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.charge.pilot.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_PILOT_OFF], NULL);
       NotifiedVehicleChargePilotOff();
       }
     }
@@ -1696,12 +1876,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_charge_timermode->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.charge.timermode.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_TIMERMODE_ON], NULL);
       NotifiedVehicleChargeTimermodeOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.charge.timermode.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_TIMERMODE_OFF], NULL);
       NotifiedVehicleChargeTimermodeOff();
       }
     }
@@ -1709,12 +1889,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_aux12v->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.aux.12v.on", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_AUX_12V_ON], NULL);
       NotifiedVehicleAux12vOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.aux.12v.off", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_AUX_12V_OFF], NULL);
       NotifiedVehicleAux12vOff();
       }
     }
@@ -1724,12 +1904,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
       {
       if (m_12v_ticker < 30)
         m_12v_ticker = 30; // min calmdown time
-      MyEvents.SignalEvent("vehicle.charge.12v.start",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_12V_START], NULL);
       NotifiedVehicleCharge12vStart();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.charge.12v.stop",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_12V_STOP], NULL);
       NotifiedVehicleCharge12vStop();
       }
     }
@@ -1737,12 +1917,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_locked->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.locked",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_LOCKED], NULL);
       NotifiedVehicleLocked();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.unlocked",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_UNLOCKED], NULL);
       NotifiedVehicleUnlocked();
       }
     }
@@ -1750,13 +1930,13 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_valet->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.valet.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_VALET_ON], NULL);
       if (m_autonotifications) NotifyValetEnabled();
       NotifiedVehicleValetOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.valet.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_VALET_OFF], NULL);
       if (m_autonotifications) NotifyValetDisabled();
       NotifiedVehicleValetOff();
       }
@@ -1765,12 +1945,12 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_headlights->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.headlights.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_HEADLIGHTS_ON], NULL);
       NotifiedVehicleHeadlightsOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.headlights.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_HEADLIGHTS_OFF], NULL);
       NotifiedVehicleHeadlightsOff();
       }
     }
@@ -1794,13 +1974,13 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     if (StandardMetrics.ms_v_env_alarm->AsBool())
       {
-      MyEvents.SignalEvent("vehicle.alarm.on",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ALARM_ON], NULL);
       if (m_autonotifications) NotifyAlarmSounding();
       NotifiedVehicleAlarmOn();
       }
     else
       {
-      MyEvents.SignalEvent("vehicle.alarm.off",NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_ALARM_OFF], NULL);
       if (m_autonotifications) NotifyAlarmStopped();
       NotifiedVehicleAlarmOff();
       }
@@ -1809,11 +1989,11 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     int gear = StandardMetrics.ms_v_env_gear->AsInt();
     if (gear < 0)
-      MyEvents.SignalEvent("vehicle.gear.reverse", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_GEAR_REVERSE], NULL);
     else if (gear > 0)
-      MyEvents.SignalEvent("vehicle.gear.forward", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_GEAR_FORWARD], NULL);
     else
-      MyEvents.SignalEvent("vehicle.gear.neutral", NULL);
+      MyEvents.SignalEvent(vehicle_event[VEV_GEAR_NEUTRAL], NULL);
     NotifiedVehicleGear(gear);
     }
   else if (metric == StandardMetrics.ms_v_env_drivemode)
@@ -1826,14 +2006,14 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
     {
     std::string m = metric->AsString();
     const char* mc = m.c_str();
-    MyEvents.SignalEvent("vehicle.charge.mode",(void*)mc, strlen(mc)+1);
+    MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_MODE], (void*)mc, strlen(mc)+1);
     NotifiedVehicleChargeMode(mc);
     }
   else if (metric == StandardMetrics.ms_v_charge_state)
     {
     std::string m = metric->AsString();
     const char* mc = m.c_str();
-    MyEvents.SignalEvent("vehicle.charge.state",(void*)mc, strlen(mc)+1);
+    MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_STATE], (void*)mc, strlen(mc)+1);
     if (m == "done")
       {
       StandardMetrics.ms_v_charge_duration_full->SetValue(0);
@@ -1850,20 +2030,20 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
   else if (metric == StandardMetrics.ms_v_charge_type)
     {
     std::string m = metric->AsString();
-    MyEvents.SignalEvent("vehicle.charge.type", (void*)m.c_str(), m.size()+1);
+    MyEvents.SignalEvent(vehicle_event[VEV_CHARGE_TYPE], (void*)m.c_str(), m.size()+1);
     NotifiedVehicleChargeType(m);
     }
   else if (metric == StandardMetrics.ms_v_gen_state)
     {
     std::string state = metric->AsString();
-    MyEvents.SignalEvent("vehicle.gen.state", (void*)state.c_str(), state.size()+1);
+    MyEvents.SignalEvent(vehicle_event[VEV_GEN_STATE], (void*)state.c_str(), state.size()+1);
     if (m_autonotifications)
       NotifyGenState();
     }
   else if (metric == StandardMetrics.ms_v_gen_type)
     {
     std::string m = metric->AsString();
-    MyEvents.SignalEvent("vehicle.gen.type", (void*)m.c_str(), m.size()+1);
+    MyEvents.SignalEvent(vehicle_event[VEV_GEN_TYPE], (void*)m.c_str(), m.size()+1);
     NotifiedVehicleGenType(m);
     }
   else if (metric == StandardMetrics.ms_v_pos_speed)
@@ -2465,6 +2645,19 @@ void OvmsVehicle::PollSetTimeBetweenSuccess(uint16_t time_between_ms)
   {
   MyPollers.PollSetTimeBetweenSuccess(time_between_ms);
   }
+void OvmsVehicle::PollSetPipelining(uint8_t max_inflight)
+  {
+  MyPollers.PollSetPipelining(max_inflight);
+  }
+void OvmsVehicle::PollSetPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t priority,
+  const std::vector<std::string> &metrics)
+  {
+  MyPollers.PollSetPidHint(txmoduleid, type, pid, priority, metrics);
+  }
+void OvmsVehicle::PollSetBatching(uint32_t txmoduleid, uint8_t maxdids)
+  {
+  MyPollers.PollSetBatching(txmoduleid, maxdids);
+  }
 
 /**
  * IncomingPollReply: poll response handler (stub, override with vehicle implementation)
@@ -2483,6 +2676,22 @@ void OvmsVehicle::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint8_t*
   {
   }
 
+/**
+ * IncomingPollResponse: complete poll response handler (stub, override with vehicle implementation)
+ *  With PollSetReassembly(true), the poller collects all frames of a response
+ *  in a pooled buffer and calls this once per response instead of calling
+ *  IncomingPollReply() per frame. Multi frame responses of pipelined requests
+ *  are reassembled per ECU. The buffer is reused after the call returns.
+ *
+ *  @param job
+ *    Status of the current Poll job
+ *  @param reply
+ *    Complete payload (data following the response type & PID)
+ */
+void OvmsVehicle::IncomingPollResponse(const OvmsPoller::poll_job_t &job, const OvmsPollReply &reply)
+  {
+  }
+
 /**
  * IncomingPollError: Calls Vehicle poll response error handler
  *  This is called by PollerReceive() on reception of an OBD/UDS Negative Response Code (NRC),
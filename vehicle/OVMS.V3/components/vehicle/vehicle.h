@@ -44,6 +44,7 @@
 #include "ovms_mutex.h"
 #include "ovms_semaphore.h"
 #include "vehicle_common.h"
+#include "vehicle_integrator.h"
 #ifdef CONFIG_OVMS_COMP_POLLER
 #include "vehicle_poller.h"
 #endif
@@ -173,8 +174,9 @@ class OvmsVehicle : public InternalRamAllocated
     canbus* m_can4;
 
   private:
-    void VehicleTicker1(std::string event, void* data);
-    void VehicleConfigChanged(std::string event, void* data);
+    void VehicleTicker1(const char* event, void* data);
+    void VehicleConfigChanged(const char* event, void* data);
+    void UpdateCanAcceptance();
     void PollRunFinishedNotify(canbus* bus, void *data);
     void PollerStateTickerNotify(canbus* bus, void *data);
   protected:
@@ -208,6 +210,14 @@ class OvmsVehicle : public InternalRamAllocated
     void PollSetResponseSeparationTime(uint8_t septime);
     void PollSetChannelKeepalive(uint16_t keepalive_seconds);
     void PollSetTimeBetweenSuccess(uint16_t tick_between_ms);
+    void PollSetPipelining(uint8_t max_inflight);
+    void PollSetPidHint(uint32_t txmoduleid, uint16_t type, uint16_t pid, int8_t priority,
+      const std::vector<std::string> &metrics = std::vector<std::string>());
+    void PollSetBatching(uint32_t txmoduleid, uint8_t maxdids);
+    void PollSetReassembly(bool enable)
+      {
+      m_poll_reassembly = enable;
+      }
 #endif
 
     uint8_t GetBusNo(canbus* bus);
@@ -237,6 +247,9 @@ class OvmsVehicle : public InternalRamAllocated
     float m_batpwr_smoothing;               // … smoothing factor (samples, 0 = none, default 2.0) …
     float m_batpwr_smoothed;                // … and smoothed value of ms_v_bat_power
 
+  protected:
+    OvmsBatteryIntegrator m_bat_integrator; // CAN rate battery energy & charge counter, Feed() from frame handlers
+
   protected:
     bool m_brakelight_enable;               // Regen brake light enable (default no)
     int m_brakelight_port;                  // … MAX7317 output port number (1, 3…9, default 1 = SW_12V)
@@ -370,8 +383,14 @@ class OvmsVehicle : public InternalRamAllocated
 
   protected:
     void RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, dbcfile* dbcfile = NULL);
+    void AddCanAcceptance(int bus, uint32_t id_from, uint32_t id_to, bool extended=false);
     bool PinCheck(const char* pin);
 
+  private:
+    uint8_t m_can_acceptance;                 // Buses with declared frame IDs (bit = bus number)
+    bool m_can_acceptance_enable;             // Config vehicle can.acceptance
+    bool m_can_acceptance_update;             // Apply filters on next ticker
+
   public:
     typedef enum
       {
@@ -450,6 +469,8 @@ class OvmsVehicle : public InternalRamAllocated
       void IncomingPollReply(const OvmsPoller::poll_job_t &job, uint8_t* data, uint8_t length) override;
       void IncomingPollError(const OvmsPoller::poll_job_t &job, uint16_t code) override;
       void IncomingPollTxCallback(const OvmsPoller::poll_job_t &job, bool success) override;
+      bool PollReassembly() override;
+      void IncomingPollResponse(const OvmsPoller::poll_job_t &job, const OvmsPollReply &reply) override;
 
       bool Ready() override;
     };
@@ -465,11 +486,13 @@ class OvmsVehicle : public InternalRamAllocated
     virtual void IncomingPollReply(const OvmsPoller::poll_job_t &job, uint8_t* data, uint8_t length);
     virtual void IncomingPollError(const OvmsPoller::poll_job_t &job, uint16_t code);
     virtual void IncomingPollTxCallback(const OvmsPoller::poll_job_t &job, bool success);
+    virtual void IncomingPollResponse(const OvmsPoller::poll_job_t &job, const OvmsPollReply &reply);
 #endif
 
   protected:
 #ifdef CONFIG_OVMS_COMP_POLLER
     OvmsVehicleSignal*m_pollsignal;
+    bool              m_poll_reassembly;      // Deliver complete responses to IncomingPollResponse()
     uint8_t           m_poll_state;           // Current poll state
     void PollRequest(canbus* bus, const std::string &name, const std::shared_ptr<OvmsPoller::PollSeriesEntry> &series);
     void RemovePollRequest(canbus* bus, const std::string &name);
@@ -519,6 +542,16 @@ class OvmsVehicle : public InternalRamAllocated
     float m_bms_defthr_valert;                // Default voltage deviation alert threshold [V]
     float m_bms_defthr_twarn;                 // Default temperature deviation warn threshold [°C]
     float m_bms_defthr_talert;                // Default temperature deviation alert threshold [°C]
+    float m_bms_thr_vmaxgrad;                 // Configured voltage deviation max valid gradient [V]
+    float m_bms_thr_vmaxsddev;                // Configured voltage deviation max valid stddev deviation [V]
+    float m_bms_thr_vwarn;                    // Configured voltage deviation warn threshold [V]
+    float m_bms_thr_valert;                   // Configured voltage deviation alert threshold [V]
+    float m_bms_thr_twarn;                    // Configured temperature deviation warn threshold [°C]
+    float m_bms_thr_talert;                   // Configured temperature deviation alert threshold [°C]
+    int m_bms_vdirty_first;                   // First cell with changed min/max voltage (-1 = none)
+    int m_bms_vdirty_last;                    // Last cell with changed min/max voltage
+    int m_bms_tdirty_first;                   // First cell with changed min/max temperature (-1 = none)
+    int m_bms_tdirty_last;                    // Last cell with changed min/max temperature
     uint32_t m_bms_vlog_last;                 // Last log time for voltages
     uint32_t m_bms_tlog_last;                 // Last log time for temperatures
 
@@ -530,12 +563,17 @@ class OvmsVehicle : public InternalRamAllocated
     void BmsSetCellLimitsVoltage(float min, float max);
     void BmsSetCellLimitsTemperature(float min, float max);
     void BmsSetCellVoltage(int index, float value);
+    void BmsSetCellVoltages(int start, int count, const float* values);
     void BmsResetCellVoltages(bool full = false);
     void BmsSetCellTemperature(int index, float value);
+    void BmsSetCellTemperatures(int start, int count, const float* values);
     void BmsResetCellTemperatures(bool full = false);
     void BmsRestartCellVoltages();
     void BmsRestartCellTemperatures();
     void BmsTicker();
+    void BmsReadThresholds();
+    void BmsCompleteVoltages();
+    void BmsCompleteTemperatures();
     virtual void NotifyBmsAlerts();
 
   public:
@@ -632,8 +670,8 @@ class OvmsVehicleFactory
     static void bms_alerts(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void obdii_request(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
 
-    void EventSystemShuttingDown(std::string event, void* data);
-    void EventTicker1ShuttingDown(std::string event, void* data);
+    void EventSystemShuttingDown(const char* event, void* data);
+    void EventTicker1ShuttingDown(const char* event, void* data);
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   protected:
@@ -44,6 +44,7 @@ static const char *TAG = "vehicle";
 #include <ovms_peripherals.h>
 #include <string_writer.h>
 #include "vehicle.h"
+#include "vehicle_bms_stats.h"
 
 // Voltage stddev running average sample count:
 #define VSTDDEV_SMOOTHCNT         5
@@ -62,6 +63,7 @@ void OvmsVehicle::BmsSetCellArrangementVoltage(int readings, int readingspermodu
   if (m_bms_valerts != NULL) delete m_bms_valerts;
   m_bms_valerts = new OvmsStatus[readings];
   m_bms_valerts_new = 0;
+  m_bms_vdirty_first = m_bms_vdirty_last = -1;
 
   m_bms_bitset_v.clear();
   m_bms_bitset_v.reserve(readings);
@@ -208,6 +210,7 @@ void OvmsVehicle::BmsSetCellArrangementTemperature(int readings, int readingsper
   if (m_bms_talerts != NULL) delete m_bms_talerts;
   m_bms_talerts = new OvmsStatus[readings];
   m_bms_talerts_new = 0;
+  m_bms_tdirty_first = m_bms_tdirty_last = -1;
 
   m_bms_bitset_t.clear();
   m_bms_bitset_t.reserve(readings);
@@ -239,6 +242,7 @@ void OvmsVehicle::BmsSetCellDefaultThresholdsVoltage(float warn, float alert,
   m_bms_defthr_valert = alert;
   m_bms_defthr_vmaxgrad = (maxgrad < 0) ? BMS_DEFTHR_VMAXGRAD : maxgrad;
   m_bms_defthr_vmaxsddev = (maxsddev < 0) ? BMS_DEFTHR_VMAXSDDEV : maxsddev;
+  BmsReadThresholds();
   }
 
 void OvmsVehicle::BmsGetCellDefaultThresholdsVoltage(float* warn, float* alert,
@@ -254,6 +258,21 @@ void OvmsVehicle::BmsSetCellDefaultThresholdsTemperature(float warn, float alert
   {
   m_bms_defthr_twarn = warn;
   m_bms_defthr_talert = alert;
+  BmsReadThresholds();
+  }
+
+/**
+ * BmsReadThresholds: cache the configured deviation thresholds
+ *  Called on config changes and when the vehicle sets its defaults.
+ */
+void OvmsVehicle::BmsReadThresholds()
+  {
+  m_bms_thr_vmaxgrad  = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.maxgrad",  m_bms_defthr_vmaxgrad);
+  m_bms_thr_vmaxsddev = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.maxsddev", m_bms_defthr_vmaxsddev);
+  m_bms_thr_vwarn     = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.warn",     m_bms_defthr_vwarn);
+  m_bms_thr_valert    = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.alert",    m_bms_defthr_valert);
+  m_bms_thr_twarn     = MyConfig.GetParamValueFloat("vehicle", "bms.dev.temp.warn",        m_bms_defthr_twarn);
+  m_bms_thr_talert    = MyConfig.GetParamValueFloat("vehicle", "bms.dev.temp.alert",       m_bms_defthr_talert);
   }
 
 void OvmsVehicle::BmsGetCellDefaultThresholdsTemperature(float* warn, float* alert)
@@ -276,210 +295,249 @@ void OvmsVehicle::BmsSetCellLimitsTemperature(float min, float max)
 
 void OvmsVehicle::BmsSetCellVoltage(int index, float value)
   {
-  // ESP_LOGV(TAG,"BmsSetCellVoltage(%d,%f) c=%d", index, value, m_bms_bitset_cv);
-  if ((index<0)||(index>=m_bms_readings_v)) return;
-  if ((value<m_bms_limit_vmin)||(value>m_bms_limit_vmax)) {
-    ESP_LOGE(TAG, "BmsSetCellVoltage: cell %d voltage %f: out of range", index, value);
+  BmsSetCellVoltages(index, 1, &value);
   }
-  m_bms_voltages[index] = value;
 
-  if (! m_bms_has_voltages)
-    {
-    m_bms_vmins[index] = value;
-    m_bms_vmaxs[index] = value;
-    }
-  else if (m_bms_vmins[index] > value)
-    m_bms_vmins[index] = value;
-  else if (m_bms_vmaxs[index] < value)
-    m_bms_vmaxs[index] = value;
+/**
+ * BmsSetCellVoltages: set a range of cell voltages in one call
+ *  The statistics are calculated & published when all cells of a series have been set.
+ */
+void OvmsVehicle::BmsSetCellVoltages(int start, int count, const float* values)
+  {
+  // ESP_LOGV(TAG,"BmsSetCellVoltages(%d,%d) c=%d", start, count, m_bms_bitset_cv);
+  if ((start<0)||(start>=m_bms_readings_v)||(count<=0)||(!values)) return;
+  if (start + count > m_bms_readings_v)
+    count = m_bms_readings_v - start;
 
-  if (m_bms_bitset_v[index] == false) m_bms_bitset_cv++;
-  if (m_bms_bitset_cv == m_bms_readings_v)
+  for (int i=0; i<count; i++)
     {
-    // Series complete, all cell voltages acquired
-    float thr_maxgrad  = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.maxgrad",  m_bms_defthr_vmaxgrad);
-    float thr_maxsddev = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.maxsddev", m_bms_defthr_vmaxsddev);
-    float thr_warn     = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.warn",     m_bms_defthr_vwarn);
-    float thr_alert    = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.alert",    m_bms_defthr_valert);
-
-    // Get min, max, avg & standard deviation:
-    double sum=0, sqrsum=0, avg, stddev=0;
-    float min=0, max=0;
-    for (int i=0; i<m_bms_readings_v; i++)
-      {
-      sum += m_bms_voltages[i];
-      sqrsum += SQR(m_bms_voltages[i]);
-      if (min==0 || m_bms_voltages[i]<min)
-        min = m_bms_voltages[i];
-      if (max==0 || m_bms_voltages[i]>max)
-        max = m_bms_voltages[i];
-      }
-    avg = sum / m_bms_readings_v;
-    stddev = sqrt(LIMIT_MIN((sqrsum / m_bms_readings_v) - SQR(avg), 0));
+    int index = start + i;
+    float value = values[i];
+    if ((value<m_bms_limit_vmin)||(value>m_bms_limit_vmax)) {
+      ESP_LOGE(TAG, "BmsSetCellVoltage: cell %d voltage %f: out of range", index, value);
+    }
+    m_bms_voltages[index] = value;
 
-    // Get gradient:
-    double sumn = 0, sumd = 0;
-    for (int i=0; i<m_bms_readings_v; i++)
-      {
-      sumn += (i - (m_bms_readings_v / 2 - 0.5)) * (m_bms_voltages[i] - avg);
-      sumd += SQR(i - (m_bms_readings_v / 2 - 0.5));
-      }
-    float grad = (sumn / sumd) * m_bms_readings_v;
-
-    // …publish to metrics:
-    StandardMetrics.ms_v_bat_pack_vmin->SetValue(min);
-    StandardMetrics.ms_v_bat_pack_vmax->SetValue(max);
-    StandardMetrics.ms_v_bat_pack_vavg->SetValue(ROUNDPREC(avg, 5));
-    StandardMetrics.ms_v_bat_pack_vstddev->SetValue(ROUNDPREC(stddev, 5));
-    StandardMetrics.ms_v_bat_pack_vgrad->SetValue(ROUNDPREC(grad, 5));
-    StandardMetrics.ms_v_bat_cell_voltage->SetElemValues(0, m_bms_readings_v, m_bms_voltages);
-    StandardMetrics.ms_v_bat_cell_vmin->SetElemValues(0, m_bms_readings_v, m_bms_vmins);
-    StandardMetrics.ms_v_bat_cell_vmax->SetElemValues(0, m_bms_readings_v, m_bms_vmaxs);
-    StandardMetrics.ms_v_bat_cell_vupdatedon->SetValue(monotonictime);
-
-    // Voltages are very volatile and may respond to a load change within the sensor query loop.
-    // To detect an inconsistent series, we check for a too high gradient and/or a too high
-    // offset of the momentary stddev level from the previously observed average:
-    bool series_valid;
-    if (ABS(grad) > thr_maxgrad)
-      {
-      series_valid = false;
-      }
-    else if (m_bms_vstddev_cnt < VSTDDEV_SMOOTHCNT)
-      {
-      // skip the first VSTDDEV_SMOOTHCNT series to init the average:
-      m_bms_vstddev_cnt++;
-      m_bms_vstddev_avg = ((m_bms_vstddev_cnt-1) * m_bms_vstddev_avg + stddev) / m_bms_vstddev_cnt;
-      series_valid = false;
-      }
-    else if (stddev - m_bms_vstddev_avg > thr_maxsddev)
+    bool changed = true;
+    if (! m_bms_has_voltages)
       {
-      series_valid = false;
+      m_bms_vmins[index] = value;
+      m_bms_vmaxs[index] = value;
       }
+    else if (m_bms_vmins[index] > value)
+      m_bms_vmins[index] = value;
+    else if (m_bms_vmaxs[index] < value)
+      m_bms_vmaxs[index] = value;
     else
+      changed = false;
+    if (changed)
       {
-      m_bms_vstddev_avg = ((VSTDDEV_SMOOTHCNT-1) * m_bms_vstddev_avg + stddev) / VSTDDEV_SMOOTHCNT;
-      series_valid = true;
+      if (m_bms_vdirty_first < 0 || index < m_bms_vdirty_first)
+        m_bms_vdirty_first = index;
+      if (index > m_bms_vdirty_last)
+        m_bms_vdirty_last = index;
       }
 
-    // Check cell deviations only if the series appears to be consistent:
-    if (series_valid)
+    if (m_bms_bitset_v[index] == false)
       {
-      float dev;
-      for (int i=0; i<m_bms_readings_v; i++)
-        {
-        dev = ROUNDPREC(m_bms_voltages[i] - avg, 5);
-        if (ABS(dev) > ABS(m_bms_vdevmaxs[i]))
-          m_bms_vdevmaxs[i] = dev;
-        if (ABS(dev) >= stddev + thr_alert && m_bms_valerts[i] <= OvmsStatus::Warn)
-          {
-          m_bms_valerts[i] = OvmsStatus::Alert;
-          m_bms_valerts_new++; // trigger notification
-          }
-        else if (ABS(dev) >= stddev + thr_warn && m_bms_valerts[i] < OvmsStatus::Warn)
-          m_bms_valerts[i] = OvmsStatus::Warn;
-        }
-
-      // Publish deviation maximums & alerts:
-      if (stddev > StandardMetrics.ms_v_bat_pack_vstddev_max->AsFloat())
-        StandardMetrics.ms_v_bat_pack_vstddev_max->SetValue(stddev);
-      StandardMetrics.ms_v_bat_cell_vdevmax->SetElemValues(0, m_bms_readings_v, m_bms_vdevmaxs);
-      StandardMetrics.ms_v_bat_cell_valert->SetElemValues(0, m_bms_readings_v, (short *)m_bms_valerts);
+      m_bms_bitset_v[index] = true;
+      m_bms_bitset_cv++;
       }
+    if (m_bms_bitset_cv == m_bms_readings_v)
+      BmsCompleteVoltages();
+    }
+  }
 
-    // complete:
-    m_bms_has_voltages = true;
-    m_bms_bitset_v.clear();
-    m_bms_bitset_v.resize(m_bms_readings_v);
-    m_bms_bitset_cv = 0;
+/**
+ * BmsCompleteVoltages: series complete, all cell voltages acquired
+ */
+void OvmsVehicle::BmsCompleteVoltages()
+  {
+  // Get min, max, avg, standard deviation & gradient:
+  bms_cell_stats_t stats;
+  bms_cell_stats(m_bms_voltages, m_bms_readings_v, stats);
+  double avg = stats.avg, stddev = stats.stddev;
+  float grad = stats.grad;
+
+  // …publish to metrics:
+  StandardMetrics.ms_v_bat_pack_vmin->SetValue(stats.min);
+  StandardMetrics.ms_v_bat_pack_vmax->SetValue(stats.max);
+  StandardMetrics.ms_v_bat_pack_vavg->SetValue(ROUNDPREC(avg, 5));
+  StandardMetrics.ms_v_bat_pack_vstddev->SetValue(ROUNDPREC(stddev, 5));
+  StandardMetrics.ms_v_bat_pack_vgrad->SetValue(ROUNDPREC(grad, 5));
+  StandardMetrics.ms_v_bat_cell_voltage->SetElemValues(0, m_bms_readings_v, m_bms_voltages);
+  if (m_bms_vdirty_first >= 0)
+    {
+    // Only cells with new minimum/maximum values need to be updated:
+    int cnt = m_bms_vdirty_last - m_bms_vdirty_first + 1;
+    StandardMetrics.ms_v_bat_cell_vmin->SetElemValues(m_bms_vdirty_first, cnt, m_bms_vmins + m_bms_vdirty_first);
+    StandardMetrics.ms_v_bat_cell_vmax->SetElemValues(m_bms_vdirty_first, cnt, m_bms_vmaxs + m_bms_vdirty_first);
+    m_bms_vdirty_first = m_bms_vdirty_last = -1;
+    }
+  StandardMetrics.ms_v_bat_cell_vupdatedon->SetValue(monotonictime);
+
+  // Voltages are very volatile and may respond to a load change within the sensor query loop.
+  // To detect an inconsistent series, we check for a too high gradient and/or a too high
+  // offset of the momentary stddev level from the previously observed average:
+  bool series_valid;
+  if (ABS(grad) > m_bms_thr_vmaxgrad)
+    {
+    series_valid = false;
+    }
+  else if (m_bms_vstddev_cnt < VSTDDEV_SMOOTHCNT)
+    {
+    // skip the first VSTDDEV_SMOOTHCNT series to init the average:
+    m_bms_vstddev_cnt++;
+    m_bms_vstddev_avg = ((m_bms_vstddev_cnt-1) * m_bms_vstddev_avg + stddev) / m_bms_vstddev_cnt;
+    series_valid = false;
+    }
+  else if (stddev - m_bms_vstddev_avg > m_bms_thr_vmaxsddev)
+    {
+    series_valid = false;
     }
   else
     {
-    m_bms_bitset_v[index] = true;
+    m_bms_vstddev_avg = ((VSTDDEV_SMOOTHCNT-1) * m_bms_vstddev_avg + stddev) / VSTDDEV_SMOOTHCNT;
+    series_valid = true;
     }
+
+  // Check cell deviations only if the series appears to be consistent:
+  if (series_valid)
+    {
+    float dev;
+    for (int i=0; i<m_bms_readings_v; i++)
+      {
+      dev = ROUNDPREC(m_bms_voltages[i] - avg, 5);
+      if (ABS(dev) > ABS(m_bms_vdevmaxs[i]))
+        m_bms_vdevmaxs[i] = dev;
+      if (ABS(dev) >= stddev + m_bms_thr_valert && m_bms_valerts[i] <= OvmsStatus::Warn)
+        {
+        m_bms_valerts[i] = OvmsStatus::Alert;
+        m_bms_valerts_new++; // trigger notification
+        }
+      else if (ABS(dev) >= stddev + m_bms_thr_vwarn && m_bms_valerts[i] < OvmsStatus::Warn)
+        m_bms_valerts[i] = OvmsStatus::Warn;
+      }
+
+    // Publish deviation maximums & alerts:
+    if (stddev > StandardMetrics.ms_v_bat_pack_vstddev_max->AsFloat())
+      StandardMetrics.ms_v_bat_pack_vstddev_max->SetValue(stddev);
+    StandardMetrics.ms_v_bat_cell_vdevmax->SetElemValues(0, m_bms_readings_v, m_bms_vdevmaxs);
+    StandardMetrics.ms_v_bat_cell_valert->SetElemValues(0, m_bms_readings_v, (short *)m_bms_valerts);
+    }
+
+  // complete:
+  m_bms_has_voltages = true;
+  m_bms_bitset_v.clear();
+  m_bms_bitset_v.resize(m_bms_readings_v);
+  m_bms_bitset_cv = 0;
   }
 
 void OvmsVehicle::BmsSetCellTemperature(int index, float value)
   {
-  // ESP_LOGV(TAG,"BmsSetCellTemperature(%d,%f) c=%d", index, value, m_bms_bitset_ct);
-  if ((index<0)||(index>=m_bms_readings_t)) return;
-  if ((value<m_bms_limit_tmin)||(value>m_bms_limit_tmax)) return;
-  m_bms_temperatures[index] = value;
+  BmsSetCellTemperatures(index, 1, &value);
+  }
 
-  if (! m_bms_has_temperatures)
-    {
-    m_bms_tmins[index] = value;
-    m_bms_tmaxs[index] = value;
-    }
-  else if (m_bms_tmins[index] > value)
-    m_bms_tmins[index] = value;
-  else if (m_bms_tmaxs[index] < value)
-    m_bms_tmaxs[index] = value;
+/**
+ * BmsSetCellTemperatures: set a range of cell temperatures in one call
+ *  Values out of the sanity limits are skipped.
+ */
+void OvmsVehicle::BmsSetCellTemperatures(int start, int count, const float* values)
+  {
+  // ESP_LOGV(TAG,"BmsSetCellTemperatures(%d,%d) c=%d", start, count, m_bms_bitset_ct);
+  if ((start<0)||(start>=m_bms_readings_t)||(count<=0)||(!values)) return;
+  if (start + count > m_bms_readings_t)
+    count = m_bms_readings_t - start;
 
-  if (m_bms_bitset_t[index] == false) m_bms_bitset_ct++;
-  if (m_bms_bitset_ct == m_bms_readings_t)
+  for (int i=0; i<count; i++)
     {
-    // Series complete, all cell temperatures acquired
-    float thr_warn  = MyConfig.GetParamValueFloat("vehicle", "bms.dev.temp.warn", m_bms_defthr_twarn);
-    float thr_alert = MyConfig.GetParamValueFloat("vehicle", "bms.dev.temp.alert", m_bms_defthr_talert);
+    int index = start + i;
+    float value = values[i];
+    if ((value<m_bms_limit_tmin)||(value>m_bms_limit_tmax)) continue;
+    m_bms_temperatures[index] = value;
 
-    // get min, max, avg & standard deviation:
-    double sum=0, sqrsum=0, avg, stddev=0;
-    float min=0, max=0;
-    for (int i=0; i<m_bms_readings_t; i++)
+    bool changed = true;
+    if (! m_bms_has_temperatures)
+      {
+      m_bms_tmins[index] = value;
+      m_bms_tmaxs[index] = value;
+      }
+    else if (m_bms_tmins[index] > value)
+      m_bms_tmins[index] = value;
+    else if (m_bms_tmaxs[index] < value)
+      m_bms_tmaxs[index] = value;
+    else
+      changed = false;
+    if (changed)
       {
-      sum += m_bms_temperatures[i];
-      sqrsum += SQR(m_bms_temperatures[i]);
-      if (min==0 || m_bms_temperatures[i]<min)
-        min = m_bms_temperatures[i];
-      if (max==0 || m_bms_temperatures[i]>max)
-        max = m_bms_temperatures[i];
+      if (m_bms_tdirty_first < 0 || index < m_bms_tdirty_first)
+        m_bms_tdirty_first = index;
+      if (index > m_bms_tdirty_last)
+        m_bms_tdirty_last = index;
       }
-    avg = sum / m_bms_readings_t;
-    stddev = sqrt(LIMIT_MIN((sqrsum / m_bms_readings_t) - SQR(avg), 0));
 
-    // check cell deviations:
-    float dev;
-    for (int i=0; i<m_bms_readings_t; i++)
+    if (m_bms_bitset_t[index] == false)
       {
-      dev = ROUNDPREC(m_bms_temperatures[i] - avg, 2);
-      if (ABS(dev) > ABS(m_bms_tdevmaxs[i]))
-        m_bms_tdevmaxs[i] = dev;
-      if (ABS(dev) >= stddev + thr_alert && m_bms_talerts[i] < OvmsStatus::Alert)
-        {
-        m_bms_talerts[i] = OvmsStatus::Alert;
-        m_bms_talerts_new++; // trigger notification
-        }
-      else if (ABS(dev) >= stddev + thr_warn && m_bms_valerts[i] < OvmsStatus::Warn)
-        m_bms_talerts[i] = OvmsStatus::Warn;
+      m_bms_bitset_t[index] = true;
+      m_bms_bitset_ct++;
       }
+    if (m_bms_bitset_ct == m_bms_readings_t)
+      BmsCompleteTemperatures();
+    }
+  }
 
-    // publish to metrics:
-    avg = ROUNDPREC(avg, 2);
-    stddev = ROUNDPREC(stddev, 2);
-    StandardMetrics.ms_v_bat_pack_tmin->SetValue(min);
-    StandardMetrics.ms_v_bat_pack_tmax->SetValue(max);
-    StandardMetrics.ms_v_bat_pack_tavg->SetValue(avg);
-    StandardMetrics.ms_v_bat_pack_tstddev->SetValue(stddev);
-    if (stddev > StandardMetrics.ms_v_bat_pack_tstddev_max->AsFloat())
-      StandardMetrics.ms_v_bat_pack_tstddev_max->SetValue(stddev);
-    StandardMetrics.ms_v_bat_cell_temp->SetElemValues(0, m_bms_readings_t, m_bms_temperatures);
-    StandardMetrics.ms_v_bat_cell_tmin->SetElemValues(0, m_bms_readings_t, m_bms_tmins);
-    StandardMetrics.ms_v_bat_cell_tmax->SetElemValues(0, m_bms_readings_t, m_bms_tmaxs);
-    StandardMetrics.ms_v_bat_cell_tdevmax->SetElemValues(0, m_bms_readings_t, m_bms_tdevmaxs);
-    StandardMetrics.ms_v_bat_cell_talert->SetElemValues(0, m_bms_readings_t, (short *) m_bms_talerts);
-    StandardMetrics.ms_v_bat_cell_tupdatedon->SetValue(monotonictime);
-
-    // complete:
-    m_bms_has_temperatures = true;
-    m_bms_bitset_t.clear();
-    m_bms_bitset_t.resize(m_bms_readings_t);
-    m_bms_bitset_ct = 0;
+/**
+ * BmsCompleteTemperatures: series complete, all cell temperatures acquired
+ */
+void OvmsVehicle::BmsCompleteTemperatures()
+  {
+  // get min, max, avg & standard deviation:
+  bms_cell_stats_t stats;
+  bms_cell_stats(m_bms_temperatures, m_bms_readings_t, stats);
+  double avg = stats.avg, stddev = stats.stddev;
+
+  // check cell deviations:
+  float dev;
+  for (int i=0; i<m_bms_readings_t; i++)
+    {
+    dev = ROUNDPREC(m_bms_temperatures[i] - avg, 2);
+    if (ABS(dev) > ABS(m_bms_tdevmaxs[i]))
+      m_bms_tdevmaxs[i] = dev;
+    if (ABS(dev) >= stddev + m_bms_thr_talert && m_bms_talerts[i] < OvmsStatus::Alert)
+      {
+      m_bms_talerts[i] = OvmsStatus::Alert;
+      m_bms_talerts_new++; // trigger notification
+      }
+    else if (ABS(dev) >= stddev + m_bms_thr_twarn && m_bms_talerts[i] < OvmsStatus::Warn)
+      m_bms_talerts[i] = OvmsStatus::Warn;
     }
-  else
-    {
-    m_bms_bitset_t[index] = true;
+
+  // publish to metrics:
+  avg = ROUNDPREC(avg, 2);
+  stddev = ROUNDPREC(stddev, 2);
+  StandardMetrics.ms_v_bat_pack_tmin->SetValue(stats.min);
+  StandardMetrics.ms_v_bat_pack_tmax->SetValue(stats.max);
+  StandardMetrics.ms_v_bat_pack_tavg->SetValue(avg);
+  StandardMetrics.ms_v_bat_pack_tstddev->SetValue(stddev);
+  if (stddev > StandardMetrics.ms_v_bat_pack_tstddev_max->AsFloat())
+    StandardMetrics.ms_v_bat_pack_tstddev_max->SetValue(stddev);
+  StandardMetrics.ms_v_bat_cell_temp->SetElemValues(0, m_bms_readings_t, m_bms_temperatures);
+  if (m_bms_tdirty_first >= 0)
+    {
+    int cnt = m_bms_tdirty_last - m_bms_tdirty_first + 1;
+    StandardMetrics.ms_v_bat_cell_tmin->SetElemValues(m_bms_tdirty_first, cnt, m_bms_tmins + m_bms_tdirty_first);
+    StandardMetrics.ms_v_bat_cell_tmax->SetElemValues(m_bms_tdirty_first, cnt, m_bms_tmaxs + m_bms_tdirty_first);
+    m_bms_tdirty_first = m_bms_tdirty_last = -1;
     }
+  StandardMetrics.ms_v_bat_cell_tdevmax->SetElemValues(0, m_bms_readings_t, m_bms_tdevmaxs);
+  StandardMetrics.ms_v_bat_cell_talert->SetElemValues(0, m_bms_readings_t, (short *) m_bms_talerts);
+  StandardMetrics.ms_v_bat_cell_tupdatedon->SetValue(monotonictime);
+
+  // complete:
+  m_bms_has_temperatures = true;
+  m_bms_bitset_t.clear();
+  m_bms_bitset_t.resize(m_bms_readings_t);
+  m_bms_bitset_ct = 0;
   }
 
 void OvmsVehicle::BmsRestartCellVoltages()
@@ -512,6 +570,7 @@ void OvmsVehicle::BmsResetCellVoltages(bool full /*=false*/)
       m_bms_valerts[k] = OvmsStatus::OK;
       }
     m_bms_valerts_new = 0;
+    m_bms_vdirty_first = m_bms_vdirty_last = -1;
     m_bms_vstddev_cnt = 0;
     m_bms_vstddev_avg = 0;
     if (full) StandardMetrics.ms_v_bat_cell_voltage->ClearValue();
@@ -539,6 +598,7 @@ void OvmsVehicle::BmsResetCellTemperatures(bool full /*=false*/)
       m_bms_talerts[k] = OvmsStatus::OK;
       }
     m_bms_talerts_new = 0;
+    m_bms_tdirty_first = m_bms_tdirty_last = -1;
     if (full) StandardMetrics.ms_v_bat_cell_temp->ClearValue();
     StandardMetrics.ms_v_bat_cell_tmin->ClearValue();
     StandardMetrics.ms_v_bat_cell_tmax->ClearValue();
@@ -0,0 +1,79 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_BMS_STATS_H__
+#define __VEHICLE_BMS_STATS_H__
+
+#include <math.h>
+
+/**
+ * bms_cell_stats: get min, max, avg, standard deviation & gradient in a single pass
+ *  The sums are taken relative to the first value (shifted data), so float precision
+ *  suffices (ESP32 FPU) and the loop is free of divisions. The gradient is the least
+ *  squares slope over the cell positions, scaled to the pack.
+ */
+typedef struct
+  {
+  float min, max;
+  double avg, stddev, grad;
+  } bms_cell_stats_t;
+
+static inline void bms_cell_stats(const float* values, int count, bms_cell_stats_t &res)
+  {
+  const float ref = values[0];
+  const float ctr = count / 2 - 0.5f;
+  float min = ref, max = ref;
+  float sum = 0, sqrsum = 0, possum = 0;
+  for (int i = 0; i < count; i++)
+    {
+    float v = values[i];
+    float d = v - ref;
+    sum += d;
+    sqrsum += d * d;
+    possum += (i - ctr) * d;
+    min = (v < min) ? v : min;
+    max = (v > max) ? v : max;
+    }
+
+  double n = count;
+  double mean = sum / n;
+  res.min = min;
+  res.max = max;
+  res.avg = ref + mean;
+  double var = sqrsum / n - mean * mean;
+  res.stddev = (var > 0) ? sqrt(var) : 0;
+
+  // sum (i - ctr) * (v - avg) = possum - mean * sum (i - ctr):
+  double possum_i = n * (n - 1) / 2 - n * ctr;
+  double sumn = possum - mean * possum_i;
+  double sumd = (n - 1) * n * (2 * n - 1) / 6 - 2 * ctr * n * (n - 1) / 2 + n * ctr * ctr;
+  res.grad = (sumd > 0) ? (sumn / sumd) * n : 0;
+  }
+
+#endif //#ifndef __VEHICLE_BMS_STATS_H__
@@ -42,6 +42,9 @@
 #define VWTP_16                         16    // VW/VAG Transport Protocol 1.6 (placeholder, unsupported)
 #define VWTP_20                         20    // VW/VAG Transport Protocol 2.0
 
+// Protocol flags:
+#define ISOTP_COLLECT                   0x80  // broadcast (rxmoduleid 0): collect the responses of all ECUs
+
 // Argument tag:
 #define POLL_TXDATA                     0xff  // poll_pid_t using xargs for external payload up to 4095 bytes
 
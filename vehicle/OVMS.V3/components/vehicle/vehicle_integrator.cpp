@@ -0,0 +1,211 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include <esp_timer.h>
+#include "metrics_standard.h"
+#include "vehicle_integrator.h"
+
+// Default max sample gap to integrate over [ms]:
+#define INTEGRATOR_MAXGAP         2000
+
+// Accumulator scaling:
+#define UJ_PER_KWH                3.6e12
+#define UC_PER_AH                 3.6e9
+
+
+/**
+ * IntegrateSegment: trapezoidal area of the linear segment a→b over dt,
+ *  split into positive & negative parts at the zero crossing
+ */
+static inline void IntegrateSegment(float a, float b, float dt, int64_t &pos, int64_t &neg)
+  {
+  float apos, aneg;
+  if ((a >= 0) == (b >= 0))
+    {
+    float area = (a + b) * 0.5f * dt;
+    apos = (area > 0) ? area : 0;
+    aneg = (area < 0) ? -area : 0;
+    }
+  else
+    {
+    // crossing at fraction f = a/(a-b) of dt:
+    float f = a / (a - b);
+    float area1 = a * f * dt * 0.5f;
+    float area2 = b * (1 - f) * dt * 0.5f;
+    apos = (a > 0) ? area1 : area2;
+    aneg = (a > 0) ? -area2 : -area1;
+    }
+  pos = (int64_t)(apos + 0.5f);
+  neg = (int64_t)(aneg + 0.5f);
+  }
+
+
+OvmsBatteryIntegrator::OvmsBatteryIntegrator()
+  {
+  m_energy_used = 0;
+  m_energy_recd = 0;
+  m_charge_used = 0;
+  m_charge_recd = 0;
+  m_time = 0;
+  m_power = 0;
+  m_current = 0;
+  m_maxgap = (int64_t) INTEGRATOR_MAXGAP * 1000;
+  m_samples = 0;
+  m_gaps = 0;
+  m_publish = INTEGRATOR_ALL;
+
+  OvmsMetricFloat* metrics[8] =
+    {
+    StdMetrics.ms_v_bat_energy_used, StdMetrics.ms_v_bat_energy_recd,
+    StdMetrics.ms_v_bat_energy_used_total, StdMetrics.ms_v_bat_energy_recd_total,
+    StdMetrics.ms_v_bat_coulomb_used, StdMetrics.ms_v_bat_coulomb_recd,
+    StdMetrics.ms_v_bat_coulomb_used_total, StdMetrics.ms_v_bat_coulomb_recd_total,
+    };
+  for (int i = 0; i < 8; i++)
+    {
+    m_out[i].metric = metrics[i];
+    m_out[i].published = 0;
+    m_out[i].acc = 0;
+    m_out[i].base = 0;
+    m_out[i].baseacc = 0;
+    m_out[i].valid = false;
+    }
+  }
+
+OvmsBatteryIntegrator::~OvmsBatteryIntegrator()
+  {
+  }
+
+/**
+ * Feed: add a battery sample
+ *  - voltage [V], current [A] (output = positive)
+ *  - time_us: sample time [µs] on the esp_timer scale, 0 = now
+ *  Call from a single producer context only (normally the vehicle task).
+ */
+void OvmsBatteryIntegrator::Feed(float voltage, float current, int64_t time_us)
+  {
+  if (time_us == 0)
+    time_us = esp_timer_get_time();
+  float power = voltage * current;
+  int64_t dt = time_us - m_time;
+  m_samples++;
+
+  if (m_time == 0 || dt < 0 || dt > m_maxgap)
+    {
+    // (re)start integration:
+    if (m_time != 0)
+      m_gaps++;
+    }
+  else if (dt > 0)
+    {
+    int64_t eu, er, cu, cr;
+    IntegrateSegment(m_power, power, dt, eu, er);
+    IntegrateSegment(m_current, current, dt, cu, cr);
+    portENTER_CRITICAL(&m_spinlock);
+    m_energy_used += eu;
+    m_energy_recd += er;
+    m_charge_used += cu;
+    m_charge_recd += cr;
+    portEXIT_CRITICAL(&m_spinlock);
+    }
+
+  m_time = time_us;
+  m_power = power;
+  m_current = current;
+  }
+
+/**
+ * Restart: drop the reference sample, i.e. do not integrate up to the next sample
+ *  (e.g. when the source signal becomes invalid). Producer context only.
+ */
+void OvmsBatteryIntegrator::Restart()
+  {
+  m_time = 0;
+  }
+
+/**
+ * Publish: add the accumulated increments to the metrics selected
+ */
+void OvmsBatteryIntegrator::Publish()
+  {
+  if (m_samples == 0)
+    return;
+
+  int64_t eu, er, cu, cr;
+  portENTER_CRITICAL(&m_spinlock);
+  eu = m_energy_used;
+  er = m_energy_recd;
+  cu = m_charge_used;
+  cr = m_charge_recd;
+  portEXIT_CRITICAL(&m_spinlock);
+
+  if (m_publish & INTEGRATOR_ENERGY_TRIP)
+    {
+    Publish(m_out[0], eu, 1/UJ_PER_KWH, kWh);
+    Publish(m_out[1], er, 1/UJ_PER_KWH, kWh);
+    }
+  if (m_publish & INTEGRATOR_ENERGY_TOTAL)
+    {
+    Publish(m_out[2], eu, 1/UJ_PER_KWH, kWh);
+    Publish(m_out[3], er, 1/UJ_PER_KWH, kWh);
+    }
+  if (m_publish & INTEGRATOR_CHARGE_TRIP)
+    {
+    Publish(m_out[4], cu, 1/UC_PER_AH, AmpHours);
+    Publish(m_out[5], cr, 1/UC_PER_AH, AmpHours);
+    }
+  if (m_publish & INTEGRATOR_CHARGE_TOTAL)
+    {
+    Publish(m_out[6], cu, 1/UC_PER_AH, AmpHours);
+    Publish(m_out[7], cr, 1/UC_PER_AH, AmpHours);
+    }
+  }
+
+/**
+ * Publish: update a metric from the accumulator
+ *  The metric value is computed from a base value taken at the first publish or
+ *  after an external change (e.g. trip reset), so float rounding does not add
+ *  up over the single increments.
+ */
+void OvmsBatteryIntegrator::Publish(output_t &out, int64_t acc, double scale, metric_unit_t unit)
+  {
+  if (acc == out.acc)
+    return;
+  float current = out.metric->AsFloat();
+  if (!out.valid || current != out.published)
+    {
+    out.base = current;
+    out.baseacc = out.acc;
+    out.valid = true;
+    }
+  out.metric->SetValue((float)(out.base + (acc - out.baseacc) * scale), unit);
+  out.published = out.metric->AsFloat();
+  out.acc = acc;
+  }
@@ -0,0 +1,107 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_INTEGRATOR_H__
+#define __VEHICLE_INTEGRATOR_H__
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "ovms_metrics.h"
+
+// Publish selection:
+#define INTEGRATOR_ENERGY_TRIP    0x01    // ms_v_bat_energy_used / _recd
+#define INTEGRATOR_ENERGY_TOTAL   0x02    // ms_v_bat_energy_used_total / _recd_total
+#define INTEGRATOR_CHARGE_TRIP    0x04    // ms_v_bat_coulomb_used / _recd
+#define INTEGRATOR_CHARGE_TOTAL   0x08    // ms_v_bat_coulomb_used_total / _recd_total
+#define INTEGRATOR_ALL            0x0f
+
+/**
+ * OvmsBatteryIntegrator: CAN rate battery energy & charge counter
+ *
+ *  Vehicle modules feed battery voltage & current samples directly from their
+ *  frame handlers, integration is done by the trapezoidal rule on the sample
+ *  timestamps, segments crossing zero are split into used & recovered parts.
+ *  Integration is suspended across sample gaps exceeding the max gap.
+ *
+ *  Feed() only updates integer accumulators (µJ / µC), the metrics are updated
+ *  by Publish(), called once per second by the vehicle framework. Publishing
+ *  adds the increments to the current metric values, so modules can still reset
+ *  or restore the trip & total metrics as before.
+ */
+class OvmsBatteryIntegrator
+  {
+  public:
+    OvmsBatteryIntegrator();
+    ~OvmsBatteryIntegrator();
+
+  public:
+    void Feed(float voltage, float current, int64_t time_us=0);
+    void Restart();
+    void Publish();
+
+  public:
+    void SetPublish(uint8_t mask) { m_publish = mask; }
+    void SetMaxGap(uint32_t gap_ms) { m_maxgap = (int64_t) gap_ms * 1000; }
+    bool IsActive() { return m_samples != 0; }
+    uint32_t GetSamples() { return m_samples; }
+    uint32_t GetGaps() { return m_gaps; }
+
+  protected:
+    struct output_t
+      {
+      OvmsMetricFloat*  metric;
+      float             published;      // Value set by last publish
+      int64_t           acc;            // Accumulator state at last publish
+      double            base;           // Metric value at rebase
+      int64_t           baseacc;        // … and accumulator state
+      bool              valid;
+      };
+    void Publish(output_t &out, int64_t acc, double scale, metric_unit_t unit);
+
+  protected:
+    portMUX_TYPE        m_spinlock = portMUX_INITIALIZER_UNLOCKED;
+    int64_t             m_energy_used;  // Accumulators [µJ / µC]
+    int64_t             m_energy_recd;
+    int64_t             m_charge_used;
+    int64_t             m_charge_recd;
+
+  protected:
+    int64_t             m_time;         // Last sample (producer side)
+    float               m_power;
+    float               m_current;
+    int64_t             m_maxgap;       // [µs]
+    uint32_t            m_samples;
+    uint32_t            m_gaps;
+
+  protected:
+    uint8_t             m_publish;
+    output_t            m_out[8];
+  };
+
+#endif //#ifndef __VEHICLE_INTEGRATOR_H__
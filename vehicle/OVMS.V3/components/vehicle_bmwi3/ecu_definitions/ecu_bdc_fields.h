@@ -0,0 +1,1913 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/bdc.json: BDC 40: Body domain controller
+// This generated code  makes it easier to process CANBUS messages from the BDC ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PIA_NR_AKTUELL[] = {   // 0x0F27
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_NR_AKTUELL", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_LIN_EINLERNVORGANG[] = {   // 0xA118
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WISCHER_LIN_EINLERNVORGANG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_SELBSTTEST[] = {   // 0xA322
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_SELBSTTEST_NR", "0-n" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_SELBSTTEST_FC_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_REGENSENSOR_INITIALISIERUNG[] = {   // 0xA3B7
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REGENSENSOR_INIT_VORGANG_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LEUCHTEN_KALTUEBERWACHUNG[] = {   // 0xA530
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KALTUEBERWACHUNG_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LEUCHTEN_WARMUEBERWACHUNG[] = {   // 0xA531
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WARMUEBERWACHUNG_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_GURTZUBRINGER_INIT[] = {   // 0xA71A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_FA_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_BF_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ELV_ANLIEFERZUSTAND[] = {   // 0xAA73
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ELV_ANLIEFERZUSTAND", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SMO_SIMULATION_BEDIENUNG[] = {   // 0xAA80
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSFUEHRUNGSSTATUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STEUERN_CA_BROADCAST[] = {   // 0xAC54
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM2", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM3", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM4", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM5", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM6", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM7", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_SCHL_NUM8", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STEUERN_CA_ANTENNEN_TEST[] = {   // 0xAC55
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_TEST_OKAY", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_1", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_2", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_3", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_4", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_5", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_6", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_7", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_8", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_1", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_2", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_3", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_4", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_5", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_6", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_7", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_8", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STEUERN_FBD_EMPFAENGER_INIT[] = {   // 0xAC58
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FBD_EMPFAENGER_INIT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FBD_REICHWEITENMESSUNG[] = {   // 0xAC5D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REICHWEITENMESSUNG_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FBD_FEHLER[] = {   // 0xAC5E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_X", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_RESETS_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE1_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE2_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE3_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE4_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE1_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE2_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE3_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE4_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE1_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE2_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE3_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE4_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ELSV_TASTER[] = {   // 0xD070
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_ELSV_HINTEN_EIN", "0/1" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_ELSV_OBEN_EIN", "0/1" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_ELSV_UNTEN_EIN", "0/1" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_ELSV_VORNE_EIN", "0/1" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_ELSV_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKRADHEIZUNG_TASTER[] = {   // 0xD073
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRADHEIZUNG_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ELSV_STATEMACHINE[] = {   // 0xD07B
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_STATEMACHINE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ELSV_VORHANDEN[] = {   // 0xD07F
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_ELSV_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKRAD_MFL[] = {   // 0xD081
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_SET_EIN", "0-n" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_TIPPRAENDEL_NR", "0-n" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_RES_EIN", "0-n" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_UMSCHALT_TASTE_EIN", "0-n" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_ACC_ABSTAND_EIN", "0-n" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_OFF_EIN", "0-n" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_PUSH_TO_TALK_EIN", "0-n" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_MODE_TASTE", "0-n" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_TIPPRAENDEL_BC_NR", "0-n" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_TEL_EIN", "0-n" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_VOL_MINUS_EIN", "0-n" },
+  {   11, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_VOL_PLUS_EIN", "0-n" },
+  {   12, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL1_NR", "0-n" },
+  {   13, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL2_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ELSV_POS_STATUS[] = {   // 0xD089
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ELSV_POS_HOEHE_WERT", "Digit" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ELSV_POS_LAENGE_WERT", "Digit" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_OBEN_EIN", "0/1" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_UNTEN_EIN", "0/1" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_EINGEFAHREN_EIN", "0/1" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_AUSGEFAHREN_EIN", "0/1" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_OBEN_EIN", "0/1" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_UNTEN_EIN", "0/1" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_EINGEFAHREN_EIN", "0/1" },
+  {   11, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_AUSGEFAHREN_EIN", "0/1" },
+  {   12, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ELSV_NORMIERUNG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SMO_SPIELSCHUTZZAEHLER[] = {   // 0xD096
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPIELSCHUTZZAEHLER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SMO_VARIANTE[] = {   // 0xD098
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAHRZEUGTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PLOCK[] = {   // 0xD09D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PLOCK_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZUSATZINFO_LICHT[] = {   // 0xD0F1
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_STAND_1_WERT", "km" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENBN_AEP_STATUS_1_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_U_BATT_ANFANG_1_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DAUER_1_WERT", "min" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHT_1_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTUNG_LICHT_1_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_1_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLEMMENSTATUS_1_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_STAND_2_WERT", "km" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENBN_AEP_STATUS_2_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_U_BATT_ANFANG_2_WERT", "V" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DAUER_2_WERT", "min" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHT_2_NR", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTUNG_LICHT_2_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_2_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLEMMENSTATUS_2_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HANDBREMSE_KONTAKT[] = {   // 0xD130
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HANDBREMSE_KONTAKT_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_HINTEN_TASTER_LINKS[] = {   // 0xD161
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_HINTEN_LINKS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_HINTEN_TASTER_RECHTS[] = {   // 0xD162
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_HINTEN_RECHTS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FA_TASTER[] = {   // 0xD188
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FA_FA_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FA_BF_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FA_FAH_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FA_BFH_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FA_HS_NR", "0-n" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TASTER_FA_RESERVE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BF_TASTER[] = {   // 0xD189
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_BF_BF_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FAH_TASTER[] = {   // 0xD18A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_FAH_FAH_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BFH_TASTER[] = {   // 0xD18B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_BFH_BFH_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_KISI_LED[] = {   // 0xD18D
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_KISI_LED_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FA_BEWEGUNG[] = {   // 0xD1A7
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_HALL_MAX_WERT", "Ink" },
+  {    7, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_MM_WERT", "mm" },
+  {    9, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_MM_MAX_WERT", "mm" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_POSITION_PROZENT_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_LAGE_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_ZUSTAND_TUER_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_FREIGABE_AKTIV_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FA_RESERVE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BF_BEWEGUNG[] = {   // 0xD1A8
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_HALL_MAX_WERT", "Ink" },
+  {    7, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_MM_WERT", "mm" },
+  {    9, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_MM_MAX_WERT", "mm" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_POSITION_PROZENT_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_LAGE_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_ZUSTAND_TUER_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_FREIGABE_AKTIV_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BF_RESERVE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FAH_BEWEGUNG[] = {   // 0xD1A9
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_HALL_MAX_WERT", "Ink" },
+  {    7, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_MM_WERT", "mm" },
+  {    9, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_MM_MAX_WERT", "mm" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_POSITION_PROZENT_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_LAGE_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_ZUSTAND_TUER_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_FREIGABE_AKTIV_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FAH_RESERVE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BFH_BEWEGUNG[] = {   // 0xD1AA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_HALL_MAX_WERT", "Ink" },
+  {    7, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_MM_WERT", "mm" },
+  {    9, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_MM_MAX_WERT", "mm" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_POSITION_PROZENT_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_LAGE_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_ZUSTAND_TUER_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_FREIGABE_AKTIV_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BFH_RESERVE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BFH_RELAIS[] = {   // 0xD1AD
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT", "mV" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BFH_HALLSENSOREN[] = {   // 0xD1AE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSZTAND_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSZTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FAH_RELAIS[] = {   // 0xD1AF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1AF", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1AF", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1AF", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1AF", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1AF", "mV" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1AF", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FAH_HALLSENSOREN[] = {   // 0xD1B0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B0", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B0", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSZTAND_NR_0XD1B0", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B0", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_1", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSZTAND_NR_0XD1B0", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FA_RELAIS[] = {   // 0xD1B1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B1", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1B1", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B1", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1B1", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B1", "mV" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B1", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FA_HALLSENSOREN[] = {   // 0xD1B2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B2", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B2", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B2", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1B2", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BF_RELAIS[] = {   // 0xD1B3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B3", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1B3", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B3", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1B3", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B3", "mV" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B3", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BF_HALLSENSOREN[] = {   // 0xD1B4
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B4", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B4", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR_0XD1B4", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B4", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1B4", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR_0XD1B4", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FA_STATUS_DETAIL[] = {   // 0xD1B5
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_KURZHUB_VORHANDEN", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_MOTORTEMPERATUR_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_FH_FA_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_MT_LIEFERANT_NR", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FA_MT_SW_VERSION_WERT", "HEX" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FA_MT_PARAMETER_VERSION_WERT", "HEX" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_STATUS_VON_FAH", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_WACHHALTEN", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_FZG_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FA_RELATIVZEIT_WERT", "s" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_EKS_AKTIV", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FA_SYSTEMTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BF_STATUS_DETAIL[] = {   // 0xD1B6
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_KURZHUB_VORHANDEN", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_MOTORTEMPERATUR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_FH_BF_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_MT_LIEFERANT", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BF_MT_SW_VERSION_WERT", "HEX" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BF_MT_PARAMETER_VERSION_WERT", "HEX" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_STATUS_VON_BFH", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_WACHHALTEN", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_FZG_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BF_RELATIVZEIT_WERT", "s" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_EKS_AKTIV", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BF_SYSTEMTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_FAH_STATUS_DETAIL[] = {   // 0xD1B7
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_KURZHUB_VORHANDEN", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_MOTORTEMPERATUR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_FH_FAH_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_MT_LIEFERANT", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FAH_MT_SW_VERSION_WERT", "HEX" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FAH_MT_PARAMETER_VERSION_WERT", "HEX" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_STATUS_VON_FA", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_WACHHALTEN", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_FZG_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_FAH_RELATIVZEIT_WERT", "s" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_EKS_AKTIV", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_FAH_SYSTEMTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FH_BFH_STATUS_DETAIL[] = {   // 0xD1B8
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_KURZHUB_VORHANDEN", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_MOTORTEMPERATUR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_FH_BFH_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_MT_LIEFERANT", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BFH_MT_SW_VERSION_WERT", "HEX" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BFH_MT_PARAMETER_VERSION_WERT", "HEX" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_STATUS_VON_BF", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_WACHHALTEN", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_FZG_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FH_BFH_RELATIVZEIT_WERT", "s" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_EKS_AKTIV", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FH_BFH_SYSTEMTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_SITZEXT_TASTEN[] = {   // 0xD1CA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZMEMORY_FA", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZMEMORY_BF", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZMEMORY_FAH", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZMEMORY_BFH", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MASSAGE_FA", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MASSAGE_BF", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MASSAGE_FAH", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MASSAGE_BFH", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FERNBEDIENUNG_FA", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESET_TASTE_BF", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHLAFPOSITION_TASTE_BFTH", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZPOSITION_TASTE_BFTH", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_SITZEXT_VORHANDEN[] = {   // 0xD1CB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SITZEXT_VORNE", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SITZEXT_HINTEN", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_TANK_FUELLSTAND_LINKS[] = {   // 0xD258
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FUELLSTAND_TANK_LI_WERT", "Ohm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_TANK_FUELLSTAND_RECHTS[] = {   // 0xD259
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FUELLSTAND_TANK_RE_WERT", "Ohm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HUPE_TASTER[] = {   // 0xD297
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_HUPE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_THERMOSCHUTZ[] = {   // 0xD321
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_THERMOSCHUTZ_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_LIN[] = {   // 0xD329
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LIN_SPIEGEL_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_MEM_VORHANDEN[] = {   // 0xD32B
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_MEMORY_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_HEIZUNG_VERBAUT[] = {   // 0xD32E
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_HEIZUNG_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_EC_SPIEGEL_VORHANDEN[] = {   // 0xD330
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_EC_SPIEGEL", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_TASTER[] = {   // 0xD331
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_BEIKLAPPEN_EIN", "0/1" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_SCHALTER_FA_EIN", "0/1" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_LINKS_EIN", "0/1" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_OBEN_EIN", "0/1" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_RECHTS_EIN", "0/1" },
+  {   10, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_UNTEN_EIN", "0/1" },
+  {   12, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_KLAPPEN_VORHANDEN[] = {   // 0xD332
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_BEIKLAPPEN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_UGDO_VORHANDEN[] = {   // 0xD33A
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_UGDO", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSENSPIEGEL_ABBLENDEN_VORHANDEN[] = {   // 0xD33C
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_ABBLENDEN_EIN", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_UGDO_LAND[] = {   // 0xD33D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UGDO_LAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_UGDO_MODE[] = {   // 0xD33E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UGDO_MODE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KOMPASS_SPIEGEL_VORHANDEN[] = {   // 0xD343
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_VORHANDEN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KOMPASS_SPIEGEL_MAGNET[] = {   // 0xD344
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_MAGNET_ZONE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KOMPASS_SPIEGEL_SPRACHE[] = {   // 0xD345
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_SPRACHE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KOMPASS_SPIEGEL_LENKUNG[] = {   // 0xD346
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_LENKUNG_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_FRONT_MOTOR[] = {   // 0xD351
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_FRONTWISCHER_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_HECK_MOTOR[] = {   // 0xD353
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_HECKWISCHER_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SRA_RELAIS[] = {   // 0xD354
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_SRA_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WASCHWASSERSTAND[] = {   // 0xD357
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WASCHWASSERSTAND_EIN", "0/1" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_WASCHWASSERSTAND_WERT", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_HECK_VORHANDEN[] = {   // 0xD358
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_HECKWISCHER_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SRA_VORHANDEN[] = {   // 0xD359
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SRA", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_WISCHER[] = {   // 0xD35B
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_TASTER_AXIAL_EIN", "0-n" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_FRONTWASCHEN", "0/1" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_HECKWASCHEN", "0/1" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_HECKWISCHEN", "0/1" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_INTERVALL", "0/1" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_NULLSTELLUNG", "0/1" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_1", "0/1" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_2", "0/1" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_RAENDEL_NR", "0-n" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_TIPPWISCHEN", "0/1" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_FRONT_LIN[] = {   // 0xD35E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LIN_FRONTWISCHER", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_REGENSENSOR_VORHANDEN[] = {   // 0xD373
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_REGENSENSOR_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_REGENSENSOR_INIT[] = {   // 0xD375
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REGENSENSOR_INIT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_REGENSENSOR_INT_WERT[] = {   // 0xD376
+  {    0, BMW_UDS_SINT  , 0              , 0.5f, 0.0f, "STAT_REGEN_INT_WERT", "%" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FAHRLICHTSENSOR[] = {   // 0xD3BE
+  {    0, BMW_UDS_UINT  , 0              , 6.7f, 0.0f, "STAT_FRONTLICHT_WERT", "mW/m²" },
+  {    2, BMW_UDS_UINT  , 0              , 6.7f, 0.0f, "STAT_FRONTLICHT_GEMITTELT_WERT", "mW/m²" },
+  {    4, BMW_UDS_SINT  , 0              , 100.0f, 0.0f, "STAT_UMGEBUNGSLICHT_WERT", "Lux" },
+  {    6, BMW_UDS_SINT  , 0              , 100.0f, 0.0f, "STAT_UMGEBUNGSLICHT_GEMITTELT_WERT", "Lux" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_HUD_WERT", "Digit" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_WERT_0XD3BE", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FAHRLICHTSENSOR_VORHANDEN[] = {   // 0xD3BF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FAHRLICHTSENSOR", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HOD_LENKRAD[] = {   // 0xD3F0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HOD_STATUS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HOD_ZUSTAND_GAP[] = {   // 0xD3F1
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ADC_ROHWERT_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_LIN_DATEN_LESEN[] = {   // 0xD505
+  {    0, BMW_UDS_UINT  , 0              , 100.0f, 0.0f, "STAT_ANZAHL_WISCHZYKLEN_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CARCODE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_WISCHER_HECK_MOTOR_2[] = {   // 0xD507
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_HECKWISCHER_2_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE[] = {   // 0xD52C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INNENLICHT", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LESELICHT_LINKS", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LESELICHT_RECHTS", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WELCOMELIGHT", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AMBIENTELICHT", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_LINKS", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_RECHTS", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_VORNE[] = {   // 0xD53A
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LESELICHT_LINKS_VORNE", "0/1" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LESELICHT_RECHTS_VORNE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LICHTSCHALTER_WBL_TASTER_BEL[] = {   // 0xD53D
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TASTER_WBL_BEL_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_RUECKWAERTSGANG_SCHALTER[] = {   // 0xD540
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SCHALTER_RUECK_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SCHEINWERFER_GRUNDSTELLUNG_STATUS[] = {   // 0xD541
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_GRUNDSTELLUNG_SCHEINWERFER_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_VORNE_VORHANDEN[] = {   // 0xD544
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LESELICHT_VORNE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_HINTEN_VORHANDEN[] = {   // 0xD545
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LESELICHT_HINTEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_DYNAMISCH_SCHRITTE_REFLAUF[] = {   // 0xD548
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LWR_SCHRITTE_REF_LAUF_WERT", "Ink" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHT_HINTEN_TASTER[] = {   // 0xD54B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_TASTER_HINTEN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHT_VORNE_TASTER[] = {   // 0xD54C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_TASTER_VORNE_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_VORNE_DAUER_AUS_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_BELADUNGSSENSOR[] = {   // 0xD54D
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_BELADUNGSSENSOR_VORNE_WERT", "mm" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_BELADUNGSSENSOR_HINTEN_WERT", "mm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_HINTEN_RECHTS_TASTER[] = {   // 0xD54E
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_HINTEN_RECHTS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_MANUELL_POTI[] = {   // 0xD54F
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_POTI_MAN_LWR_WERT", "Ink" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LICHTSCHALTEREINHEIT[] = {   // 0xD550
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_AL_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_FLC_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_NEUTRAL_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_STL_EIN", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LICHTSCHALTER_WBL_TASTER[] = {   // 0xD552
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_WBL_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_HINTEN[] = {   // 0xD553
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LESELICHT_LINKS_HINTEN", "0/1" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LESELICHT_RECHTS_HINTEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PIA_FLA_FOLLOW[] = {   // 0xD555
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_FLA_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_FOLLOW_ME_HOME_ZEIT_WERT", "s" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_WELCOMELIGHT_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SCHALTERBELEUCHTUNG_RAENDELRAD[] = {   // 0xD557
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_POTI_DIMMUNG_WERT", "Ink" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PIA_ABBIEGELICHT[] = {   // 0xD559
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_ABBIEGELICHT_PIA_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PIA_TIPPBLINKEN[] = {   // 0xD55E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_MIND_ANZAHL_BLINKZYKLEN_BEI_TIPP_WERT", "Ink" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_QUITT_BLINK_ENTRIEGELN_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_QUITT_BLINK_SICHERN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_MANUELL[] = {   // 0xD55F
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MAN_LWR_MAXPOS_WERT", "°" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MAN_LWR_MINPOS_WERT", "°" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MAN_LWR_LINKS_WERT", "°" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MAN_LWR_RECHTS_WERT", "°" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_PIA_TAGFAHRLICHT[] = {   // 0xD573
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIA_TAGFAHRLICHT_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHT_HINTEN[] = {   // 0xD57B
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_HINTEN_EIN", "0/1" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_HINTEN_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_MODUS[] = {   // 0xD57E
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_KEINE_LWR_EIN", "0/1" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MAN_LWR_EIN", "0/1" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUT_LWR_EIN", "0/1" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_DYN_LWR_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHT_KLEMME_VA[] = {   // 0xD57F
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_KLEMME_VA_EIN", "0/1" },
+  {    2, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_INNENLICHT_KLEMME_VA_NACHLAUFZEIT_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_BLINKER_TASTER_FLA[] = {   // 0xD580
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_FLA_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_BLINKER_TASTER_BC[] = {   // 0xD581
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_BC_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_BLINKER_FRA[] = {   // 0xD582
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LINKS_EIN", "0/1" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LINKS_DAUER_EIN", "0/1" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_RECHTS_EIN", "0/1" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_RECHTS_DAUER_EIN", "0/1" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_NULLSTELLUNG_EIN", "0/1" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_BLINKER_LICHTHUPE_FERNLICHT[] = {   // 0xD583
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_FERNLICHT_BETAETIGT", "0/1" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LICHTHUPE_BETAETIGT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKSTOCK_BLINKER_WIPPE[] = {   // 0xD585
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NACH_OBEN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NACH_UNTEN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NULLSTELLUNG", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_WIPPE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_HINTEN_LINKS_TASTER[] = {   // 0xD587
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_HINTEN_LINKS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_VORNE_RECHTS_TASTER[] = {   // 0xD588
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_VORNE_RECHTS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LESELICHT_VORNE_LINKS_TASTER[] = {   // 0xD589
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TASTER_LESELICHT_VORNE_LINKS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_POSITION_MIN_MAX[] = {   // 0xD58A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_POSITION_MAX_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_POSITION_MIN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LICHTSCHALTER_NSW_TASTER[] = {   // 0xD58B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_NSW_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LICHTSCHALTER_NSL_TASTER[] = {   // 0xD58C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_NSL_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AMBIENTE_BELEUCHTUNG[] = {   // 0xD5D3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AMBIENTE_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AMBIENTE_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_INNENLICHT_MAPPING[] = {   // 0xD5DE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_0", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_1", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_2", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_3", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_4", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_5", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_6", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_7", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BELEGUNG_LCI_8", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AHL_LWR_TMS_ID_LESEN[] = {   // 0xD5E5
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TMS_ID_LINKS_WERT", "HEX" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TMS_ID_RECHTS_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HOEHENSTAENDE_SENSOREN[] = {   // 0xD601
+  {    0, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_HOEHENSTAND_ROHWERT_VR_WERT", "V" },
+  {    2, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_HOEHENSTAND_ROHWERT_HR_WERT", "V" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_SENSOR_VR_NR", "0-n" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_SENSOR_HR_NR", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_VR_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_HR_NR", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_VR_NR_1", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HOEHENSTAND_HR_NR_1", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HOEHENSTAENDE_VERSORGUNG[] = {   // 0xD603
+  {    0, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_HOEHENSTAND_VERSORGUNG_VR_WERT", "V" },
+  {    2, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_HOEHENSTAND_VERSORGUNG_HR_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_FES_MODUS[] = {   // 0xD611
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FES_MODUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_FES_STATISTIK[] = {   // 0xD612
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ECO_GRUPPE_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COMFORT_GRUPPE_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SONSTIGE_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SWITCH_BOARD_TASTEN[] = {   // 0xD622
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xD622_D", "bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_FES_DATEN[] = {   // 0xD625
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FES_LASTMODE", "0-n" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FES_SLEEPTIME_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SWITCHBOARD_TASTE_VERBAU[] = {   // 0xD627
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_HDC_TASTE", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_PDC_TASTE", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_SV_TASTE", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_DSC_TASTE", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_FES_WIPPE", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBAU_HUD_TASTE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUSSTATTUNG_CORONA_LED[] = {   // 0xD62B
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_CORONA_LED", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FES_MASTER_SW_FEHLER_INFO[] = {   // 0xD62D
+  {    0, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_FES_MASTER_SW_FEHLER_INFO_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SWITCH_BOARD_TASTEN_VERBAU[] = {   // 0xD669
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xD669_D", "bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KUEHLMITTELSTAND[] = {   // 0xD672
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KUEHLMITTELSTAND_EIN", "0/1" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLMITTELSTAND_WERT", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_GURTZUBRINGER_FA[] = {   // 0xD71A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GZB_FA_POS_WERT", "Ink" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GZB_FA_ENDLAGE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_GURTZUBRINGER_BF[] = {   // 0xD71B
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GZB_BF_POS_WERT", "Ink" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GZB_BF_ENDLAGE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_FA_VORHANDEN[] = {   // 0xD726
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_BF_VORHANDEN[] = {   // 0xD727
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_FAH_VORHANDEN[] = {   // 0xD728
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_BFH_VORHANDEN[] = {   // 0xD729
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_SITZHEIZUNG_STUFE_BF[] = {   // 0xD72D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_SITZHEIZUNG_BF_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_BF[] = {   // 0xD730
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_VERBRAUCHSREDUZIERUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_NOTBETRIEB_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_TIMEOUT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_SITZHEIZUNG_STUFE_FA[] = {   // 0xD731
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_SITZHEIZUNG_FA_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_VORHANDEN_DRITTE_SITZREIHE_EIN[] = {   // 0xD762
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_DRITTE_SITZREIHE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_VERRIEGELUNG_ZWEITE_SITZREIHE[] = {   // 0xD763
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERRIEGELUNG_ZWEITE_SITZREIHE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_FA[] = {   // 0xD771
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_VERBRAUCHSREDUZIERUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_NOTBETRIEB_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_TIMEOUT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_FAH[] = {   // 0xD7EA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_VERBRAUCHSREDUZIERUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_NOTBETRIEB_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_TIMEOUT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_BFH[] = {   // 0xD7EC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_VERBRAUCHSREDUZIERUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_NOTBETRIEB_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_TIMEOUT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SITZHEIZUNG_HINTEN_TASTER_VORHANDEN[] = {   // 0xD86C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SITZHEIZUNG_TASTER_HINTEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_VORHANDEN_FONDSCHICHTUNG[] = {   // 0xD8AA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FONDSCHICHTUNGSPOTI", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SOLARSENSOR_VORHANDEN[] = {   // 0xD8AB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SOLARSENSOR_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUC_SENSOR_VORHANDEN[] = {   // 0xD8AC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_AUC_SENSOR", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FENSTERHEBER_VORHANDEN[] = {   // 0xD8FE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_FH_KODIERT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KLIMAKOMPRESSOR[] = {   // 0xD906
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_KLIMAKOMPRESSOR_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMAKOMPRESSOR_PWM_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_VORHANDEN_KOMPRESSORKUPPLUNG[] = {   // 0xD916
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xD916_D", "bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_DRUCKSENSOR_VORHANDEN[] = {   // 0xD959
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DRUCKSENSOR_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_VORHANDEN_WASSERVENTIL[] = {   // 0xD95A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_MONO", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_DUO", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SOLARSENSOR[] = {   // 0xD961
+  {    0, BMW_UDS_UINT  , 0              , 4.0158f, 0.0f, "STAT_SOLARSENSOR_FA_WERT", "W/m²" },
+  {    2, BMW_UDS_UINT  , 0              , 4.0158f, 0.0f, "STAT_SOLARSENSOR_BF_WERT", "W/m²" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_AUC_SENSOR[] = {   // 0xD963
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUC_SENSOR_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_DRUCKSENSOR[] = {   // 0xD967
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R134A_DRUCK_WERT", "bar" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BESCHLAGSENSOR[] = {   // 0xD96C
+  {    0, BMW_UDS_SINT  , 0              , 0.5f, 0.0f, "STAT_BESCHLAGSENSOR_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BESCHLAGSENSOR_TEMP_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BESCHLAGSENSOR_VORHANDEN[] = {   // 0xD96D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_BESCHLAGSENSOR", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_FONDSCHICHTUNGS_POTI[] = {   // 0xD96E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FONDSCHICHTUNGS_POTI_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_DRUCKSENSOR_HOCHAUFLOESEND[] = {   // 0xD9B8
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_DRUCK_WERT", "bar" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LENKRAD_SCHALTPADDLES[] = {   // 0xDA24
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKRAD_SCHALTPADDLE_NR", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SCHALTPADDLES_AD_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_DC_DC_WANDLER_VORHANDEN[] = {   // 0xDA54
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DC_DC_WANDLER_1_VORHANDEN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DC_DC_WANDLER_2_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STAT_LIN_LAYERING[] = {   // 0xDA5F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_1_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_1_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_1_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_1_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_1_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_1_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_1_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_1_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_1_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_1_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_2_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_2_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_2_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_2_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_2_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_2_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_2_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_2_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_2_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_2_WERT", "" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_3_WERT", "" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_3_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_3_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_3_WERT", "" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_3_WERT", "" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_3_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_3_WERT", "" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_3_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_3_WERT", "" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_3_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_4_WERT", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_4_WERT", "" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_4_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_4_WERT", "" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_4_WERT", "" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_4_WERT", "" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_4_WERT", "" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_4_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_4_WERT", "" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_4_WERT", "" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_5_WERT", "" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_5_WERT", "" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_5_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_5_WERT", "" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_5_WERT", "" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_5_WERT", "" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_5_WERT", "" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_5_WERT", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_5_WERT", "" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_5_WERT", "" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_6_WERT", "" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_6_WERT", "" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_6_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_6_WERT", "" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_6_WERT", "" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_6_WERT", "" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_6_WERT", "" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_6_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_6_WERT", "" },
+  {   59, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_6_WERT", "" },
+  {   60, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_7_WERT", "" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_7_WERT", "" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_7_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_7_WERT", "" },
+  {   64, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_7_WERT", "" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_7_WERT", "" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_7_WERT", "" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_7_WERT", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_7_WERT", "" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_7_WERT", "" },
+  {   70, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_8_WERT", "" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_8_WERT", "" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_8_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_8_WERT", "" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_8_WERT", "" },
+  {   75, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_8_WERT", "" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_8_WERT", "" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_8_WERT", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_8_WERT", "" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_8_WERT", "" },
+  {   80, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_9_WERT", "" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_9_WERT", "" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_9_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_9_WERT", "" },
+  {   84, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_9_WERT", "" },
+  {   85, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_9_WERT", "" },
+  {   86, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_9_WERT", "" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_9_WERT", "" },
+  {   88, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_9_WERT", "" },
+  {   89, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_9_WERT", "" },
+  {   90, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_10_WERT", "" },
+  {   91, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_10_WERT", "" },
+  {   92, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_10_WERT", "" },
+  {   93, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_10_WERT", "" },
+  {   94, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_10_WERT", "" },
+  {   95, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_10_WERT", "" },
+  {   96, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_10_WERT", "" },
+  {   97, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_10_WERT", "" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_10_WERT", "" },
+  {   99, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_10_WERT", "" },
+  {  100, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_11_WERT", "" },
+  {  101, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_11_WERT", "" },
+  {  102, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_11_WERT", "" },
+  {  103, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_11_WERT", "" },
+  {  104, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_11_WERT", "" },
+  {  105, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_11_WERT", "" },
+  {  106, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_11_WERT", "" },
+  {  107, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_11_WERT", "" },
+  {  108, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_11_WERT", "" },
+  {  109, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_11_WERT", "" },
+  {  110, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_12_WERT", "" },
+  {  111, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_12_WERT", "" },
+  {  112, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_12_WERT", "" },
+  {  113, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_12_WERT", "" },
+  {  114, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_12_WERT", "" },
+  {  115, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_12_WERT", "" },
+  {  116, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_12_WERT", "" },
+  {  117, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_12_WERT", "" },
+  {  118, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_12_WERT", "" },
+  {  119, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_12_WERT", "" },
+  {  120, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_13_WERT", "" },
+  {  121, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_13_WERT", "" },
+  {  122, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_13_WERT", "" },
+  {  123, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_13_WERT", "" },
+  {  124, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_13_WERT", "" },
+  {  125, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_13_WERT", "" },
+  {  126, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_13_WERT", "" },
+  {  127, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_13_WERT", "" },
+  {  128, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_13_WERT", "" },
+  {  129, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_13_WERT", "" },
+  {  130, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_14_WERT", "" },
+  {  131, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_14_WERT", "" },
+  {  132, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_14_WERT", "" },
+  {  133, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_14_WERT", "" },
+  {  134, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_14_WERT", "" },
+  {  135, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_14_WERT", "" },
+  {  136, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_14_WERT", "" },
+  {  137, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_14_WERT", "" },
+  {  138, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_14_WERT", "" },
+  {  139, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_14_WERT", "" },
+  {  140, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_15_WERT", "" },
+  {  141, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_15_WERT", "" },
+  {  142, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_15_WERT", "" },
+  {  143, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_15_WERT", "" },
+  {  144, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_15_WERT", "" },
+  {  145, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_15_WERT", "" },
+  {  146, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_15_WERT", "" },
+  {  147, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_15_WERT", "" },
+  {  148, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_15_WERT", "" },
+  {  149, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_15_WERT", "" },
+  {  150, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_16_WERT", "" },
+  {  151, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_16_WERT", "" },
+  {  152, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_16_WERT", "" },
+  {  153, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_16_WERT", "" },
+  {  154, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_16_WERT", "" },
+  {  155, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_16_WERT", "" },
+  {  156, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_16_WERT", "" },
+  {  157, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_16_WERT", "" },
+  {  158, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_16_WERT", "" },
+  {  159, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_16_WERT", "" },
+  {  160, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_17_WERT", "" },
+  {  161, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_17_WERT", "" },
+  {  162, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_17_WERT", "" },
+  {  163, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_17_WERT", "" },
+  {  164, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_17_WERT", "" },
+  {  165, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_17_WERT", "" },
+  {  166, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_17_WERT", "" },
+  {  167, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_17_WERT", "" },
+  {  168, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_17_WERT", "" },
+  {  169, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_17_WERT", "" },
+  {  170, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_18_WERT", "" },
+  {  171, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_18_WERT", "" },
+  {  172, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_18_WERT", "" },
+  {  173, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_18_WERT", "" },
+  {  174, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_18_WERT", "" },
+  {  175, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_18_WERT", "" },
+  {  176, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_18_WERT", "" },
+  {  177, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_18_WERT", "" },
+  {  178, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_18_WERT", "" },
+  {  179, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_18_WERT", "" },
+  {  180, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_19_WERT", "" },
+  {  181, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_19_WERT", "" },
+  {  182, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_19_WERT", "" },
+  {  183, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_19_WERT", "" },
+  {  184, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_19_WERT", "" },
+  {  185, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_19_WERT", "" },
+  {  186, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_19_WERT", "" },
+  {  187, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_19_WERT", "" },
+  {  188, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_19_WERT", "" },
+  {  189, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_19_WERT", "" },
+  {  190, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_20_WERT", "" },
+  {  191, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_20_WERT", "" },
+  {  192, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_20_WERT", "" },
+  {  193, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_20_WERT", "" },
+  {  194, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_20_WERT", "" },
+  {  195, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_20_WERT", "" },
+  {  196, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_20_WERT", "" },
+  {  197, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_20_WERT", "" },
+  {  198, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_20_WERT", "" },
+  {  199, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_20_WERT", "" },
+  {  200, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_21_WERT", "" },
+  {  201, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_21_WERT", "" },
+  {  202, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_21_WERT", "" },
+  {  203, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_21_WERT", "" },
+  {  204, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_21_WERT", "" },
+  {  205, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_21_WERT", "" },
+  {  206, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_21_WERT", "" },
+  {  207, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_21_WERT", "" },
+  {  208, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_21_WERT", "" },
+  {  209, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_21_WERT", "" },
+  {  210, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_22_WERT", "" },
+  {  211, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_22_WERT", "" },
+  {  212, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_22_WERT", "" },
+  {  213, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_22_WERT", "" },
+  {  214, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_22_WERT", "" },
+  {  215, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_22_WERT", "" },
+  {  216, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_22_WERT", "" },
+  {  217, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_22_WERT", "" },
+  {  218, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_22_WERT", "" },
+  {  219, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_22_WERT", "" },
+  {  220, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_23_WERT", "" },
+  {  221, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_23_WERT", "" },
+  {  222, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_23_WERT", "" },
+  {  223, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_23_WERT", "" },
+  {  224, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_23_WERT", "" },
+  {  225, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_23_WERT", "" },
+  {  226, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_23_WERT", "" },
+  {  227, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_23_WERT", "" },
+  {  228, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_23_WERT", "" },
+  {  229, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_23_WERT", "" },
+  {  230, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_24_WERT", "" },
+  {  231, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_24_WERT", "" },
+  {  232, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_24_WERT", "" },
+  {  233, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_24_WERT", "" },
+  {  234, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_24_WERT", "" },
+  {  235, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_24_WERT", "" },
+  {  236, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_24_WERT", "" },
+  {  237, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_24_WERT", "" },
+  {  238, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_24_WERT", "" },
+  {  239, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_24_WERT", "" },
+  {  240, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_25_WERT", "" },
+  {  241, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_25_WERT", "" },
+  {  242, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_25_WERT", "" },
+  {  243, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_25_WERT", "" },
+  {  244, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_25_WERT", "" },
+  {  245, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_25_WERT", "" },
+  {  246, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_25_WERT", "" },
+  {  247, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_25_WERT", "" },
+  {  248, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_25_WERT", "" },
+  {  249, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_25_WERT", "" },
+  {  250, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLAVE_NAME_26_WERT", "" },
+  {  251, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_BLUE_26_WERT", "" },
+  {  252, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_GREEN_26_WERT", "" },
+  {  253, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RED_26_WERT", "" },
+  {  254, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BRIGHTNESS_26_WERT", "" },
+  {  255, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_WHITE_26_WERT", "" },
+  {  256, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_26_WERT", "" },
+  {  257, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_26_WERT", "" },
+  {  258, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_26_WERT", "" },
+  {  259, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLER_INTERN_26_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN[] = {   // 0xDA61
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_FRONTKLAPPE", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_HECKKLAPPE", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_HECKSCHEIBE", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_MOTORHAUBE", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_SPLITDOORS", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_TUERKONTAKT_BFH_OBEN[] = {   // 0xDA7B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TUERKONTAKT_BFH_OBEN", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_TUERKONTAKT_FAH_OBEN[] = {   // 0xDA7E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TUERKONTAKT_FA_OBEN", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_BEIFAHRER[] = {   // 0xDA81
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BF_ENTRIEGELT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BF_VERRIEGELT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BF_GESICHERT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_BEIFAHRER_HINTEN[] = {   // 0xDA82
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BFH_ENTRIEGELT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BFH_VERRIEGELT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BFH_GESICHERT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_FAHRER[] = {   // 0xDA83
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FA_ENTRIEGELT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FA_VERRIEGELT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FA_GESICHERT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_FAHRER_HINTEN[] = {   // 0xDA84
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FAH_ENTRIEGELT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FAH_VERRIEGELT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FAH_GESICHERT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_HECKKLAPPE[] = {   // 0xDA85
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_HECKKLAPPE_ENTRIEGELT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_HECKKLAPPE_VERRIEGELT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_HECKSCHEIBE[] = {   // 0xDA86
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_HECKSCHEIBE_ENTRIEGELT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_HECKSCHEIBE_VERRIEGELT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_GESAMT[] = {   // 0xDA87
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FA_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BF_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_FAH_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_BFH_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ZV_KURZSCHLUSSABSCHALTUNG[] = {   // 0xDA95
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKKLAPPE_KURZSCHLUSSABSCHALTUNG_AKTIV", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKSCHEIBE_KURZSCHLUSSABSCHALTUNG_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SPANNUNG_KLEMMEN[] = {   // 0xDAB3
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_1_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_2_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_3_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_KLEMME_15WUP", "0/1" },
+  {    8, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15N1_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15N2_WERT", "V" },
+  {   12, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15_WERT", "V" },
+  {   14, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_STROM_KLEMME_15_50_WERT", "A" },
+  {   16, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_50_WERT", "V" },
+  {   18, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_50MSA_WERT", "V" },
+  {   20, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_STROM_LF_WERT", "A" },
+  {   22, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_DIAG_LF_WERT", "V" },
+  {   24, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_31ELV_WERT", "V" },
+  {   26, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30ELV_WERT", "V" },
+  {   28, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_INNENTEMPERATUR_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KEY_VALID_NR_AKTUELL[] = {   // 0xDAB4
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KEY_VAILD_NR_AKTUELL", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_CA_TAGE_ER_LEITUNG[] = {   // 0xDAB5
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_ER_FT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_ER_BFT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_ER_FTH", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_ER_BFTH", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_START_STOP_TASTER[] = {   // 0xDAB6
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SST_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_KLEMMEN_VERHINDERER[] = {   // 0xDABA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL15_EIN_VERHINDERER", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL15_AUS_VERHINDERER", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL50_EIN_VERHINDERER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_DATUM_ZEIT[] = {   // 0xDABB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_STUNDEN_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_MINUTEN_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_DATUM_TAG_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_DATUM_MONAT_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_DATUM_JAHR_WERT", "" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_RELATIV_WERT", "s" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_TAGE_RELATIV_WERT", "d" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_DME1[] = {   // 0xDABC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_GANG", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_MOTOR_LAEUFT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_MOTOR_FREIGABE", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_ANLASSER_SPERRE", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_KUPPLUNG", "0-n" },
+  {    5, BMW_UDS_UINT  , 0              , 0.25f, 0.0f, "STAT_BUS_IN_DREHZAHL_WERT", "1/min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_DSC[] = {   // 0xDABD
+  {    0, BMW_UDS_UINT  , 0              , 0.015625f, 0.0f, "STAT_BUS_IN_GESCHW_WERT", "km/h" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_GESCHW_STATUS", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_BREMSPEDAL", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BUS_IN_FH[] = {   // 0xDABF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_FH_FT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_FH_BFT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_FH_FTH", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_FH_BFTH", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_CA_TAGE_STATUS[] = {   // 0xDACA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_FT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_BFT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_FTH", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAGE_BFTH", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SPANNUNG_KLEMME_30L1[] = {   // 0xDAD6
+  {    0, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30L1_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_SPANNUNG_KLEMME_30L2[] = {   // 0xDAD7
+  {    0, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30L2_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG[] = {   // 0xDB12
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N1_AKTIV", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N2_AKTIV", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL30BACSM_AKTIV", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL301_AKTIV", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL302_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HECKKLAPPENSENSOR[] = {   // 0xDB16
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKKLAPPENSENSOR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_NACHLAUFZEIT_KLEMME_15N[] = {   // 0xDB2D
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHLAUFZEIT_KLEMME_15N_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_NACHLAUFZEIT_KLEMME_30B[] = {   // 0xDB2E
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHLAUFZEIT_KLEMME_30B_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_KLEMMEN[] = {   // 0xDC56
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLEMMENSTATUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_STATUS_KL15_ABSCHALTUNG[] = {   // 0xDC57
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_OBDKOMMUNIKATION_AKTIV", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_BREMSE_AKTIV", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_MOTORLAUF_AKTIV", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_KUPPLUNG_AKTIV", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_ENERGIESPARMODE_AKTIV", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_AKTIV", "0/1" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_MSA_AKTIV", "0/1" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_ABBLENDLICHT_AKTIV", "0/1" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_WAEHLHEBEL_IN_N_AKTIV", "0/1" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_DIAGNOSE_AKTIV", "0/1" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_FLA_MODE", "0/1" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_AKTIV", "0/1" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOMATISCHE_ABSCHALTUNG_DURCHGEFUEHRT", "0/1" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_PRAESENTATIONSMODUS_AKTIV", "0/1" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_UNPLAUSIBEL_AKTIV", "0/1" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_FREMDLADUNG_HYBRID_AKTIV", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GURT_FAHRER_GESTECKT_AKTIV", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_GURT_AKTIV", "0/1" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_KLAPPENWECHSEL_AKTIV", "0/1" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_OSFG_ERREICHT_AKTIV", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_TIMEOUT_OSFG_AKTIV", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_ZV_SICHERN_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_ANSTEUERUNG_KL30F_HINTEN[] = {   // 0xDC5A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL30F_HINTEN_AN", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL30F_HINTEN_AUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_BREMSLICHT_SCHALTER[] = {   // 0xDC61
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER_BREMSLICHT_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_KUPPL_PN_SCHALTER[] = {   // 0xDC63
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER_KUPPL_PN_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_MOTORHAUBE_SCHALTER[] = {   // 0xDC65
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER_MOTORHAUBE_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HOTEL_SCHALTER[] = {   // 0xDC66
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER_HOTEL_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_READHWMODIFICATIONINDEX[] = {   // 0xF152
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HW_MODIFICATION_INDEX_WERT", "HEX" },
+  {    1, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_22_F152_SUPPLIERINFO", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_LWR_STATISTIK[] = {   // 0x2302
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_AL_AKTIV_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0000_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0001_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1000_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1001_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1010_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1100_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1110_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1011_WERT", "" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1101_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1111_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0010_WERT", "" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0100_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0110_WERT", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0011_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0101_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0111_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_GES_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_GES_KL_20_WERT", "" },
+  {   42, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_GES_KL_10_WERT", "" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_GES_GR_10_WERT", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_GES_GR_20_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_AL_WERT", "" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_AL_KL_20_WERT", "" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_AL_KL_10_WERT", "" },
+  {   56, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_AL_GR_10_WERT", "" },
+  {   58, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_AL_GR_20_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_COUNT_NSC_MIRRORHEATING_ACTIVATIONS[] = {   // 0x2303
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_AKTIVIERUNGEN_ASP_NSC_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__LWR_DIAG[] = {   // 0x4507
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_ENABLE", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_SPUL_ERR_STOP", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_SPUL_EINTR", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SP_PRUEF_AKTIV", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_DIAGNOSE_PARAM_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_DIAGNOSE_PARAM_A_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_LWR_CHECKGRENZE_WERT", "V" },
+  {    7, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_LWR_PRUEF_SPANNUNG_WERT", "V" },
+  {    8, BMW_UDS_UCHAR , 0              , 512.0f, 0.0f, "STAT_LWR_DIAG_HEAT_TIME_WERT", "s" },
+  {    9, BMW_UDS_UCHAR , 0              , 512.0f, 0.0f, "STAT_LWR_DIAG_COOL_TIME_WERT", "s" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LWR_FRONT_LIGHT_HOT", "0/1" },
+  {   11, BMW_UDS_UINT  , 0              , 0.5f, 0.0f, "STAT_LWR_FRONT_LIGHT_THERMO_TIMER_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__LICHT_UEBERSPANNUNGSCOUNTER[] = {   // 0x4508
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LICHT_UESPANNUNG_COUNTER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER[] = {   // 0x4700
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_COUNT_MAX_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_COUNT_MAX_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KODIERUNG_RESTARTS_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KODIERUNG_KL15_CYCLES_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__INNENBELEUCHTUNG_DAUERAUS[] = {   // 0x4801
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INNENLICHT_IB_1_DAUER_AUS", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__SARAH_STATISTIK[] = {   // 0x4910
+  {    0, BMW_UDS_UINT  , 0              , 0.166666667f, 0.0f, "STAT_FAHRDAUER_WERT", "h" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAHRZYKLEN_WERT", "Counts" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SARAH_TASTER_WERT", "Counts" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SARAH_CONFIG_WERT", "Counts" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SARAH_CONFIG_DIREKT_WERT", "Counts" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE1_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE2_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE3_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE4_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE5_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_IBS_WAKEUP_GRUND[] = {   // 0x4F0E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_IBS_WAKEUP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__STATUS_DFZ_GUELTIGKEIT[] = {   // 0x5003
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DFZ_GUELTIGKEITSZAEHLER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER[] = {   // 0x5020
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_COUNT_MAX_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_COUNT_MAX_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_COUNT_MAX_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_COUNT_MAX_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_COUNT_MAX_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_KS_RESTARTS_WERT", "" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_KS_KL15_CYCLES_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KODIERUNG_RESTARTS_WERT_0X5020", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KODIERUNG_KL15_CYCLES_WERT_0X5020", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__ECUMA_INTERN[] = {   // 0x5101
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ECUMA_LAST_HW_WAKEUP_ID_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ECUMA_LAST_SW_WAKEUP_ID", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ECUMA_LAST_BUS_WAKEUP_ID", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ECUMA_LAST_RESET_ID", "0-n" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ECUMA_CAN_WAKEUP_ID_WERT", "" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVED_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__ECUMA_SLEEP_MODE_NRC[] = {   // 0x5109
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLEEP_MODE_NRC", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_HW_INFO_PROVIDER[] = {   // 0x510A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HW_VERSION", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__JTAGLOCK[] = {   // 0x510B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NORMAL_LOCK_STATE", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PERMANENT_LOCK_STATE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_READ_PULLUP_REF_RESFUEL_TANK_0[] = {   // 0x5DBE
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PULLUP_REF_RESFUEL_TANK_LEFT_WERT", "Ohm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC_READ_PULLUP_REF_RESFUEL_TANK_1[] = {   // 0x5DBF
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PULLUP_REF_RESFUEL_TANK_RIGHT_WERT", "Ohm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT[] = {   // 0x603A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_ZAEHLER_WERT", "Ink" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_1_URSACHE_NR", "0-n" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_1_POS_HALL_WERT", "Ink" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_DENORM_1_KM_WERT", "Ink" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_RESERVED_1_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_2_URSACHE_NR", "0-n" },
+  {   11, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_2_POS_HALL_WERT", "Ink" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_DENORM_2_KM_WERT", "Ink" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_RESERVED_2_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_3_URSACHE_NR", "0-n" },
+  {   20, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_3_POS_HALL_WERT", "Ink" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_DENORM_3_KM_WERT", "Ink" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_RESERVED_3_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_4_URSACHE_NR", "0-n" },
+  {   29, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_4_POS_HALL_WERT", "Ink" },
+  {   31, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_DENORM_4_KM_WERT", "Ink" },
+  {   35, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_RESERVED_4_WERT", "" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_5_URSACHE_NR", "0-n" },
+  {   38, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_DENORM_5_POS_HALL_WERT", "Ink" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_DENORM_5_KM_WERT", "Ink" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_RESERVED_5_WERT", "" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_ZAEHLER_WERT", "Ink" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_1_URSACHE_NR", "0-n" },
+  {   48, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_1_POS_HALL_WERT", "Ink" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_DENORM_1_KM_WERT", "Ink" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_RESERVED_1_WERT", "" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_2_URSACHE_NR", "0-n" },
+  {   57, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_2_POS_HALL_WERT", "Ink" },
+  {   59, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_DENORM_2_KM_WERT", "Ink" },
+  {   63, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_RESERVED_2_WERT", "" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_3_URSACHE_NR", "0-n" },
+  {   66, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_3_POS_HALL_WERT", "Ink" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_DENORM_3_KM_WERT", "Ink" },
+  {   72, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_RESERVED_3_WERT", "" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_4_URSACHE_NR", "0-n" },
+  {   75, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_4_POS_HALL_WERT", "Ink" },
+  {   77, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_DENORM_4_KM_WERT", "Ink" },
+  {   81, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_RESERVED_4_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_5_URSACHE_NR", "0-n" },
+  {   84, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_DENORM_5_POS_HALL_WERT", "Ink" },
+  {   86, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_DENORM_5_KM_WERT", "Ink" },
+  {   90, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_RESERVED_5_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR[] = {   // 0x603B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_ZAEHLER_WERT", "Ink" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_1_URSACHE_NR", "0-n" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_1_POS_HALL_WERT", "Ink" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_1_KM_WERT", "Ink" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_RESERVED_1_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_2_URSACHE_NR", "0-n" },
+  {   11, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_2_POS_HALL_WERT", "Ink" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_2_KM_WERT", "Ink" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_RESERVED_2_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_3_URSACHE_NR", "0-n" },
+  {   20, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_3_POS_HALL_WERT", "Ink" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_3_KM_WERT", "Ink" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_RESERVED_3_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_4_URSACHE_NR", "0-n" },
+  {   29, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_4_POS_HALL_WERT", "Ink" },
+  {   31, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_4_KM_WERT", "Ink" },
+  {   35, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_RESERVED_4_WERT", "" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_5_URSACHE_NR", "0-n" },
+  {   38, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_5_POS_HALL_WERT", "Ink" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_DENORM_5_KM_WERT", "Ink" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_RESERVED_5_WERT", "" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_ZAEHLER_WERT", "Ink" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_1_URSACHE_NR", "0-n" },
+  {   48, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_1_POS_HALL_WERT", "Ink" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_1_KM_WERT", "Ink" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_RESERVED_1_WERT", "" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_2_URSACHE_NR", "0-n" },
+  {   57, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_2_POS_HALL_WERT", "Ink" },
+  {   59, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_2_KM_WERT", "Ink" },
+  {   63, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_RESERVED_2_WERT", "" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_3_URSACHE_NR", "0-n" },
+  {   66, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_3_POS_HALL_WERT", "Ink" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_3_KM_WERT", "Ink" },
+  {   72, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_RESERVED_3_WERT", "" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_4_URSACHE_NR", "0-n" },
+  {   75, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_4_POS_HALL_WERT", "Ink" },
+  {   77, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_4_KM_WERT", "Ink" },
+  {   81, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_RESERVED_4_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_5_URSACHE_NR", "0-n" },
+  {   84, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_5_POS_HALL_WERT", "Ink" },
+  {   86, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_DENORM_5_KM_WERT", "Ink" },
+  {   90, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_RESERVED_5_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT[] = {   // 0x603E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_ZAEHLER_WERT", "Ink" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_URSACHE_NR", "0-n" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_POS_HALL_WERT", "Ink" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_KM_WERT", "km" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_ATEMP_WERT", "°C" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_SPANNUNG_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_URSACHE_NR", "0-n" },
+  {   13, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_POS_HALL_WERT", "Ink" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_KM_WERT", "km" },
+  {   19, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_ATEMP_WERT", "°C" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_SPANNUNG_WERT", "V" },
+  {   21, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_URSACHE_NR", "0-n" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_POS_HALL_WERT", "Ink" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_KM_WERT", "km" },
+  {   30, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_ATEMP_WERT", "°C" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_SPANNUNG_WERT", "V" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_URSACHE_NR", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_POS_HALL_WERT", "Ink" },
+  {   37, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_KM_WERT", "km" },
+  {   41, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_ATEMP_WERT", "°C" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_SPANNUNG_WERT", "V" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_URSACHE_NR", "0-n" },
+  {   46, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_POS_HALL_WERT", "Ink" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_KM_WERT", "km" },
+  {   52, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_ATEMP_WERT", "°C" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_SPANNUNG_WERT", "V" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_ZAEHLER_WERT", "Ink" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_URSACHE_NR", "0-n" },
+  {   58, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_POS_HALL_WERT", "Ink" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_KM_WERT", "km" },
+  {   64, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_ATEMP_WERT", "°C" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_SPANNUNG_WERT", "V" },
+  {   66, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_URSACHE_NR", "0-n" },
+  {   69, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_POS_HALL_WERT", "Ink" },
+  {   71, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_KM_WERT", "km" },
+  {   75, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_ATEMP_WERT", "°C" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_SPANNUNG_WERT", "V" },
+  {   77, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_URSACHE_NR", "0-n" },
+  {   80, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_POS_HALL_WERT", "Ink" },
+  {   82, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_KM_WERT", "km" },
+  {   86, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_ATEMP_WERT", "°C" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_SPANNUNG_WERT", "V" },
+  {   88, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   90, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_URSACHE_NR", "0-n" },
+  {   91, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_POS_HALL_WERT", "Ink" },
+  {   93, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_KM_WERT", "km" },
+  {   97, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_ATEMP_WERT", "°C" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_SPANNUNG_WERT", "V" },
+  {   99, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_GESCHWINDIGKEIT_WERT", "km/h" },
+  {  101, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_URSACHE_NR", "0-n" },
+  {  102, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_POS_HALL_WERT", "Ink" },
+  {  104, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_KM_WERT", "km" },
+  {  108, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_ATEMP_WERT", "°C" },
+  {  109, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_SPANNUNG_WERT", "V" },
+  {  110, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_GESCHWINDIGKEIT_WERT", "km/h" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_REVERSIER_LOGGER_LESEN_REAR[] = {   // 0x603F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_ZAEHLER_WERT", "Ink" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_URSACHE_NR", "0-n" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_POS_HALL_WERT", "Ink" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_KM_WERT", "km" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_ATEMP_WERT", "°C" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_SPANNUNG_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_URSACHE_NR", "0-n" },
+  {   13, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_POS_HALL_WERT", "Ink" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_KM_WERT", "km" },
+  {   19, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_ATEMP_WERT", "°C" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_SPANNUNG_WERT", "V" },
+  {   21, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_URSACHE_NR", "0-n" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_POS_HALL_WERT", "Ink" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_KM_WERT", "km" },
+  {   30, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_ATEMP_WERT", "°C" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_SPANNUNG_WERT", "V" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_URSACHE_NR", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_POS_HALL_WERT", "Ink" },
+  {   37, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_KM_WERT", "km" },
+  {   41, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_ATEMP_WERT", "°C" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_SPANNUNG_WERT", "V" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_URSACHE_NR", "0-n" },
+  {   46, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_POS_HALL_WERT", "Ink" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_KM_WERT", "km" },
+  {   52, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_ATEMP_WERT", "°C" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_SPANNUNG_WERT", "V" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_ZAEHLER_WERT", "Ink" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_URSACHE_NR", "0-n" },
+  {   58, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_POS_HALL_WERT", "Ink" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_KM_WERT", "km" },
+  {   64, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_ATEMP_WERT", "°C" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_SPANNUNG_WERT", "V" },
+  {   66, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_URSACHE_NR", "0-n" },
+  {   69, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_POS_HALL_WERT", "Ink" },
+  {   71, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_KM_WERT", "km" },
+  {   75, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_ATEMP_WERT", "°C" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_SPANNUNG_WERT", "V" },
+  {   77, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_URSACHE_NR", "0-n" },
+  {   80, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_POS_HALL_WERT", "Ink" },
+  {   82, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_KM_WERT", "km" },
+  {   86, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_ATEMP_WERT", "°C" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_SPANNUNG_WERT", "V" },
+  {   88, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT", "km/h" },
+  {   90, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_URSACHE_NR", "0-n" },
+  {   91, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_POS_HALL_WERT", "Ink" },
+  {   93, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_KM_WERT", "km" },
+  {   97, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_ATEMP_WERT", "°C" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_SPANNUNG_WERT", "V" },
+  {   99, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT", "km/h" },
+  {  101, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_URSACHE_NR", "0-n" },
+  {  102, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_POS_HALL_WERT", "Ink" },
+  {  104, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_KM_WERT", "km" },
+  {  108, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_ATEMP_WERT", "°C" },
+  {  109, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_SPANNUNG_WERT", "V" },
+  {  110, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT", "km/h" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT[] = {   // 0x6042
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_1_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_2_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_3_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_4_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_5_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_6_NR", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_7_NR", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_8_NR", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_9_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FA_STOPREASON_10_NR", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_1_NR", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_2_NR", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_3_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_4_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_5_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_6_NR", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_7_NR", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_8_NR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_9_NR", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BF_STOPREASON_10_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR[] = {   // 0x6043
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_1_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_2_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_3_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_4_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_5_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_6_NR", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_7_NR", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_8_NR", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_9_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAH_STOPREASON_10_NR", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_1", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_2", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_3_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_4_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_5_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_6_NR", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_7_NR", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_8_NR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_9_NR", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BFH_STOPREASON_10_NR", "0-n" },
+  };
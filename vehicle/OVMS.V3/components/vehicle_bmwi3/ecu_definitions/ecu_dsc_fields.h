@@ -0,0 +1,894 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/dsc_i1.json: DSC 29: Dynamic stability controller
+// This generated code  makes it easier to process CANBUS messages from the DSC ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FEHLERSPEICHER_ENDE_WERKSABLAUF[] = {   // 0x1061
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FS_ENDE_WABL", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_START_ADAPTIVDATEN_RUECKSETZEN[] = {   // 0xA051
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STEUERN_AX_AY_ABGLEICH[] = {   // 0xA052
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA052", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_START_ADAPTIVDATEN_WERKSMODUS[] = {   // 0xA053
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA053", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STEUERN_ADAPTIVDATEN_SLW_RESET[] = {   // 0xA05B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA05B", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DATEN_SCHREIBEN_AKTIV_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_IPB_LED[] = {   // 0xA123
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_IPB_LED_ZUSTAND", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FLM_RESET[] = {   // 0xA130
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLM_RESET", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_DSC_PUMPENFUNKTIONSTEST[] = {   // 0xA222
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA222", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_LEERLAUF_WERT", "%" },
+  {    3, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_KREIS_1_WERT", "%" },
+  {    5, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_KREIS_2_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STEUERN_EEPROM_SCHREIBEN[] = {   // 0xAB5B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XAB5B", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EEPROM_SICHERN_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_START_ADAPTIVDATEN_WERKSMODUS_2[] = {   // 0xABA3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XABA3", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_GMK_DATEN[] = {   // 0xD09A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZUSTAND_IST_GMK_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZUSTAND_SOLL_GMK_WERT", "" },
+  {    2, BMW_UDS_SCHAR , 0              , 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_EPS_WERT", "Nm" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_OFFSET_EPS_QUALIFIER_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUNKTION_GMK_CODIERUNG_EIN", "0/1" },
+  {    5, BMW_UDS_SCHAR , 0              , 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_GMK_EPS_WERT", "Nm" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LENKUNG_VERBAUT_FAHRZEUG_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_BREMSPEDALWINKELSENSOR[] = {   // 0xD0D2
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_IST_SENSOR1_WERT", "mm" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_SENSOR1_WERT", "mm" },
+  {    4, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_SENSOR1_WERT", "mm" },
+  {    6, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_SENSOR1_WERT", "mm" },
+  {    8, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_SENSOR2_WERT", "mm" },
+  {   10, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_SENSOR2_WERT", "mm" },
+  {   12, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_SENSOR2_WERT", "mm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_CBS_BREMSE_DETAILS[] = {   // 0xD272
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VA_IDENT_WERT", "" },
+  {    1, BMW_UDS_UINT  , 0              , 100.0f, 0.0f, "STAT_VA_S_SIGNAL_WERT", "km" },
+  {    3, BMW_UDS_UINT  , 0              , 100.0f, 0.0f, "STAT_VA_S_WECHSEL_WERT", "km" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VA_S_REST_ORIG_WERT", "km" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VA_S_MIN_WERT", "km" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VA_S_MAX_WERT", "km" },
+  {   11, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VA_S_REST_WERT", "km" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VA_S_GESAMT_1_WERT", "km" },
+  {   19, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VA_S_GESAMT_2_WERT", "km" },
+  {   23, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VA_S_GESAMT_3_WERT", "km" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VA_SZ_WERT", "" },
+  {   28, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_VA_FLAG_BVA", "Bit" },
+  {   29, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_VA_RESET_VERHINDERER_1", "Bit" },
+  {   30, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_VA_RESET_VERHINDERER_2", "Bit" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HA_IDENT_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 100.0f, 0.0f, "STAT_HA_S_SIGNAL_WERT", "km" },
+  {   34, BMW_UDS_UINT  , 0              , 100.0f, 0.0f, "STAT_HA_S_WECHSEL_WERT", "km" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HA_S_REST_ORIG_WERT", "km" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HA_S_MIN_WERT", "km" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HA_S_MAX_WERT", "km" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HA_S_REST_WERT", "km" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HA_S_GESAMT_1_WERT", "km" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HA_S_GESAMT_2_WERT", "km" },
+  {   54, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HA_S_GESAMT_3_WERT", "km" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HA_SZ_WERT", "" },
+  {   59, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_HA_FLAG_BVA", "Bit" },
+  {   60, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_HA_RESET_VERHINDERER_1", "Bit" },
+  {   61, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_HA_RESET_VERHINDERER_2", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FES_COORDINT_SW_FEHLER_INFO[] = {   // 0xD62E
+  {    0, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_FES_COORDINT_SW_FEHLER_INFO_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_LERNDATEN_STATISTIK[] = {   // 0xD804
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_FESTELLEN_STEIGUNG20_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_ROLLUEBERWACHUNG_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_TEMPERATUR_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_AUTO_ADJUST_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_PRAEVENTIV_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE5_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE6_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE7_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE8_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE9_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_AKTUATOR_KOMBISATTEL[] = {   // 0xD805
+  {    0, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_MOTOR_HL_WERT", "V" },
+  {    2, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_STROM_MOTOR_HL_WERT", "A" },
+  {    4, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_TEMPERATUR_MOTOR_HL_WERT", "°C" },
+  {    6, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_MOTOR_HR_WERT", "V" },
+  {    8, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_STROM_MOTOR_HR_WERT", "A" },
+  {   10, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_TEMPERATUR_MOTOR_HR_WERT", "°C" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKTUATOR_R", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKTUATOR_L", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HU_MODE_STATUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_LERNDATEN_TASTER[] = {   // 0xD808
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_TASTER_FESTSTELLEN_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_TASTER_LOESEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_LERNDATEN_AKTUATOR[] = {   // 0xD80A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_FESTSTELLEN_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_NOTENTRIEGELN_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_BOOST_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_UEBERLAST_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_KLEMMEN_KOMBISATTEL[] = {   // 0xD80C
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_ELEKTRONIK_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_AKUATOR_HL_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_AKUATOR_HR_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_WECKLEITUNG_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EMF_TASTER[] = {   // 0xD80D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_EMF", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_EMF_DIGITAL_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_TASTER_EMF_1_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_TASTER_EMF_2_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_TASTER_EMF_3_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_TASTER_EMF_4_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_TASTER_EMF_5_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_LESEN[] = {   // 0xD81A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AKTUELLER_ZAEHLERSTAND_GKU_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_LESEN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_LESEN[] = {   // 0xD8EB
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_ANTI_POWER_HOP_FUNKTION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_MODUS_ROLLENPRUEFSTAND[] = {   // 0xDB5B
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ROLLENMODUS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_GIERRATE[] = {   // 0xDBD9
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GIERRATE_SENSOR_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_QUERBESCHLEUNIGUNG[] = {   // 0xDBDA
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_QUERBESCHLEUNIGUNG_SENSOR_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_LAENGSBESCHLEUNIGUNG[] = {   // 0xDBDB
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LAENGSBESCHLEUNIGUNG_SENSOR1_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_BREMSBELAGSSENSOR[] = {   // 0xDBDF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILLE_VA", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILLE_HA", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_REIFENPANNENANZEIGE[] = {   // 0xDBE3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WARNUNG_AKTIV", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUNKTION_AKTIV", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PLATTROLLEN_ERKANNT", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3PLUS1_ERKANNT", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NEUREIFEN_ERKANNT", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NAEHERUNG_WARNGRENZE_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PANNEN_POSITION", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_0_100_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_100_190_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_UEBER_190_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_GESCHWINDIGKEIT_RAD[] = {   // 0xDBE4
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_VL_WERT", "km/h" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_VR_WERT", "km/h" },
+  {    4, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_HL_WERT", "km/h" },
+  {    6, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_HR_WERT", "km/h" },
+  {    8, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_FZG_WERT", "km/h" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_VL", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_VR", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_HL", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_HR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_REF", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIGNALQUALITAET_VL_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIGNALQUALITAET_VR_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIGNALQUALITAET_HL_WERT", "%" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIGNALQUALITAET_HR_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_DSC_DRUCKSENSOREN[] = {   // 0xDBE5
+  {    0, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_KREIS1_WERT", "bar" },
+  {    2, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_KREIS2_WERT", "bar" },
+  {    4, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_VL_WERT", "bar" },
+  {    6, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_VR_WERT", "bar" },
+  {    8, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_HL_WERT", "bar" },
+  {   10, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_DRUCK_HR_WERT", "bar" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_DSC_KLEMMEN[] = {   // 0xDBE7
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_ELEKTRONIK_WERT_0XDBE7", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_PUMPE_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_VENTILE_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_WECKLEITUNG_WERT_0XDBE7", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_VAKUUMSENSOR[] = {   // 0xDBF4
+  {    0, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_DRUCK_IST_WERT", "bar" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_IST_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_BREMSPEDALWEGSENSOR[] = {   // 0xDBF5
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_IST_WERT", "mm" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_WERT", "mm" },
+  {    4, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_WERT", "mm" },
+  {    6, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_WERT", "mm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_BREMSREKUPERATIONSMOMENT[] = {   // 0xDBF6
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MOMENT_SOLL_WERT", "Nm" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MOMENT_IST_WERT", "Nm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_ADAPTIVDATEN_ZUSTAND[] = {   // 0xDC13
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_ADAPTIVDATEN_RUECKSETZEN_NR", "0-n" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AX_AY_ABGLEICH_NR", "0-n" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ADAPTIVDATEN_WERKSMODUS_NR", "0-n" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_ADAPTIVDATEN_LERNWERTE_AKTIV_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RPA_LERNDATEN_STATISTIK[] = {   // 0xDC14
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RPA_VERSION_NR_1_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RPA_VERSION_NR_2_WERT", "" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_WERT", "km" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_1_WERT", "km" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_2_WERT", "km" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_WERT", "d" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_1_WERT", "d" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_2_WERT", "d" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_WERT", "km" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_MINUS_1_WERT", "km" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_MINUS_2_WERT", "km" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_WERT", "d" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_1_WERT", "d" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_2_WERT", "d" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_WERT", "km/h" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_1_WERT", "km/h" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_2_WERT", "km/h" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_WERT", "km/h" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_1_WERT", "km/h" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_2_WERT", "km/h" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_3PLUS1_ERKENNUNG_WERT", "km" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_LETZTE_NEUREIFEN_ERKENNUNG_WERT", "km" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NEUREIFEN_POSITON", "0-n" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_URSACHE_WARNUNG_WERT", "" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MAX_NAEHERUNG_WARNGRENZE_SEIT_LETZTER_STD_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RPA_LERNDATEN_STD[] = {   // 0xDC15
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_0_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_1_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_2_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_3_WERT", "%" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_4_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_5_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_6_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_7_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_0_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_1_WERT", "%" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_2_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_3_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_4_WERT", "%" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_5_WERT", "%" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_6_WERT", "%" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_7_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_0_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_1_WERT", "%" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_2_WERT", "%" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_3_WERT", "%" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_4_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_5_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_6_WERT", "%" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_7_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_DSC_BREMSLICHTSCHALTER[] = {   // 0xDC1E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER_BREMSLICHT_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_BREMSFLUESSIGKEITSSCHALTER[] = {   // 0xDC1F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BREMSFLUESSIGKEIT_NIVEAU_SCHALTER_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_GBRPLUS[] = {   // 0xDC3A
+  {    0, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_FAKTORU_EPS_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_FAKTORARD_EPS_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_FAKTORARZ_EPS_WERT", "" },
+  {    3, BMW_UDS_SCHAR , 0              , 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_EPS_WERT_0XDC3A", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKTOR_EPS_QUALIFIER_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_OFFSET_EPS_QUALIFIER_WERT_0XDC3A", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUNKTION_GBR_CODIERUNG_EIN", "0/1" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT_0XDC3A", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT_0XDC3A", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZUSTAND_GRENZBEREICHSREUCKMELDUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_LLP[] = {   // 0xDC42
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_MANI_AKTIV", "0/1" },
+  {    1, BMW_UDS_SCHAR , 0              , 0.1f, 0.0f, "STAT_LLP_MANI_WERT", "kW" },
+  {    2, BMW_UDS_SCHAR , 0              , 0.1f, 0.0f, "STAT_LLP_CALC_WERT", "kW" },
+  {    3, BMW_UDS_SCHAR , 0              , 0.1f, 0.0f, "STAT_LLP_PEL_IST_WERT", "kW" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LLP_FZS_WERT", "N" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LLP_RITZELWINKEL_WERT", "°" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_ANTEIL_HUB_WERT", "%" },
+  {    9, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_LLP_V_ZS_WERT", "m/s" },
+  {   11, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_LLP_FAHRERHANDMOMENT_WERT", "Nm" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_VX_ENTRY", "0/1" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_AX_KORR", "0/1" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_RETURN", "0/1" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_STOP", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_EXTRAP_PEL", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_EXTRAP_FZS", "0/1" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FZSREDUC_BRAKE", "0/1" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_PMA", "0/1" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_PDC", "0/1" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_TEMP_A", "0/1" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_RAIN", "0/1" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_AX", "0/1" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_STOP", "0/1" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_RAIN", "0/1" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_PMA", "0/1" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_PDC", "0/1" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_RETURN", "0/1" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_TEMP_A", "0/1" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_EXTRAP_FZS", "0/1" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_EXTRAP_PEL", "0/1" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LLP_FLAG_FZSREDUC_BRAKE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_ABS_FUNKTION[] = {   // 0xDC6C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABS_FUNKTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABS_FUNKTION_QUALIFIER_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ABS_FUNKTION_QUALIFIER_ERW_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_ASC_FUNKTION[] = {   // 0xDC6D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ASC_FUNKTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ASC_FUNKTION_QUALIFIER_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ASC_FUNKTION_QUALIFIER_ERW_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FDR_FUNKTION[] = {   // 0xDC6E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDR_FUNKTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDR_FUNKTION_QUALIFIER_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDR_FUNKTION_QUALIFIER_ERW_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_PBRK_FUNKTION[] = {   // 0xDC6F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PBRK_FUNKTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PBRK_FUNKTION_QUALIFIER_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PBRK_FUNKTION_QUALIFIER_ERW_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_HDC_FUNKTION[] = {   // 0xDC70
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HDC_FUNKTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HDC_FUNKTION_QUALIFIER_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HDC_FUNKTION_QUALIFIER_ERW_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_RDC_VERSION[] = {   // 0xDC94
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RDC_VERSION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_RDC_LESEN[] = {   // 0xDC95
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EIGENRAEDER_BEKANNT", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOS_ER_BEKANNT", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOS_UEBERPRUEFT_BESTAETIGT", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DTC_INACTIVE", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAL_ANFORDERUNG_AKTIV", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RAD_ZUORDNUNG_TIMEOUT", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BANDMODE_AKTIV", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ER_ERKENNUNG_FAHRT", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEST_EIGENRAD_FAHRT", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEST_EIGENRAD_STAND", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ER_FAHRT_VTHRS_AKTIV", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BM_TIMEOUT_ACTIVE", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_UNSPEZIFISCH_AKTIV", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_VL_AKTIV", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_VR_AKTIV", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_HL_AKTIV", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_HR_AKTIV", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL_15_EIN", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_LAEUFT_EIN", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZG_FAEHRT", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ERKENNUNG_ALLE_RE", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ERKENNUNG_ZUVIELE_RE", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STOERSENDER", "0-n" },
+  {   23, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FREQUENZ_WERT", "MHz" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_INAKTIVEREIGNIS[] = {   // 0xDC96
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_1_KILOMETERSTAND_WERT", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_1_SYSTEMFLAGS_WERT", "HEX" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_1_INTERNER_FEHLERCODE_WERT", "HEX" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_ZAEHLER_INAKTIV", "0-n" },
+  {   47, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_2_KILOMETERSTAND_WERT", "km" },
+  {   51, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_2_SYSTEMFLAGS_WERT", "HEX" },
+  {   55, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_2_INTERNER_FEHLERCODE_WERT", "HEX" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_ZAEHLER_INAKTIV", "0-n" },
+  {   76, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_3_KILOMETERSTAND_WERT", "km" },
+  {   80, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_3_SYSTEMFLAGS_WERT", "HEX" },
+  {   84, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_3_INTERNER_FEHLERCODE_WERT", "HEX" },
+  {   86, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_ZAEHLER_INAKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_KALIBRIEREREIGNIS[] = {   // 0xDC97
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_PLAUSI_DRUCK", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_KALIBRIERUNG", "0-n" },
+  {   20, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_1_KILOMETERSTAND_WERT_0XDC97", "km" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_1_SYSTEMFLAGS_WERT_0XDC97", "HEX" },
+  {   28, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_1_BEFUELL_AUSSENTEMPERATUR_WERT", "°" },
+  {   29, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_1_BEFUELL_AUSSENDRUCK_WERT", "bar" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_RADPOSITION_RE0", "0-n" },
+  {   32, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE0_WERT", "bar" },
+  {   34, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE0_WERT", "°C" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_RADPOSITION_RE1", "0-n" },
+  {   36, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE1_WERT", "bar" },
+  {   38, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE1_WERT", "°C" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_RADPOSITION_RE2", "0-n" },
+  {   40, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE2_WERT", "bar" },
+  {   42, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE2_WERT", "°C" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_RADPOSITION_RE3", "0-n" },
+  {   44, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE3_WERT", "bar" },
+  {   46, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE3_WERT", "°C" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_1_ZAEHLER_KALIBRIERUNG", "0-n" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_PLAUSI_DRUCK", "0-n" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_KALIBRIERUNG", "0-n" },
+  {   68, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_2_KILOMETERSTAND_WERT_0XDC97", "km" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_2_SYSTEMFLAGS_WERT_0XDC97", "HEX" },
+  {   76, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_2_BEFUELL_AUSSENTEMPERATUR_WERT", "°" },
+  {   77, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_2_BEFUELL_AUSSENDRUCK_WERT", "bar" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_RADPOSITION_RE0", "0-n" },
+  {   80, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE0_WERT", "bar" },
+  {   82, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE0_WERT", "°C" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_RADPOSITION_RE1", "0-n" },
+  {   84, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE1_WERT", "bar" },
+  {   86, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE1_WERT", "°C" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_RADPOSITION_RE2", "0-n" },
+  {   88, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE2_WERT", "bar" },
+  {   90, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE2_WERT", "°C" },
+  {   91, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_RADPOSITION_RE3", "0-n" },
+  {   92, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE3_WERT", "bar" },
+  {   94, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE3_WERT", "°C" },
+  {   95, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_2_ZAEHLER_KALIBRIERUNG", "0-n" },
+  {   96, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_PLAUSI_DRUCK", "0-n" },
+  {   97, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_KALIBRIERUNG", "0-n" },
+  {  116, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_3_KILOMETERSTAND_WERT_0XDC97", "km" },
+  {  120, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_3_SYSTEMFLAGS_WERT_0XDC97", "HEX" },
+  {  124, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_3_BEFUELL_AUSSENTEMPERATUR_WERT", "°" },
+  {  125, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_3_BEFUELL_AUSSENDRUCK_WERT", "bar" },
+  {  127, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_RADPOSITION_RE0", "0-n" },
+  {  128, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE0_WERT", "bar" },
+  {  130, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE0_WERT", "°C" },
+  {  131, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_RADPOSITION_RE1", "0-n" },
+  {  132, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE1_WERT", "bar" },
+  {  134, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE1_WERT", "°C" },
+  {  135, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_RADPOSITION_RE2", "0-n" },
+  {  136, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE2_WERT", "bar" },
+  {  138, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE2_WERT", "°C" },
+  {  139, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_RADPOSITION_RE3", "0-n" },
+  {  140, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE3_WERT", "bar" },
+  {  142, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE3_WERT", "°C" },
+  {  143, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_3_ZAEHLER_KALIBRIERUNG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_MESSDATENBLOCK_1[] = {   // 0xDC98
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RAD_POSITION_NR", "0-n" },
+  {    5, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT", "bar" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT", "°C" },
+  {    8, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT", "bar" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GUTEMPFAENGE", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSBEUTE", "0-n" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RSSI_PEGEL", "0-n" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POS_CHANGED", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FOLGEAUSFALL", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_HERSTELLER", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE", "0-n" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT", "HEX" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROLLSWITCH", "0-n" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TELEGRAMMTYP", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_MESSDATENBLOCK_2[] = {   // 0xDC99
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC99", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC99", "0-n" },
+  {    5, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC99", "bar" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC99", "°C" },
+  {    8, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC99", "bar" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC99", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC99", "0-n" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC99", "0-n" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC99", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC99", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC99", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC99", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC99", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC99", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC99", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC99", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC99", "0-n" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC99", "HEX" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC99", "0-n" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC99", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_MESSDATENBLOCK_3[] = {   // 0xDC9A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC9A", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC9A", "0-n" },
+  {    5, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9A", "bar" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9A", "°C" },
+  {    8, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC9A", "bar" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC9A", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC9A", "0-n" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC9A", "0-n" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC9A", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC9A", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC9A", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC9A", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC9A", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC9A", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC9A", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC9A", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC9A", "0-n" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9A", "HEX" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC9A", "0-n" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC9A", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_MESSDATENBLOCK_4[] = {   // 0xDC9B
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC9B", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC9B", "0-n" },
+  {    5, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9B", "bar" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9B", "°C" },
+  {    8, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC9B", "bar" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC9B", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC9B", "0-n" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC9B", "0-n" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC9B", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC9B", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC9B", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC9B", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC9B", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC9B", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC9B", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC9B", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC9B", "0-n" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9B", "HEX" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC9B", "0-n" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC9B", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_1[] = {   // 0xDC9C
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_2[] = {   // 0xDC9D
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9D", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9D", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9D", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9D", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9D", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9D", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9D", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9D", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9D", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9D", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9D", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9D", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9D", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9D", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9D", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9D", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9D", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9D", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9D", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9D", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9D", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9D", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9D", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9D", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9D", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9D", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9D", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9D", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9D", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_3[] = {   // 0xDC9E
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9E", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9E", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9E", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9E", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9E", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9E", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9E", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9E", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9E", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9E", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9E", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9E", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9E", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9E", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9E", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9E", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9E", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9E", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9E", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9E", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9E", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9E", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9E", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9E", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9E", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9E", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9E", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9E", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9E", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME[] = {   // 0xDC9F
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9F", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9F", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9F", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9F", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9F", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9F", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9F", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9F", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9F", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9F", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9F", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9F", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9F", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9F", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9F", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9F", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9F", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9F", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9F", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9F", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9F", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9F", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9F", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9F", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9F", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9F", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9F", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9F", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARN_RUECKNAHME", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG[] = {   // 0xDCD9
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE0_WERT", "HEX" },
+  {    4, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCD9", "bar" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE0_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE0_WERT", "" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE1_WERT", "HEX" },
+  {   13, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCD9", "bar" },
+  {   15, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE1_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE1_WERT", "" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE2_WERT", "HEX" },
+  {   22, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCD9", "bar" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE2_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE2_WERT", "" },
+  {   27, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE3_WERT", "HEX" },
+  {   31, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCD9", "bar" },
+  {   33, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE3_WERT", "" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE3_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE4_WERT", "HEX" },
+  {   40, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE4_WERT", "bar" },
+  {   42, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE4_WERT", "" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE4_WERT", "" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE5_WERT", "HEX" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE5_WERT", "bar" },
+  {   51, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE5_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE5_WERT", "" },
+  {   54, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE6_WERT", "HEX" },
+  {   58, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE6_WERT", "bar" },
+  {   60, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE6_WERT", "" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE6_WERT", "" },
+  {   63, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE7_WERT", "HEX" },
+  {   67, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE7_WERT", "bar" },
+  {   69, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE7_WERT", "" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE7_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_WEICH_1[] = {   // 0xDCF1
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF1", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF1", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF1", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF1", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF1", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF1", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF1", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF1", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF1", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF1", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF1", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF1", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF1", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF1", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF1", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF1", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF1", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF1", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF1", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF1", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF1", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF1", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF1", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF1", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF1", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF1", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF1", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF1", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF1", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_WEICH_2[] = {   // 0xDCF2
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF2", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF2", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF2", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF2", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF2", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF2", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF2", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF2", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF2", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF2", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF2", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF2", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF2", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF2", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF2", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF2", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF2", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF2", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF2", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF2", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF2", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF2", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF2", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF2", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF2", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF2", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF2", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF2", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF2", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_RDC_HS_WARNEREIGNIS_WEICH_3[] = {   // 0xDCF3
+  {   18, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF3", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF3", "HEX" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF3", "°" },
+  {   27, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF3", "bar" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF3", "°" },
+  {   30, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF3", "bar" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF3", "HEX" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF3", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF3", "0-n" },
+  {   35, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF3", "bar" },
+  {   37, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF3", "°C" },
+  {   38, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF3", "bar" },
+  {   40, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF3", "°" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF3", "0-n" },
+  {   42, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF3", "bar" },
+  {   44, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF3", "°C" },
+  {   45, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF3", "bar" },
+  {   47, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF3", "°" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF3", "0-n" },
+  {   49, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF3", "bar" },
+  {   51, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF3", "°C" },
+  {   52, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF3", "bar" },
+  {   54, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF3", "°" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF3", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF3", "bar" },
+  {   58, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF3", "°C" },
+  {   59, BMW_UDS_SINT  , 0              , 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF3", "bar" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF3", "°" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF3", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_STATUS_AUTO_EPB_ZAEHLER[] = {   // 0xDD1B
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AUTO_EPB_ZAEHLER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_LESEN[] = {   // 0xE354
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLERSTAND_EPB_AKTIVIERUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FAHRZEUGZUSTAND[] = {   // 0x5002
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAHRZEUGZUSTAND_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_ANTRIEBSZUSTAND[] = {   // 0x5004
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANTRIEBSZUSTAND_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_SPANNUNGSMASTER_VERFUEGBAR[] = {   // 0x5008
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPANNUNGSMASTER_VERFUEGBAR_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FUNKTIONSZUSTAND[] = {   // 0x500B
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FUNKTIONSZUSTAND_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_INTERNER_FUNKTIONSZUSTAND[] = {   // 0x500C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INTERNER_FUNKTIONSZUSTAND_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_FEHLERSPEICHERSPERRE_AKTIV[] = {   // 0x500F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLERSPEICHERSPERRE_AKTIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_DSC_NETZWERK_ROHDATEN[] = {   // 0x5010
+  {    0, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_ROHDATEN_WERT", "HEX" },
+  };
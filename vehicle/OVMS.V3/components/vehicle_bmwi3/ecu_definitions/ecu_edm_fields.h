@@ -0,0 +1,353 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/edmei1.json: EDM 12: Electrical digital motor electronics (low voltage ECU)
+// This generated code  makes it easier to process CANBUS messages from the EDM ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_EDM_ENTLUEFTUNG_KUEHLSYSTEM[] = {   // 0xA1D0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESTZEIT_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_EME_KAELTEMITTEL_ABSPERRVENTIL_ON_OFF[] = {   // 0xDE22
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKAV_ON", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_PEDALWERTGEBER[] = {   // 0xDE9C
+  {    0, BMW_UDS_UINT  , 0              , 0.0049f, 0.0f, "STAT_SPANNUNG_PEDALWERT1_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.0049f, 0.0f, "STAT_SPANNUNG_PEDALWERT2_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.0625f, 0.0f, "STAT_PEDALWERT_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_BETRIEB[] = {   // 0xDEE1
+  {    0, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_BETRIEB_KILOMETER_WERT", "km" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LAUFZEIT_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BETRIEB_ERSTSTARTS_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_BETRIEB_MSA_STARTS_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_BETRIEB_WARTUNG_STARTS_WERT", "" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_REX_BETRIEB_BEZUGSKILOMETER_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_DREHZAHL[] = {   // 0xDEE2
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_11_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_12_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_13_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_14_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_15_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_16_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_17_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_18_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_ZYKLISCHES_NACHLADEN_INFO[] = {   // 0xDEFD
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PARKEN_SYSTEMZEIT_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PARKEN_KILOMETERSTAND_WERT", "km" },
+  {    8, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_PARKEN_NV_BATTERIE_SOC_WERT", "%" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_PARKEN_SYSTEMZEIT_WERT", "s" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_PARKEN_KILOMETERSTAND_WERT", "km" },
+  {   17, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_PARKEN_NV_BATTERIE_SOC_WERT", "%" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_START_ZYKNL_SYSTEMZEIT_WERT", "s" },
+  {   22, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_START_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   23, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_START_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, -128.0f, "STAT_E1_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT", "°C" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 1.0f, "STAT_E1_LADEDAUER_WERT", "s" },
+  {   27, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   28, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E1_GRUND_LADEENDE", "0-n" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E1_ZYKNL_PROGNOSE_EIN", "0/1" },
+  {   31, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_PARKEN_SYSTEMZEIT_WERT", "s" },
+  {   35, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_PARKEN_KILOMETERSTAND_WERT", "km" },
+  {   39, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_PARKEN_NV_BATTERIE_SOC_WERT", "%" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_START_ZYKNL_SYSTEMZEIT_WERT", "s" },
+  {   44, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_START_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   45, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_START_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, -128.0f, "STAT_E2_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT", "°C" },
+  {   47, BMW_UDS_UINT  , 0              , 1.0f, 1.0f, "STAT_E2_LADEDAUER_WERT", "s" },
+  {   49, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   50, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E2_GRUND_LADEENDE", "0-n" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E2_ZYKNL_PROGNOSE_EIN", "0/1" },
+  {   53, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_PARKEN_SYSTEMZEIT_WERT", "s" },
+  {   57, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_PARKEN_KILOMETERSTAND_WERT", "km" },
+  {   61, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_PARKEN_NV_BATTERIE_SOC_WERT", "%" },
+  {   62, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_START_ZYKNL_SYSTEMZEIT_WERT", "s" },
+  {   66, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_START_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_START_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, -128.0f, "STAT_E3_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT", "°C" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 1.0f, "STAT_E3_LADEDAUER_WERT", "s" },
+  {   71, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E3_GRUND_LADEENDE", "0-n" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E3_ZYKNL_PROGNOSE_EIN", "0/1" },
+  {   75, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_PARKEN_SYSTEMZEIT_WERT", "s" },
+  {   79, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_PARKEN_KILOMETERSTAND_WERT", "km" },
+  {   83, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_PARKEN_NV_BATTERIE_SOC_WERT", "%" },
+  {   84, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_START_ZYKNL_SYSTEMZEIT_WERT", "s" },
+  {   88, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_START_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   89, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_START_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   90, BMW_UDS_UCHAR , 0              , 1.0f, -128.0f, "STAT_E4_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT", "°C" },
+  {   91, BMW_UDS_UINT  , 0              , 1.0f, 1.0f, "STAT_E4_LADEDAUER_WERT", "s" },
+  {   93, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT", "%" },
+  {   94, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT", "%" },
+  {   95, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E4_GRUND_LADEENDE", "0-n" },
+  {   96, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E4_ZYKNL_PROGNOSE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM[] = {   // 0xDEFE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_A_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_B_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_C_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_D_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_E_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_F_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_G_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_H_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_A_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_B_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_C_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_D_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_E_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_F_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_G_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_H_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_TEMPERATUR[] = {   // 0xDF53
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_1_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_2_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_3_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_1_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_2_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_3_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_KILOMETER_KLASSEN[] = {   // 0xDF54
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_2_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_3_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_4_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_5_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_ZYKLEN[] = {   // 0xDF55
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZYKLEN_GESAMT_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZYKLEN_REX_BETRIEB_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN[] = {   // 0xDF56
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_1_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_1_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_1_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_2_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_2_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_2_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_2_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_3_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_3_WERT", "" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_3_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_3_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_4_WERT", "" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_4_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_4_WERT", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_4_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_5_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_5_WERT", "" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_5_WERT", "" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_5_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_6_WERT", "" },
+  {   42, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_6_WERT", "" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_6_WERT", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_6_WERT", "" },
+  {   48, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_7_WERT", "" },
+  {   50, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_7_WERT", "" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_7_WERT", "" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_7_WERT", "" },
+  {   56, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_8_WERT", "" },
+  {   58, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_8_WERT", "" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_8_WERT", "" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_8_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_REX_STATISTIK_ZAEHLER[] = {   // 0xDF5E
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_BETRIEB_LANGZEITSTART_IO_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_BETRIEB_LANGZEITSTART_NIO_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REX_BETRIEB_TANK_LEER_STOPS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_12V_NACHLADEHISTORIE[] = {   // 0x409D
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_STAND_WERT", "km" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SYSTEMZEIT_PARKEN_WERT", "s" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_12V_BATTERIE_SOC_PARKEN_WERT", "%" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_KM_STAND_WERT", "km" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_KM_STAND_WERT", "km" },
+  {   17, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_KM_STAND_WERT", "km" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_KM_STAND_WERT", "km" },
+  {   25, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_SYSTEMZEIT_PARKEN_WERT", "s" },
+  {   29, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_SYSTEMZEIT_PARKEN_WERT", "s" },
+  {   33, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_SYSTEMZEIT_PARKEN_WERT", "s" },
+  {   37, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_SYSTEMZEIT_PARKEN_WERT", "s" },
+  {   41, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_PARKEN_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_PARKEN_WERT", "%" },
+  {   43, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_PARKEN_WERT", "%" },
+  {   44, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_PARKEN_WERT", "%" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E1_SYSTEMZEIT_LADEBEGINN_WERT", "s" },
+  {   49, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E2_SYSTEMZEIT_LADEBEGINN_WERT", "s" },
+  {   53, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E3_SYSTEMZEIT_LADEBEGINN_WERT", "s" },
+  {   57, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_E4_SYSTEMZEIT_LADEBEGINN_WERT", "s" },
+  {   61, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   63, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   64, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   65, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_HV_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_HV_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_HV_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   68, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_HV_BATTERIE_SOC_LADEBEGINN_WERT", "%" },
+  {   69, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_E1_12V_BATTERIE_TEMP_LADEBEGINN_WERT", "°C" },
+  {   70, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_E2_12V_BATTERIE_TEMP_LADEBEGINN_WERT", "°C" },
+  {   71, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_E3_12V_BATTERIE_TEMP_LADEBEGINN_WERT", "°C" },
+  {   72, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_E4_12V_BATTERIE_TEMP_LADEBEGINN_WERT", "°C" },
+  {   73, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_E1_LADEDAUER_WERT_0X409D", "s" },
+  {   75, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_E2_LADEDAUER_WERT_0X409D", "s" },
+  {   77, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_E3_LADEDAUER_WERT_0X409D", "s" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_E4_LADEDAUER_WERT_0X409D", "s" },
+  {   81, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   83, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   84, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   85, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E1_HV_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   86, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E2_HV_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   87, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E3_HV_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   88, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_E4_HV_BATTERIE_SOC_LADEENDE_WERT", "%" },
+  {   89, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E1_12VLADEFEHLER", "0-n" },
+  {   90, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E2_12VLADEFEHLER", "0-n" },
+  {   91, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E3_12VLADEFEHLER", "0-n" },
+  {   92, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_E4_12VLADEFEHLER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_12V_NACHLADEHISTOGRAMM[] = {   // 0x409E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_A_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_B_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_C_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_D_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_E_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_F_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_G_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_H_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_A_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_B_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_C_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_D_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_E_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_F_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_G_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_H_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_S_KL_15_WUP[] = {   // 0x4101
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_E_S_KL15_WUP", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_PWG1_RAW[] = {   // 0x4102
+  {    0, BMW_UDS_UINT  , 0              , 0.0048828125f, 0.0f, "STAT_E_A_PWG1_RAW_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_PWG2_RAW[] = {   // 0x4103
+  {    0, BMW_UDS_UINT  , 0              , 0.0048828125f, 0.0f, "STAT_E_A_PWG2_RAW_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_TMEL_RAW[] = {   // 0x4104
+  {    0, BMW_UDS_UINT  , 0              , 0.00122070312f, 0.0f, "STAT_E_A_TMEL_RAW_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_BATTERIE_VOLTAGE_RAUS[] = {   // 0x4105
+  {    0, BMW_UDS_UINT  , 0              , 0.00122100122f, 0.0f, "STAT_BATTERY_VOLTAGE_RAW_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_U_PWG1[] = {   // 0x4106
+  {    0, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_A_U_PWG1_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_U_PWG2[] = {   // 0x4107
+  {    0, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_A_U_PWG2_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_MEL[] = {   // 0x4109
+  {    0, BMW_UDS_UINT  , 0              , 0.00305526252f, 0.0f, "STAT_E_A_MEL_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_ECU_MICRO_TEMPERATUR[] = {   // 0x410A
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_ECU_MICRO_TEMPERATUR_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_TMEL2_RAW[] = {   // 0x410B
+  {    0, BMW_UDS_UINT  , 0              , 0.00488758553f, 0.0f, "STAT__WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_S_ELRLY[] = {   // 0x4120
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_A_S_ELRLY", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_T_ELUE[] = {   // 0x4121
+  {    0, BMW_UDS_UINT  , 0              , 0.00152590219f, 0.0f, "STAT_A_T_ELUE_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_T_EWP[] = {   // 0x4122
+  {    0, BMW_UDS_UINT  , 0              , 0.00152590219f, 0.0f, "STAT_A_T_EWAP_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_S_KV1[] = {   // 0x4123
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_A_S_KV1", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_S_KV2[] = {   // 0x4124
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_A_S_KV2", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_A_S_MEL[] = {   // 0x4125
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_A_S_MEL", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_PWG1[] = {   // 0x4182
+  {    0, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_E_A_PWG1_FILTERED_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_E_A_PWG2_FILTERED[] = {   // 0x4183
+  {    0, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_E_A_PWG2_FILTERED_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_TEMPERATUR_SENSOR_1[] = {   // 0x4184
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TEMPERATUR_TEMPERATURSENSOR_1_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_BATTERY_VOLTAGE_FILTERED[] = {   // 0x4185
+  {    0, BMW_UDS_SINT  , 0              , 0.0078125f, 0.0f, "STAT_BATTERY_VOLTAGE_FILTERED_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STATUS_TEMPERATUR_SENSOR_2[] = {   // 0x418B
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TEMPERATUR_TEMPERATURSENSOR_2_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EDM_STEUERN_AKKS[] = {   // 0xF0D5
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AKKS_SMOTPOAKKSLIN_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AKKS_IS_POS_LIN_WERT", "" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AKKS_DSRD_POS_ANGLE_WERT", "" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_AKKS_ACT_POS_ANGLE_WERT", "" },
+  {    6, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_AKKS_ERROR", "Bit" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VRSAKKLIN_WERT", "" },
+  };
@@ -0,0 +1,1314 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eme_i01.json: EME 1A: Electrical machine electronics
+// This generated code  makes it easier to process CANBUS messages from the EME ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_EME_FEHLERSPEICHER_ENDE_WERKSABLAUF[] = {   // 0x1061
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FS_ENDE_WABL", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AKS_DIAG_STATUS_INFO[] = {   // 0x4009
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAM_STATUS_WERT", "HEX" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FRM_ISR_WERT", "HEX" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_POM_1MS_WERT", "HEX" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_POM_10MS_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ERR_MOT_TRCT_WERT", "HEX" },
+  {   11, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVSM_MC0_WERT", "HEX" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVSM_AKKUM_MC0_WERT", "HEX" },
+  {   19, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVSM_MC2_WERT", "HEX" },
+  {   23, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVSM_AKKUM_MC2_WERT", "HEX" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CPLD_INFO_WERT", "HEX" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FUSI_MC2_WERT", "HEX" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FUSI_MC0_WERT", "HEX" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SSD_MC0_WERT", "HEX" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ERR_UPDATE_IN_PROGRESS_WERT", "HEX" },
+  {   41, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FRM_WHY_WERT", "HEX" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FRM_EM2_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_DCDC_LV[] = {   // 0xDDF6
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SPANNUNG_DCDC_LV_WERT", "V" },
+  {    2, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_STROM_DCDC_LV_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVPM_DCDC_ANSTEUERUNG[] = {   // 0xDE00
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_HVB_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_SOC_HVB_MIN_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEGERAET", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREMDLADUNG", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAHRB", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BA_DCDC_KOMM_NR", "0-n" },
+  {    7, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_I_DCDC_HV_OUT_WERT", "A" },
+  {    9, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_U_DCDC_HV_OUT_WERT", "V" },
+  {   11, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_I_DCDC_LV_OUT_WERT", "A" },
+  {   13, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_U_DCDC_LV_OUT_WERT", "V" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BA_DCDC_IST_NR", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_ALS_DCDC_WERT", "%" },
+  {   17, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_I_DCDC_HV_WERT", "A" },
+  {   19, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_U_DCDC_HV_WERT", "V" },
+  {   21, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_I_DCDC_LV_WERT", "A" },
+  {   23, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_U_DCDC_LV_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVPM_HV_SYSTEM_ON_OFF[] = {   // 0xDE02
+  {    0, BMW_UDS_SINT  , 0              , 0.0313f, 0.0f, "STAT_U_DC_HV_LE_WERT", "V" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HV_READY", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HDCAC_EREQ", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_I0ANF_HVB", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANF_ENTL_ZK", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVSTART_KOMM", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANF_ENTL_EME", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVPM_ENERGIEBORDNETZ_2[] = {   // 0xDE04
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_0_20_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_20_25_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_25_30_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_30_33_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_33_36_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_36_39_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_39_42_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_42_45_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_45_48_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_48_51_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_51_56_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_56_65_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_65_80_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_80_100_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVPM_PKOR[] = {   // 0xDE06
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_0_WERT", "s" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_1_WERT", "s" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_2_WERT", "s" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_3_WERT", "s" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_4_WERT", "s" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_5_WERT", "s" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_6_WERT", "s" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_7_WERT", "s" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_8_WERT", "s" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_9_WERT", "s" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_10_WERT", "s" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_11_WERT", "s" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_12_WERT", "s" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_0_WERT", "s" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_1_WERT", "s" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_2_WERT", "s" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_3_WERT", "s" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_4_WERT", "s" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_5_WERT", "s" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_6_WERT", "s" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_7_WERT", "s" },
+  {   42, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_8_WERT", "s" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_9_WERT", "s" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_10_WERT", "s" },
+  {   48, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_11_WERT", "s" },
+  {   50, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_12_WERT", "s" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_0_WERT", "s" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_1_WERT", "s" },
+  {   56, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_2_WERT", "s" },
+  {   58, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_3_WERT", "s" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_4_WERT", "s" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_5_WERT", "s" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_6_WERT", "s" },
+  {   66, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_7_WERT", "s" },
+  {   68, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_8_WERT", "s" },
+  {   70, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_9_WERT", "s" },
+  {   72, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_10_WERT", "s" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_11_WERT", "s" },
+  {   76, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_12_WERT", "s" },
+  {   78, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_0_WERT", "W" },
+  {   80, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_1_WERT", "W" },
+  {   82, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_2_WERT", "W" },
+  {   84, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_3_WERT", "W" },
+  {   86, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_4_WERT", "W" },
+  {   88, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_5_WERT", "W" },
+  {   90, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_6_WERT", "W" },
+  {   92, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_7_WERT", "W" },
+  {   94, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_8_WERT", "W" },
+  {   96, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_9_WERT", "W" },
+  {   98, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_0_WERT", "W" },
+  {  100, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_1_WERT", "W" },
+  {  102, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_2_WERT", "W" },
+  {  104, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_3_WERT", "W" },
+  {  106, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_4_WERT", "W" },
+  {  108, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_5_WERT", "W" },
+  {  110, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_6_WERT", "W" },
+  {  112, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_7_WERT", "W" },
+  {  114, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_8_WERT", "W" },
+  {  116, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_9_WERT", "W" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVIL_GESAMT[] = {   // 0xDE0C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVIL_GESAMT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_ANSTEUERUNG_ELUP[] = {   // 0xDE0E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANST_ELUP_ON", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EME_HVPM_DCDC_ALS[] = {   // 0xDE1C
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_NULL_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_1_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_2_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_3_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_CPLD_VERSION[] = {   // 0xDE2D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CPLD_VERSION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SYSTEMLEISTUNG_INV_EM[] = {   // 0xDE39
+  {    0, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_ST_ERR_MOT_TRCT", "Bit" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, -48.0f, "STAT_AVL_TEMP_MOT_TRCT_WERT", "°C" },
+  {    3, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_T_EM2TMODROT_WERT", "°C" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, -48.0f, "STAT_AVL_COL_TEMP_ENGMG_EL_WERT", "°C" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TMOD_V_T_LE2_COOLANT_EXIT_EST_WERT", "°C" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_TEMP_INVE_IGBT_MAX_WERT", "°C" },
+  {    8, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_ST_INFO_DER_MOT_TRCT", "Bit" },
+  {   10, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_ST_INFO_DER_INVE_TRCT", "Bit" },
+  {   12, BMW_UDS_UINT32, BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_V_E_EM2POMERROR50US", "Bit" },
+  {   16, BMW_UDS_UINT32, BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_V_E_FUSILDUWB_MC2_UE2", "Bit" },
+  {   20, BMW_UDS_UINT32, BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_V_E_FUSILDUWB", "Bit" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_E_EMOPMO_IST", "0-n" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_E_BAMSTATUS", "0-n" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_LIM_TQP_MD_EM2_GEN_MAX_WERT", "Nm" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_LIM_TQP_MD_EM2_MOT_MAX_WERT", "Nm" },
+  {   30, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_U_INVEM2_UQ_WERT", "V" },
+  {   32, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_U_INVEM2_UD_WERT", "V" },
+  {   34, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_I_INVEM2_IQ_WERT", "A" },
+  {   36, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_I_INVEM2_ID_WERT", "A" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_N_RSLV_STATUS", "0-n" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_PHI_RSLV_STATUS", "0-n" },
+  {   40, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_TAR_TORQ_MOT_TRCT_ASD_WERT", "Nm" },
+  {   42, BMW_UDS_UINT  , 0              , 0.5f, -1023.5f, "STAT_TAR_TORQ_MOT_TRCT_WERT", "Nm" },
+  {   44, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_N_EMMECHSLOW_UE2_WERT", "1/min" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_E_RLSFUSI_ACVREQ", "0-n" },
+  {   47, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STAT_V_ST_RLS_FUSI_MC0", "Bit" },
+  {   48, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_I_INV1_U_RMS_WERT", "A" },
+  {   50, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_I_INV1_V_RMS_WERT", "A" },
+  {   52, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_V_I_INV1_W_RMS_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_LSC_LADEN_2[] = {   // 0xDE6E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEMODUS", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POSITIONIERUNG", "0-n" },
+  {    2, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEUNTERBRECHUNG", "Bit" },
+  {    4, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_HVB_SOC_DISP_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_STATUS_LSC_AUSWAHL_LADEN_MODUS", "Bit" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LSC_PROGNOSEMODE", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LSC_VERSION", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKT_PHASE_COUNT_AC_CHARGING", "0-n" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HV_BATTERY_SIZE_WERT", "" },
+  {   11, BMW_UDS_UINT  , 0              , 0.02f, 0.0f, "STAT_ENERGIEDELTA_VOLL_WERT", "kWh" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEENDE_URSACHE", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEVERFAHREN_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADESTATUS_NR", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEGINN_FENSTER_STD_WERT", "h" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEGINN_FENSTER_MIN_WERT", "min" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENDE_FENSTER_STD_WERT", "h" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENDE_FENSTER_MIN_WERT", "min" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEFENSTER1_AUSWAHL_NR", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEFENSTER2_AUSWAHL_NR", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKTOR_STROMBEGRENZUNG_NR", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STROMBEGRENZUNG_AUSWAHL_NR", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_1_WERT", "" },
+  {   25, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_1_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_2_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_2_WERT", "%" },
+  {   30, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_3_WERT", "" },
+  {   31, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_3_WERT", "%" },
+  {   33, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_4_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_4_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_5_WERT", "" },
+  {   37, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_5_WERT", "%" },
+  {   39, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HV_SOC_IST_WERT", "%" },
+  {   41, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_WERT", "min" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEN_SPANNUNG_WERT", "V" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEN_STROM_WERT", "A" },
+  {   45, BMW_UDS_UINT32, 0              , 3600.0f, 0.0f, "STAT_ENERGIEINHALT_IST_WERT", "Ws" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LSC_TRIGGER_INHALT_NR", "0-n" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ENERGIEINHALT_MAX_WERT", "Ws" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_REST_WERT", "min" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADESTECKER_NR", "0-n" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LSC_AUSWAHL_LADEN_SOFORT_MODUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_CHARGE_ENABLE[] = {   // 0xDE71
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CHARGE_ENABLE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_SENSOREN[] = {   // 0xDE74
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_1_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_2_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_HV_SPANNUNG_LESEN[] = {   // 0xDE75
+  {    0, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_PFC_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_AC_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_SPANNUNG_HV_DCDC_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_SPANNUNG_HV_UMRICHTER_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_SW[] = {   // 0xDE76
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PS_SW_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_POSITION[] = {   // 0xDE79
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_POSITION_PARKSPERRE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_STROM[] = {   // 0xDE7B
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STROM_PARKSPERRE_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_SPANNUNGEN[] = {   // 0xDE7C
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PS_SPG_HBRUECKE_WERT", "mV" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PS_POSITION_OFFEN_WERT", "mV" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_AUSGANG[] = {   // 0xDE7D
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE1_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE2", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE_NOTENTRIEGELUNG", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_ELUP_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_ELUP_BUDS[] = {   // 0xDE7E
+  {    0, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_ENDSTUFE_ELUP_WERT", "V" },
+  {    4, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_BUDS_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_EM_INV[] = {   // 0xDE7F
+  {    0, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_EMASCHINE_STATOR_WERT", "V" },
+  {    4, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_U_WERT", "V" },
+  {    8, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_V_WERT", "V" },
+  {   12, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_W_WERT", "V" },
+  {   16, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_HVDC_UMRICHTER_WERT", "V" },
+  {   20, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_HVDC_UMRICHTER_WERT", "A" },
+  {   24, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_U_WERT", "A" },
+  {   28, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_V_WERT", "A" },
+  {   32, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_W_WERT", "A" },
+  {   36, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_ROTORLAGESENSOR_WERT", "rad" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE[] = {   // 0xDE80
+  {    0, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_PARKSPERRE_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_POSITION_PARKSPERRE3_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_POSITION_PARKSPERRE4_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_SG[] = {   // 0xDE81
+  {    0, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_KL30B_WERT", "V" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_KL15WUO_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_CRASHSIGNAL_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_SLE[] = {   // 0xDE82
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_AC_NETZ_L1_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_STROM_PFC_EFF_WERT", "A" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ROHSIGNAL_E_S_CHARGE_EN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ROHSIG_EINGANG_SENS_DCDC[] = {   // 0xDE83
+  {    0, BMW_UDS_UINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_LV_DCDC_WERT", "V" },
+  {    4, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_LV_DCDC_WERT", "A" },
+  {    8, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_HV_DCDC_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_BETRIEBSZUSTAND_SLE[] = {   // 0xDE84
+  {    0, BMW_UDS_UINT  , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_WERT", "s" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FEHLERZUSTAND_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLE_DERATING_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BETRIEBSART_NR", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SLE_LEISTUNG[] = {   // 0xDE85
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, -30000.0f, "STAT_SLE_DC_HV_LEISTUNG_WERT", "W" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, -30000.0f, "STAT_SLE_DC_HV_LEISTUNG_MAX_WERT", "W" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, -30000.0f, "STAT_SLE_AC_WIRKLEISTUNG_WERT", "W" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SLE_SPANNUNG[] = {   // 0xDE86
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_SLE_DC_HV_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_SLE_DC_HV_OBERGRENZE_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SLE_STROM[] = {   // 0xDE87
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, -100.0f, "STAT_STROM_TRAFO_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SPANNUNG_KLEMME30B[] = {   // 0xDE88
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SPANNUNG_KL30B_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_STROM_DCDC[] = {   // 0xDE89
+  {    0, BMW_UDS_UINT  , 0              , 0.05f, -100.0f, "STAT_STROM_DCDC_WANDLER_HV_WERT", "A" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, -1000.0f, "STAT_STROM_DCDC_WANDLER_12V_WERT", "A" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STROM_DCDC_TS1_WERT", "A" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STROM_DCDC_TS2_WERT", "A" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STROM_DCDC_TRAFO1_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_STROM_EMASCHINE[] = {   // 0xDE8A
+  {    0, BMW_UDS_SINT  , 0              , 0.0625f, 0.0f, "STAT_STROM_AC_EFF_W_WERT", "A" },
+  {    2, BMW_UDS_SINT  , 0              , 0.0625f, 0.0f, "STAT_STROM_AC_EFF_V_WERT", "A" },
+  {    4, BMW_UDS_SINT  , 0              , 0.0625f, 0.0f, "STAT_STROM_AC_EFF_U_WERT", "A" },
+  {    6, BMW_UDS_SINT  , 0              , 0.0625f, 0.0f, "STAT_ERREGERSTROM_WERT", "A" },
+  {    8, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_STROM_DC_HV_UMRICHTER_EM_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_TEMP_LE[] = {   // 0xDE8C
+  {    0, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_U_WERT", "°C" },
+  {    2, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_V_WERT", "°C" },
+  {    4, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_W_WERT", "°C" },
+  {    6, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_GT_WERT", "°C" },
+  {    8, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_DCDC_BO_WERT", "°C" },
+  {   10, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_DCDC_GTW_WERT", "°C" },
+  {   12, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_DCDC_TS_WERT", "°C" },
+  {   14, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_DCDC_GR_WERT", "°C" },
+  {   16, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_SLE_PFC_WERT", "°C" },
+  {   18, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_SLE_GR_WERT", "°C" },
+  {   20, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_SLE_GTW_WERT", "°C" },
+  {   22, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_SLE_BO_WERT", "°C" },
+  {   24, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_ELUP_LE_WERT", "°C" },
+  {   26, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_PROZESSOR_MC0_WERT", "°C" },
+  {   28, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP_PROZESSOR_MC2_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ZUSTAND_1_DCDC[] = {   // 0xDE92
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BETRIEBSART_DCDC_IST", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 0.05f, 0.0f, "STAT_SPANNUNG_LV_IST_WERT", "V" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUSLASTUNG_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ZUSTAND_DCDC_FEHLERBILD[] = {   // 0xDE96
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xDE96_D", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_STATUS_CONNECTED_DRIVE[] = {   // 0xDE9E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEN_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REMOTE_LADEN_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TIMER_LADEN_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_HV_SOC_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_LADEENDE_WERT", "min" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MAX_LADESTROM_LADEGERAET_WERT", "A" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_IST_AC_SPANNUNG_LADEGERAET_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REICHWEITE_WERT", "km" },
+  {   10, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_HVB_TEMP_WERT", "°" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRIGGER_SEGMENTSPEICHER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_BUDS[] = {   // 0xDEA5
+  {    0, BMW_UDS_UCHAR , 0              , 4.0f, -1000.0f, "STAT_BUDS_WERT", "hPa" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_TEMP_EMASCHINE[] = {   // 0xDEA6
+  {    0, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP1_E_MOTOR_WERT", "°C" },
+  {    2, BMW_UDS_SINT  , 0              , 0.0156f, 0.0f, "STAT_TEMP2_E_MOTOR_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ELEKTRISCHE_MASCHINE[] = {   // 0xDEA7
+  {    0, BMW_UDS_UINT  , 0              , 0.5f, -5000.0f, "STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT", "1/min" },
+  {    2, BMW_UDS_SINT  , 0              , 0.5f, 0.0f, "STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT", "Nm" },
+  {    4, BMW_UDS_SINT  , 0              , 0.5f, 0.0f, "STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT", "Nm" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ELEKTRISCHE_BETRIEBSART_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_ZUSTAND_2_DCDC[] = {   // 0xDEA9
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xDEA9_D", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_PARKSPERRE_VERSION[] = {   // 0xDEB0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PS_VERSION_MAIN_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PS_VERSION_SUB_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_CTRL_VERSION[] = {   // 0xDEBC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CTRL_VERSION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SPANNUNG_DCDC[] = {   // 0xDEBD
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_LV_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SPANNUNG_LE[] = {   // 0xDEBE
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY0_5V0_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY2_5V0_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY0_3V3_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY2_3V3_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY0_1V5_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_CY2_1V5_WERT", "V" },
+  {   12, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_SPANNUNG_32V_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_SYSSTATE[] = {   // 0xDEBF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SYSSTATE_DPR", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SYSSTATE_MC0_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SYSSTATE_MC2_NR", "0-n" },
+  {    3, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_SYSSTATE_KLEMMEN", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_SPANNUNG_ELUP[] = {   // 0xDEC2
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_U_ELUP_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_STROM_ELUP[] = {   // 0xDEC3
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_I_ELUP_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_FAHRSTUFE[] = {   // 0xDEDD
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POS_PRND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_LSC_LADEN[] = {   // 0xDEDE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEVERFAHREN_NR_0XDEDE", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADESTATUS_NR_0XDEDE", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEGINN_FENSTER_STD_WERT_0XDEDE", "h" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEGINN_FENSTER_MIN_WERT_0XDEDE", "min" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENDE_FENSTER_STD_WERT_0XDEDE", "h" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENDE_FENSTER_MIN_WERT_0XDEDE", "min" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEFENSTER1_AUSWAHL_NR_0XDEDE", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEFENSTER2_AUSWAHL_NR_0XDEDE", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKTOR_STROMBEGRENZUNG_NR_0XDEDE", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STROMBEGRENZUNG_AUSWAHL_NR_0XDEDE", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_1_WERT_0XDEDE", "" },
+  {   11, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_1_WERT_0XDEDE", "%" },
+  {   13, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_2_WERT_0XDEDE", "" },
+  {   14, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_2_WERT_0XDEDE", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_3_WERT_0XDEDE", "" },
+  {   17, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_3_WERT_0XDEDE", "%" },
+  {   19, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_4_WERT_0XDEDE", "" },
+  {   20, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_4_WERT_0XDEDE", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_POLY_TIM_5_WERT_0XDEDE", "" },
+  {   23, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_POLY_SOC_5_WERT_0XDEDE", "%" },
+  {   25, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HV_SOC_IST_WERT_0XDEDE", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_LADEN_PROGNOSE_WERT_0XDEDE", "min" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEN_SPANNUNG_WERT_0XDEDE", "V" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEN_STROM_WERT_0XDEDE", "A" },
+  {   30, BMW_UDS_UINT32, 0              , 3600.0f, 0.0f, "STAT_ENERGIEINHALT_IST_WERT_0XDEDE", "Ws" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LSC_TRIGGER_INHALT_NR_0XDEDE", "0-n" },
+  {   35, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ENERGIEINHALT_MAX_WERT_0XDEDE", "Ws" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_REST_WERT_0XDEDE", "min" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADESTECKER_NR_0XDEDE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_HISTOGRAMM_ANTRIEB[] = {   // 0xDEED
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_010_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_011_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_012_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_013_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_014_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_015_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_016_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_017_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_018_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_019_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_020_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_021_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_022_WERT", "" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_023_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_024_WERT", "" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_025_WERT", "" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_026_WERT", "" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_027_WERT", "" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1601_WERT", "" },
+  {   76, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1602_WERT", "" },
+  {   80, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1603_WERT", "" },
+  {   84, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1604_WERT", "" },
+  {   88, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1605_WERT", "" },
+  {   92, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANTR_HIST_1606_WERT", "" },
+  {   96, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3214_WERT", "" },
+  {  100, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3215_WERT", "" },
+  {  104, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3216_WERT", "" },
+  {  108, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3217_WERT", "" },
+  {  112, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3218_WERT", "" },
+  {  116, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3219_WERT", "" },
+  {  120, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3220_WERT", "" },
+  {  124, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3221_WERT", "" },
+  {  128, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3278_WERT", "" },
+  {  132, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3279_WERT", "" },
+  {  136, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3280_WERT", "" },
+  {  140, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3281_WERT", "" },
+  {  144, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3282_WERT", "" },
+  {  148, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3283_WERT", "" },
+  {  152, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3284_WERT", "" },
+  {  156, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3285_WERT", "" },
+  {  160, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3286_WERT", "" },
+  {  164, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3287_WERT", "" },
+  {  168, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3288_WERT", "" },
+  {  172, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3289_WERT", "" },
+  {  176, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3290_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_HISTOGRAMM_DEGRADATION[] = {   // 0xDEEF
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3238_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3239_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3240_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3241_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3242_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3243_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3244_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3245_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3246_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3247_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3248_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3249_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3250_WERT", "" },
+  {   52, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3251_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3252_WERT", "" },
+  {   60, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3253_WERT", "" },
+  {   64, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3254_WERT", "" },
+  {   68, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3255_WERT", "" },
+  {   72, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3256_WERT", "" },
+  {   76, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3257_WERT", "" },
+  {   80, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3258_WERT", "" },
+  {   84, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3259_WERT", "" },
+  {   88, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3260_WERT", "" },
+  {   92, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3261_WERT", "" },
+  {   96, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3262_WERT", "" },
+  {  100, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3263_WERT", "" },
+  {  104, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3264_WERT", "" },
+  {  108, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3265_WERT", "" },
+  {  112, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3266_WERT", "" },
+  {  116, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3267_WERT", "" },
+  {  120, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3268_WERT", "" },
+  {  124, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3269_WERT", "" },
+  {  128, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3270_WERT", "" },
+  {  132, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3271_WERT", "" },
+  {  136, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3272_WERT", "" },
+  {  140, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3273_WERT", "" },
+  {  144, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3274_WERT", "" },
+  {  148, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3275_WERT", "" },
+  {  152, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3276_WERT", "" },
+  {  156, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ANTR_HIST_3277_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AUTOP_SBW[] = {   // 0xDEFB
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_LVEH_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_EMF_N_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_EMF_DR_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_FB_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_KL15_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COUNT_AUTOP_CHRGWIRE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_FAHRSTUFEN_ZAEHLER_SBW[] = {   // 0xDEFF
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_R_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_N_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_D_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_P_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_N_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_D_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_P_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_R_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_D_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_P_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_R_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_N_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_HISTOGRAMM_LADEKOORDINATOR[] = {   // 0xDF49
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_1_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_2_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_3_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_4_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_5_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_6_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_1_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_2_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_3_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_4_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_5_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_INT_6_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_1_WERT", "" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_2_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_3_WERT", "" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_4_WERT", "" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_5_WERT", "" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_6_WERT", "" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_1_WERT", "" },
+  {   76, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_2_WERT", "" },
+  {   80, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_3_WERT", "" },
+  {   84, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_4_WERT", "" },
+  {   88, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_5_WERT", "" },
+  {   92, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_INVERTER_HISTOGRAMM[] = {   // 0xDF4D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, -10.0f, "STAT_INVERTER_IGBT_LEBENSZEIT_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, -10.0f, "STAT_INVERTER_IGBT_LEBENSZEIT_KONST_KUEHLUNG_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, -10.0f, "STAT_INVERTER_DIODE_LEBENSZEIT_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, -10.0f, "STAT_INVERTER_DIODE_LEBENSZEIT_KONST_KUEHLUNG_WERT", "%" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INVERTER_RESET_LEBENSZEIT_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_INVERTER_RBM_INFO[] = {   // 0xDF58
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC1_WERT", "HEX" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC2_WERT", "HEX" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC3_WERT", "HEX" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC4_WERT", "HEX" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC5_WERT", "HEX" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT", "" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC6_WERT", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_DCDC_RBM_INFO[] = {   // 0xDF59
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC1_WERT_0XDF59", "HEX" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT_0XDF59", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT_0XDF59", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC2_WERT_0XDF59", "HEX" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT_0XDF59", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT_0XDF59", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC3_WERT_0XDF59", "HEX" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT_0XDF59", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT_0XDF59", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC4_WERT_0XDF59", "HEX" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT_0XDF59", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT_0XDF59", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC5_WERT_0XDF59", "HEX" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT_0XDF59", "" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT_0XDF59", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC6_WERT_0XDF59", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT_0XDF59", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT_0XDF59", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC7_WERT", "HEX" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM7_WERT", "" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN7_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC8_WERT", "HEX" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM8_WERT", "" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN8_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_LADEGERAET_RBM_INFO[] = {   // 0xDF5A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC1_WERT_0XDF5A", "HEX" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT_0XDF5A", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT_0XDF5A", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC2_WERT_0XDF5A", "HEX" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT_0XDF5A", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT_0XDF5A", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC3_WERT_0XDF5A", "HEX" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT_0XDF5A", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT_0XDF5A", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC4_WERT_0XDF5A", "HEX" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT_0XDF5A", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT_0XDF5A", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC5_WERT_0XDF5A", "HEX" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT_0XDF5A", "" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT_0XDF5A", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC6_WERT_0XDF5A", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT_0XDF5A", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT_0XDF5A", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC7_WERT_0XDF5A", "HEX" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM7_WERT_0XDF5A", "" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN7_WERT_0XDF5A", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC8_WERT_0XDF5A", "HEX" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM8_WERT_0XDF5A", "" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN8_WERT_0XDF5A", "" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC9_WERT", "HEX" },
+  {   68, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM9_WERT", "" },
+  {   70, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN9_WERT", "" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC10_WERT", "HEX" },
+  {   76, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM10_WERT", "" },
+  {   78, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN10_WERT", "" },
+  {   80, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC11_WERT", "HEX" },
+  {   84, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM11_WERT", "" },
+  {   86, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN11_WERT", "" },
+  {   88, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC12_WERT", "HEX" },
+  {   92, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM12_WERT", "" },
+  {   94, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN12_WERT", "" },
+  {   96, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC13_WERT", "HEX" },
+  {  100, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM13_WERT", "" },
+  {  102, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN13_WERT", "" },
+  {  104, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC14_WERT", "HEX" },
+  {  108, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM14_WERT", "" },
+  {  110, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN14_WERT", "" },
+  {  112, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC15_WERT", "HEX" },
+  {  116, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM15_WERT", "" },
+  {  118, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN15_WERT", "" },
+  {  120, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC16_WERT", "HEX" },
+  {  124, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM16_WERT", "" },
+  {  126, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN16_WERT", "" },
+  {  128, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC17_WERT", "HEX" },
+  {  132, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM17_WERT", "" },
+  {  134, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN17_WERT", "" },
+  {  136, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC18_WERT", "HEX" },
+  {  140, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM18_WERT", "" },
+  {  142, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN18_WERT", "" },
+  {  144, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC19_WERT", "HEX" },
+  {  148, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM19_WERT", "" },
+  {  150, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN19_WERT", "" },
+  {  152, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC20_WERT", "HEX" },
+  {  156, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM20_WERT", "" },
+  {  158, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN20_WERT", "" },
+  {  160, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC21_WERT", "HEX" },
+  {  164, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM21_WERT", "" },
+  {  166, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN21_WERT", "" },
+  {  168, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC22_WERT", "HEX" },
+  {  172, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM22_WERT", "" },
+  {  174, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN22_WERT", "" },
+  {  176, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC23_WERT", "HEX" },
+  {  180, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM23_WERT", "" },
+  {  182, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN23_WERT", "" },
+  {  184, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SAE_DTC24_WERT", "HEX" },
+  {  188, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_NUM24_WERT", "" },
+  {  190, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SAE_DTC_DEN24_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM[] = {   // 0xDFB5
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_1_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_2_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_3_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_4_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_5_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_6_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_1_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_2_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_3_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_4_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_5_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_6_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_1_WERT", "" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_2_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_3_WERT", "" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_4_WERT", "" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_5_WERT", "" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_LADEGERAET_HV_UEBERSTROM[] = {   // 0xDFB7
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZAEHLER_HV_UEBERSTROM_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_EMASCHINE_MAX_DREHZAHL[] = {   // 0xDFCE
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DREHZAHL_BEREICH_1_WERT", "s" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DREHZAHL_BEREICH_2_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN[] = {   // 0xDFD0
+  {    0, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_1_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_2_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_3_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_4_WERT", "%" },
+  {    8, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_5_WERT", "%" },
+  {   10, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_6_WERT", "%" },
+  {   12, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_7_WERT", "%" },
+  {   14, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_8_WERT", "%" },
+  {   16, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_9_WERT", "%" },
+  {   18, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_10_WERT", "%" },
+  {   20, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_11_WERT", "%" },
+  {   22, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_12_WERT", "%" },
+  {   24, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_13_WERT", "%" },
+  {   26, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_14_WERT", "%" },
+  {   28, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_15_WERT", "%" },
+  {   30, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_16_WERT", "%" },
+  {   32, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_17_WERT", "%" },
+  {   34, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_18_WERT", "%" },
+  {   36, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_19_WERT", "%" },
+  {   38, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_20_WERT", "%" },
+  {   40, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_21_WERT", "%" },
+  {   42, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_22_WERT", "%" },
+  {   44, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_23_WERT", "%" },
+  {   46, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_24_WERT", "%" },
+  {   48, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_25_WERT", "%" },
+  {   50, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_26_WERT", "%" },
+  {   52, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_27_WERT", "%" },
+  {   54, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_28_WERT", "%" },
+  {   56, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_29_WERT", "%" },
+  {   58, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_30_WERT", "%" },
+  {   60, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_31_WERT", "%" },
+  {   62, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_32_WERT", "%" },
+  {   64, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_33_WERT", "%" },
+  {   66, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_34_WERT", "%" },
+  {   68, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_35_WERT", "%" },
+  {   70, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_36_WERT", "%" },
+  {   72, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_37_WERT", "%" },
+  {   74, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_38_WERT", "%" },
+  {   76, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_39_WERT", "%" },
+  {   78, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_40_WERT", "%" },
+  {   80, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_41_WERT", "%" },
+  {   82, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_42_WERT", "%" },
+  {   84, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_43_WERT", "%" },
+  {   86, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_44_WERT", "%" },
+  {   88, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_45_WERT", "%" },
+  {   90, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_46_WERT", "%" },
+  {   92, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_47_WERT", "%" },
+  {   94, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_48_WERT", "%" },
+  {   96, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_49_WERT", "%" },
+  {   98, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_50_WERT", "%" },
+  {  100, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_51_WERT", "%" },
+  {  102, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_52_WERT", "%" },
+  {  104, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_53_WERT", "%" },
+  {  106, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_54_WERT", "%" },
+  {  108, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_55_WERT", "%" },
+  {  110, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_56_WERT", "%" },
+  {  112, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_57_WERT", "%" },
+  {  114, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_58_WERT", "%" },
+  {  116, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_59_WERT", "%" },
+  {  118, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_60_WERT", "%" },
+  {  120, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_61_WERT", "%" },
+  {  122, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_62_WERT", "%" },
+  {  124, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_63_WERT", "%" },
+  {  126, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_64_WERT", "%" },
+  {  128, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_65_WERT", "%" },
+  {  130, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_66_WERT", "%" },
+  {  132, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_67_WERT", "%" },
+  {  134, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_68_WERT", "%" },
+  {  136, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_69_WERT", "%" },
+  {  138, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_70_WERT", "%" },
+  {  140, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_71_WERT", "%" },
+  {  142, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_72_WERT", "%" },
+  {  144, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_73_WERT", "%" },
+  {  146, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_74_WERT", "%" },
+  {  148, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_75_WERT", "%" },
+  {  150, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_76_WERT", "%" },
+  {  152, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_77_WERT", "%" },
+  {  154, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_78_WERT", "%" },
+  {  156, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_79_WERT", "%" },
+  {  158, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_80_WERT", "%" },
+  {  160, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_81_WERT", "%" },
+  {  162, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_82_WERT", "%" },
+  {  164, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_83_WERT", "%" },
+  {  166, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_84_WERT", "%" },
+  {  168, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_85_WERT", "%" },
+  {  170, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_86_WERT", "%" },
+  {  172, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_87_WERT", "%" },
+  {  174, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_88_WERT", "%" },
+  {  176, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_89_WERT", "%" },
+  {  178, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_90_WERT", "%" },
+  {  180, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_91_WERT", "%" },
+  {  182, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_92_WERT", "%" },
+  {  184, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_93_WERT", "%" },
+  {  186, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_94_WERT", "%" },
+  {  188, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_95_WERT", "%" },
+  {  190, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_96_WERT", "%" },
+  {  192, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_97_WERT", "%" },
+  {  194, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_98_WERT", "%" },
+  {  196, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_99_WERT", "%" },
+  {  198, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_100_WERT", "%" },
+  {  200, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_101_WERT", "%" },
+  {  202, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_102_WERT", "%" },
+  {  204, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_103_WERT", "%" },
+  {  206, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_104_WERT", "%" },
+  {  208, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_105_WERT", "%" },
+  {  210, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_106_WERT", "%" },
+  {  212, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_107_WERT", "%" },
+  {  214, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_108_WERT", "%" },
+  {  216, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_109_WERT", "%" },
+  {  218, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_110_WERT", "%" },
+  {  220, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_111_WERT", "%" },
+  {  222, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_112_WERT", "%" },
+  {  224, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_113_WERT", "%" },
+  {  226, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_114_WERT", "%" },
+  {  228, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_115_WERT", "%" },
+  {  230, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_116_WERT", "%" },
+  {  232, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_117_WERT", "%" },
+  {  234, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_118_WERT", "%" },
+  {  236, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_119_WERT", "%" },
+  {  238, BMW_UDS_UINT  , 0              , 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_120_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_RATE_BASED_MONITORING[] = {   // 0xE52F
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_1_NUM_WERT", "" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_1_DEN_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_2_NUM_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_2_DEN_WERT", "" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_3_NUM_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_3_DEN_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_4_NUM_WERT", "" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_4_DEN_WERT", "" },
+  {   31, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_5_NUM_WERT", "" },
+  {   33, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_5_DEN_WERT", "" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_6_NUM_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_6_DEN_WERT", "" },
+  {   45, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_7_NUM_WERT", "" },
+  {   47, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_7_DEN_WERT", "" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_8_NUM_WERT", "" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_8_DEN_WERT", "" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_9_NUM_WERT", "" },
+  {   61, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_9_DEN_WERT", "" },
+  {   66, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_10_NUM_WERT", "" },
+  {   68, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_10_DEN_WERT", "" },
+  {   73, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_11_NUM_WERT", "" },
+  {   75, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_11_DEN_WERT", "" },
+  {   80, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_12_NUM_WERT", "" },
+  {   82, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_12_DEN_WERT", "" },
+  {   87, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_13_NUM_WERT", "" },
+  {   89, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_13_DEN_WERT", "" },
+  {   94, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_14_NUM_WERT", "" },
+  {   96, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_14_DEN_WERT", "" },
+  {  101, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_15_NUM_WERT", "" },
+  {  103, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_15_DEN_WERT", "" },
+  {  108, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_16_NUM_WERT", "" },
+  {  110, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_16_DEN_WERT", "" },
+  {  115, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_17_NUM_WERT", "" },
+  {  117, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_17_DEN_WERT", "" },
+  {  122, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_18_NUM_WERT", "" },
+  {  124, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_18_DEN_WERT", "" },
+  {  129, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_19_NUM_WERT", "" },
+  {  131, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_19_DEN_WERT", "" },
+  {  136, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_20_NUM_WERT", "" },
+  {  138, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_20_DEN_WERT", "" },
+  {  143, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_21_NUM_WERT", "" },
+  {  145, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_21_DEN_WERT", "" },
+  {  150, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_22_NUM_WERT", "" },
+  {  152, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_22_DEN_WERT", "" },
+  {  157, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_23_NUM_WERT", "" },
+  {  159, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_23_DEN_WERT", "" },
+  {  164, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_24_NUM_WERT", "" },
+  {  166, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_24_DEN_WERT", "" },
+  {  171, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_25_NUM_WERT", "" },
+  {  173, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_25_DEN_WERT", "" },
+  {  178, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_26_NUM_WERT", "" },
+  {  180, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_26_DEN_WERT", "" },
+  {  185, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_27_NUM_WERT", "" },
+  {  187, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_27_DEN_WERT", "" },
+  {  192, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_28_NUM_WERT", "" },
+  {  194, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_28_DEN_WERT", "" },
+  {  199, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_29_NUM_WERT", "" },
+  {  201, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_29_DEN_WERT", "" },
+  {  206, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_30_NUM_WERT", "" },
+  {  208, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_30_DEN_WERT", "" },
+  {  213, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_31_NUM_WERT", "" },
+  {  215, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_31_DEN_WERT", "" },
+  {  220, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_32_NUM_WERT", "" },
+  {  222, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_32_DEN_WERT", "" },
+  {  227, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_33_NUM_WERT", "" },
+  {  229, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_33_DEN_WERT", "" },
+  {  234, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_34_NUM_WERT", "" },
+  {  236, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_34_DEN_WERT", "" },
+  {  241, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_35_NUM_WERT", "" },
+  {  243, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_35_DEN_WERT", "" },
+  {  248, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_36_NUM_WERT", "" },
+  {  250, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_36_DEN_WERT", "" },
+  {  255, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_37_NUM_WERT", "" },
+  {  257, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_37_DEN_WERT", "" },
+  {  262, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_38_NUM_WERT", "" },
+  {  264, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_38_DEN_WERT", "" },
+  {  269, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_39_NUM_WERT", "" },
+  {  271, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_39_DEN_WERT", "" },
+  {  276, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_40_NUM_WERT", "" },
+  {  278, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_40_DEN_WERT", "" },
+  {  283, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_41_NUM_WERT", "" },
+  {  285, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_41_DEN_WERT", "" },
+  {  290, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_42_NUM_WERT", "" },
+  {  292, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_42_DEN_WERT", "" },
+  {  297, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_43_NUM_WERT", "" },
+  {  299, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_43_DEN_WERT", "" },
+  {  304, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_44_NUM_WERT", "" },
+  {  306, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_44_DEN_WERT", "" },
+  {  311, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_45_NUM_WERT", "" },
+  {  313, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_45_DEN_WERT", "" },
+  {  318, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_46_NUM_WERT", "" },
+  {  320, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_46_DEN_WERT", "" },
+  {  325, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_47_NUM_WERT", "" },
+  {  327, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_47_DEN_WERT", "" },
+  {  332, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_48_NUM_WERT", "" },
+  {  334, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_48_DEN_WERT", "" },
+  {  339, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_49_NUM_WERT", "" },
+  {  341, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_49_DEN_WERT", "" },
+  {  346, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_50_NUM_WERT", "" },
+  {  348, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_50_DEN_WERT", "" },
+  {  353, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_51_NUM_WERT", "" },
+  {  355, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_51_DEN_WERT", "" },
+  {  360, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_52_NUM_WERT", "" },
+  {  362, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_52_DEN_WERT", "" },
+  {  367, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_53_NUM_WERT", "" },
+  {  369, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_53_DEN_WERT", "" },
+  {  374, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_54_NUM_WERT", "" },
+  {  376, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_54_DEN_WERT", "" },
+  {  381, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_55_NUM_WERT", "" },
+  {  383, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_55_DEN_WERT", "" },
+  {  388, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_56_NUM_WERT", "" },
+  {  390, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_56_DEN_WERT", "" },
+  {  395, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_57_NUM_WERT", "" },
+  {  397, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_57_DEN_WERT", "" },
+  {  402, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_58_NUM_WERT", "" },
+  {  404, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_58_DEN_WERT", "" },
+  {  409, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_59_NUM_WERT", "" },
+  {  411, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_59_DEN_WERT", "" },
+  {  416, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_60_NUM_WERT", "" },
+  {  418, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_60_DEN_WERT", "" },
+  {  423, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_61_NUM_WERT", "" },
+  {  425, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_61_DEN_WERT", "" },
+  {  430, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_62_NUM_WERT", "" },
+  {  432, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_62_DEN_WERT", "" },
+  {  437, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_63_NUM_WERT", "" },
+  {  439, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_63_DEN_WERT", "" },
+  {  444, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_64_NUM_WERT", "" },
+  {  446, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_64_DEN_WERT", "" },
+  {  451, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_65_NUM_WERT", "" },
+  {  453, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_65_DEN_WERT", "" },
+  {  458, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_66_NUM_WERT", "" },
+  {  460, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_66_DEN_WERT", "" },
+  {  465, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_67_NUM_WERT", "" },
+  {  467, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_67_DEN_WERT", "" },
+  {  472, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_68_NUM_WERT", "" },
+  {  474, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_68_DEN_WERT", "" },
+  {  479, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_69_NUM_WERT", "" },
+  {  481, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_69_DEN_WERT", "" },
+  {  486, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_70_NUM_WERT", "" },
+  {  488, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_70_DEN_WERT", "" },
+  {  493, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_71_NUM_WERT", "" },
+  {  495, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_71_DEN_WERT", "" },
+  {  500, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_72_NUM_WERT", "" },
+  {  502, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_72_DEN_WERT", "" },
+  {  507, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_73_NUM_WERT", "" },
+  {  509, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_73_DEN_WERT", "" },
+  {  514, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_74_NUM_WERT", "" },
+  {  516, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_74_DEN_WERT", "" },
+  {  521, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_75_NUM_WERT", "" },
+  {  523, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_75_DEN_WERT", "" },
+  {  528, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_76_NUM_WERT", "" },
+  {  530, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_76_DEN_WERT", "" },
+  {  535, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_77_NUM_WERT", "" },
+  {  537, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_77_DEN_WERT", "" },
+  {  542, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_78_NUM_WERT", "" },
+  {  544, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_78_DEN_WERT", "" },
+  {  549, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_79_NUM_WERT", "" },
+  {  551, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_79_DEN_WERT", "" },
+  {  556, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_80_NUM_WERT", "" },
+  {  558, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_80_DEN_WERT", "" },
+  {  563, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_81_NUM_WERT", "" },
+  {  565, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_81_DEN_WERT", "" },
+  {  570, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_82_NUM_WERT", "" },
+  {  572, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_82_DEN_WERT", "" },
+  {  577, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_83_NUM_WERT", "" },
+  {  579, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_83_DEN_WERT", "" },
+  {  584, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_84_NUM_WERT", "" },
+  {  586, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_84_DEN_WERT", "" },
+  {  591, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_85_NUM_WERT", "" },
+  {  593, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_85_DEN_WERT", "" },
+  {  598, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_86_NUM_WERT", "" },
+  {  600, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_86_DEN_WERT", "" },
+  {  605, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_87_NUM_WERT", "" },
+  {  607, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_87_DEN_WERT", "" },
+  {  612, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_88_NUM_WERT", "" },
+  {  614, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_88_DEN_WERT", "" },
+  {  619, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_89_NUM_WERT", "" },
+  {  621, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_89_DEN_WERT", "" },
+  {  626, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_90_NUM_WERT", "" },
+  {  628, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_90_DEN_WERT", "" },
+  {  633, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_91_NUM_WERT", "" },
+  {  635, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_91_DEN_WERT", "" },
+  {  640, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_92_NUM_WERT", "" },
+  {  642, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_92_DEN_WERT", "" },
+  {  647, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_93_NUM_WERT", "" },
+  {  649, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_93_DEN_WERT", "" },
+  {  654, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_94_NUM_WERT", "" },
+  {  656, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_94_DEN_WERT", "" },
+  {  661, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_95_NUM_WERT", "" },
+  {  663, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_95_DEN_WERT", "" },
+  {  668, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_96_NUM_WERT", "" },
+  {  670, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_96_DEN_WERT", "" },
+  {  675, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_97_NUM_WERT", "" },
+  {  677, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_97_DEN_WERT", "" },
+  {  682, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_98_NUM_WERT", "" },
+  {  684, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_98_DEN_WERT", "" },
+  {  689, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_99_NUM_WERT", "" },
+  {  691, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_99_DEN_WERT", "" },
+  {  696, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_100_NUM_WERT", "" },
+  {  698, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_100_DEN_WERT", "" },
+  {  703, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_101_NUM_WERT", "" },
+  {  705, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_101_DEN_WERT", "" },
+  {  710, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_102_NUM_WERT", "" },
+  {  712, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_102_DEN_WERT", "" },
+  {  717, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_103_NUM_WERT", "" },
+  {  719, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_103_DEN_WERT", "" },
+  {  724, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_104_NUM_WERT", "" },
+  {  726, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_104_DEN_WERT", "" },
+  {  731, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_105_NUM_WERT", "" },
+  {  733, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_105_DEN_WERT", "" },
+  {  738, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_106_NUM_WERT", "" },
+  {  740, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_106_DEN_WERT", "" },
+  {  745, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_107_NUM_WERT", "" },
+  {  747, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_107_DEN_WERT", "" },
+  {  752, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_108_NUM_WERT", "" },
+  {  754, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_108_DEN_WERT", "" },
+  {  759, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_109_NUM_WERT", "" },
+  {  761, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_109_DEN_WERT", "" },
+  {  766, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_110_NUM_WERT", "" },
+  {  768, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_110_DEN_WERT", "" },
+  {  773, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_111_NUM_WERT", "" },
+  {  775, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_111_DEN_WERT", "" },
+  {  780, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_112_NUM_WERT", "" },
+  {  782, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_112_DEN_WERT", "" },
+  {  787, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_113_NUM_WERT", "" },
+  {  789, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_113_DEN_WERT", "" },
+  {  794, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_114_NUM_WERT", "" },
+  {  796, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_114_DEN_WERT", "" },
+  {  801, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_115_NUM_WERT", "" },
+  {  803, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_115_DEN_WERT", "" },
+  {  808, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_116_NUM_WERT", "" },
+  {  810, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_116_DEN_WERT", "" },
+  {  815, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_117_NUM_WERT", "" },
+  {  817, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_117_DEN_WERT", "" },
+  {  822, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_118_NUM_WERT", "" },
+  {  824, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_118_DEN_WERT", "" },
+  {  829, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_119_NUM_WERT", "" },
+  {  831, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_119_DEN_WERT", "" },
+  {  836, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_120_NUM_WERT", "" },
+  {  838, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_120_DEN_WERT", "" },
+  {  843, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_121_NUM_WERT", "" },
+  {  845, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_121_DEN_WERT", "" },
+  {  850, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_122_NUM_WERT", "" },
+  {  852, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_122_DEN_WERT", "" },
+  {  857, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_123_NUM_WERT", "" },
+  {  859, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_123_DEN_WERT", "" },
+  {  864, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_124_NUM_WERT", "" },
+  {  866, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_124_DEN_WERT", "" },
+  {  871, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_125_NUM_WERT", "" },
+  {  873, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_125_DEN_WERT", "" },
+  {  878, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_126_NUM_WERT", "" },
+  {  880, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_126_DEN_WERT", "" },
+  {  885, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_127_NUM_WERT", "" },
+  {  887, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_127_DEN_WERT", "" },
+  {  892, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_128_NUM_WERT", "" },
+  {  894, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_128_DEN_WERT", "" },
+  {  899, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_129_NUM_WERT", "" },
+  {  901, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_129_DEN_WERT", "" },
+  {  906, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_130_NUM_WERT", "" },
+  {  908, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_130_DEN_WERT", "" },
+  {  913, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_131_NUM_WERT", "" },
+  {  915, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_131_DEN_WERT", "" },
+  {  920, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_132_NUM_WERT", "" },
+  {  922, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_132_DEN_WERT", "" },
+  {  927, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_133_NUM_WERT", "" },
+  {  929, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_133_DEN_WERT", "" },
+  {  934, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_134_NUM_WERT", "" },
+  {  936, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_134_DEN_WERT", "" },
+  {  941, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_135_NUM_WERT", "" },
+  {  943, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_135_DEN_WERT", "" },
+  {  948, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_136_NUM_WERT", "" },
+  {  950, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_136_DEN_WERT", "" },
+  {  955, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_137_NUM_WERT", "" },
+  {  957, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_137_DEN_WERT", "" },
+  {  962, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_138_NUM_WERT", "" },
+  {  964, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_138_DEN_WERT", "" },
+  {  969, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_139_NUM_WERT", "" },
+  {  971, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_139_DEN_WERT", "" },
+  {  976, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_140_NUM_WERT", "" },
+  {  978, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_140_DEN_WERT", "" },
+  {  983, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_141_NUM_WERT", "" },
+  {  985, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_141_DEN_WERT", "" },
+  {  990, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_142_NUM_WERT", "" },
+  {  992, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DTC_142_DEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_LADEKOORDINATOR_INTERFACE[] = {   // 0xE5FE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_OPMO_CHGE_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_OPMOCHGE_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_OPMO_INTLE_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_OPMO_INTLE_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_OPMO_CF_CHGE_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_OPMO_CF_CHGE_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_CHG_MOD_CF_CHGE_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_CHG_MOD_CF_CHGE_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TAR_PWR_CHGNG_WERT", "W" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_AVL_PWR_CHGNG_WERT", "W" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_TAR_PWR_INTLE_WERT", "W" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_AVL_PWR_INTLE_WERT", "W" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TAR_PWR_CF_CHGE_WERT", "W" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AVL_PWR_CF_CHGE_WERT", "W" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_SPEC_I_MAX_ALTC_CHGE_WERT", "A" },
+  {   32, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPEC_I_MAX_ALTC_CF_CHGE_WERT", "A" },
+  {   34, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_CHGE_WERT", "A" },
+  {   38, BMW_UDS_SINT  , 0              , 0.1f, -204.7f, "STAT_AVL_I_CHGE_WERT", "A" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_INTLE_WERT", "A" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_AVL_I_INTLE_WERT", "A" },
+  {   48, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_CF_CHGE_WERT", "A" },
+  {   50, BMW_UDS_SINT  , 0              , 0.1f, -204.7f, "STAT_AVL_I_CF_CHGE_WERT", "A" },
+  {   52, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPEC_U_MAX_CHG_CHGE_WERT", "V" },
+  {   54, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_AVL_U_CHGE_WERT", "V" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SPEC_U_MAX_INTLE_WERT", "V" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_AVL_U_INTLE_WERT", "V" },
+  {   64, BMW_UDS_SINT  , 0              , 0.25f, 0.0f, "STAT_SPEC_U_MAX_CF_CHGE_WERT", "V" },
+  {   66, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_AVL_U_CF_CHGE_WERT", "V" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_U_CHGE_ALTC_WR_1_WERT", "V" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_U_1_CF_CHGE_ALTC_WERT", "V" },
+  {   70, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_U_2_CF_CHGE_ALTC_WERT", "V" },
+  {   71, BMW_UDS_SINT  , 0              , 1.0f, -48.0f, "STAT_AVL_TEMP_CHGE_WERT", "°C" },
+  {   73, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_AVL_TEMP_INTLE_WERT", "°C" },
+  {   75, BMW_UDS_SINT  , 0              , 1.0f, -48.0f, "STAT_AVL_TEMP_CF_CHGE_WERT", "°C" },
+  {   77, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_DER_WERT", "W" },
+  {   81, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_INTLE_DER_WERT", "W" },
+  {   85, BMW_UDS_UINT32, 0              , 10.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_CF_CHGE_DER_WERT", "W" },
+  {   89, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REAS_FAILSAFE_CHGNG_WERT", "" },
+  {   91, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REAS_FAILSAFE_INTLE_WERT", "" },
+  {   93, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REAS_CON_VRFD_CF_CHGE_WERT", "" },
+  {   95, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAS_DER_CHGNG_WERT", "" },
+  {   96, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAS_DER_INTLE_WERT", "" },
+  {   97, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAS_DER_CF_CHGNG_WERT", "" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ST_ERR_CHGNG_WERT", "" },
+  {   99, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ST_ERR_INTLE_WERT", "" },
+  {  100, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ST_ERR_CF_CHGE_WERT", "" },
+  {  101, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREQWR_CHGNG_WERT", "Hz" },
+  {  105, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREQWR_INTLE_WERT", "Hz" },
+  {  109, BMW_UDS_UINT32, 0              , 0.25f, 0.0f, "STAT_FREQWR_1_CF_CHGE_ALTC_WERT", "Hz" },
+  {  113, BMW_UDS_UINT32, 0              , 0.25f, 0.0f, "STAT_FREQWR_2_CF_CHGE_ALTC_WERT", "Hz" },
+  {  117, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AVL_EFFY_CHGNG_CYC_WERT", "%" },
+  {  121, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_EFFY_INTLE_CYC_WERT", "%" },
+  {  122, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_EFFY_CF_CHGNG_CYC_WERT", "%" },
+  {  123, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_CHGNG_TYP_WERT", "" },
+  {  124, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_CHGNG_TYP_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_DCDC_MESSGROESSEN_KOMPLETT[] = {   // 0xE5FF
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AVL_CUTIL_DCDC_CNV_WERT", "%" },
+  {    4, BMW_UDS_SINT32, 0              , 0.1f, 0.0f, "STAT_AVL_I_HV_DCDC_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AVL_I_LV_DCDC_WERT", "A" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AVL_OPMO_DCDC_CNV_WERT", "" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AVL_U_DCDC_CNV_HV_WERT", "V" },
+  {   17, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_AVL_U_LV_DCDC_CNV_WERT", "V" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SPEC_PWR_DCDC_CNV_MAX_WERT", "W" },
+  {   25, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ST_DCDC_CNV_DIAG_WERT", "" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ST_ERR_DCDC_CNV_WERT", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TAR_OPMO_DCDC_CNV_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_TAR_U_LV_DCDC_CNV_WERT", "V" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_U_DCDC_CNV_HV_MIN_WERT", "V" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_V_B_DCDC_HI_ENABLE_WERT", "" },
+  {   41, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_E_DCDC_BTS_STATUS_MC6_WERT", "" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_E_DCDC_CTRL_STATUS_MC6_PKR2_WERT", "" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_E_DCDC_HI_ST_OUT_WERT", "" },
+  {   49, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_E_DCDC_MC0_CTRL_WERT", "" },
+  {   53, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_H_SPI_DCDC_0_SPI_DATA_E_STATUS_WERT", "" },
+  {   55, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_H_SPI_DCDC_6_SPI_DATA_E_STATUS_WERT", "" },
+  {   57, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_I_DCDC_HV_MC6_WERT", "A" },
+  {   61, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_I_DCDC_TRA1_MC6_WERT", "A" },
+  {   65, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_I_DCDC_TRA_FIL_WERT", "A" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_S_DCDC_PWM_HTS1_WERT", "" },
+  {   71, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_S_DCDC_PWM_HTS2_WERT", "" },
+  {   73, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_V_S_DCDC_SW_VERSION_WERT", "" },
+  {   75, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_T_DCDC_BO_WERT", "°C" },
+  {   79, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_T_DCDC_GR_MC6_WERT", "°C" },
+  {   83, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_T_DCDC_GTW_MC6_WERT", "°C" },
+  {   87, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_U_DCDC_GT_MC6_PKR2_WERT", "V" },
+  {   91, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_U_DCDC_LV_WERT", "V" },
+  {   95, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_U_DCDC_LV_CAL_WERT", "V" },
+  {   99, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_V_U_DCDC_LV_SOLL_WERT", "V" },
+  {  103, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_I_DCDC_TS1_MC6_RUKO_WERT", "A" },
+  {  107, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_I_DCDC_TS2_MC6_RUKO_WERT", "A" },
+  {  111, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_V_T_DCDC_TS_MC6_RUKO_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EME_AE_FREILAUF_MODUS[] = {   // 0xF050
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_STATUS", "0-n" },
+  };
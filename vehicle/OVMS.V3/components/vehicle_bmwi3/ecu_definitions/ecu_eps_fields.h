@@ -0,0 +1,38 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eps_i1.json: EPS 30: Power steering
+// This generated code  makes it easier to process CANBUS messages from the EPS ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_EPS_EPS_INITIALISIERUNG_SERVICE[] = {   // 0xAB6C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTINE_STATUS", "0-n" },
+  {    1, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_LENKRADWINKEL_WERT", "°" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EPS_EPS_RITZELWINKELSENSOR[] = {   // 0xDB57
+  {    0, BMW_UDS_SINT32, 0              , 0.01f, 0.0f, "STAT_RITZELWINKEL_WERT", "°" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_RITZELWINKELGESCHWINDIGKEIT_WERT", "°/s" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR_0XDB57", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EPS_EPS_MOMENTENSENSOR[] = {   // 0xDB99
+  {    0, BMW_UDS_SINT  , 0              , 0.0078125f, 0.0f, "STAT_MOMENT_WERT", "Nm" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR_0XDB99", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EPS_EPS_ZAHNSTANGENMITTE[] = {   // 0xDC77
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAHNSTANGENMITTE_ZUSTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EPS_READHWMODIFICATIONINDEX[] = {   // 0xF152
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HW_MODIFICATION_INDEX_WERT", "HEX" },
+  {    1, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_22_F152_SUPPLIERINFO", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_EPS_FLASH_UPDATE_MULTITURNZAEHLER[] = {   // 0x1234
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SERVICE", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PIC", "0-n" },
+  };
@@ -0,0 +1,310 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/fzd_f15.json: FZD 56: Roof function centre
+// This generated code  makes it easier to process CANBUS messages from the FZD ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_HALLSENSOREN[] = {   // 0xD180
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_ESH_TASTER[] = {   // 0xD192
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SHD_ESH_NR", "0-n" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TASTER_RESERVE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_VORHANDEN[] = {   // 0xD193
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_ESH", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_ESH_TASTER_VORHANDEN[] = {   // 0xD194
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_TASTER_SHD_ESH", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_VORHANDEN[] = {   // 0xD195
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SHD", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_BEWEGUNG[] = {   // 0xD196
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_MIN_WERT", "Ink" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_MAX_WERT", "Ink" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_MM_WERT", "mm" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_MM_MIN_WERT", "mm" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_MM_MAX_WERT", "mm" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_POSITION_PROZENT_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_LAGE_NR", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_ZUSTAND_TUER_NR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_FREIGABE_AKTIV_NR", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SHD_RESERVE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_STATUS_DETAIL[] = {   // 0xD1A6
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_RESERVE_1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_MOTORTEMPERATUR_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_MT_LIEFERANT_NR", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SHD_MT_SW_VERSION", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_RESERVE_2", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_WACHHALTEN", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_FZG_GESCHWINDIGKEIT", "0-n" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SHD_RELATIVZEIT", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_EKS_AKTIV", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_FREIGABE_DEAKTIVIERT", "0/1" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SHD_PANIKMODUS_DEAKTIVIERT", "0/1" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SHD_RESERVE_0XD1A6", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_RELAIS[] = {   // 0xD1B9
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_BEWEGUNG[] = {   // 0xD1BA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_INIT_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_BEWEGUNG_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_NR", "0-n" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_WERT", "Ink" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_MIN_WERT", "Ink" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_MAX_WERT", "Ink" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_MM_WERT", "mm" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_MM_MIN_WERT", "mm" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_MM_MAX_WERT", "mm" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_POSITION_PROZENT_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_LAGE_NR", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_ZUSTAND_TUER_NR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_FREIGABE_AKTIV_NR", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_PANIKMODUS_AKTIV_NR", "0-n" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ESH_RESERVE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_HALLSENSOREN[] = {   // 0xD1BB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1BB", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1BB", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_RELAIS[] = {   // 0xD1BC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1BC", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1BC", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_STATUS_DETAIL[] = {   // 0xD1BD
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_RESERVE_1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_MOTORTEMPERATUR_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_ESH_AUSSENTEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_MT_LIEFERANT_NR", "0-n" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ESH_MT_SW_VERSION", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_EEPROM_PRUEFSUMME_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_RESERVE_2", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_WACHHALTEN", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_FZG_GESCHWINDIGKEIT", "0-n" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ESH_RELATIVZEIT", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_TEMPERATUR_UEBERWACHUNG", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_EKS_AKTIV", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_FREIGABE_DEAKTIVIERT", "0/1" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ESH_PANIKMODUS_DEAKTIVIERT", "0/1" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ESH_RESERVE_0XD1BD", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_STATISTIKZAEHLER_LESEN[] = {   // 0xD1BE
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHNORMIERUNG_AUTOMATISCH", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHNORMIERUNG_MANUELL", "0-n" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERFAHREN_EMERGENCY", "0-n" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PANIC", "0-n" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIER_NORMALMODUS", "0-n" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIERER_EMERGENCY", "0-n" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ABBRUCH_MOTORLAUF", "0-n" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_80_KMH", "0-n" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_80_KMH", "0-n" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_80_KMH", "0-n" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_120_KMH", "0-n" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_120_KMH", "0-n" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_120_KMH", "0-n" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_160_KMH", "0-n" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_160_KMH", "0-n" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_160_KMH", "0-n" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_300_KMH", "0-n" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_300_KMH", "0-n" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_300_KMH", "0-n" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETAETIGUNG_BEI_MINUS_10_GRAD", "0-n" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIER_BEI_0_GRAD", "0-n" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_1", "0-n" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_2", "0-n" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_3", "0-n" },
+  {   54, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_4", "0-n" },
+  {   58, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_5", "0-n" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE_6", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_STATISTIKZAEHLER_LESEN[] = {   // 0xD1C0
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NACHNORMIERUNG_MANUELL_0XD1C0", "0-n" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERFAHREN_EMERGENCY_0XD1C0", "0-n" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PANIC_0XD1C0", "0-n" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIER_NORMALMODUS_0XD1C0", "0-n" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIERER_EMERGENCY_0XD1C0", "0-n" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ABBRUCH_MOTORLAUF_0XD1C0", "0-n" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0", "0-n" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_80_KMH_0XD1C0", "0-n" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0", "0-n" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0", "0-n" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_120_KMH_0XD1C0", "0-n" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0", "0-n" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0", "0-n" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_160_KMH_0XD1C0", "0-n" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0", "0-n" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0", "0-n" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_HEBEN_300_KMH_0XD1C0", "0-n" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0", "0-n" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0", "0-n" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REVERSIER_BEI_0_GRAD_0XD1C0", "0-n" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_1_0XD1C0", "0-n" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_2_0XD1C0", "0-n" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_3_0XD1C0", "0-n" },
+  {   54, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_4_0XD1C0", "0-n" },
+  {   58, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_5_0XD1C0", "0-n" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESERVE_6_0XD1C0", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_SINE_LIN[] = {   // 0xDCA1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_LIN_SIRENE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_SINE[] = {   // 0xDCA2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LEITUNG_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UNTERSPANNUNG_EXT_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EEPROM_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKTIVER_SCHUTZ_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WAKE_UP_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIRENE_AKUSTIK_NR", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TILT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_SINE_BATT_LEVEL[] = {   // 0xDCA3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_SINE_NEIGUNG[] = {   // 0xDCA9
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NEIGUNG_X_ACHSE_WERT", "Grad" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_NEIGUNG_Y_ACHSE_WERT", "Grad" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_INTERN[] = {   // 0xDCAC
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DWA_INTERN_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_ALARM_AUSGELOEST[] = {   // 0xDCB0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_FAT_AUSGELOEST_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_BFT_AUSGELOEST_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_FATH_AUSGELOEST_EIN", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN", "0/1" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN", "0/1" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN", "0/1" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN", "0/1" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN", "0/1" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN", "0/1" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN", "0/1" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN", "0/1" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN", "0/1" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN", "0/1" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_SINE_SPANNUNG_EIN", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DWA_ALARM_PANIKALARM_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_VORHANDEN[] = {   // 0xDCB1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_DWA", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_USIS_EMPFINDLICHKEIT[] = {   // 0xDCB2
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_IRS_SENS_EMPFINDLICHKEIT_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_KLAPPENKONTAKTE[] = {   // 0xDCDD
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_FAHRERTUER_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_BEIFAHRERTUER_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_FAHRERTUER_HINTEN_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_MOTORHAUBE_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_HECKKLAPPE_NR", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KONTAKT_HECKSCHEIBE_NR", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZV_NR", "0-n" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RESERVE_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE[] = {   // 0x4107
+  {  256, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT", "s" },
+  {  258, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT", "V" },
+  {  259, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPIEL_WERT", "" },
+  {  260, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GUELTIGKEIT", "0/1" },
+  {  261, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEWERTUNG", "0/1" },
+  {  262, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1[] = {   // 0x4108
+  {  256, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT_0X4108", "s" },
+  {  258, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT_0X4108", "V" },
+  {  259, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPIEL_WERT_0X4108", "" },
+  {  260, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GUELTIGKEIT_0X4108", "0/1" },
+  {  261, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEWERTUNG_0X4108", "0/1" },
+  {  262, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT_0X4108", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1[] = {   // 0x4109
+  {  256, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT_0X4109", "s" },
+  {  258, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT_0X4109", "V" },
+  {  259, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPIEL_WERT_0X4109", "" },
+  {  260, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GUELTIGKEIT_0X4109", "0/1" },
+  {  261, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BEWERTUNG_0X4109", "0/1" },
+  {  262, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT_0X4109", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_FZD_DWA_ALARM_ANZAHL[] = {   // 0x6012
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_MOTORHAUBE_WERT", "count" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_FAT_WERT", "count" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_BFT_WERT", "count" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_FATH_WERT", "count" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_BFTH_WERT", "count" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_HECKKLAPPE_WERT", "count" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_HECKSCHEIBE_WERT", "count" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT", "count" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT", "count" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_MANIPULATION_AUTH_WERT", "count" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT", "count" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_A_WERT", "count" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_B_WERT", "count" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT", "count" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT", "count" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT", "count" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SINE_ALARM_SPANNUNG_WERT", "count" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SINE_ALARM_LIN_TELEGRAMM_WERT", "count" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FZD_ALARM_PANIKALARM_WERT", "count" },
+  };
@@ -0,0 +1,541 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ihx_i1.json: IHX 78: Integrated automatic heating/aircon
+// This generated code  makes it easier to process CANBUS messages from the IHX ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_IHX_EDH_VERRIEGELUNG[] = {   // 0xA11B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EDH_VERRIEGELUNG_AKTIV", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EDH_VERRIEGELUNG_ZAEHLER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_WP_BEFUELLUNG[] = {   // 0xA11C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WP_BEFUELLUNG", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_WP_EXP_VENTIL_KALIBRIEREN[] = {   // 0xA11D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KALIBRIERUNG", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SITZHEIZUNG_VORNE_TASTER_LINKS[] = {   // 0xD15D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_VORNE_LINKS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SITZHEIZUNG_VORNE_TASTER_RECHTS[] = {   // 0xD15E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_VORNE_RECHTS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SITZHEIZUNG_VORNE_LED_RECHTS[] = {   // 0xD15F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE1_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE2_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE3_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SITZHEIZUNG_VORNE_LED_LINKS[] = {   // 0xD160
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE1_EIN", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE2_EIN", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE3_EIN", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_FBM_TASTEN_VORHANDEN_WERT[] = {   // 0xD599
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FBM_TASTEN_VORHANDEN_WERT", "Tasten" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_FUSSRAUM_LINKS_WERT[] = {   // 0xD859
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_LINKS_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_FUSSRAUM_RECHTS_WERT[] = {   // 0xD85A
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_RECHTS_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_INNEN_UNBELUEFTET[] = {   // 0xD85C
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_INNEN_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_POTI_SCHICHTUNG_FOND_WERT[] = {   // 0xD860
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_POTI_SCHICHTUNG_FOND_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KONFIGURATION_KLIMA_VORN[] = {   // 0xD866
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_ZUSATZWASSERPUMPE", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_DISPLAY_EINHEIT_NR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VARIANTE_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_EMOTORWASSERPUMPE", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_KOMPRESSORKUPPLUNG", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_PTC_VORN", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_UMWAELZPUMPE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KAELTEMITTEL_MEDIUM[] = {   // 0xD868
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAELTEMITTEL_MEDIUM_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SCHRITTMOTOR_FEHLER[] = {   // 0xD88E
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHRITTMOTOR_BLOCKIERUNG_WERT", "Fehler" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHRITTMOTOR_ANTWORT_FEHLT_WERT", "Fehler" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHRITTMOTOR_INTERNER_FEHLER_WERT", "Fehler" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SCHRITTMOTOR_INITIALISIERUNG_FEHLER_WERT", "Fehler" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_FONDSCHICHTUNG[] = {   // 0xD8AA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FONDSCHICHTUNGSPOTI", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SOLARSENSOR_VORHANDEN[] = {   // 0xD8AB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SOLARSENSOR_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_AUC_SENSOR_VORHANDEN[] = {   // 0xD8AC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_AUC_SENSOR", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_EKK_DREHZAHLERHOEHUNG[] = {   // 0xD8C2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EKK_DREHZAHLERHOEHUNG_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_EKMV_ANALOGWERTE_GEN20[] = {   // 0xD8C4
+  {    0, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_DREHZAHL_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 0.04f, 0.0f, "STAT_LEISTUNG_WERT", "kW" },
+  {    2, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_STROM_DC_WERT", "A" },
+  {    3, BMW_UDS_UCHAR , 0              , 2.0f, 0.0f, "STAT_HOCHSPANNUNG_WERT", "V" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, -50.0f, "STAT_TEMPERATUR_WERT", "°C" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STROM_AC_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_EKMV_BETRIEBSZUSTAND_GEN20[] = {   // 0xD8C5
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0xD8C5_D", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_EDH_STATUS[] = {   // 0xD8CD
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, -40.0f, "STAT_TEMPERATUR_WASSERAUSTRITT_WERT", "°C" },
+  {    2, BMW_UDS_UINT  , 0              , 0.2f, 0.0f, "STAT_STROM_WERT", "A" },
+  {    4, BMW_UDS_UINT  , 0              , 2.0f, 0.0f, "STAT_HOCHVOLTSPANNUNG_WERT", "V" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_VERRIEGELUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KONFIGURATION_KLIMA_PRODUKTLINIE[] = {   // 0xD8CE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_PRODUKTLINIE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_HV_POWERMANAGEMENT[] = {   // 0xD8D2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREIGABE_KLIMAKOMPRESSOR", "0/1" },
+  {    1, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_LEISTUNG_KLIMAKOMPRESSOR_MAXIMAL_WERT", "kW" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_HV_PM_EDH[] = {   // 0xD8D3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREIGABE_EDH", "0/1" },
+  {    1, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_LEISTUNG_EDH_MAXIMAL_WERT", "kW" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_KUEHLMITTELTEMPERATUR[] = {   // 0xD8D4
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_KUEHLMITTEL_MOTOR_TEMP_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SOLLWERT_ELEKTRISCHER_ZUHEIZER_VORN[] = {   // 0xD902
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOLLWERT_ELEKTRISCHER_ZUHEIZER_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_OUT_ZUSATZWASSERPUMPE_EIN[] = {   // 0xD904
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_OUT_ZUSATZWASSERPUMPE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TIMER_EINLAUFSCHUTZ[] = {   // 0xD905
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TIMER_EINLAUFSCHUTZ_WERT", "s" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TIMER_START_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SITZHEIZUNG_VORNE_TASTER_VORHANDEN[] = {   // 0xD90E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SITZHEIZUNG_TASTER_VORNE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_KOMPRESSORKUPPLUNG[] = {   // 0xD916
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_KOMPRESSORKUPPLUNG_0XD916", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE[] = {   // 0xD91A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT[] = {   // 0xD91D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_KLAPPEN_PRG_MITTE[] = {   // 0xD928
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_KLAPPEN_PRG_MITTE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_GEBLAESESTUFE_ANZ[] = {   // 0xD92B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_GEBLAESESTUFE_ANZ_WERT", "Stufe" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_OFF_EIN[] = {   // 0xD92C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_OFF_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_DEFROST_EIN[] = {   // 0xD92D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_DEFROST_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_MAX_AC_EIN[] = {   // 0xD92E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_MAX_AC_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_AUC_EIN[] = {   // 0xD930
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_AUC_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_UMLUFT_EIN[] = {   // 0xD931
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_UMLUFT_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_HHS_EIN[] = {   // 0xD932
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_HHS_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_AC_EIN[] = {   // 0xD934
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_AC_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_KLIMASTIL_MITTE[] = {   // 0xD936
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_KLIMASTIL_MITTE_WERT", "Stufe" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_STANDLUEFTEN_EIN[] = {   // 0xD939
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_STANDLUEFTEN_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_GEBLAESELEISTUNG_WERT[] = {   // 0xD93F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_GEBLAESELEISTUNG_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_DEFROST_WERT[] = {   // 0xD941
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_DEFROST_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_DEFROST_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_BELUEFTUNG_WERT[] = {   // 0xD942
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_BELUEFTUNG_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_BELUEFTUNG_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_FUSSRAUM_WERT[] = {   // 0xD947
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_FUSSRAUM_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_FUSSRAUM_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_SCHICHTUNG_WERT[] = {   // 0xD949
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_SCHICHTUNG_LI_WERT[] = {   // 0xD94A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_LI_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_LI_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_SCHICHTUNG_RE_WERT[] = {   // 0xD94B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_RE_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_RE_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_UMLUFT_WERT[] = {   // 0xD94D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_UMLUFT_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_UMLUFT_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_TEMP_LUFT_FOND_WERT[] = {   // 0xD950
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_TEMP_LUFT_FOND_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_TEMP_LUFT_FOND_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_MOTOR_KALIBRIERLAUF[] = {   // 0xD953
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KALIBRIERLAUF_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KALIBRIERLAUF_ERGEBNIS", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_1_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_2_NR", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_3_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_4_NR", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_5_NR", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_6_NR", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_7_NR", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_8_NR", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_9_NR", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_10_NR", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_11_NR", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_12_NR", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_13_NR", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_14_NR", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_15_NR", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_16_NR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_17_NR", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_18_NR", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_19_NR", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOTOR_20_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SELBSTTEST_SCHRITTMOTORE[] = {   // 0xD954
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SELBSTTEST_SCHRITTMOTORE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_BELUEFTUNG_LINKS_WERT[] = {   // 0xD957
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_LINKS_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_BELUEFTUNG_RECHTS_WERT[] = {   // 0xD958
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_RECHTS_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_DRUCKSENSOR_VORHANDEN[] = {   // 0xD959
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DRUCKSENSOR_VORHANDEN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_WASSERVENTIL[] = {   // 0xD95A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_MONO", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_DUO", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_VERDAMPFER_WERT[] = {   // 0xD95C
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_VERDAMPFER_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_KOMPRESSORFREIGABE[] = {   // 0xD960
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_KOMPRESSORFREIGABE_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_SOLARSENSOR_WERT[] = {   // 0xD962
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_SOLARSENSOR_LINKS_WERT", "W/m²" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_BUS_IN_SOLARSENSOR_RECHTS_WERT", "W/m²" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_AUC_SENSOR_WERT[] = {   // 0xD964
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_AUC_SENSOR_WERT", "Stufe" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_BESCHLAGSENSOR_WERT[] = {   // 0xD966
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_BESCHLAGSENSOR_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_KAELTEMITTELDRUCK_WERT[] = {   // 0xD968
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_IN_R134A_DRUCK_WERT", "bar" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_IN_TEMP_AUSSEN_WERT[] = {   // 0xD96B
+  {    0, BMW_UDS_SINT  , 0              , 0.5f, -40.0f, "STAT_BUS_IN_TEMP_AUSSEN_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BESCHLAGSENSOR_VORHANDEN[] = {   // 0xD96D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_BESCHLAGSENSOR", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_TEMPERATUR_SOLLWERT[] = {   // 0xD977
+  {    0, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_KLIMA_VORNE_SOLLTEMP_LINKS_WERT", "°C" },
+  {    1, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_KLIMA_VORNE_SOLLTEMP_RECHTS_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_LIN_1_ADRESSEN[] = {   // 0xD97B
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE1_ADR_WERT", "" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE2_ADR_WERT", "" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE3_ADR_WERT", "" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE4_ADR_WERT", "" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE5_ADR_WERT", "" },
+  {   10, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE6_ADR_WERT", "" },
+  {   12, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE7_ADR_WERT", "" },
+  {   14, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE8_ADR_WERT", "" },
+  {   16, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE9_ADR_WERT", "" },
+  {   18, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE10_ADR_WERT", "" },
+  {   20, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE11_ADR_WERT", "" },
+  {   22, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE12_ADR_WERT", "" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE13_ADR_WERT", "" },
+  {   26, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE14_ADR_WERT", "" },
+  {   28, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE15_ADR_WERT", "" },
+  {   30, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SLAVE16_ADR_WERT", "" },
+  {   32, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_MOT_0X3F_WERT", "" },
+  {   34, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_FEHLERSTATUS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLAPPEN_VERSTELLBEREICH[] = {   // 0xD980
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE1_WERT", "Inkremente" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE2_WERT", "Inkremente" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE3_WERT", "Inkremente" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE4_WERT", "Inkremente" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE5_WERT", "Inkremente" },
+  {   10, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE6_WERT", "Inkremente" },
+  {   12, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE7_WERT", "Inkremente" },
+  {   14, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE8_WERT", "Inkremente" },
+  {   16, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE9_WERT", "Inkremente" },
+  {   18, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE10_WERT", "Inkremente" },
+  {   20, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE11_WERT", "Inkremente" },
+  {   22, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE12_WERT", "Inkremente" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE13_WERT", "Inkremente" },
+  {   26, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE14_WERT", "Inkremente" },
+  {   28, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE15_WERT", "Inkremente" },
+  {   30, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE16_WERT", "Inkremente" },
+  {   32, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE17_WERT", "Inkremente" },
+  {   34, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE18_WERT", "Inkremente" },
+  {   36, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE19_WERT", "Inkremente" },
+  {   38, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE20_WERT", "Inkremente" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_TEMPERATUR_MITTE_SOLLWERT[] = {   // 0xD988
+  {    0, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_KLIMA_SOLLTEMP_MITTE_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_MISCHLUFT_WERT[] = {   // 0xD98A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_ZENTRALANTRIEB_WERT[] = {   // 0xD98B
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_MOT_ISTPOS_ZENTRALANTRIEB_WERT", "°" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_MOT_SOLLPOS_ZENTRALANTRIEB_WERT", "°" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_MISCHLUFT_LINKS_WERT[] = {   // 0xD98C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_LINKS_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_LINKS_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLP_POS_MISCHLUFT_RECHTS_WERT[] = {   // 0xD98E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_RECHTS_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_RECHTS_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_MIKROSCHALTER_ZENTRALANTRIEB[] = {   // 0xD98F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIKROSCHALTER_ZENTRALANTRIEB_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_BELUEFTUNG_WERT[] = {   // 0xD990
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_TEMP_FUSSRAUM_WERT[] = {   // 0xD991
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_AUDIOBEDIENTEIL[] = {   // 0xD995
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_AUDIOBEDIENTEIL", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_POTI_SCHICHTUNG_MITTE_WERT[] = {   // 0xD998
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_POTI_SCHICHTUNG_MITTE_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT[] = {   // 0xD99C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOT_ISTPOS_BEL_FUSS_LINKS_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOT_ISTPOS_BEL_FUSS_RECHTS_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOT_SOLLPOS_BEL_FUSS_LINKS_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MOT_SOLLPOS_BEL_FUSS_RECHTS_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VARIANTE_AUDIOBEDIENTEIL[] = {   // 0xD9A0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VARIANTE_AUDIOBEDIENTEIL", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_BUS_OUT_KOMPRESSORKUPPLUNG_EIN[] = {   // 0xD9A1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BUS_OUT_KOMPRESSORKUPPLUNG_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_EKMV[] = {   // 0xD9A4
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_EKMV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_KLIMA_VORN_PRG_HFS[] = {   // 0xD9A8
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_HFS", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_WAERMEPUMPE_SENSOREN[] = {   // 0xD9AC
+  {    0, BMW_UDS_UINT  , 0              , 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_1_WERT", "°C" },
+  {    2, BMW_UDS_UINT  , 0              , 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_2_WERT", "°C" },
+  {    4, BMW_UDS_UINT  , 0              , 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_3_WERT", "°C" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_WP_PT_FUEHLER_1_DRUCK_WERT", "bar" },
+  {    8, BMW_UDS_UINT  , 0              , 0.2f, -20.0f, "STAT_WP_PT_FUEHLER_1_TEMP_WERT", "°C" },
+  {   10, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_WP_PT_FUEHLER_2_DRUCK_WERT", "bar" },
+  {   12, BMW_UDS_UINT  , 0              , 0.2f, -20.0f, "STAT_WP_PT_FUEHLER_2_TEMP_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_EDH[] = {   // 0xD9AE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_EDH", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_WAERMEPUMPE[] = {   // 0xD9AF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_WAERMEPUMPE", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_VORHANDEN_FSH[] = {   // 0xD9B1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FSH", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_SPANNUNG_KLEMME_30_WERT[] = {   // 0xDAD8
+  {    0, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_STATUS_KLEMME_R_EIN[] = {   // 0xDAFD
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_STATUS_KLEMME_R_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_STATUS_KLEMME_15_EIN[] = {   // 0xDAFE
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_STATUS_KLEMME_15_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_STATUS_KLEMME_30B_EIN[] = {   // 0xDB06
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_STATUS_KLEMME_30B_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_STATUS_KLEMME_50_EIN[] = {   // 0xDB10
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_STATUS_KLEMME_50_EIN", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_HV_EDH_STECKVERBINDUNG[] = {   // 0xDFC0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HV_STECKER_EDH", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_HV_EKMV_STECKVERBINDUNG[] = {   // 0xDFC1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HV_STECKER_EKMV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX_UWB_HKLUSV_DIAGINFO[] = {   // 0x4002
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR_ERROR", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_0_1_2_3", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_4_5_6_7", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_8_9_10_11", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_12_13_14", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_0_1_2_3", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_4_5_6_7", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_8_9_10_11", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_12_13_14", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX__ADC_EINGAENGE_WERT[] = {   // 0x4010
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_VERDAMPFER", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_ZWEITE_VERDAMPFER", "0-n" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_BELUEFTUNG_LINKS", "0-n" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_BELEUFTUNG_RECHTS", "0-n" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_FUSSRAUM_LINKS", "0-n" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_FUSSRAUM_RECHTS", "0-n" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_SCHICHTUNG_POTI", "0-n" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_KLEMME_30", "0-n" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_EXT_SUPPLY_DIAG", "0-n" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_LIN_DIAG_SPANNUNG", "0-n" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ADC_LIN_DIAG_STROM", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX__STAT_STANDHEIZUNG_WERT[] = {   // 0x4011
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STANDHEIZUNG_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX__STANDHEIZUNG_AUSGANG[] = {   // 0x4012
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STADHEIZING_AUSGANG", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AC_LIN_SPANNUNG_CMD_AUSGANG", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AC_LIN_SPANNUNG_DEN_AUSGANG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_IHX__VALEO_LESEN_SPEICHER[] = {   // 0x4020
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SPEICHER_BLOCK", "0-n" },
+  };
@@ -0,0 +1,205 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/kafas20.json: KAF 5D: Camera based driver assistance system
+// This generated code  makes it easier to process CANBUS messages from the KAF ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_KAF__FASTA_FLA_DATA[] = {   // 0x4001
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FLA_OP_TIME_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_NIGHT_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_ACT_HB_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_ACT_LB_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FLA_COUNT_OVERRIDE_WERT", "Counts" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_OPTIME_TOTAL_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__KAFAS_ECU_DATA[] = {   // 0x4002
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CNTRY_CODE_WERT", "Counts" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_OPTIME_TOTAL_WERT_0X4002", "s" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_OPTIME_NIGHT_WERT", "s" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_OPTIME_WIPER_WERT", "s" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DRIVEN_DIST_TOTAL_WERT", "km" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DRIVEN_DIST_URBAN_WERT", "km" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DRIVEN_DIST_RURAL_WERT", "km" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DRIVEN_DIST_MOWAY_WERT", "km" },
+  {   30, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_DRIVEN_DIST_NA_WERT", "km" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AMNT_EYEQ_RESET_WERT", "Counts" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AMNT_ONLINE_CALIB_WERT", "Counts" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__KAFAS_TLC_DATA[] = {   // 0x4003
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TLC_DRIV_LEFT_AVAIL_WERT", "km" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TLC_DRIV_RIGHT_AVAIL_WERT", "km" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TLC_DRIV_DIST_REL_SPD_WERT", "km" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TLC_AMNT_WARN_WERT", "Counts" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TLC_AMNT_DEACT_WERT", "Counts" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TLC_DRIV_DIST_ACT_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_KAFAS_FCW_DATA[] = {   // 0x4004
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_ACT_WERT", "km" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FS_WERT", "km" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FS_ACT_WERT", "km" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_OFF_WERT", "km" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_EARLY_WERT", "km" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_LATE_WERT", "km" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_AMNT_FOR_WERT", "Counts" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_WERT", "Counts" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_45_WERT", "Counts" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_90_WERT", "Counts" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_135_WERT", "Counts" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_PREFILLS_WERT", "Counts" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_PRECRASH_WERT", "Counts" },
+  {   38, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_DEACT_WERT", "Counts" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FCW_FS_CC_WERT", "Counts" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__KAFAS_SLI_DATA[] = {   // 0x4005
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SLI_AMT_CAM_DET_WERT", "Counts" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLI_MATCH_URBAN_WERT", "Counts" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLI_MATCH_RURAL_WERT", "Counts" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SLI_MATCH_MOWAY_WERT", "Counts" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_REP_URBAN_WERT", "m" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_REP_RURAL_WERT", "m" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_REP_MOWAY_WERT", "m" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SLI_OVER_SLI_WERT", "km" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_SSS_TIME_WERT", "Counts" },
+  {   19, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SLI_NPI_WERT", "km" },
+  {   23, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_NP_WITHDRAW_DIST_WERT", "Counts" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SLI_NP_WITHDRAW_SIGN_WERT", "Counts" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__STATUS_SAFETY_DIAG_INFO[] = {   // 0x400E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_0_FAULT_WERT", "HEX" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_1_FAULT_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_2_FAULT_WERT", "HEX" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_3_FAULT_WERT", "HEX" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_4_FAULT_WERT", "HEX" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_5_FAULT_WERT", "HEX" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BYTE_6_FAULT_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__STATUS_WARNZEITPUNKT_FCW[] = {   // 0x400F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WARN_FLAV_FCW", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_FASTA_PPP_DATA[] = {   // 0x4010
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_WARNING_ZONE", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_0_TO_20_WERT", "Counts" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_20_TO_40_WERT", "Counts" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_40_TO_60_WERT", "Counts" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_0_TO_20_WERT", "Counts" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_20_TO_40_WERT", "Counts" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_40_TO_60_WERT", "Counts" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_0_TO_20_WERT", "Counts" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_20_TO_40_WERT", "Counts" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_40_TO_60_WERT", "Counts" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PREWARNUNG_REQUESTS_WERT", "Counts" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_ACUTEWARNING_REQUESTS_WERT", "Counts" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_HBA_REQUESTS_WERT", "Counts" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_PREFILL_REQUESTS_WERT", "Counts" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_AMNT_BRAKE_REQUESTS_WERT", "Counts" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_DEACT_DRIVER_WERT", "Counts" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_DEACT_AVAILABILITY_WERT", "Counts" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_DEACT_WARNING_CHAIN_WERT", "Counts" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PPP_OPERATION_TIME_CL50_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PPP_OPERATION_TIME_ACTIVE_WERT", "s" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PPP_FS_CC_WERT", "Counts" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_PPP_DRIVEN_TIME_FS_ACT_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_FASTA_CCM_DATA[] = {   // 0x4011
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_20_WERT", "Counts" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_40_WERT", "Counts" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_GEQ40_WERT", "Counts" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__KAFAS_ENVINT_DATA[] = {   // 0x4012
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ENVINT_DRIVEN_DIST_FS_WERT", "km" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ENVINT_DRIVEN_TIME_FS_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_PPP_ANFORDERUNGEN[] = {   // 0x4016
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TYPE_OF_WARNING", "0-n" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TIMESTAMP_ACUTE_WERT", "s" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TIMESTAMP_BRAKE_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__GENERIC_EYEQ2_INFO[] = {   // 0x4017
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EYEQ2_RESTARTS_WERT", "Counts" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__STATUS_CAMERA_MONITORING_WERT[] = {   // 0x4050
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FRAME_INDEX_WERT", "Counts" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VIDEO_ERROR_COUNT_WERT", "Counts" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DROPPED_FRAME_COUNT_WERT", "Counts" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, -60.0f, "STAT_CAMERA_TEMP_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_ABSCHALTGRUND_FERNLICHT[] = {   // 0xD341
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_ENTGEGENKOMMENDES_FAHRZEUG", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_VORAUSFAHRENDES_FAHRZEUG", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_GESCHWINDIGKEITSLIMIT", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_UMGEBUNGSHELLIGKEIT", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_ORTSCHAFTSERKENNUNG", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_NEBELERKENNUNG", "0/1" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_AUTOBAHNMODE", "0/1" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLA_VERZOEGERUNGSZEIT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_KONFIGURATION_KAFAS[] = {   // 0xD374
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_TLC", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FLA", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_SLI", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_NPI", "0/1" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_FCW", "0/1" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VORHANDEN_PED", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_KAFAS_VINS_LESEN[] = {   // 0xD393
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAFAS_VIN_STATUS_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_KALIBRIERDATEN_KAFAS[] = {   // 0xD396
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OFFLINE_YAW_WERT", "Pixel" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OFFLINE_HORIZON_WERT", "Pixel" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_OFFLINE_ROLL_WERT", "Grad" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ONLINE_YAW_WERT", "Pixel" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ONLINE_HORIZON_WERT", "Pixel" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ONLINE_ROLL_WERT", "Grad" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KAM_HOEHE_WERT", "mm" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BRENNWEITE_WERT", "Pixel" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_GRABBING_SHIFT_WERT", "Pixel" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_KAMERAVERBINDUNG_ECU[] = {   // 0xD397
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAFAS_VERBINDUNG_KAM_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_ERGEBNIS_SLI[] = {   // 0xD3AA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAMERA_ZEICHEN_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAMERA_GESCHWINDIGKEIT_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KARTE_ZEICHEN_NR", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KARTE_GESCHWINDIGKEIT_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUSIONIERT_ZEICHEN_NR", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FUSIONIERT_GESCHWINDIGKEIT_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GUETE_KAM_SLI_GESCHW_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF_SPANNUNG_KLEMME_15N_WERT[] = {   // 0xDAD2
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_15N_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__DEBUG_AUSGABE[] = {   // 0xF001
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DEBUG_AUSGABE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__PEDANTIC_MODE[] = {   // 0xF003
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PEDANTIC_MODE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KAF__ERASE_MICRO_CORE_DUMP[] = {   // 0xF004
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ERASE_RESULT", "0-n" },
+  };
@@ -0,0 +1,170 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ucx2_i01.json: KLE 15: Convenience charging electronics
+// This generated code  makes it easier to process CANBUS messages from the KLE ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_KLE_FLASH_DSPS[] = {   // 0xAF43
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DSP_FLASHING", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_BETRIEBSZUSTAND_LADEGERAET[] = {   // 0xDE84
+  {    0, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT", "Hz" },
+  {    1, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_DERATING", "Bit" },
+  {    2, BMW_UDS_UINT  , 0              , 10.0f, 0.0f, "STAT_LEISTUNG_DERATING_WERT", "W" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DERATING_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_FEHLERZUSTAND_UCXII", "Bit" },
+  {    6, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_AUSLOESER_FAILSAFE_UCXII", "Bit" },
+  {    8, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG", "Bit" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BETRIEBSART_NR", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_2_WERT", "Hz" },
+  {   11, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_3_WERT", "Hz" },
+  {   12, BMW_UDS_UINT32, BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_MOD_ERR", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LEISTUNG[] = {   // 0xDE85
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_DC_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT", "W" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_SPANNUNG[] = {   // 0xDE86
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_WERT", "V" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KL30_WERT", "V" },
+  {    7, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KL30C_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_STROM[] = {   // 0xDE87
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_1_WERT", "A" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_MAX_GESPEICHERT_WERT", "A" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, -204.7f, "STAT_STROM_HV_DC_WERT", "A" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_HV_DC_MAX_LIMIT_WERT", "A" },
+  {    8, BMW_UDS_UINT  , 0              , 0.1f, -204.7f, "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT", "A" },
+  {   10, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_2_WERT", "A" },
+  {   12, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_3_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_AC_PHASENANZAHL[] = {   // 0xDF25
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AC_PHASENANZAHL_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LADEDAUER[] = {   // 0xDFB0
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_WERT", "min" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_WERT", "s" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEZYKLEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_TEMPERATUREN[] = {   // 0xDFB1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC1_TEMPERATUR_WERT", "°C" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC2_TEMPERATUR_WERT", "°C" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC3_TEMPERATUR_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC4_TEMPERATUR_WERT", "°C" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC5_TEMPERATUR_WERT", "°C" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC6_TEMPERATUR_WERT", "°C" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC7_TEMPERAUTR_WERT", "°C" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC8_TEMPERATUR_WERT", "°C" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC9_TEMPEARTUR_WERT", "°C" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, -75.0f, "STAT_NTC10_TEMPEARTUR_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LEISTUNG2[] = {   // 0xDFB4
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4", "W" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LADE_HISTOGRAMM[] = {   // 0xDFB6
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LADE_HISTOGRAMM2[] = {   // 0xDFB7
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_LADEDAUER2[] = {   // 0xDFB8
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8", "min" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8", "s" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEZYKLEN_WERT_0XDFB8", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_UMSCHALTMATRIX[] = {   // 0xDFB9
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SCHALTER1_SCHALTZYKLEN_ANZAHL_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SCHALTER2_SCHALTZYKLEN_ANZAHL_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SCHALTER3_SCHALTZYKLEN_ANZAHL_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SCHALTER4_SCHALTZYKLEN_ANZAHL_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER1", "0/1" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER2", "0/1" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER3", "0/1" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHALTER4", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_SPANNUNG2[] = {   // 0xDFBA
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA", "V" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_WERT_0XDFBA", "V" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KL30_WERT_0XDFBA", "V" },
+  {    7, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KL30C_WERT_0XDFBA", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEGERAET_STROM2[] = {   // 0xDFBB
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_1_WERT_0XDFBB", "A" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB", "A" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, -204.7f, "STAT_STROM_HV_DC_WERT_0XDFBB", "A" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB", "A" },
+  {    8, BMW_UDS_UINT  , 0              , 0.1f, -204.7f, "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB", "A" },
+  {   10, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_2_WERT_0XDFBB", "A" },
+  {   12, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_STROM_AC_PHASE_3_WERT_0XDFBB", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_BETRIEBSZUSTAND_LADEGERAET2[] = {   // 0xDFBC
+  {    0, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC", "Hz" },
+  {    1, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_DERATING_0XDFBC", "Bit" },
+  {    2, BMW_UDS_UINT  , 0              , 10.0f, 0.0f, "STAT_LEISTUNG_DERATING_WERT_0XDFBC", "W" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DERATING_WERT_0XDFBC", "%" },
+  {    5, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC", "Bit" },
+  {    6, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC", "Bit" },
+  {    7, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC", "Bit" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BETRIEBSART_NR_0XDFBC", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC", "Hz" },
+  {   10, BMW_UDS_UCHAR , 0              , 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC", "Hz" },
+  {   11, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_MOD_ERR_0XDFBC", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_LADEDAUER_LADEART[] = {   // 0xDFBD
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_1PH_WERT", "min" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT", "s" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEZYKLUS_1PH_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_3PH_WERT", "min" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT", "s" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEZYKLUS_3PH_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KLE_FLASH_DSPS_0XF000[] = {   // 0xF000
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DSP_FLASHING_0XF000", "0-n" },
+  };
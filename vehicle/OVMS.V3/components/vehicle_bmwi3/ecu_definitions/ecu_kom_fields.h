@@ -0,0 +1,1208 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/komb25.json: KOM 60: Instrument panel
+// This generated code  makes it easier to process CANBUS messages from the KOM ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_KOM_STATUS_SYSTIME[] = {   // 0x1725
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDEN_SEIT_INIT_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_DREHZAHL_WERT[] = {   // 0xD106
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DREHZAHL_WERT", "1/min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_TACHO_WERT[] = {   // 0xD107
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_GESCHWINDIGKEIT_WERT", "km/h" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_GWSZ_ABSOLUT_WERT[] = {   // 0xD10D
+  {    0, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_ABSOLUT_GWSZ_RAM_WERT", "km" },
+  {    4, BMW_UDS_SINT32, 0              , 1.0f, 0.0f, "STAT_ABSOLUT_GWSZ_EEP_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_LSS_TASTE[] = {   // 0xD10E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_LSS_TASTE_GEDRUECKT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_REICHWEITE_BEV_PHEV[] = {   // 0xD111
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ELECTRIC_RANGE_CURRENT_WERT", "km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ELECTRIC_RANGE_MAXIMUM_WERT", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_FUEL_RANGE_CURRENT_WERT", "km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_FUEL_RANGE_MAXIMUM_WERT", "km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_RANGE_CONSUMPTION_ELECTRIC_WERT", "kWh/100km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_NEBENVERBRAUCHERLEISTUNG_WERT", "kW" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_A_TEMP_WERT[] = {   // 0xD112
+  {    0, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_A_TEMP_ANZEIGE_WERT", "°C" },
+  {    1, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_A_TEMP_ROHWERT_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_UHRZEIT_DATUM[] = {   // 0xD113
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_STUNDE_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_MINUTE_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_SEKUNDE_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_TAG_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_MONAT_WERT", "" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KOMBI_JAHR_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMBI_ZEIT_FORMAT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_GWSZ_RESET[] = {   // 0xD114
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GWSZ_OFFSET_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_STARTWERT_ZEITEN[] = {   // 0xD118
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_KODIERTE_STARTZEITEN_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_1_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_2_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_3_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_4_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_5_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_6_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_7_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_1_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_2_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_3_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_4_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_5_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_6_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_7_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_TANKINHALT[] = {   // 0xD11F
+  {    0, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_TANKKAMMER_RECHTS_WERT", "l" },
+  {    2, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_TANKKAMMER_LINKS_WERT", "l" },
+  {    4, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_SUMMENWERT_WERT", "l" },
+  {    6, BMW_UDS_UINT  , 0              , 0.0078125f, 0.0f, "STAT_GEDAEMPFT_ANZ_WERT", "l" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TANKPHASE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_TIMER_KLIMATISIERUNG[] = {   // 0xD121
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T1_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T1_ID_BEDIENUNG_TIMER_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T1_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T2_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T2_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T2_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T3_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T3_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T3_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T4_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T4_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T4_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T5_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T5_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T5_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T6_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T6_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T6_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  {   48, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_T7_ID_FUNKTION_BEDIENUNG_TIMER_WERT", "" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T7_ID_BEDIENUNG_TIMER_WERT", "" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT", "h" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT", "min" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_T7_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_ZEITSTEMPEL_HU_ABFRAGEN[] = {   // 0xD12C
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SEKUNDENZAEHLER_WERT", "s" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TAG_WERT", "d" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MONAT_WERT", "mth" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_JAHR_WERT", "y" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_SEGMENTDATEN_SPEICHER[] = {   // 0xD12F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_SEGMENT_ID_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_TAG_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_MONAT_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_01_JAHR_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_STUNDE_WERT", "h" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_MINUTE_WERT", "min" },
+  {    9, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_01_A_TEMP_WERT", "°C" },
+  {   10, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_01_AKT_DAUER_ECO_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_01_SOC_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_01_REKUPERATION_WERT", "kWh" },
+  {   17, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {   20, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_01_STERNE", "Bit" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_SEGMENT_ID_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_TAG_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_MONAT_WERT", "" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_02_JAHR_WERT", "" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_STUNDE_WERT", "h" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_MINUTE_WERT", "min" },
+  {   30, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_02_A_TEMP_WERT", "°C" },
+  {   31, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_02_AKT_DAUER_ECO_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {   33, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_02_SOC_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_02_REKUPERATION_WERT", "kWh" },
+  {   38, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_02_STERNE", "Bit" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_SEGMENT_ID_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_TAG_WERT", "" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_MONAT_WERT", "" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_03_JAHR_WERT", "" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_STUNDE_WERT", "h" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_MINUTE_WERT", "min" },
+  {   51, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_03_A_TEMP_WERT", "°C" },
+  {   52, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_03_AKT_DAUER_ECO_WERT", "%" },
+  {   53, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {   54, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_03_SOC_WERT", "%" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_03_REKUPERATION_WERT", "kWh" },
+  {   59, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_03_STERNE", "Bit" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_SEGMENT_ID_WERT", "" },
+  {   64, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_TAG_WERT", "" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_MONAT_WERT", "" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_04_JAHR_WERT", "" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_STUNDE_WERT", "h" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_MINUTE_WERT", "min" },
+  {   72, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_04_A_TEMP_WERT", "°C" },
+  {   73, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_04_AKT_DAUER_ECO_WERT", "%" },
+  {   74, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {   75, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_04_SOC_WERT", "%" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_04_REKUPERATION_WERT", "kWh" },
+  {   80, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {   83, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_04_STERNE", "Bit" },
+  {   84, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_SEGMENT_ID_WERT", "" },
+  {   85, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_TAG_WERT", "" },
+  {   86, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_MONAT_WERT", "" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_05_JAHR_WERT", "" },
+  {   88, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_STUNDE_WERT", "h" },
+  {   89, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_MINUTE_WERT", "min" },
+  {   93, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_05_A_TEMP_WERT", "°C" },
+  {   94, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_05_AKT_DAUER_ECO_WERT", "%" },
+  {   95, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {   96, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_05_SOC_WERT", "%" },
+  {  100, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_05_REKUPERATION_WERT", "kWh" },
+  {  101, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  104, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_05_STERNE", "Bit" },
+  {  105, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_SEGMENT_ID_WERT", "" },
+  {  106, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_TAG_WERT", "" },
+  {  107, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_MONAT_WERT", "" },
+  {  108, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_06_JAHR_WERT", "" },
+  {  109, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_STUNDE_WERT", "h" },
+  {  110, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_MINUTE_WERT", "min" },
+  {  114, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_06_A_TEMP_WERT", "°C" },
+  {  115, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_06_AKT_DAUER_ECO_WERT", "%" },
+  {  116, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {  117, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_06_SOC_WERT", "%" },
+  {  121, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_06_REKUPERATION_WERT", "kWh" },
+  {  122, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  125, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_06_STERNE", "Bit" },
+  {  126, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_SEGMENT_ID_WERT", "" },
+  {  127, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_TAG_WERT", "" },
+  {  128, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_MONAT_WERT", "" },
+  {  129, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_07_JAHR_WERT", "" },
+  {  130, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_STUNDE_WERT", "h" },
+  {  131, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_MINUTE_WERT", "min" },
+  {  135, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_07_A_TEMP_WERT", "°C" },
+  {  136, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_07_AKT_DAUER_ECO_WERT", "%" },
+  {  137, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {  138, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_07_SOC_WERT", "%" },
+  {  142, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_07_REKUPERATION_WERT", "kWh" },
+  {  143, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  146, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_07_STERNE", "Bit" },
+  {  147, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_SEGMENT_ID_WERT", "" },
+  {  148, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_TAG_WERT", "" },
+  {  149, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_MONAT_WERT", "" },
+  {  150, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_08_JAHR_WERT", "" },
+  {  151, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_STUNDE_WERT", "h" },
+  {  152, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_MINUTE_WERT", "min" },
+  {  156, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_08_A_TEMP_WERT", "°C" },
+  {  157, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_08_AKT_DAUER_ECO_WERT", "%" },
+  {  158, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {  159, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_08_SOC_WERT", "%" },
+  {  163, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_08_REKUPERATION_WERT", "kWh" },
+  {  164, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  167, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_08_STERNE", "Bit" },
+  {  168, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_SEGMENT_ID_WERT", "" },
+  {  169, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_TAG_WERT", "" },
+  {  170, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_MONAT_WERT", "" },
+  {  171, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_09_JAHR_WERT", "" },
+  {  172, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_STUNDE_WERT", "h" },
+  {  173, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_MINUTE_WERT", "min" },
+  {  177, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_09_A_TEMP_WERT", "°C" },
+  {  178, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_09_AKT_DAUER_ECO_WERT", "%" },
+  {  179, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {  180, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_09_SOC_WERT", "%" },
+  {  184, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_09_REKUPERATION_WERT", "kWh" },
+  {  185, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  188, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_09_STERNE", "Bit" },
+  {  189, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_SEGMENT_ID_WERT", "" },
+  {  190, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_TAG_WERT", "" },
+  {  191, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_MONAT_WERT", "" },
+  {  192, BMW_UDS_UCHAR , 0              , 1.0f, 2000.0f, "STAT_BLOCK_10_JAHR_WERT", "" },
+  {  193, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_STUNDE_WERT", "h" },
+  {  194, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_MINUTE_WERT", "min" },
+  {  198, BMW_UDS_UCHAR , 0              , 0.5f, -40.0f, "STAT_BLOCK_10_A_TEMP_WERT", "°C" },
+  {  199, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_10_AKT_DAUER_ECO_WERT", "%" },
+  {  200, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT", "%" },
+  {  201, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_10_SOC_WERT", "%" },
+  {  205, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLOCK_10_REKUPERATION_WERT", "kWh" },
+  {  206, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT", "%" },
+  {  209, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_BLOCK_10_STERNE", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF[] = {   // 0xD1D0
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRW_WERT", "km" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CRW_WERT", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BCRW_WERT", "km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_GRW_WERT", "km" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_GK_WERT", "µl" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSERHOEHUNG_ALPHA[] = {   // 0xD1D1
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AKKUM_ABS_VERBR_ERH_WERT", "µl" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VERBR_ERH_VERZOEGERUNG_WERT", "µl" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VERBR_ERH_MSA_WERT", "µl" },
+  {   12, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_V_REF_WERT", "km/h" },
+  {   14, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_V_IST_WERT", "km/h" },
+  {   16, BMW_UDS_UINT  , 0              , 0.025f, 0.0f, "STAT_FWP_AKT_WERT", "%" },
+  {   18, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSERHOEHUNG_PI[] = {   // 0xD1D2
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_PROZ_VERBR_ERH_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GW_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GESCHW_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_BESCHL_WERT", "%" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_KOMF_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_MEHRVERBRAUCH_MV_REF[] = {   // 0xD1D3
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_AKT_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_WERT", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_30_WERT", "l/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_70_WERT", "l/100km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_100_WERT", "l/100km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_MAX_WERT", "l/100km" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_GESAMT_WERT", "l/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_ECO_MODE_AUSTRITT[] = {   // 0xD1D4
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "STAT_ECO_MODE_AUSTRITT", "Bit" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ECO_TIPP_ANZ", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_X[] = {   // 0xD1D5
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_X_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_X_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_X_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_X_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_X_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_X_WERT", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_X_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_X_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_X_WERT", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_X_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_X_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_X_WERT", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_X_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_X_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_X_WERT", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_X_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_X_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_X_WERT", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_X_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_X_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_X_WERT", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_X_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_X_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_X_WERT", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_X_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_X_WERT", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_X_WERT", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_X_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_X_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_X_WERT", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_X_WERT", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_X_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_X_WERT", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_X_WERT", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_X_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_X_WERT", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_X_WERT", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_X_WERT", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_X_WERT", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_X_WERT", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_X_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_X_WERT", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_X_WERT", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_X_WERT", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_X_WERT", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_X_WERT", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_X_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_X_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_Y[] = {   // 0xD1D6
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Y_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Y_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Y_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Y_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Y_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Y_WERT", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Y_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Y_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Y_WERT", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Y_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Y_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Y_WERT", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Y_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Y_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Y_WERT", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Y_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Y_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Y_WERT", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Y_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Y_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Y_WERT", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Y_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Y_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Y_WERT", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Y_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Y_WERT", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Y_WERT", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Y_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Y_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Y_WERT", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Y_WERT", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Y_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Y_WERT", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Y_WERT", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Y_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Y_WERT", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Y_WERT", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Y_WERT", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Y_WERT", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Y_WERT", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Y_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Y_WERT", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Y_WERT", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Y_WERT", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Y_WERT", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Y_WERT", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Y_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Y_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_Z[] = {   // 0xD1D7
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Z_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Z_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Z_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Z_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Z_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Z_WERT", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Z_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Z_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Z_WERT", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Z_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Z_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Z_WERT", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Z_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Z_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Z_WERT", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Z_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Z_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Z_WERT", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Z_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Z_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Z_WERT", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Z_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Z_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Z_WERT", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Z_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Z_WERT", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Z_WERT", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Z_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Z_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Z_WERT", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Z_WERT", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Z_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Z_WERT", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Z_WERT", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Z_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Z_WERT", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Z_WERT", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Z_WERT", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Z_WERT", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Z_WERT", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Z_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Z_WERT", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Z_WERT", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Z_WERT", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Z_WERT", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Z_WERT", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Z_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Z_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_A[] = {   // 0xD1D8
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_A_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_A_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_A_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_A_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_A_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_A_WERT", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_A_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_A_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_A_WERT", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_A_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_A_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_A_WERT", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_A_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_A_WERT", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_A_WERT", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_A_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_A_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_A_WERT", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_A_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_A_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_A_WERT", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_A_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_A_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_A_WERT", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_A_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_A_WERT", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_A_WERT", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_A_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_A_WERT", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_A_WERT", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_A_WERT", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_A_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_A_WERT", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_A_WERT", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_A_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_A_WERT", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_A_WERT", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_A_WERT", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_A_WERT", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_A_WERT", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_A_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_A_WERT", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_A_WERT", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_A_WERT", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_A_WERT", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_A_WERT", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_A_WERT", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_A_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT[] = {   // 0xD1D9
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT", "l/100km" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_HUD_AKTIVE_WARPLISTE[] = {   // 0xDA00
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WARPLISTE_AKTIV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_STATUS_HUD_BILDPOSITION_SCHRITTE[] = {   // 0xDA0A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_BILDPOSITION_SCHRITTE_WERT", "Schritte" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_STATUS_HUD_BILDROTATION_SCHRITTE[] = {   // 0xDA0F
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_BILDROTATION_SCHRITTE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_PORTS_LESEN[] = {   // 0xDA43
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_AD_TEMP_BL_WERT", "°C" },
+  {    1, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_HUD_AD_KL30_WERT", "V" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_CUR_WERT", "A" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_SPG_WERT", "V" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_FET1_WERT", "V" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_FET2_WERT", "V" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_OV_WERT", "V" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_DRV_FAULT_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HUD_LED_PWM_WERT", "%" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HUD_LED_PWM_INV_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_SMC_FLAGS_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE1_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE2_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE3_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE4_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_SW_VERSION_LESEN[] = {   // 0xDA44
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_VERSION_MAIN_WERT", "HEX" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_VERSION_MINOR_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_VERSION_PATCH_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT[] = {   // 0xDA46
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_VERBAUORT_NR_WERT", "" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SENSOR_BMW_TEILE_NR_WERT", "HEX" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_HERSTELLER_NR_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SENSOR_SERIEN_NR_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_YEAR_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_MONTH_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_DAY_WERT", "" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_HW_VERSION_NR_WERT", "" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_OPTIK_VERSION_NR_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_MECHANIK_VERSION_NR_WERT", "" },
+  {   21, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SENSOR_FLASH_VERSION_NR_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_HUD_BILDPOSITION_STUFEN[] = {   // 0xDA47
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_BILDROTATION_STUFEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200[] = {   // 0x4200
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRW_WERT_0X4200", "km" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CRW_WERT_0X4200", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BCRW_WERT_0X4200", "km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_GRW_WERT_0X4200", "km" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_GK_WERT_0X4200", "µl" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201[] = {   // 0x4201
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201", "µl" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201", "µl" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VERBR_ERH_MSA_WERT_0X4201", "µl" },
+  {   12, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_V_REF_WERT_0X4201", "km/h" },
+  {   14, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_V_IST_WERT_0X4201", "km/h" },
+  {   16, BMW_UDS_UINT  , 0              , 0.025f, 0.0f, "STAT_FWP_AKT_WERT_0X4201", "%" },
+  {   18, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG_0X4201", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202[] = {   // 0x4202
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_PROZ_VERBR_ERH_WERT_0X4202", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GW_WERT_0X4202", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202", "%" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PI_VERBR_ERH_KOMF_WERT_0X4202", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_MEHRVERBRAUCH_MV_REF_0X4203[] = {   // 0x4203
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_AKT_WERT_0X4203", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_WERT_0X4203", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_30_WERT_0X4203", "l/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_70_WERT_0X4203", "l/100km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_100_WERT_0X4203", "l/100km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_MAX_WERT_0X4203", "l/100km" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MV_REF_GESAMT_WERT_0X4203", "l/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_ECO_MODE_AUSTRITT_0X4204[] = {   // 0x4204
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "STAT_ECO_MODE_AUSTRITT_0X4204", "Bit" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ECO_TIPP_ANZ_0X4204", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205[] = {   // 0x4205
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_X_WERT_0X4205", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_X_WERT_0X4205", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_X_WERT_0X4205", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_X_WERT_0X4205", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_X_WERT_0X4205", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_X_WERT_0X4205", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_X_WERT_0X4205", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_X_WERT_0X4205", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_X_WERT_0X4205", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_X_WERT_0X4205", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_X_WERT_0X4205", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_X_WERT_0X4205", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_X_WERT_0X4205", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_X_WERT_0X4205", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_X_WERT_0X4205", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_X_WERT_0X4205", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206[] = {   // 0x4206
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Y_WERT_0X4206", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Y_WERT_0X4206", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Y_WERT_0X4206", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Y_WERT_0X4206", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Y_WERT_0X4206", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Y_WERT_0X4206", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Y_WERT_0X4206", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Y_WERT_0X4206", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Y_WERT_0X4206", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Y_WERT_0X4206", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Y_WERT_0X4206", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Y_WERT_0X4206", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Y_WERT_0X4206", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Y_WERT_0X4206", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Y_WERT_0X4206", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Y_WERT_0X4206", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207[] = {   // 0x4207
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Z_WERT_0X4207", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Z_WERT_0X4207", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Z_WERT_0X4207", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Z_WERT_0X4207", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Z_WERT_0X4207", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Z_WERT_0X4207", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Z_WERT_0X4207", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Z_WERT_0X4207", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Z_WERT_0X4207", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Z_WERT_0X4207", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Z_WERT_0X4207", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Z_WERT_0X4207", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Z_WERT_0X4207", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Z_WERT_0X4207", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Z_WERT_0X4207", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Z_WERT_0X4207", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208[] = {   // 0x4208
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208", "l/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_A_WERT_0X4208", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_A_WERT_0X4208", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_A_WERT_0X4208", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_A_WERT_0X4208", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208", "HEX" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_A_WERT_0X4208", "" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208", "HEX" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_A_WERT_0X4208", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_A_WERT_0X4208", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208", "HEX" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_A_WERT_0X4208", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208", "HEX" },
+  {   44, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_A_WERT_0X4208", "" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208", "HEX" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208", "%" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_A_WERT_0X4208", "" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208", "HEX" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208", "%" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_A_WERT_0X4208", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208", "HEX" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208", "%" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_A_WERT_0X4208", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208", "%" },
+  {   66, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208", "%" },
+  {   67, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_A_WERT_0X4208", "" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208", "HEX" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208", "%" },
+  {   71, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208", "%" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_A_WERT_0X4208", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208", "HEX" },
+  {   74, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208", "%" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208", "%" },
+  {   77, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_A_WERT_0X4208", "" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208", "HEX" },
+  {   79, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208", "%" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208", "%" },
+  {   82, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_A_WERT_0X4208", "" },
+  {   83, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209[] = {   // 0x4209
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209", "l/100km" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERVRAEUCHE_SKALIERUNG_MCV[] = {   // 0x420A
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_8_WERT", "kWh/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_16_WERT", "kWh/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_X_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG1_X_WERT", "HEX" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT", "%" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT", "%" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_X_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG2_X_WERT", "HEX" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT", "%" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT", "%" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_X_WERT", "" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG3_X_WERT", "HEX" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT", "%" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_X_WERT", "" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG4_X_WERT", "HEX" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT", "%" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_X_WERT", "" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG5_X_WERT", "HEX" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT", "%" },
+  {   36, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT", "%" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_X_WERT", "" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG6_X_WERT", "HEX" },
+  {   40, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT", "%" },
+  {   42, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT", "%" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_X_WERT", "" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG7_X_WERT", "HEX" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT", "%" },
+  {   48, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT", "%" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_X_WERT", "" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG8_X_WERT", "HEX" },
+  {   52, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT", "%" },
+  {   54, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT", "%" },
+  {   56, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_X_WERT", "" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG9_X_WERT", "HEX" },
+  {   58, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT", "%" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT", "%" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_X_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG10_X_WERT", "HEX" },
+  {   64, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT", "%" },
+  {   66, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT", "%" },
+  {   68, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_X_WERT", "" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG11_X_WERT", "HEX" },
+  {   70, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT", "%" },
+  {   72, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT", "%" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_X_WERT", "" },
+  {   75, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG12_X_WERT", "HEX" },
+  {   76, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT", "%" },
+  {   78, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT", "%" },
+  {   80, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_X_WERT", "" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG13_X_WERT", "HEX" },
+  {   82, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT", "%" },
+  {   84, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT", "%" },
+  {   86, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_X_WERT", "" },
+  {   87, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG14_X_WERT", "HEX" },
+  {   88, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT", "%" },
+  {   90, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT", "%" },
+  {   92, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_X_WERT", "" },
+  {   93, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG15_X_WERT", "HEX" },
+  {   94, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT", "%" },
+  {   96, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT", "%" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_X_WERT", "" },
+  {   99, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FU_SEG16_X_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV[] = {   // 0x420B
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT", "kWh/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT", "kWh/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_REICHWEITE_MCV[] = {   // 0x420C
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ECO_MODE_REICHWEITE_WERT", "km" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_COMFORT_MODE_REICHWEITE_WERT", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BC_REICHWEITE_WERT", "km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ECO_PRO_PLUS_REICHWEITE_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_ERHOEHUNG_A[] = {   // 0x420D
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT", "kWh" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VERBR_ERHOEHUNG_VERZ_WERT", "kWh" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBR_REF_WERT", "kWh" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBR_IST_WERT", "kWh" },
+  {   12, BMW_UDS_UINT  , 0              , 0.0004f, 0.0f, "STAT_FWP_AKT_WERT_0X420D", "%" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG_0X420D", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_ERHOEHUNG_TT[] = {   // 0x420E
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT", "kWh/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT", "kWh/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT", "kWh/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_MEHRVERBRAUCH[] = {   // 0x420F
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_AKT_WERT", "kWh/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_REF_WERT", "kWh/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_ECO_WERT", "kWh/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_ECO_PLUS_WERT", "kWh/100km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_200M_WERT", "kWh/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_ECO_MODE_AUSTRITT_0X4210[] = {   // 0x4210
+  {    0, BMW_UDS_UCHAR , BMW_UDS_BITFIELD, 1.0f, 0.0f, "RES_0x4210_D", "bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_CHARAKTERISTIK_ECO[] = {   // 0x4230
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE1_WERT", "l/km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE2_WERT", "l/km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE3_WERT", "l/km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE4_WERT", "l/km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE5_WERT", "l/km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE6_WERT", "l/km" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE7_WERT", "l/km" },
+  {   14, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE8_WERT", "l/km" },
+  {   16, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE9_WERT", "l/km" },
+  {   18, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE10_WERT", "l/km" },
+  {   20, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE11_WERT", "l/km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL[] = {   // 0x4231
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE1_WERT_0X4231", "l/km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE2_WERT_0X4231", "l/km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE3_WERT_0X4231", "l/km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE4_WERT_0X4231", "l/km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE5_WERT_0X4231", "l/km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE6_WERT_0X4231", "l/km" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE7_WERT_0X4231", "l/km" },
+  {   14, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE8_WERT_0X4231", "l/km" },
+  {   16, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE9_WERT_0X4231", "l/km" },
+  {   18, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE10_WERT_0X4231", "l/km" },
+  {   20, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_STUETZSTELLE11_WERT_0X4231", "l/km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR[] = {   // 0x4232
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR1_ECO_WERT", "L/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR2_ECO_WERT", "L/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR3_ECO_WERT", "L/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR4_ECO_WERT", "L/100km" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR1_NORMAL_WERT", "L/100km" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR2_NORMAL_WERT", "L/100km" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR3_NORMAL_WERT", "L/100km" },
+  {   14, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LERNFAKTOR4_NORMAL_WERT", "L/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR[] = {   // 0x4233
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_DELTA_RATIO_ECO_WERT", "L/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_VB_INTERPOLIERT_ECO_WERT", "L/100km" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_DELTA_RATIO_NORMAL_WERT", "L/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_VB_INTERPOLIERT_NORMAL_WERT", "L/100km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_LOGBUCH[] = {   // 0x4800
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_OPERATION_HOURS_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_OPERATION_MINUTES_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_LED_OPERATION_HOURS_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_OPERATION_MINUTES_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_LED_REPEAT_TIME_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_01_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_02_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_03_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_04_WERT", "" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP1_WERT", "" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP2_WERT", "" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP3_WERT", "" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP4_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_TEMP5_WERT", "" },
+  {   21, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_LOGTIME_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_01_WERT", "" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_02_WERT", "" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_03_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_04_WERT", "" },
+  {   27, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM1_WERT", "" },
+  {   29, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM2_WERT", "" },
+  {   31, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM3_WERT", "" },
+  {   33, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM4_WERT", "" },
+  {   35, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM5_WERT", "" },
+  {   37, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM1_WERT", "" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM2_WERT", "" },
+  {   41, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM3_WERT", "" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM4_WERT", "" },
+  {   45, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM5_WERT", "" },
+  {   47, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM1_WERT", "" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM2_WERT", "" },
+  {   51, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM3_WERT", "" },
+  {   53, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM4_WERT", "" },
+  {   55, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM5_WERT", "" },
+  {   57, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM1_WERT", "" },
+  {   59, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM2_WERT", "" },
+  {   61, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM3_WERT", "" },
+  {   63, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM4_WERT", "" },
+  {   65, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM5_WERT", "" },
+  {   67, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_HEIGHT_ADJUSTMENT_WERT", "" },
+  {   69, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ROTATION_WERT", "" },
+  {   71, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_ACTIVATION_WERT", "" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_ENVIRONMENTAL_COND_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_PIA[] = {   // 0x4801
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER0_BRIGHT_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER0_HEIGHT_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER0_ROTATION_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_USER0_FUNKTION_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER1_BRIGHT_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER1_HEIGHT_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER1_ROTATION_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_USER1_FUNKTION_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER2_BRIGHT_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER2_HEIGHT_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_USER2_ROTATION_WERT", "" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_USER2_FUNKTION_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_GUEST_BRIGHT_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_GUEST_HEIGHT_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HUD_GUEST_ROTATION_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HUD_GUEST_FUNKTION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_HUD_PROCESS_VERSION_READ[] = {   // 0x4805
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AL_NUMMER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_BC_BCW_L_KM[] = {   // 0xD126
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_BC_DSV_L_KM_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_BC_DSG_L_KM_WERT", "km/h" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_BC_MVERB_L_KM_WERT", "l/100km" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BC_RW_L_KM_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_BC_RBC_L_KM[] = {   // 0xD127
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RBC_DSV_L_KM_WERT", "l/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RBC_DSG_L_KM_WERT", "km/h" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RBC_STRECKE_L_KM_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_BC_BCW_KWH_KM[] = {   // 0xD129
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BC_DSV_KWH_KM_WERT", "kWh/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_BC_DSG_KWH_KM_WERT", "km/h" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BC_MVERB_KWH_KM_WERT", "kW" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_BC_RW_KWH_KM_WERT", "km" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_KOM_KOMBI_BC_RBC_KWH_KM[] = {   // 0xD12A
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_RBC_DSV_KWH_KM_WERT", "kWh/100km" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_RBC_DSG_KWH_KM_WERT", "km/h" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RBC_STRECKE_KWH_KM_WERT", "km" },
+  };
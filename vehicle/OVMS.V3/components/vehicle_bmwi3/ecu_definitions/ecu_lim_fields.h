@@ -0,0 +1,53 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/lim_i1.json: LIM 14: Charging interface module
+// This generated code  makes it easier to process CANBUS messages from the LIM ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_LIM_STATUS_CALCVN[] = {   // 0x2541
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CVN_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_LADESTECKDOSE_TEMPERATUR[] = {   // 0xDB0F
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, -40.0f, "STAT_LADESTECKDOSE_TEMP_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_LADEBEREITSCHAFT_LIM[] = {   // 0xDEF2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADEBEREITSCHAFT_LIM", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_PROXIMITY[] = {   // 0xDEF5
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STECKER_NR", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STROMTRAGFAEHIGKEIT_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_PILOTSIGNAL[] = {   // 0xDEF6
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILOT_AKTIV", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILOT_PWM_DUTYCYCLE_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILOT_CURRENT_WERT", "A" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PILOT_LADEBEREIT", "0/1" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PILOT_FREQUENZ_WERT", "Hz" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_PILOT_PEGEL_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_LADESCHNITTSTELLE_DC_TEPCO[] = {   // 0xDEF7
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CHARGE_CONTROL_1", "0/1" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CHARGE_CONTROL_2", "0/1" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CHARGE_PERMISSION", "0/1" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADESTECKER", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_DC_SCHUETZ_SCHALTER[] = {   // 0xDEF8
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DC_SCHUETZ_SCHALTER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_DC_SCHUETZ_SPANNUNG_EINGANG[] = {   // 0xDEF9
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DC_SCHUETZ_SPANNUNG_EINGANG_WERT", "V" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DC_SCHUETZ_SPANNUNG_NEGATIV", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_LIM_DC_PINABDECKUNG_COMBO[] = {   // 0xDEFA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DC_PINABDECKUNG", "0/1" },
+  };
@@ -0,0 +1,642 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/nbtevo.json: NBT 63: Headunit high
+// This generated code  makes it easier to process CANBUS messages from the NBT ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ETH_PHY_SWITCH_ENGINE_RESET[] = {   // 0x1044
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PHY_STOPPED_FOR_T_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_LIFECYCLE[] = {   // 0x1735
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LIFECYCLE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ETH_GET_NUMBER_OF_PORTS[] = {   // 0x1800
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NUM_PORTS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ETH_PHY_LINK_STATE[] = {   // 0x1802
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NUM_OF_PORTS_WERT", "" },
+  {    1, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_PHY_LINK_STATE_BTFLD", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ETH_LEARN_PORT_CONFIGURATION[] = {   // 0x1803
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LEARN_PORT_CONFIGURATION", "0-n" },
+  {    1, BMW_UDS_UINT  , BMW_UDS_BITFIELD, 1.0f, 0.0f, "BF_ETH_PORT_CONFIGURATION", "Bit" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_FIND_BEST_STATION[] = {   // 0xA00A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEARCHING_PROCESS", "0-n" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PI_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_QUALITY_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_PROVISIONING[] = {   // 0xA02F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROVISIONING", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_SDARS_FACTORY_DEFAULTS[] = {   // 0xA03D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SDARS_FACTORY_DEFAULTS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_FIND_BEST_STATION_DAB[] = {   // 0xA03F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEARCHING_PROCESS_STATUS_DAB", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ENSEMBLE_BER_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_FIND_BEST_TMC_STATION[] = {   // 0xA045
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEARCHING_PROCESS_STATUS", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PI_WERT_0XA045", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XA045", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_QUALITY_WERT_0XA045", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_INITIALISATION_COUNTER_REGION_CODE_DVD[] = {   // 0xA04D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INITIALISATION_COUNTER_REGION_CODE_DVD_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_SWUP_REMOVE_CUSTOMER_UPDATES[] = {   // 0xA05A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REMOVE_CUSTOMER_UPDATES", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_TELNET_ZUGANG_AUS[] = {   // 0xA0B0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TELNET_ZUGANG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_HU_VIN_PROTECTION[] = {   // 0xA0F6
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HU_VIN_PROTECTION", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_HU_FSC_REFURBISH_UI[] = {   // 0xA0F7
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HU_FSC_REFURBISH_UI_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_LESEN_SYSTEMAUDIO[] = {   // 0xD002
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUDIO_SYSTEM", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_INITIALISIERUNG[] = {   // 0xD004
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INITIALISIERUNG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_DRIVE_HDD[] = {   // 0xD007
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_HDD_PERCENT_WERT", "%" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_HDD_MBYTE_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION1_PERCENT_WERT", "%" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION1_MBYTE_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION2_PERCENT_WERT", "%" },
+  {   11, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION2_MBYTE_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION3_PERCENT_WERT", "%" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION3_MBYTE_WERT", "" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION4_PERCENT_WERT", "%" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION4_MBYTE_WERT", "" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION5_PERCENT_WERT", "%" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION5_MBYTE_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION6_PERCENT_WERT", "%" },
+  {   31, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION6_MBYTE_WERT", "" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION7_PERCENT_WERT", "%" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION7_MBYTE_WERT", "" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION8_PERCENT_WERT", "%" },
+  {   41, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION8_MBYTE_WERT", "" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION9_PERCENT_WERT", "%" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION9_MBYTE_WERT", "" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION10_PERCENT_WERT", "%" },
+  {   51, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION10_MBYTE_WERT", "" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION11_PERCENT_WERT", "%" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION11_MBYTE_WERT", "" },
+  {   60, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION12_PERCENT_WERT", "%" },
+  {   61, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION12_MBYTE_WERT", "" },
+  {   65, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION13_PERCENT_WERT", "%" },
+  {   66, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION13_MBYTE_WERT", "" },
+  {   70, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION14_PERCENT_WERT", "%" },
+  {   71, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION14_MBYTE_WERT", "" },
+  {   75, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION15_PERCENT_WERT", "%" },
+  {   76, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION15_MBYTE_WERT", "" },
+  {   80, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION16_PERCENT_WERT", "%" },
+  {   81, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION16_MBYTE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_MEMORY_USAGE[] = {   // 0xD00A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MEMORYSPACE_FLASH_KBYTE_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_FLASH_KBYTE_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_FLASH_PERCENT_WERT", "%" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MEMORYSPACE_RAM_KBYTE_WERT", "" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_RAM_KBYTE_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_RAM_PERCENT_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_LESEN_LAUFWERK[] = {   // 0xD00C
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VERBAUTE_LAUFWERKE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_ANT_QFS[] = {   // 0xD010
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_QUALITY_WERT_0XD010", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XD010", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANT_PW", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_EXACT_WERT", "dBµV" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREQUENZ_WERT", "kHz" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_SWUP_INSTALLATION_HISTORY[] = {   // 0xD01E
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_1_KILOMETER_WERT", "km" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_1_TYP", "0-n" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_1_FLASHSPEICHER_WERT", "kBytes" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_1_ERROR_CODE", "0-n" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_2_KILOMETER_WERT", "km" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_2_TYP", "0-n" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_2_FLASHSPEICHER_WERT", "kBytes" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_2_ERROR_CODE", "0-n" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_3_KILOMETER_WERT", "km" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_3_TYP", "0-n" },
+  {   25, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_3_FLASHSPEICHER_WERT", "kBytes" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_3_ERROR_CODE", "0-n" },
+  {   30, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_4_KILOMETER_WERT", "km" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_4_TYP", "0-n" },
+  {   35, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_4_FLASHSPEICHER_WERT", "kBytes" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_4_ERROR_CODE", "0-n" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_5_KILOMETER_WERT", "km" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_5_TYP", "0-n" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_5_FLASHSPEICHER_WERT", "kBytes" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_5_ERROR_CODE", "0-n" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_6_KILOMETER_WERT", "km" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_6_TYP", "0-n" },
+  {   55, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_6_FLASHSPEICHER_WERT", "kBytes" },
+  {   59, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_6_ERROR_CODE", "0-n" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_7_KILOMETER_WERT", "km" },
+  {   64, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_7_TYP", "0-n" },
+  {   65, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_7_FLASHSPEICHER_WERT", "kBytes" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_7_ERROR_CODE", "0-n" },
+  {   70, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_8_KILOMETER_WERT", "km" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_8_TYP", "0-n" },
+  {   75, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTORY_8_FLASHSPEICHER_WERT", "kBytes" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HISTORY_8_ERROR_CODE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_APPLICATION[] = {   // 0xD021
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_1", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_1", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_2", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_2", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_2", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_3", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_3", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_3", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_4", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_4", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_4", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_5", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_5", "0-n" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_5", "0-n" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_6", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_6", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_6", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_7", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_7", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_7", "0-n" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_8", "0-n" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_8", "0-n" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_8", "0-n" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_9", "0-n" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_9", "0-n" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_9", "0-n" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_10", "0-n" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_10", "0-n" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_10", "0-n" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_11", "0-n" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_11", "0-n" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_11", "0-n" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_12", "0-n" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_12", "0-n" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_12", "0-n" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_13", "0-n" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_13", "0-n" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_13", "0-n" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_14", "0-n" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_14", "0-n" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_14", "0-n" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_15", "0-n" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_15", "0-n" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_15", "0-n" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_16", "0-n" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_16", "0-n" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_16", "0-n" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_17", "0-n" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_17", "0-n" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_17", "0-n" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_18", "0-n" },
+  {   52, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_ENABLED_18", "0-n" },
+  {   53, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_APPL_CODED_18", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_ANALOG_TEMPERATUR[] = {   // 0xD026
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_FOT_WERT", "°C" },
+  {    1, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_TEMP_ENDSTU_WERT", "°C" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_GYRO_WERT", "°C" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MOD_WERT", "°C" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_HDD_WERT", "°C" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_DVD_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_CD_MD_CDC[] = {   // 0xD02C
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIGITAL_PLAYBACK_QUALITY_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_SPEED[] = {   // 0xD030
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_WHEEL1_SENSOR_SPEED_WERT", "km/h" },
+  {    2, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_WHEEL2_SENSOR_SPEED_WERT", "km/h" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_WHEEL3_SENSOR_SPEED_WERT", "km/h" },
+  {    6, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_WHEEL4_SENSOR_SPEED_WERT", "km/h" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_COMBINED_SENSOR_SPEED_WERT", "km/h" },
+  {   10, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_GPS_SPEED_WERT", "km/h" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SPEED_DIFFERENCE_PERCENT_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_DIRECTION[] = {   // 0xD031
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIRECTION", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIRECTION_SOURCE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_GPS_DILUTION_OF_POSITION[] = {   // 0xD032
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GPS_PDOP_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GPS_HDOP_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GPS_VDOP_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_GPS_SATINFO[] = {   // 0xD034
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NUMBER_VISIBLE_SATS_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NUMBER_TRACKED_SATS_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_1_ID_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_1_STATUS", "0-n" },
+  {    4, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_1_SIGNAL_TO_NOISE_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_2_ID_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_2_STATUS", "0-n" },
+  {    8, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_2_SIGNAL_TO_NOISE_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_3_ID_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_3_STATUS", "0-n" },
+  {   12, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_3_SIGNAL_TO_NOISE_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_4_ID_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_4_STATUS", "0-n" },
+  {   16, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_4_SIGNAL_TO_NOISE_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_5_ID_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_5_STATUS", "0-n" },
+  {   20, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_5_SIGNAL_TO_NOISE_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_6_ID_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_6_STATUS", "0-n" },
+  {   24, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_6_SIGNAL_TO_NOISE_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_7_ID_WERT", "" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_7_STATUS", "0-n" },
+  {   28, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_7_SIGNAL_TO_NOISE_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_8_ID_WERT", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_8_STATUS", "0-n" },
+  {   32, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_8_SIGNAL_TO_NOISE_WERT", "" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_9_ID_WERT", "" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_9_STATUS", "0-n" },
+  {   36, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_9_SIGNAL_TO_NOISE_WERT", "" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_10_ID_WERT", "" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_10_STATUS", "0-n" },
+  {   40, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_10_SIGNAL_TO_NOISE_WERT", "" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_11_ID_WERT", "" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_11_STATUS", "0-n" },
+  {   44, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_11_SIGNAL_TO_NOISE_WERT", "" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_12_ID_WERT", "" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_12_STATUS", "0-n" },
+  {   48, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_12_SIGNAL_TO_NOISE_WERT", "" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_13_ID_WERT", "" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_13_STATUS", "0-n" },
+  {   52, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_13_SIGNAL_TO_NOISE_WERT", "" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_14_ID_WERT", "" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_14_STATUS", "0-n" },
+  {   56, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_14_SIGNAL_TO_NOISE_WERT", "" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_15_ID_WERT", "" },
+  {   59, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_15_STATUS", "0-n" },
+  {   60, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_15_SIGNAL_TO_NOISE_WERT", "" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_16_ID_WERT", "" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SAT_16_STATUS", "0-n" },
+  {   64, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_SAT_16_SIGNAL_TO_NOISE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_GPS[] = {   // 0xD038
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GPS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_NAVI_CALIBRATION[] = {   // 0xD03D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NAVI_CALIBRATION", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_EXT_GYROSIGNAL[] = {   // 0xD03E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EXT_GYRO_SIGNAL", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_ANT_QFS_FM2[] = {   // 0xD045
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_QUALITY_WERT_0XD045", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XD045", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANT_PW_0XD045", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FIELDSTRENGTH_EXACT_WERT_0XD045", "dBµV" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FREQUENZ_WERT_0XD045", "kHz" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_SIGNAL_DAB[] = {   // 0xD053
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SIGNAL_DAB", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_USB_HUB_TEST[] = {   // 0xD057
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_HUB_TEST_PORT_1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_HUB_TEST_PORT_2", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_ROUTE_DOWNLOAD[] = {   // 0xD065
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ROUTE_DOWNLOAD", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PERCENT_COMPLETE_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AVAILABLE_DATASETS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_ADAS[] = {   // 0xD067
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LIFECYCLE_DURATION_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_ACC_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_NIVI_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_LDM_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_ICM_QL_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_KAFAS_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_FLA_WERT", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_FRMFA_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_V_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_LNE_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGRAPHSYNC_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGPS1_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGPS2_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVSYSINFO_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SENT_NAVGRAPHMATCH_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_TDA_AKTIVIERUNG[] = {   // 0xD091
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIENSTE_AKTIVIERUNG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_TIME_AFTER_STARTUP[] = {   // 0xD092
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TIME_AFTER_START_UP_WERT", "s" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TIME_AFTER_POWER_DOWN_AVAILABLE_WERT", "s" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TIME_AFTER_FULLY_OPERATIONAL_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_FM_PHASDIV_ANTENNA[] = {   // 0xD093
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FM_PHASEDIV_ANTENNA1", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FM_PHASEDIV_ANTENNA2", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_COUNTER_FILES_MUSICDB[] = {   // 0xD0C1
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MUSICDB_STORED_FILES_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ZIN_CENTRAL_INSTRUMENT[] = {   // 0xD0C9
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HW_INDEX_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_INDEX_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CRC_COUNTER_WERT", "" },
+  {    3, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SERIAL_NUMBER_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIAGNOSTIC_FLAGS", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZIN_VARIANT", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ZIN_EVENT_QUEUE[] = {   // 0xD0CA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_0_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_1_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_2_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_3_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_4_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_5_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_EVENT_ID_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_ZIN_INTERNAL_STATES[] = {   // 0xD0CB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CURRENT_WIDGET_ID_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_1_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_2_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_3_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_MAJOR_VERSION_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_MINOR_VERSION_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SW_PATCH_VERSION_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TARGET_BRIGHTNESS_WERT", "" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RING_OFFSET_BRIGHTNESS_WERT", "" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CURRENT_PWM_OUTPUT_VALUE_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LED_RING_SWITCH_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PERMANENT_SWITCH_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PERMANENT_DISPLAYS_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANIMATION_SWITCH_WERT", "" },
+  {   15, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANIMATION_DISPLAYS_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANAIMATION_TRIGGER_EVENT_WERT", "" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_ID_WERT", "" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_PRIO_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_TRIGGER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_PROVISIONING_PARAMETER[] = {   // 0xD0CE
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CAUSE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_MEDIA_STATISTIK[] = {   // 0xD0D1
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COUNTER_MEDIA_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COUNTER_AUDIO_CDS_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COUNTER_CD_ROM_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COUNTER_DVD_VIDEO_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_COUNTER_BLURAY_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RECOGNIZED_AUDIO_CDS_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ERROR_DURING_PLAYBACK_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PLAYBACK_TIME_CD_WERT", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PLAYBACK_TIME_DVD_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PLAYBACK_TIME_BLURAY_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INSERT_EJECT_COUNT_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_PROVISIONING_DATA[] = {   // 0xD0D3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROVISIONING_0XD0D3", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_SDARS_SIGNAL_QUALITY_SXM[] = {   // 0xD0DF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SDARS_COMP_RECEPTION_SXM", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SDARS_GLOBAL_STATUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_DRIVE[] = {   // 0xD0E2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MEDIUM_INSERTED", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_BORDERLINE_CHANGE_MODE[] = {   // 0xD0E8
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BORDERLINE_CHANGE_MODE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_PROVISIONING_FORMAT[] = {   // 0xD0EB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STAT_SIGNATURE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_WLAN_AUSSTATTUNG[] = {   // 0xD1FA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_CODED", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_AP_SA", "0-n" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_WIFI_DIRECT_SA", "0-n" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_STATION_SA", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_USB_TEST[] = {   // 0xD207
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_HUB_KDZ_CODING", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_TEST_HUB", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VENDORID_HUB_WERT", "HEX" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRODUCTID_HUB_WERT", "HEX" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_TEST_KDZ1", "0-n" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VENDORID_KDZ1_WERT", "HEX" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRODUCTID_KDZ1_WERT", "HEX" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_TEST_KDZ2", "0-n" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VENDORID_KDZ2_WERT", "HEX" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRODUCTID_KDZ2_WERT", "HEX" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_USB_TEST_SIA", "0-n" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VENDORID_SIA_WERT", "HEX" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PRODUCTID_SIA_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_WLAN_AP_NETWORK[] = {   // 0xD20E
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_AP_ENCRYPTION", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_PHOTOSENSOR[] = {   // 0xD5CB
+  {    0, BMW_UDS_SINT  , 0              , 1.0f, 0.0f, "STAT_PHOTOSENSOR_CID_WERT", "lx" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_TEMP_BACKLIGHT[] = {   // 0xD5CC
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_BACKLIGHT_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_HELLIGKEIT_SOLLWERT[] = {   // 0xD5CD
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HELLIGKEIT_SOLL_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_HELLIGKEIT_ISTWERT[] = {   // 0xD5CE
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HELLIGKEIT_IST_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_EINGANGSWERTE_LESEN[] = {   // 0xD5CF
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DISPLAY_AKTIVIERUNG", "0-n" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_OFFSET_HELLIGKEIT_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIMMRAD_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HELLIGKEIT_KOMBI_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DAEMPFUNG_LCD_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_VERBINDUNG[] = {   // 0xD5D0
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CID_VERBINDUNG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_DETAIL_INFORMATIONEN[] = {   // 0xD5D4
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CID_LOCATION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_SENSOR_WERTE[] = {   // 0x400A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AMB_SENSOR_WERT", "lx" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_BL_TEMP_WERT", "°C" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VCC_VOLTAGE_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BACKLIGT_DRIVER_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INT_STATUS_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_CID_SW_VERSION[] = {   // 0x400E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MAJOR_VERSION_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MINOR_VERSION_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PATCH_VERSION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_INTERNAL_STATES[] = {   // 0x400F
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CID_POWER_MODE", "0-n" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ERROR_FLAGS_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MAIN_STATE", "0-n" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_OPERATION_STATE", "0-n" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INIT_STATE", "0-n" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COM_STATE", "0-n" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHEDULE_ID", "0-n" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FADE_STATE", "0-n" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLASH_STATE", "0-n" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FLASH_DATA_CHANGED", "0-n" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DISPLAY_VOLTAGE", "0-n" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DISPLAY_ENABLE", "0-n" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DISPLAY_READY", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_CID_CODIERDATEN[] = {   // 0x4010
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_X1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_X2_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_X3_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_Y1_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_Y2_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_CURVE_Y3_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_TOLERANCE_ALPHA_WERT", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_TOLERANCE_ABS_WERT", "" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DIFF_GAIN_WERT", "" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DIFF_THRESHOLD_WERT", "" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DIFF_BIAS_WERT", "" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DIFF_MAX_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DIFF_MIN_WERT", "" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_UP_MIN_WERT", "" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_DOWN_MIN_WERT", "" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_MAX_OFFSET_BRIG_WERT", "" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T0_WERT", "" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T1_WERT", "" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T2_WERT", "" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_FADE_EXPO_T1_WERT", "" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_FADE_EXPO_T2_WERT", "" },
+  {   27, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DIM_FILT_CHANGE_SENSITIVITY_WERT", "" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIM_MIN_OFFSET_BRIG_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ENDIANESS_ADAPTED_WERT", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PADDING_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED[] = {   // 0x4011
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CID_LOCATION_WERT_0X4011", "" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SUPPLIER_NR_WERT", "" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SERIAL_NUMBER_WERT_0X4011", "" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PRODUCTION_YEAR_WERT", "HEX" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PRODUCTION_MONTH_WERT", "HEX" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PRODUCTION_DAY_WERT", "HEX" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HARDWARE_VERSION_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_DISPLAY_VERSION_WERT", "" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_MECHANICAL_VERSION_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_FLASH_DATA_VERSION_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_WLAN_SIGNAL_TEST_AP[] = {   // 0x4044
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_1_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_1_WERT", "dBm" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_2_WERT", "%" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_2_WERT", "dBm" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_3_WERT", "%" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_3_WERT", "dBm" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_4_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_4_WERT", "dBm" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_5_WERT", "%" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_5_WERT", "dBm" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_6_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_6_WERT", "dBm" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_7_WERT", "%" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_7_WERT", "dBm" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_8_WERT", "%" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_8_WERT", "dBm" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT[] = {   // 0x4045
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_1_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_1_WERT", "dBm" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_2_WERT", "%" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_2_WERT", "dBm" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_3_WERT", "%" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_3_WERT", "dBm" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_4_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_4_WERT", "dBm" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_5_WERT", "%" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_5_WERT", "dBm" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_6_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_6_WERT", "dBm" },
+  {   54, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_7_WERT", "%" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_7_WERT", "dBm" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_8_WERT", "%" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_8_WERT", "dBm" },
+  };
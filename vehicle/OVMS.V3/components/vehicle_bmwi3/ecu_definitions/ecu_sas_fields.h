@@ -0,0 +1,51 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/sas_i1.json: SAS 22: Optional equipment system
+// This generated code  makes it easier to process CANBUS messages from the SAS ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_SAS_VDC0_LESEN[] = {   // 0xD817
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VL_WERT", "mA" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VR_WERT", "mA" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HL_WERT", "mA" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HR_WERT", "mA" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VL_WERT", "mA" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VR_WERT", "mA" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HL_WERT", "mA" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HR_WERT", "mA" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_VL", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_VR", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_HL", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_HR", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLEMMEN", "0-n" },
+  {   21, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_VL_WERT", "rad/s" },
+  {   23, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_VR_WERT", "rad/s" },
+  {   25, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_HL_WERT", "rad/s" },
+  {   27, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_HR_WERT", "rad/s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SAS_VDC0_LESEN_0XD817[] = {   // 0xD817
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VL_WERT_0XD817", "mA" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VR_WERT_0XD817", "mA" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HL_WERT_0XD817", "mA" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HR_WERT_0XD817", "mA" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VL_WERT_0XD817", "mA" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VR_WERT_0XD817", "mA" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HL_WERT_0XD817", "mA" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HR_WERT_0XD817", "mA" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_VL_0XD817", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_VR_0XD817", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_HL_0XD817", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VDC_STATUS_HR_0XD817", "0-n" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KLEMMEN_0XD817", "0-n" },
+  {   21, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_VL_WERT_0XD817", "rad/s" },
+  {   23, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_VR_WERT_0XD817", "rad/s" },
+  {   25, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_HL_WERT_0XD817", "rad/s" },
+  {   27, BMW_UDS_UINT  , 0              , 0.0156f, -511.984f, "STAT_WHL_SPD_HR_WERT_0XD817", "rad/s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SAS_STATUS_SWC_VERSIONEN_LESEN_ANZAHL_DATENSAETZE[] = {   // 0xDD33
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INDEX_DATENSATZ_WERT", "" },
+  };
@@ -0,0 +1,2079 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/sme_i1.json: SME 07: Battery management electronics
+// This generated code  makes it easier to process CANBUS messages from the SME ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_INNENWIDERSTAND_TS[] = {   // 0x6334
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ALTERUNG_INNENWIDERSTAND_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_KAPAZITAET_TS[] = {   // 0x6335
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ALTERUNG_KAPAZITAET_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME__ST_SYM_MODUS[] = {   // 0x6516
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SYM_MODUS", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME__UEBERLAST_ZAHELER[] = {   // 0x651D
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_K1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_K2_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_K3_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_COOLING_VALVE_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_CSC_SUPPLY_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_ISENS_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_COOLING_PUMP_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_OVERLOAD_HEATING_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME__STATUS_UEBERNAHME_KAPATEST_NV[] = {   // 0x6526
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UEBERNAHME_KAPATEST_NV", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISOLATIONSWIDERSTAND_KOMMUNIKATION[] = {   // 0xAD5E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KOMMUNIKATION_AVL_ISRE", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISOLATION[] = {   // 0xAD61
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MESSUNG_ERFOLGREICH", "0-n" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MESSUNG_ISOLATIONSFEHLER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KAPAZITAET_BESTIMMUNG[] = {   // 0xAD66
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAPAZITAET_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AKTUELLER_ZUSTAND_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HEIZUNG[] = {   // 0xAD6A
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HEIZUNG_AKTIV_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SYMMETRIERUNG[] = {   // 0xAD6B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SYM", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HEIZUNG_FUNKTION[] = {   // 0xAD73
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HEIZUNG_FUNKTION_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_SOC_REKALIBRIERUNG[] = {   // 0xD4C5
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_REKAL_1", "0-n" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_1_WERT", "s" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_1_WERT", "s" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_1_WERT", "°C" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_1_WERT", "°C" },
+  {   11, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_1_WERT", "V" },
+  {   13, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_1_WERT", "V" },
+  {   15, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_1_WERT", "V" },
+  {   17, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_1_WERT", "%" },
+  {   19, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_1_WERT", "%" },
+  {   21, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_1_WERT", "%" },
+  {   23, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_1_WERT", "%" },
+  {   25, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_1_WERT", "%" },
+  {   27, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_1_WERT", "%" },
+  {   29, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_1_WERT", "%" },
+  {   31, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_1_WERT", "%" },
+  {   33, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_1_WERT", "%" },
+  {   35, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_1_WERT", "%" },
+  {   37, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_1_WERT", "%" },
+  {   39, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_1_WERT", "%" },
+  {   41, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_1_WERT", "%" },
+  {   43, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_1_WERT", "%" },
+  {   45, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_1_WERT", "%" },
+  {   47, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_VOR_1_WERT", "%" },
+  {   49, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_NACH_1_WERT", "%" },
+  {   51, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_REKAL_2", "0-n" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_2_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_2_WERT", "s" },
+  {   60, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_2_WERT", "°C" },
+  {   61, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_2_WERT", "°C" },
+  {   62, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_2_WERT", "V" },
+  {   64, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_2_WERT", "V" },
+  {   66, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_2_WERT", "V" },
+  {   68, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_2_WERT", "%" },
+  {   70, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_2_WERT", "%" },
+  {   72, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_2_WERT", "%" },
+  {   74, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_2_WERT", "%" },
+  {   76, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_2_WERT", "%" },
+  {   78, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_2_WERT", "%" },
+  {   80, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_2_WERT", "%" },
+  {   82, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_2_WERT", "%" },
+  {   84, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_2_WERT", "%" },
+  {   86, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_2_WERT", "%" },
+  {   88, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_2_WERT", "%" },
+  {   90, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_2_WERT", "%" },
+  {   92, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_2_WERT", "%" },
+  {   94, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_2_WERT", "%" },
+  {   96, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_2_WERT", "%" },
+  {   98, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_VOR_2_WERT", "%" },
+  {  100, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_NACH_2_WERT", "%" },
+  {  102, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_REKAL_3", "0-n" },
+  {  103, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_3_WERT", "s" },
+  {  107, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_3_WERT", "s" },
+  {  111, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_3_WERT", "°C" },
+  {  112, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_3_WERT", "°C" },
+  {  113, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_3_WERT", "V" },
+  {  115, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_3_WERT", "V" },
+  {  117, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_3_WERT", "V" },
+  {  119, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_3_WERT", "%" },
+  {  121, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_3_WERT", "%" },
+  {  123, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_3_WERT", "%" },
+  {  125, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_3_WERT", "%" },
+  {  127, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_3_WERT", "%" },
+  {  129, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_3_WERT", "%" },
+  {  131, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_3_WERT", "%" },
+  {  133, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_3_WERT", "%" },
+  {  135, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_3_WERT", "%" },
+  {  137, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_3_WERT", "%" },
+  {  139, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_3_WERT", "%" },
+  {  141, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_3_WERT", "%" },
+  {  143, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_3_WERT", "%" },
+  {  145, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_3_WERT", "%" },
+  {  147, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_3_WERT", "%" },
+  {  149, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_VOR_3_WERT", "%" },
+  {  151, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_NACH_3_WERT", "%" },
+  {  153, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_REKAL_4", "0-n" },
+  {  154, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_4_WERT", "s" },
+  {  158, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_4_WERT", "s" },
+  {  162, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_4_WERT", "°C" },
+  {  163, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_4_WERT", "°C" },
+  {  164, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_4_WERT", "V" },
+  {  166, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_4_WERT", "V" },
+  {  168, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_4_WERT", "V" },
+  {  170, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_4_WERT", "%" },
+  {  172, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_4_WERT", "%" },
+  {  174, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_4_WERT", "%" },
+  {  176, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_4_WERT", "%" },
+  {  178, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_4_WERT", "%" },
+  {  180, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_4_WERT", "%" },
+  {  182, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_4_WERT", "%" },
+  {  184, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_4_WERT", "%" },
+  {  186, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_4_WERT", "%" },
+  {  188, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_4_WERT", "%" },
+  {  190, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_4_WERT", "%" },
+  {  192, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_4_WERT", "%" },
+  {  194, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_4_WERT", "%" },
+  {  196, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_4_WERT", "%" },
+  {  198, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_4_WERT", "%" },
+  {  200, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_VOR_4_WERT", "%" },
+  {  202, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_NACH_4_WERT", "%" },
+  {  204, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_REKAL_5", "0-n" },
+  {  205, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_5_WERT", "s" },
+  {  209, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_5_WERT", "s" },
+  {  213, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_5_WERT", "°C" },
+  {  214, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_5_WERT", "°C" },
+  {  215, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_5_WERT", "V" },
+  {  217, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_5_WERT", "V" },
+  {  219, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_5_WERT", "V" },
+  {  221, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_5_WERT", "%" },
+  {  223, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_5_WERT", "%" },
+  {  225, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_5_WERT", "%" },
+  {  227, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_5_WERT", "%" },
+  {  229, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_5_WERT", "%" },
+  {  231, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_5_WERT", "%" },
+  {  233, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_5_WERT", "%" },
+  {  235, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_5_WERT", "%" },
+  {  237, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_5_WERT", "%" },
+  {  239, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_5_WERT", "%" },
+  {  241, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_5_WERT", "%" },
+  {  243, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_5_WERT", "%" },
+  {  245, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_5_WERT", "%" },
+  {  247, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_5_WERT", "%" },
+  {  249, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_5_WERT", "%" },
+  {  251, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_VOR_5_WERT", "%" },
+  {  253, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_BAND_NACH_5_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SOC_GUETE[] = {   // 0xD4C7
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_GUETE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_SOC_GUETE[] = {   // 0xD4C8
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_1_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_2_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_3_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_4_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_5_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ANZAHL_OCV_SOC_REKAL[] = {   // 0xD4C9
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_OCV_SOC_REKAL_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ANZAHL_LADEENDE_REKAL[] = {   // 0xD4CA
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LADEENDE_REKAL_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_SOC_VOLLADEENDE[] = {   // 0xD4CB
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_1_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_1_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_1_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_1_WERT", "%" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_1_WERT", "°C" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEENDE_1_WERT", "°C" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_2_WERT", "%" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_2_WERT", "%" },
+  {   14, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_2_WERT", "%" },
+  {   16, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_2_WERT", "%" },
+  {   18, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_2_WERT", "°C" },
+  {   19, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEENDE_2_WERT", "°C" },
+  {   20, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_3_WERT", "%" },
+  {   22, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_3_WERT", "%" },
+  {   24, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_3_WERT", "%" },
+  {   26, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_3_WERT", "%" },
+  {   28, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_3_WERT", "°C" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEENDE_3_WERT", "°C" },
+  {   30, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_4_WERT", "%" },
+  {   32, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_4_WERT", "%" },
+  {   34, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_4_WERT", "%" },
+  {   36, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_4_WERT", "%" },
+  {   38, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_4_WERT", "°C" },
+  {   39, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEENDE_4_WERT", "°C" },
+  {   40, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_5_WERT", "%" },
+  {   42, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_5_WERT", "%" },
+  {   44, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_5_WERT", "%" },
+  {   46, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_5_WERT", "%" },
+  {   48, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_5_WERT", "°C" },
+  {   49, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_LADEENDE_5_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KUEHLDAUER_HVB[] = {   // 0xD4CC
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_MAX_WERT", "min" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_1_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_2_WERT", "" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_3_WERT", "" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_4_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADUNGSVERLUST_ZELLE[] = {   // 0xD67F
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_MIN_NENN_01_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DIFF_SOC_01_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_MIN_NENN_02_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DIFF_SOC_02_WERT", "%" },
+  {    8, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_MIN_NENN_03_WERT", "%" },
+  {   10, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DIFF_SOC_03_WERT", "%" },
+  {   12, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_MIN_NENN_04_WERT", "%" },
+  {   14, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DIFF_SOC_04_WERT", "%" },
+  {   16, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SOC_MIN_NENN_05_WERT", "%" },
+  {   18, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_DIFF_SOC_05_WERT", "%" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ID_ZELLE_SOC_MIN_WERT", "" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COUNTER_RG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_STATUS_MIN_KAPAZITAET_MOD[] = {   // 0xD681
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_01_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_02_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_03_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_04_WERT", "%" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_05_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_06_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_07_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_08_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_09_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_10_WERT", "%" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_11_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_12_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_ISO_MESS_TRG[] = {   // 0xD6C7
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_R_ISO_TRG_01_WERT", "kOhm" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_01_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_R_ISO_TRG_02_WERT", "kOhm" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_02_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_R_ISO_TRG_03_WERT", "kOhm" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_03_WERT", "" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_R_ISO_TRG_04_WERT", "kOhm" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_04_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_R_ISO_TRG_05_WERT", "kOhm" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_05_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_ISO_MESS_STD_IO_NIO[] = {   // 0xD6C8
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_01_WERT", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_01_WERT", "kOhm" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_01_WERT", "" },
+  {    7, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_02_WERT", "km" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_02_WERT", "kOhm" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_02_WERT", "" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_03_WERT", "km" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_03_WERT", "kOhm" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_03_WERT", "" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_04_WERT", "km" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_04_WERT", "kOhm" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_04_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_05_WERT", "km" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_05_WERT", "kOhm" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_05_WERT", "" },
+  {   35, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_06_WERT", "km" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_06_WERT", "kOhm" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_06_WERT", "" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_07_WERT", "km" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_07_WERT", "kOhm" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_07_WERT", "" },
+  {   49, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_08_WERT", "km" },
+  {   53, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_08_WERT", "kOhm" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_08_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_09_WERT", "km" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_09_WERT", "kOhm" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_09_WERT", "" },
+  {   63, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_STD_KM_ISO_10_WERT", "km" },
+  {   67, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_10_WERT", "kOhm" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_10_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_ISO_MESS_TRG_IO_NIO[] = {   // 0xD6C9
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_01_WERT", "km" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_01_WERT", "kOhm" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_01_WERT", "" },
+  {    7, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_02_WERT", "km" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_02_WERT", "kOhm" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_02_WERT", "" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_03_WERT", "km" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_03_WERT", "kOhm" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_03_WERT", "" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_04_WERT", "km" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_04_WERT", "kOhm" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_04_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_05_WERT", "km" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_05_WERT", "kOhm" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_05_WERT", "" },
+  {   35, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_06_WERT", "km" },
+  {   39, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_06_WERT", "kOhm" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_06_WERT", "" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_07_WERT", "km" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_07_WERT", "kOhm" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_07_WERT", "" },
+  {   49, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_08_WERT", "km" },
+  {   53, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_08_WERT", "kOhm" },
+  {   55, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_08_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_09_WERT", "km" },
+  {   60, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_09_WERT", "kOhm" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_09_WERT", "" },
+  {   63, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TRG_KM_ISO_10_WERT", "km" },
+  {   67, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_10_WERT", "kOhm" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_10_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISODIAG_INPUT_ISTWERTE[] = {   // 0xD6CA
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_01_WERT", "V" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_02_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_03_WERT", "V" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_04_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_05_WERT", "V" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_06_WERT", "" },
+  {    9, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_07_WERT", "V" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_08_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_09_WERT", "V" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_10_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISO_ERR_STD_FZ1_2[] = {   // 0xD6CB
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FEHLERZAEHLER_STD_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_01_WERT", "V" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_02_WERT", "" },
+  {    7, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_03_WERT", "V" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_04_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_05_WERT", "V" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_06_WERT", "" },
+  {   13, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_07_WERT", "V" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_08_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_09_WERT", "V" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_10_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_11_WERT", "kOhm" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_12_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_13_WERT", "kOhm" },
+  {   24, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_14_WERT", "" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_15_WERT", "kOhm" },
+  {   27, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_16_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_01_WERT", "V" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_02_WERT", "" },
+  {   31, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_03_WERT", "V" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_04_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_05_WERT", "V" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_06_WERT", "" },
+  {   37, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_07_WERT", "V" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_08_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_09_WERT", "V" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_10_WERT", "" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_11_WERT", "kOhm" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_12_WERT", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_13_WERT", "kOhm" },
+  {   48, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_14_WERT", "" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_15_WERT", "kOhm" },
+  {   51, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_16_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_SOH_KAPATEST[] = {   // 0xD6CC
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_1_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_1_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_1_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_1_WERT", "%" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_1_WERT", "°C" },
+  {    9, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_1_WERT", "V" },
+  {   11, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_1_WERT", "%" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_1_WERT", "s" },
+  {   17, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_2_WERT", "%" },
+  {   19, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_2_WERT", "%" },
+  {   21, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_2_WERT", "%" },
+  {   23, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_2_WERT", "%" },
+  {   25, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_2_WERT", "°C" },
+  {   26, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_2_WERT", "V" },
+  {   28, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_2_WERT", "%" },
+  {   30, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_2_WERT", "s" },
+  {   34, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_3_WERT", "%" },
+  {   36, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_3_WERT", "%" },
+  {   38, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_3_WERT", "%" },
+  {   40, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_3_WERT", "%" },
+  {   42, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_3_WERT", "°C" },
+  {   43, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_3_WERT", "V" },
+  {   45, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_3_WERT", "%" },
+  {   47, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_3_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_REKU_VOLTAGE_LIFT[] = {   // 0xD6CD
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_REKU_VOLT_LIFT_WERT", "" },
+  {    2, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_DAUER_REKU_VOLT_LIFT_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_ALTERUNG_KAPA[] = {   // 0xD6CE
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_1_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_ADAPTION_1_WERT", "" },
+  {    3, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_1_WERT", "s" },
+  {    7, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_1_WERT", "Ah" },
+  {   11, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_1_WERT", "Ah" },
+  {   15, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_1_WERT", "s" },
+  {   17, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN1_1_WERT", "°C" },
+  {   18, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN2_1_WERT", "°C" },
+  {   19, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_1_WERT", "V" },
+  {   21, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_1_WERT", "V" },
+  {   23, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_1_WERT", "V" },
+  {   25, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_1_WERT", "V" },
+  {   27, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_1_WERT", "V" },
+  {   29, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_1_WERT", "V" },
+  {   31, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_1_WERT", "%" },
+  {   33, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_1_WERT", "%" },
+  {   35, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC1_ZELLE1_1_WERT", "V" },
+  {   37, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC2_ZELLE1_1_WERT", "V" },
+  {   39, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_1_WERT", "" },
+  {   41, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_NACH_1_WERT", "%" },
+  {   43, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_NACH_1_WERT", "%" },
+  {   45, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_1_WERT", "%" },
+  {   47, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_2_WERT", "" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_ADAPTION_2_WERT", "" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_2_WERT", "s" },
+  {   54, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_2_WERT", "Ah" },
+  {   58, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_2_WERT", "Ah" },
+  {   62, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_2_WERT", "s" },
+  {   64, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN1_2_WERT", "°C" },
+  {   65, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN2_2_WERT", "°C" },
+  {   66, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_2_WERT", "V" },
+  {   68, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_2_WERT", "V" },
+  {   70, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_2_WERT", "V" },
+  {   72, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_2_WERT", "V" },
+  {   74, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_2_WERT", "V" },
+  {   76, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_2_WERT", "V" },
+  {   78, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_2_WERT", "%" },
+  {   80, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_2_WERT", "%" },
+  {   82, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC1_ZELLE1_2_WERT", "V" },
+  {   84, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC2_ZELLE1_2_WERT", "V" },
+  {   86, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_2_WERT", "" },
+  {   88, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_NACH_2_WERT", "%" },
+  {   90, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_NACH_2_WERT", "%" },
+  {   92, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_2_WERT", "%" },
+  {   94, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_3_WERT", "" },
+  {   96, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_ADAPTION_3_WERT", "" },
+  {   97, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_3_WERT", "s" },
+  {  101, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_3_WERT", "Ah" },
+  {  105, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_3_WERT", "Ah" },
+  {  109, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_3_WERT", "s" },
+  {  111, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN1_3_WERT", "°C" },
+  {  112, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN2_3_WERT", "°C" },
+  {  113, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_3_WERT", "V" },
+  {  115, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_3_WERT", "V" },
+  {  117, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_3_WERT", "V" },
+  {  119, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_3_WERT", "V" },
+  {  121, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_3_WERT", "V" },
+  {  123, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_3_WERT", "V" },
+  {  125, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_3_WERT", "%" },
+  {  127, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_3_WERT", "%" },
+  {  129, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC1_ZELLE1_3_WERT", "V" },
+  {  131, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC2_ZELLE1_3_WERT", "V" },
+  {  133, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_3_WERT", "" },
+  {  135, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_NACH_3_WERT", "%" },
+  {  137, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_NACH_3_WERT", "%" },
+  {  139, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_3_WERT", "%" },
+  {  141, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_4_WERT", "" },
+  {  143, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_ADAPTION_4_WERT", "" },
+  {  144, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_4_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_4_WERT", "Ah" },
+  {  152, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_4_WERT", "Ah" },
+  {  156, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_4_WERT", "s" },
+  {  158, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN1_4_WERT", "°C" },
+  {  159, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN2_4_WERT", "°C" },
+  {  160, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_4_WERT", "V" },
+  {  162, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_4_WERT", "V" },
+  {  164, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_4_WERT", "V" },
+  {  166, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_4_WERT", "V" },
+  {  168, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_4_WERT", "V" },
+  {  170, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_4_WERT", "V" },
+  {  172, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_4_WERT", "%" },
+  {  174, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_4_WERT", "%" },
+  {  176, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC1_ZELLE1_4_WERT", "V" },
+  {  178, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC2_ZELLE1_4_WERT", "V" },
+  {  180, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_4_WERT", "" },
+  {  182, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_NACH_4_WERT", "%" },
+  {  184, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_NACH_4_WERT", "%" },
+  {  186, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_4_WERT", "%" },
+  {  188, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_5_WERT", "" },
+  {  190, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_ADAPTION_5_WERT", "" },
+  {  191, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_5_WERT", "s" },
+  {  195, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_5_WERT", "Ah" },
+  {  199, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_5_WERT", "Ah" },
+  {  203, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_5_WERT", "s" },
+  {  205, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN1_5_WERT", "°C" },
+  {  206, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN2_5_WERT", "°C" },
+  {  207, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_5_WERT", "V" },
+  {  209, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_5_WERT", "V" },
+  {  211, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_5_WERT", "V" },
+  {  213, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_5_WERT", "V" },
+  {  215, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_5_WERT", "V" },
+  {  217, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_5_WERT", "V" },
+  {  219, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_5_WERT", "%" },
+  {  221, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_5_WERT", "%" },
+  {  223, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC1_ZELLE1_5_WERT", "V" },
+  {  225, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVC2_ZELLE1_5_WERT", "V" },
+  {  227, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_5_WERT", "" },
+  {  229, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_NACH_5_WERT", "%" },
+  {  231, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_NACH_5_WERT", "%" },
+  {  233, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_5_WERT", "%" },
+  {  235, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MIN_VOR_5_WERT", "%" },
+  {  237, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MAX_VOR_5_WERT", "%" },
+  {  239, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SOH_MEAN_VOR_5_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_CSC_TEMPERATUREN[] = {   // 0xD6CF
+  {    0, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC1_SENS1_WERT", "°C" },
+  {    1, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC1_SENS2_WERT", "°C" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC2_SENS1_WERT", "°C" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC2_SENS2_WERT", "°C" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC3_SENS1_WERT", "°C" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC3_SENS2_WERT", "°C" },
+  {    6, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC4_SENS1_WERT", "°C" },
+  {    7, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC4_SENS2_WERT", "°C" },
+  {    8, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC5_SENS1_WERT", "°C" },
+  {    9, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC5_SENS2_WERT", "°C" },
+  {   10, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC6_SENS1_WERT", "°C" },
+  {   11, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC6_SENS2_WERT", "°C" },
+  {   12, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC7_SENS1_WERT", "°C" },
+  {   13, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC7_SENS2_WERT", "°C" },
+  {   14, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC8_SENS1_WERT", "°C" },
+  {   15, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC8_SENS2_WERT", "°C" },
+  {   16, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC9_SENS1_WERT", "°C" },
+  {   17, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC9_SENS2_WERT", "°C" },
+  {   18, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC10_SENS1_WERT", "°C" },
+  {   19, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC10_SENS2_WERT", "°C" },
+  {   20, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC11_SENS1_WERT", "°C" },
+  {   21, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC11_SENS2_WERT", "°C" },
+  {   22, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC12_SENS1_WERT", "°C" },
+  {   23, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_MESSTEMP_CSC12_SENS2_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISO_ERR_TRG_FZ1_2[] = {   // 0xD6D1
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_FEHLERZAEHLER_TRG_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_01_WERT", "V" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_02_WERT", "" },
+  {    7, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_03_WERT", "V" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_04_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_05_WERT", "V" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_06_WERT", "" },
+  {   13, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_07_WERT", "V" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_08_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_09_WERT", "V" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_10_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_11_WERT", "kOhm" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_12_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_13_WERT", "kOhm" },
+  {   24, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_14_WERT", "" },
+  {   25, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_15_WERT", "kOhm" },
+  {   27, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_16_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_01_WERT", "V" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_02_WERT", "" },
+  {   31, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_03_WERT", "V" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_04_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_05_WERT", "V" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_06_WERT", "" },
+  {   37, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_07_WERT", "V" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_08_WERT", "" },
+  {   40, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_09_WERT", "V" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_10_WERT", "" },
+  {   43, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_11_WERT", "kOhm" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_12_WERT", "" },
+  {   46, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_13_WERT", "kOhm" },
+  {   48, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_14_WERT", "" },
+  {   49, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_15_WERT", "kOhm" },
+  {   51, BMW_UDS_UCHAR , 0              , 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_16_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SCHUETZ_SCHALTER[] = {   // 0xDD60
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SCHUETZ_SCHALTER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SCHUETZSCHALTUNGEN_ANZAHL[] = {   // 0xDD63
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_SCHALTUNGEN_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_SCHALTUNGEN_LAST_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HVIL[] = {   // 0xDD64
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GUELTIG", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_SPANNUNG[] = {   // 0xDD66
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HV_SPANNUNG_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ANZAHL_KUEHLANFORDERUNG_DRINGEND[] = {   // 0xDD67
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_KUEHLANFORDERUNG_DRINGEND_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_SPANNUNG_BERECHNET[] = {   // 0xDD68
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HV_SPANNUNG_BERECHNET_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_STROM[] = {   // 0xDD69
+  {    0, BMW_UDS_SINT32, 0              , 0.01f, 0.0f, "STAT_HV_STROM_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ISOLATIONSWIDERSTAND[] = {   // 0xDD6A
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_TRG_WERT", "kOhm" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_STD_WERT", "kOhm" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_INT_WERT", "kOhm" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_TRG_PLAUS", "0/1" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_STD_PLAUS", "0/1" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ISOWIDERSTAND_INT_PLAUS", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KUEHLKREISLAUF_TEMP[] = {   // 0xDD6C
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TEMP_KUEHLKREISLAUF_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_AUFSTART_VERHINDERER[] = {   // 0xDD72
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_AUFSTART_VERHINDERER", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_CUMULATIVE_LADUNG[] = {   // 0xDD73
+  {    0, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_LADUNG_AMP_STUNDEN_WERT", "Ah" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_CUMULATIVE_ENTLADUNG[] = {   // 0xDD74
+  {    0, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_ENTLADUNG_AMP_STUNDEN_WERT", "Ah" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_STATUS_KL30C_SPANNUNG[] = {   // 0xDD76
+  {    0, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_KL30C_SPANNUNG_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_KAPAZITAET[] = {   // 0xDD7B
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAPAZITAET_WERT_0XDD7B", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_GW_INFO[] = {   // 0xDD7C
+  {    0, BMW_UDS_UINT  , 0              , 1000.0f, 0.0f, "STAT_LEISTUNG_MAX_WERT", "W" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_1_WERT", "min" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_2_WERT", "min" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_3_WERT", "min" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_4_WERT", "min" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_5_WERT", "min" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_6_WERT", "min" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_7_WERT", "min" },
+  {   30, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_1_WERT", "min" },
+  {   34, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_2_WERT", "min" },
+  {   38, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_3_WERT", "min" },
+  {   42, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_4_WERT", "min" },
+  {   46, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_5_WERT", "min" },
+  {   50, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_6_WERT", "min" },
+  {   54, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_7_WERT", "min" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UCELLMAX_EIN", "0/1" },
+  {   59, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_UCELLMIN_EIN", "0/1" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_KM_STAND_WERT", "km" },
+  {   64, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_IMAX_DCHG_WERT", "A" },
+  {   68, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_IMAX_CHG_WERT", "A" },
+  {   72, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_IMAX_LAD_ERROR_EIN", "0/1" },
+  {   73, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TMAX_ERROR_OP_EIN", "0/1" },
+  {   74, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TMAX_ERROR_NO_OP_EIN", "0/1" },
+  {   75, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TMIN_ERROR_OP_EIN", "0/1" },
+  {   76, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TMIN_ERROR_NO_OP_EIN", "0/1" },
+  {   77, BMW_UDS_UINT32, 0              , 36.0f, 0.0f, "STAT_CUMULATIVE_ENERGIE_LADUNG_WERT", "Ws" },
+  {   81, BMW_UDS_UINT32, 0              , 36.0f, 0.0f, "STAT_CUMULATIVE_ENERGIE_ENTLADUNG_WERT", "Ws" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_STROMGRENZEN[] = {   // 0xDD7D
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_LADESTROMGRENZE_WERT", "A" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ENTLADESTROMGRENZE_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SPANNUNGSGRENZEN[] = {   // 0xDD7E
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LADESPANNUNGSGRENZE_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ENTLADESPANNUNGSGRENZE_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HVB_HISTORIE_ZYKLEN[] = {   // 0xDD8E
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_1_WERT", "" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_2_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_3_WERT", "" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_4_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_5_WERT", "" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_6_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_7_WERT", "" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_8_WERT", "" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_9_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_10_WERT", "" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_1_WERT", "" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_2_WERT", "" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_3_WERT", "" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_4_WERT", "" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_5_WERT", "" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_6_WERT", "" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_7_WERT", "" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_8_WERT", "" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_9_WERT", "" },
+  {   76, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_10_WERT", "" },
+  {   80, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_STROM_MAX_WERT", "A" },
+  {   82, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_STROM_MIN_WERT", "A" },
+  {   84, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_1_WERT", "min" },
+  {   88, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_2_WERT", "min" },
+  {   92, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_3_WERT", "min" },
+  {   96, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_4_WERT", "min" },
+  {  100, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_5_WERT", "min" },
+  {  104, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_6_WERT", "min" },
+  {  108, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_7_WERT", "min" },
+  {  112, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_I_HISTO_8_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ZEIT_TEMP_HISTOGRAMM[] = {   // 0xDD90
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_1_WERT", "min" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_2_WERT", "min" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_3_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_4_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_5_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_6_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_7_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_8_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_9_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_10_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_11_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_12_WERT", "min" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_13_WERT", "min" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_14_WERT", "min" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_1_WERT", "min" },
+  {   60, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_2_WERT", "min" },
+  {   64, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_3_WERT", "min" },
+  {   68, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_4_WERT", "min" },
+  {   72, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_5_WERT", "min" },
+  {   76, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_6_WERT", "min" },
+  {   80, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_7_WERT", "min" },
+  {   84, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_8_WERT", "min" },
+  {   88, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_9_WERT", "min" },
+  {   92, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_10_WERT", "min" },
+  {   96, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_11_WERT", "min" },
+  {  100, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_12_WERT", "min" },
+  {  104, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_13_WERT", "min" },
+  {  108, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_14_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ZEIT_SOC_KLASSE[] = {   // 0xDD91
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_1_WERT", "min" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_2_WERT", "min" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_3_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_4_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_5_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_6_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_7_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_8_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_9_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_10_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_11_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEIT_SOC_12_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T1_1[] = {   // 0xDD94
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T2_1[] = {   // 0xDD95
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T3_1[] = {   // 0xDD96
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T4_1[] = {   // 0xDD97
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T5_1[] = {   // 0xDD98
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T6_1[] = {   // 0xDD99
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T7_1[] = {   // 0xDD9A
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I10_WERT", "s" },
+  {  120, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I1_WERT", "s" },
+  {  124, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I2_WERT", "s" },
+  {  128, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I3_WERT", "s" },
+  {  132, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I4_WERT", "s" },
+  {  136, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I5_WERT", "s" },
+  {  140, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I6_WERT", "s" },
+  {  144, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I7_WERT", "s" },
+  {  148, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I8_WERT", "s" },
+  {  152, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I9_WERT", "s" },
+  {  156, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADEZIELSPANNUNG_TAUSCH[] = {   // 0xDDAB
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_LADEZIELSPANNUNG_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_SPANNUNG_BATTERIE[] = {   // 0xDDB4
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_HV_SPANNUNG_BATT_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_INNENWIDERSTAND[] = {   // 0xDDB6
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ALTERUNG_INNENWIDERSTAND_WERT_0XDDB6", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ANZEIGE_SOC[] = {   // 0xDDBC
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_ANZEIGE_SOC_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_MAXIMALE_ANZEIGE_SOC_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_MINIMALE_ANZEIGE_SOC_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SERVICE_DISCONNECT[] = {   // 0xDDBD
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SERVICE_DISCONNECT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_VORLADUNG[] = {   // 0xDDBE
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_WERT", "ms" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_1_WERT", "ms" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_2_WERT", "ms" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_3_WERT", "ms" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_4_WERT", "ms" },
+  {   10, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_WERT", "A" },
+  {   12, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_1_WERT", "A" },
+  {   14, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_2_WERT", "A" },
+  {   16, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_3_WERT", "A" },
+  {   18, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_4_WERT", "A" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ZELLSPANNUNGEN_MIN_MAX[] = {   // 0xDDBF
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCELL_MIN_WERT", "V" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UCELL_MAX_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_TEMPERATUREN[] = {   // 0xDDC0
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TCORE_MIN_WERT", "°C" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TCORE_MAX_WERT", "°C" },
+  {    4, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_TCORE_MEAN_WERT", "°C" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_PARAMETER[] = {   // 0xDDC2
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_FAKTOR_RS_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_FAKTOR_RP_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_FAKTOR_CP_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HISTO_SYM_DAUER[] = {   // 0xDDC6
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SYM_DAUER_MAX_WERT", "min" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_1_WERT", "" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_2_WERT", "" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_3_WERT", "" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_4_WERT", "" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_5_WERT", "" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_6_WERT", "" },
+  {   26, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_7_WERT", "" },
+  {   30, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_8_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HISTO_SYM_ZELLANZAHL[] = {   // 0xDDC7
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_2_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_3_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_4_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_5_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_6_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_7_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_8_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SYM_DELTASOC[] = {   // 0xDDC8
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SYM_DELTASOC_1_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SYM_DELTASOC_2_WERT", "%" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SYM_DELTASOC_3_WERT", "%" },
+  {    6, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SYM_DELTASOC_4_WERT", "%" },
+  {    8, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_SYM_DELTASOC_5_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_MAX_SYM_DAUER[] = {   // 0xDDC9
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_1_WERT", "s" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAL_COMPL_1_NR", "0-n" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_2_WERT", "s" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_2_WERT", "s" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAL_COMPL_2_NR", "0-n" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_3_WERT", "s" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_3_WERT", "s" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAL_COMPL_3_NR", "0-n" },
+  {   27, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_4_WERT", "s" },
+  {   31, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_4_WERT", "s" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAL_COMPL_4_NR", "0-n" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_5_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_5_WERT", "s" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_BAL_COMPL_5_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SOC_GRENZEN[] = {   // 0xDDCB
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MIN_SOC_GRENZE_WERT", "%" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_MAX_SOC_GRENZE_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_DIFFERENZ_SPANNUNGEN[] = {   // 0xDDCF
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_DIFF_SPANNUNG_STATISCH_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_KAPAZITAET_DEGRADATION[] = {   // 0xDDE8
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_DEGRADATION_GESAMT_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_DEGRADATION_LAUFENDES_JAHR_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB[] = {   // 0xDDE9
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_50_65_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_65_80_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_80_85_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_85_90_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_90_95_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_95_100_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_50_65_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_65_80_WERT", "" },
+  {   16, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_80_85_WERT", "" },
+  {   18, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_85_90_WERT", "" },
+  {   20, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_90_95_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_95_100_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_50_65_WERT", "" },
+  {   26, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_65_80_WERT", "" },
+  {   28, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_80_85_WERT", "" },
+  {   30, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_85_90_WERT", "" },
+  {   32, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_90_95_WERT", "" },
+  {   34, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_95_100_WERT", "" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_50_65_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_65_80_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_80_85_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_85_90_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_90_95_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_95_100_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RINGPUFFER_LADEVORGAENGE[] = {   // 0xDDEB
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_START_SOC_1_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_START_SOC_2_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_START_SOC_3_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_START_SOC_4_WERT", "%" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_START_SOC_5_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERF_P_LADEN_1_WERT", "kW" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERF_P_LADEN_2_WERT", "kW" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERF_P_LADEN_3_WERT", "kW" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERF_P_LADEN_4_WERT", "kW" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERF_P_LADEN_5_WERT", "kW" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAL_END_SOC_1_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAL_END_SOC_2_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAL_END_SOC_3_WERT", "%" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAL_END_SOC_4_WERT", "%" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_REAL_END_SOC_5_WERT", "%" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_1", "0-n" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_2", "0-n" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_3", "0-n" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_4", "0-n" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_5", "0-n" },
+  {   20, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_START_TEMP_1_WERT", "°C" },
+  {   21, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_START_TEMP_2_WERT", "°C" },
+  {   22, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_START_TEMP_3_WERT", "°C" },
+  {   23, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_START_TEMP_4_WERT", "°C" },
+  {   24, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_START_TEMP_5_WERT", "°C" },
+  {   25, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_END_TEMP_1_WERT", "°C" },
+  {   26, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_END_TEMP_2_WERT", "°C" },
+  {   27, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_END_TEMP_3_WERT", "°C" },
+  {   28, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_END_TEMP_4_WERT", "°C" },
+  {   29, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_END_TEMP_5_WERT", "°C" },
+  {   30, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_1_WERT", "min" },
+  {   31, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_2_WERT", "min" },
+  {   32, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_3_WERT", "min" },
+  {   33, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_4_WERT", "min" },
+  {   34, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_5_WERT", "min" },
+  {   35, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_REAL_LADEZEIT_1_WERT", "min" },
+  {   36, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_REAL_LADEZEIT_2_WERT", "min" },
+  {   37, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_REAL_LADEZEIT_3_WERT", "min" },
+  {   38, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_REAL_LADEZEIT_4_WERT", "min" },
+  {   39, BMW_UDS_UCHAR , 0              , 5.0f, 0.0f, "STAT_REAL_LADEZEIT_5_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RELATIVZEIT_1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RELATIVZEIT_2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RELATIVZEIT_3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RELATIVZEIT_4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RELATIVZEIT_5_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_PROG_LADEZEIT[] = {   // 0xDDEC
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_1_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_2_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_3_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_4_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_5_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_6_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_7_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_SPANNUNG_QUER[] = {   // 0xDDEF
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HV_SPANNUNG_QUER_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ALPHA_INITIAL_ALTERUNG[] = {   // 0xDE37
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_ALPHA_INIT_ALTERUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_BETRIEBSSTUNDEN[] = {   // 0xDF60
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TIME_HV_ON_WERT", "h" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TIME_TOTAL_WERT", "h" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_COOL_DOWN[] = {   // 0xDF62
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_KUEHLVORGAENGE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KLEMMENZYKLEN[] = {   // 0xDF63
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_KLEMMENZYKLEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KUEHLDAUER[] = {   // 0xDF64
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_MAX_WERT_0XDF64", "min" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_1_WERT_0XDF64", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_2_WERT_0XDF64", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_3_WERT_0XDF64", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_KUEHLDAUER_4_WERT_0XDF64", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_TEMP_SPREIZUNG_SYSTEM[] = {   // 0xDF65
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_TEMP_SPREIZUNG_MAX_WERT", "°C" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_1_WERT", "min" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_2_WERT", "min" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_3_WERT", "min" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_4_WERT", "min" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_5_WERT", "min" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_6_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_TEMP_KUEHLMITTEL[] = {   // 0xDF66
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_TEMP_KUEHLMITTEL_MAX_WERT", "°C" },
+  {    2, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_1_WERT", "min" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_2_WERT", "min" },
+  {   10, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_3_WERT", "min" },
+  {   14, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_4_WERT", "min" },
+  {   18, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_5_WERT", "min" },
+  {   22, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_6_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADUNG_KUEHLUNG[] = {   // 0xDF67
+  {    0, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_LADUNG_KUEHLUNG_WERT", "Ah" },
+  {    4, BMW_UDS_UINT32, 0              , 0.000277777778f, 0.0f, "STAT_ENTLADUNG_KUEHLUNG_WERT", "Ah" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T1_2[] = {   // 0xDF68
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T4_2[] = {   // 0xDF69
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T3_2[] = {   // 0xDF6A
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T5_2[] = {   // 0xDF6B
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T2_2[] = {   // 0xDF6C
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T7_2[] = {   // 0xDF6D
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HV_BATT_HIST_SOC_T6_2[] = {   // 0xDF6E
+  {    0, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I1_WERT", "s" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I2_WERT", "s" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I3_WERT", "s" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I4_WERT", "s" },
+  {   16, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I5_WERT", "s" },
+  {   20, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I6_WERT", "s" },
+  {   24, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I7_WERT", "s" },
+  {   28, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I8_WERT", "s" },
+  {   32, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I9_WERT", "s" },
+  {   36, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I10_WERT", "s" },
+  {   40, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I1_WERT", "s" },
+  {   44, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I2_WERT", "s" },
+  {   48, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I3_WERT", "s" },
+  {   52, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I4_WERT", "s" },
+  {   56, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I5_WERT", "s" },
+  {   60, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I6_WERT", "s" },
+  {   64, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I7_WERT", "s" },
+  {   68, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I8_WERT", "s" },
+  {   72, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I9_WERT", "s" },
+  {   76, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I10_WERT", "s" },
+  {   80, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I1_WERT", "s" },
+  {   84, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I2_WERT", "s" },
+  {   88, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I3_WERT", "s" },
+  {   92, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I4_WERT", "s" },
+  {   96, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I5_WERT", "s" },
+  {  100, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I6_WERT", "s" },
+  {  104, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I7_WERT", "s" },
+  {  108, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I8_WERT", "s" },
+  {  112, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I9_WERT", "s" },
+  {  116, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I10_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_STROM[] = {   // 0xDF6F
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_WERT", "As" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_WERT", "As" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM[] = {   // 0xDF70
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_PROJEKT_PARAMETER[] = {   // 0xDF71
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_ZELLEN_INSGESAMT_WERT", "" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT", "" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_MODULE_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KURZSCHLUESSE[] = {   // 0xDF72
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_KURZSCHLUESSE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HEIZUNG_VERBAUT[] = {   // 0xDF73
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HEIZUNG_VERBAUT", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_VOKO_HEIZ_DAUER[] = {   // 0xDF74
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_MAX_WERT", "min" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_1_WERT", "" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_2_WERT", "" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_3_WERT", "" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_4_WERT", "" },
+  {   17, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_5_WERT", "" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADE_KOND_HEIZ_DAUER[] = {   // 0xDF75
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_MAX_WERT", "min" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_1_WERT", "" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_2_WERT", "" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_3_WERT", "" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_4_WERT", "" },
+  {   12, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_5_WERT", "" },
+  {   14, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_VOKO_KUEHL_DAUER[] = {   // 0xDF76
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_MAX_WERT", "min" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_1_WERT", "" },
+  {    5, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_2_WERT", "" },
+  {    9, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_3_WERT", "" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_4_WERT", "" },
+  {   17, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_5_WERT", "" },
+  {   21, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADE_DAUER[] = {   // 0xDF77
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_LADE_DAUER_MAX_WERT", "h" },
+  {    1, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_1_WERT", "" },
+  {    3, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_2_WERT", "" },
+  {    5, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_3_WERT", "" },
+  {    7, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_4_WERT", "" },
+  {    9, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_5_WERT", "" },
+  {   11, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LADEDAUER_6_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_SOC_WARN_GRENZEN[] = {   // 0xDF81
+  {    0, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_SOC_LOW_I_ZERO_WERT", "%" },
+  {    2, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_SOC_LOW_WARN_WERT", "%" },
+  {    4, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_SOC_HIGH_I_ZERO_WERT", "%" },
+  {    6, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_SOC_HIGH_WARN_WERT", "%" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_1_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_2_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_3_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_4_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_5_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ID_SBOX[] = {   // 0xDF83
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ID_SER_NR_WERT", "" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ID_MV_HW_WERT", "" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ID_MV_SW_WERT", "" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ID_SV_SW_WERT", "" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ID_VAR_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SOC_HISTORIE[] = {   // 0xDF86
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_1_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_2_WERT", "%" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_3_WERT", "%" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_4_WERT", "%" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_5_WERT", "%" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_6_WERT", "%" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_DAY_7_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_WEEK_2_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_WEEK_3_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_WEEK_4_WERT", "%" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_LAST_HV_ON_WERT", "h" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_LAST_DRIVE_CYCLE_WERT", "%" },
+  {   13, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TIME_STAMP_LAST_CHG_END_WERT", "h" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KL30C[] = {   // 0xDF89
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KL30C", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM_TMIN[] = {   // 0xDF8A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMIN_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMIN_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMIN_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMIN_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMIN_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMIN_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMIN_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMIN_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMIN_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMIN_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMIN_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMIN_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM_TLOW[] = {   // 0xDF8B
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TLOW_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TLOW_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TLOW_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TLOW_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TLOW_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TLOW_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TLOW_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TLOW_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TLOW_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TLOW_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TLOW_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TLOW_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM_TMID[] = {   // 0xDF8C
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMID_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMID_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMID_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMID_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMID_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMID_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMID_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMID_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMID_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMID_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMID_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMID_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM_THIGH[] = {   // 0xDF8D
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_THIGH_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_THIGH_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_THIGH_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_THIGH_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_THIGH_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_THIGH_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_THIGH_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_THIGH_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_THIGH_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_THIGH_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_THIGH_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_THIGH_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_EFF_STROM_TMAX[] = {   // 0xDF8E
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMAX_WERT", "A" },
+  {    4, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMAX_WERT", "A" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMAX_WERT", "A" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMAX_WERT", "A" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMAX_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMAX_WERT", "min" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMAX_WERT", "min" },
+  {   28, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMAX_WERT", "min" },
+  {   32, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMAX_WERT", "min" },
+  {   36, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMAX_WERT", "min" },
+  {   40, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMAX_WERT", "min" },
+  {   44, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMAX_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_STROM_TMIN[] = {   // 0xDF8F
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TMIN_WERT", "As" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TMIN_WERT", "As" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TMIN_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TMIN_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TMIN_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TMIN_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_STROM_TLOW[] = {   // 0xDF90
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TLOW_WERT", "As" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TLOW_WERT", "As" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TLOW_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TLOW_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TLOW_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TLOW_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_STROM_THIGH[] = {   // 0xDF91
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_THIGH_WERT", "As" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_THIGH_WERT", "As" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_THIGH_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_THIGH_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_THIGH_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_THIGH_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_STROM_TMAX[] = {   // 0xDF92
+  {    0, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TMAX_WERT", "As" },
+  {    4, BMW_UDS_UINT32, 0              , 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TMAX_WERT", "As" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TMAX_WERT", "min" },
+  {   12, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TMAX_WERT", "min" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TMAX_WERT", "min" },
+  {   20, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TMAX_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_LADEZEIT_ADAPT_KENNFELD_LESEN[] = {   // 0xDF9C
+  {    0, BMW_UDS_UCHAR , 0              , 200.0f, 0.0f, "STAT_PWR_STUETZP_P1_WERT", "W" },
+  {    1, BMW_UDS_UCHAR , 0              , 200.0f, 0.0f, "STAT_PWR_STUETZP_P2_WERT", "W" },
+  {    2, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_STUETZP_T1_WERT", "°C" },
+  {    3, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_STUETZP_T2_WERT", "°C" },
+  {    4, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_STUETZP_T3_WERT", "°C" },
+  {    5, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_STUETZP_T4_WERT", "°C" },
+  {    6, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC1_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC2_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC3_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC4_WERT", "%" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC5_WERT", "%" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC1_WERT", "%" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC2_WERT", "%" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC3_WERT", "%" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC4_WERT", "%" },
+  {   15, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC5_WERT", "%" },
+  {   16, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC1_WERT", "%" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC2_WERT", "%" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC3_WERT", "%" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC4_WERT", "%" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC5_WERT", "%" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC1_WERT", "%" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC2_WERT", "%" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC3_WERT", "%" },
+  {   24, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC4_WERT", "%" },
+  {   25, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC5_WERT", "%" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC1_WERT", "%" },
+  {   27, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC2_WERT", "%" },
+  {   28, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC3_WERT", "%" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC4_WERT", "%" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC5_WERT", "%" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC1_WERT", "%" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC2_WERT", "%" },
+  {   33, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC3_WERT", "%" },
+  {   34, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC4_WERT", "%" },
+  {   35, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC5_WERT", "%" },
+  {   36, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC1_WERT", "%" },
+  {   37, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC2_WERT", "%" },
+  {   38, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC3_WERT", "%" },
+  {   39, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC4_WERT", "%" },
+  {   40, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC5_WERT", "%" },
+  {   41, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC1_WERT", "%" },
+  {   42, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC2_WERT", "%" },
+  {   43, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC3_WERT", "%" },
+  {   44, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC4_WERT", "%" },
+  {   45, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC5_WERT", "%" },
+  {   46, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC1_WERT", "%" },
+  {   47, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC2_WERT", "%" },
+  {   48, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC3_WERT", "%" },
+  {   49, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC4_WERT", "%" },
+  {   50, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC5_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_VERH_VOLLADE_LADEVORG_LESEN[] = {   // 0xDF9E
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_VERH_VOLLADE_LADEVORG_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ZUSTAND_SPEICHER[] = {   // 0xDFA0
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MIN_WERT", "Ah" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MAX_WERT", "Ah" },
+  {    4, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MEAN_WERT", "Ah" },
+  {    6, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MIN_WERT", "V" },
+  {    8, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MAX_WERT", "V" },
+  {   10, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MEAN_WERT", "V" },
+  {   12, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MIN_WERT", "°C" },
+  {   14, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MAX_WERT", "°C" },
+  {   16, BMW_UDS_SINT  , 0              , 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MEAN_WERT", "°C" },
+  {   18, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT", "" },
+  {   20, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT", "" },
+  {   22, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT", "" },
+  {   24, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLSOC_MIN_WERT", "%" },
+  {   26, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLSOC_MAX_WERT", "%" },
+  {   28, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ZELLSOC_MEAN_WERT", "%" },
+  {   30, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLOCV_MIN_WERT", "V" },
+  {   32, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLOCV_MAX_WERT", "V" },
+  {   34, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_ZELLOCV_MEAN_WERT", "V" },
+  {   36, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_ERR_LIM_SPANNUNG[] = {   // 0xDFA1
+  {    0, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_OVER_VOLT_INT_LIM_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 0.001f, 0.0f, "STAT_UNDER_VOLT_INT_LIM_WERT", "" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_1_WERT", "min" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_2_WERT", "min" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_1_WERT", "min" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_2_WERT", "min" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HIS_SOC_MAX_MIN[] = {   // 0xDFAE
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_MIN_NENN_MAX_WERT", "%" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_SOC_MIN_NENN_MIN_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_STATUS_HV_SPEICHER_ID[] = {   // 0xDFE1
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SP_ID_00", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_SP_ID_01_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_SYMMETRIERBAND[] = {   // 0xDFE2
+  {    0, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_SOC_LAST_BALANCING_WERT", "%" },
+  {    1, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_TIME_LAST_BALANCING_WERT", "s" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_DIFFERENCE_VOLTAGE_LAST_BALANCING_WERT", "mV" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_1_WERT", "%" },
+  {    7, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_2_WERT", "%" },
+  {    8, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_3_WERT", "%" },
+  {    9, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_4_WERT", "%" },
+  {   10, BMW_UDS_UCHAR , 0              , 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_5_WERT", "%" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_GW_INFO_SCHNELLLADEN[] = {   // 0xE50D
+  {    0, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_HIGH_WERT", "%" },
+  {    2, BMW_UDS_UINT  , 0              , 0.01f, 0.0f, "STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_LOW_WERT", "%" },
+  {    4, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_HIGH_WERT", "kWh" },
+  {    8, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_LOW_WERT", "kWh" },
+  {   12, BMW_UDS_UINT32, 0              , 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_GESAMT_WERT", "kWh" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_CODIERVARIABLEN_HV_SPEICHER[] = {   // 0xE540
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COOL_VALVE_PRESENT_WERT", "HEX" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COUNTRY_CODE_WERT", "HEX" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COD_FUNKTION_SWITCH_WERT", "HEX" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_COD_STATSP_WERT", "HEX" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_ANZAHL_DEFEKTE_SICHERUNG[] = {   // 0xE5F1
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ANZAHL_DEFEKTE_SICHERUNG_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_HVOFF_VOLTAGES[] = {   // 0xE5F2
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_RB1_WERT", "" },
+  {    1, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_1_WERT", "V" },
+  {    3, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_2_WERT", "V" },
+  {    5, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_3_WERT", "V" },
+  {    7, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_4_WERT", "V" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_1_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_2_WERT", "" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_3_WERT", "" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_4_WERT", "" },
+  {   13, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_1_WERT", "V" },
+  {   15, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_2_WERT", "V" },
+  {   17, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_3_WERT", "V" },
+  {   19, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_4_WERT", "V" },
+  {   21, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_1_WERT", "V" },
+  {   23, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_2_WERT", "V" },
+  {   25, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_3_WERT", "V" },
+  {   27, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_4_WERT", "V" },
+  {   29, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_1_WERT", "" },
+  {   30, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_2_WERT", "" },
+  {   31, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_3_WERT", "" },
+  {   32, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_4_WERT", "" },
+  {   33, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_1_WERT", "V" },
+  {   35, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_2_WERT", "V" },
+  {   37, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_3_WERT", "V" },
+  {   39, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_4_WERT", "V" },
+  {   41, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_1_WERT", "s" },
+  {   45, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_2_WERT", "s" },
+  {   49, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_3_WERT", "s" },
+  {   53, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_4_WERT", "s" },
+  {   57, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_1", "0/1" },
+  {   58, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_2", "0/1" },
+  {   59, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_3", "0/1" },
+  {   60, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_4", "0/1" },
+  {   61, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_1", "0-n" },
+  {   62, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_2", "0-n" },
+  {   63, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_3", "0-n" },
+  {   64, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_4", "0-n" },
+  {   65, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_1_WERT", "°C" },
+  {   66, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_2_WERT", "°C" },
+  {   67, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_3_WERT", "°C" },
+  {   68, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_4_WERT", "°C" },
+  {   69, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_RB2_WERT", "" },
+  {   70, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_1_WERT", "V" },
+  {   72, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_2_WERT", "V" },
+  {   74, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_3_WERT", "V" },
+  {   76, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_4_WERT", "V" },
+  {   78, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_1_WERT", "" },
+  {   79, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_2_WERT", "" },
+  {   80, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_3_WERT", "" },
+  {   81, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_4_WERT", "" },
+  {   82, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_1_WERT", "V" },
+  {   84, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_2_WERT", "V" },
+  {   86, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_3_WERT", "V" },
+  {   88, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_4_WERT", "V" },
+  {   90, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_1_WERT", "V" },
+  {   92, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_2_WERT", "V" },
+  {   94, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_3_WERT", "V" },
+  {   96, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_4_WERT", "V" },
+  {   98, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_1_WERT", "" },
+  {   99, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_2_WERT", "" },
+  {  100, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_3_WERT", "" },
+  {  101, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_4_WERT", "" },
+  {  102, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_1_WERT", "V" },
+  {  104, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_2_WERT", "V" },
+  {  106, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_3_WERT", "V" },
+  {  108, BMW_UDS_UINT  , 0              , 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_4_WERT", "V" },
+  {  110, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_1_WERT", "s" },
+  {  114, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_2_WERT", "s" },
+  {  118, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_3_WERT", "s" },
+  {  122, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_4_WERT", "s" },
+  {  126, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_1", "0/1" },
+  {  127, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_2", "0/1" },
+  {  128, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_3", "0/1" },
+  {  129, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_4", "0/1" },
+  {  130, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_1", "0-n" },
+  {  131, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_2", "0-n" },
+  {  132, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_3", "0-n" },
+  {  133, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_4", "0-n" },
+  {  134, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_1_WERT", "°C" },
+  {  135, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_2_WERT", "°C" },
+  {  136, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_3_WERT", "°C" },
+  {  137, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_4_WERT", "°C" },
+  {  138, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_SCORE_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_RB_SOH_KAPATEST_ERW[] = {   // 0xE5F3
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_1_WERT", "°C" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_1_WERT", "°C" },
+  {    2, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_1_WERT", "°C" },
+  {    3, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_1_WERT", "°C" },
+  {    4, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_1_WERT", "°C" },
+  {    5, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_1_WERT", "°C" },
+  {    6, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_1_WERT", "kW" },
+  {    7, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_1_WERT", "A" },
+  {    8, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_1_WERT", "" },
+  {    9, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_2_WERT", "°C" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_2_WERT", "°C" },
+  {   11, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_2_WERT", "°C" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_2_WERT", "°C" },
+  {   13, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_2_WERT", "°C" },
+  {   14, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_2_WERT", "°C" },
+  {   15, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_2_WERT", "kW" },
+  {   16, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_2_WERT", "A" },
+  {   17, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_2_WERT", "" },
+  {   18, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_3_WERT", "°C" },
+  {   19, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_3_WERT", "°C" },
+  {   20, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_3_WERT", "°C" },
+  {   21, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_3_WERT", "°C" },
+  {   22, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_3_WERT", "°C" },
+  {   23, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_3_WERT", "°C" },
+  {   24, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_3_WERT", "kW" },
+  {   25, BMW_UDS_UCHAR , 0              , 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_3_WERT", "A" },
+  {   26, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_3_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_CPI_ANALYSE[] = {   // 0xE5F4
+  {    0, BMW_UDS_SINT  , 0              , 0.1f, 0.0f, "STAT_CPI_REL_TEMP_WERT", "%" },
+  {    2, BMW_UDS_SINT32, 0              , 0.001f, 0.0f, "STAT_CPI_TEMP_GRAD_WERT", "" },
+  {    6, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CPI_E_LOSS_WERT", "" },
+  {   10, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CPI_DIAGNOSE", "0-n" },
+  {   11, BMW_UDS_SCHAR , 0              , 1.0f, 0.0f, "STAT_CPI_TEMP_UMGEBUNG_WERT", "°C" },
+  {   12, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_CPI_FRT_AC", "0-n" },
+  {   13, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_CPI_LIFE_TIME_WERT", "s" },
+  {   17, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_CPI_OK_WERT", "" },
+  {   19, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_CPI_FAILED_WERT", "" },
+  {   21, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ANZAHL_CPI_ABGEBROCHEN_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL[] = {   // 0xE5FA
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAPATEST_ASYM_ZELLE_ID_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_KAPATEST_ASYM_MOD_ID_WERT", "" },
+  {    2, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_KAPATEST_ASYM_POT_WERT", "%" },
+  };
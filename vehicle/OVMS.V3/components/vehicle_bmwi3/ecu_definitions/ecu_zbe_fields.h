@@ -0,0 +1,129 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/zbe6.json: ZBE 67: iDrive controller
+// This generated code  makes it easier to process CANBUS messages from the ZBE ecu in a BMW i3
+//
+
+#include "../src/bmw_uds_decoder.h"
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_PROGRAMMING_COUNTER[] = {   // 0x2502
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_RESERVE_WERT", "" },
+  {    1, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_PROG_ZAEHLER_STATUS", "0-n" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PROG_ZAEHLER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_PROGRAMMING_COUNTER_MAX_VALUE[] = {   // 0x2503
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_PROG_MAX_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_FLASH_TIMING_PARAMETER[] = {   // 0x2504
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_ERASE_MEMORY_TIME_WERT", "s" },
+  {    2, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_CHECK_MEMORY_TIME_WERT", "s" },
+  {    4, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_BOOTLOADER_INSTALLATION_TIME_WERT", "s" },
+  {    6, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_AUTHENTICATION_TIME_WERT", "s" },
+  {    8, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_RESET_TIME_WERT", "s" },
+  {   10, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_TRANSFER_DATA_TIME_WERT", "s" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_VARIANTE_ZBE[] = {   // 0xD137
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ZBE_VARIANTE_NR", "0-n" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_SCHRITTE_ROTRAD[] = {   // 0xD14E
+  {    0, BMW_UDS_UINT  , 0              , 1.0f, 0.0f, "STAT_REGISTER_ROTRAD_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE1[] = {   // 0xD213
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE2[] = {   // 0xD214
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD214", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD214", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD214", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE3[] = {   // 0xD215
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD215", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD215", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD215", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE4[] = {   // 0xD216
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD216", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD216", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD216", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE5[] = {   // 0xD217
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD217", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD217", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD217", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE6[] = {   // 0xD218
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD218", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD218", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD218", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE7[] = {   // 0xD219
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD219", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD219", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD219", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_TASTE8[] = {   // 0xD21A
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21A", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21A", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21A", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_DREHSTELLER[] = {   // 0xD21B
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RASTEN_IM_UHRZEIGERSINN_WERT", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_RASTEN_GEGEN_UHRZEIGERSINN_WERT", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_UNDERFLOW_WERT", "" },
+  {   24, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_OVERFLOW_WERT", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_DREHSTELLER_NORD[] = {   // 0xD21C
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21C", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21C", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21C", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_DREHSTELLER_OST[] = {   // 0xD21D
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21D", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21D", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21D", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_DREHSTELLER_SUED[] = {   // 0xD21E
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21E", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21E", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21E", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_LOGGING_DREHSTELLER_WEST[] = {   // 0xD21F
+  {    0, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21F", "" },
+  {    8, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21F", "" },
+  {   16, BMW_UDS_UINT32, 0              , 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21F", "" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_TOUCHPAD_BERUEHRUNG[] = {   // 0xD60D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TOUCHPAD_BERUEHRUNG", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_TOUCHPAD_ANNAEHERUNG[] = {   // 0xD68D
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_TOUCHPAD_ANNAEHERUNG", "0/1" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_SPANNUNG_KLEMME_30B_WERT[] = {   // 0xDAD9
+  {    0, BMW_UDS_UINT  , 0              , 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_WERT", "V" },
+  };
+
+static const bmw_uds_field_t I3_FIELDS_ZBE_ACTIVE_DIAGNOSTIC_SESSION[] = {   // 0xF186
+  {    0, BMW_UDS_UCHAR , 0              , 1.0f, 0.0f, "STAT_ACTIVE_DIAGNOSTIC_SESSION", "0-n" },
+  };
@@ -0,0 +1,142 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    BMW I3 / Mini SE component:
+;    Generic decoder for the UDS result field tables generated by
+;    tools/generate_ecu_code.pl (ecu_definitions/ecu_*_fields.h).
+;    Shared by the BMW i3 and Mini Cooper SE vehicle modules.
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __BMW_UDS_DECODER_H__
+#define __BMW_UDS_DECODER_H__
+
+#include <stdint.h>
+#include <string>
+#include "esp_system.h"
+#include "ovms_log.h"
+
+// Field types, named like the RXBUF_ access macros
+typedef enum : uint8_t
+  {
+  BMW_UDS_UCHAR = 0,
+  BMW_UDS_SCHAR,
+  BMW_UDS_UINT,
+  BMW_UDS_SINT,
+  BMW_UDS_UINT32,
+  BMW_UDS_SINT32,
+  } bmw_uds_type_t;
+
+// Field flags
+#define BMW_UDS_BITFIELD      0x01      // Log as hex bit mask
+
+// One result field of a UDS reply: value = raw * scale + add
+typedef struct
+  {
+  uint16_t offset;                      // Byte offset in the reply data
+  uint8_t type;                         // bmw_uds_type_t
+  uint8_t flags;                        // BMW_UDS_BITFIELD
+  float scale;
+  float add;
+  const char *name;
+  const char *unit;
+  } bmw_uds_field_t;
+
+inline size_t BmwUdsFieldSize(const bmw_uds_field_t &field)
+  {
+  switch (field.type)
+    {
+    case BMW_UDS_UINT:
+    case BMW_UDS_SINT:
+      return 2;
+    case BMW_UDS_UINT32:
+    case BMW_UDS_SINT32:
+      return 4;
+    default:
+      return 1;
+    }
+  }
+
+/**
+ * BmwUdsFieldRaw: read the unscaled field value (big endian), sign extended for signed types
+ */
+inline int64_t BmwUdsFieldRaw(const bmw_uds_field_t &field, const std::string &rxbuf)
+  {
+  const uint8_t *p = (const uint8_t*) rxbuf.data() + field.offset;
+  switch (field.type)
+    {
+    case BMW_UDS_SCHAR:
+      return (int8_t) p[0];
+    case BMW_UDS_UINT:
+      return (uint16_t) (p[0] << 8 | p[1]);
+    case BMW_UDS_SINT:
+      return (int16_t) (p[0] << 8 | p[1]);
+    case BMW_UDS_UINT32:
+      return (uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 | p[3];
+    case BMW_UDS_SINT32:
+      return (int32_t) ((uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 | p[3]);
+    default:
+      return p[0];
+    }
+  }
+
+/**
+ * BmwUdsFieldValue: read the scaled field value
+ */
+inline float BmwUdsFieldValue(const bmw_uds_field_t &field, const std::string &rxbuf)
+  {
+  return BmwUdsFieldRaw(field, rxbuf) * field.scale + field.add;
+  }
+
+/**
+ * BmwUdsLogFields: log all fields of a reply present in rxbuf (debug level)
+ *  The level is checked at runtime like for ESP_LOGD. IDF 3.x cannot query
+ *  the tag level, esp_log_write() then filters each line.
+ */
+inline void BmwUdsLogFields(const char *tag, const char *ecu, const char *pid,
+  const bmw_uds_field_t *fields, size_t count, const std::string &rxbuf)
+  {
+#if ESP_IDF_VERSION_MAJOR >= 5
+  if (esp_log_level_get(tag) < ESP_LOG_DEBUG)
+    return;
+#endif
+  for (size_t i = 0; i < count; i++)
+    {
+    const bmw_uds_field_t &field = fields[i];
+    if (field.offset + BmwUdsFieldSize(field) > rxbuf.size())
+      break;
+    if (field.flags & BMW_UDS_BITFIELD)
+      ESP_LOGD(tag, "From ECU %s, pid %s: got %s=%lx%s", ecu, pid, field.name,
+        (unsigned long) BmwUdsFieldRaw(field, rxbuf), field.unit);
+    else if (field.scale == 1.0f && field.add == 0.0f)
+      ESP_LOGD(tag, "From ECU %s, pid %s: got %s=%ld%s", ecu, pid, field.name,
+        (long) BmwUdsFieldRaw(field, rxbuf), field.unit);
+    else
+      ESP_LOGD(tag, "From ECU %s, pid %s: got %s=%.4f%s", ecu, pid, field.name,
+        BmwUdsFieldValue(field, rxbuf), field.unit);
+    }
+  }
+
+// BMW_UDS_LOGD: log a reply by its generated field table, e.g.
+//    BMW_UDS_LOGD(TAG, "SME", "ANZEIGE_SOC", I3_FIELDS_SME_ANZEIGE_SOC, rxbuf);
+#define BMW_UDS_LOGD(tag, ecu, pid, fields, rxbuf) \
+  BmwUdsLogFields(tag, ecu, pid, fields, sizeof(fields) / sizeof(fields[0]), rxbuf)
+
+#endif //#ifndef __BMW_UDS_DECODER_H__
@@ -75,11 +75,13 @@ our $usedresultnames = {};
 
 open (CODE, ">&=3") || die "Can't fdopen 3";
 open (POLLLIST, ">&=4") || die "Can't fdopen 4";
+open (FIELDS, ">&=5") || die "Can't fdopen 5";
 
 binmode(STDOUT, ":utf8");
 binmode(STDERR, ":utf8");
 binmode(CODE, ":utf8");
 binmode(POLLLIST, ":utf8");
+binmode(FIELDS, ":utf8");
 
 # Read ECU definition json as created by parseecu.pl
 my $tables;
@@ -96,7 +98,7 @@ our $ECUDESC = $tables->{'ovmsdesc'} || "ECU: $ECU";
 print STDERR "Generating OVMS config for ECU $ECU on id $ECUID: $ECUDESC\n";
 
 # Dump header
-foreach my $FD (*STDOUT, *CODE, *POLLLIST) {
+foreach my $FD (*STDOUT, *CODE, *POLLLIST, *FIELDS) {
     print $FD "
 //
 // Warning: don't edit - generated by generate_ecu_code.pl processing $ARGV[0]: $ECU $ECUID: $ECUDESC
@@ -104,6 +106,8 @@ foreach my $FD (*STDOUT, *CODE, *POLLLIST) {
 //";
 }
 
+print FIELDS "\n\n#include \"../src/bmw_uds_decoder.h\"";
+
 print "
 
 #define I3_ECU_${ECU}_TX                                                0x06F1${ECUID}
@@ -187,6 +191,7 @@ foreach my $function (@$functions) {
     if ($results) {
         my $offset = 0;
         my @codelines;
+        my @fieldlines;
         foreach my $result (@$results) {
             print "\n";
             print STDERR Dumper({result => $result}) if ($DEBUG);
@@ -253,6 +258,15 @@ foreach my $function (@$functions) {
                 }
                 $expr .= (($add > 0) ? '+' : '') . $add if ($add ne '-' && $add != 0);
                     $expr .= ')';
+
+                # field descriptor for the generic decoder (bmw_uds_decoder.h)
+                my $scale = 1;
+                $scale *= $mul if ($mul ne '-');
+                $scale /= $div if ($div ne '-' && $div != 0);
+                my $fadd = ($add ne '-') ? $add : 0;
+                push @fieldlines, sprintf("\n  { %4d, BMW_UDS_%-6s, %-15s, %sf, %sf, \"%s\", \"%s\" },",
+                    $offset, $types->{$datatype}, ($isbitfield ? 'BMW_UDS_BITFIELD' : '0'),
+                    float_literal($scale), float_literal($fadd), $resultname, (($unit && $unit ne '-') ? $unit : ''));
                 $offset += $sizes->{$datatype};
 
                 printf "\n    #define I3_RES_%s_%-45s %s", $ECU, $resultname, $expr;
@@ -280,6 +294,13 @@ foreach my $function (@$functions) {
         # code
         print CODE "\n    if (datalen < $offset) {\n        ESP_LOGW(TAG, \"Received %d bytes for %s, expected %d\", datalen, \"I3_PID_${ECU}_" . $functionname . "\", $offset);\n        break;\n    }";
         print CODE "\n" . join('', @codelines);
+
+        # field descriptors
+        if (scalar(@fieldlines)) {
+            print FIELDS "\n\nstatic const bmw_uds_field_t I3_FIELDS_${ECU}_${functionname}[] = {   // " . $function->{ID};
+            print FIELDS join('', @fieldlines);
+            print FIELDS "\n  };";
+        }
     }
 
     # code
@@ -295,9 +316,17 @@ foreach my $function (@$functions) {
 
 print "\n";
 print POLLLIST "\n";
+print FIELDS "\n";
 print CODE "\n";
 
 
+sub float_literal {
+    my ($v) = @_;
+    my $s = sprintf("%.9g", $v);
+    $s .= ".0" unless ($s =~ /[.eE]/);
+    return $s;
+}
+
 sub format_desc {
     my ($en, $de) = @_;
     
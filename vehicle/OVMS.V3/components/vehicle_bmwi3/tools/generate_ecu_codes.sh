@@ -31,19 +31,19 @@
 # 78 IHX    Integrated automatic heating / aircon - though its mainly the buttons I think)
 
 
-perl ./generate_ecu_code.pl ../dev/sme_i1.json >../ecu_definitions/ecu_sme_defines.h  3>../ecu_definitions/ecu_sme_code.cpp 4>../ecu_definitions/ecu_sme_polls.cpp
-perl ./generate_ecu_code.pl ../dev/edmei1.json >../ecu_definitions/ecu_edm_defines.h  3>../ecu_definitions/ecu_edm_code.cpp 4>../ecu_definitions/ecu_edm_polls.cpp
-perl ./generate_ecu_code.pl ../dev/lim_i1.json >../ecu_definitions/ecu_lim_defines.h  3>../ecu_definitions/ecu_lim_code.cpp 4>../ecu_definitions/ecu_lim_polls.cpp
-perl ./generate_ecu_code.pl ../dev/ucx2_i01.json >../ecu_definitions/ecu_kle_defines.h  3>../ecu_definitions/ecu_kle_code.cpp 4>../ecu_definitions/ecu_kle_polls.cpp
-perl ./generate_ecu_code.pl ../dev/eme_i01.json >../ecu_definitions/ecu_eme_defines.h  3>../ecu_definitions/ecu_eme_code.cpp 4>../ecu_definitions/ecu_eme_polls.cpp
-perl ./generate_ecu_code.pl ../dev/sas_i1.json >../ecu_definitions/ecu_sas_defines.h  3>../ecu_definitions/ecu_sas_code.cpp 4>../ecu_definitions/ecu_sas_polls.cpp
-perl ./generate_ecu_code.pl ../dev/dsc_i1.json >../ecu_definitions/ecu_dsc_defines.h  3>../ecu_definitions/ecu_dsc_code.cpp 4>../ecu_definitions/ecu_dsc_polls.cpp
-perl ./generate_ecu_code.pl ../dev/bdc.json >../ecu_definitions/ecu_bdc_defines.h  3>../ecu_definitions/ecu_bdc_code.cpp 4>../ecu_definitions/ecu_bdc_polls.cpp
-perl ./generate_ecu_code.pl ../dev/fzd_f15.json >../ecu_definitions/ecu_fzd_defines.h  3>../ecu_definitions/ecu_fzd_code.cpp 4>../ecu_definitions/ecu_fzd_polls.cpp
-perl ./generate_ecu_code.pl ../dev/kafas20.json >../ecu_definitions/ecu_kaf_defines.h  3>../ecu_definitions/ecu_kaf_code.cpp 4>../ecu_definitions/ecu_kaf_polls.cpp
-perl ./generate_ecu_code.pl ../dev/komb25.json >../ecu_definitions/ecu_kom_defines.h  3>../ecu_definitions/ecu_kom_code.cpp 4>../ecu_definitions/ecu_kom_polls.cpp
-perl ./generate_ecu_code.pl ../dev/nbtevo.json >../ecu_definitions/ecu_nbt_defines.h  3>../ecu_definitions/ecu_nbt_code.cpp 4>../ecu_definitions/ecu_nbt_polls.cpp
-perl ./generate_ecu_code.pl ../dev/zbe6.json >../ecu_definitions/ecu_zbe_defines.h  3>../ecu_definitions/ecu_zbe_code.cpp 4>../ecu_definitions/ecu_zbe_polls.cpp
-perl ./generate_ecu_code.pl ../dev/ihx_i1.json >../ecu_definitions/ecu_ihx_defines.h  3>../ecu_definitions/ecu_ihx_code.cpp 4>../ecu_definitions/ecu_ihx_polls.cpp
-perl ./generate_ecu_code.pl ../dev/eps_i1.json >../ecu_definitions/ecu_eps_defines.h  3>../ecu_definitions/ecu_eps_code.cpp 4>../ecu_definitions/ecu_eps_polls.cpp
+perl ./generate_ecu_code.pl ../dev/sme_i1.json >../ecu_definitions/ecu_sme_defines.h  3>../ecu_definitions/ecu_sme_code.cpp 4>../ecu_definitions/ecu_sme_polls.cpp 5>../ecu_definitions/ecu_sme_fields.h
+perl ./generate_ecu_code.pl ../dev/edmei1.json >../ecu_definitions/ecu_edm_defines.h  3>../ecu_definitions/ecu_edm_code.cpp 4>../ecu_definitions/ecu_edm_polls.cpp 5>../ecu_definitions/ecu_edm_fields.h
+perl ./generate_ecu_code.pl ../dev/lim_i1.json >../ecu_definitions/ecu_lim_defines.h  3>../ecu_definitions/ecu_lim_code.cpp 4>../ecu_definitions/ecu_lim_polls.cpp 5>../ecu_definitions/ecu_lim_fields.h
+perl ./generate_ecu_code.pl ../dev/ucx2_i01.json >../ecu_definitions/ecu_kle_defines.h  3>../ecu_definitions/ecu_kle_code.cpp 4>../ecu_definitions/ecu_kle_polls.cpp 5>../ecu_definitions/ecu_kle_fields.h
+perl ./generate_ecu_code.pl ../dev/eme_i01.json >../ecu_definitions/ecu_eme_defines.h  3>../ecu_definitions/ecu_eme_code.cpp 4>../ecu_definitions/ecu_eme_polls.cpp 5>../ecu_definitions/ecu_eme_fields.h
+perl ./generate_ecu_code.pl ../dev/sas_i1.json >../ecu_definitions/ecu_sas_defines.h  3>../ecu_definitions/ecu_sas_code.cpp 4>../ecu_definitions/ecu_sas_polls.cpp 5>../ecu_definitions/ecu_sas_fields.h
+perl ./generate_ecu_code.pl ../dev/dsc_i1.json >../ecu_definitions/ecu_dsc_defines.h  3>../ecu_definitions/ecu_dsc_code.cpp 4>../ecu_definitions/ecu_dsc_polls.cpp 5>../ecu_definitions/ecu_dsc_fields.h
+perl ./generate_ecu_code.pl ../dev/bdc.json >../ecu_definitions/ecu_bdc_defines.h  3>../ecu_definitions/ecu_bdc_code.cpp 4>../ecu_definitions/ecu_bdc_polls.cpp 5>../ecu_definitions/ecu_bdc_fields.h
+perl ./generate_ecu_code.pl ../dev/fzd_f15.json >../ecu_definitions/ecu_fzd_defines.h  3>../ecu_definitions/ecu_fzd_code.cpp 4>../ecu_definitions/ecu_fzd_polls.cpp 5>../ecu_definitions/ecu_fzd_fields.h
+perl ./generate_ecu_code.pl ../dev/kafas20.json >../ecu_definitions/ecu_kaf_defines.h  3>../ecu_definitions/ecu_kaf_code.cpp 4>../ecu_definitions/ecu_kaf_polls.cpp 5>../ecu_definitions/ecu_kaf_fields.h
+perl ./generate_ecu_code.pl ../dev/komb25.json >../ecu_definitions/ecu_kom_defines.h  3>../ecu_definitions/ecu_kom_code.cpp 4>../ecu_definitions/ecu_kom_polls.cpp 5>../ecu_definitions/ecu_kom_fields.h
+perl ./generate_ecu_code.pl ../dev/nbtevo.json >../ecu_definitions/ecu_nbt_defines.h  3>../ecu_definitions/ecu_nbt_code.cpp 4>../ecu_definitions/ecu_nbt_polls.cpp 5>../ecu_definitions/ecu_nbt_fields.h
+perl ./generate_ecu_code.pl ../dev/zbe6.json >../ecu_definitions/ecu_zbe_defines.h  3>../ecu_definitions/ecu_zbe_code.cpp 4>../ecu_definitions/ecu_zbe_polls.cpp 5>../ecu_definitions/ecu_zbe_fields.h
+perl ./generate_ecu_code.pl ../dev/ihx_i1.json >../ecu_definitions/ecu_ihx_defines.h  3>../ecu_definitions/ecu_ihx_code.cpp 4>../ecu_definitions/ecu_ihx_polls.cpp 5>../ecu_definitions/ecu_ihx_fields.h
+perl ./generate_ecu_code.pl ../dev/eps_i1.json >../ecu_definitions/ecu_eps_defines.h  3>../ecu_definitions/ecu_eps_code.cpp 4>../ecu_definitions/ecu_eps_polls.cpp 5>../ecu_definitions/ecu_eps_fields.h
 
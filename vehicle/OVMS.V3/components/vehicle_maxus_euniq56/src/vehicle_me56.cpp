@@ -131,6 +131,12 @@ OvmsVehicleMaxe56::OvmsVehicleMaxe56()
         // Init CAN:
         RegisterCanBus(1,CAN_MODE_ACTIVE,CAN_SPEED_500KBPS);
 
+        // Frames processed by IncomingFrameCan1() (for hardware filtering):
+        AddCanAcceptance(1, 0x389, 0x389);
+        AddCanAcceptance(1, 0x540, 0x540);
+        AddCanAcceptance(1, 0x604, 0x604);
+        AddCanAcceptance(1, 0x6f2, 0x6f2);
+
         // Init BMS:
         BmsSetCellArrangementVoltage(96, 16);
         BmsSetCellArrangementTemperature(16, 1);
@@ -1,10 +0,0 @@
-
-
-// VIN:
-
-
-#define I3_PID_BDC_VIN                               0xF190
-        // Returns the VIN - 17 byte string response
-
-// POLL line
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VIN,                  {  0,300,300,300 }, 0, ISOTP_EXTADR },   // 0xF190
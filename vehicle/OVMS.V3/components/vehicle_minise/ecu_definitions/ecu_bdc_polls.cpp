@@ -1,244 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/bdc.json: BDC 40: Body domain controller
-// This generated code  makes it easier to process CANBUS messages from the BDC ecu in a BMW i3
-//
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PIA_NR_AKTUELL,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x0F27
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOD_KALIBRIERUNG,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA093
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BATTERIEVORSCHAEDIGUNGSHISTORIE,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA099
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_LIN_EINLERNVORGANG,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA118
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_SELBSTTEST,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA322
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_REGENSENSOR_INITIALISIERUNG,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA3B7
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LEUCHTEN_KALTUEBERWACHUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA530
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LEUCHTEN_WARMUEBERWACHUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA531
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOEHENSTAENDE_OFFSET_RESET,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA532
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_GURTZUBRINGER_INIT,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA71A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LIN_AUTOADRESSIERUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA838
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ELV_ANLIEFERZUSTAND,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA73
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SMO_SIMULATION_BEDIENUNG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA80
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STEUERN_CA_BROADCAST,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAC54
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAC55
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STEUERN_FBD_EMPFAENGER_INIT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAC58
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FBD_REICHWEITENMESSUNG,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAC5D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FBD_FEHLER,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAC5E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ELSV_TASTER,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD070
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKRADHEIZUNG_TASTER,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD073
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ELSV_STATEMACHINE,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD07B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ELSV_VORHANDEN,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD07F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKRAD_MFL,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD081
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ELSV_POS_STATUS,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD089
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SMO_SPIELSCHUTZZAEHLER,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD096
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SMO_VARIANTE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD098
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PLOCK,                                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD09D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZUSATZINFO_LICHT,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0F1
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HANDBREMSE_KONTAKT,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD130
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_LINKS,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD161
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_RECHTS,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD162
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FA_TASTER,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD188
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BF_TASTER,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD189
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FAH_TASTER,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD18A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BFH_TASTER,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD18B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_KISI_LED,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD18D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FA_BEWEGUNG,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1A7
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BF_BEWEGUNG,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1A8
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FAH_BEWEGUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1A9
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BFH_BEWEGUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1AA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BFH_RELAIS,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1AD
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BFH_HALLSENSOREN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1AE
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FAH_RELAIS,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1AF
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FAH_HALLSENSOREN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B0
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FA_RELAIS,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B1
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FA_HALLSENSOREN,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B2
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BF_RELAIS,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B3
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BF_HALLSENSOREN,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B4
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FA_STATUS_DETAIL,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B5
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BF_STATUS_DETAIL,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B6
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_FAH_STATUS_DETAIL,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B7
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FH_BFH_STATUS_DETAIL,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B8
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_SITZEXT_TASTEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1CA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_SITZEXT_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1CB
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_TANK_FUELLSTAND_LINKS,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD258
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_TANK_FUELLSTAND_RECHTS,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD259
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HUPE_TASTER,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD297
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_THERMOSCHUTZ,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD321
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_LIN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD329
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_MEM_VORHANDEN,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD32B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_HEIZUNG_VERBAUT,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD32E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_EC_SPIEGEL_VORHANDEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD330
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_TASTER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD331
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_KLAPPEN_VORHANDEN,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD332
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_UGDO_VORHANDEN,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD33A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSENSPIEGEL_ABBLENDEN_VORHANDEN,        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD33C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_UGDO_LAND,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD33D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_UGDO_MODE,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD33E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KOMPASS_SPIEGEL_VORHANDEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD343
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KOMPASS_SPIEGEL_MAGNET,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD344
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KOMPASS_SPIEGEL_SPRACHE,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD345
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KOMPASS_SPIEGEL_LENKUNG,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD346
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_FRONT_MOTOR,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD351
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_HECK_MOTOR,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD353
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SRA_RELAIS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD354
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WASCHWASSERSTAND,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD357
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_HECK_VORHANDEN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD358
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SRA_VORHANDEN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD359
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_WISCHER,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD35B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_FRONT_LIN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD35E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_REGENSENSOR_VORHANDEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD373
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_REGENSENSOR_INIT,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD375
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_REGENSENSOR_INT_WERT,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD376
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FAHRLICHTSENSOR,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD3BE
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FAHRLICHTSENSOR_VORHANDEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD3BF
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOD_LENKRAD,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD3F0
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOD_ZUSTAND_GAP,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD3F1
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_LIN_DATEN_LESEN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD505
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_WISCHER_HECK_MOTOR_2,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD507
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD52C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_VORNE,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD53A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LICHTSCHALTER_WBL_TASTER_BEL,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD53D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_RUECKWAERTSGANG_SCHALTER,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD540
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SCHEINWERFER_GRUNDSTELLUNG_STATUS,        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD541
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_VORNE_VORHANDEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD544
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_HINTEN_VORHANDEN,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD545
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_DYNAMISCH_SCHRITTE_REFLAUF,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD548
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHT_HINTEN_TASTER,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD54B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHT_VORNE_TASTER,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD54C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_BELADUNGSSENSOR,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD54D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_HINTEN_RECHTS_TASTER,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD54E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_MANUELL_POTI,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD54F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LICHTSCHALTEREINHEIT,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD550
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LICHTSCHALTER_WBL_TASTER,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD552
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_HINTEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD553
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PIA_FLA_FOLLOW,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD555
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SCHALTERBELEUCHTUNG_RAENDELRAD,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD557
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PIA_ABBIEGELICHT,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD559
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PIA_TIPPBLINKEN,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD55E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_MANUELL,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD55F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_PIA_TAGFAHRLICHT,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD573
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHT_HINTEN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD57B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_MODUS,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD57E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHT_KLEMME_VA,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD57F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_FLA,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD580
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_BC,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD581
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_BLINKER_FRA,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD582
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_BLINKER_LICHTHUPE_FERNLICHT,    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD583
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD585
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_HINTEN_LINKS_TASTER,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD587
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_VORNE_RECHTS_TASTER,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD588
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LESELICHT_VORNE_LINKS_TASTER,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD589
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_POSITION_MIN_MAX,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD58A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LICHTSCHALTER_NSW_TASTER,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD58B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LICHTSCHALTER_NSL_TASTER,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD58C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AMBIENTE_BELEUCHTUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5D3
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_INNENLICHT_MAPPING,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5DE
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AHL_LWR_TMS_ID_LESEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5E5
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOEHENSTAENDE_SENSOREN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD601
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOEHENSTAENDE_VERSORGUNG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD603
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOEHENSTAENDE_KALIBRIERUNG_LESEN,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD604
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_FES_MODUS,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD611
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_FES_STATISTIK,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD612
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SWITCH_BOARD_TASTEN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD622
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_FES_DATEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD625
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD627
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUSSTATTUNG_CORONA_LED,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD62B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FES_MASTER_SW_FEHLER_INFO,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD62D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SWITCH_BOARD_TASTEN_VERBAU,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD669
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KUEHLMITTELSTAND,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD672
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_GURTZUBRINGER_FA,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD71A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_GURTZUBRINGER_BF,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD71B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_FA_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD726
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_BF_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD727
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_FAH_VORHANDEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD728
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_BFH_VORHANDEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD729
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_BF,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD72D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_BF,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD730
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_FA,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD731
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VORHANDEN_DRITTE_SITZREIHE_EIN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD762
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VERRIEGELUNG_ZWEITE_SITZREIHE,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD763
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_FA,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD771
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_FAH,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD7EA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_BFH,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD7EC
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_VORHANDEN,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD86C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VORHANDEN_FONDSCHICHTUNG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SOLARSENSOR_VORHANDEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AB
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUC_SENSOR_VORHANDEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AC
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FENSTERHEBER_VORHANDEN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8FE
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KLIMAKOMPRESSOR,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD906
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VORHANDEN_KOMPRESSORKUPPLUNG,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD916
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_DRUCKSENSOR_VORHANDEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD959
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_VORHANDEN_WASSERVENTIL,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD95A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SOLARSENSOR,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD961
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_AUC_SENSOR,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD963
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_DRUCKSENSOR,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD967
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BESCHLAGSENSOR,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD96C
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BESCHLAGSENSOR_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD96D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_FONDSCHICHTUNGS_POTI,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD96E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_DRUCKSENSOR_HOCHAUFLOESEND,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9B8
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LENKRAD_SCHALTPADDLES,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA24
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_DC_DC_WANDLER_VORHANDEN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA54
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STAT_LIN_LAYERING,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA5F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA61
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_TUERKONTAKT_BFH_OBEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA7B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_TUERKONTAKT_FAH_OBEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA7E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_BEIFAHRER,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA81
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_BEIFAHRER_HINTEN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA82
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_FAHRER,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA83
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_FAHRER_HINTEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA84
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_HECKKLAPPE,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA85
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_HECKSCHEIBE,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA86
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_GESAMT,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA87
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ZV_KURZSCHLUSSABSCHALTUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA95
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SPANNUNG_KLEMMEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAB3
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KEY_VALID_NR_AKTUELL,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAB4
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_CA_TAGE_ER_LEITUNG,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAB5
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_START_STOP_TASTER,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAB6
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_KLEMMEN_VERHINDERER,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDABA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_DATUM_ZEIT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDABB
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_DME1,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDABC
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_DSC,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDABD
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BUS_IN_FH,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDABF
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_CA_TAGE_STATUS,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDACA
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SPANNUNG_KLEMME_30L1,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAD6
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_SPANNUNG_KLEMME_30L2,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAD7
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB12
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HECKKLAPPENSENSOR,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB16
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_NACHLAUFZEIT_KLEMME_15N,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB2D
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_NACHLAUFZEIT_KLEMME_30B,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB2E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_KLEMMEN,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC56
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_STATUS_KL15_ABSCHALTUNG,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC57
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_ANSTEUERUNG_KL30F_HINTEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC5A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_BREMSLICHT_SCHALTER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC61
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_KUPPL_PN_SCHALTER,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC63
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_MOTORHAUBE_SCHALTER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC65
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HOTEL_SCHALTER,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC66
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_READHWMODIFICATIONINDEX,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF152
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_LWR_STATISTIK,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2302
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_COUNT_NSC_MIRRORHEATING_ACTIVATIONS,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2303
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__LWR_DIAG,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4507
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__LICHT_UEBERSPANNUNGSCOUNTER,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4508
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4700
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__INNENBELEUCHTUNG_DAUERAUS,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4801
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__SARAH_STATISTIK,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4910
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__STATUS_BASESTATION,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4E07
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_IBS_WAKEUP_GRUND,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4F0E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__STATUS_DFZ_SK,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5001
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__STATUS_DFZ_GUELTIGKEIT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5003
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5020
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__ECUMA_INTERN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5101
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__ECUMA_SLEEP_MODE_NRC,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5109
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_HW_INFO_PROVIDER,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x510A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__JTAGLOCK,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x510B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_0,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5DBE
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_1,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5DBF
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_FA_STATISTIKZAEHLER_LESEN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6020
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_BF_STATISTIKZAEHLER_LESEN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6021
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_FAH_STATISTIKZAEHLER_LESEN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6022
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_BFH_STATISTIKZAEHLER_LESEN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6023
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT,     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x603A
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x603B
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x603E
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x603F
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6042
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6043
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__STEUERN_DFZ_VERBINDUNGSENDE,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF003
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__ECU_HW_RESET,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF005
-  //{ I3_ECU_BDC_TX, I3_ECU_BDC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_BDC__LWR_STATISTIK_RESET,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF105
@@ -1,92 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/dsc_i1.json: DSC 29: Dynamic stability controller
-// This generated code  makes it easier to process CANBUS messages from the DSC ecu in a BMW i3
-//
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FS_LOESCHEN_PERMANENT,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1060
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FEHLERSPEICHER_ENDE_WERKSABLAUF,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1061
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_START_ADAPTIVDATEN_RUECKSETZEN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA051
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STEUERN_AX_AY_ABGLEICH,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA052
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA053
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STEUERN_ADAPTIVDATEN_SLW_RESET,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA05B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RPA_RESET_STATISTIK,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA068
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DSC_DRUCKSENSOREN_KALIBRIERUNG,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA070
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RPA_RESET_STANDARDISIERUNG,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA074
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DAC_RESET,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA087
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DAC_AUSLOESUNG,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA088
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_IPB_LED,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA123
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FLM_RESET,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA130
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_RUECKSETZEN,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA1AA
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_RUECKSETZEN,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA1BE
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA222
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STEUERN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_RUECKSETZEN,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA2A2
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STEUERN_EEPROM_SCHREIBEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAB5B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS_2,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xABA3
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_GMK_DATEN,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD09A
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0D2
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_CBS_BREMSE_DETAILS,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD272
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FES_COORDINT_SW_FEHLER_INFO,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD62E
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FLM_LESEN,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6D6
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_LERNDATEN_STATISTIK,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD804
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD805
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_LERNDATEN_TASTER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD808
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_LERNDATEN_AKTUATOR,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD80A
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD80C
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EMF_TASTER,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD80D
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_LESEN,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD81A
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_LESEN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_LESEN,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8EB
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_MODUS_ROLLENPRUEFSTAND,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB5B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_GIERRATE,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBD9
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_QUERBESCHLEUNIGUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBDA
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_LAENGSBESCHLEUNIGUNG,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBDB
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_BREMSBELAGSSENSOR,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBDF
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_REIFENPANNENANZEIGE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBE3
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_GESCHWINDIGKEIT_RAD,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBE4
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DSC_DRUCKSENSOREN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBE5
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DSC_KLEMMEN,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBE7
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_VAKUUMSENSOR,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBF4
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_BREMSPEDALWEGSENSOR,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBF5
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_BREMSREKUPERATIONSMOMENT,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDBF6
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC13
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RPA_LERNDATEN_STATISTIK,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC14
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RPA_LERNDATEN_STD,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC15
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_DSC_BREMSLICHTSCHALTER,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC1E
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_BREMSFLUESSIGKEITSSCHALTER,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC1F
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_GBRPLUS,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC3A
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_LLP,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC42
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_ABS_FUNKTION,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC6C
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_ASC_FUNKTION,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC6D
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FDR_FUNKTION,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC6E
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_PBRK_FUNKTION,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC6F
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_HDC_FUNKTION,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC70
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_MIRROR_AAEPS,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC8F
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_MIRROR_EV,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC90
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_MIRROR_SBS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC91
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_MIRROR_TSC,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC92
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_MIRROR_ZFM,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC93
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_RDC_VERSION,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC94
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_RDC_LESEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC95
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC96
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC97
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_MESSDATENBLOCK_1,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC98
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_MESSDATENBLOCK_2,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC99
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_MESSDATENBLOCK_3,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9A
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_MESSDATENBLOCK_4,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9C
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9D
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_3,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9E
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC9F
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCD9
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCF1
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCF2
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCF3
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_STATUS_AUTO_EPB_ZAEHLER,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD1B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_LESEN,    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE354
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC__SW_IDENTIFIKATION,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4000
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FAHRZEUGZUSTAND,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5002
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_ANTRIEBSZUSTAND,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5004
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_SPANNUNGSMASTER_VERFUEGBAR,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5008
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FUNKTIONSZUSTAND,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x500B
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_INTERNER_FUNKTIONSZUSTAND,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x500C
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_FEHLERSPEICHERSPERRE_AKTIV,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x500F
-  //{ I3_ECU_DSC_TX, I3_ECU_DSC_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_DSC_NETZWERK_ROHDATEN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x5010
@@ -1,45 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/edmei1.json: EDM 12: Electrical digital motor electronics (low voltage ECU)
-// This generated code  makes it easier to process CANBUS messages from the EDM ecu in a BMW i3
-//
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_ENTLUEFTUNG_KUEHLSYSTEM,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA1D0
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_MCAMOS,                                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xADFA
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_12V_NACHLADEHISTORIE_LOESCHEN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAE02
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_12V_NACHLADEHISTOGRAMM_LOESCHEN,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAE03
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_EME_KAELTEMITTEL_ABSPERRVENTIL_ON_OFF,    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE22
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_PEDALWERTGEBER,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE9C
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_BETRIEB,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEE1
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_DREHZAHL,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEE2
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEFD
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEFE
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_TEMPERATUR,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF53
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF54
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_ZYKLEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF55
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF56
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_REX_STATISTIK_ZAEHLER,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF5E
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STEUERN_INTERLOCK,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1061
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_12V_NACHLADEHISTORIE,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x409D
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_12V_NACHLADEHISTOGRAMM,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x409E
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_S_KL_15_WUP,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4101
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_PWG1_RAW,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4102
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_PWG2_RAW,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4103
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_TMEL_RAW,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4104
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_BATTERIE_VOLTAGE_RAUS,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4105
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_U_PWG1,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4106
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_U_PWG2,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4107
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_MEL,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4109
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_ECU_MICRO_TEMPERATUR,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x410A
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_TMEL2_RAW,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x410B
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_S_ELRLY,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4120
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_T_ELUE,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4121
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_T_EWP,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4122
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_S_KV1,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4123
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_S_KV2,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4124
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_A_S_MEL,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4125
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_PWG1,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4182
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_E_A_PWG2_FILTERED,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4183
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_1,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4184
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_BATTERY_VOLTAGE_FILTERED,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4185
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_2,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x418B
-  //{ I3_ECU_EDM_TX, I3_ECU_EDM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EDM_STEUERN_AKKS,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF0D5
@@ -1,76 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eme_i01.json: EME 1A: Electrical machine electronics
-// This generated code  makes it easier to process CANBUS messages from the EME ecu in a BMW i3
-//
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_FS_LOESCHEN_PERMANENT,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1060
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_FEHLERSPEICHER_ENDE_WERKSABLAUF,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1061
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AKS_DIAG_STATUS_INFO,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4009
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_DCDC_LV,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDF6
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE00
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE02
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE04
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVPM_PKOR,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE06
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVIL_GESAMT,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE0C
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_ANSTEUERUNG_ELUP,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE0E
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EME_HVPM_DCDC_ALS,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE1C
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_CPLD_VERSION,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE2D
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE39
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_LSC_LADEN_2,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE6E
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_CHARGE_ENABLE,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE71
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_SENSOREN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE74
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_HV_SPANNUNG_LESEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE75
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_SW,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE76
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_POSITION,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE79
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_STROM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE7B
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_SPANNUNGEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE7C
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_AUSGANG,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE7D
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_ELUP_BUDS,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE7E
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE7F
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE,        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE80
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE81
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SLE,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE82
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ROHSIG_EINGANG_SENS_DCDC,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE83
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_BETRIEBSZUSTAND_SLE,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE84
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SLE_LEISTUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE85
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SLE_SPANNUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE86
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SLE_STROM,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE87
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SPANNUNG_KLEMME30B,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE88
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_STROM_DCDC,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE89
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_STROM_EMASCHINE,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE8A
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_TEMP_LE,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE8C
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ZUSTAND_1_DCDC,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE92
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ZUSTAND_DCDC_FEHLERBILD,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE96
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_STATUS_CONNECTED_DRIVE,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE9E
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_BUDS,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEA5
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_TEMP_EMASCHINE,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEA6
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ELEKTRISCHE_MASCHINE,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEA7
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_ZUSTAND_2_DCDC,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEA9
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_PARKSPERRE_VERSION,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEB0
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_CTRL_VERSION,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEBC
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SPANNUNG_DCDC,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEBD
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SPANNUNG_LE,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEBE
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_SYSSTATE,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEBF
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_SPANNUNG_ELUP,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEC2
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_STROM_ELUP,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEC3
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_FAHRSTUFE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEDD
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_LSC_LADEN,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEDE
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_HISTOGRAMM_ANTRIEB,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEED
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_HISTOGRAMM_DEGRADATION,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEEF
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AUTOP_SBW,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEFB
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEFF
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF49
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_INVERTER_HISTOGRAMM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF4D
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_INVERTER_RBM_INFO,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF58
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_DCDC_RBM_INFO,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF59
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LADEGERAET_RBM_INFO,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF5A
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LIEFERANT_TRACE_NUMMER,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF5B
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB5
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LADEGERAET_HV_UEBERSTROM,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB7
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_EMASCHINE_MAX_DREHZAHL,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFCE
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFD0
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_RATE_BASED_MONITORING,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE52F
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_LADEKOORDINATOR_INTERFACE,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5FE
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5FF
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_RESETINFO_LESEN,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF011
-  //{ I3_ECU_EME_TX, I3_ECU_EME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EME_AE_FREILAUF_MODUS,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF050
@@ -1,15 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eps_i1.json: EPS 30: Power steering
-// This generated code  makes it easier to process CANBUS messages from the EPS ecu in a BMW i3
-//
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_STEUERN_EPS_PULLDRIFT_OFFSET_RESET,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA2BB
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_EPS_LENKWINKELSENSOR_KALIBRIERUNG_RESET,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAB69
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_EPS_INITIALISIERUNG_SERVICE,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAB6C
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_STEUERN_EPS_MULTITURNWERT_RESET,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAB7D
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_EPS_RITZELWINKELSENSOR,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB57
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_EPS_MOMENTENSENSOR,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB99
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_EPS_ZAHNSTANGENMITTE,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDC77
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_GELERNTER_ZAHNSTANGENWEG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFDD
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_READHWMODIFICATIONINDEX,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF152
-  //{ I3_ECU_EPS_TX, I3_ECU_EPS_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_EPS_FLASH_UPDATE_MULTITURNZAEHLER,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1234
@@ -1,1367 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/fzd_f15.json: FZD 56: Roof function centre
-// This generated code  makes it easier to process CANBUS messages from the FZD ecu in a BMW i3
-//
-
-#define I3_ECU_FZD_TX                                                0x06F156
-#define I3_ECU_FZD_RX                                                0x0656F1
-
-// Skipping SHD_ESH_EINLERNEN on 0xA17C which takes arguments
-
-// Skipping SHD_ESH_VERFAHREN_ZEIT on 0xA183 which takes arguments
-
-// Skipping SHD_ESH_VERFAHREN_SONDERFUNKTION on 0xA184 which takes arguments
-
-// Skipping SHD_ESH_VERFAHREN_HALL on 0xA185 which takes arguments
-
-// Skipping SHD_ESH_VERFAHREN_PROZENT on 0xA186 which takes arguments
-
-// Skipping SHD_ESH_VERFAHREN_SERVICE_POSITION on 0xA187 which takes arguments
-
-// Skipping SHD_ESH_TASTER_STEUERN on 0xA188 which takes arguments
-
-#define I3_PID_FZD_DWA_SINE_ANSTEUERUNG                              0xAA70
-        // Activation of the siren for a maximum of 5 seconds / Ansteuerung der Sirene für maximal 5 Sekunden
-
-#define I3_PID_FZD_DWA_SINE_BATT_LEVEL_RESET                         0xAA71
-        // Reset the battery level. Perform only after replacing the battery / Reset des Batterie-Levels. Nur nach
-        // Austausch der Batterie durchführen
-
-// Skipping DWA_SELBSTTEST on 0xAA76 which takes arguments
-
-// Skipping DWA_SCHAERFEN on 0xAA79 which takes arguments
-
-#define I3_PID_FZD_DWA_ALARM_ANZAHL_LOESCHEN                         0xAA7A
-        // Delete number of alarms / Anzahl Alarme löschen
-
-// Skipping DWA_CAR_KEY_MEMORY_RESET on 0xAA7B which takes arguments
-
-// Skipping SHD_ESH_NORMIERUNG_LOESCHEN on 0xD17C which takes arguments
-
-// Skipping SHD_ESH_KENNLINIE_LOESCHEN on 0xD17D which takes arguments
-
-// Skipping SHD_ESH_RELAIS_STEUERN on 0xD17E which takes arguments
-
-#define I3_PID_FZD_SHD_HALLSENSOREN                                  0xD180
-        // Status of the hall sensors / Status der Hallsensoren
-
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN                 (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_TYPE            unsigned char
-        // Hall A switching state 0x00: Off 0x01: On / Hall A Schaltzustand 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN                    (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN_UNIT               '0/1'
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN_TYPE               unsigned char
-        // Hall A supply 0x00: Off 0x01: On / Hall A Versorgung 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR                  (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_TYPE             unsigned char
-        // Error status Hall connection see table TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND / Fehlerzustand Hallanschluss siehe
-        // Tabelle TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND
-
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN                 (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_TYPE            unsigned char
-        // Hall B switching state 0x00: Off 0x01: On / Hall B Schaltzustand 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN                    (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN_UNIT               '0/1'
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN_TYPE               unsigned char
-        // Hall B supply 0x00: Off 0x01: On / Hall B Versorgung 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR                  (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_TYPE             unsigned char
-        // Error status Hall connection see table TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND / Fehlerzustand Hallanschluss siehe
-        // Tabelle TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND
-
-#define I3_PID_FZD_SHD_ESH_TASTER                                    0xD192
-        // Status / simulation button sunroof / Status / Simulation Taster Schiebedach
-
-    #define I3_RES_FZD_STAT_TASTER_SHD_ESH_NR                        (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_TASTER_SHD_ESH_NR_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_TASTER_SHD_ESH_NR_TYPE                   unsigned char
-        // For button request see table TAB_FH_ESH_VERFAHREN / Tasteranforderung siehe Tabelle TAB_FH_ESH_VERFAHREN
-
-    #define I3_RES_FZD_STAT_TASTER_RESERVE                           (RXBUF_UINT32(1))
-    #define I3_RES_FZD_STAT_TASTER_RESERVE_UNIT                      '0-n'
-    #define I3_RES_FZD_STAT_TASTER_RESERVE_TYPE                      unsigned long
-        // still vacant / noch unbelgt
-
-#define I3_PID_FZD_ESH_VORHANDEN                                     0xD193
-        // 0x00: electric sliding headliner not available 0x01: electric sliding headliner available / 0x00: elektrischer
-        // Schiebehimmel nicht vorhanden 0x01: elektrischer Schiebehimmel vorhanden
-
-    #define I3_RES_FZD_STAT_VORHANDEN_ESH                            (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_VORHANDEN_ESH_UNIT                       '0/1'
-    #define I3_RES_FZD_STAT_VORHANDEN_ESH_TYPE                       unsigned char
-        // 0x00: electric sliding headliner not available 0x01: electric sliding headliner available / 0x00: elektrischer
-        // Schiebehimmel nicht vorhanden 0x01: elektrischer Schiebehimmel vorhanden
-
-#define I3_PID_FZD_SHD_ESH_TASTER_VORHANDEN                          0xD194
-        // 0x00: No SHD button available 0x01: SHD button available / 0x00: Kein SHD-Taster vorhanden 0x01: SHD-Taster
-        // vorhanden
-
-    #define I3_RES_FZD_STAT_VORHANDEN_TASTER_SHD_ESH                 (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_VORHANDEN_TASTER_SHD_ESH_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_VORHANDEN_TASTER_SHD_ESH_TYPE            char
-        // 0x00: No SHD button available 0x01: SHD button available / 0x00: Kein SHD-Taster vorhanden 0x01: SHD-Taster
-        // vorhanden
-
-#define I3_PID_FZD_SHD_VORHANDEN                                     0xD195
-        // 1: Sunroof available / 1: Schiebedach vorhanden
-
-    #define I3_RES_FZD_STAT_VORHANDEN_SHD                            (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_VORHANDEN_SHD_UNIT                       '0/1'
-    #define I3_RES_FZD_STAT_VORHANDEN_SHD_TYPE                       char
-        // 1: Sunroof available / 1: Schiebedach vorhanden
-
-#define I3_PID_FZD_SHD_BEWEGUNG                                      0xD196
-        // Sunroof movement status / Status Bewegung Schiebedach
-
-    #define I3_RES_FZD_STAT_SHD_INIT_NR                              (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_SHD_INIT_NR_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_SHD_INIT_NR_TYPE                         unsigned char
-        // For the initialization result, see table TAB_FH_SHD_ESH_INIT / Initialisierungsergebnis siehe Tabelle
-        // TAB_FH_SHD_ESH_INIT
-
-    #define I3_RES_FZD_STAT_SHD_BEWEGUNG_NR                          (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_SHD_BEWEGUNG_NR_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_SHD_BEWEGUNG_NR_TYPE                     unsigned char
-        // Movement of the element see table TAB_FH_SHD_ESH_BEWEGUNG / Bewegung des Elements siehe Tabelle
-        // TAB_FH_SHD_ESH_BEWEGUNG
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_NR                          (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_SHD_POSITION_NR_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_SHD_POSITION_NR_TYPE                     unsigned char
-        // For the current position of the glass lid, see table TAB_FH_SHD_ESH_POSITION / Aktuelle Position des
-        // Glasdeckels siehe Tabelle TAB_FH_SHD_ESH_POSITION
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_WERT                   (RXBUF_UINT(3))
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_WERT_UNIT              'Ink'
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_WERT_TYPE              unsigned short
-        // Current position in Hall pulses (500 means completely closed) / Aktuelle Position in Hall-Pulsen (500 bedeutet
-        // komplett geschlossen)
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MIN_WERT               (RXBUF_UINT(5))
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MIN_WERT_UNIT          'Ink'
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MIN_WERT_TYPE          unsigned short
-        // Minimum position in Hall pulses / Minimale Position in Hall-Pulsen
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MAX_WERT               (RXBUF_UINT(7))
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MAX_WERT_UNIT          'Ink'
-    #define I3_RES_FZD_STAT_SHD_POSITION_HALL_MAX_WERT_TYPE          unsigned short
-        // Maximum position in Hall pulses / Maximale Position in Hall-Pulsen
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_WERT                     (RXBUF_UINT(9))
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_WERT_UNIT                'mm'
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_WERT_TYPE                unsigned short
-        // Slide travel in mm between MIN and MAX in millimeters (0 means completely closed) / Schlittenweg in mm
-        // zwischen MIN und MAX in Millimeter (0 bedeut komplett geschlossen)
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MIN_WERT                 (RXBUF_UINT(11))
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MIN_WERT_UNIT            'mm'
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MIN_WERT_TYPE            unsigned short
-        // Minimum position in millimeters / Minimale Position in Millimeter
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MAX_WERT                 (RXBUF_UINT(13))
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MAX_WERT_UNIT            'mm'
-    #define I3_RES_FZD_STAT_SHD_POSITION_MM_MAX_WERT_TYPE            unsigned short
-        // Maximum position in millimeters / Maximale Position in Millimeter
-
-    #define I3_RES_FZD_STAT_SHD_POSITION_PROZENT_WERT                (RXBUF_UCHAR(15))
-    #define I3_RES_FZD_STAT_SHD_POSITION_PROZENT_WERT_UNIT           '%'
-    #define I3_RES_FZD_STAT_SHD_POSITION_PROZENT_WERT_TYPE           unsigned char
-        // % of the maximum travel 0% means open / 100% means closed / % vom maximalen Verfahrweg 0% bedeutet offen /100%
-        // bedeutet geschlossen
-
-    #define I3_RES_FZD_STAT_SHD_LAGE_NR                              (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_SHD_LAGE_NR_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_SHD_LAGE_NR_TYPE                         unsigned char
-        // For the position of the glass cover, see table TAB_FH_SHD_ESH_LAGE_NR / Lage Glasdeckel siehe Tabelle
-        // TAB_FH_SHD_ESH_LAGE_NR
-
-    #define I3_RES_FZD_STAT_SHD_ZUSTAND_TUER_NR                      (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_SHD_ZUSTAND_TUER_NR_UNIT                 '0-n'
-    #define I3_RES_FZD_STAT_SHD_ZUSTAND_TUER_NR_TYPE                 unsigned char
-        // Status of the door contact that is available to the motor driver. see table TAB_FH_SHD_ESH_ZUSTAND_TUER /
-        // Status Türkontakt, der den Motortreiber zur Verfügung steht. siehe Tabelle TAB_FH_SHD_ESH_ZUSTAND_TUER
-
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_AKTIV_NR                    (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_AKTIV_NR_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_AKTIV_NR_TYPE               unsigned char
-        // For release status, see table TAB_FH_SHD_ESH_FREIGABE / Freigabezustand siehe Tabelle TAB_FH_SHD_ESH_FREIGABE
-
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_AKTIV_NR                  (RXBUF_UCHAR(19))
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_AKTIV_NR_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_AKTIV_NR_TYPE             unsigned char
-        // Status link enable panic mode / Status Verknüpfung Freigabe Panikmodus
-
-    #define I3_RES_FZD_STAT_SHD_RESERVE                              (RXBUF_UINT32(20))
-    #define I3_RES_FZD_STAT_SHD_RESERVE_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_SHD_RESERVE_TYPE                         unsigned long
-        // reserve / Reserve
-
-// Skipping SHD_ESH_HALLVERSORGUNG on 0xD19E which takes arguments
-
-#define I3_PID_FZD_SHD_STATUS_DETAIL                                 0xD1A6
-        // Extended status sunroof / Erweiterter Status Schiebedach
-
-    #define I3_RES_FZD_STAT_SHD_RESERVE_1                            (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_SHD_RESERVE_1_UNIT                       '0-n'
-    #define I3_RES_FZD_STAT_SHD_RESERVE_1_TYPE                       unsigned char
-        // Not used by SHD! / Von SHD nicht benutzt!
-
-    #define I3_RES_FZD_STAT_SHD_MOTORTEMPERATUR_NR                   (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_SHD_MOTORTEMPERATUR_NR_UNIT              '0-n'
-    #define I3_RES_FZD_STAT_SHD_MOTORTEMPERATUR_NR_TYPE              unsigned char
-        // For motor temperature ranges see table TAB_FH_SHD_ESH_MOTORTEMPERATUR / Motortemperaturbereiche siehe Tabelle
-        // TAB_FH_SHD_ESH_MOTORTEMPERATUR
-
-    #define I3_RES_FZD_STAT_SHD_AUSSENTEMPERATUR_WERT                (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_SHD_AUSSENTEMPERATUR_WERT_UNIT           '°C'
-    #define I3_RES_FZD_STAT_SHD_AUSSENTEMPERATUR_WERT_TYPE           unsigned char
-        // Outside temperature (coding analogue to CAN signal) / Aussentemperatur (Codierung analog CAN-Signal)
-
-    #define I3_RES_FZD_STAT_SHD_MT_LIEFERANT_NR                      (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_SHD_MT_LIEFERANT_NR_UNIT                 '0-n'
-    #define I3_RES_FZD_STAT_SHD_MT_LIEFERANT_NR_TYPE                 unsigned char
-        // For the supplier of the motor driver, see table TAB_FH_SHD_ESH_MT_LIEFERANT / Lieferant des Motortreibers
-        // siehe Tabelle TAB_FH_SHD_ESH_MT_LIEFERANT
-
-    #define I3_RES_FZD_STAT_SHD_MT_SW_VERSION                        (RXBUF_UINT32(4))
-    #define I3_RES_FZD_STAT_SHD_MT_SW_VERSION_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_SHD_MT_SW_VERSION_TYPE                   unsigned long
-        // SW version Byte 0 = Patchlevelnumber Byte 1 = Minorversionnumber Byte2 = Majorversionnumber Byte3 = unused /
-        // SW-Version Byte 0 = Patchlevelnumber Byte 1 = Minorversionnumber Byte2 = Majorversionnumber Byte3 = unused
-
-    #define I3_RES_FZD_STAT_SHD_EEPROM_PRUEFSUMME_NR                 (RXBUF_UCHAR(8))
-    #define I3_RES_FZD_STAT_SHD_EEPROM_PRUEFSUMME_NR_UNIT            '0-n'
-    #define I3_RES_FZD_STAT_SHD_EEPROM_PRUEFSUMME_NR_TYPE            unsigned char
-        // Status EEPROM checksum see table TAB_FH_SHD_ESH_STAT_EEPROM / Status EEPROM Checksumme siehe Tabelle
-        // TAB_FH_SHD_ESH_STAT_EEPROM
-
-    #define I3_RES_FZD_STAT_SHD_RESERVE_2                            (RXBUF_UCHAR(9))
-    #define I3_RES_FZD_STAT_SHD_RESERVE_2_UNIT                       '0-n'
-    #define I3_RES_FZD_STAT_SHD_RESERVE_2_TYPE                       unsigned char
-        // Not used by SHD for the time being! / Von SHD vorerst nicht benutzt!
-
-    #define I3_RES_FZD_STAT_SHD_WACHHALTEN                           (RXBUF_UCHAR(10))
-    #define I3_RES_FZD_STAT_SHD_WACHHALTEN_UNIT                      '0-n'
-    #define I3_RES_FZD_STAT_SHD_WACHHALTEN_TYPE                      unsigned char
-        // For the status of preventing sleep, see table TAB_FH_SHD_ESH_WACHHALTEN / Status Einschlaf-Verhinderung siehe
-        // Tabelle TAB_FH_SHD_ESH_WACHHALTEN
-
-    #define I3_RES_FZD_STAT_SHD_FZG_GESCHWINDIGKEIT                  (RXBUF_UCHAR(11))
-    #define I3_RES_FZD_STAT_SHD_FZG_GESCHWINDIGKEIT_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_SHD_FZG_GESCHWINDIGKEIT_TYPE             unsigned char
-        // Vehicle speed (coding analogue to CAN signal) / Fahrzeuggeschwindigkeit (Codierung analog CAN-Signal)
-
-    #define I3_RES_FZD_STAT_SHD_RELATIVZEIT                          (RXBUF_UINT32(12))
-    #define I3_RES_FZD_STAT_SHD_RELATIVZEIT_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_SHD_RELATIVZEIT_TYPE                     unsigned long
-        // Current relative time (as received from the bus) / Aktuelle Relativ-Zeit (wie vom Bus erhalten)
-
-    #define I3_RES_FZD_STAT_SHD_TEMPERATUR_UEBERWACHUNG              (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_SHD_TEMPERATUR_UEBERWACHUNG_UNIT         '0/1'
-    #define I3_RES_FZD_STAT_SHD_TEMPERATUR_UEBERWACHUNG_TYPE         unsigned char
-        // Status activation temperature monitoring 0x00: Off 0x01: On / Status Aktivierung Temperaturüberwachung  0x00:
-        // Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_SHD_EKS_AKTIV                            (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_SHD_EKS_AKTIV_UNIT                       '0/1'
-    #define I3_RES_FZD_STAT_SHD_EKS_AKTIV_TYPE                       unsigned char
-        // EKS activation status 0x00: Off 0x01: On / Status Aktivierung EKS 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_DEAKTIVIERT                 (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_DEAKTIVIERT_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_SHD_FREIGABE_DEAKTIVIERT_TYPE            unsigned char
-        // Status link enable 0x00: Off 0x01: On / Status Verknüpfung Freigabe 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_DEAKTIVIERT               (RXBUF_UCHAR(19))
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_DEAKTIVIERT_UNIT          '0/1'
-    #define I3_RES_FZD_STAT_SHD_PANIKMODUS_DEAKTIVIERT_TYPE          unsigned char
-        // Status link enable panic mode 0x00: Off 0x01: On / Status Verknüpfung Freigabe Panikmodus 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_SHD_RESERVE_0XD1A6                       (RXBUF_UINT32(20))
-    #define I3_RES_FZD_STAT_SHD_RESERVE_0XD1A6_UNIT                  '0-n'
-    #define I3_RES_FZD_STAT_SHD_RESERVE_0XD1A6_TYPE                  unsigned long
-        // Reserve for extensions / Reserve für Erweiterungen
-
-#define I3_PID_FZD_SHD_RELAIS                                        0xD1B9
-        // Status relay sunroof / Status Relais Schiebedach
-
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN                 (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_TYPE            unsigned char
-        // Status control relay A 0x00: Off 0x01: On / Status Ansteuerung Relais A 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN                       (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN_UNIT                  '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN_TYPE                  unsigned char
-        // Status of the read-back line relay A 0x00: Off 0x01: On / Status Rückleseleitung Relais A 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN                 (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_TYPE            unsigned char
-        // Status control relay B 0x00: Off 0x01: On / Status Ansteuerung Relais B 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN                       (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN_UNIT                  '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN_TYPE                  unsigned char
-        // Status of the readback line relay B 0x00: Off 0x01: On / Status Rückleseleitung Relais B 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT                 (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_UNIT            'V'
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_TYPE            float
-        // Input voltage at the relay (terminal voltage of the motor). Resolution 0.01 V / Eingangsspannung am Relais
-        // (Klemmenspannung des Motors) . Auflösung 0,01 V
-
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT                 (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_UNIT            'V'
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_TYPE            float
-        // Input voltage at the relay (terminal voltage of the motor). Resolution 0.01 V / Eingangsspannung am Relais
-        // (Klemmenspannung des Motors) . Auflösung 0,01 V
-
-#define I3_PID_FZD_ESH_BEWEGUNG                                      0xD1BA
-        // Status of electrical sliding headliner movement / Status elektrischer Schiebehimmel Bewegung
-
-    #define I3_RES_FZD_STAT_ESH_INIT_NR                              (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_ESH_INIT_NR_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_ESH_INIT_NR_TYPE                         unsigned char
-        // For the initialization result, see table TAB_FH_SHD_ESH_INIT / Initialisierungsergebnis siehe Tabelle
-        // TAB_FH_SHD_ESH_INIT
-
-    #define I3_RES_FZD_STAT_ESH_BEWEGUNG_NR                          (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_ESH_BEWEGUNG_NR_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_ESH_BEWEGUNG_NR_TYPE                     unsigned char
-        // Movement of the element see table TAB_FH_SHD_ESH_BEWEGUNG / Bewegung des Elements siehe Tabelle
-        // TAB_FH_SHD_ESH_BEWEGUNG
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_NR                          (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_ESH_POSITION_NR_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_ESH_POSITION_NR_TYPE                     unsigned char
-        // Current position of the sliding headliner see table TAB_FH_SHD_ESH_POSITION / Aktuelle Position des
-        // Schiebehimmels siehe Tabelle TAB_FH_SHD_ESH_POSITION
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_WERT                   (RXBUF_UINT(3))
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_WERT_UNIT              'Ink'
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_WERT_TYPE              unsigned short
-        // Current position in Hall pulses (500 means completely closed) / Aktuelle Position in Hall-Pulsen (500 bedeutet
-        // komplett geschlossen)
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MIN_WERT               (RXBUF_UINT(5))
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MIN_WERT_UNIT          'Ink'
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MIN_WERT_TYPE          unsigned short
-        // Minimum position in Hall pulses / Minimale Position in Hall-Pulsen
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MAX_WERT               (RXBUF_UINT(7))
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MAX_WERT_UNIT          'Ink'
-    #define I3_RES_FZD_STAT_ESH_POSITION_HALL_MAX_WERT_TYPE          unsigned short
-        // Maximum position in Hall pulses / Maximale Position in Hall-Pulsen
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_WERT                     (RXBUF_UINT(9))
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_WERT_UNIT                'mm'
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_WERT_TYPE                unsigned short
-        // supplies the slide path in mm between MIN and MAX in millimeters (0 means completely closed) / liefert den
-        // Schlittenweg in mm zwischen MIN und MAX in Millimeter (0 bedeut komplett geschlossen)
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MIN_WERT                 (RXBUF_UINT(11))
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MIN_WERT_UNIT            'mm'
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MIN_WERT_TYPE            unsigned short
-        // Minimum position in millimeters / Minimale Position in Millimeter
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MAX_WERT                 (RXBUF_UINT(13))
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MAX_WERT_UNIT            'mm'
-    #define I3_RES_FZD_STAT_ESH_POSITION_MM_MAX_WERT_TYPE            unsigned short
-        // Maximum position in millimeters / Maximale Position in Millimeter
-
-    #define I3_RES_FZD_STAT_ESH_POSITION_PROZENT_WERT                (RXBUF_UCHAR(15))
-    #define I3_RES_FZD_STAT_ESH_POSITION_PROZENT_WERT_UNIT           '%'
-    #define I3_RES_FZD_STAT_ESH_POSITION_PROZENT_WERT_TYPE           unsigned char
-        // % of the maximum travel 0% open / 100% closed / % vom maximalen Verfahrweg 0% offen / 100% geschlossen
-
-    #define I3_RES_FZD_STAT_ESH_LAGE_NR                              (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_ESH_LAGE_NR_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_ESH_LAGE_NR_TYPE                         unsigned char
-        // For the position of the sliding headliner, see table TAB_FH_SHD_ESH_LAGE_NR / Lage Schiebehimmel siehe Tabelle
-        // TAB_FH_SHD_ESH_LAGE_NR
-
-    #define I3_RES_FZD_STAT_ESH_ZUSTAND_TUER_NR                      (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_ESH_ZUSTAND_TUER_NR_UNIT                 '0-n'
-    #define I3_RES_FZD_STAT_ESH_ZUSTAND_TUER_NR_TYPE                 unsigned char
-        // Status of the door contact that is available to the motor driver. see table TAB_FH_SHD_ESH_ZUSTAND_TUER /
-        // Status Türkontakt, der den Motortreiber zur Verfügung steht. siehe Tabelle TAB_FH_SHD_ESH_ZUSTAND_TUER
-
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_AKTIV_NR                    (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_AKTIV_NR_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_AKTIV_NR_TYPE               unsigned char
-        // For release status, see table TAB_FH_SHD_ESH_FREIGABE / Freigabezustand siehe Tabelle TAB_FH_SHD_ESH_FREIGABE
-
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_AKTIV_NR                  (RXBUF_UCHAR(19))
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_AKTIV_NR_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_AKTIV_NR_TYPE             unsigned char
-        // Status link enable panic mode / Status Verknüpfung Freigabe Panikmodus
-
-    #define I3_RES_FZD_STAT_ESH_RESERVE                              (RXBUF_UINT32(20))
-    #define I3_RES_FZD_STAT_ESH_RESERVE_UNIT                         '0-n'
-    #define I3_RES_FZD_STAT_ESH_RESERVE_TYPE                         unsigned long
-        // reserve / Reserve
-
-#define I3_PID_FZD_ESH_HALLSENSOREN                                  0xD1BB
-        // Status of hall sensors, electric sliding headliner / Status Hallsensoren elektrischer Schiebehimmel
-
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB          (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB_TYPE     unsigned char
-        // Hall A switching state 0x00: Off 0x01: On / Hall A Schaltzustand 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN_0XD1BB             (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN_0XD1BB_UNIT        '0/1'
-    #define I3_RES_FZD_STAT_HALL_A_VERSORGUNG_EIN_0XD1BB_TYPE        unsigned char
-        // Hall A supply 0x00: Off 0x01: On / Hall A Versorgung 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB           (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB_UNIT      '0-n'
-    #define I3_RES_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB_TYPE      unsigned char
-        // Error status Hall connection see table TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND / Fehlerzustand Hallanschluss siehe
-        // Tabelle TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND
-
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB          (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB_TYPE     unsigned char
-        // Hall B switching state 0x00: Off 0x01: On / Hall B Schaltzustand 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN_0XD1BB             (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN_0XD1BB_UNIT        '0/1'
-    #define I3_RES_FZD_STAT_HALL_B_VERSORGUNG_EIN_0XD1BB_TYPE        unsigned char
-        // Hall B supply 0x00: Off 0x01: On / Hall B Versorgung 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB           (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB_UNIT      '0-n'
-    #define I3_RES_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB_TYPE      unsigned char
-        // Error status Hall connection see table TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND / Fehlerzustand Hallanschluss siehe
-        // Tabelle TAB_FH_SHD_ESH_HALL_FEHLERZUSTAND
-
-#define I3_PID_FZD_ESH_RELAIS                                        0xD1BC
-        // Status relay electrical sliding headliner / Status Relais elektrischer Schiebehimmel
-
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC          (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC_TYPE     unsigned char
-        // Status control relay A 0x00: Off 0x01: On / Status Ansteuerung Relais A 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN_0XD1BC                (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN_0XD1BC_UNIT           '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_A_RUECK_EIN_0XD1BC_TYPE           unsigned char
-        // Status of the read-back line relay A 0x00: Off 0x01: On / Status Rückleseleitung Relais A 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC          (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC_TYPE     unsigned char
-        // Status control relay B 0x00: Off 0x01: On / Status Ansteuerung Relais B 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN_0XD1BC                (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN_0XD1BC_UNIT           '0/1'
-    #define I3_RES_FZD_STAT_RELAIS_B_RUECK_EIN_0XD1BC_TYPE           unsigned char
-        // Status of the readback line relay B 0x00: Off 0x01: On / Status Rückleseleitung Relais B 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC          (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC_UNIT     'V'
-    #define I3_RES_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC_TYPE     float
-        // Input voltage at the relay (terminal voltage of the motor). Resolution 0.01 V / Eingangsspannung am Relais
-        // (Klemmenspannung des Motors) . Auflösung 0,01 V
-
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC          (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC_UNIT     'V'
-    #define I3_RES_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC_TYPE     float
-        // Input voltage at the relay (terminal voltage of the motor). Resolution 0.01 V / Eingangsspannung am Relais
-        // (Klemmenspannung des Motors) . Auflösung 0,01 V
-
-#define I3_PID_FZD_ESH_STATUS_DETAIL                                 0xD1BD
-        // Extended information electric sliding headliner / Erweiterte Informationen elektrischer Schiebehimmel
-
-    #define I3_RES_FZD_STAT_ESH_RESERVE_1                            (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_ESH_RESERVE_1_UNIT                       '0-n'
-    #define I3_RES_FZD_STAT_ESH_RESERVE_1_TYPE                       unsigned char
-        // Not used by ESH! / Von ESH nicht benutzt!
-
-    #define I3_RES_FZD_STAT_ESH_MOTORTEMPERATUR_NR                   (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_ESH_MOTORTEMPERATUR_NR_UNIT              '0-n'
-    #define I3_RES_FZD_STAT_ESH_MOTORTEMPERATUR_NR_TYPE              unsigned char
-        // Motor temperature ranges, see table TAB_FH_SHD_ESH_MOTORTEMPERATUR / Motortemperaturbereiche, siehe Tabelle
-        // TAB_FH_SHD_ESH_MOTORTEMPERATUR
-
-    #define I3_RES_FZD_STAT_ESH_AUSSENTEMPERATUR_WERT                (RXBUF_UCHAR(2)*0.5f-40.0)
-    #define I3_RES_FZD_STAT_ESH_AUSSENTEMPERATUR_WERT_UNIT           '°C'
-    #define I3_RES_FZD_STAT_ESH_AUSSENTEMPERATUR_WERT_TYPE           float
-        // Outside temperature (coding analogue to CAN signal) / Aussentemperatur (Codierung analog CAN-Signal)
-
-    #define I3_RES_FZD_STAT_ESH_MT_LIEFERANT_NR                      (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_ESH_MT_LIEFERANT_NR_UNIT                 '0-n'
-    #define I3_RES_FZD_STAT_ESH_MT_LIEFERANT_NR_TYPE                 unsigned char
-        // Supplier of the motor driver, see table TAB_FH_SHD_ESH_MT_LIEFERANT / Lieferant des Motortreibers, siehe
-        // Tabelle TAB_FH_SHD_ESH_MT_LIEFERANT
-
-    #define I3_RES_FZD_STAT_ESH_MT_SW_VERSION                        (RXBUF_UINT32(4))
-    #define I3_RES_FZD_STAT_ESH_MT_SW_VERSION_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_ESH_MT_SW_VERSION_TYPE                   unsigned long
-        // SW version Byte 0 = Patchlevelnumber Byte 1 = Minorversionnumber Byte2 = Majorversionnumber Byte3 = unused /
-        // SW-Version Byte 0 = Patchlevelnumber Byte 1 = Minorversionnumber Byte2 = Majorversionnumber Byte3 = unused
-
-    #define I3_RES_FZD_STAT_ESH_EEPROM_PRUEFSUMME_NR                 (RXBUF_UCHAR(8))
-    #define I3_RES_FZD_STAT_ESH_EEPROM_PRUEFSUMME_NR_UNIT            '0-n'
-    #define I3_RES_FZD_STAT_ESH_EEPROM_PRUEFSUMME_NR_TYPE            unsigned char
-        // Status EEPROM checksum, see table TAB_FH_SHD_ESH_STAT_EEPROM / Status EEPROM Checksumme, siehe Tabelle
-        // TAB_FH_SHD_ESH_STAT_EEPROM
-
-    #define I3_RES_FZD_STAT_ESH_RESERVE_2                            (RXBUF_UCHAR(9))
-    #define I3_RES_FZD_STAT_ESH_RESERVE_2_UNIT                       '0-n'
-    #define I3_RES_FZD_STAT_ESH_RESERVE_2_TYPE                       unsigned char
-        // Not used by SHD for the time being! / Von SHD vorerst nicht benutzt!
-
-    #define I3_RES_FZD_STAT_ESH_WACHHALTEN                           (RXBUF_UCHAR(10))
-    #define I3_RES_FZD_STAT_ESH_WACHHALTEN_UNIT                      '0-n'
-    #define I3_RES_FZD_STAT_ESH_WACHHALTEN_TYPE                      unsigned char
-        // Status of falling asleep prevention, see table TAB_FH_SHD_ESH_WACHHALTEN / Status Einschlaf-Verhinderung,
-        // siehe Tabelle TAB_FH_SHD_ESH_WACHHALTEN
-
-    #define I3_RES_FZD_STAT_ESH_FZG_GESCHWINDIGKEIT                  (RXBUF_UCHAR(11))
-    #define I3_RES_FZD_STAT_ESH_FZG_GESCHWINDIGKEIT_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_ESH_FZG_GESCHWINDIGKEIT_TYPE             unsigned char
-        // Vehicle speed (coding analogue to CAN signal) / Fahrzeuggeschwindigkeit (Codierung analog CAN-Signal)
-
-    #define I3_RES_FZD_STAT_ESH_RELATIVZEIT                          (RXBUF_UINT32(12))
-    #define I3_RES_FZD_STAT_ESH_RELATIVZEIT_UNIT                     '0-n'
-    #define I3_RES_FZD_STAT_ESH_RELATIVZEIT_TYPE                     unsigned long
-        // Current relative time (as received from the bus) / Aktuelle Relativ-Zeit (wie vom Bus erhalten)
-
-    #define I3_RES_FZD_STAT_ESH_TEMPERATUR_UEBERWACHUNG              (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_ESH_TEMPERATUR_UEBERWACHUNG_UNIT         '0/1'
-    #define I3_RES_FZD_STAT_ESH_TEMPERATUR_UEBERWACHUNG_TYPE         unsigned char
-        // Status activation temperature monitoring 0x00: Off 0x01: On / Status Aktivierung Temperaturüberwachung 0x00:
-        // Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_ESH_EKS_AKTIV                            (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_ESH_EKS_AKTIV_UNIT                       '0/1'
-    #define I3_RES_FZD_STAT_ESH_EKS_AKTIV_TYPE                       unsigned char
-        // EKS activation status 0x00: Off 0x01: On / Status Aktivierung EKS 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_DEAKTIVIERT                 (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_DEAKTIVIERT_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_ESH_FREIGABE_DEAKTIVIERT_TYPE            unsigned char
-        // Status link enable 0x00: Off 0x01: On / Status Verknüpfung Freigabe 0x00: Aus 0x01: Ein
-
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_DEAKTIVIERT               (RXBUF_UCHAR(19))
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_DEAKTIVIERT_UNIT          '0/1'
-    #define I3_RES_FZD_STAT_ESH_PANIKMODUS_DEAKTIVIERT_TYPE          unsigned char
-        // Status link enable panic mode 0x00: Panic mode active 0x01: Panic mode deactivated / Status Verknüpfung
-        // Freigabe Panikmodus 0x00: Panikmodus aktiv 0x01: Panikmodus deaktiviert
-
-    #define I3_RES_FZD_STAT_ESH_RESERVE_0XD1BD                       (RXBUF_UINT32(20))
-    #define I3_RES_FZD_STAT_ESH_RESERVE_0XD1BD_UNIT                  '0-n'
-    #define I3_RES_FZD_STAT_ESH_RESERVE_0XD1BD_TYPE                  unsigned long
-        // Reserve for extensions / Reserve für Erweiterungen
-
-#define I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN                        0xD1BE
-        // Reading out the statistic counter of the sunroof / Auslesen des Statistikzählers Schiebedach
-
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH               (RXBUF_UINT(0))
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_UNIT          '0-n'
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_TYPE          unsigned short
-        // Number of automatic readjustments / Anzahl automatische Nachnormierungen
-
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL                   (RXBUF_UINT(2))
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL_UNIT              '0-n'
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL_TYPE              unsigned short
-        // Number of manual readjustments / Anzahl manuelle Nachnormierungen
-
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY                      (RXBUF_UINT(4))
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY_UNIT                 '0-n'
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY_TYPE                 unsigned short
-        // Procedure in Emergnecy Close / Verfahren im Emergnecy Close
-
-    #define I3_RES_FZD_STAT_PANIC                                    (RXBUF_UINT(6))
-    #define I3_RES_FZD_STAT_PANIC_UNIT                               '0-n'
-    #define I3_RES_FZD_STAT_PANIC_TYPE                               unsigned short
-        // Procedure in panic mode / Verfahren im Panic Mode
-
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS                    (RXBUF_UINT(8))
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS_TYPE               unsigned short
-        // Number of reversing processes in normal mode / Anzahl der Reversiervorgänge im Normalmode
-
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY                    (RXBUF_UINT(10))
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY_TYPE               unsigned short
-        // Number of reversing processes in emergency mode / Anzahl Reversiervorgänge im Emergency Mode
-
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF                        (RXBUF_UINT(12))
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF_TYPE                   unsigned short
-        // Number of times the engine has aborted / Anzahl der Abbrüche des Motorlaufs
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH                   (RXBUF_UINT(14))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH_UNIT              '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH_TYPE              unsigned short
-        // Number of opening processes in the range 0-80 km / h / Anzahl Vorgänge Öffnen im Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH                     (RXBUF_UINT(16))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH_UNIT                '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH_TYPE                unsigned short
-        // Number of lifting operations / fan position in the range 0-80 km / h / Anzahl Vorgänge Heben/Lüfterposition im
-        // Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH                (RXBUF_UINT(18))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_UNIT           '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_TYPE           unsigned short
-        // Number of closing processes in the range 0-80 km / h / Anzahl Vorgänge Schliessen im Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH                  (RXBUF_UINT(20))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH_TYPE             unsigned short
-        // Number of opening processes in the range 80-120 km / h / Anzahl Vorgänge Öffnen im Bereich 80-120 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH                    (RXBUF_UINT(22))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH_TYPE               unsigned short
-        // Number of lifting operations / fan position in the range 80-120 km / h / Anzahl Vorgänge Heben/Lüfterposition
-        // im Bereich 80-120  km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH               (RXBUF_UINT(24))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_UNIT          '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_TYPE          unsigned short
-        // Number of closing processes in the range 80-120 km / h / Anzahl Vorgänge Schliessen im Bereich 80-120 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH                  (RXBUF_UINT(26))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH_TYPE             unsigned short
-        // Number of opening processes in the range 120-160 km / h / Anzahl Vorgänge Öffnen im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH                    (RXBUF_UINT(28))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH_TYPE               unsigned short
-        // Number of lifting operations / fan position in the range 120-160 km / h / Anzahl Vorgänge Heben/Lüfterposition
-        // im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH               (RXBUF_UINT(30))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_UNIT          '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_TYPE          unsigned short
-        // Number of processes closing in the range 120-160 km / h / Anzahl Vorgänge Schliessen im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH                  (RXBUF_UINT(32))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH_UNIT             '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH_TYPE             unsigned short
-        // Number of opening processes in the range> 160 km / h / Anzahl Vorgänge Öffnen im Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH                    (RXBUF_UINT(34))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH_TYPE               unsigned short
-        // Number of lifting operations / fan position in the range> 160 km / h / Anzahl Vorgänge Heben/Lüfterposition im
-        // Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH               (RXBUF_UINT(36))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_UNIT          '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_TYPE          unsigned short
-        // Number of closing processes in the range> 160 km / h / Anzahl Vorgänge Schliessen im Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD            (RXBUF_UINT(38))
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_UNIT       '0-n'
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_TYPE       unsigned short
-        // Actuation at minus 10 degrees / Betätigungen bei minus 10 Grad
-
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD                     (RXBUF_UINT(40))
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD_UNIT                '0-n'
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD_TYPE                unsigned short
-        // Reversing processes at less than 0 degrees / Reversiervorgänge bei kleiner 0 Grad
-
-    #define I3_RES_FZD_STAT_RESERVE_1                                (RXBUF_UINT32(42))
-    #define I3_RES_FZD_STAT_RESERVE_1_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_1_TYPE                           unsigned long
-        // Reserve 1 / Reserve 1
-
-    #define I3_RES_FZD_STAT_RESERVE_2                                (RXBUF_UINT32(46))
-    #define I3_RES_FZD_STAT_RESERVE_2_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_2_TYPE                           unsigned long
-        // Reserve 2 / Reserve 2
-
-    #define I3_RES_FZD_STAT_RESERVE_3                                (RXBUF_UINT32(50))
-    #define I3_RES_FZD_STAT_RESERVE_3_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_3_TYPE                           unsigned long
-        // Reserve 3 / Reserve 3
-
-    #define I3_RES_FZD_STAT_RESERVE_4                                (RXBUF_UINT32(54))
-    #define I3_RES_FZD_STAT_RESERVE_4_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_4_TYPE                           unsigned long
-        // Reserve 4 / Reserve 4
-
-    #define I3_RES_FZD_STAT_RESERVE_5                                (RXBUF_UINT32(58))
-    #define I3_RES_FZD_STAT_RESERVE_5_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_5_TYPE                           unsigned long
-        // Reserve 5 / Reserve 5
-
-    #define I3_RES_FZD_STAT_RESERVE_6                                (RXBUF_UINT(62))
-    #define I3_RES_FZD_STAT_RESERVE_6_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_6_TYPE                           unsigned short
-        // Reserve 6 / Reserve 6
-
-// Skipping SHD_STATISTIKZAEHLER_LOESCHEN on 0xD1BF which takes arguments
-
-#define I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN                        0xD1C0
-        // Reading out the statistics counter for the electric sliding headliner / Auslesen des Statistikzähler
-        // elektrischer Schiebehimmel
-
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0        (RXBUF_UINT(0))
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0_UNIT   '0-n'
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0_TYPE   unsigned short
-        // Number of automatic readjustments / Anzahl automatische Nachnormierungen
-
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL_0XD1C0            (RXBUF_UINT(2))
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL_0XD1C0_UNIT       '0-n'
-    #define I3_RES_FZD_STAT_NACHNORMIERUNG_MANUELL_0XD1C0_TYPE       unsigned short
-        // Number of manual readjustments / Anzahl manuelle Nachnormierungen
-
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY_0XD1C0               (RXBUF_UINT(4))
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY_0XD1C0_UNIT          '0-n'
-    #define I3_RES_FZD_STAT_VERFAHREN_EMERGENCY_0XD1C0_TYPE          unsigned short
-        // Procedure in Emergnecy Close / Verfahren im Emergnecy Close
-
-    #define I3_RES_FZD_STAT_PANIC_0XD1C0                             (RXBUF_UINT(6))
-    #define I3_RES_FZD_STAT_PANIC_0XD1C0_UNIT                        '0-n'
-    #define I3_RES_FZD_STAT_PANIC_0XD1C0_TYPE                        unsigned short
-        // Procedure in panic mode / Verfahren im Panic Mode
-
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS_0XD1C0             (RXBUF_UINT(8))
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS_0XD1C0_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_REVERSIER_NORMALMODUS_0XD1C0_TYPE        unsigned short
-        // Number of reversing processes in normal mode / Anzahl der Reversiervorgänge im Normalmode
-
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY_0XD1C0             (RXBUF_UINT(10))
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY_0XD1C0_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_REVERSIERER_EMERGENCY_0XD1C0_TYPE        unsigned short
-        // Number of reversing processes in emergency mode / Anzahl Reversiervorgänge im Emergency Mode
-
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF_0XD1C0                 (RXBUF_UINT(12))
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF_0XD1C0_UNIT            '0-n'
-    #define I3_RES_FZD_STAT_ABBRUCH_MOTORLAUF_0XD1C0_TYPE            unsigned short
-        // Number of times the engine has aborted / Anzahl der Abbrüche des Motorlaufs
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0            (RXBUF_UINT(14))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0_UNIT       '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0_TYPE       unsigned short
-        // Number of opening processes in the range 0-80 km / h / Anzahl Vorgänge Öffnen im Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH_0XD1C0              (RXBUF_UINT(16))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH_0XD1C0_UNIT         '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_80_KMH_0XD1C0_TYPE         unsigned short
-        // Number of lifting operations / fan position in the range 0-80 km / h / Anzahl Vorgänge Heben/Lüfterposition im
-        // Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0         (RXBUF_UINT(18))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0_UNIT    '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0_TYPE    unsigned short
-        // Number of closing processes in the range 0-80 km / h / Anzahl Vorgänge Schliessen im Bereich 0-80 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0           (RXBUF_UINT(20))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0_UNIT      '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0_TYPE      unsigned short
-        // Number of opening processes in the range 80-120 km / h / Anzahl Vorgänge Öffnen im Bereich 80-120 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH_0XD1C0             (RXBUF_UINT(22))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH_0XD1C0_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_120_KMH_0XD1C0_TYPE        unsigned short
-        // Number of lifting operations / fan position in the range 80-120 km / h / Anzahl Vorgänge Heben/Lüfterposition
-        // im Bereich 80-120  km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0        (RXBUF_UINT(24))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0_UNIT   '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0_TYPE   unsigned short
-        // Number of closing processes in the range 80-120 km / h / Anzahl Vorgänge Schliessen im Bereich 80-120 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0           (RXBUF_UINT(26))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0_UNIT      '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0_TYPE      unsigned short
-        // Number of opening processes in the range 120-160 km / h / Anzahl Vorgänge Öffnen im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH_0XD1C0             (RXBUF_UINT(28))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH_0XD1C0_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_160_KMH_0XD1C0_TYPE        unsigned short
-        // Number of lifting operations / fan position in the range 120-160 km / h / Anzahl Vorgänge Heben/Lüfterposition
-        // im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0        (RXBUF_UINT(30))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0_UNIT   '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0_TYPE   unsigned short
-        // Number of processes closing in the range 120-160 km / h / Anzahl Vorgänge Schliessen im Bereich 120-160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0           (RXBUF_UINT(32))
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0_UNIT      '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0_TYPE      unsigned short
-        // Number of opening processes in the range> 160 km / h / Anzahl Vorgänge Öffnen im Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH_0XD1C0             (RXBUF_UINT(34))
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH_0XD1C0_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_HEBEN_300_KMH_0XD1C0_TYPE        unsigned short
-        // Number of lifting operations / fan position in the range> 160 km / h / Anzahl Vorgänge Heben/Lüfterposition im
-        // Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0        (RXBUF_UINT(36))
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0_UNIT   '0-n'
-    #define I3_RES_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0_TYPE   unsigned short
-        // Number of closing processes in the range> 160 km / h / Anzahl Vorgänge Schliessen im Bereich > 160 km/h
-
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0     (RXBUF_UINT(38))
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0_UNIT '0-n'
-    #define I3_RES_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0_TYPE unsigned short
-        // Actuation at minus 10 degrees / Betätigungen bei minus 10 Grad
-
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD_0XD1C0              (RXBUF_UINT(40))
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD_0XD1C0_UNIT         '0-n'
-    #define I3_RES_FZD_STAT_REVERSIER_BEI_0_GRAD_0XD1C0_TYPE         unsigned short
-        // Reversing processes at less than 0 degrees / Reversiervorgänge bei kleiner 0 Grad
-
-    #define I3_RES_FZD_STAT_RESERVE_1_0XD1C0                         (RXBUF_UINT32(42))
-    #define I3_RES_FZD_STAT_RESERVE_1_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_1_0XD1C0_TYPE                    unsigned long
-        // Reserve 1 / Reserve 1
-
-    #define I3_RES_FZD_STAT_RESERVE_2_0XD1C0                         (RXBUF_UINT32(46))
-    #define I3_RES_FZD_STAT_RESERVE_2_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_2_0XD1C0_TYPE                    unsigned long
-        // Reserve 2 / Reserve 2
-
-    #define I3_RES_FZD_STAT_RESERVE_3_0XD1C0                         (RXBUF_UINT32(50))
-    #define I3_RES_FZD_STAT_RESERVE_3_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_3_0XD1C0_TYPE                    unsigned long
-        // Reserve 3 / Reserve 3
-
-    #define I3_RES_FZD_STAT_RESERVE_4_0XD1C0                         (RXBUF_UINT32(54))
-    #define I3_RES_FZD_STAT_RESERVE_4_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_4_0XD1C0_TYPE                    unsigned long
-        // Reserve 4 / Reserve 4
-
-    #define I3_RES_FZD_STAT_RESERVE_5_0XD1C0                         (RXBUF_UINT32(58))
-    #define I3_RES_FZD_STAT_RESERVE_5_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_5_0XD1C0_TYPE                    unsigned long
-        // Reserve 5 / Reserve 5
-
-    #define I3_RES_FZD_STAT_RESERVE_6_0XD1C0                         (RXBUF_UINT(62))
-    #define I3_RES_FZD_STAT_RESERVE_6_0XD1C0_UNIT                    '0-n'
-    #define I3_RES_FZD_STAT_RESERVE_6_0XD1C0_TYPE                    unsigned short
-        // Reserve 6 / Reserve 6
-
-// Skipping ESH_STATISTIKZAEHLER_LOESCHEN on 0xD1C1 which takes arguments
-
-#define I3_PID_FZD_DWA_SINE_LIN                                      0xDCA1
-        // 0: No LIN siren installed 1: LIN siren installed / 0: Keine LIN-Sirene verbaut 1: LIN-Sirene verbaut
-
-    #define I3_RES_FZD_STAT_VORHANDEN_LIN_SIRENE                     (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_VORHANDEN_LIN_SIRENE_UNIT                '0/1'
-    #define I3_RES_FZD_STAT_VORHANDEN_LIN_SIRENE_TYPE                char
-        // 0: No LIN siren installed 1: LIN siren installed / 0: Keine LIN-Sirene verbaut 1: LIN-Sirene verbaut
-
-#define I3_PID_FZD_DWA_SINE                                          0xDCA2
-        // Status of the siren / tilt sensor / Status der Sirene / Neigungsgeber
-
-    #define I3_RES_FZD_STAT_LEITUNG_NR                               (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_LEITUNG_NR_UNIT                          '0-n'
-    #define I3_RES_FZD_STAT_LEITUNG_NR_TYPE                          char
-        // Line monitoring status / Status der Leitungsüberwachung
-
-    #define I3_RES_FZD_STAT_UNTERSPANNUNG_EXT_NR                     (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_UNTERSPANNUNG_EXT_NR_UNIT                '0-n'
-    #define I3_RES_FZD_STAT_UNTERSPANNUNG_EXT_NR_TYPE                char
-        // Status of undervoltage monitoring of the external battery / Status Unterspannungsüberwachung der externen
-        // Batterie
-
-    #define I3_RES_FZD_STAT_EEPROM_NR                                (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_EEPROM_NR_UNIT                           '0-n'
-    #define I3_RES_FZD_STAT_EEPROM_NR_TYPE                           char
-        // EEPROM monitoring status / Status Überwachnung EEPROM
-
-    #define I3_RES_FZD_STAT_AKTIVER_SCHUTZ_NR                        (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_AKTIVER_SCHUTZ_NR_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_AKTIVER_SCHUTZ_NR_TYPE                   char
-        // Active protection status / Status Aktiver Schutz
-
-    #define I3_RES_FZD_STAT_WAKE_UP_NR                               (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_WAKE_UP_NR_UNIT                          '0-n'
-    #define I3_RES_FZD_STAT_WAKE_UP_NR_TYPE                          char
-        // Status monitoring of the wake-up time / Status Überwachung der WakeUp-Zeit
-
-    #define I3_RES_FZD_STAT_SIRENE_AKUSTIK_NR                        (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_SIRENE_AKUSTIK_NR_UNIT                   '0-n'
-    #define I3_RES_FZD_STAT_SIRENE_AKUSTIK_NR_TYPE                   char
-        // Status siren circuit (acoustics) / Status Sirenenschaltkreis (Akustik)
-
-    #define I3_RES_FZD_STAT_TILT_NR                                  (RXBUF_UCHAR(6))
-    #define I3_RES_FZD_STAT_TILT_NR_UNIT                             '0-n'
-    #define I3_RES_FZD_STAT_TILT_NR_TYPE                             char
-        // Inclination sensor status / Status Neigungsgeber
-
-#define I3_PID_FZD_DWA_SINE_BATT_LEVEL                               0xDCA3
-        // Internal battery status: See table TAB_SINE_BATT_LEVEL / Status interne Batterie: Siehe Tabelle
-        // TAB_SINE_BATT_LEVEL
-
-    #define I3_RES_FZD_STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR        (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR_UNIT   '0-n'
-    #define I3_RES_FZD_STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR_TYPE   unsigned char
-        // Internal battery status: See table TAB_SINE_BATT_LEVEL / Status interne Batterie: Siehe Tabelle
-        // TAB_SINE_BATT_LEVEL
-
-// Skipping DWA_LED on 0xDCA8 which takes arguments
-
-#define I3_PID_FZD_DWA_SINE_NEIGUNG                                  0xDCA9
-        // Vehicle inclination angle (X and Y axes). / Neigungswinkel (X- und Y-Achse) des Fahrzeugs.
-
-    #define I3_RES_FZD_STAT_NEIGUNG_X_ACHSE_WERT                     (RXBUF_UINT(0))
-    #define I3_RES_FZD_STAT_NEIGUNG_X_ACHSE_WERT_UNIT                'Grad'
-    #define I3_RES_FZD_STAT_NEIGUNG_X_ACHSE_WERT_TYPE                unsigned short
-        // X-axis inclination angle in degrees / Neigungswinkel X-Achse in Grad
-
-    #define I3_RES_FZD_STAT_NEIGUNG_Y_ACHSE_WERT                     (RXBUF_UINT(2))
-    #define I3_RES_FZD_STAT_NEIGUNG_Y_ACHSE_WERT_UNIT                'Grad'
-    #define I3_RES_FZD_STAT_NEIGUNG_Y_ACHSE_WERT_TYPE                unsigned short
-        // Y-axis inclination angle in degrees / Neigungswinkel Y-Achse in Grad
-
-// Skipping DWA_CAR_KEY_MEMORY on 0xDCAA which takes arguments
-
-#define I3_PID_FZD_DWA_INTERN                                        0xDCAC
-        // 0: disarmed; / 0: entschärft;
-
-    #define I3_RES_FZD_STAT_DWA_INTERN_NR                            (RXBUF_UINT(0))
-    #define I3_RES_FZD_STAT_DWA_INTERN_NR_UNIT                       '0-n'
-    #define I3_RES_FZD_STAT_DWA_INTERN_NR_TYPE                       unsigned short
-        // 0: disarmed; / 0: entschärft;
-
-#define I3_PID_FZD_DWA_ALARM_AUSGELOEST                              0xDCB0
-        // Status which triggered the alarm / Status, welcher Alarm ausgelöst hat
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN      (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by bonnet; 1 = DWA alarm triggered by bonnet / 0= DWA-Alarm nicht ausgelöst durch
-        // Motorhaube; 1= DWA-Alarm ausgelöst durch Motorhaube
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_FAT_AUSGELOEST_EIN             (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_DWA_ALARM_FAT_AUSGELOEST_EIN_UNIT        '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_FAT_AUSGELOEST_EIN_TYPE        char
-        // 0 = DWA alarm not triggered by driver's door; 1 = DWA alarm triggered by driver's door / 0= DWA-Alarm nicht
-        // ausgelöst durch Fahrertür; 1= DWA-Alarm ausgelöst durch Fahrertür
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFT_AUSGELOEST_EIN             (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFT_AUSGELOEST_EIN_UNIT        '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFT_AUSGELOEST_EIN_TYPE        char
-        // 0 = DWA alarm not triggered by passenger door; 1 = DWA alarm triggered by passenger door / 0= DWA-Alarm nicht
-        // ausgelöst durch Beifahrertür; 1= DWA-Alarm ausgelöst durch Beifahrertür
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_FATH_AUSGELOEST_EIN            (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_DWA_ALARM_FATH_AUSGELOEST_EIN_UNIT       '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_FATH_AUSGELOEST_EIN_TYPE       char
-        // 0 = DWA alarm not triggered by the rear driver's door; 1 = DWA alarm triggered by the driver's rear door / 0=
-        // DWA-Alarm nicht ausgelöst durch Fahrertür hinten; 1= DWA-Alarm ausgelöst durch Fahrertür hinten
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN            (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN_UNIT       '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN_TYPE       char
-        // 0 = DWA alarm not triggered by rear passenger door; 1 = DWA alarm triggered by the rear passenger door / 0=
-        // DWA-Alarm nicht ausgelöst durch Beifahrertür hinten ; 1= DWA-Alarm ausgelöst durch Beifahrertür hinten
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN      (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by tailgate; 1 = DWA alarm triggered by tailgate / 0= DWA-Alarm nicht ausgelöst
-        // durch Heckklappe; 1= DWA-Alarm ausgelöst durch Heckklappe
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN     (RXBUF_UCHAR(6))
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by rear window; 1 = DWA alarm triggered by rear window / 0= DWA-Alarm nicht
-        // ausgelöst durch Heckscheibe; 1= DWA-Alarm ausgelöst durch Heckscheibe
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN          (RXBUF_UCHAR(7))
-    #define I3_RES_FZD_STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN_TYPE     char
-        // 0 = DWA alarm not triggered by OBD communication; 1 = DWA alarm triggered by OBD communication / 0= DWA-Alarm
-        // nicht ausgelöst durch OBD-Kommunikation; 1= DWA-Alarm ausgelöst durch OBD-Kommunikation
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN (RXBUF_UCHAR(8))
-    #define I3_RES_FZD_STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by line monitoring SINE; 1 = DWA alarm triggered by SINE line monitoring / 0=
-        // DWA-Alarm nicht ausgelöst durch Leitungsüberwachung SINE; 1= DWA-Alarm ausgelöst durch Leitungsüberwachung
-        // SINE
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN (RXBUF_UCHAR(9))
-    #define I3_RES_FZD_STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by manipulation authentication; 1 = DWA alarm triggered by manipulation
-        // authentication / 0= DWA-Alarm nicht ausgelöst durch Manipulation Authentisierung; 1= DWA-Alarm ausgelöst durch
-        // Manipulation Authentisierung
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN    (RXBUF_UCHAR(10))
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by interior protection A and B; 1 = DWA alarm triggered by interior protection A
-        // and B / 0= DWA-Alarm nicht ausgelöst durch Innenraumschutz A und B; 1= DWA-Alarm ausgelöst durch
-        // Innenraumschutz A und B
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN          (RXBUF_UCHAR(11))
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN_TYPE     char
-        // 0 = DWA alarm not triggered by interior protection A; 1 = DWA alarm triggered by interior protection A / 0=
-        // DWA-Alarm nicht ausgelöst durch Innenraumschutz A; 1= DWA-Alarm ausgelöst durch Innenraumschutz A
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN          (RXBUF_UCHAR(12))
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN_UNIT     '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN_TYPE     char
-        // 0 = DWA alarm not triggered by interior protection B; 1 = DWA alarm triggered by interior protection B / 0=
-        // DWA-Alarm nicht ausgelöst durch Innenraumschutz B; 1= DWA-Alarm ausgelöst durch Innenraumschutz B
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN (RXBUF_UCHAR(13))
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by X-axis inclination sensor; 1 = DWA alarm triggered by inclination sensor X-axis
-        // / 0= DWA-Alarm nicht ausgelöst durch Neigungsgeber X-Achse; 1= DWA-Alarm ausgelöst durch Neigungsgeber X-Achse
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN (RXBUF_UCHAR(14))
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by Y-axis inclination sensor; 1 = DWA alarm triggered by inclination sensor Y-axis
-        // / 0= DWA-Alarm nicht ausgelöst durch Neigungsgeber Y-Achse; 1= DWA-Alarm ausgelöst durch Neigungsgeber Y-Achse
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN (RXBUF_UCHAR(15))
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN_UNIT '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN_TYPE char
-        // 0 = DWA alarm not triggered by inclination sensor X and Y axis; 1 = DWA alarm triggered by inclination sensor
-        // X and Y axis / 0= DWA-Alarm nicht ausgelöst durch Neigungsgeber X- und Y-Achse; 1= DWA-Alarm ausgelöst durch
-        // Neigungsgeber X- und Y-Achse
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_SPANNUNG_EIN              (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_SPANNUNG_EIN_UNIT         '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_SPANNUNG_EIN_TYPE         char
-        // 0 = DWA alarm not triggered by SINE power supply; 1 = DWA alarm triggered by SINE power supply / 0= DWA-Alarm
-        // nicht ausgelöst durch SINE Spannungsversorgung; 1= DWA-Alarm ausgelöst durch SINE Spannungsversorgung
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN         (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN_UNIT    '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN_TYPE    char
-        // 0 = DWA alarm not triggered by SINE no LIN telegram can be sent; 1 = DWA alarm triggered by SINE no LIN
-        // telegram can be sent / 0= DWA-Alarm nicht ausgelöst durch SINE kein LIN-Telegramm absetzbar; 1= DWA-Alarm
-        // ausgelöst durch SINE kein LIN-Telegramm absetzbar
-
-    #define I3_RES_FZD_STAT_DWA_ALARM_PANIKALARM_EIN                 (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_DWA_ALARM_PANIKALARM_EIN_UNIT            '0/1'
-    #define I3_RES_FZD_STAT_DWA_ALARM_PANIKALARM_EIN_TYPE            char
-        // 0 = DWA alarm not triggered by panic alarm; 1 = DWA alarm triggered by panic alarm / 0= DWA-Alarm nicht
-        // ausgelöst durch Panikalarm; 1= DWA-Alarm ausgelöst durch Panikalarm
-
-#define I3_PID_FZD_DWA_VORHANDEN                                     0xDCB1
-        // 0: No DWA installed 1: DWA installed / 0: Keine DWA verbaut 1: DWA verbaut
-
-    #define I3_RES_FZD_STAT_VORHANDEN_DWA                            (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_VORHANDEN_DWA_UNIT                       '0/1'
-    #define I3_RES_FZD_STAT_VORHANDEN_DWA_TYPE                       char
-        // 0: No DWA installed 1: DWA installed / 0: Keine DWA verbaut 1: DWA verbaut
-
-#define I3_PID_FZD_DWA_USIS_EMPFINDLICHKEIT                          0xDCB2
-        // Current sensitivity level / Aktuelle Empflindlichkeitsstufe
-
-    #define I3_RES_FZD_STAT_IRS_SENS_EMPFINDLICHKEIT_NR              (RXBUF_UINT(0))
-    #define I3_RES_FZD_STAT_IRS_SENS_EMPFINDLICHKEIT_NR_UNIT         '0-n'
-    #define I3_RES_FZD_STAT_IRS_SENS_EMPFINDLICHKEIT_NR_TYPE         unsigned short
-        // Current sensitivity level / Aktuelle Empflindlichkeitsstufe
-
-// Skipping DWA_SCHNELLTEST on 0xDCB5 which takes arguments
-
-#define I3_PID_FZD_DWA_KLAPPENKONTAKTE                               0xDCDD
-        // Status of the flap contacts read / Status der eingelesenen Klappenkontakte
-
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_NR                    (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_NR_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_NR_TYPE               unsigned char
-        // Contact driver's door / Kontakt Fahrertür
-
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_NR                 (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_NR_UNIT            '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_NR_TYPE            unsigned char
-        // Contact passenger door / Kontakt Beifahrertür
-
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_HINTEN_NR             (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_HINTEN_NR_UNIT        '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_FAHRERTUER_HINTEN_NR_TYPE        unsigned char
-        // Contact at the rear of the driver's door / Kontakt Fahrertür hinten
-
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR          (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR_UNIT     '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR_TYPE     unsigned char
-        // Contact rear passenger door / Kontakt Beifahrertür hinten
-
-    #define I3_RES_FZD_STAT_KONTAKT_MOTORHAUBE_NR                    (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_KONTAKT_MOTORHAUBE_NR_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_MOTORHAUBE_NR_TYPE               unsigned char
-        // Contact bonnet / Kontakt Motorhaube
-
-    #define I3_RES_FZD_STAT_KONTAKT_HECKKLAPPE_NR                    (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_KONTAKT_HECKKLAPPE_NR_UNIT               '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_HECKKLAPPE_NR_TYPE               unsigned char
-        // Contact tailgate / Kontakt Heckklappe
-
-    #define I3_RES_FZD_STAT_KONTAKT_HECKSCHEIBE_NR                   (RXBUF_UCHAR(6))
-    #define I3_RES_FZD_STAT_KONTAKT_HECKSCHEIBE_NR_UNIT              '0-n'
-    #define I3_RES_FZD_STAT_KONTAKT_HECKSCHEIBE_NR_TYPE              unsigned char
-        // Contact rear window / Kontakt Heckscheibe
-
-    #define I3_RES_FZD_STAT_ZV_NR                                    (RXBUF_UCHAR(7))
-    #define I3_RES_FZD_STAT_ZV_NR_UNIT                               '0-n'
-    #define I3_RES_FZD_STAT_ZV_NR_TYPE                               unsigned char
-        // Central locking status / Status Zentralverriegelung
-
-    #define I3_RES_FZD_STAT_RESERVE_WERT                             (RXBUF_UINT32(8))
-    #define I3_RES_FZD_STAT_RESERVE_WERT_UNIT                        'HEX'
-    #define I3_RES_FZD_STAT_RESERVE_WERT_TYPE                        unsigned long
-        // Reserve (not yet occupied) / Reserve (noch nicht belegt)
-
-// Skipping OBD_UEBERWACHUNG on 0xDD16 which takes arguments
-
-// Skipping SHD_ESH_THERMOMONITOR on 0x4100 which takes arguments
-
-// Skipping SHD_ESH_FREIGABE_AKTIV on 0x4101 which takes arguments
-
-// Skipping SHD_ESH_EMERGENCY_PANIC on 0x4103 which takes arguments
-
-#define I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE               0x4107
-        // ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE / ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_DATA of type data[128] at offset 0. But we account for the 128 bytes
-        // Speed value over the travel path of the first block / Drehzahlwert über dem Verfahrweg erster Block
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_2_DATA of type data[128] at offset 128. But we account for the 128 bytes
-        // Speed value over the travel distance of the second block / Drehzahlwert über dem Verfahrweg zweiter Block
-
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT                        (RXBUF_UINT(256))
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_UNIT                   's'
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_TYPE                   unsigned short
-        // Closing time during the initialization process. Resolution 10ms steps / Schliesszeit beim
-        // Initialisierungsvorgang. Auflösung 10ms Schritte
-
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT                         (RXBUF_UCHAR(258))
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_UNIT                    'V'
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_TYPE                    unsigned char
-        // Voltage that is applied to the window regulator during initialization. Resolution 100mV steps / Spannung die
-        // am Fensterheber während dem Initialisieren anliegt. Auflösung 100mV Schritte
-
-    #define I3_RES_FZD_STAT_SPIEL_WERT                               (RXBUF_UCHAR(259))
-    #define I3_RES_FZD_STAT_SPIEL_WERT_TYPE                          unsigned char
-        // Number of hall increments / Anzahl Hall Inkremente
-
-    #define I3_RES_FZD_STAT_GUELTIGKEIT                              (RXBUF_UCHAR(260))
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_UNIT                         '0/1'
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_TYPE                         unsigned char
-        // 0x00 characteristic curve invalid 0x01 characteristic curve valid / 0x00 Kennlinie ungültig 0x01 Kennlinie
-        // gültig
-
-    #define I3_RES_FZD_STAT_BEWERTUNG                                (RXBUF_UCHAR(261))
-    #define I3_RES_FZD_STAT_BEWERTUNG_UNIT                           '0/1'
-    #define I3_RES_FZD_STAT_BEWERTUNG_TYPE                           unsigned char
-        // 0x00 Characteristic curve OK 0x01 Characteristic curve not OK / 0x00 Kennlinie in Ordnung  0x01 Kennlinie
-        // nicht in Ordnung
-
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT                     (RXBUF_UCHAR(262))
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT_TYPE                unsigned char
-        // to clarify / zu klären
-
-#define I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1            0x4108
-        // SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1 / SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_DATA_0X4108 of type data[128] at offset 0. But we account for the 128 bytes
-        // Speed value over the travel path of the first block / Drehzahlwert über dem Verfahrweg erster Block
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_2_DATA_0X4108 of type data[128] at offset 128. But we account for the 128 bytes
-        // Speed value over the travel distance of the second block / Drehzahlwert über dem Verfahrweg zweiter Block
-
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4108                 (RXBUF_UINT(256))
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4108_UNIT            's'
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4108_TYPE            unsigned short
-        // Closing time during the initialization process. Resolution 10ms steps / Schliesszeit beim
-        // Initialisierungsvorgang. Auflösung 10ms Schritte
-
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4108                  (RXBUF_UCHAR(258))
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4108_UNIT             'V'
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4108_TYPE             unsigned char
-        // Voltage that is applied to the window regulator during initialization. Resolution 100mV steps / Spannung die
-        // am Fensterheber während dem Initialisieren anliegt. Auflösung 100mV Schritte
-
-    #define I3_RES_FZD_STAT_SPIEL_WERT_0X4108                        (RXBUF_UCHAR(259))
-    #define I3_RES_FZD_STAT_SPIEL_WERT_0X4108_TYPE                   unsigned char
-        // Number of hall increments / Anzahl Hall Inkremente
-
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4108                       (RXBUF_UCHAR(260))
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4108_UNIT                  '0/1'
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4108_TYPE                  unsigned char
-        // 0x00 characteristic curve invalid 0x01 characteristic curve valid / 0x00 Kennlinie ungültig 0x01 Kennlinie
-        // gültig
-
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4108                         (RXBUF_UCHAR(261))
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4108_UNIT                    '0/1'
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4108_TYPE                    unsigned char
-        // 0x00 Characteristic curve OK 0x01 Characteristic curve not OK / 0x00 Kennlinie in Ordnung 0x01 Kennlinie nicht
-        // in Ordnung
-
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT_0X4108              (RXBUF_UCHAR(262))
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT_0X4108_TYPE         unsigned char
-        // to clarify / zu klären
-
-#define I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1             0x4109
-        // SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1 / SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_DATA_0X4109 of type data[128] at offset 0. But we account for the 128 bytes
-        // Speed value over the travel path of the first block / Drehzahlwert über dem Verfahrweg erster Block
-
-    // Can't yet generate code for STAT_KENNLINIENDATEN_2_DATA_0X4109 of type data[128] at offset 128. But we account for the 128 bytes
-        // Speed value over the travel distance of the second block / Drehzahlwert über dem Verfahrweg zweiter Block
-
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4109                 (RXBUF_UINT(256))
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4109_UNIT            's'
-    #define I3_RES_FZD_STAT_SCHLIESSZEIT_WERT_0X4109_TYPE            unsigned short
-        // Closing time during the initialization process. Resolution 10ms steps / Schliesszeit beim
-        // Initialisierungsvorgang. Auflösung 10ms Schritte
-
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4109                  (RXBUF_UCHAR(258))
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4109_UNIT             'V'
-    #define I3_RES_FZD_STAT_BN_SPANNUNG_WERT_0X4109_TYPE             unsigned char
-        // Voltage that is applied to the window regulator during initialization. Resolution 100mV steps / Spannung die
-        // am Fensterheber während dem Initialisieren anliegt. Auflösung 100mV Schritte
-
-    #define I3_RES_FZD_STAT_SPIEL_WERT_0X4109                        (RXBUF_UCHAR(259))
-    #define I3_RES_FZD_STAT_SPIEL_WERT_0X4109_TYPE                   unsigned char
-        // Number of hall increments / Anzahl Hall Inkremente
-
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4109                       (RXBUF_UCHAR(260))
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4109_UNIT                  '0/1'
-    #define I3_RES_FZD_STAT_GUELTIGKEIT_0X4109_TYPE                  unsigned char
-        // 0x00 characteristic curve invalid 0x01 characteristic curve valid / 0x00 Kennlinie ungültig 0x01 Kennlinie
-        // gültig
-
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4109                         (RXBUF_UCHAR(261))
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4109_UNIT                    '0/1'
-    #define I3_RES_FZD_STAT_BEWERTUNG_0X4109_TYPE                    unsigned char
-        // 0x00 Characteristic curve OK 0x01 Characteristic curve not OK / 0x00 Kennlinie in Ordnung  0x01 Kennlinie
-        // nicht in Ordnung
-
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT_0X4109              (RXBUF_UCHAR(262))
-    #define I3_RES_FZD_STAT_REGELVERLETZUNG_WERT_0X4109_TYPE         unsigned char
-        // to clarify / zu klären
-
-#define I3_PID_FZD_DWA_ALARM_ANZAHL                                  0x6012
-        // Number of triggered alarms / Anzahl ausgelöster Alarme
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_MOTORHAUBE_WERT                (RXBUF_UCHAR(0))
-    #define I3_RES_FZD_STAT_FZD_ALARM_MOTORHAUBE_WERT_UNIT           'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_MOTORHAUBE_WERT_TYPE           unsigned char
-        // Number of alarms for flap contact, bonnet / Anzahl Alarme Klappenkontakt MotorHaube
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_FAT_WERT                       (RXBUF_UCHAR(1))
-    #define I3_RES_FZD_STAT_FZD_ALARM_FAT_WERT_UNIT                  'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_FAT_WERT_TYPE                  unsigned char
-        // Number of alarms for flap contact for driver's door / Anzahl Alarme Klappenkontakt FAhrerTür
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFT_WERT                       (RXBUF_UCHAR(2))
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFT_WERT_UNIT                  'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFT_WERT_TYPE                  unsigned char
-        // Number of alarms for flap contact at driver's door / Anzahl Alarme Klappenkontakt BeiFahrerTür
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_FATH_WERT                      (RXBUF_UCHAR(3))
-    #define I3_RES_FZD_STAT_FZD_ALARM_FATH_WERT_UNIT                 'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_FATH_WERT_TYPE                 unsigned char
-        // Number of alarms for flap contact at the rear of the driver's door / Anzahl Alarme Klappenkontakt FAhrerTür
-        // Hinten
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFTH_WERT                      (RXBUF_UCHAR(4))
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFTH_WERT_UNIT                 'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_BFTH_WERT_TYPE                 unsigned char
-        // Number of alarms for flap contact at the rear door of the driver / Anzahl Alarme Klappenkontakt BeiFahrerTür
-        // Hinten
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKKLAPPE_WERT                (RXBUF_UCHAR(5))
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKKLAPPE_WERT_UNIT           'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKKLAPPE_WERT_TYPE           unsigned char
-        // Number of tailgate alarms / Anzahl Alarme Heckklappe
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKSCHEIBE_WERT               (RXBUF_UCHAR(6))
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKSCHEIBE_WERT_UNIT          'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_HECKSCHEIBE_WERT_TYPE          unsigned char
-        // Number of alarms rear window / Anzahl Alarme Heckscheibe
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT         (RXBUF_UCHAR(7))
-    #define I3_RES_FZD_STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT_UNIT    'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT_TYPE    unsigned char
-        // Number of OBD communication alarms / Anzahl Alarme OBD-Kommunikation
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT (RXBUF_UCHAR(8))
-    #define I3_RES_FZD_STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT_UNIT 'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT_TYPE unsigned char
-        // Number of alarms line monitoring LIN-SINE / Anzahl Alarme Leitungsüberwachung LIN-SINE
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_MANIPULATION_AUTH_WERT         (RXBUF_UCHAR(9))
-    #define I3_RES_FZD_STAT_FZD_ALARM_MANIPULATION_AUTH_WERT_UNIT    'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_MANIPULATION_AUTH_WERT_TYPE    unsigned char
-        // Number of alarms Tamper protection authentication / Anzahl Alarme Manipulationsschutz Authentifizierung
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT        (RXBUF_UCHAR(10))
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT_UNIT   'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT_TYPE   unsigned char
-        // Number of USIS alarms simultaneously on channel A and B (right + left) / Anzahl USIS-Alarme gleichzeitig auf
-        // Kanal A und B (rechts + links)
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_WERT              (RXBUF_UCHAR(11))
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_WERT_UNIT         'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_A_WERT_TYPE         unsigned char
-        // Number of USIS alarms only on channel A (right) / Anzahl USIS-Alarme nur auf Kanal A (rechts)
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_B_WERT              (RXBUF_UCHAR(12))
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_B_WERT_UNIT         'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_USIS_KANAL_B_WERT_TYPE         unsigned char
-        // Number of USIS alarms only on channel B (left) / Anzahl USIS-Alarme nur auf Kanal B (links)
-
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT          (RXBUF_UCHAR(13))
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT_UNIT     'count'
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT_TYPE     unsigned char
-        // Number of alarms inclination sensor X-axis / Anzahl Alarme Neigungsgeber X-Achse
-
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT          (RXBUF_UCHAR(14))
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT_UNIT     'count'
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT_TYPE     unsigned char
-        // Number of alarms inclination sensor Y-axis / Anzahl Alarme Neigungsgeber Y-Achse
-
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT    (RXBUF_UCHAR(15))
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT_UNIT 'count'
-    #define I3_RES_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT_TYPE unsigned char
-        // Number of alarms inclination sensor X and Y axis / Anzahl Alarme Neigungsgeber X- und Y-Achse
-
-    #define I3_RES_FZD_STAT_SINE_ALARM_SPANNUNG_WERT                 (RXBUF_UCHAR(16))
-    #define I3_RES_FZD_STAT_SINE_ALARM_SPANNUNG_WERT_UNIT            'count'
-    #define I3_RES_FZD_STAT_SINE_ALARM_SPANNUNG_WERT_TYPE            unsigned char
-        // Number of alarms Interruption in the power supply of the LIN-SINE / Anzahl Alarme Unterbrechung
-        // Spannungsversorgung der LIN-SINE
-
-    #define I3_RES_FZD_STAT_SINE_ALARM_LIN_TELEGRAMM_WERT            (RXBUF_UCHAR(17))
-    #define I3_RES_FZD_STAT_SINE_ALARM_LIN_TELEGRAMM_WERT_UNIT       'count'
-    #define I3_RES_FZD_STAT_SINE_ALARM_LIN_TELEGRAMM_WERT_TYPE       unsigned char
-        // Number of alarms LIN bus: no telegram can be sent / Anzahl Alarme LIN-Bus: kein Telegramm absetzbar
-
-    #define I3_RES_FZD_STAT_FZD_ALARM_PANIKALARM_WERT                (RXBUF_UCHAR(18))
-    #define I3_RES_FZD_STAT_FZD_ALARM_PANIKALARM_WERT_UNIT           'count'
-    #define I3_RES_FZD_STAT_FZD_ALARM_PANIKALARM_WERT_TYPE           unsigned char
-        // Number of alarms Panic alarm / Anzahl Alarme Panikalarm
-
-// Skipping DWA_SINE_ALARMSPEICHER on 0x6013 which takes arguments
-
-// Skipping DWA_SINE_FEHLERSPEICHER on 0x6014 which takes arguments
-
-// Skipping DWA_SINE_VERPOLZAEHLER on 0x6015 which takes arguments
-
-// Skipping _SHD_ESH_DEBUG_OUTPUT_KONF on 0xF000 which takes arguments
@@ -1,35 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/fzd_f15.json: FZD 56: Roof function centre
-// This generated code  makes it easier to process CANBUS messages from the FZD ecu in a BMW i3
-//
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE_ANSTEUERUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA70
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE_BATT_LEVEL_RESET,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA71
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_ALARM_ANZAHL_LOESCHEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA7A
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_HALLSENSOREN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD180
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_ESH_TASTER,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD192
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_VORHANDEN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD193
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_ESH_TASTER_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD194
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_VORHANDEN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD195
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_BEWEGUNG,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD196
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_STATUS_DETAIL,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1A6
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_RELAIS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1B9
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_BEWEGUNG,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1BA
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_HALLSENSOREN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1BB
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_RELAIS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1BC
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_STATUS_DETAIL,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1BD
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1BE
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1C0
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE_LIN,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCA1
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE,                                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCA2
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE_BATT_LEVEL,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCA3
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_SINE_NEIGUNG,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCA9
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_INTERN,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCAC
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_ALARM_AUSGELOEST,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCB0
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_VORHANDEN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCB1
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_USIS_EMPFINDLICHKEIT,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCB2
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_KLAPPENKONTAKTE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDCDD
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4107
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1,   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4108
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1,    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4109
-  //{ I3_ECU_FZD_TX, I3_ECU_FZD_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_FZD_DWA_ALARM_ANZAHL,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6012
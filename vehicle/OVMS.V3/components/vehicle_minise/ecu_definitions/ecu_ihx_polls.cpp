@@ -1,111 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ihx_i1.json: IHX 78: Integrated automatic heating/aircon
-// This generated code  makes it easier to process CANBUS messages from the IHX ecu in a BMW i3
-//
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_EDH_VERRIEGELUNG,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA11B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_WP_BEFUELLUNG,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA11C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_WP_EXP_VENTIL_KALIBRIEREN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA11D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_LINKS,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD15D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_RECHTS,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD15E
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD15F
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD160
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_FBM_TASTEN_VORHANDEN_WERT,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD599
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_FUSSRAUM_LINKS_WERT,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD859
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_FUSSRAUM_RECHTS_WERT,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD85A
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_INNEN_UNBELUEFTET,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD85C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_POTI_SCHICHTUNG_FOND_WERT,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD860
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KONFIGURATION_KLIMA_VORN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD866
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KAELTEMITTEL_MEDIUM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD868
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STEUERN_MOTOREN_KALIBRIERLAUF,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD88D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SCHRITTMOTOR_FEHLER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD88E
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STEUERN_SELBSTTEST_SCHRITTMOTOREN,        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD88F
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_FONDSCHICHTUNG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AA
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SOLARSENSOR_VORHANDEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AB
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_AUC_SENSOR_VORHANDEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8AC
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_EKK_DREHZAHLERHOEHUNG,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8C2
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_EKMV_ANALOGWERTE_GEN20,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8C4
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_EKMV_BETRIEBSZUSTAND_GEN20,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8C5
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_EDH_STATUS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8CD
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KONFIGURATION_KLIMA_PRODUKTLINIE,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8CE
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_HV_POWERMANAGEMENT,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8D2
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_HV_PM_EDH,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8D3
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_KUEHLMITTELTEMPERATUR,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD8D4
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SOLLWERT_ELEKTRISCHER_ZUHEIZER_VORN,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD902
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_OUT_ZUSATZWASSERPUMPE_EIN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD904
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TIMER_EINLAUFSCHUTZ,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD905
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_VORHANDEN,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD90E
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_KOMPRESSORKUPPLUNG,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD916
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD91A
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD91D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_KLAPPEN_PRG_MITTE,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD928
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_GEBLAESESTUFE_ANZ,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD92B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_OFF_EIN,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD92C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_DEFROST_EIN,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD92D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_MAX_AC_EIN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD92E
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD930
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD931
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_HHS_EIN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD932
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_AC_EIN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD934
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_KLIMASTIL_MITTE,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD936
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_STANDLUEFTEN_EIN,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD939
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_GEBLAESELEISTUNG_WERT,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD93F
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_DEFROST_WERT,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD941
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_BELUEFTUNG_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD942
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_FUSSRAUM_WERT,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD947
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_SCHICHTUNG_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD949
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_SCHICHTUNG_LI_WERT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD94A
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_SCHICHTUNG_RE_WERT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD94B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_UMLUFT_WERT,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD94D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_TEMP_LUFT_FOND_WERT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD950
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_MOTOR_KALIBRIERLAUF,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD953
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SELBSTTEST_SCHRITTMOTORE,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD954
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_BELUEFTUNG_LINKS_WERT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD957
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_BELUEFTUNG_RECHTS_WERT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD958
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_DRUCKSENSOR_VORHANDEN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD959
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_WASSERVENTIL,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD95A
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_VERDAMPFER_WERT,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD95C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_KOMPRESSORFREIGABE,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD960
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_SOLARSENSOR_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD962
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_AUC_SENSOR_WERT,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD964
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_BESCHLAGSENSOR_WERT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD966
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_KAELTEMITTELDRUCK_WERT,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD968
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_IN_TEMP_AUSSEN_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD96B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BESCHLAGSENSOR_VORHANDEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD96D
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_TEMPERATUR_SOLLWERT,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD977
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_LIN_1_ADRESSEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD97B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STEUERN_RESET_LIN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD97C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLAPPEN_VERSTELLBEREICH,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD980
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STEUERN_AUTOADR_KLAPPENMOTOREN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD981
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_TEMPERATUR_MITTE_SOLLWERT,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD988
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_MISCHLUFT_WERT,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD98A
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_ZENTRALANTRIEB_WERT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD98B
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_MISCHLUFT_LINKS_WERT,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD98C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLP_POS_MISCHLUFT_RECHTS_WERT,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD98E
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_MIKROSCHALTER_ZENTRALANTRIEB,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD98F
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_BELUEFTUNG_WERT,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD990
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_TEMP_FUSSRAUM_WERT,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD991
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_AUDIOBEDIENTEIL,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD995
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_POTI_SCHICHTUNG_MITTE_WERT,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD998
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD99C
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VARIANTE_AUDIOBEDIENTEIL,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9A0
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_BUS_OUT_KOMPRESSORKUPPLUNG_EIN,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9A1
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_EKMV,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9A4
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_KLIMA_VORN_PRG_HFS,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9A8
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_WAERMEPUMPE_SENSOREN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9AC
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_EDH,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9AE
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_WAERMEPUMPE,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9AF
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_VORHANDEN_FSH,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD9B1
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_SPANNUNG_KLEMME_30_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAD8
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STATUS_KLEMME_R_EIN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAFD
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STATUS_KLEMME_15_EIN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAFE
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STATUS_KLEMME_30B_EIN,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB06
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_STATUS_KLEMME_50_EIN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB10
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_HV_EDH_STECKVERBINDUNG,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFC0
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_HV_EKMV_STECKVERBINDUNG,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFC1
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_UWB_CPD_DIAGINFO,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4001
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX_UWB_HKLUSV_DIAGINFO,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4002
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX__ADC_EINGAENGE_WERT,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4010
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX__STAT_STANDHEIZUNG_WERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4011
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX__STANDHEIZUNG_AUSGANG,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4012
-  //{ I3_ECU_IHX_TX, I3_ECU_IHX_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_IHX__VALEO_LESEN_SPEICHER,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4020
@@ -1,28 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/kafas20.json: KAF 5D: Camera based driver assistance system
-// This generated code  makes it easier to process CANBUS messages from the KAF ecu in a BMW i3
-//
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__FASTA_FLA_DATA,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4001
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__KAFAS_ECU_DATA,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4002
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__KAFAS_TLC_DATA,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4003
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_KAFAS_FCW_DATA,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4004
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__KAFAS_SLI_DATA,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4005
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__STATUS_SAFETY_DIAG_INFO,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x400E
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__STATUS_WARNZEITPUNKT_FCW,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x400F
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_FASTA_PPP_DATA,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4010
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_FASTA_CCM_DATA,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4011
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__KAFAS_ENVINT_DATA,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4012
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_PPP_ANFORDERUNGEN,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4016
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__GENERIC_EYEQ2_INFO,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4017
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4050
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_ABSCHALTGRUND_FERNLICHT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD341
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_KONFIGURATION_KAFAS,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD374
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_KAFAS_VINS_LESEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD393
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_KALIBRIERDATEN_KAFAS,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD396
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_KAMERAVERBINDUNG_ECU,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD397
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_ERGEBNIS_SLI,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD3AA
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF_SPANNUNG_KLEMME_15N_WERT,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAD2
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__DEBUG_AUSGABE,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF001
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__PEDANTIC_MODE,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF003
-  //{ I3_ECU_KAF_TX, I3_ECU_KAF_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KAF__ERASE_MICRO_CORE_DUMP,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF004
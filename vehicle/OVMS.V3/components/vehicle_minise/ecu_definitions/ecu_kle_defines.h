@@ -1,688 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ucx2_i01.json: KLE 15: Convenience charging electronics
-// This generated code  makes it easier to process CANBUS messages from the KLE ecu in a BMW i3
-//
-
-#define I3_ECU_KLE_TX                                                0x06F115
-#define I3_ECU_KLE_RX                                                0x0615F1
-
-#define I3_PID_KLE_FLASH_DSPS                                        0xAF43
-        // Programming of DSP / Programmierung von DSP
-
-    #define I3_RES_KLE_STAT_DSP_FLASHING                             (RXBUF_UCHAR(0))
-    #define I3_RES_KLE_STAT_DSP_FLASHING_UNIT                        '0-n'
-    #define I3_RES_KLE_STAT_DSP_FLASHING_TYPE                        unsigned char
-        // DSP programming status. / Status der DSP-Programmierung.
-
-#define I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET                        0xDE84
-        // Operating modes charger / Betriebsarten Ladegerät
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT                (RXBUF_UCHAR(0)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_UNIT           'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_TYPE           float
-        // Current grid frequency phase 1 / Aktuelle Netzfrequenz Phase 1
-
-    // BF_LADEGERAET_DERATING is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Reason for derating / Grund für Derating
-            // STAT_DERATING_BIT0: Mask: 0x01 - Overtemperature: 0 = not active; 1 = active
-            // STAT_DERATING_BIT1: Mask: 0x02 - Mains frequency too low: 0 = not active; 1 = active
-            // STAT_DERATING_BIT2: Mask: 0x04 - Failure of a charging module: 0 = not active; 1 = active
-            // STAT_DERATING_BIT3: Mask: 0x08 - DC current limitation: 0 = not active; 1 = active
-            // STAT_DERATING_BIT4: Mask: 0x10 - Network available power of lower nominal power: 0 = not active; 1 = active
-            // STAT_DERATING_BIT5: Mask: 0x20 - Reserved
-            // STAT_DERATING_BIT6: Mask: 0x40 - Reserved
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING                        (RXBUF_UCHAR(1))
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING_UNIT                   'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING_TYPE                   unsigned char
-        // Reason for derating / Grund für Derating
-
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT                   (RXBUF_UINT(2)*10.0f)
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT_UNIT              'W'
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT_TYPE              float
-        // Derating performance / Derating Leistung
-
-    #define I3_RES_KLE_STAT_DERATING_WERT                            (RXBUF_UCHAR(4))
-    #define I3_RES_KLE_STAT_DERATING_WERT_UNIT                       '%'
-    #define I3_RES_KLE_STAT_DERATING_WERT_TYPE                       unsigned char
-        // Derating / Derating
-
-    // BF_LADEGERAET_FEHLERZUSTAND_UCXII is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Charger fault conditions / Ladegerät Fehlerzustände 
-            // STAT_FEHLERZUSTAND_BIT0: Mask: 0x01 - Derating: 0 = not active; 1 = active
-            // STAT_FEHLERZUSTAND_BIT1: Mask: 0x02 - Charge interruption: 0 = not active; 1 = active
-            // STAT_FEHLERZUSTAND_BIT2: Mask: 0x04 - Failsafe: 0 = not active; 1 = active
-            // STAT_FEHLERZUSTAND_BIT3: Mask: 0x08 - Communication failure: 0 = not active; 1 = active
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII             (RXBUF_UCHAR(5))
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_UNIT        'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_TYPE        unsigned char
-        // Charger fault conditions / Ladegerät Fehlerzustände 
-
-    // BF_AUSLOESER_FAILSAFE_UCXII is a BITFIELD of size unsigned int.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Failsafe trigger / Auslöser Failsafe
-            // STAT_AUSLOESER_FAILSAFE_BIT0: Mask: 0x001 - Hardware error: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT1: Mask: 0x002 - Undervoltage AC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT2: Mask: 0x004 - Overvoltage AC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT3: Mask: 0x008 - Overcurrent AC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT4: Mask: 0x010 - Undervoltage DC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT5: Mask: 0x020 - Overvoltage DC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT6: Mask: 0x040 - Overcurrent DC: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT7: Mask: 0x080 - Temperature: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT8: Mask: 0x100 - Communication error: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT9: Mask: 0x200 - Load initialization timeout: 0 = not active; 1 = active
-            // STAT_AUSLOESER_FAILSAFE_BIT10: Mask: 0x400 - Controller undervoltage: 0 = not active; 1 = active
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII                   (RXBUF_UINT(6))
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII_UNIT              'Bit'
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII_TYPE              unsigned short
-        // Failsafe trigger / Auslöser Failsafe
-
-    // BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Cause of charging interruption / Ursache für Ladeunterbrechung
-            // STAT_URSACHE_LADEUNTERBRECHUNG_BIT0: Mask: 0x01 - Forced separation of the plug: 0 = not active; 1 = active
-            // STAT_URSACHE_LADEUNTERBRECHUNG_BIT1: Mask: 0x02 - AC voltage missing or grid connection unstable: 0 = not active; 1 = active
-            // STAT_URSACHE_LADEUNTERBRECHUNG_BIT2: Mask: 0x04 - Connector not locked: 0 = not active; 1 = active
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG       (RXBUF_UCHAR(8))
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_UNIT  'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_TYPE  unsigned char
-        // Cause of charging interruption / Ursache für Ladeunterbrechung
-
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR                           (RXBUF_UCHAR(9))
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR_UNIT                      '0-n'
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR_TYPE                      unsigned char
-        // Operating mode / Betriebsart
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT                (RXBUF_UCHAR(10)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_UNIT           'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_TYPE           float
-        // Current grid frequency phase 2 / Aktuelle Netzfrequenz Phase 2
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT                (RXBUF_UCHAR(11)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_UNIT           'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_TYPE           float
-        // Current grid frequency phase 3 / Aktuelle Netzfrequenz Phase 3
-
-    // BF_MOD_ERR is a BITFIELD of size unsigned long.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Error states load module / Fehlerzustände Lademodul
-            // STAT_BF_DSP_ERR_HVDCV_OORL: Mask: 0x00000001 - PM HVDC voltage sensor outside lower threshold: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_HVDCV_OORH: Mask: 0x00000002 - PM HVDC voltage sensor outside upper threshold: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_HVDCI_OORH: Mask: 0x00000004 - PM HVDC current sensor outside upper threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_IRES_OORH: Mask: 0x00000008 - PM sensor resonance current outside the upper threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VBUS_OORL: Mask: 0x00000010 - PM sensor bus voltage outside the lower threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VBUS_OORH: Mask: 0x00000020 - PM sensor bus voltage outside the upper threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_OVERTEMPERATURE: Mask: 0x00000040 - PM temperature sensor outside upper threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_UNDERTEMPERATURE: Mask: 0x00000080 - PM temperature sensor outside lower threshold: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_HVDCV_SHGND: Mask: 0x00000100 - PM HVDC voltage sensor short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_HVDCI_SHGND: Mask: 0x00000200 - PM HVDC current sensor short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_AC_I_OORH: Mask: 0x00000400 - PM AC current sensor outside upper threshold: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_AC_I_SHGND: Mask: 0x00000800 - PM AC current sensor short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LX_SHBATT: Mask: 0x00001000 - PM AC Lx current sensor short circuit to positive: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LX_SHGND: Mask: 0x00002000 - PM AC Lx current sensor short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_IRES_SHBATT: Mask: 0x00004000 - PM sensor resonance current short circuit to plus: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_IRES_SHGND: Mask: 0x00008000 - PM sensor resonance current short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_CAN_ALIVE: Mask: 0x00010000 - PM error test ALIVE: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_CAN_MSG401_TOUT: Mask: 0x00020000 - PM error timeout telegram 0x401: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_CAN_MSG300_TOUT: Mask: 0x00040000 - PM error timeout telegram 0x300: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_SPI_PROTOCOL: Mask: 0x00080000 - PM error SPI protocol: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_SPI_WIPER0_MISMATCH: Mask: 0x00100000 - PM error SPI Wiper0 discrepancy: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_SPI_WIPER1_MISMATCH: Mask: 0x00200000 - PM error SPI Wiper1 discrepancy: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_RAM: Mask: 0x00400000 - PM error RAM: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_WATCHDOG: Mask: 0x00800000 - PM watchdog error: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_STACKOVFL: Mask: 0x01000000 - PM stack overflow: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_DATA_INTEGRITY: Mask: 0x02000000 - PM data integrity: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_CLOCK: Mask: 0x04000000 - PM clock: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_CRC_CALIBRATION: Mask: 0x08000000 - PM CRC calibration: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LY_SHBATT: Mask: 0x10000000 - PM AC Ly voltage sensor short circuit to plus: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LY_SHGND: Mask: 0x20000000 - PM AC Ly voltage sensor short circuit to ground: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LX_OORH: Mask: 0x40000000 - PM AC Lx voltage sensor outside upper threshold value: 0 = not active; 1 = active
-            // STAT_BF_DSP_ERR_VAC_LY_OORH: Mask: 0x80000000 - PM AC Ly voltage sensor outside upper threshold: 0 = not active; 1 = active
-    #define I3_RES_KLE_BF_MOD_ERR                                    (RXBUF_UINT32(12))
-    #define I3_RES_KLE_BF_MOD_ERR_UNIT                               'Bit'
-    #define I3_RES_KLE_BF_MOD_ERR_TYPE                               unsigned long
-        // Error states load module / Fehlerzustände Lademodul
-
-#define I3_PID_KLE_LADEGERAET_LEISTUNG                               0xDE85
-        // Power values intermediate circuit of the charger / Leistungswerte Zwischenkreis des Ladegeräts
-
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT             (RXBUF_UCHAR(0))
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_UNIT        '%'
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_TYPE        unsigned char
-        // Charge cycle efficiency / Wirkungsgrad Ladezyklus
-
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT                     (RXBUF_UCHAR(1))
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT_UNIT                '%'
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT_TYPE                unsigned char
-        // Efficiency DC / Wirkungsgrad DC
-
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT           (RXBUF_UINT(2))
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_UNIT      'W'
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_TYPE      unsigned short
-        // Instantaneous power output in the intermediate circuit / Abgegebende Momentanleistung in den Zwischenkreis
-
-#define I3_PID_KLE_LADEGERAET_SPANNUNG                               0xDE86
-        // AC and DC voltages charger / AC und DC Spannungen Ladegerät
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT             (RXBUF_UINT(0))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_UNIT        'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_TYPE        unsigned short
-        // RMS values of the AC conductor voltages (phase 1) / Effektivwerte der AC Leiterspannungen (Phase1)
-
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT           (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_UNIT      'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_TYPE      float
-        // HV DC voltage upper limit / HV DC Spannungsobergrenze
-
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT                      (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT_UNIT                 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT_TYPE                 float
-        // HV DC voltage / HV DC Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT                       (RXBUF_UCHAR(6)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT_UNIT                  'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT_TYPE                  float
-        // KL30 voltage / KL30 Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT                      (RXBUF_UCHAR(7)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT_UNIT                 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT_TYPE                 float
-        // KL30C voltage / KL30C Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT             (RXBUF_UINT(8))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_UNIT        'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_TYPE        unsigned short
-        // RMS values of the AC conductor voltages (phase 2) / Effektivwerte der AC Leiterspannungen (Phase 2)
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT             (RXBUF_UINT(10))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_UNIT        'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_TYPE        unsigned short
-        // RMS values of the AC conductor voltages (phase 3) / Effektivwerte der AC Leiterspannungen (Phase 3)
-
-#define I3_PID_KLE_LADEGERAET_STROM                                  0xDE87
-        // AC and DC currents charger / AC und DC Ströme Ladegerät
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT                    (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT_UNIT               'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT_TYPE               float
-        // AC current phase 1 / AC Strom Phase 1
-
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT            (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_UNIT       'A'
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_TYPE       float
-        // Maximum stored AC current / Maximal gespeicherter AC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT                         (RXBUF_UINT(4)/10.0f-204.7)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT_UNIT                    'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT_TYPE                    float
-        // HV DC electricity / HV DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT               (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_UNIT          'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_TYPE          float
-        // Maximum permitted HV DC current / Maximal erlaubter HV DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT         (RXBUF_UINT(8)/10.0f-204.7)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_UNIT    'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_TYPE    float
-        // Maximum stored DC current / Maximal gespeicherter DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT                    (RXBUF_UINT(10)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT_UNIT               'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT_TYPE               float
-        // AC current phase 2 / AC Strom Phase 2
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT                    (RXBUF_UINT(12)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT_UNIT               'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT_TYPE               float
-        // AC current phase 3 / AC Strom Phase 3
-
-#define I3_PID_KLE_AC_PHASENANZAHL                                   0xDF25
-        // Status of the number of AC phases / Status AC-Phasenanzahl
-
-    #define I3_RES_KLE_STAT_AC_PHASENANZAHL_WERT                     (RXBUF_UCHAR(0))
-    #define I3_RES_KLE_STAT_AC_PHASENANZAHL_WERT_TYPE                unsigned char
-        // Status of the number of AC phases / Status AC-Phasenanzahl
-
-#define I3_PID_KLE_LADEGERAET_LADEDAUER                              0xDFB0
-        // Information on the charging time / Information zur Ladedauer
-
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT                  (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_UNIT             'min'
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_TYPE             unsigned long
-        // Charging time in minutes / Ladezeit in Minuten
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT                 (RXBUF_UINT(4))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_UNIT            's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_TYPE            unsigned short
-        // Loading time in seconds / Ladezeit in Sekunden
-
-    #define I3_RES_KLE_STAT_LADEZYKLEN_WERT                          (RXBUF_UINT(6))
-    #define I3_RES_KLE_STAT_LADEZYKLEN_WERT_TYPE                     unsigned short
-        // Number of charging cycles / Anzahl der Ladezyklen
-
-#define I3_PID_KLE_LADEGERAET_TEMPERATUREN                           0xDFB1
-        // Reading out temperatures / Auslesen Temperaturen
-
-    #define I3_RES_KLE_STAT_NTC1_TEMPERATUR_WERT                     (RXBUF_UCHAR(0)-75.0)
-    #define I3_RES_KLE_STAT_NTC1_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC1_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 1) / interne Temperatur (Temperatursensor 1)
-
-    #define I3_RES_KLE_STAT_NTC2_TEMPERATUR_WERT                     (RXBUF_UCHAR(1)-75.0)
-    #define I3_RES_KLE_STAT_NTC2_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC2_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 2) / interne Temperatur (Temperatursensor 2)
-
-    #define I3_RES_KLE_STAT_NTC3_TEMPERATUR_WERT                     (RXBUF_UCHAR(2)-75.0)
-    #define I3_RES_KLE_STAT_NTC3_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC3_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 3) / interne Temperatur (Temperatursensor 3)
-
-    #define I3_RES_KLE_STAT_NTC4_TEMPERATUR_WERT                     (RXBUF_UCHAR(3)-75.0)
-    #define I3_RES_KLE_STAT_NTC4_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC4_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 4) / interne Temperatur (Temperatursensor 4)
-
-    #define I3_RES_KLE_STAT_NTC5_TEMPERATUR_WERT                     (RXBUF_UCHAR(4)-75.0)
-    #define I3_RES_KLE_STAT_NTC5_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC5_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 5) / interne Temperatur (Temperatursensor 5)
-
-    #define I3_RES_KLE_STAT_NTC6_TEMPERATUR_WERT                     (RXBUF_UCHAR(5)-75.0)
-    #define I3_RES_KLE_STAT_NTC6_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC6_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 6) / interne Temperatur (Temperatursensor 6)
-
-    #define I3_RES_KLE_STAT_NTC7_TEMPERAUTR_WERT                     (RXBUF_UCHAR(6)-75.0)
-    #define I3_RES_KLE_STAT_NTC7_TEMPERAUTR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC7_TEMPERAUTR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 7) / interne Temperatur (Temperatursensor 7)
-
-    #define I3_RES_KLE_STAT_NTC8_TEMPERATUR_WERT                     (RXBUF_UCHAR(7)-75.0)
-    #define I3_RES_KLE_STAT_NTC8_TEMPERATUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC8_TEMPERATUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 8) / interne Tempeartur (Temperatursensor 8)
-
-    #define I3_RES_KLE_STAT_NTC9_TEMPEARTUR_WERT                     (RXBUF_UCHAR(8)-75.0)
-    #define I3_RES_KLE_STAT_NTC9_TEMPEARTUR_WERT_UNIT                '°C'
-    #define I3_RES_KLE_STAT_NTC9_TEMPEARTUR_WERT_TYPE                unsigned char
-        // internal temperature (temperature sensor 9) / interne Temperatur (Temperatursensor 9)
-
-    #define I3_RES_KLE_STAT_NTC10_TEMPEARTUR_WERT                    (RXBUF_UCHAR(9)-75.0)
-    #define I3_RES_KLE_STAT_NTC10_TEMPEARTUR_WERT_UNIT               '°C'
-    #define I3_RES_KLE_STAT_NTC10_TEMPEARTUR_WERT_TYPE               unsigned char
-        // internal temperature (temperature sensor 10) / interne Temperatur (Temperatursensor 10)
-
-#define I3_PID_KLE_LADEGERAET_LEISTUNG2                              0xDFB4
-        // Power values for second charger (multi-phase charging) / Leistungswerte für zweites Ladegerät (mehrphasiges
-        // Laden)
-
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4      (RXBUF_UCHAR(0))
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4_UNIT '%'
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4_TYPE unsigned char
-        // Charge cycle efficiency / Wirkungsgrad Ladezyklus
-
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4              (RXBUF_UCHAR(1))
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4_UNIT         '%'
-    #define I3_RES_KLE_STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4_TYPE         unsigned char
-        // Efficiency DC / Wirkungsgrad DC
-
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4    (RXBUF_UINT(2))
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4_UNIT 'W'
-    #define I3_RES_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4_TYPE unsigned short
-        // Instantaneous power output in the intermediate circuit / Abgegebende Momentanleistung in den Zwischenkreis
-
-#define I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM                        0xDFB6
-        // Charge histogram related to temperature and power / Ladehistogramm bezüglich Temperatur und Leistung
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT       (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_TYPE  unsigned long
-        // Seconds at temperature below 0 ° C / Sekunden bei Temperatur unter 0°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT       (RXBUF_UINT32(4))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_TYPE  unsigned long
-        // Seconds at a temperature between 0 ° C and 45 ° C / Sekunden bei Temperatur zwischen 0°C und 45°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT       (RXBUF_UINT32(8))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_TYPE  unsigned long
-        // Seconds at a temperature between 46 ° C and 60 ° C / Sekunden bei Temperatur zwischen 46°C und 60°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT       (RXBUF_UINT32(12))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_TYPE  unsigned long
-        // Seconds in the temperature range between 61 ° C and 70 ° C / Sekunden im Temperaturbereich zwischen 61°C und
-        // 70°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT       (RXBUF_UINT32(16))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_TYPE  unsigned long
-        // Seconds at a temperature between 71 ° C and 85 ° C / Sekunden bei Temperatur zwischen 71°C und 85°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT       (RXBUF_UINT32(20))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_UNIT  's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_TYPE  unsigned long
-        // Seconds at temperatures above 85 ° C / Sekunden bei Temperatur über 85°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT         (RXBUF_UINT32(24))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_UNIT    's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_TYPE    unsigned long
-        // Seconds at power below 1000W / Sekunden bei Leistung unter 1000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT         (RXBUF_UINT32(28))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_UNIT    's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_TYPE    unsigned long
-        // Seconds at power between 1001W and 2000W / Sekunden bei Leistung zwischen 1001W und 2000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT         (RXBUF_UINT32(32))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_UNIT    's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_TYPE    unsigned long
-        // Seconds at power between 2001W and 3000W / Sekunden bei Leistung zwischen 2001W und 3000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT         (RXBUF_UINT32(36))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_UNIT    's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_TYPE    unsigned long
-        // Seconds at power over 3000W / Sekunden bei Leistung über 3000W
-
-#define I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2                       0xDFB7
-        // Charging histogram relating to temperature and power for a second charger (multi-phase charging). /
-        // Ladehistogramm bezüglich Temperatur und Leistung für ein zweites Ladegerät (mehrphasiges Laden).
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7 (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at temperature below 0 ° C / Sekunden bei Temperatur unter 0°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7 (RXBUF_UINT32(4))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at a temperature between 0 ° C and 45 ° C / Sekunden bei Temperatur zwischen 0°C und 45°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7 (RXBUF_UINT32(8))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at a temperature between 46 ° C and 60 ° C / Sekunden bei Temperatur zwischen 46°C und 60°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7 (RXBUF_UINT32(12))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7_TYPE unsigned long
-        // Seconds in the temperature range between 61 ° C and 70 ° C / Sekunden im Temperaturbereich zwischen 61°C und
-        // 70°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7 (RXBUF_UINT32(16))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at a temperature between 71 ° C and 85 ° C / Sekunden bei Temperatur zwischen 71°C und 85°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7 (RXBUF_UINT32(20))
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at temperatures above 85 ° C / Sekunden bei Temperatur über 85°C
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7  (RXBUF_UINT32(24))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at power below 1000W / Sekunden bei Leistung unter 1000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7  (RXBUF_UINT32(28))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at power between 1001W and 2000W / Sekunden bei Leistung zwischen 1001W und 2000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7  (RXBUF_UINT32(32))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at power between 2001W and 3000W / Sekunden bei Leistung zwischen 2001W und 3000W
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7  (RXBUF_UINT32(36))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7_UNIT 's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7_TYPE unsigned long
-        // Seconds at power over 3000W / Sekunden bei Leistung über 3000W
-
-#define I3_PID_KLE_LADEGERAET_LADEDAUER2                             0xDFB8
-        // Information on the charging time for a second charger (multi-phase charging) / Information zur Ladedauer für
-        // ein zweites Ladegerät (mehrphasiges Laden)
-
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8           (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8_UNIT      'min'
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8_TYPE      unsigned long
-        // Charging time in minutes / Ladezeit in Minuten
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8          (RXBUF_UINT(4))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8_UNIT     's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8_TYPE     unsigned short
-        // Loading time in seconds / Ladezeit in Sekunden
-
-    #define I3_RES_KLE_STAT_LADEZYKLEN_WERT_0XDFB8                   (RXBUF_UINT(6))
-    #define I3_RES_KLE_STAT_LADEZYKLEN_WERT_0XDFB8_TYPE              unsigned short
-        // Number of charging cycles / Anzahl der Ladezyklen
-
-#define I3_PID_KLE_UMSCHALTMATRIX                                    0xDFB9
-        // Switching matrix (multi-phase charging): number of switching cycles and state of the switches / Umschaltmatrix
-        // (mehrphasiges Laden): Anzahl von Schaltzyklen und Zustand der Schalter
-
-    #define I3_RES_KLE_STAT_SCHALTER1_SCHALTZYKLEN_ANZAHL_WERT       (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_SCHALTER1_SCHALTZYKLEN_ANZAHL_WERT_TYPE  unsigned long
-        // Number of switching cycles for switch 1 (multi-phase charging: phase 1) / Anzahl von Schaltzyklen für Schalter
-        // 1 (mehrphasiges Laden: Phase 1)
-
-    #define I3_RES_KLE_STAT_SCHALTER2_SCHALTZYKLEN_ANZAHL_WERT       (RXBUF_UINT32(4))
-    #define I3_RES_KLE_STAT_SCHALTER2_SCHALTZYKLEN_ANZAHL_WERT_TYPE  unsigned long
-        // Number of switching cycles for switch 2 (multi-phase charging: phase 2) / Anzahl von Schaltzyklen für Schalter
-        // 2 (mehrphasiges Laden: Phase 2)
-
-    #define I3_RES_KLE_STAT_SCHALTER3_SCHALTZYKLEN_ANZAHL_WERT       (RXBUF_UINT32(8))
-    #define I3_RES_KLE_STAT_SCHALTER3_SCHALTZYKLEN_ANZAHL_WERT_TYPE  unsigned long
-        // Number of switching cycles for switch 3 (multi-phase charging: phase 3) / Anzahl von Schaltzyklen für Schalter
-        // 3 (mehrphasiges Laden: Phase 3)
-
-    #define I3_RES_KLE_STAT_SCHALTER4_SCHALTZYKLEN_ANZAHL_WERT       (RXBUF_UINT32(12))
-    #define I3_RES_KLE_STAT_SCHALTER4_SCHALTZYKLEN_ANZAHL_WERT_TYPE  unsigned long
-        // Number of switching cycles for switch 4 (multi-phase charging: changeover) / Anzahl von Schaltzyklen für
-        // Schalter 4 (mehrphasiges Laden: Umschaltung)
-
-    #define I3_RES_KLE_STAT_SCHALTER1                                (RXBUF_UCHAR(16))
-    #define I3_RES_KLE_STAT_SCHALTER1_UNIT                           '0/1'
-    #define I3_RES_KLE_STAT_SCHALTER1_TYPE                           unsigned char
-        // State of switch 1 (0 = open, 1 = closed) / Zustand vom Schalter 1 (0= offen, 1=geschlossen)
-
-    #define I3_RES_KLE_STAT_SCHALTER2                                (RXBUF_UCHAR(17))
-    #define I3_RES_KLE_STAT_SCHALTER2_UNIT                           '0/1'
-    #define I3_RES_KLE_STAT_SCHALTER2_TYPE                           unsigned char
-        // State of switch 2 (0 = open, 1 = closed) / Zustand vom Schalter 2 (0= offen, 1=geschlossen)
-
-    #define I3_RES_KLE_STAT_SCHALTER3                                (RXBUF_UCHAR(18))
-    #define I3_RES_KLE_STAT_SCHALTER3_UNIT                           '0/1'
-    #define I3_RES_KLE_STAT_SCHALTER3_TYPE                           unsigned char
-        // State of switch 3 (0 = open, 1 = closed) / Zustand vom Schalter 3 (0= offen, 1=geschlossen)
-
-    #define I3_RES_KLE_STAT_SCHALTER4                                (RXBUF_UCHAR(19))
-    #define I3_RES_KLE_STAT_SCHALTER4_UNIT                           '0/1'
-    #define I3_RES_KLE_STAT_SCHALTER4_TYPE                           unsigned char
-        // State of switch 4 (0 = charger 1, 1 = charger 2) / Zustand vom Schalter 4 (0= Ladegerät 1, 1=Ladegerät 2)
-
-#define I3_PID_KLE_LADEGERAET_SPANNUNG2                              0xDFBA
-        // AC and DC voltages for second charger (multi-phase charging) / AC und DC Spannungen für zweites Ladegerät
-        // (mehrphasiges Laden)
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA      (RXBUF_UINT(0))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA_UNIT 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA_TYPE unsigned short
-        // RMS values of the AC conductor voltages (phase 1) / Effektivwerte der AC Leiterspannungen (Phase1)
-
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA    (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA_UNIT 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA_TYPE float
-        // HV DC voltage upper limit / HV DC Spannungsobergrenze
-
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT_0XDFBA               (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT_0XDFBA_UNIT          'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_DC_HV_WERT_0XDFBA_TYPE          float
-        // HV DC voltage / HV DC Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT_0XDFBA                (RXBUF_UCHAR(6)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT_0XDFBA_UNIT           'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30_WERT_0XDFBA_TYPE           float
-        // KL30 voltage / KL30 Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT_0XDFBA               (RXBUF_UCHAR(7)/10.0f)
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT_0XDFBA_UNIT          'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_KL30C_WERT_0XDFBA_TYPE          float
-        // KL30C voltage / KL30C Spannung
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA      (RXBUF_UINT(8))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA_UNIT 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA_TYPE unsigned short
-        // RMS values of the AC conductor voltages (phase 2) / Effektivwerte der AC Leiterspannungen (Phase 2)
-
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA      (RXBUF_UINT(10))
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA_UNIT 'V'
-    #define I3_RES_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA_TYPE unsigned short
-        // RMS values of the AC conductor voltages (phase 3) / Effektivwerte der AC Leiterspannungen (Phase 3)
-
-#define I3_PID_KLE_LADEGERAET_STROM2                                 0xDFBB
-        // Charger currents for second charger (multi-phase charging) / Ströme des Ladegeräts für zweits Ladegerät
-        // (mehrphasiges Laden)
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT_0XDFBB             (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT_0XDFBB_UNIT        'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_1_WERT_0XDFBB_TYPE        float
-        // AC current phase 1 / AC Strom Phase 1
-
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB     (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB_UNIT 'A'
-    #define I3_RES_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB_TYPE float
-        // Maximum stored AC current / Maximal gespeicherter AC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT_0XDFBB                  (RXBUF_UINT(4)/10.0f-204.7)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT_0XDFBB_UNIT             'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_WERT_0XDFBB_TYPE             float
-        // HV DC electricity / HV DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB        (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB_UNIT   'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB_TYPE   float
-        // Maximum permitted HV DC current / Maximal erlaubter HV DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB  (RXBUF_UINT(8)/10.0f-204.7)
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB_UNIT 'A'
-    #define I3_RES_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB_TYPE float
-        // Maximum stored DC current / Maximal gespeicherter DC Strom
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT_0XDFBB             (RXBUF_UINT(10)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT_0XDFBB_UNIT        'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_2_WERT_0XDFBB_TYPE        float
-        // AC current phase 2 / AC Strom Phase 2
-
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT_0XDFBB             (RXBUF_UINT(12)/10.0f)
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT_0XDFBB_UNIT        'A'
-    #define I3_RES_KLE_STAT_STROM_AC_PHASE_3_WERT_0XDFBB_TYPE        float
-        // AC current phase 3 / AC Strom Phase 3
-
-#define I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2                       0xDFBC
-        // Operating modes charger for second charger (multi-phase charging) / Betriebsarten Ladegerät für zweites
-        // Ladegerät (mehrphasiges Laden)
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC         (RXBUF_UCHAR(0)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC_UNIT    'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC_TYPE    float
-        // Current grid frequency phase 1 / Aktuelle Netzfrequenz Phase 1
-
-    // BF_LADEGERAET_DERATING_0XDFBC is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Reason for derating / Grund für Derating
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING_0XDFBC                 (RXBUF_UCHAR(1))
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING_0XDFBC_UNIT            'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_DERATING_0XDFBC_TYPE            unsigned char
-        // Reason for derating / Grund für Derating
-
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT_0XDFBC            (RXBUF_UINT(2)*10.0f)
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT_0XDFBC_UNIT       'W'
-    #define I3_RES_KLE_STAT_LEISTUNG_DERATING_WERT_0XDFBC_TYPE       float
-        // Derating performance / Derating Leistung
-
-    #define I3_RES_KLE_STAT_DERATING_WERT_0XDFBC                     (RXBUF_UCHAR(4))
-    #define I3_RES_KLE_STAT_DERATING_WERT_0XDFBC_UNIT                '%'
-    #define I3_RES_KLE_STAT_DERATING_WERT_0XDFBC_TYPE                unsigned char
-        // Derating / Derating
-
-    // BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Charger fault conditions / Ladegerät Fehlerzustände
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC      (RXBUF_UCHAR(5))
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC_UNIT 'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC_TYPE unsigned char
-        // Charger fault conditions / Ladegerät Fehlerzustände
-
-    // BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Failsafe trigger / Auslöser Failsafe
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC            (RXBUF_UCHAR(6))
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC_UNIT       'Bit'
-    #define I3_RES_KLE_BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC_TYPE       unsigned char
-        // Failsafe trigger / Auslöser Failsafe
-
-    // BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Cause of charging interruption / Ursache für Ladeunterbrechung
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC (RXBUF_UCHAR(7))
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC_UNIT 'Bit'
-    #define I3_RES_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC_TYPE unsigned char
-        // Cause of charging interruption / Ursache für Ladeunterbrechung
-
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR_0XDFBC                    (RXBUF_UCHAR(8))
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR_0XDFBC_UNIT               '0-n'
-    #define I3_RES_KLE_STAT_BETRIEBSART_NR_0XDFBC_TYPE               unsigned char
-        // Operating mode / Betriebsart
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC         (RXBUF_UCHAR(9)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC_UNIT    'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC_TYPE    float
-        // Current grid frequency phase 2 / Aktuelle Netzfrequenz Phase 2
-
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC         (RXBUF_UCHAR(10)/4.0f)
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC_UNIT    'Hz'
-    #define I3_RES_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC_TYPE    float
-        // Current grid frequency phase 3 / Aktuelle Netzfrequenz Phase 3
-
-    // BF_MOD_ERR_0XDFBC is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Error states load module / Fehlerzustände Lademodul
-    #define I3_RES_KLE_BF_MOD_ERR_0XDFBC                             (RXBUF_UCHAR(11))
-    #define I3_RES_KLE_BF_MOD_ERR_0XDFBC_UNIT                        'Bit'
-    #define I3_RES_KLE_BF_MOD_ERR_0XDFBC_TYPE                        unsigned char
-        // Error states load module / Fehlerzustände Lademodul
-
-#define I3_PID_KLE_LADEDAUER_LADEART                                 0xDFBD
-        // Charging time for different charging types / Ladedauer für verschiedene Ladearten
-
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_1PH_WERT              (RXBUF_UINT32(0))
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_1PH_WERT_UNIT         'min'
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_1PH_WERT_TYPE         unsigned long
-        // Charging time in minutes for single-phase charging / Ladezeit in Minuten für einphasiges Laden
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT             (RXBUF_UINT(4))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT_UNIT        's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT_TYPE        unsigned short
-        // Charging time in seconds for single-phase charging / Ladezeit in Sekunden für einphasiges Laden
-
-    #define I3_RES_KLE_STAT_LADEZYKLUS_1PH_WERT                      (RXBUF_UINT(6))
-    #define I3_RES_KLE_STAT_LADEZYKLUS_1PH_WERT_TYPE                 unsigned short
-        // Number of charging cycles, single-phase charging / Anzahl Ladezyklus einphasiges Laden
-
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_3PH_WERT              (RXBUF_UINT32(8))
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_3PH_WERT_UNIT         'min'
-    #define I3_RES_KLE_STAT_MINUTEN_LADEZYKLUS_3PH_WERT_TYPE         unsigned long
-        // Charging time in minutes for multi-phase charging / Ladezeit in Minuten für mehrphasiges Laden
-
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT             (RXBUF_UINT(12))
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT_UNIT        's'
-    #define I3_RES_KLE_STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT_TYPE        unsigned short
-        // Charging time in seconds for multi-phase charging / Ladezeit in Sekunden für mehrphasiges Laden
-
-    #define I3_RES_KLE_STAT_LADEZYKLUS_3PH_WERT                      (RXBUF_UINT(14))
-    #define I3_RES_KLE_STAT_LADEZYKLUS_3PH_WERT_TYPE                 unsigned short
-        // Number of charging cycles, multi-phase charging / Anzahl Ladezyklus mehrphasiges Laden
-
-#define I3_PID_KLE_FLASH_DSPS_0XF000                                 0xF000
-        // RID used to flash DSPs / RID used to flash DSPs
-
-    #define I3_RES_KLE_STAT_DSP_FLASHING_0XF000                      (RXBUF_UCHAR(0))
-    #define I3_RES_KLE_STAT_DSP_FLASHING_0XF000_UNIT                 '0-n'
-    #define I3_RES_KLE_STAT_DSP_FLASHING_0XF000_TYPE                 unsigned char
-        // DSP programming status. / Status der DSP-Programmierung.
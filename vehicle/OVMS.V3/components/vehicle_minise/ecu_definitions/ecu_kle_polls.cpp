@@ -1,23 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ucx2_i01.json: KLE 15: Convenience charging electronics
-// This generated code  makes it easier to process CANBUS messages from the KLE ecu in a BMW i3
-//
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_FLASH_DSPS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAF43
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE84
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LEISTUNG,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE85
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_SPANNUNG,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE86
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_STROM,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE87
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_AC_PHASENANZAHL,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF25
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LADEDAUER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB0
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_TEMPERATUREN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB1
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LEISTUNG2,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB4
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB6
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB7
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_LADEDAUER2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB8
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_UMSCHALTMATRIX,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFB9
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_SPANNUNG2,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFBA
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEGERAET_STROM2,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFBB
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFBC
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_LADEDAUER_LADEART,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFBD
-  //{ I3_ECU_KLE_TX, I3_ECU_KLE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KLE_FLASH_DSPS_0XF000,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF000
@@ -1,6178 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/komb25.json: KOM 60: Instrument panel
-// This generated code  makes it easier to process CANBUS messages from the KOM ecu in a BMW i3
-//
-
-#define I3_ECU_KOM_TX                                                0x06F160
-#define I3_ECU_KOM_RX                                                0x0660F1
-
-#define I3_PID_KOM_SELBSTTEST                                        0x0F04
-        // Self test / Selbsttest
-
-#define I3_PID_KOM_START_SYSTIME                                     0x1005
-        // Start of the system time counter Must only be implemented by the Kombi! / Start des Systemzeitzaehlers Muss
-        // nur vom Kombi umgesetzt werden!
-
-#define I3_PID_KOM_STATUS_SYSTIME                                    0x1725
-        // DM_Master_ReadTime Must be implemented by the time master. / DM_Master_ReadTime Muss vom Zeitmaster umgesetzt
-        // werden.
-
-    #define I3_RES_KOM_STAT_SEKUNDEN_SEIT_INIT_WERT                  (RXBUF_UINT32(0))
-    #define I3_RES_KOM_STAT_SEKUNDEN_SEIT_INIT_WERT_UNIT             's'
-    #define I3_RES_KOM_STAT_SEKUNDEN_SEIT_INIT_WERT_TYPE             unsigned long
-        // DM_Master_ReadTime Must be implemented by the time master. / DM_Master_ReadTime Muss vom Zeitmaster umgesetzt
-        // werden.
-
-#define I3_PID_KOM_STATUS_AKT_AUSFALL_CCMS                           0x2521
-        // Returns a list of the currently active failure CC messages / Gibt eine Liste der aktuell aktiven
-        // Ausfall-CCMeldungen zurück
-
-    // Can't yet generate code for STAT_AKT_CCMS_WERT of type data[90] at offset 0. But we account for the 90 bytes
-        // Returns a list of the currently active failure CC messages / Gibt eine Liste der aktuell aktiven
-        // Ausfall-CCMeldungen zurück
-
-// Skipping KOMBI_TESTBITMAP_HUD on 0xA102 which takes arguments
-
-// Skipping STEUERN_TESTBITMAP_KOMBI_HUD on 0xA102 which takes arguments
-
-// Skipping STEUERN_WARPING on 0xA103 which takes arguments
-
-#define I3_PID_KOM_SELBSTTEST_HUD                                    0xA104
-        // Start and stop the function test of the HUD. Functions of height adjustment, image rotation and backlighting
-        // with gradual lowering are controlled. / Starten und stoppen des Funktionstests des HUD. Funktionen
-        // Höhenverstellung, Bildrotation und Hinterleuchtung mit stufenweisem Absenken werden angesteuert.
-
-// Skipping KOMBI_BLINKER on 0xA105 which takes arguments
-
-// Skipping KOMBI_HUD_WARPLISTE on 0xA106 which takes arguments
-
-// Skipping STEUERN_HUD_BILDPOSITION_RELATIV on 0xA107 which takes arguments
-
-#define I3_PID_KOM_AO_TOTAL_TIME_RESET                               0xA108
-        // Always Open Counter reset to zero / Always Open Zähler Reset auf Null
-
-#define I3_PID_KOM_HUD_SHOWMODE                                      0xAA00
-        // starts HUD display sequence / startet HUD Anzeigesequenz
-
-#define I3_PID_KOM_HUD_LOGBUCH_RESET                                 0xAA01
-        // Reset logbook data to 0 / Logbuchdaten auf 0 zurücksetzen
-
-// Skipping HUD_BILDHOEHE on 0xD08D which takes arguments
-
-// Skipping HUD_BILDROTATION on 0xD08E which takes arguments
-
-// Skipping HUD_AKTIVIERUNG on 0xD090 which takes arguments
-
-// Skipping HUD_COMBINER_SERVICEPOSITION on 0xD0D4 which takes arguments
-
-#define I3_PID_KOM_DREHZAHL_WERT                                     0xD106
-        // Output of the engine speed. / Ausgabe der Motordrehzahl.
-
-    #define I3_RES_KOM_STAT_DREHZAHL_WERT                            (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_DREHZAHL_WERT_UNIT                       '1/min'
-    #define I3_RES_KOM_STAT_DREHZAHL_WERT_TYPE                       unsigned short
-        // Output of the engine speed. / Ausgabe der Motordrehzahl.
-
-#define I3_PID_KOM_TACHO_WERT                                        0xD107
-        // Returns the display speed. / Rückgabe der Anzeigegeschwindigkeit.
-
-    #define I3_RES_KOM_STAT_GESCHWINDIGKEIT_WERT                     (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_GESCHWINDIGKEIT_WERT_UNIT                'km/h'
-    #define I3_RES_KOM_STAT_GESCHWINDIGKEIT_WERT_TYPE                float
-        // Returns the display speed. / Rückgabe der Anzeigegeschwindigkeit.
-
-// Skipping CBS_KM_PRO_JAHR on 0xD10A which takes arguments
-
-#define I3_PID_KOM_GWSZ_ABSOLUT_WERT                                 0xD10D
-        // Call provides the displayed total odometer / Aufruf liefert den angezeigeten Gesamtwegstreckenzähler
-
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_RAM_WERT                    (RXBUF_SINT32(0))
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_RAM_WERT_UNIT               'km'
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_RAM_WERT_TYPE               long
-        // Returns the absolute total odometer from the RAM. / Liefert den absoluten Gesamtwegstreckenzähler aus dem RAM.
-
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_EEP_WERT                    (RXBUF_SINT32(4))
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_EEP_WERT_UNIT               'km'
-    #define I3_RES_KOM_STAT_ABSOLUT_GWSZ_EEP_WERT_TYPE               long
-        // Supplies the absolute total odometer from the EEPROM. / Liefert den absoluten Gesamtwegstreckenzähler aus dem
-        // EEPROM.
-
-#define I3_PID_KOM_LSS_TASTE                                         0xD10E
-        // Return of the status of the steering column button. / Rückgabe des Status der Lenkstocktaste.
-
-    #define I3_RES_KOM_STAT_KOMBI_LSS_TASTE_GEDRUECKT                (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_KOMBI_LSS_TASTE_GEDRUECKT_UNIT           '0-n'
-    #define I3_RES_KOM_STAT_KOMBI_LSS_TASTE_GEDRUECKT_TYPE           unsigned char
-        // Return of the status of the steering column button. / Rückgabe des Status der Lenkstocktaste.
-
-#define I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV                         0xD111
-        // Range display from the instrument cluster / Reichweitenanzeige aus Kombiinstrument
-
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_CURRENT_WERT              (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_CURRENT_WERT_UNIT         'km'
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_CURRENT_WERT_TYPE         float
-        // STAT_ELECTRIC_RANGE_CURRENT [0.1 km] / STAT_ELECTRIC_RANGE_CURRENT [0,1 km]
-
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_MAXIMUM_WERT              (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_MAXIMUM_WERT_UNIT         'km'
-    #define I3_RES_KOM_STAT_ELECTRIC_RANGE_MAXIMUM_WERT_TYPE         float
-        // STAT_ELECTRIC_RANGE_MAXIMUM (actual maximum, depends on battery deterioration etc.) [0.1 km] /
-        // STAT_ELECTRIC_RANGE_MAXIMUM (actual  maximum, depends on battery deterioration  etc.)  [0,1 km]
-
-    #define I3_RES_KOM_STAT_FUEL_RANGE_CURRENT_WERT                  (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KOM_STAT_FUEL_RANGE_CURRENT_WERT_UNIT             'km'
-    #define I3_RES_KOM_STAT_FUEL_RANGE_CURRENT_WERT_TYPE             float
-        // STAT_FUEL_RANGE_CURRENT [0.1 km] (0xFFFF if no REX is available) / STAT_FUEL_RANGE_CURRENT [0,1 km]  (0xFFFF
-        // if no REX is available)
-
-    #define I3_RES_KOM_STAT_FUEL_RANGE_MAXIMUM_WERT                  (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_FUEL_RANGE_MAXIMUM_WERT_UNIT             'km'
-    #define I3_RES_KOM_STAT_FUEL_RANGE_MAXIMUM_WERT_TYPE             float
-        // STAT_FUEL_RANGE_MAXIMUM (actual maximum, depends on average consumption etc.) [0.1 km] (0xFFFF if no REX is
-        // available) / STAT_FUEL_RANGE_MAXIMUM (actual  maximum, depends on average consumption etc.)  [0,1 km] (0xFFFF
-        // if no REX is available)
-
-    #define I3_RES_KOM_STAT_RANGE_CONSUMPTION_ELECTRIC_WERT          (RXBUF_UINT(8)/1000.0f)
-    #define I3_RES_KOM_STAT_RANGE_CONSUMPTION_ELECTRIC_WERT_UNIT     'kWh/100km'
-    #define I3_RES_KOM_STAT_RANGE_CONSUMPTION_ELECTRIC_WERT_TYPE     float
-        // STAT_RANGE_CONSUMPTION_ELECTRIC [kWh / 100km], (only for vehicles without STARTWETESPEICHER, 0xFFFF if not
-        // used) / STAT_RANGE_CONSUMPTION_ELECTRIC [kWh/100km], (only for vehicles without STARTWETESPEICHER, 0xFFFF if
-        // not used)
-
-    #define I3_RES_KOM_STAT_NEBENVERBRAUCHERLEISTUNG_WERT            (RXBUF_UINT(10)/100.0f)
-    #define I3_RES_KOM_STAT_NEBENVERBRAUCHERLEISTUNG_WERT_UNIT       'kW'
-    #define I3_RES_KOM_STAT_NEBENVERBRAUCHERLEISTUNG_WERT_TYPE       float
-        // STAT_NEBENVERBENVERBRAUCHERLEISTUNG_WERT [0.01 kW], (only for vehicles without STARTWERTESPEICHER, 0xFFFF if
-        // not used) / STAT_NEBENVERBRAUCHERLEISTUNG_WERT  [0,01 kW], (only for vehicles without STARTWERTESPEICHER,
-        // 0xFFFF if not used)
-
-#define I3_PID_KOM_A_TEMP_WERT                                       0xD112
-        // Returns the outside temperature in degrees Celsius. / Liefert die Außentemperatur in Grad Celsius.
-
-    #define I3_RES_KOM_STAT_A_TEMP_ANZEIGE_WERT                      (RXBUF_UCHAR(0)/2.0f-40.0)
-    #define I3_RES_KOM_STAT_A_TEMP_ANZEIGE_WERT_UNIT                 '°C'
-    #define I3_RES_KOM_STAT_A_TEMP_ANZEIGE_WERT_TYPE                 float
-        // Display value outside temperature / Anzeigewert Außentemperatur
-
-    #define I3_RES_KOM_STAT_A_TEMP_ROHWERT_WERT                      (RXBUF_UCHAR(1)/2.0f-40.0)
-    #define I3_RES_KOM_STAT_A_TEMP_ROHWERT_WERT_UNIT                 '°C'
-    #define I3_RES_KOM_STAT_A_TEMP_ROHWERT_WERT_TYPE                 float
-        // Raw value outside temperature / Rohwert Außentemperatur
-
-#define I3_PID_KOM_KOMBI_UHRZEIT_DATUM                               0xD113
-        // Call returns the time and date. / Aufruf liefert die Uhrzeit und das Datum zurück.
-
-    #define I3_RES_KOM_STAT_KOMBI_STUNDE_WERT                        (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_KOMBI_STUNDE_WERT_TYPE                   unsigned char
-        // Returns the current hour. / Rückgabe der aktuellen Stunde.
-
-    #define I3_RES_KOM_STAT_KOMBI_MINUTE_WERT                        (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_KOMBI_MINUTE_WERT_TYPE                   unsigned char
-        // Returns the current minute. / Rückgabe der aktuellen Minute.
-
-    #define I3_RES_KOM_STAT_KOMBI_SEKUNDE_WERT                       (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_KOMBI_SEKUNDE_WERT_TYPE                  unsigned char
-        // Returns the current second. / Rückgabe der aktuellen Sekunde.
-
-    #define I3_RES_KOM_STAT_KOMBI_TAG_WERT                           (RXBUF_UCHAR(3))
-    #define I3_RES_KOM_STAT_KOMBI_TAG_WERT_TYPE                      unsigned char
-        // Returns the current day. / Rückgabe des aktuellen Tag.
-
-    #define I3_RES_KOM_STAT_KOMBI_MONAT_WERT                         (RXBUF_UCHAR(4))
-    #define I3_RES_KOM_STAT_KOMBI_MONAT_WERT_TYPE                    unsigned char
-        // Returns the current month. / Rückgabe des aktuellen Monat.
-
-    #define I3_RES_KOM_STAT_KOMBI_JAHR_WERT                          (RXBUF_UINT(5))
-    #define I3_RES_KOM_STAT_KOMBI_JAHR_WERT_TYPE                     unsigned short
-        // Returns the current year. / Rückgabe des aktuellen Jahr.
-
-    #define I3_RES_KOM_STAT_KOMBI_ZEIT_FORMAT                        (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_KOMBI_ZEIT_FORMAT_UNIT                   '0-n'
-    #define I3_RES_KOM_STAT_KOMBI_ZEIT_FORMAT_TYPE                   unsigned char
-        // Returns the current display format. / Rückgabe des aktuellen Anzeigeformat.
-
-#define I3_PID_KOM_GWSZ_RESET                                        0xD114
-        // Total odometer offset. / Offset Gesamtwegstreckenzähler.
-
-    #define I3_RES_KOM_STAT_GWSZ_OFFSET_WERT                         (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_GWSZ_OFFSET_WERT_UNIT                    'km'
-    #define I3_RES_KOM_STAT_GWSZ_OFFSET_WERT_TYPE                    unsigned char
-        // Total odometer offset. / Offset Gesamtwegstreckenzähler.
-
-// Skipping KOMBI_ACC_ZEIGER on 0xD115 which takes arguments
-
-// Skipping STARTWERTESPEICHER on 0xD116 which takes arguments
-
-// Skipping KOMBI_DREHZAHL on 0xD117 which takes arguments
-
-#define I3_PID_KOM_STARTWERT_ZEITEN                                  0xD118
-        // Job reads the coded start value times / Job liest die kodierten Startwertzeiten
-
-    #define I3_RES_KOM_STAT_ANZAHL_KODIERTE_STARTZEITEN_WERT         (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_ANZAHL_KODIERTE_STARTZEITEN_WERT_TYPE    unsigned char
-        // Number of coded start times / Anzahl kodierter Startzeiten
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_1_WERT                  (RXBUF_UCHAR(1)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_1_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_2_WERT                  (RXBUF_UCHAR(2)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_2_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_3_WERT                  (RXBUF_UCHAR(3)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_3_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_4_WERT                  (RXBUF_UCHAR(4)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_4_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_5_WERT                  (RXBUF_UCHAR(5)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_5_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_6_WERT                  (RXBUF_UCHAR(6)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_6_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_7_WERT                  (RXBUF_UCHAR(7)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ANFANG_7_WERT_TYPE             float
-        // Start time start [display in hours and minutes, resolution 15 minutes, 05hex = 01:15 am] / Startzeit Anfang
-        // [Anzeige in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_1_WERT                    (RXBUF_UCHAR(8)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_1_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_2_WERT                    (RXBUF_UCHAR(9)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_2_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_3_WERT                    (RXBUF_UCHAR(10)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_3_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_4_WERT                    (RXBUF_UCHAR(11)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_4_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_5_WERT                    (RXBUF_UCHAR(12)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_5_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_6_WERT                    (RXBUF_UCHAR(13)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_6_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_7_WERT                    (RXBUF_UCHAR(14)*15.0f)
-    #define I3_RES_KOM_STAT_STARTZEIT_ENDE_7_WERT_TYPE               float
-        // Start time end [display in hours and minutes, resolution 15 minutes, 05hex = 01:15] / Startzeit Ende [Anzeige
-        // in Stunden und Minuten, Auflösung 15 Minuten, 05hex = 01:15Uhr]
-
-// Skipping KOMBI_OELTEMPERATUR on 0xD119 which takes arguments
-
-// Skipping KOMBI_TACHO on 0xD11A which takes arguments
-
-// Skipping KOMBI_KVA_OELTEMPERATUR on 0xD11C which takes arguments
-
-// Skipping KOMBI_TANKANZEIGE on 0xD11E which takes arguments
-
-#define I3_PID_KOM_TANKINHALT                                        0xD11F
-        // Return of the liter values of the tank lever sensors 1 and 2, total value undamped and damped as well as the
-        // tank phase. / Rückgabe der Literwerte der Tank-Hebelgeber 1 und 2, Summenwert ungedämpft und gedämpft sowie
-        // Tankphase.
-
-    #define I3_RES_KOM_STAT_TANKKAMMER_RECHTS_WERT                   (RXBUF_UINT(0)/128.0f)
-    #define I3_RES_KOM_STAT_TANKKAMMER_RECHTS_WERT_UNIT              'l'
-    #define I3_RES_KOM_STAT_TANKKAMMER_RECHTS_WERT_TYPE              float
-        // Contents of the right tank chamber in liters / Inhalt rechte Tankkammer in Liter
-
-    #define I3_RES_KOM_STAT_TANKKAMMER_LINKS_WERT                    (RXBUF_UINT(2)/128.0f)
-    #define I3_RES_KOM_STAT_TANKKAMMER_LINKS_WERT_UNIT               'l'
-    #define I3_RES_KOM_STAT_TANKKAMMER_LINKS_WERT_TYPE               float
-        // Contents of the left tank chamber in liters / Inhalt linke Tankkammer in Liter
-
-    #define I3_RES_KOM_STAT_SUMMENWERT_WERT                          (RXBUF_UINT(4)/128.0f)
-    #define I3_RES_KOM_STAT_SUMMENWERT_WERT_UNIT                     'l'
-    #define I3_RES_KOM_STAT_SUMMENWERT_WERT_TYPE                     float
-        // Undamped sum of the liter values of the tank lever sensors right and left in liters / Ungedämpfte Summe der
-        // Literwerte der Tank-Hebelgeber rechts und links in Liter
-
-    #define I3_RES_KOM_STAT_GEDAEMPFT_ANZ_WERT                       (RXBUF_UINT(6)/128.0f)
-    #define I3_RES_KOM_STAT_GEDAEMPFT_ANZ_WERT_UNIT                  'l'
-    #define I3_RES_KOM_STAT_GEDAEMPFT_ANZ_WERT_TYPE                  float
-        // Numerical value of damped total value from lever sensor left and right in liters / Zahlenwert gedämpfter
-        // Summenwert aus Hebelgeber links und rechts in Liter
-
-    #define I3_RES_KOM_STAT_TANKPHASE                                (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_TANKPHASE_UNIT                           '0-n'
-    #define I3_RES_KOM_STAT_TANKPHASE_TYPE                           unsigned char
-        // Tank phase: 1 = OK; 2 = at least 1 lever encoder not OK; 3 = like 2 and additionally no consumption signal /
-        // Tankphase:  1= i.O;  2= mind. 1 Hebelgeber n.i.O.; 3= wie 2 und zusaetzlich kein Verbrauchssignal
-
-#define I3_PID_KOM_TIMER_KLIMATISIERUNG                              0xD121
-        // Set timer for air conditioning / Eingestellter Timer für Klimatisierung
-
-    #define I3_RES_KOM_STAT_T1_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_T1_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T1_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_T1_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(3))
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(4))
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T1_BEDIENUNG_DATA of type data[2] at offset 5. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_T1_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T2_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(8))
-    #define I3_RES_KOM_STAT_T2_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T2_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(10))
-    #define I3_RES_KOM_STAT_T2_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T2_BEDIENUNG_DATA of type data[2] at offset 13. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(15))
-    #define I3_RES_KOM_STAT_T2_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T3_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(16))
-    #define I3_RES_KOM_STAT_T3_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T3_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_T3_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(19))
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(20))
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T3_BEDIENUNG_DATA of type data[2] at offset 21. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_T3_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T4_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_T4_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T4_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_T4_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T4_BEDIENUNG_DATA of type data[2] at offset 29. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_T4_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T5_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(32))
-    #define I3_RES_KOM_STAT_T5_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T5_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(34))
-    #define I3_RES_KOM_STAT_T5_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(35))
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T5_BEDIENUNG_DATA of type data[2] at offset 37. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(39))
-    #define I3_RES_KOM_STAT_T5_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T6_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(40))
-    #define I3_RES_KOM_STAT_T6_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T6_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_T6_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(44))
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T6_BEDIENUNG_DATA of type data[2] at offset 45. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_T6_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-    #define I3_RES_KOM_STAT_T7_ID_FUNKTION_BEDIENUNG_TIMER_WERT      (RXBUF_UINT(48))
-    #define I3_RES_KOM_STAT_T7_ID_FUNKTION_BEDIENUNG_TIMER_WERT_TYPE unsigned short
-        // ID_Ffunktion_Bedienung_Timer (ID_FN_OP_TIM) Information about EventID (auxiliary heating, auxiliary
-        // ventilation or auxiliary heating / ventilation) / ID_Funktion_Bedienung_Timer (ID_FN_OP_TIM) Information über
-        // EventID (Standheizen, Standlüften oder Standheizen/-lüften)
-
-    #define I3_RES_KOM_STAT_T7_ID_BEDIENUNG_TIMER_WERT               (RXBUF_UCHAR(50))
-    #define I3_RES_KOM_STAT_T7_ID_BEDIENUNG_TIMER_WERT_TYPE          unsigned char
-        // ID_Bedienung_Timer (ID_OP_TIM) Number of the currently adjusted timer (1 or 2) / ID_Bedienung_Timer
-        // (ID_OP_TIM) Nummer des gerade verstellten Timers (1 oder 2)
-
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT           (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT_UNIT      'h'
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT_TYPE      unsigned char
-        // Operation_Timer_Hour (OP_TIM_HR) / Bedienung_Timer_Stunde (OP_TIM_HR)
-
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT          (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT_UNIT     'min'
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT_TYPE     unsigned char
-        // Operation_Timer_Minute (OP_TIM_MN) / Bedienung_Timer_Minute (OP_TIM_MN)
-
-    // Can't yet generate code for STAT_T7_BEDIENUNG_DATA of type data[2] at offset 53. But we account for the 2 bytes
-        // Operation_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN) ==> Byte 5 (Bit
-        // 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_VAR (ST_Variante_VAR) => Byte 6
-        // (bit 0,1, 2) / Bedienung_Timer (OP_TIM) ==> Byte 5 (Bit 0,1) Laden_Abfahrt_Zeit_Auswahl (CHGNG_DPRT_T_SLCTN)
-        // ==> Byte 5 (Bit 2,3) Klima_Abfahrt_Zeit_Auswahl (AIC_DPRT_T_SLCTN) ==> Byte 5 (Bit 4,5) Status_Timer_Variante
-        // (ST_TIM_VAR) ==> Byte 6 (Bit 0,1, 2)
-
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      (RXBUF_UCHAR(55))
-    #define I3_RES_KOM_STAT_T7_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT_TYPE unsigned char
-        // Operation_Timer_Auswahl_Wochenentag (OP_TIM_SLCTN_WDAY) / Bedienung_Timer_Auswahl_Wochentag
-        // (OP_TIM_SLCTN_WDAY)
-
-// Skipping UMSATZRATEN_SPEICHER on 0xD12B which takes arguments
-
-#define I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN                           0xD12C
-        // Time stamp query of HU-relevant data / Zeitstempel Abfrage HU-relevanter Daten
-
-    #define I3_RES_KOM_STAT_SEKUNDENZAEHLER_WERT                     (RXBUF_UINT32(0))
-    #define I3_RES_KOM_STAT_SEKUNDENZAEHLER_WERT_UNIT                's'
-    #define I3_RES_KOM_STAT_SEKUNDENZAEHLER_WERT_TYPE                unsigned long
-        // Second counter [1 second] / Sekundenzähler [1 Sekunde]
-
-    // Can't yet generate code for STAT_GWSZ_TEXT of type string[3], at offset 4. But we account for the 3 bytes
-        // GWSZ [1 km] / GWSZ [1 km]
-
-    #define I3_RES_KOM_STAT_TAG_WERT                                 (RXBUF_SCHAR(7))
-    #define I3_RES_KOM_STAT_TAG_WERT_UNIT                            'd'
-    #define I3_RES_KOM_STAT_TAG_WERT_TYPE                            char
-        // Date (day) at the time of the CC query / Datum (Tag) zum Zeitpunkt der CC-Abfrage
-
-    #define I3_RES_KOM_STAT_MONAT_WERT                               (RXBUF_SCHAR(8))
-    #define I3_RES_KOM_STAT_MONAT_WERT_UNIT                          'mth'
-    #define I3_RES_KOM_STAT_MONAT_WERT_TYPE                          char
-        // Date (month) at the time of the CC query / Datum (Monat) zum Zeitpunkt der CC-Abfrage
-
-    #define I3_RES_KOM_STAT_JAHR_WERT                                (RXBUF_SCHAR(9))
-    #define I3_RES_KOM_STAT_JAHR_WERT_UNIT                           'y'
-    #define I3_RES_KOM_STAT_JAHR_WERT_TYPE                           char
-        // Date (year) at the time of the CC query, whereby the offset to the year 2000 is output here / Datum (Jahr) zum
-        // Zeitpunkt der CC-Abfrage, wobei hier das Offset auf das Jahr 2000 ausgegeben wird
-
-// Skipping KLIMA_TIMER_SCHREIBEN on 0xD12E which takes arguments
-
-#define I3_PID_KOM_SEGMENTDATEN_SPEICHER                             0xD12F
-        // Segment data storage / Segmentdatenspeicher
-
-    #define I3_RES_KOM_STAT_BLOCK_01_SEGMENT_ID_WERT                 (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_BLOCK_01_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_01_TAG_WERT                        (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_BLOCK_01_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_01_MONAT_WERT                      (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_BLOCK_01_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_01_JAHR_WERT                       (RXBUF_UCHAR(3)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_01_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_01_STUNDE_WERT                     (RXBUF_UCHAR(4))
-    #define I3_RES_KOM_STAT_BLOCK_01_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_01_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_01_MINUTE_WERT                     (RXBUF_UCHAR(5))
-    #define I3_RES_KOM_STAT_BLOCK_01_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_01_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_01_MILE_DATA of type data[3] at offset 6. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_01_A_TEMP_WERT                     (RXBUF_UCHAR(9)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_01_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_01_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(10)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(11)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_01_SOC_WERT                        (RXBUF_UCHAR(12)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_01_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_01_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_01_VERBRAUCH_DATA of type data[3] at offset 13. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_01_REKUPERATION_WERT               (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_BLOCK_01_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_01_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(17)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_01_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 18. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_01_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_01_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_01_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_01_STERNE                            (RXBUF_UCHAR(20))
-    #define I3_RES_KOM_BF_BLOCK_01_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_01_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_02_SEGMENT_ID_WERT                 (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_BLOCK_02_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_02_TAG_WERT                        (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_BLOCK_02_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_02_MONAT_WERT                      (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_BLOCK_02_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_02_JAHR_WERT                       (RXBUF_UCHAR(24)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_02_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_02_STUNDE_WERT                     (RXBUF_UCHAR(25))
-    #define I3_RES_KOM_STAT_BLOCK_02_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_02_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_02_MINUTE_WERT                     (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_BLOCK_02_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_02_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_02_MILE_DATA of type data[3] at offset 27. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_02_A_TEMP_WERT                     (RXBUF_UCHAR(30)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_02_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_02_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(31)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(32)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_02_SOC_WERT                        (RXBUF_UCHAR(33)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_02_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_02_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_02_VERBRAUCH_DATA of type data[3] at offset 34. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_02_REKUPERATION_WERT               (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_BLOCK_02_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_02_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(38)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_02_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 39. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_02_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_02_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_02_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_02_STERNE                            (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_BF_BLOCK_02_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_02_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_03_SEGMENT_ID_WERT                 (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_BLOCK_03_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_03_TAG_WERT                        (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_BLOCK_03_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_03_MONAT_WERT                      (RXBUF_UCHAR(44))
-    #define I3_RES_KOM_STAT_BLOCK_03_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_03_JAHR_WERT                       (RXBUF_UCHAR(45)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_03_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_03_STUNDE_WERT                     (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_BLOCK_03_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_03_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_03_MINUTE_WERT                     (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_BLOCK_03_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_03_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_03_MILE_DATA of type data[3] at offset 48. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_03_A_TEMP_WERT                     (RXBUF_UCHAR(51)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_03_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_03_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(52)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(53)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_03_SOC_WERT                        (RXBUF_UCHAR(54)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_03_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_03_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_03_VERBRAUCH_DATA of type data[3] at offset 55. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_03_REKUPERATION_WERT               (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_BLOCK_03_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_03_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(59)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_03_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 60. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_03_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_03_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_03_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_03_STERNE                            (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_BF_BLOCK_03_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_03_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_04_SEGMENT_ID_WERT                 (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_BLOCK_04_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_04_TAG_WERT                        (RXBUF_UCHAR(64))
-    #define I3_RES_KOM_STAT_BLOCK_04_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_04_MONAT_WERT                      (RXBUF_UCHAR(65))
-    #define I3_RES_KOM_STAT_BLOCK_04_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_04_JAHR_WERT                       (RXBUF_UCHAR(66)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_04_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_04_STUNDE_WERT                     (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_BLOCK_04_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_04_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_04_MINUTE_WERT                     (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_BLOCK_04_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_04_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_04_MILE_DATA of type data[3] at offset 69. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_04_A_TEMP_WERT                     (RXBUF_UCHAR(72)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_04_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_04_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(73)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(74)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_04_SOC_WERT                        (RXBUF_UCHAR(75)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_04_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_04_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_04_VERBRAUCH_DATA of type data[3] at offset 76. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_04_REKUPERATION_WERT               (RXBUF_UCHAR(79))
-    #define I3_RES_KOM_STAT_BLOCK_04_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_04_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(80)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_04_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 81. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_04_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_04_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_04_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_04_STERNE                            (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_BF_BLOCK_04_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_04_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_05_SEGMENT_ID_WERT                 (RXBUF_UCHAR(84))
-    #define I3_RES_KOM_STAT_BLOCK_05_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_05_TAG_WERT                        (RXBUF_UCHAR(85))
-    #define I3_RES_KOM_STAT_BLOCK_05_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_05_MONAT_WERT                      (RXBUF_UCHAR(86))
-    #define I3_RES_KOM_STAT_BLOCK_05_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_05_JAHR_WERT                       (RXBUF_UCHAR(87)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_05_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_05_STUNDE_WERT                     (RXBUF_UCHAR(88))
-    #define I3_RES_KOM_STAT_BLOCK_05_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_05_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_05_MINUTE_WERT                     (RXBUF_UCHAR(89))
-    #define I3_RES_KOM_STAT_BLOCK_05_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_05_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_05_MILE_DATA of type data[3] at offset 90. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_05_A_TEMP_WERT                     (RXBUF_UCHAR(93)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_05_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_05_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(94)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(95)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_05_SOC_WERT                        (RXBUF_UCHAR(96)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_05_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_05_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_05_VERBRAUCH_DATA of type data[3] at offset 97. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_05_REKUPERATION_WERT               (RXBUF_UCHAR(100))
-    #define I3_RES_KOM_STAT_BLOCK_05_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_05_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(101)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_05_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 102. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_05_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_05_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_05_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_05_STERNE                            (RXBUF_UCHAR(104))
-    #define I3_RES_KOM_BF_BLOCK_05_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_05_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_06_SEGMENT_ID_WERT                 (RXBUF_UCHAR(105))
-    #define I3_RES_KOM_STAT_BLOCK_06_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_06_TAG_WERT                        (RXBUF_UCHAR(106))
-    #define I3_RES_KOM_STAT_BLOCK_06_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_06_MONAT_WERT                      (RXBUF_UCHAR(107))
-    #define I3_RES_KOM_STAT_BLOCK_06_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_06_JAHR_WERT                       (RXBUF_UCHAR(108)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_06_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_06_STUNDE_WERT                     (RXBUF_UCHAR(109))
-    #define I3_RES_KOM_STAT_BLOCK_06_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_06_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_06_MINUTE_WERT                     (RXBUF_UCHAR(110))
-    #define I3_RES_KOM_STAT_BLOCK_06_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_06_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_06_MILE_DATA of type data[3] at offset 111. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_06_A_TEMP_WERT                     (RXBUF_UCHAR(114)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_06_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_06_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(115)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(116)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_06_SOC_WERT                        (RXBUF_UCHAR(117)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_06_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_06_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_06_VERBRAUCH_DATA of type data[3] at offset 118. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_06_REKUPERATION_WERT               (RXBUF_UCHAR(121))
-    #define I3_RES_KOM_STAT_BLOCK_06_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_06_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(122)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_06_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 123. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_06_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_06_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_06_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_06_STERNE                            (RXBUF_UCHAR(125))
-    #define I3_RES_KOM_BF_BLOCK_06_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_06_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_07_SEGMENT_ID_WERT                 (RXBUF_UCHAR(126))
-    #define I3_RES_KOM_STAT_BLOCK_07_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_07_TAG_WERT                        (RXBUF_UCHAR(127))
-    #define I3_RES_KOM_STAT_BLOCK_07_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_07_MONAT_WERT                      (RXBUF_UCHAR(128))
-    #define I3_RES_KOM_STAT_BLOCK_07_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_07_JAHR_WERT                       (RXBUF_UCHAR(129)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_07_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_07_STUNDE_WERT                     (RXBUF_UCHAR(130))
-    #define I3_RES_KOM_STAT_BLOCK_07_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_07_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_07_MINUTE_WERT                     (RXBUF_UCHAR(131))
-    #define I3_RES_KOM_STAT_BLOCK_07_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_07_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_07_MILE_DATA of type data[3] at offset 132. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_07_A_TEMP_WERT                     (RXBUF_UCHAR(135)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_07_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_07_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(136)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(137)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_07_SOC_WERT                        (RXBUF_UCHAR(138)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_07_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_07_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_07_VERBRAUCH_DATA of type data[3] at offset 139. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_07_REKUPERATION_WERT               (RXBUF_UCHAR(142))
-    #define I3_RES_KOM_STAT_BLOCK_07_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_07_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(143)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_07_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 144. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_07_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_07_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_07_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_07_STERNE                            (RXBUF_UCHAR(146))
-    #define I3_RES_KOM_BF_BLOCK_07_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_07_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_08_SEGMENT_ID_WERT                 (RXBUF_UCHAR(147))
-    #define I3_RES_KOM_STAT_BLOCK_08_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_08_TAG_WERT                        (RXBUF_UCHAR(148))
-    #define I3_RES_KOM_STAT_BLOCK_08_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_08_MONAT_WERT                      (RXBUF_UCHAR(149))
-    #define I3_RES_KOM_STAT_BLOCK_08_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_08_JAHR_WERT                       (RXBUF_UCHAR(150)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_08_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_08_STUNDE_WERT                     (RXBUF_UCHAR(151))
-    #define I3_RES_KOM_STAT_BLOCK_08_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_08_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_08_MINUTE_WERT                     (RXBUF_UCHAR(152))
-    #define I3_RES_KOM_STAT_BLOCK_08_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_08_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_08_MILE_DATA of type data[3] at offset 153. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_08_A_TEMP_WERT                     (RXBUF_UCHAR(156)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_08_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_08_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(157)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(158)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_08_SOC_WERT                        (RXBUF_UCHAR(159)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_08_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_08_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_08_VERBRAUCH_DATA of type data[3] at offset 160. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_08_REKUPERATION_WERT               (RXBUF_UCHAR(163))
-    #define I3_RES_KOM_STAT_BLOCK_08_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_08_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(164)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_08_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 165. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_08_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_08_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_08_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_08_STERNE                            (RXBUF_UCHAR(167))
-    #define I3_RES_KOM_BF_BLOCK_08_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_08_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_09_SEGMENT_ID_WERT                 (RXBUF_UCHAR(168))
-    #define I3_RES_KOM_STAT_BLOCK_09_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_09_TAG_WERT                        (RXBUF_UCHAR(169))
-    #define I3_RES_KOM_STAT_BLOCK_09_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_09_MONAT_WERT                      (RXBUF_UCHAR(170))
-    #define I3_RES_KOM_STAT_BLOCK_09_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_09_JAHR_WERT                       (RXBUF_UCHAR(171)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_09_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_09_STUNDE_WERT                     (RXBUF_UCHAR(172))
-    #define I3_RES_KOM_STAT_BLOCK_09_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_09_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_09_MINUTE_WERT                     (RXBUF_UCHAR(173))
-    #define I3_RES_KOM_STAT_BLOCK_09_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_09_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_09_MILE_DATA of type data[3] at offset 174. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_09_A_TEMP_WERT                     (RXBUF_UCHAR(177)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_09_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_09_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(178)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(179)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_09_SOC_WERT                        (RXBUF_UCHAR(180)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_09_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_09_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_09_VERBRAUCH_DATA of type data[3] at offset 181. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_09_REKUPERATION_WERT               (RXBUF_UCHAR(184))
-    #define I3_RES_KOM_STAT_BLOCK_09_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_09_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(185)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_09_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 186. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_09_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_09_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_09_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_09_STERNE                            (RXBUF_UCHAR(188))
-    #define I3_RES_KOM_BF_BLOCK_09_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_09_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-    #define I3_RES_KOM_STAT_BLOCK_10_SEGMENT_ID_WERT                 (RXBUF_UCHAR(189))
-    #define I3_RES_KOM_STAT_BLOCK_10_SEGMENT_ID_WERT_TYPE            unsigned char
-        // Segment ID / Segment ID
-
-    #define I3_RES_KOM_STAT_BLOCK_10_TAG_WERT                        (RXBUF_UCHAR(190))
-    #define I3_RES_KOM_STAT_BLOCK_10_TAG_WERT_TYPE                   unsigned char
-        // Day / Tag
-
-    #define I3_RES_KOM_STAT_BLOCK_10_MONAT_WERT                      (RXBUF_UCHAR(191))
-    #define I3_RES_KOM_STAT_BLOCK_10_MONAT_WERT_TYPE                 unsigned char
-        // month / Monat
-
-    #define I3_RES_KOM_STAT_BLOCK_10_JAHR_WERT                       (RXBUF_UCHAR(192)+2000.0)
-    #define I3_RES_KOM_STAT_BLOCK_10_JAHR_WERT_TYPE                  unsigned char
-        // year / Jahr
-
-    #define I3_RES_KOM_STAT_BLOCK_10_STUNDE_WERT                     (RXBUF_UCHAR(193))
-    #define I3_RES_KOM_STAT_BLOCK_10_STUNDE_WERT_UNIT                'h'
-    #define I3_RES_KOM_STAT_BLOCK_10_STUNDE_WERT_TYPE                unsigned char
-        // hour / Stunde
-
-    #define I3_RES_KOM_STAT_BLOCK_10_MINUTE_WERT                     (RXBUF_UCHAR(194))
-    #define I3_RES_KOM_STAT_BLOCK_10_MINUTE_WERT_UNIT                'min'
-    #define I3_RES_KOM_STAT_BLOCK_10_MINUTE_WERT_TYPE                unsigned char
-        // minute / Minute
-
-    // Can't yet generate code for STAT_BLOCK_10_MILE_DATA of type data[3] at offset 195. But we account for the 3 bytes
-        // Mile / Mile
-
-    #define I3_RES_KOM_STAT_BLOCK_10_A_TEMP_WERT                     (RXBUF_UCHAR(198)*0.5f-40.0)
-    #define I3_RES_KOM_STAT_BLOCK_10_A_TEMP_WERT_UNIT                '°C'
-    #define I3_RES_KOM_STAT_BLOCK_10_A_TEMP_WERT_TYPE                float
-        // Outside temperature [-40 to + 50 ° C] / Außentemperatur [-40 bis +50°C]
-
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECO_WERT              (RXBUF_UCHAR(199)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECO_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECO_WERT_TYPE         float
-        // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT    (RXBUF_UCHAR(200)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT_TYPE float
-        // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-
-    #define I3_RES_KOM_STAT_BLOCK_10_SOC_WERT                        (RXBUF_UCHAR(201)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_10_SOC_WERT_UNIT                   '%'
-    #define I3_RES_KOM_STAT_BLOCK_10_SOC_WERT_TYPE                   float
-        // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-
-    // Can't yet generate code for STAT_BLOCK_10_VERBRAUCH_DATA of type data[3] at offset 202. But we account for the 3 bytes
-        // Electric consumption absolute and comfort / Elektrischer Verbrauch absolute und komfort
-
-    #define I3_RES_KOM_STAT_BLOCK_10_REKUPERATION_WERT               (RXBUF_UCHAR(205))
-    #define I3_RES_KOM_STAT_BLOCK_10_REKUPERATION_WERT_UNIT          'kWh'
-    #define I3_RES_KOM_STAT_BLOCK_10_REKUPERATION_WERT_TYPE          unsigned char
-        // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-
-    #define I3_RES_KOM_STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT      (RXBUF_UCHAR(206)/2.0f)
-    #define I3_RES_KOM_STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT_TYPE float
-        // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-
-    // Can't yet generate code for STAT_BLOCK_10_VERBRAUCHTER_KRAFTSTOFF_DATA of type data[2] at offset 207. But we account for the 2 bytes
-        // Consumed fuel [0-102.2 L] / Verbrauchter Kraftstoff [0-102,2 L]
-
-    // BF_BLOCK_10_STERNE is a BITFIELD of size unsigned char.  We don't yet generate definitions for each bit, we treat as the host data type
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-            // STAT_BLOCK_10_STERNE_BESCHLEUNIGUNG: Mask: 0x05 - Stars for acceleration
-            // STAT_BLOCK_10_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
-    #define I3_RES_KOM_BF_BLOCK_10_STERNE                            (RXBUF_UCHAR(209))
-    #define I3_RES_KOM_BF_BLOCK_10_STERNE_UNIT                       'Bit'
-    #define I3_RES_KOM_BF_BLOCK_10_STERNE_TYPE                       unsigned char
-        // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
-        // Bremsen
-
-#define I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF                  0xD1D0
-        // Range and fuel gained / Reichweite und gewonnener Kraftstoff
-
-    #define I3_RES_KOM_STAT_PRW_WERT                                 (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_PRW_WERT_UNIT                            'km'
-    #define I3_RES_KOM_STAT_PRW_WERT_TYPE                            unsigned short
-        // Potential range (PRW) / Potentielle Reichweite (PRW)
-
-    #define I3_RES_KOM_STAT_CRW_WERT                                 (RXBUF_UINT(2))
-    #define I3_RES_KOM_STAT_CRW_WERT_UNIT                            'km'
-    #define I3_RES_KOM_STAT_CRW_WERT_TYPE                            unsigned short
-        // Comfort mode range (CRW) / Comfort- Mode Reichweite (CRW)
-
-    #define I3_RES_KOM_STAT_BCRW_WERT                                (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KOM_STAT_BCRW_WERT_UNIT                           'km'
-    #define I3_RES_KOM_STAT_BCRW_WERT_TYPE                           float
-        // BC range in 0.1 km / BC- Reichweite in 0,1 km
-
-    #define I3_RES_KOM_STAT_GRW_WERT                                 (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_GRW_WERT_UNIT                            'km'
-    #define I3_RES_KOM_STAT_GRW_WERT_TYPE                            float
-        // Gained range (GRW) / Gewonnene Reichweite (GRW)
-
-    #define I3_RES_KOM_STAT_GK_WERT                                  (RXBUF_UINT32(8)/10.0f)
-    #define I3_RES_KOM_STAT_GK_WERT_UNIT                             'µl'
-    #define I3_RES_KOM_STAT_GK_WERT_TYPE                             float
-        // recovered fuel (GK) / gewonnener Kraftstoff (GK)
-
-#define I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA                         0xD1D1
-        // Increase in consumption alpha / Verbrauchserhöhung alpha
-
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT                 (RXBUF_UINT32(0))
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_UNIT            'µl'
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_TYPE            unsigned long
-        // accumulated absolute consumption increase / akkumulierte absolute Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT              (RXBUF_UINT32(4))
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_UNIT         'µl'
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_TYPE         unsigned long
-        // Increase in consumption through delay / Verbrauchserhöhung durch Verzögerung
-
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT                       (RXBUF_UINT32(8))
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT_UNIT                  'µl'
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT_TYPE                  unsigned long
-        // Increase in consumption through MSA / Verbrauchserhöhung durch MSA
-
-    #define I3_RES_KOM_STAT_V_REF_WERT                               (RXBUF_UINT(12)/10.0f)
-    #define I3_RES_KOM_STAT_V_REF_WERT_UNIT                          'km/h'
-    #define I3_RES_KOM_STAT_V_REF_WERT_TYPE                          float
-        // V ref / V ref
-
-    #define I3_RES_KOM_STAT_V_IST_WERT                               (RXBUF_UINT(14)/10.0f)
-    #define I3_RES_KOM_STAT_V_IST_WERT_UNIT                          'km/h'
-    #define I3_RES_KOM_STAT_V_IST_WERT_TYPE                          float
-        // V is / V ist
-
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT                             (RXBUF_UINT(16)/40.0f)
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_UNIT                        '%'
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_TYPE                        float
-        // FWP act / FWP akt
-
-    // STAT_BLS_VERZOEGERUNG is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Status_BLS / delay / Status_BLS / Verzögerung
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG                         (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_UNIT                    'Bit'
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_TYPE                    unsigned char
-        // Status_BLS / delay / Status_BLS / Verzögerung
-
-#define I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI                            0xD1D2
-        // PI consumption increase / Verbrauchserhöhung PI
-
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT                   (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_UNIT              '%'
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_TYPE              float
-        // PI percentage increase in consumption / PI prozentuale Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT                     (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT_UNIT                '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT_TYPE                float
-        // PI increase in consumption through gear selection / PI Verbrauchserhöhung durch Gangwahl
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT                 (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_UNIT            '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_TYPE            float
-        // PI increase in consumption through speed / PI Verbrauchserhöhung durch Geschwindigkeit
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT                 (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_UNIT            '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_TYPE            float
-        // PI increase in consumption through acceleration / PI Verbrauchserhöhung durch Beschleunigung
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT                   (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_UNIT              '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_TYPE              float
-        // PI increase in consumption through convenience / PI Verbrauchserhöhung durch Komfort
-
-#define I3_PID_KOM_MEHRVERBRAUCH_MV_REF                              0xD1D3
-        // Additional consumption MVref / Mehrverbrauch MVref
-
-    #define I3_RES_KOM_STAT_MV_AKT_WERT                              (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_MV_AKT_WERT_UNIT                         'l/100km'
-    #define I3_RES_KOM_STAT_MV_AKT_WERT_TYPE                         float
-        // Current consumption / Mehrverbrauch aktuell
-
-    #define I3_RES_KOM_STAT_MV_REF_WERT                              (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_WERT_UNIT                         'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_WERT_TYPE                         float
-        // Overconsumption Ref (V act) / Mehrverbrauch Ref (V ist)
-
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT                           (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT_UNIT                      'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT_TYPE                      float
-        // Additional consumption Ref 30 / Mehrverbrauch Ref 30
-
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT                           (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT_UNIT                      'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT_TYPE                      float
-        // Additional consumption Ref 70 / Mehrverbrauch Ref 70
-
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT                          (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT_UNIT                     'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT_TYPE                     float
-        // Additional consumption Ref 100 / Mehrverbrauch Ref 100
-
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT                          (RXBUF_UINT(10)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT_UNIT                     'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT_TYPE                     float
-        // Additional consumption Ref Max / Mehrverbrauch Ref Max
-
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT                       (RXBUF_UINT(12)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT_UNIT                  'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT_TYPE                  float
-        // Additional consumption ref total / Mehrverbrauch Ref Gesamt
-
-#define I3_PID_KOM_ECO_MODE_AUSTRITT                                 0xD1D4
-        // ECO mode exit / ECO- Mode Austritt
-
-    // STAT_ECO_MODE_AUSTRITT is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // ECO mode exit / ECO- Mode Austritt
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT                        (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT_UNIT                   'Bit'
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT_TYPE                   unsigned char
-        // ECO mode exit / ECO- Mode Austritt
-
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ                             (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ_UNIT                        '0-n'
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ_TYPE                        unsigned char
-        // ECO tip display / ECO Tipp Anzeige
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X                          0xD1D5
-        // Consumption scaling x / Verbräuche Skalierung x
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT          (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_UNIT     'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_TYPE     float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT         (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_UNIT    'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_TYPE    float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT               (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT        (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT                 (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT                  (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT               (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT        (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT                 (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT                  (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT               (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT        (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT                 (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT                  (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT               (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT        (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT                 (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT                  (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT               (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT        (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT                 (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT                  (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT               (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT        (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT                 (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT                  (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT               (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT        (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT                 (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT                  (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT               (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT        (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT                 (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT                  (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT               (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT        (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT                 (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT                  (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT              (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT       (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT                (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT                 (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT              (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT       (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT                (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT                 (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT              (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT       (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT                (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT                 (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT              (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT       (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT                (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT                 (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT              (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT       (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT                (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT                 (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT              (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT       (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT                (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT                 (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT              (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT       (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT                (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT                 (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y                          0xD1D6
-        // Consumption scaling y / Verbräuche Skalierung y
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT          (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_UNIT     'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_TYPE     float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT         (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_UNIT    'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_TYPE    float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT               (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT        (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT                 (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT                  (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT               (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT        (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT                 (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT                  (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT               (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT        (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT                 (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT                  (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT               (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT        (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT                 (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT                  (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT               (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT        (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT                 (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT                  (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT               (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT        (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT                 (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT                  (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT               (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT        (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT                 (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT                  (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT               (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT        (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT                 (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT                  (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT               (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT        (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT                 (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT                  (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT              (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT       (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT                (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT                 (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT              (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT       (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT                (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT                 (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT              (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT       (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT                (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT                 (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT              (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT       (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT                (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT                 (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT              (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT       (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT                (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT                 (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT              (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT       (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT                (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT                 (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT              (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT       (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT                (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT                 (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z                          0xD1D7
-        // Consumption scaling e.g. / Verbräuche Skalierung z
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT          (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_UNIT     'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_TYPE     float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT         (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_UNIT    'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_TYPE    float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT               (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT        (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT                 (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT                  (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT               (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT        (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT                 (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT                  (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT               (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT        (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT                 (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT                  (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT               (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT        (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT                 (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT                  (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT               (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT        (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT                 (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT                  (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT               (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT        (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT                 (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT                  (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT               (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT        (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT                 (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT                  (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT               (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT        (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT                 (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT                  (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT               (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT        (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT                 (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT                  (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT              (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT       (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT                (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT                 (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT              (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT       (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT                (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT                 (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT              (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT       (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT                (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT                 (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT              (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT       (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT                (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT                 (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT              (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT       (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT                (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT                 (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT              (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT       (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT                (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT                 (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT              (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT       (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT                (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT                 (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A                          0xD1D8
-        // Consumption scaling a / Verbräuche Skalierung a
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT          (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_UNIT     'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_TYPE     float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT         (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_UNIT    'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_TYPE    float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT               (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT        (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT                 (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT                  (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT               (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT        (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT                 (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT                  (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT               (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT        (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT                 (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT                  (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT               (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT        (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT                 (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT                  (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT               (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT        (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT                 (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT                  (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT               (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT        (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT                 (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT                  (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT               (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT        (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT                 (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT                  (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT               (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT        (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT                 (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT                  (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT               (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_UNIT          '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_TYPE          unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT        (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_TYPE   unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT                 (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT_TYPE            unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT                  (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_UNIT             'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_TYPE             unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT              (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT       (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT                (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT                 (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT              (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT       (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT                (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT                 (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT              (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT       (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT                (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT                 (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT              (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT       (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT                (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT                 (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT              (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT       (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT                (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT                 (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT              (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT       (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT                (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT                 (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT              (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_UNIT         '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_TYPE         unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT       (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_TYPE  unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT                (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT_TYPE           unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT                 (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_TYPE            unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT              0xD1D9
-        // Consumption / consumption advantage hybrid current segment / Verbrauch / Verbrauchsvorteil Hybrid aktuelles
-        // Segment
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT    (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_TYPE float
-        // Average value of the act. calculated segment in 0.1 / Durchschnittswert des akt. berechneten Segments in 0,1
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_TYPE unsigned char
-        // Average value hybrid recovery of the act. Segments / Durchschnittswert Hybridrückgewinnung des akt. Segments
-
-#define I3_PID_KOM_KOMBI_HUD_AKTIVE_WARPLISTE                        0xDA00
-        // Query which WARLIST is currently active. For status see table: TAB_WARPLISTE / Abfrage, welche WARPLISTE
-        // momentan aktiv ist. Status siehe Tabelle:  TAB_WARPLISTE
-
-    #define I3_RES_KOM_STAT_WARPLISTE_AKTIV                          (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_WARPLISTE_AKTIV_UNIT                     '0-n'
-    #define I3_RES_KOM_STAT_WARPLISTE_AKTIV_TYPE                     unsigned char
-        // Query which WARLIST is currently active. For status see table: TAB_WARPLISTE / Abfrage, welche WARPLISTE
-        // momentan aktiv ist. Status siehe Tabelle:  TAB_WARPLISTE
-
-#define I3_PID_KOM_STATUS_HUD_BILDPOSITION_SCHRITTE                  0xDA0A
-        // Job supplies the position of the stepper motor for the height adjustment / Job liefert die Position des
-        // Schrittmotors für die Höhenverstellung
-
-    #define I3_RES_KOM_STAT_HUD_BILDPOSITION_SCHRITTE_WERT           (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_HUD_BILDPOSITION_SCHRITTE_WERT_UNIT      'Schritte'
-    #define I3_RES_KOM_STAT_HUD_BILDPOSITION_SCHRITTE_WERT_TYPE      unsigned short
-        // Job supplies the position of the stepper motor for the height adjustment / Job liefert die Position des
-        // Schrittmotors für die Höhenverstellung
-
-// Skipping STEUERN_HUD_HELLIGKEIT on 0xDA0C which takes arguments
-
-#define I3_PID_KOM_STATUS_HUD_BILDROTATION_SCHRITTE                  0xDA0F
-        // Job supplies the position of the stepper motor for the image rotation / Job liefert die Position des
-        // Schrittmotors für die Bildrotation
-
-    #define I3_RES_KOM_STAT_HUD_BILDROTATION_SCHRITTE_WERT           (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_HUD_BILDROTATION_SCHRITTE_WERT_TYPE      unsigned short
-        // Job supplies the position of the stepper motor for the image rotation / Job liefert die Position des
-        // Schrittmotors für die Bildrotation
-
-#define I3_PID_KOM_HUD_PORTS_LESEN                                   0xDA43
-        // read internal measured values / interne Messwerte lesen
-
-    #define I3_RES_KOM_STAT_HUD_AD_TEMP_BL_WERT                      (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_HUD_AD_TEMP_BL_WERT_UNIT                 '°C'
-    #define I3_RES_KOM_STAT_HUD_AD_TEMP_BL_WERT_TYPE                 char
-        // Temperature LED / Temperatur LED
-
-    #define I3_RES_KOM_STAT_HUD_AD_KL30_WERT                         (RXBUF_UCHAR(1)/10.0f)
-    #define I3_RES_KOM_STAT_HUD_AD_KL30_WERT_UNIT                    'V'
-    #define I3_RES_KOM_STAT_HUD_AD_KL30_WERT_TYPE                    float
-        // Voltage terminal 30 / Spannung Klemme 30
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_CUR_WERT                     (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_CUR_WERT_UNIT                'A'
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_CUR_WERT_TYPE                unsigned char
-        // LED power / LED Strom
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_SPG_WERT                     (RXBUF_UCHAR(3))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_SPG_WERT_UNIT                'V'
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_SPG_WERT_TYPE                unsigned char
-        // LED voltage / LED Spannung
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET1_WERT                    (RXBUF_UCHAR(4))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET1_WERT_UNIT               'V'
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET1_WERT_TYPE               unsigned char
-        // FET tension chain 1 / FET Spannung Kette 1
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET2_WERT                    (RXBUF_UCHAR(5))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET2_WERT_UNIT               'V'
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FET2_WERT_TYPE               unsigned char
-        // FET tension chain 2 / FET Spannung Kette 2
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_OV_WERT                      (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_OV_WERT_UNIT                 'V'
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_OV_WERT_TYPE                 unsigned char
-        // Overload / Überspannung
-
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FAULT_WERT                   (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_HUD_LED_DRV_FAULT_WERT_TYPE              unsigned char
-        // LED driver error / Fehler LED Treiber
-
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_WERT                         (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_WERT_UNIT                    '%'
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_WERT_TYPE                    float
-        // PWM / PWM
-
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_INV_WERT                     (RXBUF_UINT(10)/100.0f)
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_INV_WERT_UNIT                '%'
-    #define I3_RES_KOM_STAT_HUD_LED_PWM_INV_WERT_TYPE                float
-        // PWM inverted / PWM invertiert
-
-    #define I3_RES_KOM_STAT_HUD_SMC_FLAGS_WERT                       (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_HUD_SMC_FLAGS_WERT_TYPE                  unsigned char
-        // SMC status flags / SMC Status Flags
-
-    #define I3_RES_KOM_STAT_RESERVE1_WERT                            (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_RESERVE1_WERT_TYPE                       unsigned char
-        // Reserve 1 / Reserve 1
-
-    #define I3_RES_KOM_STAT_RESERVE2_WERT                            (RXBUF_UCHAR(14))
-    #define I3_RES_KOM_STAT_RESERVE2_WERT_TYPE                       unsigned char
-        // Reserve 2 / Reserve 2
-
-    #define I3_RES_KOM_STAT_RESERVE3_WERT                            (RXBUF_UCHAR(15))
-    #define I3_RES_KOM_STAT_RESERVE3_WERT_TYPE                       unsigned char
-        // Reserve 3 / Reserve 3
-
-    #define I3_RES_KOM_STAT_RESERVE4_WERT                            (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_RESERVE4_WERT_TYPE                       unsigned char
-        // Reserve 4 / Reserve 4
-
-#define I3_PID_KOM_HUD_SW_VERSION_LESEN                              0xDA44
-        // Read HUD SW version / HUD SW Version lesen
-
-    #define I3_RES_KOM_STAT_SW_VERSION_MAIN_WERT                     (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_SW_VERSION_MAIN_WERT_UNIT                'HEX'
-    #define I3_RES_KOM_STAT_SW_VERSION_MAIN_WERT_TYPE                unsigned char
-        // Version number of the HUD SW in the Kombi (Main) / Versionsnummer der HUD SW im Kombi (Main)
-
-    #define I3_RES_KOM_STAT_SW_VERSION_MINOR_WERT                    (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_SW_VERSION_MINOR_WERT_UNIT               'HEX'
-    #define I3_RES_KOM_STAT_SW_VERSION_MINOR_WERT_TYPE               unsigned char
-        // Version number of the HUD SW in the combi (minor) / Versionsnummer der HUD SW im Kombi (Minor)
-
-    #define I3_RES_KOM_STAT_SW_VERSION_PATCH_WERT                    (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_SW_VERSION_PATCH_WERT_UNIT               'HEX'
-    #define I3_RES_KOM_STAT_SW_VERSION_PATCH_WERT_TYPE               unsigned char
-        // Version number of the HUD SW in the combi (patch) / Versionsnummer der HUD SW im Kombi (Patch)
-
-#define I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT                0xDA46
-        // Read identification data / Identifikation Daten lesen
-
-    #define I3_RES_KOM_STAT_SENSOR_VERBAUORT_NR_WERT                 (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_SENSOR_VERBAUORT_NR_WERT_TYPE            unsigned short
-        // Place of installation / Verbauort
-
-    #define I3_RES_KOM_STAT_SENSOR_BMW_TEILE_NR_WERT                 (RXBUF_UINT32(2))
-    #define I3_RES_KOM_STAT_SENSOR_BMW_TEILE_NR_WERT_UNIT            'HEX'
-    #define I3_RES_KOM_STAT_SENSOR_BMW_TEILE_NR_WERT_TYPE            unsigned long
-        // BMW part number / BMW Sachnummer
-
-    #define I3_RES_KOM_STAT_SENSOR_HERSTELLER_NR_WERT                (RXBUF_UINT(6))
-    #define I3_RES_KOM_STAT_SENSOR_HERSTELLER_NR_WERT_TYPE           unsigned short
-        // Manufacturer number / Herstellernummer
-
-    #define I3_RES_KOM_STAT_SENSOR_SERIEN_NR_WERT                    (RXBUF_UINT32(8))
-    #define I3_RES_KOM_STAT_SENSOR_SERIEN_NR_WERT_TYPE               unsigned long
-        // serial number / Seriennummer
-
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_YEAR_WERT              (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_YEAR_WERT_TYPE         unsigned char
-        // Production date year / Produktionsdatum Jahr
-
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_MONTH_WERT             (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_MONTH_WERT_TYPE        unsigned char
-        // Production date month / Produktionsdatum Monat
-
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_DAY_WERT               (RXBUF_UCHAR(14))
-    #define I3_RES_KOM_STAT_SENSOR_PROD_DATUM_DAY_WERT_TYPE          unsigned char
-        // Production date day / Produktionsdatum Tag
-
-    #define I3_RES_KOM_STAT_SENSOR_HW_VERSION_NR_WERT                (RXBUF_UINT(15))
-    #define I3_RES_KOM_STAT_SENSOR_HW_VERSION_NR_WERT_TYPE           unsigned short
-        // HW version number / HW Versionsnummer
-
-    #define I3_RES_KOM_STAT_SENSOR_OPTIK_VERSION_NR_WERT             (RXBUF_UINT(17))
-    #define I3_RES_KOM_STAT_SENSOR_OPTIK_VERSION_NR_WERT_TYPE        unsigned short
-        // Optics version number / Optikversionsnummer
-
-    #define I3_RES_KOM_STAT_SENSOR_MECHANIK_VERSION_NR_WERT          (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_SENSOR_MECHANIK_VERSION_NR_WERT_TYPE     unsigned short
-        // Mechanics version number / Mechanikversionsnummer
-
-    #define I3_RES_KOM_STAT_SENSOR_FLASH_VERSION_NR_WERT             (RXBUF_UINT(21))
-    #define I3_RES_KOM_STAT_SENSOR_FLASH_VERSION_NR_WERT_TYPE        unsigned short
-        // Flash version number / Flashversionsnummer
-
-#define I3_PID_KOM_KOMBI_HUD_BILDPOSITION_STUFEN                     0xDA47
-        // Set level of the image position from the HUD / Eingestellte Stufe der Bildposition vom HUD
-
-    #define I3_RES_KOM_STAT_HUD_BILDROTATION_STUFEN_WERT             (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_HUD_BILDROTATION_STUFEN_WERT_TYPE        char
-        // Set level of the image position from the HUD / Eingestellte Stufe der Bildposition vom HUD
-
-// Skipping _TWSZ on 0x4010 which takes arguments
-
-// Skipping _TWSZ_I3 on 0x4015 which takes arguments
-
-#define I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200           0x4200
-        // Range and fuel gained / Reichweite und gewonnener Kraftstoff
-
-    #define I3_RES_KOM_STAT_PRW_WERT_0X4200                          (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_PRW_WERT_0X4200_UNIT                     'km'
-    #define I3_RES_KOM_STAT_PRW_WERT_0X4200_TYPE                     unsigned short
-        // Potential range (PRW) / Potentielle Reichweite (PRW)
-
-    #define I3_RES_KOM_STAT_CRW_WERT_0X4200                          (RXBUF_UINT(2))
-    #define I3_RES_KOM_STAT_CRW_WERT_0X4200_UNIT                     'km'
-    #define I3_RES_KOM_STAT_CRW_WERT_0X4200_TYPE                     unsigned short
-        // Comfort mode range (CRW) / Comfort- Mode Reichweite (CRW)
-
-    #define I3_RES_KOM_STAT_BCRW_WERT_0X4200                         (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KOM_STAT_BCRW_WERT_0X4200_UNIT                    'km'
-    #define I3_RES_KOM_STAT_BCRW_WERT_0X4200_TYPE                    float
-        // BC range in 0.1 km / BC- Reichweite in 0,1 km
-
-    #define I3_RES_KOM_STAT_GRW_WERT_0X4200                          (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_GRW_WERT_0X4200_UNIT                     'km'
-    #define I3_RES_KOM_STAT_GRW_WERT_0X4200_TYPE                     float
-        // Gained range (GRW) / Gewonnene Reichweite (GRW)
-
-    #define I3_RES_KOM_STAT_GK_WERT_0X4200                           (RXBUF_UINT32(8)/10.0f)
-    #define I3_RES_KOM_STAT_GK_WERT_0X4200_UNIT                      'µl'
-    #define I3_RES_KOM_STAT_GK_WERT_0X4200_TYPE                      float
-        // recovered fuel (GK) / gewonnener Kraftstoff (GK)
-
-#define I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201                  0x4201
-        // Increase in consumption alpha / Verbrauchserhöhung alpha
-
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201          (RXBUF_UINT32(0))
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201_UNIT     'µl'
-    #define I3_RES_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201_TYPE     unsigned long
-        // accumulated absolute consumption increase / akkumulierte absolute Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201       (RXBUF_UINT32(4))
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201_UNIT  'µl'
-    #define I3_RES_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201_TYPE  unsigned long
-        // Increase in consumption through delay / Verbrauchserhöhung durch Verzögerung
-
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT_0X4201                (RXBUF_UINT32(8))
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT_0X4201_UNIT           'µl'
-    #define I3_RES_KOM_STAT_VERBR_ERH_MSA_WERT_0X4201_TYPE           unsigned long
-        // Increase in consumption through MSA / Verbrauchserhöhung durch MSA
-
-    #define I3_RES_KOM_STAT_V_REF_WERT_0X4201                        (RXBUF_UINT(12)/10.0f)
-    #define I3_RES_KOM_STAT_V_REF_WERT_0X4201_UNIT                   'km/h'
-    #define I3_RES_KOM_STAT_V_REF_WERT_0X4201_TYPE                   float
-        // V ref / V ref
-
-    #define I3_RES_KOM_STAT_V_IST_WERT_0X4201                        (RXBUF_UINT(14)/10.0f)
-    #define I3_RES_KOM_STAT_V_IST_WERT_0X4201_UNIT                   'km/h'
-    #define I3_RES_KOM_STAT_V_IST_WERT_0X4201_TYPE                   float
-        // V is / V ist
-
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X4201                      (RXBUF_UINT(16)/40.0f)
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X4201_UNIT                 '%'
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X4201_TYPE                 float
-        // FWP act / FWP akt
-
-    // STAT_BLS_VERZOEGERUNG_0X4201 is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Status_BLS / delay / Status_BLS / Verzögerung
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X4201                  (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X4201_UNIT             'Bit'
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X4201_TYPE             unsigned char
-        // Status_BLS / delay / Status_BLS / Verzögerung
-
-#define I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202                     0x4202
-        // PI consumption increase / Verbrauchserhöhung PI
-
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_0X4202            (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_0X4202_UNIT       '%'
-    #define I3_RES_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_0X4202_TYPE       float
-        // PI percentage increase in consumption / PI prozentuale Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT_0X4202              (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT_0X4202_UNIT         '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GW_WERT_0X4202_TYPE         float
-        // PI increase in consumption through gear selection / PI Verbrauchserhöhung durch Gangwahl
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202          (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202_UNIT     '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202_TYPE     float
-        // PI increase in consumption through speed / PI Verbrauchserhöhung durch Geschwindigkeit
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202          (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202_UNIT     '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202_TYPE     float
-        // PI increase in consumption through acceleration / PI Verbrauchserhöhung durch Beschleunigung
-
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_0X4202            (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_0X4202_UNIT       '%'
-    #define I3_RES_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_0X4202_TYPE       float
-        // PI increase in consumption through convenience / PI Verbrauchserhöhung durch Komfort
-
-#define I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203                       0x4203
-        // Additional consumption Mvref / Mehrverbrauch Mvref
-
-    #define I3_RES_KOM_STAT_MV_AKT_WERT_0X4203                       (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_MV_AKT_WERT_0X4203_UNIT                  'l/100km'
-    #define I3_RES_KOM_STAT_MV_AKT_WERT_0X4203_TYPE                  float
-        // Current consumption / Mehrverbrauch aktuell
-
-    #define I3_RES_KOM_STAT_MV_REF_WERT_0X4203                       (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_WERT_0X4203_UNIT                  'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_WERT_0X4203_TYPE                  float
-        // Overconsumption Ref (V act) / Mehrverbrauch Ref (V ist)
-
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT_0X4203                    (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT_0X4203_UNIT               'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_30_WERT_0X4203_TYPE               float
-        // Additional consumption Ref 30 / Mehrverbrauch Ref 30
-
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT_0X4203                    (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT_0X4203_UNIT               'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_70_WERT_0X4203_TYPE               float
-        // Additional consumption Ref 70 / Mehrverbrauch Ref 70
-
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT_0X4203                   (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT_0X4203_UNIT              'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_100_WERT_0X4203_TYPE              float
-        // Additional consumption Ref 100 / Mehrverbrauch Ref 100
-
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT_0X4203                   (RXBUF_UINT(10)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT_0X4203_UNIT              'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_MAX_WERT_0X4203_TYPE              float
-        // Additional consumption Ref Max / Mehrverbrauch Ref Max
-
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT_0X4203                (RXBUF_UINT(12)/100.0f)
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT_0X4203_UNIT           'l/100km'
-    #define I3_RES_KOM_STAT_MV_REF_GESAMT_WERT_0X4203_TYPE           float
-        // Additional consumption ref total / Mehrverbrauch Ref Gesamt
-
-#define I3_PID_KOM_ECO_MODE_AUSTRITT_0X4204                          0x4204
-        // ECO mode exit / ECO- Mode Austritt
-
-    // STAT_ECO_MODE_AUSTRITT_0X4204 is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // ECO mode exit / ECO- Mode Austritt
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT_0X4204                 (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT_0X4204_UNIT            'Bit'
-    #define I3_RES_KOM_STAT_ECO_MODE_AUSTRITT_0X4204_TYPE            unsigned char
-        // ECO mode exit / ECO- Mode Austritt
-
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ_0X4204                      (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ_0X4204_UNIT                 '0-n'
-    #define I3_RES_KOM_STAT_ECO_TIPP_ANZ_0X4204_TYPE                 unsigned char
-        // ECO tip display / ECO Tipp Anzeige
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205                   0x4205
-        // Consumption scaling x / Verbräuche Skalierung x
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205   (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205_TYPE float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205  (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205_TYPE float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205        (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205        (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205        (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205        (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205        (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205        (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205        (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205        (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205        (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205           (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205       (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205       (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205       (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205       (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205       (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205       (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205       (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205 (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT_0X4205         (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT_0X4205_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205          (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206                   0x4206
-        // Consumption scaling y / Verbräuche Skalierung y
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206   (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206_TYPE float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206  (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206_TYPE float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206        (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206        (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206        (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206        (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206        (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206        (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206        (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206        (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206        (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206           (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206       (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206       (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206       (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206       (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206       (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206       (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206       (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206 (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT_0X4206         (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT_0X4206_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206          (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207                   0x4207
-        // Consumption scaling e.g. / Verbräuche Skalierung z
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207   (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207_TYPE float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207  (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207_TYPE float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207        (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207        (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207        (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207        (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207        (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207        (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207        (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207        (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207        (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207           (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207       (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207       (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207       (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207       (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207       (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207       (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207       (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207 (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT_0X4207         (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT_0X4207_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207          (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208                   0x4208
-        // Consumption scaling a / Verbräuche Skalierung a
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208   (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208_TYPE float
-        // Average_8 / Durchschnittswert_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208  (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208_TYPE float
-        // Average_16 / Durchschnittswert_16
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208        (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208        (RXBUF_UINT(9))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(13))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208        (RXBUF_UINT(14))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(18))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208        (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(22))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208        (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(28))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208        (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(31))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208        (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(36))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(37))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208        (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(41))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(42))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(43))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208        (RXBUF_UINT(44))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208_UNIT   '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208_TYPE   unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(46))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(47))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208           (RXBUF_UCHAR(48))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208_UNIT      'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208_TYPE      unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208       (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(52))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(53))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208       (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(58))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208       (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(61))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208       (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(66))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(67))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208       (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(71))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(72))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208       (RXBUF_UINT(74))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(76))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(77))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(78))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208       (RXBUF_UINT(79))
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208_UNIT  '%'
-    #define I3_RES_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208_TYPE  unsigned short
-        // consumption / Verbrauch
-
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208 (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208_UNIT '%'
-    #define I3_RES_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208_TYPE unsigned char
-        // Consumption advantage / Verbrauchsvorteil
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT_0X4208         (RXBUF_UCHAR(82))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT_0X4208_TYPE    unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208          (RXBUF_UCHAR(83))
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208_UNIT     'HEX'
-    #define I3_RES_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208_TYPE     unsigned char
-        // 00010000 = FU 00001111 = FDS FDS Attribute: 0 Initialization 1 Traction mode set 2 Comfort mode set 3 Base
-        // mode set 4 Sport mode set 5 Sport + mode set 6 Race mode set 7 ECO mode set 8 ECO + mode set 9 - E Reserve F
-        // signal invalid FU attribute: 0 travel without travel interruption (FU) 1 travel with travel interruption (FU)
-        // / 00010000 = FU 00001111 = FDS  FDS Attribut: 0  Initialisierung 1  Modus Traction gesetzt 2  Modus Komfort
-        // gesetzt 3  Modus Basis gesetzt 4  Modus Sport gesetzt 5  Modus Sport+ gesetzt 6  Modus Race gesetzt 7  Modus
-        // ECO gesetzt 8  Modus ECO+ gesetzt 9 - E  Reserve F  Signal ungültig  FU Attribut: 0  Fahrt ohne
-        // Fahrtunterbrechung (FU) 1  Fahrt mit Fahrtunterbrechung (FU)
-
-#define I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209       0x4209
-        // Consumption / consumption advantage hybrid current segment / Verbrauch / Verbrauchsvorteil Hybrid aktuelles
-        // Segment
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209 (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209_UNIT 'l/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209_TYPE float
-        // Average value of the act. calculated segment in 0.1 / Durchschnittswert des akt. berechneten Segments in 0,1
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209 (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209_TYPE unsigned char
-        // Average value hybrid recovery of the act. Segments / Durchschnittswert Hybridrückgewinnung des akt. Segments
-
-#define I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV                        0x420A
-        // Consumption scaling x read in 0.1 [KWh // 100km] / Verbräuche Skalierung x lesen in 0,1 [KWh//100km]
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_8_WERT            (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_8_WERT_UNIT       'kWh/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_8_WERT_TYPE       float
-        // Average consumption_8 / Durchschnittsverbrauch_8
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_16_WERT           (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_16_WERT_UNIT      'kWh/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_16_WERT_TYPE      float
-        // Average consumption_16 / Durchschnittsverbrauch_16
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT       (RXBUF_UINT(4))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT    (RXBUF_UINT(6))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_X_WERT                      (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG1_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG1_X_WERT                           (RXBUF_UCHAR(9))
-    #define I3_RES_KOM_STAT_FU_SEG1_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG1_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT       (RXBUF_UINT(10))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT    (RXBUF_UINT(12))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_X_WERT                      (RXBUF_UCHAR(14))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG2_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG2_X_WERT                           (RXBUF_UCHAR(15))
-    #define I3_RES_KOM_STAT_FU_SEG2_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG2_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT       (RXBUF_UINT(16))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT    (RXBUF_UINT(18))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_X_WERT                      (RXBUF_UCHAR(20))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG3_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG3_X_WERT                           (RXBUF_UCHAR(21))
-    #define I3_RES_KOM_STAT_FU_SEG3_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG3_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT       (RXBUF_UINT(22))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT    (RXBUF_UINT(24))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_X_WERT                      (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG4_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG4_X_WERT                           (RXBUF_UCHAR(27))
-    #define I3_RES_KOM_STAT_FU_SEG4_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG4_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT       (RXBUF_UINT(28))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT    (RXBUF_UINT(30))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_X_WERT                      (RXBUF_UCHAR(32))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG5_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG5_X_WERT                           (RXBUF_UCHAR(33))
-    #define I3_RES_KOM_STAT_FU_SEG5_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG5_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT       (RXBUF_UINT(34))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT    (RXBUF_UINT(36))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_X_WERT                      (RXBUF_UCHAR(38))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG6_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG6_X_WERT                           (RXBUF_UCHAR(39))
-    #define I3_RES_KOM_STAT_FU_SEG6_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG6_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT       (RXBUF_UINT(40))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT    (RXBUF_UINT(42))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_X_WERT                      (RXBUF_UCHAR(44))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG7_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG7_X_WERT                           (RXBUF_UCHAR(45))
-    #define I3_RES_KOM_STAT_FU_SEG7_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG7_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT       (RXBUF_UINT(46))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT    (RXBUF_UINT(48))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_X_WERT                      (RXBUF_UCHAR(50))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG8_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG8_X_WERT                           (RXBUF_UCHAR(51))
-    #define I3_RES_KOM_STAT_FU_SEG8_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG8_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT       (RXBUF_UINT(52))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT_UNIT  '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT_TYPE  unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT    (RXBUF_UINT(54))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_X_WERT                      (RXBUF_UCHAR(56))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG9_X_WERT_TYPE                 unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG9_X_WERT                           (RXBUF_UCHAR(57))
-    #define I3_RES_KOM_STAT_FU_SEG9_X_WERT_UNIT                      'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG9_X_WERT_TYPE                      unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT      (RXBUF_UINT(58))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT   (RXBUF_UINT(60))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_X_WERT                     (RXBUF_UCHAR(62))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG10_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG10_X_WERT                          (RXBUF_UCHAR(63))
-    #define I3_RES_KOM_STAT_FU_SEG10_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG10_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT      (RXBUF_UINT(64))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT   (RXBUF_UINT(66))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_X_WERT                     (RXBUF_UCHAR(68))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG11_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG11_X_WERT                          (RXBUF_UCHAR(69))
-    #define I3_RES_KOM_STAT_FU_SEG11_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG11_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT      (RXBUF_UINT(70))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT   (RXBUF_UINT(72))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_X_WERT                     (RXBUF_UCHAR(74))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG12_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG12_X_WERT                          (RXBUF_UCHAR(75))
-    #define I3_RES_KOM_STAT_FU_SEG12_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG12_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT      (RXBUF_UINT(76))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT   (RXBUF_UINT(78))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_X_WERT                     (RXBUF_UCHAR(80))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG13_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG13_X_WERT                          (RXBUF_UCHAR(81))
-    #define I3_RES_KOM_STAT_FU_SEG13_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG13_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT      (RXBUF_UINT(82))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT   (RXBUF_UINT(84))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_X_WERT                     (RXBUF_UCHAR(86))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG14_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG14_X_WERT                          (RXBUF_UCHAR(87))
-    #define I3_RES_KOM_STAT_FU_SEG14_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG14_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT      (RXBUF_UINT(88))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT   (RXBUF_UINT(90))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_X_WERT                     (RXBUF_UCHAR(92))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG15_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG15_X_WERT                          (RXBUF_UCHAR(93))
-    #define I3_RES_KOM_STAT_FU_SEG15_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG15_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT      (RXBUF_UINT(94))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT_TYPE unsigned short
-        // Average consumption / Durchschnittsverbrauch
-
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT   (RXBUF_UINT(96))
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT_TYPE unsigned short
-        // Average recuperation / Durchschnittsrekuperation
-
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_X_WERT                     (RXBUF_UCHAR(98))
-    #define I3_RES_KOM_STAT_ZAEHLER_SEG16_X_WERT_TYPE                unsigned char
-        // counter / Zähler
-
-    #define I3_RES_KOM_STAT_FU_SEG16_X_WERT                          (RXBUF_UCHAR(99))
-    #define I3_RES_KOM_STAT_FU_SEG16_X_WERT_UNIT                     'HEX'
-    #define I3_RES_KOM_STAT_FU_SEG16_X_WERT_TYPE                     unsigned char
-        // FU / FU
-
-#define I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV          0x420B
-        // Consumption / consumption advantage hybrid current segment / Verbrauch / Verbrauchsvorteil Hybrid aktuelles
-        // Segment
-
-    #define I3_RES_KOM_STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT       (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT_UNIT  'kWh/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT_TYPE  float
-        // Average consumption of the currently calculated segment / Durchschnittsverbrauch des aktuell berechneten
-        // Segments
-
-    #define I3_RES_KOM_STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT    (RXBUF_UINT(2)/10.0f)
-    #define I3_RES_KOM_STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT_UNIT 'kWh/100km'
-    #define I3_RES_KOM_STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT_TYPE float
-        // Average recuperation of the act. calculated segment / Durchschnittsrekuperation des akt. berechneten Segments
-
-#define I3_PID_KOM_REICHWEITE_MCV                                    0x420C
-        // Read ranges in 1 [km] / Reichweiten lesen in 1 [km]
-
-    #define I3_RES_KOM_STAT_ECO_MODE_REICHWEITE_WERT                 (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_ECO_MODE_REICHWEITE_WERT_UNIT            'km'
-    #define I3_RES_KOM_STAT_ECO_MODE_REICHWEITE_WERT_TYPE            unsigned short
-        // Eco-mode range / Eco-Mode-reichweite
-
-    #define I3_RES_KOM_STAT_COMFORT_MODE_REICHWEITE_WERT             (RXBUF_UINT(2))
-    #define I3_RES_KOM_STAT_COMFORT_MODE_REICHWEITE_WERT_UNIT        'km'
-    #define I3_RES_KOM_STAT_COMFORT_MODE_REICHWEITE_WERT_TYPE        unsigned short
-        // Comfort mode range (CRW) / Comfort-Mode Reichweite (CRW)
-
-    #define I3_RES_KOM_STAT_BC_REICHWEITE_WERT                       (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KOM_STAT_BC_REICHWEITE_WERT_UNIT                  'km'
-    #define I3_RES_KOM_STAT_BC_REICHWEITE_WERT_TYPE                  float
-        // BC range / BC-Reichweite
-
-    #define I3_RES_KOM_STAT_ECO_PRO_PLUS_REICHWEITE_WERT             (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_ECO_PRO_PLUS_REICHWEITE_WERT_UNIT        'km'
-    #define I3_RES_KOM_STAT_ECO_PRO_PLUS_REICHWEITE_WERT_TYPE        float
-        // ECO Pro + range / ECO Pro+ Reichweite
-
-#define I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A                             0x420D
-        // Read consumption increase a in 1 [kWh] / Verbraucherhöhung a lesen in 1 [kWh]
-
-    #define I3_RES_KOM_STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT    (RXBUF_UINT32(0))
-    #define I3_RES_KOM_STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT_UNIT 'kWh'
-    #define I3_RES_KOM_STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT_TYPE unsigned long
-        // accumulated absolute consumption increase / akkumulierte absolute Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_VERBR_ERHOEHUNG_VERZ_WERT                (RXBUF_UINT32(4))
-    #define I3_RES_KOM_STAT_VERBR_ERHOEHUNG_VERZ_WERT_UNIT           'kWh'
-    #define I3_RES_KOM_STAT_VERBR_ERHOEHUNG_VERZ_WERT_TYPE           unsigned long
-        // Increase in consumption through delay / Verbrauchserhöhung durch Verzögerung
-
-    #define I3_RES_KOM_STAT_VERBR_REF_WERT                           (RXBUF_UINT(8))
-    #define I3_RES_KOM_STAT_VERBR_REF_WERT_UNIT                      'kWh'
-    #define I3_RES_KOM_STAT_VERBR_REF_WERT_TYPE                      unsigned short
-        // V ref / V ref
-
-    #define I3_RES_KOM_STAT_VERBR_IST_WERT                           (RXBUF_UINT(10))
-    #define I3_RES_KOM_STAT_VERBR_IST_WERT_UNIT                      'kWh'
-    #define I3_RES_KOM_STAT_VERBR_IST_WERT_TYPE                      unsigned short
-        // V is / V ist
-
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X420D                      (RXBUF_UINT(12)/2500.0f)
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X420D_UNIT                 '%'
-    #define I3_RES_KOM_STAT_FWP_AKT_WERT_0X420D_TYPE                 float
-        // FWP act / FWP akt
-
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X420D                  (RXBUF_UCHAR(14))
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X420D_UNIT             '0/1'
-    #define I3_RES_KOM_STAT_BLS_VERZOEGERUNG_0X420D_TYPE             unsigned char
-        // Status_BLS / delay xxxx xx11b / Status_BLS / Verzögerung xxxx xx11b
-
-#define I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT                            0x420E
-        // Consumption increase tt read in 0.01kWh / 100km / Verbrauchserhöhing tt lesen in 0,01kWh/100km
-
-    #define I3_RES_KOM_STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT     (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT_UNIT '%'
-    #define I3_RES_KOM_STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT_TYPE float
-        // tt percentage increase in consumption / tt prozentuale Verbrauchserhöhung
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT          (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT_UNIT     'kWh/100km'
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT_TYPE     float
-        // increased consumption through speed / verbrauchserhöhung durch Geschwindigkeit
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT       (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT_UNIT  'kWh/100km'
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT_TYPE  float
-        // Increase in consumption through acceleration / Verbrauchserhöhung durch Beschleunigung
-
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT         (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT_UNIT    'kWh/100km'
-    #define I3_RES_KOM_STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT_TYPE    float
-        // Increased consumption through convenience / Verbrauchserhöhung durch Komfort
-
-#define I3_PID_KOM_MEHRVERBRAUCH                                     0x420F
-        // Read more consumption in 0.01 [kWh / 100km] / Mehrverbrauch lesen in 0,01 [kWh/100km]
-
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_AKT_WERT                   (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_AKT_WERT_UNIT              'kWh/100km'
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_AKT_WERT_TYPE              float
-        // Additional consumption currently in 0.01 kWh / 100km / Mehrverbrauch aktuell in 0,01Kwh/100km
-
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_REF_WERT                   (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_REF_WERT_UNIT              'kWh/100km'
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_REF_WERT_TYPE              float
-        // Additional consumption reference in 0.01Kwh / 100km / Mehrverbrauch referenz in 0,01Kwh/100km
-
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_WERT                   (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_WERT_UNIT              'kWh/100km'
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_WERT_TYPE              float
-        // Additional consumption eco in 0.01Kwh / 100km / Mehrverbrauch eco in 0,01Kwh/100km
-
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_PLUS_WERT              (RXBUF_UINT(6)/100.0f)
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_PLUS_WERT_UNIT         'kWh/100km'
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_ECO_PLUS_WERT_TYPE         float
-        // Additional consumption eco plus in 0.01 kWh / 100 km / Mehrverbrauch eco plus in 0,01Kwh/100km
-
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_200M_WERT                  (RXBUF_UINT(8)/100.0f)
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_200M_WERT_UNIT             'kWh/100km'
-    #define I3_RES_KOM_STAT_MEHRVERBRAUCH_200M_WERT_TYPE             float
-        // Additional consumption 200 m in 0.01 kWh / 100 km / Mehrverbrauch 200 m in 0,01Kwh/100km
-
-#define I3_PID_KOM_ECO_MODE_AUSTRITT_0X4210                          0x4210
-        // Read ECO-Mode Aistritt / ECO-Mode Aistritt lesen
-
-    // RES_0x4210_D is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***
-        // Read ECO-Mode Aistritt / ECO-Mode Aistritt lesen
-    #define I3_RES_KOM_RES_0x4210_D                                  (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_RES_0x4210_D_UNIT                             'bit'
-    #define I3_RES_KOM_RES_0x4210_D_TYPE                             unsigned char
-        // Read ECO-Mode Aistritt / ECO-Mode Aistritt lesen
-
-#define I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO                      0x4230
-        // Consumption characteristics ECO / Verbrauchscharakteristik ECO
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT                       (RXBUF_UINT(0)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT_TYPE                  float
-        // 1. Support center / 1.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT                       (RXBUF_UINT(2)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT_TYPE                  float
-        // 2. Support center / 2.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT                       (RXBUF_UINT(4)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT_TYPE                  float
-        // 3. Support center / 3.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT                       (RXBUF_UINT(6)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT_TYPE                  float
-        // 4. Support center / 4.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT                       (RXBUF_UINT(8)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT_TYPE                  float
-        // 5. Support center / 5.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT                       (RXBUF_UINT(10)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT_TYPE                  float
-        // 6. Support center / 6.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT                       (RXBUF_UINT(12)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT_TYPE                  float
-        // 7. Support agency / 7.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT                       (RXBUF_UINT(14)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT_TYPE                  float
-        // 8. Support agency / 8.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT                       (RXBUF_UINT(16)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT_UNIT                  'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT_TYPE                  float
-        // 9. Support agency / 9.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT                      (RXBUF_UINT(18)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT_UNIT                 'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT_TYPE                 float
-        // 10. Support agency / 10.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT                      (RXBUF_UINT(20)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT_UNIT                 'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT_TYPE                 float
-        // 11. Support agency / 11.Stuetzstelle
-
-#define I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL                   0x4231
-        // Consumption characteristics normal / Verbrauchscharakteristik Normal
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT_0X4231                (RXBUF_UINT(0)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE1_WERT_0X4231_TYPE           float
-        // 1. Support center / 1.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT_0X4231                (RXBUF_UINT(2)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE2_WERT_0X4231_TYPE           float
-        // 2. Support center / 2.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT_0X4231                (RXBUF_UINT(4)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE3_WERT_0X4231_TYPE           float
-        // 3. Support center / 3.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT_0X4231                (RXBUF_UINT(6)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE4_WERT_0X4231_TYPE           float
-        // 4. Support center / 4.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT_0X4231                (RXBUF_UINT(8)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE5_WERT_0X4231_TYPE           float
-        // 5. Support center / 5.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT_0X4231                (RXBUF_UINT(10)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE6_WERT_0X4231_TYPE           float
-        // 6. Support center / 6.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT_0X4231                (RXBUF_UINT(12)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE7_WERT_0X4231_TYPE           float
-        // 7. Support agency / 7.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT_0X4231                (RXBUF_UINT(14)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE8_WERT_0X4231_TYPE           float
-        // 8. Support agency / 8.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT_0X4231                (RXBUF_UINT(16)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT_0X4231_UNIT           'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE9_WERT_0X4231_TYPE           float
-        // 9. Support agency / 9.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT_0X4231               (RXBUF_UINT(18)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT_0X4231_UNIT          'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE10_WERT_0X4231_TYPE          float
-        // 10. Support agency / 10.Stuetzstelle
-
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT_0X4231               (RXBUF_UINT(20)/100f)
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT_0X4231_UNIT          'l/km'
-    #define I3_RES_KOM_STAT_STUETZSTELLE11_WERT_0X4231_TYPE          float
-        // 11. Support agency / 11.Stuetzstelle
-
-#define I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR               0x4232
-        // Read consumption characteristics learning factor ECO / Normal / Verbrauchscharakteristik Lernfaktor ECO/Normal
-        // lesen
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_ECO_WERT                     (RXBUF_UINT(0)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_ECO_WERT_UNIT                'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_ECO_WERT_TYPE                float
-        // Learning factor1 ECO / Lernfaktor1 ECO
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_ECO_WERT                     (RXBUF_UINT(2)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_ECO_WERT_UNIT                'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_ECO_WERT_TYPE                float
-        // Learning factor2 ECO / Lernfaktor2 ECO
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_ECO_WERT                     (RXBUF_UINT(4)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_ECO_WERT_UNIT                'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_ECO_WERT_TYPE                float
-        // Learning factor3 ECO / Lernfaktor3 ECO
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_ECO_WERT                     (RXBUF_UINT(6)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_ECO_WERT_UNIT                'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_ECO_WERT_TYPE                float
-        // Learning factor4 ECO / Lernfaktor4 ECO
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_NORMAL_WERT                  (RXBUF_UINT(8)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_NORMAL_WERT_UNIT             'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR1_NORMAL_WERT_TYPE             float
-        // Learning factor 1 normal / Lernfaktor1 Normal
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_NORMAL_WERT                  (RXBUF_UINT(10)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_NORMAL_WERT_UNIT             'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR2_NORMAL_WERT_TYPE             float
-        // Learning factor2 normal / Lernfaktor2 Normal
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_NORMAL_WERT                  (RXBUF_UINT(12)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_NORMAL_WERT_UNIT             'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR3_NORMAL_WERT_TYPE             float
-        // Learning factor3 normal / Lernfaktor3 Normal
-
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_NORMAL_WERT                  (RXBUF_UINT(14)/100f)
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_NORMAL_WERT_UNIT             'L/100km'
-    #define I3_RES_KOM_STAT_LERNFAKTOR4_NORMAL_WERT_TYPE             float
-        // Learning factor4 normal / Lernfaktor4 Normal
-
-#define I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR                   0x4233
-        // Read consumption characteristics factor ECO / Normal / Verbrauchscharakteristik Faktor ECO/Normal lesen
-
-    #define I3_RES_KOM_STAT_DELTA_RATIO_ECO_WERT                     (RXBUF_UINT(0)/100f)
-    #define I3_RES_KOM_STAT_DELTA_RATIO_ECO_WERT_UNIT                'L/100km'
-    #define I3_RES_KOM_STAT_DELTA_RATIO_ECO_WERT_TYPE                float
-        // Delta_ratio_ECO / Delta_ratio_ECO
-
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_ECO_WERT                 (RXBUF_UINT(2)/100f)
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_ECO_WERT_UNIT            'L/100km'
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_ECO_WERT_TYPE            float
-        // Consumption_interpolated_ECO / Verbr_interpoliert_ECO
-
-    #define I3_RES_KOM_STAT_DELTA_RATIO_NORMAL_WERT                  (RXBUF_UINT(4)/100f)
-    #define I3_RES_KOM_STAT_DELTA_RATIO_NORMAL_WERT_UNIT             'L/100km'
-    #define I3_RES_KOM_STAT_DELTA_RATIO_NORMAL_WERT_TYPE             float
-        // Delta_ratio_NORMAL / Delta_ratio_NORMAL
-
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_NORMAL_WERT              (RXBUF_UINT(6)/100f)
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_NORMAL_WERT_UNIT         'L/100km'
-    #define I3_RES_KOM_STAT_VB_INTERPOLIERT_NORMAL_WERT_TYPE         float
-        // Consumption_interpolated_NORMAL / Verbr_interpoliert_NORMAL
-
-// Skipping _HW_AENDERUNGSINDEX on 0x4400 which takes arguments
-
-#define I3_PID_KOM_HUD_LOGBUCH                                       0x4800
-        // This job supplies the logbook data of the HUD / Dieser Job liefert die Logbuch-Daten des HUD
-
-    #define I3_RES_KOM_STAT_HUD_OPERATION_HOURS_WERT                 (RXBUF_UINT(0))
-    #define I3_RES_KOM_STAT_HUD_OPERATION_HOURS_WERT_TYPE            unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_OPERATION_MINUTES_WERT               (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_HUD_OPERATION_MINUTES_WERT_TYPE          unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_LED_OPERATION_HOURS_WERT             (RXBUF_UINT(3))
-    #define I3_RES_KOM_STAT_HUD_LED_OPERATION_HOURS_WERT_TYPE        unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_LED_OPERATION_MINUTES_WERT           (RXBUF_UCHAR(5))
-    #define I3_RES_KOM_STAT_HUD_LED_OPERATION_MINUTES_WERT_TYPE      unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_LED_REPEAT_TIME_WERT                 (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_HUD_LED_REPEAT_TIME_WERT_TYPE            unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_01_WERT               (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_01_WERT_TYPE          unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_02_WERT               (RXBUF_UCHAR(8))
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_02_WERT_TYPE          unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_03_WERT               (RXBUF_UCHAR(9))
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_03_WERT_TYPE          unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_04_WERT               (RXBUF_UCHAR(10))
-    #define I3_RES_KOM_STAT_HUD_TEMP_THRESHOLD_04_WERT_TYPE          unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP1_WERT                           (RXBUF_UINT(11))
-    #define I3_RES_KOM_STAT_HUD_TEMP1_WERT_TYPE                      unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP2_WERT                           (RXBUF_UINT(13))
-    #define I3_RES_KOM_STAT_HUD_TEMP2_WERT_TYPE                      unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP3_WERT                           (RXBUF_UINT(15))
-    #define I3_RES_KOM_STAT_HUD_TEMP3_WERT_TYPE                      unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP4_WERT                           (RXBUF_UINT(17))
-    #define I3_RES_KOM_STAT_HUD_TEMP4_WERT_TYPE                      unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_TEMP5_WERT                           (RXBUF_UINT(19))
-    #define I3_RES_KOM_STAT_HUD_TEMP5_WERT_TYPE                      unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_LOGTIME_WERT                         (RXBUF_UINT(21))
-    #define I3_RES_KOM_STAT_HUD_LOGTIME_WERT_TYPE                    unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_01_WERT                (RXBUF_UCHAR(23))
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_01_WERT_TYPE           unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_02_WERT                (RXBUF_UCHAR(24))
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_02_WERT_TYPE           unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_03_WERT                (RXBUF_UCHAR(25))
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_03_WERT_TYPE           unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_04_WERT                (RXBUF_UCHAR(26))
-    #define I3_RES_KOM_STAT_HUD_DIM_THRESHOLD_04_WERT_TYPE           unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM1_WERT                     (RXBUF_UINT(27))
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM1_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM2_WERT                     (RXBUF_UINT(29))
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM2_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM3_WERT                     (RXBUF_UINT(31))
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM3_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM4_WERT                     (RXBUF_UINT(33))
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM4_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM5_WERT                     (RXBUF_UINT(35))
-    #define I3_RES_KOM_STAT_HUD_ZONE_1_DIM5_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM1_WERT                     (RXBUF_UINT(37))
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM1_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM2_WERT                     (RXBUF_UINT(39))
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM2_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM3_WERT                     (RXBUF_UINT(41))
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM3_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM4_WERT                     (RXBUF_UINT(43))
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM4_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM5_WERT                     (RXBUF_UINT(45))
-    #define I3_RES_KOM_STAT_HUD_ZONE_2_DIM5_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM1_WERT                     (RXBUF_UINT(47))
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM1_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM2_WERT                     (RXBUF_UINT(49))
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM2_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM3_WERT                     (RXBUF_UINT(51))
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM3_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM4_WERT                     (RXBUF_UINT(53))
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM4_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM5_WERT                     (RXBUF_UINT(55))
-    #define I3_RES_KOM_STAT_HUD_ZONE_3_DIM5_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM1_WERT                     (RXBUF_UINT(57))
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM1_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM2_WERT                     (RXBUF_UINT(59))
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM2_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM3_WERT                     (RXBUF_UINT(61))
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM3_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM4_WERT                     (RXBUF_UINT(63))
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM4_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM5_WERT                     (RXBUF_UINT(65))
-    #define I3_RES_KOM_STAT_HUD_ZONE_4_DIM5_WERT_TYPE                unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_HEIGHT_ADJUSTMENT_WERT               (RXBUF_UINT(67))
-    #define I3_RES_KOM_STAT_HUD_HEIGHT_ADJUSTMENT_WERT_TYPE          unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ROTATION_WERT                        (RXBUF_UINT(69))
-    #define I3_RES_KOM_STAT_HUD_ROTATION_WERT_TYPE                   unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ACTIVATION_WERT                      (RXBUF_UINT(71))
-    #define I3_RES_KOM_STAT_HUD_ACTIVATION_WERT_TYPE                 unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_ENVIRONMENTAL_COND_WERT              (RXBUF_UCHAR(73))
-    #define I3_RES_KOM_STAT_HUD_ENVIRONMENTAL_COND_WERT_TYPE         unsigned char
-        // - / -
-
-#define I3_PID_KOM_HUD_PIA                                           0x4801
-        // Job supplies the PIA data from the HUD. The MMI settings for image height, image rotation, brightness offset
-        // and function selection are returned. / Job liefert die PIA-Daten des HUD. Zurückgegeben werden die MMI
-        // Einstellungen für Bildhöhe, Bildrotation, Helligkeitsoffset und Funktionsauswahl.
-
-    #define I3_RES_KOM_STAT_HUD_USER0_BRIGHT_WERT                    (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_HUD_USER0_BRIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER0_HEIGHT_WERT                    (RXBUF_UCHAR(1))
-    #define I3_RES_KOM_STAT_HUD_USER0_HEIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER0_ROTATION_WERT                  (RXBUF_UCHAR(2))
-    #define I3_RES_KOM_STAT_HUD_USER0_ROTATION_WERT_TYPE             unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER0_FUNKTION_WERT                  (RXBUF_UINT(3))
-    #define I3_RES_KOM_STAT_HUD_USER0_FUNKTION_WERT_TYPE             unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER1_BRIGHT_WERT                    (RXBUF_UCHAR(5))
-    #define I3_RES_KOM_STAT_HUD_USER1_BRIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER1_HEIGHT_WERT                    (RXBUF_UCHAR(6))
-    #define I3_RES_KOM_STAT_HUD_USER1_HEIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER1_ROTATION_WERT                  (RXBUF_UCHAR(7))
-    #define I3_RES_KOM_STAT_HUD_USER1_ROTATION_WERT_TYPE             unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER1_FUNKTION_WERT                  (RXBUF_UINT(8))
-    #define I3_RES_KOM_STAT_HUD_USER1_FUNKTION_WERT_TYPE             unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER2_BRIGHT_WERT                    (RXBUF_UCHAR(10))
-    #define I3_RES_KOM_STAT_HUD_USER2_BRIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER2_HEIGHT_WERT                    (RXBUF_UCHAR(11))
-    #define I3_RES_KOM_STAT_HUD_USER2_HEIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER2_ROTATION_WERT                  (RXBUF_UCHAR(12))
-    #define I3_RES_KOM_STAT_HUD_USER2_ROTATION_WERT_TYPE             unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_USER2_FUNKTION_WERT                  (RXBUF_UINT(13))
-    #define I3_RES_KOM_STAT_HUD_USER2_FUNKTION_WERT_TYPE             unsigned short
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_GUEST_BRIGHT_WERT                    (RXBUF_UCHAR(15))
-    #define I3_RES_KOM_STAT_HUD_GUEST_BRIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_GUEST_HEIGHT_WERT                    (RXBUF_UCHAR(16))
-    #define I3_RES_KOM_STAT_HUD_GUEST_HEIGHT_WERT_TYPE               unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_GUEST_ROTATION_WERT                  (RXBUF_UCHAR(17))
-    #define I3_RES_KOM_STAT_HUD_GUEST_ROTATION_WERT_TYPE             unsigned char
-        // - / -
-
-    #define I3_RES_KOM_STAT_HUD_GUEST_FUNKTION_WERT                  (RXBUF_UINT(18))
-    #define I3_RES_KOM_STAT_HUD_GUEST_FUNKTION_WERT_TYPE             unsigned short
-        // - / -
-
-// Skipping HUD_SYSTEMDATENEINBLENDUNG on 0x4802 which takes arguments
-
-#define I3_PID_KOM_HUD_NO_SIGNAL_SCREEN                              0x4803
-        // Job triggers the display of the no-signal image in the HUD / Job triggert die Anzeige des No-Signal Bildes im
-        // HUD
-
-#define I3_PID_KOM_HUD_START_UP_SCREEN                               0x4804
-        // Job leads to the display of the start-up image in the HUD. / Job führt zur Anzeige des Start-Up Bildes im HUD.
-
-#define I3_PID_KOM_HUD_PROCESS_VERSION_READ                          0x4805
-        // - / -
-
-    #define I3_RES_KOM_STAT_AL_NUMMER_WERT                           (RXBUF_UCHAR(0))
-    #define I3_RES_KOM_STAT_AL_NUMMER_WERT_TYPE                      unsigned char
-        // - / -
-
-// Skipping HUD_REGISTER_SCHREIBEN on 0x4806 which takes arguments
-
-// Skipping HUD_REGISTER_LESEN on 0x4807 which takes arguments
-
-// Skipping HUD_BILDPOSITION_MIKROSCHRITTE on 0x4808 which takes arguments
-
-// Skipping KOMBI_BC_DSV_L_KM on 0xD125 which takes arguments
-
-#define I3_PID_KOM_KOMBI_BC_BCW_L_KM                                 0xD126
-        // Read on-board computer values (write not possible) / Bordcomputerwerte lesen (schreiben nicht möglich)
-
-    #define I3_RES_KOM_STAT_BC_DSV_L_KM_WERT                         (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_BC_DSV_L_KM_WERT_UNIT                    'l/100km'
-    #define I3_RES_KOM_STAT_BC_DSV_L_KM_WERT_TYPE                    float
-        // On-board computer average consumption in 0.01 [l / 100km] / Bordcomputer Durchschnittsverbrauch in 0,01
-        // [l/100km]
-
-    #define I3_RES_KOM_STAT_BC_DSG_L_KM_WERT                         (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_BC_DSG_L_KM_WERT_UNIT                    'km/h'
-    #define I3_RES_KOM_STAT_BC_DSG_L_KM_WERT_TYPE                    float
-        // On-board computer average speed in 0.01 [km / h] / Bordcomputer Durchschnittsgeschwindigkeit in 0,01 [km/h]
-
-    #define I3_RES_KOM_STAT_BC_MVERB_L_KM_WERT                       (RXBUF_UINT(4)/100.0f)
-    #define I3_RES_KOM_STAT_BC_MVERB_L_KM_WERT_UNIT                  'l/100km'
-    #define I3_RES_KOM_STAT_BC_MVERB_L_KM_WERT_TYPE                  float
-        // On-board computer current consumption in 0.01 [l / 100km] / Bordcomputer Momentanverbrauch in 0,01 [l/100km]
-
-    #define I3_RES_KOM_STAT_BC_RW_L_KM_WERT                          (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_BC_RW_L_KM_WERT_UNIT                     'km'
-    #define I3_RES_KOM_STAT_BC_RW_L_KM_WERT_TYPE                     float
-        // On-board computer range in 0.1 [km] / Bordcomputer Reichweite in 0,1 [km]
-
-#define I3_PID_KOM_KOMBI_BC_RBC_L_KM                                 0xD127
-        // Read trip on-board computer values (write not possible) / Reise-Bordcomputerwerte lesen (schreiben nicht
-        // möglich)
-
-    #define I3_RES_KOM_STAT_RBC_DSV_L_KM_WERT                        (RXBUF_UINT(0)/100.0f)
-    #define I3_RES_KOM_STAT_RBC_DSV_L_KM_WERT_UNIT                   'l/100km'
-    #define I3_RES_KOM_STAT_RBC_DSV_L_KM_WERT_TYPE                   float
-        // On-board computer average consumption in 0.01 [l / 100km] / Reisebordcomputer Durchschnittsverbrauch in 0,01
-        // [l/100km]
-
-    #define I3_RES_KOM_STAT_RBC_DSG_L_KM_WERT                        (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_RBC_DSG_L_KM_WERT_UNIT                   'km/h'
-    #define I3_RES_KOM_STAT_RBC_DSG_L_KM_WERT_TYPE                   float
-        // On-board computer average speed in 0.01 [km / h] / Reisebordcomputer Durchschnittsgeschwindigkeit in 0,01
-        // [km/h]
-
-    // Can't yet generate code for STAT_RBC_ABFAHRT_L_KM_WERT of type string[2], at offset 4. But we account for the 2 bytes
-        // On-board computer departure time in [hh, mm] / Reisebordcomputer Abfahrtszeit in [hh,mm]
-
-    // Can't yet generate code for STAT_RBC_DAUER_L_KM_WERT of type string[2], at offset 6. But we account for the 2 bytes
-        // On-board computer duration in [hh, mm] / Reisebordcomputer Dauer in [hh,mm]
-
-    #define I3_RES_KOM_STAT_RBC_STRECKE_L_KM_WERT                    (RXBUF_UINT(8))
-    #define I3_RES_KOM_STAT_RBC_STRECKE_L_KM_WERT_UNIT               'km'
-    #define I3_RES_KOM_STAT_RBC_STRECKE_L_KM_WERT_TYPE               unsigned short
-        // On-board computer route in 1 [km] / Reisebordcomputer Strecke in 1 [km]
-
-// Skipping KOMBI_BC_DSV_KWH_KM on 0xD128 which takes arguments
-
-#define I3_PID_KOM_KOMBI_BC_BCW_KWH_KM                               0xD129
-        // Read on-board computer values (write not possible) / Bordcomputerwerte lesen (schreiben nicht möglich)
-
-    #define I3_RES_KOM_STAT_BC_DSV_KWH_KM_WERT                       (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_BC_DSV_KWH_KM_WERT_UNIT                  'kWh/100km'
-    #define I3_RES_KOM_STAT_BC_DSV_KWH_KM_WERT_TYPE                  float
-        // On-board computer average consumption in 0.1 [KWh / 100km] / Bordcomputer Durchschnittsverbrauch in 0,1
-        // [KWh/100km]
-
-    #define I3_RES_KOM_STAT_BC_DSG_KWH_KM_WERT                       (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_BC_DSG_KWH_KM_WERT_UNIT                  'km/h'
-    #define I3_RES_KOM_STAT_BC_DSG_KWH_KM_WERT_TYPE                  float
-        // On-board computer average speed in 0.01 [km / h] / Bordcomputer Durchschnittsgeschwindigkeit in 0,01 [km/h]
-
-    #define I3_RES_KOM_STAT_BC_MVERB_KWH_KM_WERT                     (RXBUF_UINT(4)/10.0f)
-    #define I3_RES_KOM_STAT_BC_MVERB_KWH_KM_WERT_UNIT                'kW'
-    #define I3_RES_KOM_STAT_BC_MVERB_KWH_KM_WERT_TYPE                float
-        // On-board computer current consumption in 0.1 [KWh / h] = [KW] / Bordcomputer Momentanverbrauch in 0,1
-        // [KWh/h]=[KW]
-
-    #define I3_RES_KOM_STAT_BC_RW_KWH_KM_WERT                        (RXBUF_UINT(6)/10.0f)
-    #define I3_RES_KOM_STAT_BC_RW_KWH_KM_WERT_UNIT                   'km'
-    #define I3_RES_KOM_STAT_BC_RW_KWH_KM_WERT_TYPE                   float
-        // On-board computer range in 0.1 [km] / Bordcomputer Reichweite in 0,1 [km]
-
-#define I3_PID_KOM_KOMBI_BC_RBC_KWH_KM                               0xD12A
-        // Read trip on-board computer values (write not possible) / Reise-Bordcomputerwerte lesen (schreiben nicht
-        // möglich)
-
-    #define I3_RES_KOM_STAT_RBC_DSV_KWH_KM_WERT                      (RXBUF_UINT(0)/10.0f)
-    #define I3_RES_KOM_STAT_RBC_DSV_KWH_KM_WERT_UNIT                 'kWh/100km'
-    #define I3_RES_KOM_STAT_RBC_DSV_KWH_KM_WERT_TYPE                 float
-        // On-board computer average consumption in 0.1 [KWh / 100km] / Reisebordcomputer Durchschnittsverbrauch in 0,1
-        // [KWh/100km]
-
-    #define I3_RES_KOM_STAT_RBC_DSG_KWH_KM_WERT                      (RXBUF_UINT(2)/100.0f)
-    #define I3_RES_KOM_STAT_RBC_DSG_KWH_KM_WERT_UNIT                 'km/h'
-    #define I3_RES_KOM_STAT_RBC_DSG_KWH_KM_WERT_TYPE                 float
-        // On-board computer average speed in 0.01 [km / h] / Reisebordcomputer Durchschnittsgeschwindigkeit in 0,01
-        // [km/h]
-
-    // Can't yet generate code for STAT_RBC_ABFAHRT_KWH_KM_WERT of type string[2], at offset 4. But we account for the 2 bytes
-        // On-board computer departure time in [hh, mm] / Reisebordcomputer Abfahrtszeit in [hh,mm]
-
-    // Can't yet generate code for STAT_RBC_DAUER_KWH_KM_WERT of type string[2], at offset 6. But we account for the 2 bytes
-        // On-board computer duration in [hh, mm] / Reisebordcomputer Dauer in [hh,mm]
-
-    #define I3_RES_KOM_STAT_RBC_STRECKE_KWH_KM_WERT                  (RXBUF_UINT(8))
-    #define I3_RES_KOM_STAT_RBC_STRECKE_KWH_KM_WERT_UNIT             'km'
-    #define I3_RES_KOM_STAT_RBC_STRECKE_KWH_KM_WERT_TYPE             unsigned short
-        // On-board computer route in 1 [km] / Reisebordcomputer Strecke in 1 [km]
-
-#define I3_PID_KOM_CC_MELDUNGSSPEICHER_LOESCHEN                      0xF010
-        // Delete the CC message memory (history memory) / CC-Meldungsspeicher (Historyspeicher) löschen
-
-#define I3_PID_KOM_HUD_M_SHOWMODE                                    0xF018
-        // starts HUD display sequence in M vehicles / startet HUD Anzeigesequenz in M-Fahrzeugen
-
-// Skipping FLASHDATEN_APIX_DOWNLOAD on 0xF120 which takes arguments
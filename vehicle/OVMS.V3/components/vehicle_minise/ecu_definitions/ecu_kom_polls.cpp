@@ -1,75 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/komb25.json: KOM 60: Instrument panel
-// This generated code  makes it easier to process CANBUS messages from the KOM ecu in a BMW i3
-//
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_SELBSTTEST,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x0F04
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_START_SYSTIME,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1005
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_STATUS_SYSTIME,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1725
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_STATUS_AKT_AUSFALL_CCMS,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2521
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_SELBSTTEST_HUD,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA104
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_AO_TOTAL_TIME_RESET,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA108
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_SHOWMODE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA00
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_LOGBUCH_RESET,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAA01
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_DREHZAHL_WERT,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD106
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_TACHO_WERT,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD107
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_GWSZ_ABSOLUT_WERT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD10D
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_LSS_TASTE,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD10E
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD111
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_A_TEMP_WERT,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD112
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_UHRZEIT_DATUM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD113
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_GWSZ_RESET,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD114
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_STARTWERT_ZEITEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD118
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_TANKINHALT,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD11F
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_TIMER_KLIMATISIERUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD121
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD12C
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_SEGMENTDATEN_SPEICHER,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD12F
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D0
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D1
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D2
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_MEHRVERBRAUCH_MV_REF,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D3
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_ECO_MODE_AUSTRITT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D4
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D5
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D6
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D7
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D8
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT,     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1D9
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_HUD_AKTIVE_WARPLISTE,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA00
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_STATUS_HUD_BILDPOSITION_SCHRITTE,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA0A
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_STATUS_HUD_BILDROTATION_SCHRITTE,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA0F
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_PORTS_LESEN,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA43
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_SW_VERSION_LESEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA44
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA46
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_HUD_BILDPOSITION_STUFEN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDA47
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4200
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4201
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4202
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4203
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_ECO_MODE_AUSTRITT_0X4204,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4204
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4205
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4206
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4207
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4208
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4209
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420A
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420B
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_REICHWEITE_MCV,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420C
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420D
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420E
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_MEHRVERBRAUCH,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x420F
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_ECO_MODE_AUSTRITT_0X4210,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4210
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4230
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4231
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4232
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4233
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_LOGBUCH,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4800
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_PIA,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4801
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_NO_SIGNAL_SCREEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4803
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_START_UP_SCREEN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4804
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_PROCESS_VERSION_READ,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4805
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_BC_BCW_L_KM,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD126
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_BC_RBC_L_KM,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD127
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_BC_BCW_KWH_KM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD129
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_KOMBI_BC_RBC_KWH_KM,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD12A
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_CC_MELDUNGSSPEICHER_LOESCHEN,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF010
-  //{ I3_ECU_KOM_TX, I3_ECU_KOM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_KOM_HUD_M_SHOWMODE,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF018
@@ -1,14 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/lim_i1.json: LIM 14: Charging interface module
-// This generated code  makes it easier to process CANBUS messages from the LIM ecu in a BMW i3
-//
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_STATUS_CALCVN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2541
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_LADESTECKDOSE_TEMPERATUR,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDB0F
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_LADEBEREITSCHAFT_LIM,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF2
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_PROXIMITY,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF5
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_PILOTSIGNAL,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF6
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF7
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_DC_SCHUETZ_SCHALTER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF8
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_DC_SCHUETZ_SPANNUNG_EINGANG,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF9
-  //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_DC_PINABDECKUNG_COMBO,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEFA
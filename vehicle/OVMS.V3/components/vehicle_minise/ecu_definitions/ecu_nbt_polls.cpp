@@ -1,115 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/nbtevo.json: NBT 63: Headunit high
-// This generated code  makes it easier to process CANBUS messages from the NBT ecu in a BMW i3
-//
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_RESET_AKTIVIERUNGSLEITUNG,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1024
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_PHY_SWITCH_ENGINE_RESET,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1044
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_RESET_PORT_CONFIGURATION,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x104A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_RESET_PORT_TX_RX_STATS,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x104B
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_LIFECYCLE,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1735
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_GET_NUMBER_OF_PORTS,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1800
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_PHY_LINK_STATE,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1802
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ETH_LEARN_PORT_CONFIGURATION,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x1803
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_VOLUMEAUDIO_DEFAULT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA002
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_LINEAR,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA004
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_FIND_BEST_STATION,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA00A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_INTERNAL_RESET,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA023
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_PROVISIONING,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA02F
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_DELETE_COOKIES,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA030
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_RESCUE_MODE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA03B
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_SDARS_FACTORY_DEFAULTS,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA03D
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_FIND_BEST_STATION_DAB,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA03F
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_FIND_BEST_TMC_STATION,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA045
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_BT_DELETE_ALL_PHONE_ID,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA04B
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_INITIALISATION_COUNTER_REGION_CODE_DVD,   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA04D
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_SWUP_REMOVE_CUSTOMER_UPDATES,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA05A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STEUERN_CLEAR_FAULT_TRACKING,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA085
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_TDA_AKTIVIERUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0A8
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_UPDATE_ZERTIFIKATE,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0A9
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_TELNET_ZUGANG_AUS,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0B0
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_WPS_PUSH_BUTTON,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0BB
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_HU_VIN_PROTECTION,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0F6
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_HU_FSC_REFURBISH_UI,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0F7
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_HU_FSC_REFURBISH_VIN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA0FB
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_HU_VIN_PROTECTION_ENFORCE_CYCLIC,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xA109
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_LESEN_SYSTEMAUDIO,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD002
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_INITIALISIERUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD004
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_DRIVE_HDD,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD007
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_MEMORY_USAGE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD00A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_VERSION_ID_LESEN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD00B
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_LESEN_LAUFWERK,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD00C
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_ANT_QFS,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD010
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SGBMID_NAVIMAP,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD012
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_SER_NR_DOM_LESEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD019
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_BT_GEKOPPELTE_GERAETE_LESEN,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD01D
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD01E
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_LOGISTIC_NR,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD020
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_APPLICATION,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD021
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_ANALOG_TEMPERATUR,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD026
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_CD_MD_CDC,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD02C
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SPEED,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD030
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_DIRECTION,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD031
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_GPS_DILUTION_OF_POSITION,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD032
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_GPS_SATINFO,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD034
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_GPS,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD038
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_GPS_RECEIVER_SW_VERSION,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD03B
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_MAPMATERIAL_VERSION,               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD03C
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_NAVI_CALIBRATION,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD03D
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_EXT_GYROSIGNAL,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD03E
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_HMI_VERSION,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD03F
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SGBMID_GRACENOTES,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD042
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_ANT_QFS_FM2,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD045
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SIGNAL_DAB,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD053
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_USB_HUB_TEST,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD057
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_ROUTE_DOWNLOAD,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD065
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_ADAS,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD067
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_TDA_AKTIVIERUNG,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD091
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_TIME_AFTER_STARTUP,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD092
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_FM_PHASDIV_ANTENNA,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD093
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_BT_FIRMWARE,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD095
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_HD_DECODER_FIRMWARE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0B8
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ABLAUF_ZERTIFIKAT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0B9
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_COOKIES,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0BA
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_COUNTER_FILES_MUSICDB,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0C1
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0C9
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ZIN_EVENT_QUEUE,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0CA
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_ZIN_INTERNAL_STATES,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0CB
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_PROVISIONING_PARAMETER,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0CE
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_MEDIA_STATISTIK,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0D1
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_PROVISIONING_DATA,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0D3
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_LAST_DESTINATIONS_FIRST_DATA_SET,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0D6
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SDARS_RADIO_ID,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0DA
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_SDARS_VERSIONS,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0DD
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SDARS_SIGNAL_QUALITY_SXM,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0DF
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_LAST_DESTINATIONS_SECOND_DATA_SET,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0E0
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_DRIVE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0E2
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_BORDERLINE_SETTING,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0E5
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_BORDERLINE_CHANGE_MODE,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0E8
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SDARS_PELLET_LESEN,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0E9
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_PROVISIONING_FORMAT,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD0EB
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_AUSSTATTUNG,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1FA
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_DEVICELIST_WIFI_DIRECT,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD1FC
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_USB_TEST,                                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD207
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_AP_NETWORK,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD20E
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_TOUCH_COMMAND_NUMBER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD26A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_PHOTOSENSOR,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5CB
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_TEMP_BACKLIGHT,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5CC
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_HELLIGKEIT_SOLLWERT,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5CD
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_HELLIGKEIT_ISTWERT,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5CE
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_EINGANGSWERTE_LESEN,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5CF
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_VERBINDUNG,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5D0
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_DETAIL_INFORMATIONEN,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD5D4
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_EQDATA_FILENAME,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4008
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_SENSOR_WERTE,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x400A
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_CID_SW_VERSION,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x400E
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_INTERNAL_STATES,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x400F
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_CID_CODIERDATEN,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4010
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED,   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4011
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_SIGNAL_TEST_AP,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4044
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x4045
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_JACINTO,      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xFDE1
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_INTEL_PLUS_SWT,  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xFDE2
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_INTEL,        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xFDE3
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT__STEUERN_BACKUP_PERSISTENCY,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xFDE5
-  //{ I3_ECU_NBT_TX, I3_ECU_NBT_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_NBT__STEUERN_RESTORE_PERSISTENCY,             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xFDE6
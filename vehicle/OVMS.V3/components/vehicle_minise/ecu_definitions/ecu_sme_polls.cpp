@@ -1,134 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/sme_i1.json: SME 07: Battery management electronics
-// This generated code  makes it easier to process CANBUS messages from the SME ecu in a BMW i3
-//
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_INNENWIDERSTAND_TS,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6334
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_KAPAZITAET_TS,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6335
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME__ST_SYM_MODUS,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6516
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME__UEBERLAST_ZAHELER,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x651D
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME__STATUS_UEBERNAHME_KAPATEST_NV,           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x6526
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISOLATIONSWIDERSTAND_KOMMUNIKATION,       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD5E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISOLATION,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD61
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KAPAZITAET_BESTIMMUNG,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD66
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HEIZUNG,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD6A
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SYMMETRIERUNG,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD6B
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HEIZUNG_FUNKTION,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xAD73
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_SOC_REKALIBRIERUNG,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4C5
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SOC_GUETE,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4C7
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_SOC_GUETE,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4C8
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ANZAHL_OCV_SOC_REKAL,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4C9
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ANZAHL_LADEENDE_REKAL,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4CA
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_SOC_VOLLADEENDE,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4CB
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KUEHLDAUER_HVB,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD4CC
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADUNGSVERLUST_ZELLE,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD67F
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD681
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_ISO_MESS_TRG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6C7
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_ISO_MESS_STD_IO_NIO,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6C8
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6C9
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISODIAG_INPUT_ISTWERTE,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CA
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISO_ERR_STD_FZ1_2,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CB
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_SOH_KAPATEST,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CC
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_REKU_VOLTAGE_LIFT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CD
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_ALTERUNG_KAPA,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CE
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_CSC_TEMPERATUREN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6CF
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISO_ERR_TRG_FZ1_2,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD6D1
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SCHUETZ_SCHALTER,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD60
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SCHUETZSCHALTUNGEN_ANZAHL,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD63
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HVIL,                                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD64
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_SPANNUNG,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD66
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ANZAHL_KUEHLANFORDERUNG_DRINGEND,         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD67
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_SPANNUNG_BERECHNET,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD68
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_STROM,                                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD69
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ISOLATIONSWIDERSTAND,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD6A
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KUEHLKREISLAUF_TEMP,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD6C
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_AUFSTART_VERHINDERER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD72
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_CUMULATIVE_LADUNG,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD73
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_CUMULATIVE_ENTLADUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD74
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_STATUS_KL30C_SPANNUNG,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD76
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_KAPAZITAET,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD7B
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_GW_INFO,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD7C
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_STROMGRENZEN,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD7D
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SPANNUNGSGRENZEN,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD7E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HVB_HISTORIE_ZYKLEN,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD8E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ZEIT_TEMP_HISTOGRAMM,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD90
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ZEIT_SOC_KLASSE,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD91
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T1_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD94
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T2_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD95
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T3_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD96
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T4_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD97
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T5_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD98
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T6_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD99
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T7_1,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDD9A
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADEZIELSPANNUNG_TAUSCH,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDAB
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_SPANNUNG_BATTERIE,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDB4
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_INNENWIDERSTAND,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDB6
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ANZEIGE_SOC,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDBC
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SERVICE_DISCONNECT,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDBD
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_VORLADUNG,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDBE
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDBF
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_TEMPERATUREN,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC0
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_PARAMETER,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC2
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HISTO_SYM_DAUER,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC6
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HISTO_SYM_ZELLANZAHL,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC7
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SYM_DELTASOC,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC8
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_MAX_SYM_DAUER,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDC9
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SERIENNUMMER_ECU,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDCA
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SOC_GRENZEN,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDCB
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_DIFFERENZ_SPANNUNGEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDCF
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_KAPAZITAET_DEGRADATION,          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDE8
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB,   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDE9
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RINGPUFFER_LADEVORGAENGE,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDEB
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_PROG_LADEZEIT,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDEC
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_SPANNUNG_QUER,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDDEF
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ALPHA_INITIAL_ALTERUNG,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDE37
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_BETRIEBSSTUNDEN,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF60
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_COOL_DOWN,                                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF62
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KLEMMENZYKLEN,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF63
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KUEHLDAUER,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF64
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_TEMP_SPREIZUNG_SYSTEM,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF65
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_TEMP_KUEHLMITTEL,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF66
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADUNG_KUEHLUNG,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF67
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T1_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF68
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T4_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF69
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T3_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6A
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T5_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6B
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T2_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6C
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T7_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6D
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HV_BATT_HIST_SOC_T6_2,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_STROM,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF6F
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF70
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_PROJEKT_PARAMETER,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF71
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KURZSCHLUESSE,                            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF72
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HEIZUNG_VERBAUT,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF73
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_VOKO_HEIZ_DAUER,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF74
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADE_KOND_HEIZ_DAUER,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF75
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_VOKO_KUEHL_DAUER,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF76
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADE_DAUER,                               {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF77
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_SOC_WARN_GRENZEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF81
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ID_SBOX,                                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF83
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SOC_HISTORIE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF86
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KL30C,                                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF89
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM_TMIN,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8A
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM_TLOW,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8B
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM_TMID,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8C
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM_THIGH,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8D
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_EFF_STROM_TMAX,                       {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_STROM_TMIN,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF8F
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_STROM_TLOW,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF90
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_STROM_THIGH,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF91
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_STROM_TMAX,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF92
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF9C
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_VERH_VOLLADE_LADEVORG_LESEN,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDF9E
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ZUSTAND_SPEICHER,                         {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFA0
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_ERR_LIM_SPANNUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFA1
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HIS_SOC_MAX_MIN,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFAE
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_STATUS_HV_SPEICHER_ID,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFE1
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_SYMMETRIERBAND,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDFE2
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_GW_INFO_SCHNELLLADEN,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE50D
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER,              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE540
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_ANZAHL_DEFEKTE_SICHERUNG,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5F1
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_HVOFF_VOLTAGES,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5F2
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_RB_SOH_KAPATEST_ERW,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5F3
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_CPI_ANALYSE,                              {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5F4
-  //{ I3_ECU_SME_TX, I3_ECU_SME_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL,     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xE5FA
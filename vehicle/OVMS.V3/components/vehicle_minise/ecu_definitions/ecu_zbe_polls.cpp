@@ -1,29 +0,0 @@
-
-//
-// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/zbe6.json: ZBE 67: iDrive controller
-// This generated code  makes it easier to process CANBUS messages from the ZBE ecu in a BMW i3
-//
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_PROGRAMMING_COUNTER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2502
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_PROGRAMMING_COUNTER_MAX_VALUE,            {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2503
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_FLASH_TIMING_PARAMETER,                   {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2504
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_MILE_KM_EEPROM,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0x2540
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_VARIANTE_ZBE,                             {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD137
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_SCHRITTE_ROTRAD,                          {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD14E
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE1,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD213
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE2,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD214
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE3,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD215
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE4,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD216
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE5,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD217
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE6,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD218
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE7,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD219
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_TASTE8,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21A
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_DREHSTELLER,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21B
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_DREHSTELLER_NORD,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21C
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_DREHSTELLER_OST,                  {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21D
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_DREHSTELLER_SUED,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21E
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_DREHSTELLER_WEST,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD21F
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_LOGGING_VERBAU,                           {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD228
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_TOUCHPAD_BERUEHRUNG,                      {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD60D
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_TOUCHPAD_ANNAEHERUNG,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xD68D
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_SPANNUNG_KLEMME_30B_WERT,                 {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDAD9
-  //{ I3_ECU_ZBE_TX, I3_ECU_ZBE_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_ZBE_ACTIVE_DIAGNOSTIC_SESSION,                {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xF186
@@ -210,6 +210,7 @@ OvmsVehicleNissanLeaf::OvmsVehicleNissanLeaf()
   m_ZE0_charger = false;
   m_AZE0_charger = false;
   m_climate_really_off = false;
+  m_bat_integrator.SetPublish(INTEGRATOR_ENERGY_TRIP | INTEGRATOR_CHARGE_TRIP);
 
   RegisterCanBus(1,CAN_MODE_ACTIVE,CAN_SPEED_500KBPS);
   RegisterCanBus(2,CAN_MODE_ACTIVE,CAN_SPEED_500KBPS);
@@ -339,8 +340,8 @@ void OvmsVehicleNissanLeaf::vehicle_nissanleaf_car_on(bool isOn)
     // Reset trip values
     StandardMetrics.ms_v_bat_energy_recd->SetValue(0);
     StandardMetrics.ms_v_bat_energy_used->SetValue(0);
-    m_cum_energy_recd_wh = 0.0f;
-    m_cum_energy_used_wh = 0.0f;
+    StandardMetrics.ms_v_bat_coulomb_recd->SetValue(0);
+    StandardMetrics.ms_v_bat_coulomb_used->SetValue(0);
     }
   else if (!isOn && StandardMetrics.ms_v_env_on->AsBool())
     {
@@ -978,18 +979,16 @@ void OvmsVehicleNissanLeaf::IncomingFrameEvCan(CAN_frame_t* p_frame)
       StandardMetrics.ms_v_bat_voltage->SetValue(battery_voltage, Volts);
       StandardMetrics.ms_v_bat_power->SetValue(battery_power, kW);
 
-      // Energy (in wh) from 10ms worth of power
+      // Trip energy & charge: integrated at frame rate while driving
+      if (StandardMetrics.ms_v_env_on->AsBool())
+        m_bat_integrator.Feed(battery_voltage, battery_current);
+
+      // Energy (in wh) from 10ms worth of power for charge & export
       float energy = battery_power * 10 / 3600;
       if (energy < 0.0)
-        {
-        m_cum_energy_recd_wh -= energy;
         m_cum_energy_charge_wh -= energy;
-        }
       else
-        {
-        m_cum_energy_used_wh += energy;
         m_cum_energy_gen_wh += energy;
-        }
 
       // soc displayed on the instrument cluster
       uint8_t soc = d[4] & 0x7f;
@@ -1896,18 +1895,13 @@ void OvmsVehicleNissanLeaf::Ticker10(uint32_t ticker)
 /**
  * Update derived energy metrics while driving
  * Called once per second from Ticker1
+ * (trip energy used and recovered are published by the battery integrator)
  */
 void OvmsVehicleNissanLeaf::HandleEnergy()
   {
   // Are we driving?
-  if (StandardMetrics.ms_v_env_on->AsBool() &&
-      (m_cum_energy_used_wh > 0.0f || m_cum_energy_recd_wh > 0.0f) )
+  if (StandardMetrics.ms_v_env_on->AsBool())
     {
-    // Update energy used and recovered
-    StandardMetrics.ms_v_bat_energy_used->SetValue( StandardMetrics.ms_v_bat_energy_used->AsFloat() + m_cum_energy_used_wh / 1000.0, kWh);
-    StandardMetrics.ms_v_bat_energy_recd->SetValue( StandardMetrics.ms_v_bat_energy_recd->AsFloat() + m_cum_energy_recd_wh / 1000.0, kWh);
-    m_cum_energy_used_wh = 0.0f;
-    m_cum_energy_recd_wh = 0.0f;
     // Calculate inverter efficiency
     float m_batt_power   = StandardMetrics.ms_v_bat_power->AsFloat(0);
     float m_inv_power    = StandardMetrics.ms_v_inv_power->AsFloat(0);
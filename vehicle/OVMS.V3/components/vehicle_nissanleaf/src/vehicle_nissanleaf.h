@@ -234,8 +234,6 @@ class OvmsVehicleNissanLeaf : public OvmsVehicle
     string cfg_limit_range_calc;                        // What range calc to use for charge to range feature
 
     int     m_MITM = 0;
-    float   m_cum_energy_used_wh;				    // Cumulated energy (in wh) used within 1 second ticker interval
-    float   m_cum_energy_recd_wh; 					// Cumulated energy (in wh) recovered  within 1 second ticker interval
     float   m_cum_energy_charge_wh;					// Cumulated energy (in wh) charged within 10 second ticker interval
     float   m_cum_energy_gen_wh;					  // Cumulated energy (in wh) exported within 10 second ticker interval
     bool    m_ZE0_charger;					        // True if 2011-2012 ZE0 LEAF with 0x380 message (Gen 1)
@@ -764,6 +764,14 @@ void OvmsVehicleRenaultTwizy::IncomingFrameCan1(CAN_frame_t* p_frame)
         }
       }
       break;
+    
+    
+    default:
+      // --------------------------------------------------------------------------
+      // SEVCON monitoring PDOs (IDs configurable, see SevconClient::InitMonitoringPDO)
+      if (m_sevcon)
+        m_sevcon->ProcessMonitoringPDO(p_frame);
+      break;
       
   }
   
@@ -214,7 +214,13 @@ class SevconClient : public InternalRamAllocated
     void ShutdownMonitoring();
     void QueryMonitoringData();
     void ProcessMonitoringData(CANopenJob &job);
+    bool ProcessMonitoringValue(uint32_t addr);
+    void UpdateMonitoringData();
     void SendMonitoringData();
+    void InitMonitoringPDO();
+    CANopenResult_t StartMonitoringPDO();
+    CANopenResult_t StopMonitoringPDO();
+    void ProcessMonitoringPDO(CAN_frame_t* p_frame);
   
   public:
     // Shell commands:
@@ -256,6 +262,10 @@ class SevconClient : public InternalRamAllocated
     bool                      m_mon_enable = false;
     volatile FILE*            m_mon_file = NULL;
     OvmsMutex                 m_mon_mutex;
+    CANopenPDOMap             m_mon_pdo[SCMON_PDO_COUNT];
+    bool                      m_mon_pdo_enable = false;           // CFG: decode monitoring PDOs
+    bool                      m_mon_pdo_active = false;           // TPDOs configured by us
+    uint32_t                  m_mon_pdo_rxtime = 0;               // last PDO reception [ms]
     
     uint32_t                  m_sevcon_type;
     cfg_drivemode             m_drivemode;
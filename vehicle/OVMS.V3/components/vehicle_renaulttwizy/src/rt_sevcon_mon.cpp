@@ -23,8 +23,8 @@
  * THE SOFTWARE.
  */
 
-// #include "ovms_log.h"
-// static const char *TAG = "v-twizy";
+#include "ovms_log.h"
+static const char *TAG = "v-twizy";
 
 #include <stdio.h>
 #include <math.h>
@@ -34,6 +34,7 @@
 
 #include "crypt_base64.h"
 #include "ovms_notify.h"
+#include "ovms_utils.h"
 
 #include "vehicle_renaulttwizy.h"
 #include "rt_sevcon.h"
@@ -83,6 +84,17 @@ void SevconClient::shell_mon_start(int verbosity, OvmsWriter* writer, OvmsComman
       writer->puts("Monitoring started.");
     }
   }
+
+  // PDO streaming:
+  CANopenResult_t res = me->StartMonitoringPDO();
+  if (me->m_mon_pdo_active) {
+    writer->printf("PDO streaming active: TPDO %d-%d, ID 0x%03" PRIx32 "-0x%03" PRIx32 ", %d ms\n",
+      me->m_mon_pdo[0].pdonum, me->m_mon_pdo[SCMON_PDO_COUNT-1].pdonum,
+      me->m_mon_pdo[0].GetCobId(me->m_nodeid), me->m_mon_pdo[SCMON_PDO_COUNT-1].GetCobId(me->m_nodeid),
+      me->m_mon_pdo[0].eventtimer);
+  } else if (me->m_mon_pdo_enable) {
+    writer->printf("PDO setup failed: %s\nUsing SDO polling.\n", GetResultString(res).c_str());
+  }
 }
 
 
@@ -108,6 +120,14 @@ void SevconClient::shell_mon_stop(int verbosity, OvmsWriter* writer, OvmsCommand
     fclose(fp);
     writer->puts("Recording stopped.");
   }
+
+  if (me->m_mon_pdo_active) {
+    CANopenResult_t res = me->StopMonitoringPDO();
+    if (res == COR_OK)
+      writer->puts("PDO streaming stopped.");
+    else
+      writer->printf("PDO stop failed: %s\n", GetResultString(res).c_str());
+  }
   
   me->SendMonitoringData();
   writer->puts("Monitoring stopped.");
@@ -204,11 +224,128 @@ void SevconClient::InitMonitoring()
 }
 
 
+/**
+ * InitMonitoringPDO: set up monitoring TPDO mappings from config
+ *  - TPDO numbers & CAN IDs are consecutive, starting at the configured base
+ *  - objects are mapped in SDO query order, so the last PDO completes a sample
+ */
+void SevconClient::InitMonitoringPDO()
+{
+  m_mon_pdo_enable = MyConfig.GetParamValueBool("xrt", "mon_pdo", false);
+
+  int pdonum = MyConfig.GetParamValueInt("xrt", "mon_pdo_num", SCMON_PDO_NUM);
+  uint32_t cobid = strtoul(MyConfig.GetParamValue("xrt", "mon_pdo_cobid", STR(SCMON_PDO_COBID)).c_str(), NULL, 0);
+  int interval = MyConfig.GetParamValueInt("xrt", "mon_pdo_interval", SCMON_PDO_INTERVAL);
+
+  // PDO 1: motor current & voltage
+  m_mon_pdo[0].Init(pdonum, cobid, 254, interval);
+  m_mon_pdo[0].Add(0x4600, 0x0c, 16);   // Actual AC Motor Current [A]
+  m_mon_pdo[0].Add(0x4600, 0x0d, 16);   // Actual AC Motor Voltage [1/16 V]
+  m_mon_pdo[0].Add(0x4600, 0x0b, 16);   // Voltage modulation [100/255 %]
+  m_mon_pdo[0].Add(0x4600, 0x01, 16);   // Slip Frequency [1/256 rad/s]
+
+  // PDO 2: frequency & torque
+  m_mon_pdo[1].Init(pdonum+1, cobid+1, 254, interval);
+  m_mon_pdo[1].Add(0x4600, 0x0f, 16);   // Electrical output frequency [1/16 rad/s]
+  m_mon_pdo[1].Add(0x4602, 0x0b, 16);   // Torque demand value [1/16 Nm]
+  m_mon_pdo[1].Add(0x4602, 0x0c, 16);   // Torque actual value [1/16 Nm]
+  m_mon_pdo[1].Add(0x4602, 0x0e, 16);   // Maximum power limit torque [1/16 Nm]
+
+  // PDO 3: battery & capacitor voltage
+  m_mon_pdo[2].Init(pdonum+2, cobid+2, 254, interval);
+  m_mon_pdo[2].Add(0x4602, 0x11, 16);   // Battery Voltage [1/16 V]
+  m_mon_pdo[2].Add(0x4602, 0x12, 16);   // Capacitor Voltage [1/16 V]
+}
+
+
+/**
+ * StartMonitoringPDO: let the SEVCON stream the monitoring objects
+ *  - needs to switch the SEVCON to pre-operational mode, so this
+ *    will only succeed while the Twizy is parked
+ *  - on failure, monitoring falls back to SDO polling
+ */
+CANopenResult_t SevconClient::StartMonitoringPDO()
+{
+  if (m_mon_pdo_active)
+    return COR_OK;
+
+  InitMonitoringPDO();
+  if (!m_mon_pdo_enable)
+    return COR_OK;
+
+  CANopenResult_t res = CheckBus();
+  if (res != COR_OK)
+    return res;
+  if (!CtrlLoggedIn() && (res = Login(true)) != COR_OK)
+    return res;
+
+  SevconJob sc(this);
+  if ((res = sc.CfgMode(true)) != COR_OK)
+    return res;
+
+  int i;
+  for (i = 0; i < SCMON_PDO_COUNT; i++) {
+    sc.m_job.Init();
+    res = m_sync.WriteTPDO(sc.m_job, m_nodeid, m_mon_pdo[i]);
+    if (res != COR_OK) {
+      ESP_LOGW(TAG, "Sevcon monitoring TPDO %d setup failed: %s", m_mon_pdo[i].pdonum, sc.GetResultString().c_str());
+      break;
+    }
+  }
+  if (res != COR_OK) {
+    // don't leave partial streams running:
+    while (--i >= 0) {
+      sc.m_job.Init();
+      m_sync.DisableTPDO(sc.m_job, m_nodeid, m_mon_pdo[i].pdonum);
+    }
+  }
+
+  sc.CfgMode(false);
+
+  if (res == COR_OK) {
+    ESP_LOGI(TAG, "Sevcon monitoring PDO streaming started");
+    m_mon_pdo_rxtime = esp_log_timestamp();
+    m_mon_pdo_active = true;
+  }
+  return res;
+}
+
+
+/**
+ * StopMonitoringPDO: disable the monitoring TPDOs
+ */
+CANopenResult_t SevconClient::StopMonitoringPDO()
+{
+  if (!m_mon_pdo_active)
+    return COR_OK;
+  m_mon_pdo_active = false;
+
+  CANopenResult_t res = CheckBus();
+  if (res != COR_OK)
+    return res;
+
+  SevconJob sc(this);
+  for (int i = 0; i < SCMON_PDO_COUNT; i++) {
+    sc.m_job.Init();
+    if (m_sync.DisableTPDO(sc.m_job, m_nodeid, m_mon_pdo[i].pdonum) != COR_OK) {
+      ESP_LOGW(TAG, "Sevcon monitoring TPDO %d disable failed: %s", m_mon_pdo[i].pdonum, sc.GetResultString().c_str());
+      res = sc.m_job.result;
+    }
+  }
+
+  ESP_LOGI(TAG, "Sevcon monitoring PDO streaming stopped");
+  return res;
+}
+
+
 /**
  * ShutdownMonitoring:
  */
 void SevconClient::ShutdownMonitoring()
 {
+  // stop PDO streaming:
+  StopMonitoringPDO();
+
   // close file:
   if (m_mon_enable) {
     FILE* fp = (FILE*)m_mon_file;
@@ -255,6 +392,10 @@ void SevconClient::QueryMonitoringData()
   if (!m_mon_enable || m_cfgmode_request || CtrlCfgMode() || !CtrlLoggedIn() || StdMetrics.ms_v_env_gear->AsInt()==0)
     return;
   
+  // PDO streaming running? (fall back to polling if PDOs stay out, i.e. after a SEVCON reset)
+  if (m_mon_pdo_active && esp_log_timestamp() - m_mon_pdo_rxtime < SCMON_PDO_TIMEOUT)
+    return;
+  
   // 4600.0c Actual AC Motor Current [A]
   SendRead(0x4600, 0x0c, &m_mon.mot_current_raw);
   // 4600.0d Actual AC Motor Voltage [1/16 V]
@@ -292,6 +433,66 @@ void SevconClient::ProcessMonitoringData(CANopenJob &job)
     return;
 
   uint32_t addr = (uint32_t)job.sdo.index << 8 | job.sdo.subindex;
+  if (ProcessMonitoringValue(addr))
+    UpdateMonitoringData();
+}
+
+
+/**
+ * ProcessMonitoringPDO: decode monitoring PDOs
+ *  - called by IncomingFrameCan1
+ *  - running in vehicle task context
+ * Raw values are stored in mapping order (see InitMonitoringPDO()), then
+ * processed like SDO results.
+ */
+void SevconClient::ProcessMonitoringPDO(CAN_frame_t* p_frame)
+{
+  if (!m_mon_enable || !m_mon_pdo_enable)
+    return;
+
+  for (int i = 0; i < SCMON_PDO_COUNT; i++) {
+    CANopenPDOMap &map = m_mon_pdo[i];
+    uint32_t values[CANopen_PDOMaxObjects];
+    if (p_frame->MsgID != map.GetCobId(m_nodeid) || !map.Decode(p_frame, values))
+      continue;
+
+    m_mon_pdo_rxtime = esp_log_timestamp();
+    switch (i) {
+      case 0:
+        m_mon.mot_current_raw = values[0];
+        m_mon.mot_voltage_raw = values[1];
+        m_mon.mot_voltmod_raw = values[2];
+        m_mon.mot_slipfreq_raw = values[3];
+        break;
+      case 1:
+        m_mon.mot_outputfreq_raw = values[0];
+        m_mon.mot_torque_demand_raw = values[1];
+        m_mon.mot_torque_raw = values[2];
+        m_mon.mot_torque_limit_raw = values[3];
+        break;
+      case 2:
+        m_mon.bat_voltage_raw = values[0];
+        m_mon.cap_voltage_raw = values[1];
+        break;
+    }
+
+    bool complete = false;
+    for (int j = 0; j < map.count; j++) {
+      complete |= ProcessMonitoringValue((uint32_t)map.object[j].index << 8 | map.object[j].subindex);
+    }
+    if (complete)
+      UpdateMonitoringData();
+    break;
+  }
+}
+
+
+/**
+ * ProcessMonitoringValue: convert raw monitoring value into metric
+ *  - returns true if the value completes a sample series
+ */
+bool SevconClient::ProcessMonitoringValue(uint32_t addr)
+{
   bool complete = false;
   switch (addr) {
     // 4600.0c Actual AC Motor Current [A]
@@ -344,76 +545,82 @@ void SevconClient::ProcessMonitoringData(CANopenJob &job)
       break;
   }
 
-  if (complete) {
-    
-    // update speed maps:
-    
-    float spd = StdMetrics.ms_v_pos_speed->AsFloat();
-    float batpwr = m_mon.bat_voltage->AsFloat() * StdMetrics.ms_v_bat_current->AsFloat();
-    float mottrq = m_mon.mot_torque->AsFloat();
-    
-    int si = (int) spd;
-    if (si < SCMON_MAX_KPH) {
-      if (batpwr > 0) {
-        // drive:
-        if (m_mon.bat_power_drv[si] < (int16_t)batpwr) {
-          m_mon.bat_power_drv[si] = (int16_t)batpwr;
-          m_mon.m_bat_power_drv->SetElemValue(si, ((int16_t)batpwr) / 1000.0f);
-        }
-        if (m_mon.mot_torque_drv[si] < mottrq) {
-          m_mon.mot_torque_drv[si] = mottrq;
-          m_mon.m_mot_torque_drv->SetElemValue(si, mottrq);
-        }
-      } else {
-        // recup:
-        if (m_mon.bat_power_rec[si] < -(int16_t)batpwr) {
-          m_mon.bat_power_rec[si] = -(int16_t)batpwr;
-          m_mon.m_bat_power_rec->SetElemValue(si, (-(int16_t)batpwr) / 1000.0f);
-        }
-        if (m_mon.mot_torque_rec[si] < -mottrq) {
-          m_mon.mot_torque_rec[si] = -mottrq;
-          m_mon.m_mot_torque_rec->SetElemValue(si, -mottrq);
-        }
+  return complete;
+}
+
+
+/**
+ * UpdateMonitoringData: update speed maps & write log with the current sample
+ */
+void SevconClient::UpdateMonitoringData()
+{
+  // update speed maps:
+  
+  float spd = StdMetrics.ms_v_pos_speed->AsFloat();
+  float batpwr = m_mon.bat_voltage->AsFloat() * StdMetrics.ms_v_bat_current->AsFloat();
+  float mottrq = m_mon.mot_torque->AsFloat();
+  
+  int si = (int) spd;
+  if (si < SCMON_MAX_KPH) {
+    if (batpwr > 0) {
+      // drive:
+      if (m_mon.bat_power_drv[si] < (int16_t)batpwr) {
+        m_mon.bat_power_drv[si] = (int16_t)batpwr;
+        m_mon.m_bat_power_drv->SetElemValue(si, ((int16_t)batpwr) / 1000.0f);
+      }
+      if (m_mon.mot_torque_drv[si] < mottrq) {
+        m_mon.mot_torque_drv[si] = mottrq;
+        m_mon.m_mot_torque_drv->SetElemValue(si, mottrq);
+      }
+    } else {
+      // recup:
+      if (m_mon.bat_power_rec[si] < -(int16_t)batpwr) {
+        m_mon.bat_power_rec[si] = -(int16_t)batpwr;
+        m_mon.m_bat_power_rec->SetElemValue(si, (-(int16_t)batpwr) / 1000.0f);
+      }
+      if (m_mon.mot_torque_rec[si] < -mottrq) {
+        m_mon.mot_torque_rec[si] = -mottrq;
+        m_mon.m_mot_torque_rec->SetElemValue(si, -mottrq);
       }
     }
-    
-    // write log:
+  }
+  
+  // write log:
+  if (m_mon_file) {
+    OvmsMutexLock lock(&m_mon_mutex);
     if (m_mon_file) {
-      OvmsMutexLock lock(&m_mon_mutex);
-      if (m_mon_file) {
-        fprintf((FILE*)m_mon_file,
-          // timestamp,kph,rpm,throttle,kickdown,brake,
-          "%" PRIu32 ",%.1f,%d,%.0f,%u,%.0f,"
-          // mot_torque_limit,mot_torque_demand,mot_torque,
-          "%.1f,%.1f,%.1f,"
-          // bat_voltage,bat_current,bat_power,cap_voltage,
-          "%.1f,%.2f,%.1f,%.1f,"
-          // mot_voltage,mot_current,mot_power,mot_voltmod,mot_slipfreq,mot_outputfreq
-          "%.1f,%.0f,%.1f,%.1f,%.1f,%.1f\n",
-          
-          esp_log_timestamp(),
-          spd,
-          StdMetrics.ms_v_mot_rpm->AsInt(),
-          StdMetrics.ms_v_env_throttle->AsFloat(),
-          m_twizy->twizy_kickdown_hold,
-          StdMetrics.ms_v_env_footbrake->AsFloat(),
-          
-          m_mon.mot_torque_limit->AsFloat(),
-          m_mon.mot_torque_demand->AsFloat(),
-          mottrq,
-          
-          m_mon.bat_voltage->AsFloat(),
-          StdMetrics.ms_v_bat_current->AsFloat(),
-          batpwr,
-          m_mon.cap_voltage->AsFloat(),
-          
-          m_mon.mot_voltage->AsFloat(),
-          m_mon.mot_current->AsFloat(),
-          m_mon.mot_power->AsFloat(),
-          m_mon.mot_voltmod->AsFloat(),
-          m_mon.mot_slipfreq->AsFloat(),
-          m_mon.mot_outputfreq->AsFloat());
-      }
+      fprintf((FILE*)m_mon_file,
+        // timestamp,kph,rpm,throttle,kickdown,brake,
+        "%" PRIu32 ",%.1f,%d,%.0f,%u,%.0f,"
+        // mot_torque_limit,mot_torque_demand,mot_torque,
+        "%.1f,%.1f,%.1f,"
+        // bat_voltage,bat_current,bat_power,cap_voltage,
+        "%.1f,%.2f,%.1f,%.1f,"
+        // mot_voltage,mot_current,mot_power,mot_voltmod,mot_slipfreq,mot_outputfreq
+        "%.1f,%.0f,%.1f,%.1f,%.1f,%.1f\n",
+        
+        esp_log_timestamp(),
+        spd,
+        StdMetrics.ms_v_mot_rpm->AsInt(),
+        StdMetrics.ms_v_env_throttle->AsFloat(),
+        m_twizy->twizy_kickdown_hold,
+        StdMetrics.ms_v_env_footbrake->AsFloat(),
+        
+        m_mon.mot_torque_limit->AsFloat(),
+        m_mon.mot_torque_demand->AsFloat(),
+        mottrq,
+        
+        m_mon.bat_voltage->AsFloat(),
+        StdMetrics.ms_v_bat_current->AsFloat(),
+        batpwr,
+        m_mon.cap_voltage->AsFloat(),
+        
+        m_mon.mot_voltage->AsFloat(),
+        m_mon.mot_current->AsFloat(),
+        m_mon.mot_power->AsFloat(),
+        m_mon.mot_voltmod->AsFloat(),
+        m_mon.mot_slipfreq->AsFloat(),
+        m_mon.mot_outputfreq->AsFloat());
     }
   }
 }
@@ -32,6 +32,12 @@
 
 #define SCMON_MAX_KPH         120
 
+#define SCMON_PDO_COUNT       3             // TPDOs used for monitoring
+#define SCMON_PDO_NUM         5             // default first TPDO number
+#define SCMON_PDO_COBID       0x4a1         // default first PDO CAN ID
+#define SCMON_PDO_INTERVAL    20            // default PDO interval [ms]
+#define SCMON_PDO_TIMEOUT     1000          // PDO reception timeout, fallback to SDO polling [ms]
+
 using namespace std;
 
 #if 0
@@ -57,6 +63,7 @@ struct sc_mondata
 {
   //
   // Direct SDO metrics
+  //  (polled via SDO or streamed via PDO)
   //
   
   // 4600.0c Actual AC Motor Current
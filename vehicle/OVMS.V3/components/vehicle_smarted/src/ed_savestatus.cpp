@@ -5,63 +5,40 @@
 #include "ovms_log.h"
 static const char *TAG = "v-smarted";
 
-#include <fstream>
+#include <stdio.h>
+#include <unistd.h>
 #include <sdkconfig.h>
-#include "ovms_peripherals.h"
 #include "vehicle_smarted.h"
 
+// Text status file of previous versions ("<metric> <value>" per line):
+#define SMARTED_STATUS_LEGACY "/sd/usr/SmartEDsatus.dat"
 
-void OvmsVehicleSmartED::SaveStatus() {
-#ifdef CONFIG_OVMS_COMP_SDCARD
-	if (MyPeripherals->m_sdcard->isavailable()) {
-    if (!path_exists("/sd/usr/") && mkpath("/sd/usr/") != 0) {
-      return;
-    }
-    FILE *sf = NULL;
-    sf = fopen("/sd/usr/SmartEDsatus.dat", "w");
-    if (sf == NULL) {
-      return;
-    }
 
-    for (OvmsMetric* m=MyMetrics.m_first; m != NULL; m=m->m_next) {
-      const char *k = m->m_name;
-      std::string v = m->AsString();
-      
-      if (!v.empty()) {
-        if (strncmp(m->m_name,"m.",2)!=0 && 
-            strncmp(m->m_name,"s.v2.",5)!=0 &&
-            strncmp(m->m_name,"s.v3.",5)!=0 &&
-          //  strncmp(m->m_name,"v.b.c.temp",10)!=0 &&
-          //  strncmp(m->m_name,"v.b.c.voltage",13)!=0 &&
-            strncmp(m->m_name,"v.e.on",6)!=0 &&
-            strncmp(m->m_name,"v.e.awake",9)!=0
-           ) {
-          fprintf(sf, "%s %s\n",k,v.c_str());
-        }
-      }
-    }
+void OvmsVehicleSmartED::SaveStatus() {
+  if (m_status->Save())
     ESP_LOGI(TAG, "SaveStatus");
-    fclose(sf);
-  }
-#endif //CONFIG_OVMS_COMP_SDCARD
 }
 
 void OvmsVehicleSmartED::RestoreStatus() {
-#ifdef CONFIG_OVMS_COMP_SDCARD
-  if (MyPeripherals->m_sdcard->isavailable()) {
-    FILE *sf = NULL;
-    char k[40];
-    char v[1024];
-    sf = fopen("/sd/usr/SmartEDsatus.dat", "r");
-    if (sf == NULL) {
-      return;
-    }
-    while (fscanf(sf, "%s %s\n", k, v) != EOF) {
-      MyMetrics.Set(k,v);
-    }
+  if (m_status->Restore() >= 0) {
     ESP_LOGI(TAG, "RestoreStatus");
-    fclose(sf);
+    return;
+  }
+
+  // No snapshot yet: migrate the legacy status file, delete it once saved
+  FILE *sf = fopen(SMARTED_STATUS_LEGACY, "r");
+  if (sf == NULL)
+    return;
+  char k[40];
+  char v[1024];
+  int cnt = 0;
+  while (fscanf(sf, "%39s %1023s\n", k, v) == 2) {
+    MyMetrics.Set(k, v);
+    cnt++;
+  }
+  fclose(sf);
+  if (m_status->Save()) {
+    unlink(SMARTED_STATUS_LEGACY);
+    ESP_LOGI(TAG, "RestoreStatus: migrated %d metrics from %s", cnt, SMARTED_STATUS_LEGACY);
   }
-#endif //CONFIG_OVMS_COMP_SDCARD
-	return;
 }
@@ -103,6 +103,10 @@ OvmsVehicleSmartED::OvmsVehicleSmartED() : smarted_obd_rxwait(1,1) {
   m_last_pid = 0;
   m_reboot_ticker = 0;
 
+  // metrics snapshot (saved on vehicle.off & shutdown, restored if SOC is unknown):
+  m_status = new OvmsMetricsSnapshot(TAG, "/sd/usr/SmartEDstatus.bin",
+    "*,!m.*,!s.v2.*,!s.v3.*,!v.e.on*,!v.e.awake*");
+
   // init commands:
   cmd_xse = MyCommandApp.RegisterCommand("xse","SmartED 451 Gen.3");
   cmd_xse->RegisterCommand("recu","Set recu..", xse_recu, "<up/down>",1,1);
@@ -130,6 +134,8 @@ OvmsVehicleSmartED::OvmsVehicleSmartED() : smarted_obd_rxwait(1,1) {
 OvmsVehicleSmartED::~OvmsVehicleSmartED() {
   ESP_LOGI(TAG, "Stop Smart ED vehicle module");
 
+  delete m_status;
+
 #ifdef CONFIG_OVMS_COMP_WEBSERVER
   WebDeInit();
 #endif
@@ -43,6 +43,7 @@
 #include "ovms_command.h"
 #include "ovms_mutex.h"
 #include "ovms_semaphore.h"
+#include "ovms_metrics_snapshot.h"
 #ifdef CONFIG_OVMS_COMP_WEBSERVER
 #include "ovms_webserver.h"
 #endif
@@ -196,6 +197,7 @@ class OvmsVehicleSmartED : public OvmsVehicle
     OvmsMetricFloat *mt_12v_batt_voltage;       // 12V Batt Voltage from can
 
   private:
+    OvmsMetricsSnapshot *m_status;          // metrics snapshot for crash reboots
     unsigned int m_candata_timer;
     unsigned int m_candata_poll;
     unsigned int m_egpio_timer;
@@ -31,11 +31,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <iterator>
 #include <ovms_log.h>
 #include "log_buffers.h"
 
 
-LogBuffers::LogBuffers() : m_refcount(0)
+QueueHandle_t LogBuffers::s_pool = NULL;
+
+LogBuffers::LogBuffers() : m_refcount(0), m_pooled(false)
   {
   }
 
@@ -48,6 +51,23 @@ LogBuffers::~LogBuffers()
     }
   }
 
+/**
+ * Acquire: get a LogBuffers object from the pool (log task only)
+ *  Pooled objects return to the pool on their last release() and keep their
+ *  first list node, so dispatching a single line needs no list allocation.
+ */
+LogBuffers* LogBuffers::Acquire()
+  {
+  LogBuffers* lb;
+  if (!s_pool)
+    s_pool = xQueueCreate(LOGBUFFERS_POOL_SIZE, sizeof(LogBuffers*));
+  if (s_pool && xQueueReceive(s_pool, &lb, 0) == pdTRUE)
+    return lb;
+  lb = new LogBuffers();
+  lb->m_pooled = true;
+  return lb;
+  }
+
 int LogBuffers::append(const char* fmt, va_list args)
   {
   char *buffer;
@@ -58,11 +78,16 @@ int LogBuffers::append(const char* fmt, va_list args)
   }
 
 void LogBuffers::append(char* buffer)
-  {  
+  {
   if (empty())
     {
     push_front(buffer);
     }
+  else if (front() == NULL)
+    {
+    // recycled, reuse the node:
+    front() = buffer;
+    }
   else
     {
     iterator before = begin(), after;
@@ -87,6 +112,26 @@ void LogBuffers::release()
   {
   int before = std::atomic_fetch_add(&m_refcount, -1);
   if (before == 1)
+    {
+    if (m_pooled)
+      recycle();
+    else
+      delete this;
+    }
+  }
+
+void LogBuffers::recycle()
+  {
+  for (iterator itr = begin(); itr != end(); ++itr)
+    free(*itr);
+  if (!empty())
+    {
+    front() = NULL;
+    while (std::next(begin()) != end())
+      erase_after(begin());
+    }
+  LogBuffers* lb = this;
+  if (xQueueSend(s_pool, &lb, 0) != pdTRUE)
     delete this;
   }
 
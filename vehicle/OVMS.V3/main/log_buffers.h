@@ -33,6 +33,10 @@
 #include <forward_list>
 #include <map>
 #include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#define LOGBUFFERS_POOL_SIZE      16      // Recycled LogBuffers kept for the log task
 
 class LogBuffers : public std::forward_list<char*>
   {
@@ -40,6 +44,9 @@ class LogBuffers : public std::forward_list<char*>
     LogBuffers();
     virtual ~LogBuffers();
 
+  public:
+    static LogBuffers* Acquire();
+
   public:
     int append(const char* fmt, va_list args) __attribute__ ((format (printf, 2, 0)));
     void append(char* buffer);
@@ -47,8 +54,13 @@ class LogBuffers : public std::forward_list<char*>
     void release();
     bool last();
 
+  private:
+    void recycle();
+
   private:
     std::atomic<int> m_refcount;
+    bool m_pooled;
+    static QueueHandle_t s_pool;
   };
 
 #endif //#ifndef __LOG_BUFFERS_H__
@@ -0,0 +1,822 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "logring";
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <algorithm>
+#include "soc/soc.h"
+#include "ovms_malloc.h"
+#include "ovms_command.h"
+#include "log_ring.h"
+
+// Note: nothing in here may log on the producer path (recursion).
+
+static portMUX_TYPE logring_limit_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+struct logring_header_t
+  {
+  const char*     fmt;
+  TaskHandle_t    task;
+  uint16_t        size;                   // Payload size
+  uint8_t         slots;
+  uint8_t         flags;
+  };
+
+enum logring_slot_state_t
+  {
+  LRS_PENDING,                            // Not yet written
+  LRS_START,                              // Start of a published record
+  LRS_CONT,                               // Continuation of an earlier record
+  LRS_NEWER,                              // Overwritten by a later record
+  };
+
+
+////////////////////////////////////////////////////////////////////////
+// Format string parsing
+////////////////////////////////////////////////////////////////////////
+
+enum logring_arg_t
+  {
+  LA_NONE,                                // "%%"
+  LA_INT,
+  LA_LONG,
+  LA_LLONG,
+  LA_SIZE,
+  LA_DOUBLE,
+  LA_STRING,
+  LA_PTR,
+  LA_INVALID,                             // unsupported, needs immediate formatting
+  };
+
+struct logring_spec_t
+  {
+  const char*     start;                  // '%'
+  const char*     end;                    // behind the conversion
+  int             stars;                  // '*' width/precision arguments
+  int             prec;                   // Precision, -1 = none, -2 = '*' (last star)
+  logring_arg_t   type;
+  };
+
+/**
+ * logring_next: find the next conversion specification
+ *  Returns false if there is none left.
+ */
+static bool logring_next(const char* p, logring_spec_t &spec)
+  {
+  p = strchr(p, '%');
+  if (!p)
+    return false;
+  spec.start = p++;
+  spec.stars = 0;
+  spec.prec = -1;
+  while (*p && strchr("-+ #0'", *p))
+    p++;
+  if (*p == '*')
+    { spec.stars++; p++; }
+  else
+    while (*p >= '0' && *p <= '9') p++;
+  if (*p == '.')
+    {
+    p++;
+    if (*p == '*')
+      { spec.stars++; spec.prec = -2; p++; }
+    else
+      {
+      spec.prec = 0;
+      while (*p >= '0' && *p <= '9')
+        spec.prec = std::min(spec.prec * 10 + (*p++ - '0'), 0xffff);
+      }
+    }
+  int len = 0;      // 1 = h/hh, 2 = l, 3 = ll/j, 4 = z/t, 5 = L
+  switch (*p)
+    {
+    case 'h': len = 1; p++; if (*p == 'h') p++; break;
+    case 'l': len = 2; p++; if (*p == 'l') { len = 3; p++; } break;
+    case 'j': len = 3; p++; break;
+    case 'q': len = 3; p++; break;
+    case 'z': case 't': len = 4; p++; break;
+    case 'L': len = 5; p++; break;
+    }
+  char conv = *p;
+  spec.end = conv ? p+1 : p;
+  switch (conv)
+    {
+    case '%':
+      spec.type = (p == spec.start+1) ? LA_NONE : LA_INVALID;
+      break;
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+      spec.type = (len == 2) ? LA_LONG : (len == 3) ? LA_LLONG : (len == 4) ? LA_SIZE
+                : (len == 5) ? LA_INVALID : LA_INT;
+      break;
+    case 'c':
+      spec.type = (len == 0) ? LA_INT : LA_INVALID;
+      break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      spec.type = (len == 5) ? LA_INVALID : LA_DOUBLE;
+      break;
+    case 's':
+      spec.type = (len == 0) ? LA_STRING : LA_INVALID;
+      break;
+    case 'p':
+      spec.type = LA_PTR;
+      break;
+    default:
+      spec.type = LA_INVALID;
+      break;
+    }
+  return true;
+  }
+
+/**
+ * logring_capture: walk the arguments of a format, pass their raw values to the sink
+ */
+template <class SINK> static bool logring_capture(const char* fmt, va_list ap, SINK &sink)
+  {
+  logring_spec_t spec;
+  for (const char* p = fmt; logring_next(p, spec); p = spec.end)
+    {
+    if (spec.type == LA_INVALID)
+      return false;
+    int prec = spec.prec;
+    for (int i = 0; i < spec.stars; i++)
+      {
+      int v = va_arg(ap, int);
+      sink.Put(&v, sizeof(v));
+      if (prec == -2 && i == spec.stars-1)
+        prec = (v < 0) ? -1 : v;
+      }
+    switch (spec.type)
+      {
+      case LA_INT:    { int v = va_arg(ap, int); sink.Put(&v, sizeof(v)); break; }
+      case LA_LONG:   { long v = va_arg(ap, long); sink.Put(&v, sizeof(v)); break; }
+      case LA_LLONG:  { long long v = va_arg(ap, long long); sink.Put(&v, sizeof(v)); break; }
+      case LA_SIZE:   { size_t v = va_arg(ap, size_t); sink.Put(&v, sizeof(v)); break; }
+      case LA_DOUBLE: { double v = va_arg(ap, double); sink.Put(&v, sizeof(v)); break; }
+      case LA_PTR:    { void* v = va_arg(ap, void*); sink.Put(&v, sizeof(v)); break; }
+      case LA_STRING:
+        {
+        const char* s = va_arg(ap, const char*);
+        if (!s) s = "(null)";
+        // a precision limits the string, it need not be terminated:
+        size_t maxlen = LOGRING_MAX_SLOTS * LOGRING_SLOT_SIZE;
+        if (prec >= 0 && (size_t)prec < maxlen)
+          maxlen = prec;
+        sink.PutString(s, strnlen(s, maxlen));
+        break;
+        }
+      default:
+        break;
+      }
+    }
+  return true;
+  }
+
+// Sink: determine the payload size
+struct logring_counter
+  {
+  size_t size = 0;
+  const char* first_string = NULL;        // ESP log lines: the tag
+  void Put(const void* data, size_t len)
+    {
+    size += len;
+    }
+  void PutString(const char* s, size_t len)
+    {
+    if (!first_string) first_string = s;
+    size += len + 1;
+    }
+  };
+
+// Sink: write the payload into the ring
+struct logring_writer
+  {
+  OvmsLogRing* ring;
+  uint32_t pos;
+  size_t remain;
+  void Put(const void* data, size_t len)
+    {
+    if (len > remain) len = remain;
+    ring->Put(pos, data, len);
+    remain -= len;
+    }
+  void PutString(const char* s, size_t len)
+    {
+    // the string may have grown since counting:
+    if (remain == 0) return;
+    if (len >= remain) len = remain - 1;
+    ring->Put(pos, s, len);
+    ring->Put(pos, "", 1);
+    remain -= len + 1;
+    }
+  };
+
+/**
+ * logring_static: check if the format string lives in flash (i.e. is a literal)
+ */
+static inline bool logring_static(const char* fmt)
+  {
+#if defined(SOC_DROM_LOW) && defined(SOC_DROM_HIGH)
+  return ((intptr_t)fmt >= SOC_DROM_LOW && (intptr_t)fmt < SOC_DROM_HIGH);
+#else
+  return false;
+#endif
+  }
+
+/**
+ * logring_level: get the level letter of an ESP log format ("[ESC…m]X (…")
+ */
+static char logring_level(const char* fmt)
+  {
+  if (*fmt == '\033')
+    {
+    while (*fmt && *fmt != 'm')
+      fmt++;
+    if (*fmt) fmt++;
+    }
+  if (fmt[0] && fmt[1] == ' ' && fmt[2] == '(')
+    return fmt[0];
+  return 0;
+  }
+
+// Output: append to a fixed size line buffer, clipping
+struct logring_output
+  {
+  char* buf;
+  size_t size;
+  size_t len;
+  void Append(const char* s, size_t n)
+    {
+    if (n > size - 1 - len) n = size - 1 - len;
+    memcpy(buf + len, s, n);
+    len += n;
+    buf[len] = 0;
+    }
+  __attribute__ ((format (printf, 2, 3))) void Appendf(const char* spec, ...)
+    {
+    va_list args;
+    va_start(args, spec);
+    int n = vsnprintf(buf + len, size - len, spec, args);
+    va_end(args);
+    if (n < 0)
+      buf[len] = 0;
+    else if ((size_t)n >= size - len)
+      len = size - 1;
+    else
+      len += n;
+    }
+  };
+
+
+////////////////////////////////////////////////////////////////////////
+// OvmsLogRing
+////////////////////////////////////////////////////////////////////////
+
+OvmsLogRing::OvmsLogRing()
+  {
+  m_data = NULL;
+  m_seq = NULL;
+  m_slots = 0;
+  m_mask = 0;
+  m_head = 0;
+  m_reader = NULL;
+  m_reader_waiting = false;
+  m_written = 0;
+  m_fallbacks = 0;
+  m_lost = 0;
+  memset(m_limit, 0, sizeof(m_limit));
+  m_limit_rate = 0;
+  m_limit_dropped = 0;
+  }
+
+OvmsLogRing::~OvmsLogRing()
+  {
+  }
+
+/**
+ * Init: allocate the ring
+ *  size is rounded down to a power of 2 slots.
+ */
+bool OvmsLogRing::Init(size_t size, TaskHandle_t reader)
+  {
+  if (m_seq)
+    return true;
+  uint32_t slots = 64;
+  while (slots * 2 * LOGRING_SLOT_SIZE <= size)
+    slots *= 2;
+  m_data = (uint8_t*) ExternalRamMalloc(slots * LOGRING_SLOT_SIZE);
+  std::atomic<uint32_t>* seq = (std::atomic<uint32_t>*) InternalRamCalloc(slots, sizeof(std::atomic<uint32_t>));
+  if (!m_data || !seq)
+    {
+    free(m_data);
+    free(seq);
+    m_data = NULL;
+    ESP_LOGE(TAG, "Init: out of memory for %u slots", slots);
+    return false;
+    }
+  m_slots = slots;
+  m_mask = slots - 1;
+  m_reader = reader;
+  // slot 0 must not look published for cursor 0:
+  for (uint32_t i = 0; i < slots; i++)
+    seq[i].store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  m_seq = seq;
+  return true;
+  }
+
+void OvmsLogRing::Put(uint32_t &pos, const void* data, size_t len)
+  {
+  uint32_t size = m_slots * LOGRING_SLOT_SIZE;
+  const uint8_t* src = (const uint8_t*) data;
+  while (len)
+    {
+    size_t chunk = size - pos;
+    if (chunk > len) chunk = len;
+    memcpy(m_data + pos, src, chunk);
+    src += chunk;
+    len -= chunk;
+    pos += chunk;
+    if (pos == size) pos = 0;
+    }
+  }
+
+void OvmsLogRing::Get(uint32_t pos, void* data, size_t len)
+  {
+  uint32_t size = m_slots * LOGRING_SLOT_SIZE;
+  uint8_t* dst = (uint8_t*) data;
+  pos %= size;
+  while (len)
+    {
+    size_t chunk = size - pos;
+    if (chunk > len) chunk = len;
+    memcpy(dst, m_data + pos, chunk);
+    dst += chunk;
+    len -= chunk;
+    pos += chunk;
+    if (pos == size) pos = 0;
+    }
+  }
+
+/**
+ * Write: add a log line (producer side, lock free)
+ *  Returns the record size or 0 if the line has been dropped.
+ */
+int OvmsLogRing::Write(const char* fmt, va_list args, uint8_t flags /*=0*/)
+  {
+  if (!m_seq)
+    return 0;
+  return WriteRecord(fmt, args, flags);
+  }
+
+int OvmsLogRing::WriteRecord(const char* fmt, va_list args, uint8_t flags)
+  {
+  logring_counter counter;
+  va_list ap;
+  va_copy(ap, args);
+  bool ok = logring_capture(fmt, ap, counter);
+  va_end(ap);
+  if (!ok)
+    return WriteText(fmt, args, flags);
+
+  // rate limit info/debug/verbose lines per tag:
+  if (m_limit_rate > 0 && counter.first_string)
+    {
+    char level = logring_level(fmt);
+    if ((level == 'I' || level == 'D' || level == 'V') && !Limit(counter.first_string))
+      return 0;
+    }
+
+  size_t fmtlen = 0;
+  if (!logring_static(fmt))
+    {
+    fmtlen = strlen(fmt) + 1;
+    flags |= LOGRING_FMTCOPY;
+    }
+  size_t total = sizeof(logring_header_t) + fmtlen + counter.size;
+  if (total > LOGRING_MAX_SLOTS * LOGRING_SLOT_SIZE)
+    return WriteText(fmt, args, flags & ~LOGRING_FMTCOPY);
+
+  // reserve & invalidate the slots:
+  uint32_t slots = (total + LOGRING_SLOT_SIZE - 1) / LOGRING_SLOT_SIZE;
+  uint32_t start = m_head.fetch_add(slots, std::memory_order_relaxed);
+  for (uint32_t i = 0; i < slots; i++)
+    m_seq[(start + i) & m_mask].store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  // write the record:
+  logring_header_t hdr;
+  hdr.fmt = fmt;
+  hdr.task = xTaskGetCurrentTaskHandle();
+  hdr.size = fmtlen + counter.size;
+  hdr.slots = slots;
+  hdr.flags = flags;
+  logring_writer writer;
+  writer.ring = this;
+  writer.pos = (start & m_mask) * LOGRING_SLOT_SIZE;
+  writer.remain = sizeof(hdr);
+  writer.Put(&hdr, sizeof(hdr));
+  writer.remain = hdr.size;
+  if (fmtlen)
+    writer.Put(fmt, fmtlen);
+  va_copy(ap, args);
+  logring_capture(fmt, ap, writer);
+  va_end(ap);
+
+  // publish, first slot last:
+  for (uint32_t i = slots-1; i > 0; i--)
+    m_seq[(start + i) & m_mask].store(start + 1, std::memory_order_release);
+  m_seq[start & m_mask].store(start + 1, std::memory_order_seq_cst);
+  m_written++;
+
+  if (m_reader_waiting.exchange(false))
+    xTaskNotifyGive(m_reader);
+  return total;
+  }
+
+/**
+ * WriteText: fallback for unsupported formats & oversized records: format now
+ */
+int OvmsLogRing::WriteText(const char* fmt, va_list args, uint8_t flags)
+  {
+  char* text;
+  va_list ap;
+  va_copy(ap, args);
+  int len = vasprintf(&text, fmt, ap);
+  va_end(ap);
+  if (len < 0)
+    return 0;
+  m_fallbacks++;
+  int maxlen = LOGRING_MAX_SLOTS * LOGRING_SLOT_SIZE - sizeof(logring_header_t) - 1;
+  if (len > maxlen)
+    len = maxlen;
+
+  size_t total = sizeof(logring_header_t) + len + 1;
+  uint32_t slots = (total + LOGRING_SLOT_SIZE - 1) / LOGRING_SLOT_SIZE;
+  uint32_t start = m_head.fetch_add(slots, std::memory_order_relaxed);
+  for (uint32_t i = 0; i < slots; i++)
+    m_seq[(start + i) & m_mask].store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  logring_header_t hdr;
+  hdr.fmt = NULL;
+  hdr.task = xTaskGetCurrentTaskHandle();
+  hdr.size = len + 1;
+  hdr.slots = slots;
+  hdr.flags = (flags & ~LOGRING_FMTCOPY) | LOGRING_TEXT;
+  uint32_t pos = (start & m_mask) * LOGRING_SLOT_SIZE;
+  Put(pos, &hdr, sizeof(hdr));
+  Put(pos, text, len);
+  Put(pos, "", 1);
+  free(text);
+
+  for (uint32_t i = slots-1; i > 0; i--)
+    m_seq[(start + i) & m_mask].store(start + 1, std::memory_order_release);
+  m_seq[start & m_mask].store(start + 1, std::memory_order_seq_cst);
+  m_written++;
+
+  if (m_reader_waiting.exchange(false))
+    xTaskNotifyGive(m_reader);
+  return total;
+  }
+
+/**
+ * Limit: per tag rate limiter (token bucket, burst = one second)
+ *  Returns false if the line shall be dropped.
+ */
+bool OvmsLogRing::Limit(const char* tag)
+  {
+  // FNV-1a hash of the tag:
+  uint32_t hash = 2166136261u;
+  for (const char* s = tag; *s && s - tag < 15; s++)
+    hash = (hash ^ (uint8_t)*s) * 16777619u;
+  hash |= 1;
+
+  uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+  int32_t budget = m_limit_rate * 1000;
+  bool accept = true;
+
+  portENTER_CRITICAL(&logring_limit_spinlock);
+  limit_t* entry = NULL;
+  limit_t* reuse = NULL;
+  for (int i = 0; i < LOGRING_LIMIT_TAGS; i++)
+    {
+    limit_t &e = m_limit[i];
+    if (e.hash == hash)
+      {
+      entry = &e;
+      break;
+      }
+    if (!reuse && (e.hash == 0 || (now - e.last > 10000 && e.dropped == 0) || now - e.last > 300000))
+      reuse = &e;
+    }
+  if (!entry && reuse)
+    {
+    entry = reuse;
+    entry->hash = hash;
+    strncpy(entry->tag, tag, sizeof(entry->tag)-1);
+    entry->tag[sizeof(entry->tag)-1] = 0;
+    entry->tokens = budget;
+    entry->last = now;
+    entry->dropped = 0;
+    }
+  if (entry)
+    {
+    uint32_t elapsed = now - entry->last;
+    entry->last = now;
+    if (elapsed >= 1000)
+      entry->tokens = budget;
+    else
+      entry->tokens = std::min(budget, (int32_t)(entry->tokens + elapsed * m_limit_rate));
+    if (entry->tokens >= 1000)
+      entry->tokens -= 1000;
+    else
+      {
+      entry->dropped++;
+      m_limit_dropped++;
+      accept = false;
+      }
+    }
+  portEXIT_CRITICAL(&logring_limit_spinlock);
+  return accept;
+  }
+
+/**
+ * State: get the state of the slot at the cursor
+ */
+int OvmsLogRing::State(uint32_t cursor)
+  {
+  uint32_t seq = m_seq[cursor & m_mask].load(std::memory_order_acquire);
+  if (seq == 0)
+    return LRS_PENDING;
+  uint32_t start = seq - 1;
+  if (start == cursor)
+    return LRS_START;
+  if ((int32_t)(start - cursor) > 0)
+    return LRS_NEWER;
+  if (cursor - start < LOGRING_MAX_SLOTS)
+    return LRS_CONT;
+  return LRS_PENDING;   // left over from the previous round
+  }
+
+/**
+ * Fetch: read the next record (reader side)
+ *  Returns false if no published record is available at the cursor.
+ *  If the cursor has been overtaken by the producers, it skips the lost records.
+ *  If the record at the cursor stays pending (i.e. the producer task has been
+ *  deleted while writing), the reader needs to Skip() it after some time.
+ */
+bool OvmsLogRing::Fetch(uint32_t &cursor, LogRingRecord &rec)
+  {
+  if (!m_seq)
+    return false;
+  for (;;)
+    {
+    uint32_t head = GetHead();
+    if (cursor == head)
+      return false;
+    if (head - cursor > m_slots)
+      {
+      m_lost += head - cursor - m_slots;
+      cursor = head - m_slots;
+      }
+
+    switch (State(cursor))
+      {
+      case LRS_PENDING:
+        return false;
+      case LRS_START:
+        break;
+      default:
+        m_lost++;
+        cursor++;
+        continue;
+      }
+
+    logring_header_t hdr;
+    uint32_t pos = (cursor & m_mask) * LOGRING_SLOT_SIZE;
+    Get(pos, &hdr, sizeof(hdr));
+    if (hdr.slots == 0 || hdr.slots > LOGRING_MAX_SLOTS ||
+        sizeof(hdr) + hdr.size > (size_t)hdr.slots * LOGRING_SLOT_SIZE)
+      {
+      // overwritten while reading:
+      m_lost++;
+      cursor++;
+      continue;
+      }
+    Get(pos + sizeof(hdr), rec.payload, hdr.size);
+
+    // check the record has not been overwritten meanwhile:
+    std::atomic_thread_fence(std::memory_order_acquire);
+    bool valid = true;
+    for (uint32_t i = 0; i < hdr.slots && valid; i++)
+      valid = (m_seq[(cursor + i) & m_mask].load(std::memory_order_relaxed) == cursor + 1);
+    if (!valid)
+      {
+      m_lost++;
+      cursor++;
+      continue;
+      }
+
+    rec.fmt = hdr.fmt;
+    rec.task = hdr.task;
+    rec.size = hdr.size;
+    rec.slots = hdr.slots;
+    rec.flags = hdr.flags;
+    if (hdr.flags & (LOGRING_TEXT|LOGRING_FMTCOPY))
+      {
+      if (hdr.size == 0 || !memchr(rec.payload, 0, hdr.size))
+        rec.flags = LOGRING_TEXT, rec.size = 0;
+      else if (hdr.flags & LOGRING_FMTCOPY)
+        rec.fmt = (const char*) rec.payload;
+      }
+    cursor += hdr.slots;
+    return true;
+    }
+  }
+
+/**
+ * Skip: skip a pending slot
+ */
+void OvmsLogRing::Skip(uint32_t &cursor)
+  {
+  if (cursor != GetHead())
+    {
+    cursor++;
+    m_lost++;
+    }
+  }
+
+/**
+ * Wait: block the reader until a record is published at the cursor
+ */
+void OvmsLogRing::Wait(uint32_t cursor, TickType_t timeout)
+  {
+  m_reader_waiting.store(true);
+  if (m_seq && cursor != GetHead() && State(cursor) != LRS_PENDING)
+    {
+    m_reader_waiting.store(false);
+    return;
+    }
+  ulTaskNotifyTake(pdTRUE, timeout);
+  }
+
+/**
+ * Format: format a record into buf (reader side)
+ *  The line is clipped to size-1 characters, returns the line length.
+ */
+size_t OvmsLogRing::Format(const LogRingRecord &rec, char* buf, size_t size)
+  {
+  logring_output out;
+  out.buf = buf;
+  out.size = size;
+  out.len = 0;
+  buf[0] = 0;
+  if (rec.flags & LOGRING_TEXT)
+    {
+    out.Append((const char*) rec.payload, strnlen((const char*) rec.payload, rec.size));
+    return out.len;
+    }
+  // a non-copied format must be a literal, a stale producer may have
+  // overwritten the header after a wrap:
+  if (!rec.fmt || (!(rec.flags & LOGRING_FMTCOPY) && !logring_static(rec.fmt)))
+    {
+    out.Append("(invalid log record)", 20);
+    return out.len;
+    }
+  const uint8_t* arg = rec.payload;
+  const uint8_t* end = rec.payload + rec.size;
+  if (rec.flags & LOGRING_FMTCOPY)
+    arg += strlen(rec.fmt) + 1;
+
+  #define LOGRING_GET(type, var) \
+    type var; \
+    if (arg + sizeof(type) > end) goto done; \
+    memcpy(&var, arg, sizeof(type)); \
+    arg += sizeof(type);
+
+  logring_spec_t spec;
+  const char* p = rec.fmt;
+  while (logring_next(p, spec))
+    {
+    out.Append(p, spec.start - p);
+    p = spec.end;
+    if (spec.type == LA_NONE)
+      {
+      out.Append("%", 1);
+      continue;
+      }
+
+    // rebuild the specification with '*' arguments inserted:
+    char sb[40];
+    size_t sl = 0;
+    for (const char* s = spec.start; s < spec.end; s++)
+      {
+      if (*s != '*')
+        {
+        if (sl + 1 >= sizeof(sb)) goto done;
+        sb[sl++] = *s;
+        continue;
+        }
+      LOGRING_GET(int, v);
+      if (v < 0 && sl > 0 && sb[sl-1] == '.')
+        sl--;   // negative precision = none
+      else
+        {
+        int n = snprintf(sb + sl, sizeof(sb) - sl, "%d", v);
+        if (n < 0 || sl + n >= sizeof(sb)) goto done;
+        sl += n;
+        }
+      }
+    sb[sl] = 0;
+
+    switch (spec.type)
+      {
+      case LA_INT:    { LOGRING_GET(int, v); out.Appendf(sb, v); continue; }
+      case LA_LONG:   { LOGRING_GET(long, v); out.Appendf(sb, v); continue; }
+      case LA_LLONG:  { LOGRING_GET(long long, v); out.Appendf(sb, v); continue; }
+      case LA_SIZE:   { LOGRING_GET(size_t, v); out.Appendf(sb, v); continue; }
+      case LA_DOUBLE: { LOGRING_GET(double, v); out.Appendf(sb, v); continue; }
+      case LA_PTR:    { LOGRING_GET(void*, v); out.Appendf(sb, v); continue; }
+      case LA_STRING:
+        {
+        const uint8_t* z = (const uint8_t*) memchr(arg, 0, end - arg);
+        if (!z) goto done;
+        out.Appendf(sb, (const char*) arg);
+        arg = z + 1;
+        continue;
+        }
+      default:
+        goto done;
+      }
+    }
+  #undef LOGRING_GET
+
+done:
+  // literal rest (or the unformatted rest if the payload doesn't match):
+  out.Append(p, strlen(p));
+  return out.len;
+  }
+
+/**
+ * Status: output ring statistics
+ */
+void OvmsLogRing::Status(int verbosity, OvmsWriter* writer)
+  {
+  writer->printf(
+    "Log ring size      : %u kB\n"
+    "  Lines written    : %" PRIu32 "\n"
+    "  Preformatted     : %" PRIu32 "\n"
+    "  Overrun slots    : %" PRIu32 "\n"
+    , (unsigned)(m_slots * LOGRING_SLOT_SIZE / 1024)
+    , m_written.load()
+    , m_fallbacks.load()
+    , m_lost);
+  if (m_limit_rate > 0)
+    writer->printf("  Rate limit       : %d lines/s per tag\n", m_limit_rate);
+  else
+    writer->puts("  Rate limit       : off");
+  writer->printf("  Rate limited     : %" PRIu32 "\n", m_limit_dropped);
+
+  portENTER_CRITICAL(&logring_limit_spinlock);
+  limit_t limit[LOGRING_LIMIT_TAGS];
+  memcpy(limit, m_limit, sizeof(limit));
+  portEXIT_CRITICAL(&logring_limit_spinlock);
+  for (int i = 0; i < LOGRING_LIMIT_TAGS; i++)
+    {
+    if (limit[i].hash && limit[i].dropped)
+      writer->printf("    %-15s: %" PRIu32 "\n", limit[i].tag, limit[i].dropped);
+    }
+  }
@@ -0,0 +1,137 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __LOG_RING_H__
+#define __LOG_RING_H__
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+class OvmsWriter;
+
+#define LOGRING_SLOT_SIZE         32      // Slot size [bytes], records occupy 1…LOGRING_MAX_SLOTS slots
+#define LOGRING_MAX_SLOTS         64      // Max record size in slots (2 kB)
+#define LOGRING_MAX_LINE          4096    // Formatted lines are clipped to this length
+#define LOGRING_LIMIT_TAGS        32      // Rate limiter: number of tags tracked
+
+// Record flags:
+#define LOGRING_PARTIAL           0x01    // Line continues with the next record of the task
+#define LOGRING_TEXT              0x02    // Payload is preformatted text (fallback)
+#define LOGRING_FMTCOPY           0x04    // Payload starts with a copy of the format string
+
+/**
+ * LogRingRecord: a log record fetched from the ring (reader side)
+ */
+struct LogRingRecord
+  {
+  const char*     fmt;                    // Format string (static or pointing into payload)
+  TaskHandle_t    task;                   // Producer task
+  uint16_t        size;                   // Payload size
+  uint8_t         slots;                  // Record size in slots
+  uint8_t         flags;                  // LOGRING_…
+  uint8_t         payload[LOGRING_MAX_SLOTS * LOGRING_SLOT_SIZE];
+  };
+
+/**
+ * OvmsLogRing: preallocated binary log ring with deferred formatting
+ *
+ *  Producers store the format pointer and the raw arguments (strings are copied),
+ *  formatting is done by the reader. Writing is lock free: a record reserves its
+ *  slots by an atomic increment of the head and publishes them by setting the slot
+ *  sequence numbers. Readers keep their own cursor and detect overwritten records
+ *  by the sequence numbers, so a slow reader loses lines but never blocks producers.
+ *
+ *  ESP log lines of levels I/D/V can be rate limited per tag (opt-in, config
+ *  "log ratelimit"); excess lines are dropped and counted.
+ */
+class OvmsLogRing
+  {
+  public:
+    OvmsLogRing();
+    ~OvmsLogRing();
+
+  public:
+    bool Init(size_t size, TaskHandle_t reader);
+    bool IsReady() { return m_seq != NULL; }
+    int Write(const char* fmt, va_list args, uint8_t flags=0) __attribute__ ((format (printf, 2, 0)));
+
+  public:
+    uint32_t GetHead() { return m_head.load(std::memory_order_acquire); }
+    bool Fetch(uint32_t &cursor, LogRingRecord &rec);
+    void Skip(uint32_t &cursor);
+    size_t Format(const LogRingRecord &rec, char* buf, size_t size);
+    void Wait(uint32_t cursor, TickType_t timeout);
+
+  public:
+    void SetRateLimit(int lines_per_sec) { m_limit_rate = lines_per_sec; }
+    uint32_t GetLimitDropped() { return m_limit_dropped; }
+    void Status(int verbosity, OvmsWriter* writer);
+
+  protected:
+    bool Limit(const char* tag);
+    int WriteRecord(const char* fmt, va_list args, uint8_t flags);
+    int WriteText(const char* fmt, va_list args, uint8_t flags);
+    void Put(uint32_t &pos, const void* data, size_t len);
+    void Get(uint32_t pos, void* data, size_t len);
+    int State(uint32_t cursor);
+    friend struct logring_writer;
+
+  protected:
+    uint8_t*                  m_data;         // Slot data
+    std::atomic<uint32_t>*    m_seq;          // Slot sequence: record start index + 1, 0 = being written
+    uint32_t                  m_slots;        // Slot count (power of 2)
+    uint32_t                  m_mask;
+    std::atomic<uint32_t>     m_head;         // Next slot index to reserve
+    TaskHandle_t              m_reader;       // Reader task to wake up
+    std::atomic<bool>         m_reader_waiting;
+
+  protected:
+    std::atomic<uint32_t>     m_written;      // Records written
+    std::atomic<uint32_t>     m_fallbacks;    // … preformatted
+    uint32_t                  m_lost;         // Slots overwritten before being read
+
+  protected:
+    struct limit_t
+      {
+      uint32_t    hash;                       // Tag hash, 0 = unused
+      char        tag[16];
+      int32_t     tokens;                     // Line budget [1/1000 lines]
+      uint32_t    last;                       // Last refill [ms]
+      uint32_t    dropped;
+      };
+    limit_t                   m_limit[LOGRING_LIMIT_TAGS];
+    int                       m_limit_rate;   // Lines per second per tag, 0 = unlimited
+    uint32_t                  m_limit_dropped;
+  };
+
+#endif //#ifndef __LOG_RING_H__
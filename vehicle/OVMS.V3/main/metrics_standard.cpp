@@ -44,6 +44,10 @@ MetricsStandard::MetricsStandard()
   ms_m_freeram = new OvmsMetricInt(MS_M_FREERAM, SM_STALE_MID);
   ms_m_monotonic = new OvmsMetricInt(MS_M_MONOTONIC, SM_STALE_MIN, Seconds);
   ms_m_timeutc = new OvmsMetricInt64(MS_M_TIME_UTC, SM_STALE_MIN, DateUTC);
+  ms_m_event_queue_hwm = new OvmsMetricInt(MS_M_EVENT_QUEUE_HWM, SM_STALE_MID);
+  ms_m_event_lag = new OvmsMetricFloat(MS_M_EVENT_LAG, SM_STALE_MID, Seconds);
+  ms_m_event_handler_max = new OvmsMetricFloat(MS_M_EVENT_HANDLER_MAX, SM_STALE_MID, Seconds);
+  ms_m_event_handler_slowest = new OvmsMetricString(MS_M_EVENT_HANDLER_SLOWEST, SM_STALE_MID);
 
   ms_m_net_type = new OvmsMetricString(MS_N_TYPE, SM_STALE_MAX);
   ms_m_net_sq = new OvmsMetricInt(MS_N_SQ, SM_STALE_MAX, dbm);
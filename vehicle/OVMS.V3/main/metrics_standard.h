@@ -47,6 +47,10 @@
 #define MS_M_FREERAM                "m.freeram"
 #define MS_M_MONOTONIC              "m.monotonic"
 #define MS_M_TIME_UTC               "m.time.utc"
+#define MS_M_EVENT_QUEUE_HWM        "m.event.queue.hwm"
+#define MS_M_EVENT_LAG              "m.event.lag"
+#define MS_M_EVENT_HANDLER_MAX      "m.event.handler.max"
+#define MS_M_EVENT_HANDLER_SLOWEST  "m.event.handler.slowest"
 
 #define MS_N_TYPE                   "m.net.type"
 #define MS_N_SQ                     "m.net.sq"
@@ -288,6 +292,10 @@ class MetricsStandard
     OvmsMetricInt*    ms_m_freeram;
     OvmsMetricInt*    ms_m_monotonic;
     OvmsMetricInt64*  ms_m_timeutc;
+    OvmsMetricInt*    ms_m_event_queue_hwm;               // Event queue depth high water mark (last minute)
+    OvmsMetricFloat*  ms_m_event_lag;                     // Max event signal to dispatch lag (last minute) [s]
+    OvmsMetricFloat*  ms_m_event_handler_max;             // Max event handler execution time (last minute) [s]
+    OvmsMetricString* ms_m_event_handler_slowest;         // … the handler: "<event>:<caller>"
 
     OvmsMetricString* ms_m_net_type;                      // none, wifi, modem
     OvmsMetricInt*    ms_m_net_sq;                        // Network signal quality [dbm]
@@ -557,7 +557,7 @@ void Boot::Restart(bool hard)
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG,"ticker.1", std::bind(&Boot::Ticker1, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.1", std::bind(&Boot::Ticker1, this, _1, _2));
   }
 
 void Boot::DeepSleep(unsigned int seconds /*=60*/)
@@ -592,7 +592,7 @@ void Boot::ShutdownReady(const char* tag)
     m_shutdown_timer = 2;
   }
 
-void Boot::Ticker1(std::string event, void* data)
+void Boot::Ticker1(const char* event, void* data)
   {
   if (m_shutdown_timer > 0)
     {
@@ -723,9 +723,10 @@ void Boot::ErrorCallback(const void *f, int core_id, bool is_abort, esp_reset_re
     boot_data.crash_data.bt[i++].pc = 0;
 
   // Save Event debug info:
-  if (!MyEvents.m_current_event.empty())
+  const char* curr_event = MyEvents.m_current_event;
+  if (curr_event && *curr_event)
     {
-    strlcpy(boot_data.curr_event_name, MyEvents.m_current_event.c_str(), sizeof(boot_data.curr_event_name));
+    strlcpy(boot_data.curr_event_name, curr_event, sizeof(boot_data.curr_event_name));
     if (MyEvents.m_current_callback)
       strlcpy(boot_data.curr_event_handler, MyEvents.m_current_callback->m_caller.c_str(), sizeof(boot_data.curr_event_handler));
     else
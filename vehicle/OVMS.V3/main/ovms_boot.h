@@ -137,7 +137,7 @@ class Boot
     void ShutdownPending(const char* tag);
     void ShutdownReady(const char* tag);
     bool IsShuttingDown();
-    void Ticker1(std::string event, void* data);
+    void Ticker1(const char* event, void* data);
     void UpdateConfig(std::string event, void* data);
 
   public:
@@ -791,6 +791,7 @@ OvmsCommandApp::OvmsCommandApp()
   m_logtask_queue = NULL;
   m_logtask_dropcnt = 0;
   m_logfile_cyclecnt = 0;
+  m_logring_task = NULL;
   m_expiretask = 0;
 
   m_root.RegisterCommand("help", "Ask for help", help, "", 0, 0, false);
@@ -831,16 +832,28 @@ OvmsCommandApp::~OvmsCommandApp()
   {
   }
 
+static void LogRingTaskEntry(void* me)
+  {
+  ((OvmsCommandApp*)me)->LogRingTask();
+  }
+
 void OvmsCommandApp::ConfigureLogging()
   {
   MyConfig.RegisterParam("log", "Logging configuration", true, true);
 
+  // start log distribution:
+  if (!m_logring_task)
+    {
+    xTaskCreatePinnedToCore(LogRingTaskEntry, "OVMS Log", 4*1024, (void*)this,
+      CONFIG_OVMS_LOG_RING_TASK_PRIORITY, &m_logring_task, CORE(1));
+    }
+
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
-  MyEvents.RegisterEvent(TAG, "sd.mounted", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
-  MyEvents.RegisterEvent(TAG, "sd.unmounting", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
-  MyEvents.RegisterEvent(TAG, "ticker.3600", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "config.changed", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "sd.mounted", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "sd.unmounting", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.3600", std::bind(&OvmsCommandApp::EventHandler, this, _1, _2));
 
   ReadConfig();
   }
@@ -890,14 +903,22 @@ OvmsCommand* OvmsCommandApp::FindCommandFullName(const char* name)
 
 void OvmsCommandApp::RegisterConsole(OvmsWriter* writer)
   {
+  OvmsMutexLock lock(&m_consoles_mutex);
   m_consoles.insert(writer);
   }
 
 void OvmsCommandApp::DeregisterConsole(OvmsWriter* writer)
   {
+  OvmsMutexLock lock(&m_consoles_mutex);
   m_consoles.erase(writer);
   }
 
+/**
+ * Log: add a log line to the log ring
+ *  Lines are stored unformatted and formatted by the log task (LogRingTask)
+ *  for the consoles, so logging doesn't allocate memory or take locks.
+ *  Until the log task has been started, lines are printed directly.
+ */
 int OvmsCommandApp::Log(const char* fmt, ...)
   {
   va_list args;
@@ -909,52 +930,126 @@ int OvmsCommandApp::Log(const char* fmt, ...)
 
 int OvmsCommandApp::Log(const char* fmt, va_list args)
   {
-  LogBuffers* lb;
-  TaskHandle_t task = xTaskGetCurrentTaskHandle();
-  PartialLogs::iterator it = m_partials.find(task);
-  if (it == m_partials.end())
-    lb = new LogBuffers();
+  if (!m_logring.IsReady())
+    return ::vprintf(fmt, args);
+  return m_logring.Write(fmt, args);
+  }
+
+int OvmsCommandApp::LogPartial(const char* fmt, ...)
+  {
+  va_list args;
+  va_start(args, fmt);
+  int ret;
+  if (!m_logring.IsReady())
+    ret = ::vprintf(fmt, args);
   else
+    ret = m_logring.Write(fmt, args, LOGRING_PARTIAL);
+  va_end(args);
+  return ret;
+  }
+
+/**
+ * LogRingTask: format the log ring records and pass them to the consoles
+ */
+void OvmsCommandApp::LogRingTask()
+  {
+  if (!m_logring.Init(CONFIG_OVMS_LOG_RING_SIZE * 1024, xTaskGetCurrentTaskHandle()))
     {
-    lb = it->second;
-    m_partials.erase(task);
+    m_logring_task = NULL;
+    vTaskDelete(NULL);
+    return;
     }
-  int ret = LogBuffer(lb, fmt, args);
-  lb->set(m_consoles.size());
-  for (ConsoleSet::iterator it = m_consoles.begin(); it != m_consoles.end(); ++it)
+
+  // record & line buffers are reused for all lines:
+  LogRingRecord* rec = new LogRingRecord;
+  char* line = (char*) ExternalRamMalloc(LOGRING_MAX_LINE);
+  uint32_t cursor = 0;
+  uint32_t stalled = 0;
+  uint32_t limit_dropped = 0, limit_reported = 0;
+
+  for (;;)
     {
-    (*it)->Log(lb);
+    while (m_logring.Fetch(cursor, *rec))
+      {
+      stalled = 0;
+      LogDispatch(*rec, line);
+      }
+
+    uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    if (cursor != m_logring.GetHead())
+      {
+      // a producer has been deleted while writing or is starved:
+      if (stalled == 0)
+        stalled = now;
+      else if (now - stalled > 1000)
+        {
+        m_logring.Skip(cursor);
+        stalled = 0;
+        continue;
+        }
+      }
+
+    // report rate limiting:
+    if (m_logring.GetLimitDropped() != limit_dropped && now - limit_reported >= 10000)
+      {
+      ESP_LOGW(TAG, "Log rate limit: %" PRIu32 " lines dropped (see 'log status')",
+        m_logring.GetLimitDropped() - limit_dropped);
+      limit_dropped = m_logring.GetLimitDropped();
+      limit_reported = now;
+      }
+
+    m_logring.Wait(cursor, pdMS_TO_TICKS(100));
     }
-  return ret;
   }
 
-int OvmsCommandApp::LogPartial(const char* fmt, ...)
+void OvmsCommandApp::LogDispatch(LogRingRecord &rec, char* line)
   {
-  LogBuffers* lb;
-  TaskHandle_t task = xTaskGetCurrentTaskHandle();
-  PartialLogs::iterator it = m_partials.find(task);
-  if (it == m_partials.end())
     {
-    lb = new LogBuffers();
-    m_partials[task] = lb;
+    OvmsMutexLock lock(&m_consoles_mutex);
+    if (m_consoles.empty() && m_partials.empty())
+      return;
     }
+  size_t len = m_logring.Format(rec, line, LOGRING_MAX_LINE);
+
+  // the consoles take ownership of the buffer, so it needs to be a copy:
+  char* buffer = (char*) ExternalRamMalloc(len + 1);
+  if (!buffer)
+    return;
+  memcpy(buffer, line, len + 1);
+
+  LogBuffers* lb;
+  PartialLogs::iterator it = m_partials.find(rec.task);
+  if (it == m_partials.end())
+    lb = LogBuffers::Acquire();
   else
     {
     lb = it->second;
+    m_partials.erase(it);
+    }
+  LogBuffer(lb, buffer);
+
+  if (rec.flags & LOGRING_PARTIAL)
+    {
+    m_partials[rec.task] = lb;
+    return;
+    }
+
+  OvmsMutexLock lock(&m_consoles_mutex);
+  if (m_consoles.empty())
+    {
+    lb->set(1);
+    lb->release();
+    return;
+    }
+  lb->set(m_consoles.size());
+  for (ConsoleSet::iterator it = m_consoles.begin(); it != m_consoles.end(); ++it)
+    {
+    (*it)->Log(lb);
     }
-  va_list args;
-  va_start(args, fmt);
-  int ret = LogBuffer(lb, fmt, args);
-  va_end(args);
-  return ret;
   }
 
-int OvmsCommandApp::LogBuffer(LogBuffers* lb, const char* fmt, va_list args)
+void OvmsCommandApp::LogBuffer(LogBuffers* lb, char* buffer)
   {
-  char *buffer;
-  int ret = vasprintf(&buffer, fmt, args);
-  if (ret < 0) return ret;
-
   // Replace CR/LF except last by "|", but don't leave '|' at the end.
   // An ESC sequence to change color may be appended after the log text.
   char* s;
@@ -978,7 +1073,6 @@ int OvmsCommandApp::LogBuffer(LogBuffers* lb, const char* fmt, va_list args)
     }
 
   lb->append(buffer);
-  return ret;
   }
 
 int OvmsCommandApp::HexDump(const char* tag, const char* prefix, const char* data, size_t length, size_t colsize /*=16*/)
@@ -1480,27 +1574,28 @@ void OvmsCommandApp::ShowLogStatus(int verbosity, OvmsWriter* writer)
     , m_logtask_dropcnt
     , m_logtask_linecnt
     , m_logtask_fsynctime / 1e6);
+  m_logring.Status(verbosity, writer);
   }
 
-void OvmsCommandApp::EventHandler(std::string event, void* data)
+void OvmsCommandApp::EventHandler(const char* event, void* data)
   {
-  if (event == "config.changed")
+  if (strcmp(event, "config.changed") == 0)
     {
     OvmsConfigParam* param = (OvmsConfigParam*) data;
     if (param && param->GetName() == "log")
       ReadConfig();
     }
-  else if (event == "sd.mounted")
+  else if (strcmp(event, "sd.mounted") == 0)
     {
     if (startsWith(m_logfile_path, "/sd"))
       OpenLogfile();
     }
-  else if (event == "sd.unmounting")
+  else if (strcmp(event, "sd.unmounting") == 0)
     {
     if (startsWith(m_logfile_path, "/sd"))
       CloseLogfile();
     }
-  else if (event == "ticker.3600")
+  else if (strcmp(event, "ticker.3600") == 0)
     {
     int keepdays = MyConfig.GetParamValueInt("log", "file.keepdays", 30);
     time_t utm = time(NULL);
@@ -1525,6 +1620,9 @@ void OvmsCommandApp::ReadConfig()
       SetLoglevel(kv.first.substr(6), kv.second);
     }
 
+  // configure rate limit (lines/s per tag, 0 = off):
+  m_logring.SetRateLimit(MyConfig.GetParamValueInt("log", "ratelimit", 0));
+
   // configure log file:
   m_logfile_maxsize = MyConfig.GetParamValueInt("log", "file.maxsize", 1024);
   if (MyConfig.GetParamValueBool("log", "file.enable", false) == true)
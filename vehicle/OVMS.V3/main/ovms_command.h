@@ -42,6 +42,7 @@
 #include "ovms_utils.h"
 #include "ovms_mutex.h"
 #include "task_base.h"
+#include "log_ring.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "microrl_config.h"
@@ -353,14 +354,16 @@ class OvmsCommandApp : public OvmsWriter
     void ExpireLogFiles(int verbosity, OvmsWriter* writer, int keepdays);
     void ShowLogStatus(int verbosity, OvmsWriter* writer);
     static void ExpireTask(void* data);
-    void EventHandler(std::string event, void* data);
+    void EventHandler(const char* event, void* data);
+    void LogRingTask();
 
   private:
     bool CycleLogfile();
     void ReadConfig();
 
   private:
-    int LogBuffer(LogBuffers* lb, const char* fmt, va_list args) __attribute__ ((format (printf, 3, 0)));
+    void LogBuffer(LogBuffers* lb, char* buffer);
+    void LogDispatch(LogRingRecord &rec, char* line);
 
   public:
     void Log(LogBuffers* message);
@@ -369,7 +372,10 @@ class OvmsCommandApp : public OvmsWriter
     OvmsCommand m_root;
     typedef std::set<OvmsWriter*> ConsoleSet;
     ConsoleSet m_consoles;
-    PartialLogs m_partials;
+    OvmsMutex m_consoles_mutex;
+    PartialLogs m_partials;           // LogRingTask only
+    OvmsLogRing m_logring;
+    TaskHandle_t m_logring_task;
     FILE* m_logfile;
     std::string m_logfile_path;
     size_t m_logfile_size;
@@ -33,12 +33,16 @@ static const char *TAG = "events";
 
 #include <string.h>
 #include <stdio.h>
+#include <vector>
+#include <algorithm>
 #include <esp_task_wdt.h>
+#include <esp_timer.h>
 #include "ovms_module.h"
 #include "ovms_events.h"
 #include "ovms_command.h"
 #include "ovms_script.h"
 #include "ovms_boot.h"
+#include "metrics_standard.h"
 #if ESP_IDF_VERSION_MAJOR >= 4
 #include <esp_netif_types.h>
 #include <esp_eth_com.h>
@@ -53,20 +57,21 @@ static const char *TAG = "events";
 
 OvmsEvents MyEvents __attribute__ ((init_priority (1200)));
 
-typedef void (*event_signal_done_fn)(const char* event, void* data);
-
-bool EventMap::GetCompletion(OvmsWriter* writer, const char* token) const
+bool OvmsEvents::GetCompletion(OvmsWriter* writer, const char* token)
   {
   unsigned int index = 0;
   bool match = false;
   writer->SetCompletion(index, NULL);
   if (token)
     {
+    OvmsMutexLock lock(&m_events_mutex);
     size_t len = strlen(token);
-    for (const_iterator it = begin(); it != end(); ++it)
+    for (EventIdMap::const_iterator it = m_event_ids.begin(); it != m_event_ids.end(); ++it)
       {
       if (it->first.compare("*") == 0)
         continue;
+      if (GetEntry(it->second)->m_callbacks.empty())
+        continue;
       if (it->first.compare(0, len, token) == 0)
         {
         writer->SetCompletion(index++, it->first.c_str());
@@ -101,8 +106,15 @@ void event_trace(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 
 void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
-  writer->printf("Event map has %d listeners, and queue has %d/%d entries\n",
-    MyEvents.Map().size(),
+  int listened = 0;
+  for (event_id_t id = 0; id < MyEvents.GetEventCount(); id++)
+    {
+    if (!MyEvents.GetEventListeners(id)->empty())
+      listened++;
+    }
+  writer->printf("Event map has %d listeners (%d/%d names interned), and queue has %d/%d entries\n",
+    listened,
+    MyEvents.GetEventCount(), EVENT_ID_MAX,
     uxQueueMessagesWaiting(MyEvents.m_taskqueue),
     CONFIG_OVMS_HW_EVENT_QUEUE_SIZE);
 
@@ -110,7 +122,7 @@ void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
   if (cbe != NULL)
     {
     writer->printf("Currently dispatching:\n");
-    writer->printf("  Event: %s\n",MyEvents.m_current_event.c_str());
+    writer->printf("  Event: %s\n",MyEvents.m_current_event);
     writer->printf("  To:    %s\n",cbe->m_caller.c_str());
     writer->printf("  For:   %" PRIu32 " second(s)\n",monotonictime-MyEvents.m_current_started);
     }
@@ -118,24 +130,37 @@ void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 
 void event_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
-  std::string event;
-  for (EventMap::const_iterator itm=MyEvents.Map().begin(); itm != MyEvents.Map().end(); ++itm)
+  MyEvents.ListEvents(writer, (argc > 0) ? argv[0] : NULL);
+  }
+
+void event_profile(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  const char* filter = NULL;
+  bool histogram = false, reset = false;
+
+  for (int i=0; i<argc; i++)
     {
-    if (argc > 0 && itm->first.find(argv[0]) == std::string::npos)
-      continue;
-    event.append(itm->first);
-    event.append(":  ");
-    EventCallbackList* el = itm->second;
-    for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); )
+    if (argv[i][0] == '-')
       {
-      EventCallbackEntry* ec = *itc;
-      event.append(ec->m_caller);
-      if (++itc != el->end())
-        event.append(", ");
+      switch (argv[i][1])
+        {
+        case 'h': histogram = true; break;
+        case 'r': reset = true; break;
+        default:
+          cmd->PutUsage(writer);
+          return;
+        }
       }
-    event.append("\n");
+    else
+      filter = argv[i];
+    }
+
+  MyEvents.ShowProfile(writer, filter, histogram);
+  if (reset)
+    {
+    MyEvents.ResetProfile();
+    writer->puts("Profile reset.");
     }
-  writer->printf("%s", event.c_str());
   }
 
 int event_validate(OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv, bool complete)
@@ -143,7 +168,7 @@ int event_validate(OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* c
   int argpos = 0;
   for (int i=0; i < argc; i++)
     argpos += (argv[i][0] != '-') ? 1 : 0;
-  if (argpos == 1 && MyEvents.Map().GetCompletion(writer, argv[argc-1]))
+  if (argpos == 1 && MyEvents.GetCompletion(writer, argv[argc-1]))
     return argc;
   return -1;
   }
@@ -201,6 +226,23 @@ OvmsEvents::OvmsEvents()
   ESP_LOGI(TAG, "Initialising EVENTS (1200)");
 
   m_current_callback = NULL;
+  m_current_event = NULL;
+  m_current_started = 0;
+
+  memset(m_events, 0, sizeof(m_events));
+  m_event_count = 0;
+  m_event_any = GetEntry(GetEventId("*"));
+
+  memset(&m_lag, 0, sizeof(m_lag));
+  memset(&m_script_other, 0, sizeof(m_script_other));
+  m_queue_hwm = m_interval_queue_hwm = 0;
+  m_interval_lag_max = m_interval_handler_max = 0;
+  m_interval_handler[0] = 0;
+  m_profile_reset = false;
+  RegisterEventCallback(TAG, "ticker.60", [this](const char* event, void* data)
+    {
+    UpdateMetrics(event, data);
+    });
 
 #ifdef CONFIG_OVMS_DEV_DEBUGEVENTS
   m_trace = true;
@@ -219,6 +261,11 @@ OvmsEvents::OvmsEvents()
   OvmsCommand* cmd_event = MyCommandApp.RegisterCommand("event","EVENT framework", event_status, "", 0, 0, false);
   cmd_event->RegisterCommand("status","Show status of event system",event_status);
   cmd_event->RegisterCommand("list","List registered events",event_list,"[<key>]", 0, 1);
+  cmd_event->RegisterCommand("profile","Show event handler execution times",event_profile,
+    "[-h] [-r] [<key>]\n"
+    "-h = show histograms\n"
+    "-r = reset statistics after display\n"
+    "<key> = filter by event/handler name part", 0, 3);
   cmd_event->RegisterCommand("raise","Raise a textual event",event_raise,"[-d<delay_ms>] <event>", 1, 2, true, event_validate);
   OvmsCommand* cmd_eventtrace = cmd_event->RegisterCommand("trace","EVENT trace framework");
   cmd_eventtrace->RegisterCommand("on","Turn event tracing ON",event_trace);
@@ -253,15 +300,18 @@ void OvmsEvents::EventTask()
     if (xQueueReceive(m_taskqueue, &msg, pdMS_TO_TICKS(5000)) == pdTRUE)
       {
       esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
+      int depth = uxQueueMessagesWaiting(m_taskqueue) + 1;
+      if (depth > m_queue_hwm) m_queue_hwm = depth;
+      if (depth > m_interval_queue_hwm) m_interval_queue_hwm = depth;
       switch(msg.type)
         {
         case EVENT_none:
           break;
         case EVENT_signal:
-          m_current_event = msg.body.signal.event;
+          m_current_event = GetQueueSignalName(&msg);
           HandleQueueSignalEvent(&msg);
           esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
-          m_current_event.clear();
+          m_current_event = NULL;
           break;
         default:
           break;
@@ -286,51 +336,215 @@ void OvmsEvents::EventTask()
     }
   }
 
-void OvmsEvents::HandleQueueSignalEvent(event_queue_t* msg)
+const char* OvmsEvents::GetQueueSignalName(const event_queue_t* msg)
   {
-  // Log everything but the ticker & clock signals
-  if (!startsWith(m_current_event, "ticker.") && !startsWith(m_current_event, "clock."))
+  if (msg->body.signal.id != EVENT_ID_NONE)
+    return MyEvents.GetEventName(msg->body.signal.id);
+  else
+    return msg->body.signal.event;
+  }
+
+/**
+ * DispatchSignal: call the listeners
+ *  Handlers deregistering listeners only mark them as removed (see DeregisterEvent),
+ *  so the list iterator and the current entry stay valid until PurgeRemoved().
+ */
+void OvmsEvents::DispatchSignal(EventCallbackList* el, void* data)
+  {
+  for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); ++itc)
     {
-    if (m_trace)
-      ESP_LOGI(TAG, "Signal(%s)",m_current_event.c_str());
-    else
-      ESP_LOGD(TAG, "Signal(%s)",m_current_event.c_str());
+    EventCallbackEntry* cbe = *itc;
+    if (cbe->m_removed)
+      continue;
+    m_current_started = monotonictime;
+    m_current_callback = cbe;
+    int64_t start = esp_timer_get_time();
+    cbe->m_callback(m_current_event, data);
+    if (!cbe->m_removed)
+      ProfileAdd(&cbe->m_profile, esp_timer_get_time() - start, cbe->m_caller.c_str());
+    m_current_callback = NULL;
     }
+  }
+
+void OvmsEvents::PurgeRemoved()
+  {
+  OvmsMutexLock lock(&m_events_mutex);
+  for (auto &removal : m_removed)
+    {
+    removal.first->remove(removal.second);
+    delete removal.second;
+    }
+  m_removed.clear();
+  }
 
-  auto k = m_map.find(m_current_event);
-  if (k != m_map.end())
+void OvmsEvents::ProfileAdd(EventProfile** profile, uint32_t us, const char* caller)
+  {
+  if (!*profile)
+    {
+    *profile = (EventProfile*) ExternalRamCalloc(1, sizeof(EventProfile));
+    if (!*profile)
+      return;
+    }
+  (*profile)->Add(us);
+  if (us > m_interval_handler_max)
     {
-    EventCallbackList* el = k->second;
-    if (el)
+    m_interval_handler_max = us;
+    snprintf(m_interval_handler, sizeof(m_interval_handler), "%s:%s", m_current_event, caller);
+    }
+  }
+
+void OvmsEvents::ProfileReset()
+  {
+  OvmsMutexLock lock(&m_events_mutex);
+  for (event_id_t id = 0; id < m_event_count; id++)
+    {
+    EventEntry* entry = GetEntry(id);
+    if (entry->m_script_profile)
+      memset(entry->m_script_profile, 0, sizeof(EventProfile));
+    for (EventCallbackList::iterator itc=entry->m_callbacks.begin(); itc!=entry->m_callbacks.end(); ++itc)
       {
-      for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); ++itc)
-        {
-        m_current_started = monotonictime;
-        m_current_callback = *itc;
-        m_current_callback->m_callback(m_current_event, msg->body.signal.data);
-        m_current_callback = NULL;
-        }
+      if ((*itc)->m_profile)
+        memset((*itc)->m_profile, 0, sizeof(EventProfile));
       }
     }
+  memset(&m_lag, 0, sizeof(m_lag));
+  memset(&m_script_other, 0, sizeof(m_script_other));
+  m_queue_hwm = 0;
+  m_profile_reset = false;
+  }
 
-  k = m_map.find("*");
-  if (k != m_map.end())
+void OvmsEvents::UpdateMetrics(const char* event, void* data)
+  {
+  StandardMetrics.ms_m_event_queue_hwm->SetValue(m_interval_queue_hwm);
+  StandardMetrics.ms_m_event_lag->SetValue((float)m_interval_lag_max / 1000000);
+  StandardMetrics.ms_m_event_handler_max->SetValue((float)m_interval_handler_max / 1000000);
+  StandardMetrics.ms_m_event_handler_slowest->SetValue(m_interval_handler);
+  m_interval_queue_hwm = 0;
+  m_interval_lag_max = 0;
+  m_interval_handler_max = 0;
+  m_interval_handler[0] = 0;
+  }
+
+struct event_profile_row_t
+  {
+  std::string event;
+  std::string caller;
+  EventProfile profile;
+  };
+
+static void event_profile_print(OvmsWriter* writer, const char* event, const char* caller,
+                                const EventProfile& p, bool histogram)
+  {
+  writer->printf("%-32s %-16s %8" PRIu32 " %10.1f %8" PRIu32 " %8" PRIu32 "\n",
+    event, caller, p.count, (float)p.total / 1000,
+    p.count ? (uint32_t)(p.total / p.count) : 0, p.max);
+  if (histogram && p.count)
     {
-    EventCallbackList* el = k->second;
-    if (el)
+    std::string hist("  ");
+    char buf[32];
+    for (int b = 0; b < EVENT_PROFILE_BUCKETS; b++)
       {
-      for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); ++itc)
-        {
-        m_current_started = monotonictime;
-        m_current_callback = *itc;
-        m_current_callback->m_callback(m_current_event, msg->body.signal.data);
-        m_current_callback = NULL;
-        }
+      if (p.hist[b] == 0)
+        continue;
+      if (b < EVENT_PROFILE_BUCKETS-1)
+        snprintf(buf, sizeof(buf), " <%" PRIu32 ":%" PRIu32, (uint32_t)2 << b, p.hist[b]);
+      else
+        snprintf(buf, sizeof(buf), " >=%" PRIu32 ":%" PRIu32, (uint32_t)1 << b, p.hist[b]);
+      hist.append(buf);
       }
+    writer->printf("%s\n", hist.c_str());
     }
+  }
+
+/**
+ * ShowProfile: list handler execution time statistics, sorted by total time
+ */
+void OvmsEvents::ShowProfile(OvmsWriter* writer, const char* filter /*=NULL*/, bool histogram /*=false*/)
+  {
+  std::vector<event_profile_row_t> rows;
+  event_profile_row_t row;
+
+  // Copy the statistics, so we don't block registrations while printing:
+  {
+  OvmsMutexLock lock(&m_events_mutex);
+  for (EventIdMap::const_iterator itm=m_event_ids.begin(); itm != m_event_ids.end(); ++itm)
+    {
+    EventEntry* entry = GetEntry(itm->second);
+    row.event = itm->first;
+    for (EventCallbackList::iterator itc=entry->m_callbacks.begin(); itc!=entry->m_callbacks.end(); ++itc)
+      {
+      EventCallbackEntry* ec = *itc;
+      if (!ec->m_profile || ec->m_profile->count == 0)
+        continue;
+      if (filter && row.event.find(filter) == std::string::npos && ec->m_caller.find(filter) == std::string::npos)
+        continue;
+      row.caller = ec->m_caller;
+      row.profile = *ec->m_profile;
+      rows.push_back(row);
+      }
+    if (entry->m_script_profile && entry->m_script_profile->count != 0 &&
+        (!filter || row.event.find(filter) != std::string::npos || strstr("[scripts]", filter)))
+      {
+      row.caller = "[scripts]";
+      row.profile = *entry->m_script_profile;
+      rows.push_back(row);
+      }
+    }
+  }
+
+  std::sort(rows.begin(), rows.end(), [](const event_profile_row_t& a, const event_profile_row_t& b)
+    {
+    return a.profile.total > b.profile.total;
+    });
+
+  writer->printf("%-32s %-16s %8s %10s %8s %8s\n", "Event", "Handler", "Count", "Total[ms]", "Avg[us]", "Max[us]");
+  for (auto it = rows.begin(); it != rows.end(); ++it)
+    event_profile_print(writer, it->event.c_str(), it->caller.c_str(), it->profile, histogram);
+  if (!filter)
+    {
+    EventProfile p = m_script_other;
+    if (p.count)
+      event_profile_print(writer, "(unregistered events)", "[scripts]", p, histogram);
+    p = m_lag;
+    writer->printf("\nDispatch lag:\n");
+    event_profile_print(writer, "(all events)", "[queue]", p, histogram);
+    writer->printf("\nQueue depth high water mark: %d/%d\n", m_queue_hwm, CONFIG_OVMS_HW_EVENT_QUEUE_SIZE);
+    }
+  }
+
+void OvmsEvents::HandleQueueSignalEvent(event_queue_t* msg)
+  {
+  if (m_profile_reset)
+    ProfileReset();
+
+  uint32_t lag = (uint32_t)esp_timer_get_time() - msg->body.signal.time;
+  m_lag.Add(lag);
+  if (lag > m_interval_lag_max) m_interval_lag_max = lag;
+
+  // Log everything but the ticker & clock signals
+  if (strncmp(m_current_event, "ticker.", 7) != 0 && strncmp(m_current_event, "clock.", 6) != 0)
+    {
+    if (m_trace)
+      ESP_LOGI(TAG, "Signal(%s)",m_current_event);
+    else
+      ESP_LOGD(TAG, "Signal(%s)",m_current_event);
+    }
+
+  EventEntry* entry = GetEntry(msg->body.signal.id);
+  if (entry)
+    DispatchSignal(&entry->m_callbacks, msg->body.signal.data);
+  DispatchSignal(&m_event_any->m_callbacks, msg->body.signal.data);
+  if (!m_removed.empty())
+    PurgeRemoved();
 
   m_current_started = monotonictime;
+  int64_t start = esp_timer_get_time();
   MyScripts.EventScript(m_current_event, msg->body.signal.data);
+  uint32_t us = esp_timer_get_time() - start;
+  if (entry)
+    ProfileAdd(&entry->m_script_profile, us, "[scripts]");
+  else
+    m_script_other.Add(us);
 
   FreeQueueSignalEvent(msg);
   }
@@ -339,40 +553,133 @@ void OvmsEvents::FreeQueueSignalEvent(event_queue_t* msg)
   {
   if (msg->body.signal.donefn != NULL)
     {
-    msg->body.signal.donefn(msg->body.signal.event, msg->body.signal.data);
+    msg->body.signal.donefn(GetQueueSignalName(msg), msg->body.signal.data);
+    }
+  if (msg->body.signal.event)
+    {
+    free(msg->body.signal.event);
+    msg->body.signal.event = NULL;
     }
-  free(msg->body.signal.event);
   }
 
-void OvmsEvents::RegisterEvent(std::string caller, std::string event, EventCallback callback)
+/**
+ * GetEventId: look up / intern an event name
+ *  Interned names and their IDs are kept until reboot. Returns EVENT_ID_NONE
+ *  if the name is unknown and create is false, or if the table is full.
+ */
+event_id_t OvmsEvents::GetEventId(const std::string& event, bool create /*=true*/)
   {
-  auto k = m_map.find(event);
-  if (k == m_map.end())
+  OvmsMutexLock lock(&m_events_mutex);
+  auto k = m_event_ids.find(event);
+  if (k != m_event_ids.end())
+    return k->second;
+  if (!create)
+    return EVENT_ID_NONE;
+  if (m_event_count >= EVENT_ID_MAX)
     {
-    m_map[event] = new EventCallbackList();
-    k = m_map.find(event);
+    ESP_LOGE(TAG, "GetEventId: name table full, cannot intern '%s'", event.c_str());
+    return EVENT_ID_NONE;
+    }
+
+  event_id_t id = m_event_count;
+  EventEntry** chunk = m_events[id / EVENT_ID_CHUNK];
+  if (!chunk)
+    {
+    chunk = m_events[id / EVENT_ID_CHUNK] = new EventEntry*[EVENT_ID_CHUNK];
+    memset(chunk, 0, EVENT_ID_CHUNK * sizeof(EventEntry*));
+    }
+  chunk[id % EVENT_ID_CHUNK] = new EventEntry(event);
+  m_event_ids[event] = id;
+  // Publish the entry after setting it up, dispatching reads the table unlocked:
+  __sync_synchronize();
+  m_event_count = id + 1;
+  return id;
+  }
+
+const char* OvmsEvents::GetEventName(event_id_t id)
+  {
+  EventEntry* entry = GetEntry(id);
+  return entry ? entry->m_name.c_str() : "";
+  }
+
+const EventCallbackList* OvmsEvents::GetEventListeners(event_id_t id)
+  {
+  EventEntry* entry = GetEntry(id);
+  return entry ? &entry->m_callbacks : NULL;
+  }
+
+void OvmsEvents::ListEvents(OvmsWriter* writer, const char* filter)
+  {
+  std::string event;
+  OvmsMutexLock lock(&m_events_mutex);
+  for (EventIdMap::const_iterator itm=m_event_ids.begin(); itm != m_event_ids.end(); ++itm)
+    {
+    if (filter && itm->first.find(filter) == std::string::npos)
+      continue;
+    EventCallbackList* el = &GetEntry(itm->second)->m_callbacks;
+    if (el->empty())
+      continue;
+    event.append(itm->first);
+    event.append(":  ");
+    for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); )
+      {
+      EventCallbackEntry* ec = *itc;
+      event.append(ec->m_caller);
+      if (++itc != el->end())
+        event.append(", ");
+      }
+    event.append("\n");
     }
-  if (k == m_map.end())
+  writer->printf("%s", event.c_str());
+  }
+
+void OvmsEvents::RegisterEvent(std::string caller, std::string event, EventCallback callback)
+  {
+  // Compatibility wrapper for std::string callbacks: this constructs a std::string
+  // per call, which allocates for names exceeding the small buffer (15 chars).
+  // Use RegisterEventCallback() for frequent events.
+  RegisterEventCallback(caller, event, [callback](const char* event, void* data)
+    {
+    callback(event, data);
+    });
+  }
+
+void OvmsEvents::RegisterEventCallback(std::string caller, std::string event, EventNameCallback callback)
+  {
+  EventEntry* entry = GetEntry(GetEventId(event));
+  if (!entry)
     {
     ESP_LOGE(TAG, "Problem registering event %s for caller %s",event.c_str(),caller.c_str());
     return;
     }
 
-  EventCallbackList *el = k->second;
-  el->push_back(new EventCallbackEntry(caller,callback));
+  OvmsMutexLock lock(&m_events_mutex);
+  entry->m_callbacks.push_back(new EventCallbackEntry(caller,callback));
   }
 
 void OvmsEvents::DeregisterEvent(std::string caller)
   {
-  EventMap::iterator itm=m_map.begin();
-  while (itm!=m_map.end())
+  OvmsMutexLock lock(&m_events_mutex);
+  // a handler running on the event task may deregister listeners of the
+  // list being dispatched, including itself: defer these deletions
+  bool dispatching = (m_current_callback != NULL && xTaskGetCurrentTaskHandle() == m_taskid);
+  for (event_id_t id = 0; id < m_event_count; id++)
     {
-    EventCallbackList* el = itm->second;
+    EventCallbackList* el = &GetEntry(id)->m_callbacks;
     EventCallbackList::iterator itc=el->begin();
     while (itc!=el->end())
       {
       EventCallbackEntry* ec = *itc;
-      if (ec->m_caller == caller)
+      if (ec->m_caller == caller && dispatching)
+        {
+        if (!ec->m_removed)
+          {
+          ec->m_removed = true;
+          m_removed.push_back(std::make_pair(el, ec));
+          }
+        ++itc;
+        }
+      else if (ec->m_caller == caller)
         {
         itc = el->erase(itc);
         delete ec;
@@ -382,26 +689,17 @@ void OvmsEvents::DeregisterEvent(std::string caller)
         ++itc;
         }
       }
-    if (el->empty())
-      {
-      itm = m_map.erase(itm);
-      delete el;
-      }
-    else
-      {
-      ++itm;
-      }
     }
   }
 
-static void CheckQueueOverflow(const char* from, char* event)
+static void CheckQueueOverflow(const char* from, const char* event)
   {
   EventCallbackEntry* cbe = MyEvents.m_current_callback;
   if (cbe != NULL)
     {
     ESP_LOGE(TAG, "%s: queue overflow (running %s->%s for %" PRIu32 " sec), event '%s' dropped",
       from,
-      MyEvents.m_current_event.c_str(),
+      MyEvents.m_current_event,
       cbe->m_caller.c_str(),
       monotonictime-MyEvents.m_current_started,
       event);
@@ -442,9 +740,10 @@ void OvmsEvents::SignalScheduledEvent(TimerHandle_t timer)
     }
 
   // … and pass on to event task:
+  msg->body.signal.time = esp_timer_get_time();
   if (xQueueSend(MyEvents.m_taskqueue, msg, 0) != pdTRUE)
     {
-    CheckQueueOverflow("SignalScheduledEvent", msg->body.signal.event);
+    CheckQueueOverflow("SignalScheduledEvent", GetQueueSignalName(msg));
     MyEvents.FreeQueueSignalEvent(msg);
     }
 
@@ -508,45 +807,55 @@ bool OvmsEvents::ScheduleEvent(event_queue_t* msg, uint32_t delay_ms)
   return true;
   }
 
-void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn callback /*=NULL*/,
-                             uint32_t delay_ms /*=0*/)
+void OvmsEvents::InitSignal(event_queue_t* msg, const std::string& event)
   {
-  event_queue_t msg;
-  memset(&msg, 0, sizeof(msg));
-
-  msg.type = EVENT_signal;
-  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
-  strcpy(msg.body.signal.event, event.c_str());
-  msg.body.signal.data = data;
-  msg.body.signal.donefn = callback;
+  memset(msg, 0, sizeof(*msg));
+  msg->type = EVENT_signal;
+  msg->body.signal.id = GetEventId(event, false);
+  if (msg->body.signal.id == EVENT_ID_NONE)
+    {
+    // Not interned = no specific listeners; pass the name for "*" & scripts:
+    msg->body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
+    strcpy(msg->body.signal.event, event.c_str());
+    }
+  }
 
+void OvmsEvents::QueueSignal(event_queue_t* msg, uint32_t delay_ms)
+  {
   if (delay_ms == 0)
     {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
+    msg->body.signal.time = esp_timer_get_time();
+    if (xQueueSend(m_taskqueue, msg, 0) != pdTRUE)
       {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
+      CheckQueueOverflow("SignalEvent", GetQueueSignalName(msg));
+      FreeQueueSignalEvent(msg);
       }
     }
   else
     {
-    if (ScheduleEvent(&msg, delay_ms) != true)
+    if (ScheduleEvent(msg, delay_ms) != true)
       {
-      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
+      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped", GetQueueSignalName(msg));
+      FreeQueueSignalEvent(msg);
       }
     }
   }
 
-void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
+void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn callback /*=NULL*/,
                              uint32_t delay_ms /*=0*/)
   {
   event_queue_t msg;
-  memset(&msg, 0, sizeof(msg));
+  InitSignal(&msg, event);
+  msg.body.signal.data = data;
+  msg.body.signal.donefn = callback;
+  QueueSignal(&msg, delay_ms);
+  }
 
-  msg.type = EVENT_signal;
-  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
-  strcpy(msg.body.signal.event, event.c_str());
+void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_queue_t msg;
+  InitSignal(&msg, event);
   if (data != NULL)
     {
     msg.body.signal.data = ExternalRamMalloc(length);
@@ -558,23 +867,35 @@ void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
     msg.body.signal.data = NULL;
     msg.body.signal.donefn = NULL;
     }
+  QueueSignal(&msg, delay_ms);
+  }
 
-  if (delay_ms == 0)
-    {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
-      {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
-      }
-    }
-  else
+void OvmsEvents::SignalEvent(event_id_t id, void* data, event_signal_done_fn callback /*=NULL*/,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_queue_t msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.type = EVENT_signal;
+  msg.body.signal.id = id;
+  msg.body.signal.data = data;
+  msg.body.signal.donefn = callback;
+  QueueSignal(&msg, delay_ms);
+  }
+
+void OvmsEvents::SignalEvent(event_id_t id, void* data, size_t length,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_queue_t msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.type = EVENT_signal;
+  msg.body.signal.id = id;
+  if (data != NULL)
     {
-    if (ScheduleEvent(&msg, delay_ms) != true)
-      {
-      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
-      }
+    msg.body.signal.data = ExternalRamMalloc(length);
+    memcpy(msg.body.signal.data, data, length);
+    msg.body.signal.donefn = EventStdFree;
     }
+  QueueSignal(&msg, delay_ms);
   }
 
 #if ESP_IDF_VERSION_MAJOR >= 4
@@ -783,12 +1104,16 @@ void OvmsEvents::SignalSystemEvent(system_event_t *event)
 
 #endif
 
-EventCallbackEntry::EventCallbackEntry(std::string caller, EventCallback callback)
+EventCallbackEntry::EventCallbackEntry(std::string caller, EventNameCallback callback)
   {
   m_caller = caller;
   m_callback = callback;
+  m_profile = NULL;
+  m_removed = false;
   }
 
 EventCallbackEntry::~EventCallbackEntry()
   {
+  if (m_profile)
+    free(m_profile);
   }
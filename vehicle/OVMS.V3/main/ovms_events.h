@@ -35,6 +35,7 @@
 #include <functional>
 #include <map>
 #include <list>
+#include <vector>
 #include "esp_idf_version.h"
 #if ESP_IDF_VERSION_MAJOR >= 4
 #include <esp_event.h>
@@ -48,27 +49,68 @@
 #include "ovms_command.h"
 #include "ovms_mutex.h"
 
-typedef std::function<void(std::string,void*)> EventCallback;
+// Event names are interned to small integer IDs on registration (or by
+// GetEventId()), signals of interned events carry the ID and are dispatched
+// by table lookup without allocations. Uninterned names have no specific
+// listeners and are passed on as a heap copy.
+typedef uint16_t event_id_t;
+#define EVENT_ID_NONE             0xffff
+#define EVENT_ID_MAX              1024    // Max number of interned event names
+#define EVENT_ID_CHUNK            64      // Name table allocation chunk size
+
+#define EVENT_PROFILE_BUCKETS     20      // Histogram: [0,2), [2,4), … [2^19,∞) µs
+
+typedef std::function<void(const char*,void*)> EventNameCallback;
+typedef std::function<void(std::string,void*)> EventCallback;   // legacy, see RegisterEvent()
+
+// Execution time statistics, allocated on first use:
+struct EventProfile
+  {
+  uint32_t count;
+  uint32_t max;                         // [µs]
+  uint64_t total;                       // [µs]
+  uint32_t hist[EVENT_PROFILE_BUCKETS]; // log2 buckets of [µs]
+
+  void Add(uint32_t us)
+    {
+    count++;
+    total += us;
+    if (us > max) max = us;
+    int b = (us < 2) ? 0 : 31 - __builtin_clz(us);
+    hist[(b < EVENT_PROFILE_BUCKETS) ? b : EVENT_PROFILE_BUCKETS-1]++;
+    }
+  };
 
 class EventCallbackEntry
   {
   public:
-    EventCallbackEntry(std::string caller, EventCallback callback);
+    EventCallbackEntry(std::string caller, EventNameCallback callback);
     virtual ~EventCallbackEntry();
 
   public:
     std::string m_caller;
-    EventCallback m_callback;
+    EventNameCallback m_callback;
+    EventProfile* m_profile;
+    bool m_removed;                       // Deregistered while dispatching, freed after
   };
 
 typedef std::list<EventCallbackEntry*> EventCallbackList;
 
-class EventMap : public  std::map<std::string, EventCallbackList*>
+// Interned event; entries are never freed, so name pointers stay valid:
+class EventEntry
   {
   public:
-    bool GetCompletion(OvmsWriter* writer, const char* token) const;
+    EventEntry(const std::string& name) : m_name(name), m_script_profile(NULL) {}
+
+  public:
+    std::string m_name;
+    EventCallbackList m_callbacks;
+    EventProfile* m_script_profile;
   };
 
+typedef std::map<std::string, event_id_t> EventIdMap;
+typedef std::vector< std::pair<EventCallbackList*, EventCallbackEntry*> > EventCallbackRemovals;
+
 typedef void (*event_signal_done_fn)(const char* event, void* data);
 
 extern void EventStdFree(const char* event, void* data);
@@ -85,9 +127,11 @@ typedef struct
     {
     struct
       {
-      char* event;
+      char* event;                        // Uninterned name (heap copy) or NULL
       void* data;
       event_signal_done_fn donefn;
+      uint32_t time;                      // Queue time [µs] (for the dispatch lag)
+      event_id_t id;                      // Interned event or EVENT_ID_NONE
       } signal;
     } body;
   event_msg_t type;
@@ -104,28 +148,59 @@ class OvmsEvents
 
   public:
     void RegisterEvent(std::string caller, std::string event, EventCallback callback);
+    void RegisterEventCallback(std::string caller, std::string event, EventNameCallback callback);
     void DeregisterEvent(std::string caller);
     void SignalEvent(std::string event, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0);
     void SignalEvent(std::string event, void* data, size_t length, uint32_t delay_ms = 0);
+    void SignalEvent(event_id_t id, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0);
+    void SignalEvent(event_id_t id, void* data, size_t length, uint32_t delay_ms = 0);
+
+  public:
+    event_id_t GetEventId(const std::string& event, bool create=true);
+    const char* GetEventName(event_id_t id);
+    const EventCallbackList* GetEventListeners(event_id_t id);
+    int GetEventCount() { return m_event_count; }
+    void ListEvents(OvmsWriter* writer, const char* filter=NULL);
+    bool GetCompletion(OvmsWriter* writer, const char* token);
+    void ShowProfile(OvmsWriter* writer, const char* filter=NULL, bool histogram=false);
+    void ResetProfile() { m_profile_reset = true; }
 
   public:
     void EventTask();
     void HandleQueueSignalEvent(event_queue_t* msg);
     void FreeQueueSignalEvent(event_queue_t* msg);
+    static const char* GetQueueSignalName(const event_queue_t* msg);
 #if ESP_IDF_VERSION_MAJOR >= 4
     static void ReceiveSystemEvent(void* handler_args, esp_event_base_t base, int32_t id, void* event_data);
 #else
     static esp_err_t ReceiveSystemEvent(void *ctx, system_event_t *event);
     void SignalSystemEvent(system_event_t *event);
 #endif
-    const EventMap& Map() { return m_map; }
+
+  protected:
+    EventEntry* GetEntry(event_id_t id)
+      {
+      return (id < m_event_count) ? m_events[id / EVENT_ID_CHUNK][id % EVENT_ID_CHUNK] : NULL;
+      }
+    void InitSignal(event_queue_t* msg, const std::string& event);
+    void QueueSignal(event_queue_t* msg, uint32_t delay_ms);
+    void DispatchSignal(EventCallbackList* el, void* data);
+    void PurgeRemoved();
+    void ProfileAdd(EventProfile** profile, uint32_t us, const char* caller);
+    void ProfileReset();
+    void UpdateMetrics(const char* event, void* data);
 
   protected:
     bool ScheduleEvent(event_queue_t* msg, uint32_t delay_ms);
     static void SignalScheduledEvent(TimerHandle_t timer);
 
   protected:
-    EventMap m_map;
+    EventEntry** m_events[EVENT_ID_MAX / EVENT_ID_CHUNK]; // Name table, indexed by ID
+    volatile event_id_t m_event_count;
+    EventIdMap m_event_ids;                 // Name lookup
+    OvmsMutex m_events_mutex;               // Protects table, lookup & callback lists
+    EventEntry* m_event_any;                // "*" listeners
+    EventCallbackRemovals m_removed;        // Deregistered by a running handler
     TimerList m_timers;
     TimerStatusMap m_timer_active;
     OvmsMutex m_timers_mutex;
@@ -138,9 +213,19 @@ class OvmsEvents
     TaskHandle_t m_taskid;
     QueueHandle_t m_taskqueue;
 
+  protected:
+    EventProfile m_lag;                     // Signal to dispatch lag
+    EventProfile m_script_other;            // Scripts of uninterned events
+    int m_queue_hwm;                        // Queue depth high water mark
+    int m_interval_queue_hwm;               // … for the metrics update interval
+    uint32_t m_interval_lag_max;
+    uint32_t m_interval_handler_max;
+    char m_interval_handler[48];            // Slowest handler "<event>:<caller>"
+    volatile bool m_profile_reset;
+
   public:
     EventCallbackEntry* m_current_callback;
-    std::string m_current_event;
+    const char* m_current_event;
     uint32_t m_current_started;
   };
 
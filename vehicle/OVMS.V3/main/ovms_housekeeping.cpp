@@ -70,6 +70,10 @@ static const char *TAG = "housekeeping";
 
 static int tick = 0;
 
+// Ticker event IDs, interned on init to signal them without name lookups:
+enum { TICKER_1, TICKER_10, TICKER_60, TICKER_300, TICKER_600, TICKER_3600, TICKER_COUNT };
+static event_id_t ticker_event[TICKER_COUNT];
+
 void HousekeepingUpdate12V()
   {
 #ifdef CONFIG_OVMS_COMP_ADC
@@ -108,25 +112,25 @@ void HousekeepingTicker1( TimerHandle_t timer )
   StandardMetrics.ms_m_timeutc->SetValue(time(NULL));
 
   HousekeepingUpdate12V();
-  MyEvents.SignalEvent("ticker.1", NULL);
+  MyEvents.SignalEvent(ticker_event[TICKER_1], NULL);
 
   tick++;
   if ((tick % 10)==0)
     {
-    MyEvents.SignalEvent("ticker.10", NULL);
+    MyEvents.SignalEvent(ticker_event[TICKER_10], NULL);
     if ((tick % 60)==0)
       {
-      MyEvents.SignalEvent("ticker.60", NULL);
+      MyEvents.SignalEvent(ticker_event[TICKER_60], NULL);
       if ((tick % 300)==0)
         {
-        MyEvents.SignalEvent("ticker.300", NULL);
+        MyEvents.SignalEvent(ticker_event[TICKER_300], NULL);
         if ((tick % 600)==0)
           {
-          MyEvents.SignalEvent("ticker.600", NULL);
+          MyEvents.SignalEvent(ticker_event[TICKER_600], NULL);
           if ((tick % 3600)==0)
             {
             tick = 0;
-            MyEvents.SignalEvent("ticker.3600", NULL);
+            MyEvents.SignalEvent(ticker_event[TICKER_3600], NULL);
             }
           }
         }
@@ -158,13 +162,20 @@ Housekeeping::Housekeeping()
   MyConfig.RegisterParam("system.adc", "ADC configuration", true, true);
   MyConfig.RegisterParam("auto", "Auto init configuration", true, true);
 
+  ticker_event[TICKER_1] = MyEvents.GetEventId("ticker.1");
+  ticker_event[TICKER_10] = MyEvents.GetEventId("ticker.10");
+  ticker_event[TICKER_60] = MyEvents.GetEventId("ticker.60");
+  ticker_event[TICKER_300] = MyEvents.GetEventId("ticker.300");
+  ticker_event[TICKER_600] = MyEvents.GetEventId("ticker.600");
+  ticker_event[TICKER_3600] = MyEvents.GetEventId("ticker.3600");
+
   // Register our events
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
   MyEvents.RegisterEvent(TAG,"housekeeping.init", std::bind(&Housekeeping::Init, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.10", std::bind(&Housekeeping::Metrics, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.300", std::bind(&Housekeeping::TimeLogger, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.10", std::bind(&Housekeeping::Metrics, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.300", std::bind(&Housekeeping::TimeLogger, this, _1, _2));
 
   // Fire off the event that causes us to be called back in Events tasks context
   MyEvents.SignalEvent("housekeeping.init", NULL);
@@ -265,10 +276,10 @@ void Housekeeping::Init(std::string event, void* data)
 
   MyEvents.SignalEvent("system.start",NULL);
 
-  Metrics(event,data); // Causes the metrics to be produced
+  Metrics(event.c_str(),data); // Causes the metrics to be produced
   }
 
-void Housekeeping::Metrics(std::string event, void* data)
+void Housekeeping::Metrics(const char* event, void* data)
   {
   OvmsMetricInt* m2 = StandardMetrics.ms_m_tasks;
   if (m2 == NULL)
@@ -300,7 +311,7 @@ void Housekeeping::Metrics(std::string event, void* data)
     }
   }
 
-void Housekeeping::TimeLogger(std::string event, void* data)
+void Housekeeping::TimeLogger(const char* event, void* data)
   {
   time_t rawtime;
   time ( &rawtime );
@@ -45,8 +45,8 @@ class Housekeeping
 
   public:
     void Init(std::string event, void* data);
-    void Metrics(std::string event, void* data);
-    void TimeLogger(std::string event, void* data);
+    void Metrics(const char* event, void* data);
+    void TimeLogger(const char* event, void* data);
 
   protected:
     TimerHandle_t m_timer1;
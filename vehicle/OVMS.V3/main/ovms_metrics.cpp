@@ -38,6 +38,8 @@ static const char *TAG = "metrics";
 #include <map>
 #include "ovms.h"
 #include "ovms_metrics.h"
+#include "ovms_metrics_snapshot.h"
+#include "ovms_metrics_history.h"
 #include "ovms_command.h"
 #include "ovms_events.h"
 #include "ovms_script.h"
@@ -635,12 +637,22 @@ void metrics_persist(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
   {
   if (argc > 0)
     {
-    if (strcmp(argv[0], "-r") != 0)
+    if (strcmp(argv[0], "-r") == 0)
+      {
+      pmetrics.magic = 0;
+      }
+    else if (strcmp(argv[0], "-s") == 0)
+      {
+      if (MyMetricsFlashStore.Save(true))
+        writer->puts("Flash tier saved");
+      else
+        writer->puts("ERROR: flash tier save failed");
+      }
+    else
       {
       cmd->PutUsage(writer);
       return;
       }
-    pmetrics.magic = 0;
     }
   if (pmetrics.magic != PERSISTENT_METRICS_MAGIC)
     writer->puts("Persistent metrics will be reset on the next boot");
@@ -650,6 +662,40 @@ void metrics_persist(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
     writer->printf("%s caused reset, ", pmetrics_reason);
   writer->printf("%d bytes, and ", pmetrics.size);
   writer->printf("%d of %d slots used\n", pmetrics.used, NUM_PERSISTENT_VALUES);
+  MyMetricsFlashStore.Status(writer);
+  }
+
+void metrics_history(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (argc > 0 && strcmp(argv[0], "-f") == 0)
+    {
+    if (MyMetricsHistory.Flush())
+      writer->puts("History flushed");
+    else
+      writer->puts("ERROR: history flush failed");
+    argc--;
+    argv++;
+    }
+  if (argc == 0)
+    {
+    MyMetricsHistory.Status(writer);
+    return;
+    }
+
+  uint32_t from = (argc > 1) ? OvmsMetricsHistory::ResolveTime(atol(argv[1])) : 0;
+  uint32_t to = (argc > 2) ? OvmsMetricsHistory::ResolveTime(atol(argv[2])) : time(NULL);
+  uint32_t step = (argc > 3) ? atol(argv[3]) : 0;
+  MetricsHistorySamples samples;
+  int cnt = MyMetricsHistory.Query(argv[0], from, to, step, samples);
+  if (cnt < 0)
+    {
+    writer->puts("Metric not recorded");
+    return;
+    }
+  for (auto &sample : samples)
+    writer->printf("%" PRIu32 ",%.7g\n", sample.time, sample.value);
+  if (cnt == 0)
+    writer->puts("No samples in time range");
   }
 
 static int metrics_set_validate(OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv, bool complete)
@@ -932,6 +978,33 @@ static duk_ret_t DukOvmsMetricAge(duk_context *ctx)
   return 1;
   }
 
+// Parse optional ([unit] [,decode]) arguments starting at arg_idx
+static metric_unit_t DukOvmsMetricValueArgs(duk_context *ctx, duk_idx_t arg_idx, bool &decode, bool &has_unit)
+  {
+  const char *un =  NULL;
+  decode = true;
+  has_unit = false;
+  if (duk_check_type_mask(ctx, arg_idx, DUK_TYPE_MASK_BOOLEAN))
+    decode = duk_opt_boolean(ctx, arg_idx, true);
+  else
+    {
+    un = duk_opt_string(ctx, arg_idx, NULL);
+    decode = duk_opt_boolean(ctx, arg_idx+1, true);
+    has_unit = un != NULL;
+    }
+  return OvmsMetricUnitFromName(un);
+  }
+
+static void DukOvmsMetricPushValue(DukContext &dc, OvmsMetric *m, metric_unit_t unit, bool decode, bool has_unit)
+  {
+  if (decode)
+    m->DukPush(dc, unit);
+  else if (has_unit)
+    dc.Push(m->AsUnitString("", unit));
+  else
+    dc.Push(m->AsString(""));
+  }
+
 static duk_ret_t DukOvmsMetricValue(duk_context *ctx)
   {
   DukContext dc(ctx);
@@ -939,27 +1012,12 @@ static duk_ret_t DukOvmsMetricValue(duk_context *ctx)
   OvmsMetric *m = MyMetrics.Find(mn);
   if (!m)
     return 0;
-  bool decode = true;
-  const char *un =  NULL;
-  bool has_unit = false;
-  if (duk_check_type_mask(ctx, 1, DUK_TYPE_MASK_BOOLEAN))
-    decode = duk_opt_boolean(ctx, 1, true);
-  else
-    {
-    un = duk_opt_string(ctx, 1, NULL);
-    decode = duk_opt_boolean(ctx, 2, true);
-    has_unit = un != NULL;
-    }
-  metric_unit_t unit = OvmsMetricUnitFromName(un);
+  bool decode, has_unit;
+  metric_unit_t unit = DukOvmsMetricValueArgs(ctx, 1, decode, has_unit);
 
   if (m && unit != UnitNotFound)
     {
-    if (decode)
-      m->DukPush(dc, unit);
-    else if (has_unit)
-      dc.Push(m->AsUnitString("", unit));
-    else
-      dc.Push(m->AsString(""));
+    DukOvmsMetricPushValue(dc, m, unit, decode, has_unit);
     return 1;  /* one return value */
     }
   else
@@ -994,35 +1052,51 @@ static duk_ret_t DukOvmsMetricFloat(duk_context *ctx)
     return 0;
   }
 
+static duk_ret_t DukOvmsMetricHistory(duk_context *ctx)
+  {
+  const char *mn = duk_to_string(ctx,0);
+  uint32_t from = duk_is_null_or_undefined(ctx,1)
+    ? 0 : OvmsMetricsHistory::ResolveTime(duk_to_number(ctx,1));
+  uint32_t to = duk_is_null_or_undefined(ctx,2)
+    ? time(NULL) : OvmsMetricsHistory::ResolveTime(duk_to_number(ctx,2));
+  uint32_t step = duk_opt_uint(ctx,3,0);
+  MetricsHistorySamples samples;
+  if (MyMetricsHistory.Query(mn, from, to, step, samples) < 0)
+    return 0;
+
+  // { time: [...], value: [...] }
+  duk_idx_t obj_idx = duk_push_object(ctx);
+  duk_idx_t arr_idx = duk_push_array(ctx);
+  for (size_t i = 0; i < samples.size(); i++)
+    {
+    duk_push_uint(ctx, samples[i].time);
+    duk_put_prop_index(ctx, arr_idx, i);
+    }
+  duk_put_prop_string(ctx, obj_idx, "time");
+  arr_idx = duk_push_array(ctx);
+  for (size_t i = 0; i < samples.size(); i++)
+    {
+    duk_push_number(ctx, float2double(samples[i].value));
+    duk_put_prop_index(ctx, arr_idx, i);
+    }
+  duk_put_prop_string(ctx, obj_idx, "value");
+  return 1;  /* one return value */
+  }
+
 static duk_ret_t DukOvmsMetricGetValues(duk_context *ctx)
   {
   OvmsMetric *m;
   DukContext dc(ctx);
 
-  bool has_unit = false;
-  bool decode = true;
-  const char *un =  NULL;
-  if (duk_check_type_mask(ctx, 1, DUK_TYPE_MASK_BOOLEAN))
-    decode = duk_opt_boolean(ctx, 1, true);
-  else
-    {
-    un = duk_opt_string(ctx, 1, NULL);
-    has_unit = un != NULL;
-    decode = duk_opt_boolean(ctx, 2, true);
-    }
-  metric_unit_t unit = OvmsMetricUnitFromName(un);
+  bool decode, has_unit;
+  metric_unit_t unit = DukOvmsMetricValueArgs(ctx, 1, decode, has_unit);
 
   duk_idx_t obj_idx = dc.PushObject();
 
   // helper: set object property from metric
   auto set_metric = [&dc, obj_idx, decode, unit, has_unit](OvmsMetric *m)
     {
-    if (decode)
-      m->DukPush(dc, unit);
-    else if (has_unit)
-      dc.Push(m->AsUnitString("", unit));
-    else
-      dc.Push(m->AsString());
+    DukOvmsMetricPushValue(dc, m, unit, decode, has_unit);
     dc.PutProp(obj_idx, m->m_name);
     };
 
@@ -1064,12 +1138,363 @@ static duk_ret_t DukOvmsMetricGetValues(duk_context *ctx)
   return 1;
   }
 
+////////////////////////////////////////////////////////////////////////////////
+// DuktapeMetricHandle: pre-resolved metric reference for scripts
+//
+// Javascript API:
+//   var h = OvmsMetrics.GetHandle("v.b.soc");
+//   h.name, h.Value([unit] [,decode]), h.AsFloat([unit]), h.AsJSON(),
+//   h.HasValue(), h.IsStale(), h.IsFresh(), h.Age()
+//   h.Subscribe(function(h) { … }), h.Unsubscribe()
+//   var list = OvmsMetrics.GetHandles(["v.b.soc", "v.b.voltage", …]);
+//   var values = OvmsMetrics.ReadHandles(list [,unit] [,decode]);
+//
+// The handle keeps the OvmsMetric pointer, so accessing the value does not need
+// a name lookup. The pointer is revalidated by name only after a metric has been
+// (de)registered (see OvmsMetrics::m_generation). Handles may be created for
+// metrics not yet registered, they then return undefined until the metric exists.
+//
+// Change notifications are delivered via the Duktape task queue. Only one
+// notification per handle is queued at a time, so a high frequency metric
+// cannot flood the queue; the callback reads the current value.
+
+class DuktapeMetricHandle : public DuktapeObject
+  {
+  public:
+    DuktapeMetricHandle(duk_context *ctx, int obj_idx, const char* name);
+    ~DuktapeMetricHandle();
+    static duk_idx_t Create(duk_context *ctx, const char* name);
+    static DuktapeMetricHandle* GetHandle(duk_context *ctx, duk_idx_t obj_idx);
+    static DuktapeMetricHandle* GetThis(duk_context *ctx);
+
+  public:
+    OvmsMetric* GetMetric();
+    void Subscribe(duk_context *ctx);
+    void Unsubscribe(duk_context *ctx);
+    duk_ret_t CallMethod(duk_context *ctx, const char* method, void* data=NULL) override;
+
+  protected:
+    void Finalize(duk_context *ctx, bool heapDestruct) override;
+    void MetricModified(OvmsMetric* metric);
+
+  protected:
+    std::string m_name;
+    OvmsMetric* m_metric;
+    unsigned int m_generation;
+    std::string m_caller;             // metric listener id if subscribed
+    std::atomic_bool m_pending;       // change notification queued
+  };
+
+DuktapeMetricHandle::DuktapeMetricHandle(duk_context *ctx, int obj_idx, const char* name)
+  : DuktapeObject(ctx, obj_idx)
+  {
+  m_name = name;
+  m_generation = MyMetrics.m_generation;
+  m_metric = MyMetrics.Find(name);
+  m_pending = false;
+  }
+
+DuktapeMetricHandle::~DuktapeMetricHandle()
+  {
+  if (!m_caller.empty())
+    MyMetrics.DeregisterListener(m_caller);
+  }
+
+OvmsMetric* DuktapeMetricHandle::GetMetric()
+  {
+  unsigned int generation = MyMetrics.m_generation;
+  if (m_generation != generation)
+    {
+    m_metric = MyMetrics.Find(m_name.c_str());
+    m_generation = generation;
+    }
+  return m_metric;
+  }
+
+void DuktapeMetricHandle::Subscribe(duk_context *ctx)
+  {
+  Lock();
+  if (!m_caller.empty())
+    {
+    Unlock();
+    return;
+    }
+  char caller[32];
+  snprintf(caller, sizeof(caller), "duktape.mh.%p", this);
+  m_caller = caller;
+  // prevent garbage collection while subscribed:
+  Register(ctx);
+  Unlock();
+  // NotifyModified() locks us (RequestCallback) while holding the listener
+  // lock, so the listener must not be (de)registered with our lock held:
+  MyMetrics.RegisterListener(caller, m_name, [this](OvmsMetric* metric) { MetricModified(metric); });
+  }
+
+void DuktapeMetricHandle::Unsubscribe(duk_context *ctx)
+  {
+  Lock();
+  if (m_caller.empty())
+    {
+    Unlock();
+    return;
+    }
+  std::string caller = m_caller;
+  m_caller.clear();
+  if (ctx)
+    Deregister(ctx);
+  Unlock();
+  MyMetrics.DeregisterListener(caller);
+  }
+
+void DuktapeMetricHandle::MetricModified(OvmsMetric* metric)
+  {
+  // coalesce notifications until the callback has been processed:
+  if (!m_pending.exchange(true))
+    RequestCallback("onchange");
+  }
+
+void DuktapeMetricHandle::Finalize(duk_context *ctx, bool heapDestruct)
+  {
+  Unsubscribe(heapDestruct ? NULL : ctx);
+  DuktapeObject::Finalize(ctx, heapDestruct);
+  }
+
+duk_ret_t DuktapeMetricHandle::CallMethod(duk_context *ctx, const char* method, void* data /*=NULL*/)
+  {
+  if (!ctx)
+    {
+    RequestCallback(method, data);
+    return 0;
+    }
+  // Hold the lock only while fetching the JS object, not during the JS call:
+  // the callback may (un)subscribe, which takes the metrics listener lock.
+  // The object stays alive while it is on the value stack.
+  duk_require_stack(ctx, 4);
+  int entry_top = duk_get_top(ctx);
+  int obj_idx;
+    {
+    OvmsRecMutexLock lock(&m_mutex);
+    m_pending = false;
+    if (!IsCoupled() || m_caller.empty()) return 0;
+    obj_idx = Push(ctx);
+    }
+  if (duk_get_prop_string(ctx, obj_idx, DUK_HIDDEN_SYMBOL("onchange")) && duk_is_callable(ctx, -1))
+    {
+    duk_dup(ctx, obj_idx);  // this
+    duk_dup(ctx, obj_idx);  // arg: handle
+    if (duk_pcall_method(ctx, 1) != 0)
+      DukOvmsErrorHandler(ctx, -1);
+    }
+  duk_pop_n(ctx, duk_get_top(ctx) - entry_top);
+  return 0;
+  }
+
+DuktapeMetricHandle* DuktapeMetricHandle::GetHandle(duk_context *ctx, duk_idx_t obj_idx)
+  {
+  if (!duk_is_object(ctx, obj_idx))
+    return NULL;
+  duk_require_stack(ctx, 1);
+  bool is_handle = duk_get_prop_string(ctx, obj_idx, DUK_HIDDEN_SYMBOL("metricHandle"));
+  duk_pop(ctx);
+  return is_handle ? (DuktapeMetricHandle*) GetInstance(ctx, obj_idx) : NULL;
+  }
+
+DuktapeMetricHandle* DuktapeMetricHandle::GetThis(duk_context *ctx)
+  {
+  duk_push_this(ctx);
+  DuktapeMetricHandle* handle = GetHandle(ctx, -1);
+  duk_pop(ctx);
+  if (!handle)
+    duk_error(ctx, DUK_ERR_TYPE_ERROR, "not a metric handle");
+  return handle;
+  }
+
+static duk_ret_t DukOvmsMetricHandleValue(duk_context *ctx)
+  {
+  DukContext dc(ctx);
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  bool decode, has_unit;
+  metric_unit_t unit = DukOvmsMetricValueArgs(ctx, 0, decode, has_unit);
+  if (!m || unit == UnitNotFound)
+    return 0;
+  DukOvmsMetricPushValue(dc, m, unit, decode, has_unit);
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleFloat(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  metric_unit_t unit = OvmsMetricUnitFromName(duk_opt_string(ctx,0,NULL));
+  if (!m || unit == UnitNotFound)
+    return 0;
+  duk_push_number(ctx, float2double(m->AsFloat(0, unit)));
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleJSON(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  if (!m)
+    return 0;
+  duk_push_string(ctx, m->AsJSON().c_str());
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleHasValue(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  if (!m)
+    return 0;
+  duk_push_boolean(ctx, m->IsDefined());
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleIsStale(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  if (!m)
+    return 0;
+  duk_push_boolean(ctx, m->IsStale());
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleIsFresh(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  if (!m)
+    return 0;
+  duk_push_boolean(ctx, m->IsFresh());
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleAge(duk_context *ctx)
+  {
+  OvmsMetric *m = DuktapeMetricHandle::GetThis(ctx)->GetMetric();
+  if (!m)
+    return 0;
+  duk_push_uint(ctx, m->Age());
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricHandleSubscribe(duk_context *ctx)
+  {
+  duk_require_function(ctx, 0);
+  DuktapeMetricHandle* handle = DuktapeMetricHandle::GetThis(ctx);
+  duk_push_this(ctx);
+  duk_dup(ctx, 0);
+  duk_put_prop_string(ctx, -2, DUK_HIDDEN_SYMBOL("onchange"));
+  duk_pop(ctx);
+  handle->Subscribe(ctx);
+  return 0;
+  }
+
+static duk_ret_t DukOvmsMetricHandleUnsubscribe(duk_context *ctx)
+  {
+  DuktapeMetricHandle* handle = DuktapeMetricHandle::GetThis(ctx);
+  handle->Unsubscribe(ctx);
+  duk_push_this(ctx);
+  duk_del_prop_string(ctx, -1, DUK_HIDDEN_SYMBOL("onchange"));
+  duk_pop(ctx);
+  return 0;
+  }
+
+/**
+ * Create: push a new handle object for metric <name>
+ *  The handle prototype is created on first use and kept in the global stash.
+ *  Stack: [ … ] → [ … handle ]
+ */
+duk_idx_t DuktapeMetricHandle::Create(duk_context *ctx, const char* name)
+  {
+  duk_require_stack(ctx, 4);
+  duk_idx_t obj_idx = duk_push_object(ctx);
+
+  duk_push_global_stash(ctx);
+  if (!duk_get_prop_string(ctx, -1, DUK_HIDDEN_SYMBOL("metricHandleProto")))
+    {
+    duk_pop(ctx);
+    static const duk_function_list_entry methods[] =
+      {
+      { "Value", DukOvmsMetricHandleValue, 2 },
+      { "AsFloat", DukOvmsMetricHandleFloat, 1 },
+      { "AsJSON", DukOvmsMetricHandleJSON, 0 },
+      { "HasValue", DukOvmsMetricHandleHasValue, 0 },
+      { "IsStale", DukOvmsMetricHandleIsStale, 0 },
+      { "IsFresh", DukOvmsMetricHandleIsFresh, 0 },
+      { "Age", DukOvmsMetricHandleAge, 0 },
+      { "Subscribe", DukOvmsMetricHandleSubscribe, 1 },
+      { "Unsubscribe", DukOvmsMetricHandleUnsubscribe, 0 },
+      { NULL, NULL, 0 }
+      };
+    duk_push_object(ctx);
+    duk_put_function_list(ctx, -1, methods);
+    duk_dup(ctx, -1);
+    duk_put_prop_string(ctx, -3, DUK_HIDDEN_SYMBOL("metricHandleProto"));
+    }
+  duk_set_prototype(ctx, obj_idx);
+  duk_pop(ctx); // global stash
+
+  duk_push_true(ctx);
+  duk_put_prop_string(ctx, obj_idx, DUK_HIDDEN_SYMBOL("metricHandle"));
+  duk_push_string(ctx, name);
+  duk_put_prop_string(ctx, obj_idx, "name");
+
+  new DuktapeMetricHandle(ctx, obj_idx, name);
+  return obj_idx;
+  }
+
+static duk_ret_t DukOvmsMetricGetHandle(duk_context *ctx)
+  {
+  DuktapeMetricHandle::Create(ctx, duk_require_string(ctx, 0));
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricGetHandles(duk_context *ctx)
+  {
+  duk_require_object(ctx, 0);
+  duk_idx_t arr_idx = duk_push_array(ctx);
+  for (int i=0; duk_get_prop_index(ctx, 0, i); i++)
+    {
+    DuktapeMetricHandle::Create(ctx, duk_to_string(ctx, -1));
+    duk_put_prop_index(ctx, arr_idx, i);
+    duk_pop(ctx);
+    }
+  duk_pop(ctx);
+  return 1;
+  }
+
+static duk_ret_t DukOvmsMetricReadHandles(duk_context *ctx)
+  {
+  DukContext dc(ctx);
+  duk_require_object(ctx, 0);
+  bool decode, has_unit;
+  metric_unit_t unit = DukOvmsMetricValueArgs(ctx, 1, decode, has_unit);
+  if (unit == UnitNotFound)
+    return 0;
+
+  duk_idx_t arr_idx = duk_push_array(ctx);
+  for (int i=0; duk_get_prop_index(ctx, 0, i); i++)
+    {
+    DuktapeMetricHandle* handle = DuktapeMetricHandle::GetHandle(ctx, -1);
+    OvmsMetric *m = handle ? handle->GetMetric() : NULL;
+    duk_pop(ctx);
+    if (m)
+      DukOvmsMetricPushValue(dc, m, unit, decode, has_unit);
+    else
+      duk_push_undefined(ctx);
+    duk_put_prop_index(ctx, arr_idx, i);
+    }
+  duk_pop(ctx);
+  return 1;
+  }
+
 #endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
 MetricCallbackEntry::MetricCallbackEntry(std::string caller, MetricCallback callback)
   {
   m_caller = caller;
   m_callback = callback;
+  m_refs = 1;
+  m_removed = false;
   }
 
 MetricCallbackEntry::~MetricCallbackEntry()
@@ -1083,6 +1508,9 @@ OvmsMetrics::OvmsMetrics()
   m_nextmodifier = 1;
   m_first = NULL;
   m_trace = false;
+  m_generation = 0;
+  for (int i = 0; i < METRICS_NOTIFY_TASKS; i++)
+    m_notifying[i] = NULL;
 
   // Register our commands
   OvmsCommand* cmd_metric = MyCommandApp.RegisterCommand("metrics","METRICS framework");
@@ -1096,8 +1524,15 @@ OvmsMetrics::OvmsMetrics()
       "-p = display only persistent metrics\n"
       "-s = show metric staleness\n"
       "-t = display non-printing characters and tabs in string metrics" , 0, 2);
-  cmd_metric->RegisterCommand("persist","Show persistent metrics info", metrics_persist, "[-r]\n"
-      "-r = reset persistent metrics", 0, 1);
+  cmd_metric->RegisterCommand("persist","Show persistent metrics info", metrics_persist, "[-r|-s]\n"
+      "-r = reset persistent metrics\n"
+      "-s = save flash tier now", 0, 1);
+  cmd_metric->RegisterCommand("history","Show metrics history info or query samples", metrics_history,
+      "[-f] [<metric> [<from> [<to> [<step>]]]]\n"
+      "-f = flush history to storage now\n"
+      "<metric> = output samples as CSV (UTC seconds,value)\n"
+      "<from>, <to> = UTC seconds, 0 / negative = seconds before now, default all\n"
+      "<step> = average over <step> seconds, default 0 = raw samples", 0, 5);
   cmd_metric->RegisterCommand("set","Set the value of a metric",metrics_set, "<metric> <value> [<unit>]", 2, 3, true, metrics_set_validate);
 
   cmd_metric->RegisterCommand("get","Get the value of a metric",metrics_get, "<metric> [<unit>]", 1, 2, true, metrics_get_validate);
@@ -1118,6 +1553,10 @@ OvmsMetrics::OvmsMetrics()
   dto->RegisterDuktapeFunction(DukOvmsMetricJSON, 1, "AsJSON");
   dto->RegisterDuktapeFunction(DukOvmsMetricFloat, 2, "AsFloat");
   dto->RegisterDuktapeFunction(DukOvmsMetricGetValues, 3, "GetValues");
+  dto->RegisterDuktapeFunction(DukOvmsMetricHistory, 4, "History");
+  dto->RegisterDuktapeFunction(DukOvmsMetricGetHandle, 1, "GetHandle");
+  dto->RegisterDuktapeFunction(DukOvmsMetricGetHandles, 1, "GetHandles");
+  dto->RegisterDuktapeFunction(DukOvmsMetricReadHandles, 3, "ReadHandles");
   MyDuktape.RegisterDuktapeObject(dto);
 #endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
@@ -1150,10 +1589,14 @@ OvmsMetrics::~OvmsMetrics()
 
 void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
   {
+  // Note: m_generation is incremented after each list change, so a handle
+  //  that sees the new generation also sees the new list (see GetMetric)
+
   // Quick simple check for if we are the first metric.
   if (m_first == NULL)
     {
     m_first = metric;
+    m_generation++;
     return;
     }
 
@@ -1162,6 +1605,7 @@ void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
     {
     metric->m_next = m_first;
     m_first = metric;
+    m_generation++;
     return;
     }
 
@@ -1171,12 +1615,14 @@ void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
     if (m->m_next == NULL)
       {
       m->m_next = metric;
+      m_generation++;
       return;
       }
     if (strcmp(m->m_next->m_name,metric->m_name)>=0)
       {
       metric->m_next = m->m_next;
       m->m_next = metric;
+      m_generation++;
       return;
       }
     }
@@ -1184,9 +1630,12 @@ void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
 
 void OvmsMetrics::DeregisterMetric(OvmsMetric* metric)
   {
+  // Note: m_generation is incremented after the unlink, before the delete
+
   if (m_first == metric)
     {
     m_first = metric->m_next;
+    m_generation++;
     delete metric;
     return;
     }
@@ -1196,6 +1645,7 @@ void OvmsMetrics::DeregisterMetric(OvmsMetric* metric)
     if (m->m_next == metric)
       {
       m->m_next = metric->m_next;
+      m_generation++;
       delete metric;
       return;
       }
@@ -1380,6 +1830,7 @@ OvmsMetricString* OvmsMetrics::InitString(const char* metric, uint16_t autostale
 
 void OvmsMetrics::RegisterListener(std::string caller, std::string name, MetricCallback callback)
   {
+  OvmsRecMutexLock lock(&m_listeners_mutex);
   auto k = m_listeners.find(name);
   if (k == m_listeners.end())
     {
@@ -1396,38 +1847,92 @@ void OvmsMetrics::RegisterListener(std::string caller, std::string name, MetricC
   ml->push_back(new MetricCallbackEntry(caller,callback));
   }
 
+/**
+ * Listener locking rules:
+ *  - m_listeners_mutex only protects the listener map & lists. It is never held
+ *    while calling a listener, so listeners may take their own locks, block or
+ *    (de)register listeners without lock order issues.
+ *  - NotifyModified() takes a reference on each entry it is going to call, so an
+ *    entry deregistered meanwhile stays valid and is deleted by the last reference.
+ *  - DeregisterListener() returns after all running calls of the entries have
+ *    finished, so the caller may delete the callback's object afterwards. A
+ *    deregistration from within a listener callback does not wait, to avoid
+ *    deadlocking on a running notification.
+ */
 void OvmsMetrics::DeregisterListener(std::string caller)
   {
-  MetricCallbackMap::iterator itm=m_listeners.begin();
-  while (itm!=m_listeners.end())
+  std::vector<MetricCallbackEntry*> removed;
     {
-    MetricCallbackList* ml = itm->second;
-    MetricCallbackList::iterator itc=ml->begin();
-    while (itc!=ml->end())
+    OvmsRecMutexLock lock(&m_listeners_mutex);
+    MetricCallbackMap::iterator itm=m_listeners.begin();
+    while (itm!=m_listeners.end())
       {
-      MetricCallbackEntry* ec = *itc;
-      if (ec->m_caller == caller)
+      MetricCallbackList* ml = itm->second;
+      MetricCallbackList::iterator itc=ml->begin();
+      while (itc!=ml->end())
         {
-        itc = ml->erase(itc);
-        delete ec;
+        MetricCallbackEntry* ec = *itc;
+        if (ec->m_caller == caller)
+          {
+          itc = ml->erase(itc);
+          ec->m_removed = true;
+          removed.push_back(ec);
+          }
+        else
+          {
+          ++itc;
+          }
+        }
+      if (ml->empty())
+        {
+        itm = m_listeners.erase(itm);
+        delete ml;
         }
       else
         {
-        ++itc;
+        ++itm;
         }
       }
-    if (ml->empty())
-      {
-      itm = m_listeners.erase(itm);
-      delete ml;
-      }
-    else
-      {
-      ++itm;
-      }
+    }
+
+  // wait for calls running on other tasks:
+  bool self = IsNotifying(xTaskGetCurrentTaskHandle());
+  for (MetricCallbackEntry* ec : removed)
+    {
+    while (!self && ec->m_refs.load() > 1)
+      vTaskDelay(1);
+    ReleaseListener(ec);
     }
   }
 
+/**
+ * HasNamedListener: check for a listener registered specifically for the metric
+ *  (see RegisterListener). Wildcard listeners and modifier based consumers
+ *  (RegisterModifier: servers, web UI, snapshots) are not considered, as these
+ *  take every metric they are given.
+ */
+bool OvmsMetrics::HasNamedListener(const std::string &name)
+  {
+  OvmsRecMutexLock lock(&m_listeners_mutex);
+  return (m_listeners.find(name) != m_listeners.end());
+  }
+
+bool OvmsMetrics::IsNotifying(TaskHandle_t task)
+  {
+  for (int i = 0; i < METRICS_NOTIFY_TASKS; i++)
+    {
+    if (m_notifying[i].load() == task)
+      return true;
+    }
+  return false;
+  }
+
+void OvmsMetrics::ReleaseListener(MetricCallbackEntry* entry)
+  {
+  if (entry->m_refs.fetch_sub(1) == 1)
+    delete entry;
+  }
+
 void OvmsMetrics::NotifyModified(OvmsMetric* metric)
   {
   if (m_trace &&
@@ -1441,23 +1946,66 @@ void OvmsMetrics::NotifyModified(OvmsMetric* metric)
       metric->m_name, metric->AsUnitString().c_str());
     }
 
-  auto k = m_listeners.find("*");
-  for (int x=0;x<2;x++)
+  // Collect the listeners, call them without holding the lock:
+  MetricCallbackEntry* entries[16];
+  std::vector<MetricCallbackEntry*> more;
+  int count = 0;
     {
-    if (k != m_listeners.end())
+    OvmsRecMutexLock lock(&m_listeners_mutex);
+    auto k = m_listeners.find("*");
+    for (int x=0;x<2;x++)
       {
-      MetricCallbackList* ml = k->second;
-      if (ml)
+      if (k != m_listeners.end() && k->second)
         {
+        MetricCallbackList* ml = k->second;
         for (MetricCallbackList::iterator itc=ml->begin(); itc!=ml->end(); ++itc)
           {
           MetricCallbackEntry* ec = *itc;
-          ec->m_callback(metric);
+          ec->m_refs++;
+          if (count < 16)
+            entries[count++] = ec;
+          else
+            more.push_back(ec);
           }
         }
+      k = m_listeners.find(metric->m_name);
       }
-    k = m_listeners.find(metric->m_name);
     }
+  if (count == 0)
+    return;
+
+  // Register the task as notifying, so a listener deregistering itself won't wait:
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  int slot;
+  for (;;)
+    {
+    for (slot = 0; slot < METRICS_NOTIFY_TASKS; slot++)
+      {
+      TaskHandle_t expected = NULL;
+      if (m_notifying[slot].compare_exchange_strong(expected, task))
+        break;
+      }
+    if (slot < METRICS_NOTIFY_TASKS)
+      break;
+    vTaskDelay(1);
+    }
+
+  for (int i = 0; i < count; i++)
+    {
+    if (!entries[i]->m_removed)
+      entries[i]->m_callback(metric);
+    }
+  for (MetricCallbackEntry* ec : more)
+    {
+    if (!ec->m_removed)
+      ec->m_callback(metric);
+    }
+
+  m_notifying[slot] = NULL;
+  for (int i = 0; i < count; i++)
+    ReleaseListener(entries[i]);
+  for (MetricCallbackEntry* ec : more)
+    ReleaseListener(ec);
   }
 
 size_t OvmsMetrics::RegisterModifier()
@@ -1125,6 +1125,8 @@ class OvmsMetricInt64 : public OvmsMetric64
 
 typedef std::function<void(OvmsMetric*)> MetricCallback;
 
+#define METRICS_NOTIFY_TASKS      16      // Max tasks running listener callbacks concurrently
+
 class MetricCallbackEntry
   {
   public:
@@ -1134,6 +1136,8 @@ class MetricCallbackEntry
   public:
     std::string m_caller;
     MetricCallback m_callback;
+    std::atomic<int> m_refs;            // listener list + running notifications
+    std::atomic<bool> m_removed;        // deregistered, skip further calls
   };
 
 class UnitConfigMap
@@ -1228,9 +1232,16 @@ class OvmsMetrics
   public:
     void RegisterListener(std::string caller, std::string name, MetricCallback callback);
     void DeregisterListener(std::string caller);
+    bool HasNamedListener(const std::string &name);
     void NotifyModified(OvmsMetric* metric);
+  protected:
+    bool IsNotifying(TaskHandle_t task);
+    void ReleaseListener(MetricCallbackEntry* entry);
+
   protected:
     MetricCallbackMap m_listeners;
+    OvmsRecMutex m_listeners_mutex;   // protects m_listeners, not held while calling
+    std::atomic<TaskHandle_t> m_notifying[METRICS_NOTIFY_TASKS]; // tasks running callbacks
 
   public:
     size_t RegisterModifier();
@@ -1245,6 +1256,7 @@ class OvmsMetrics
   public:
     OvmsMetric* m_first;
     bool m_trace;
+    std::atomic_uint m_generation;    // incremented on metric (de)registration
   };
 
 extern OvmsMetrics MyMetrics;
@@ -0,0 +1,915 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "metrics-history";
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sstream>
+#include <algorithm>
+#include "rom/crc.h"
+#include "ovms_metrics_history.h"
+#include "ovms_metrics_snapshot.h"
+#include "ovms_config.h"
+#include "ovms_events.h"
+#include "ovms_utils.h"
+#include "glob_match.h"
+
+OvmsMetricsHistory MyMetricsHistory __attribute__ ((init_priority (1840)));
+
+static inline uint32_t float_bits(float value)
+  {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+  }
+
+static inline float bits_float(uint32_t bits)
+  {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// MetricsHistoryBlock: encoder
+
+MetricsHistoryBlock::MetricsHistoryBlock(uint32_t namehash, uint32_t time, float value)
+  {
+  m_hdr.magic = METRICS_HISTORY_MAGIC;
+  m_hdr.namehash = namehash;
+  m_hdr.start = time;
+  m_hdr.end = time;
+  m_hdr.count = 1;
+  m_hdr.size = 0;
+  m_hdr.first = value;
+  m_hdr.crc = 0;
+  m_data.assign(METRICS_HISTORY_BLOCK_SIZE, 0);
+
+  m_bits = 0;
+  m_delta = 0;
+  m_value = float_bits(value);
+  m_leading = 0xff;                     // no XOR window yet
+  m_trailing = 0;
+  }
+
+void MetricsHistoryBlock::PutBits(uint32_t bits, int count)
+  {
+  while (count > 0)
+    {
+    int pos = m_bits & 7;
+    int n = std::min(8 - pos, count);
+    uint8_t chunk = (bits >> (count - n)) & ((1 << n) - 1);
+    m_data[m_bits >> 3] |= chunk << (8 - pos - n);
+    m_bits += n;
+    count -= n;
+    }
+  }
+
+/**
+ * Append: add a sample to the block
+ *  Returns false if the block is full or sealed, or if the time is out of order
+ *  (i.e. the clock has been set back), so the caller needs to start a new block.
+ */
+bool MetricsHistoryBlock::Append(uint32_t time, float value)
+  {
+  // worst case sample size: 4+32 bits time, 2+5+5+32 bits value
+  if (m_bits + 80 > m_data.size() * 8 || m_hdr.count == UINT16_MAX || time < m_hdr.end)
+    return false;
+
+  // timestamp:
+  int32_t delta = time - m_hdr.end;
+  int32_t dod = delta - m_delta;
+  if (dod == 0)
+    {
+    PutBits(0x0, 1);
+    }
+  else if (dod >= -63 && dod <= 64)
+    {
+    PutBits(0x2, 2);
+    PutBits(dod + 63, 7);
+    }
+  else if (dod >= -255 && dod <= 256)
+    {
+    PutBits(0x6, 3);
+    PutBits(dod + 255, 9);
+    }
+  else if (dod >= -2047 && dod <= 2048)
+    {
+    PutBits(0xe, 4);
+    PutBits(dod + 2047, 12);
+    }
+  else
+    {
+    PutBits(0xf, 4);
+    PutBits((uint32_t) dod, 32);
+    }
+  m_delta = delta;
+  m_hdr.end = time;
+
+  // value:
+  uint32_t bits = float_bits(value);
+  uint32_t x = bits ^ m_value;
+  if (x == 0)
+    {
+    PutBits(0x0, 1);
+    }
+  else
+    {
+    int leading = __builtin_clz(x);
+    int trailing = __builtin_ctz(x);
+    if (m_leading != 0xff && leading >= m_leading && trailing >= m_trailing)
+      {
+      PutBits(0x2, 2);
+      PutBits(x >> m_trailing, 32 - m_leading - m_trailing);
+      }
+    else
+      {
+      int len = 32 - leading - trailing;
+      PutBits(0x3, 2);
+      PutBits(leading, 5);
+      PutBits(len - 1, 5);
+      PutBits(x >> trailing, len);
+      m_leading = leading;
+      m_trailing = trailing;
+      }
+    }
+  m_value = bits;
+
+  m_hdr.count++;
+  m_hdr.size = (m_bits + 7) / 8;
+  return true;
+  }
+
+/**
+ * Seal: close the block, release the unused buffer capacity
+ */
+void MetricsHistoryBlock::Seal()
+  {
+  m_data.resize(m_hdr.size);
+  m_data.shrink_to_fit();
+  m_hdr.crc = crc32_le(0, m_data.data(), m_data.size());
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// MetricsHistoryReader: decoder
+
+MetricsHistoryReader::MetricsHistoryReader(const metrics_history_header_t &hdr, const uint8_t* data)
+  : m_hdr(hdr)
+  {
+  m_data = data;
+  m_pos = 0;
+  m_bitsize = hdr.size * 8;
+  m_index = 0;
+  m_time = hdr.start;
+  m_delta = 0;
+  m_value = float_bits(hdr.first);
+  m_leading = 0;
+  m_trailing = 0;
+  }
+
+uint32_t MetricsHistoryReader::GetBits(int count)
+  {
+  uint32_t bits = 0;
+  while (count > 0)
+    {
+    int pos = m_pos & 7;
+    int n = std::min(8 - pos, count);
+    if (m_pos + n <= m_bitsize)
+      bits = (bits << n) | ((m_data[m_pos >> 3] >> (8 - pos - n)) & ((1 << n) - 1));
+    else
+      bits <<= n;
+    m_pos += n;
+    count -= n;
+    }
+  return bits;
+  }
+
+bool MetricsHistoryReader::Next(uint32_t &time, float &value)
+  {
+  if (m_index >= m_hdr.count)
+    return false;
+
+  if (m_index > 0)
+    {
+    int32_t dod;
+    if (GetBits(1) == 0)
+      dod = 0;
+    else if (GetBits(1) == 0)
+      dod = (int32_t) GetBits(7) - 63;
+    else if (GetBits(1) == 0)
+      dod = (int32_t) GetBits(9) - 255;
+    else if (GetBits(1) == 0)
+      dod = (int32_t) GetBits(12) - 2047;
+    else
+      dod = (int32_t) GetBits(32);
+    m_delta += dod;
+    m_time += m_delta;
+
+    if (GetBits(1) != 0)
+      {
+      if (GetBits(1) != 0)
+        {
+        int leading = GetBits(5);
+        int len = GetBits(5) + 1;
+        if (leading + len > 32)
+          m_pos = m_bitsize + 1;    // corrupted
+        else
+          {
+          m_leading = leading;
+          m_trailing = 32 - leading - len;
+          }
+        }
+      if (m_pos <= m_bitsize)
+        m_value ^= GetBits(32 - m_leading - m_trailing) << m_trailing;
+      }
+
+    if (m_pos > m_bitsize)
+      {
+      m_index = m_hdr.count;
+      return false;
+      }
+    }
+
+  m_index++;
+  time = m_time;
+  value = bits_float(m_value);
+  return true;
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// OvmsMetricsHistory
+
+MetricsHistorySeries::MetricsHistorySeries(const char* name, int interval)
+  {
+  m_name = name;
+  m_namehash = MetricsSnapshot::NameHash(name);
+  m_metric = NULL;
+  m_interval = interval;
+  m_next = 0;
+  m_open = false;
+  m_unsaved = 0;
+  m_partial = -1;
+  m_partial_count = 0;
+  m_size = 0;
+  m_samples = 0;
+  }
+
+MetricsHistorySeries::~MetricsHistorySeries()
+  {
+  for (MetricsHistoryBlock* b : m_blocks)
+    delete b;
+  }
+
+OvmsMetricsHistory::OvmsMetricsHistory()
+  {
+  ESP_LOGI(TAG, "Initialising METRICS history (1840)");
+
+  m_generation = 0;
+  m_interval = METRICS_HISTORY_INTERVAL;
+  m_maxsize = METRICS_HISTORY_SIZE * 1024;
+  m_flush = METRICS_HISTORY_FLUSH;
+  m_filesize = METRICS_HISTORY_FILESIZE * 1024;
+  m_path = METRICS_HISTORY_DIR;
+  m_size = 0;
+  m_lastflush = 0;
+
+  m_cnt_samples = 0;
+  m_cnt_dropped = 0;
+  m_cnt_written = 0;
+  m_cnt_errors = 0;
+
+#ifdef bind
+  #undef bind  // Kludgy, but works
+#endif
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEventCallback(TAG, "config.mounted", std::bind(&OvmsMetricsHistory::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "config.changed", std::bind(&OvmsMetricsHistory::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&OvmsMetricsHistory::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "sd.unmounting", std::bind(&OvmsMetricsHistory::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "system.shutdown", std::bind(&OvmsMetricsHistory::EventListener, this, _1, _2));
+  }
+
+OvmsMetricsHistory::~OvmsMetricsHistory()
+  {
+  for (MetricsHistorySeries* s : m_series)
+    delete s;
+  }
+
+void OvmsMetricsHistory::EventListener(const char* event, void* data)
+  {
+  if (strcmp(event, "ticker.1") == 0)
+    {
+    Ticker();
+    }
+  else if (strcmp(event, "config.mounted") == 0)
+    {
+    LoadConfig();
+    }
+  else if (strcmp(event, "config.changed") == 0)
+    {
+    OvmsConfigParam* param = (OvmsConfigParam*) data;
+    if (param && param->GetName() == "vehicle")
+      LoadConfig();
+    }
+  else if (strcmp(event, "sd.unmounting") == 0)
+    {
+    if (startsWith(m_path, "/sd"))
+      Flush();
+    }
+  else if (strcmp(event, "system.shutdown") == 0)
+    {
+    Flush();
+    }
+  }
+
+std::string OvmsMetricsHistory::FilePath(const std::string &name)
+  {
+  return m_path + "/" + name + ".hst";
+  }
+
+void OvmsMetricsHistory::LoadConfig()
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  m_interval = MyConfig.GetParamValueInt("vehicle", "metrics.history.interval", METRICS_HISTORY_INTERVAL);
+  if (m_interval < 1)
+    m_interval = 1;
+  m_maxsize = MyConfig.GetParamValueInt("vehicle", "metrics.history.size", METRICS_HISTORY_SIZE) * 1024;
+  m_flush = MyConfig.GetParamValueInt("vehicle", "metrics.history.flush", METRICS_HISTORY_FLUSH);
+  m_filesize = MyConfig.GetParamValueInt("vehicle", "metrics.history.filesize", METRICS_HISTORY_FILESIZE) * 1024;
+
+  std::string path = MyConfig.GetParamValue("vehicle", "metrics.history.path", METRICS_HISTORY_DIR);
+  while (path.size() > 1 && path.back() == '/')
+    path.pop_back();
+  if (path != m_path)
+    {
+    // open block records belong to the old files:
+    m_path = path;
+    for (MetricsHistorySeries* s : m_series)
+      s->m_partial = -1;
+    }
+
+  std::vector<std::string> patterns;
+  std::vector<int> intervals;
+  std::istringstream list(MyConfig.GetParamValue("vehicle", "metrics.history"));
+  std::string pattern;
+  while (std::getline(list, pattern, ','))
+    {
+    int interval = m_interval;
+    size_t sep = pattern.find(':');
+    if (sep != std::string::npos)
+      {
+      interval = std::max(atoi(pattern.c_str() + sep + 1), 1);
+      pattern.resize(sep);
+      }
+    trim(pattern);
+    if (pattern.empty())
+      continue;
+    patterns.push_back(pattern);
+    intervals.push_back(interval);
+    }
+
+  if (patterns != m_patterns || intervals != m_intervals)
+    {
+    m_patterns = patterns;
+    m_intervals = intervals;
+    m_generation = MyMetrics.m_generation - 1;  // force selection update
+    }
+  }
+
+/**
+ * MatchPattern: find the selection pattern for a metric name
+ *  Returns the pattern index or -1 if not selected.
+ */
+int OvmsMetricsHistory::MatchPattern(const char* name)
+  {
+  for (int i = 0; i < (int) m_patterns.size(); i++)
+    {
+    if (glob_match(m_patterns[i].c_str(), name))
+      return i;
+    }
+  return -1;
+  }
+
+MetricsHistorySeries* OvmsMetricsHistory::FindSeries(const char* name)
+  {
+  for (MetricsHistorySeries* s : m_series)
+    {
+    if (s->m_name == name)
+      return s;
+    }
+  return NULL;
+  }
+
+/**
+ * UpdateSelection: apply patterns to registered metrics
+ *  Series of deselected metrics are flushed and removed from memory,
+ *  series of deregistered metrics are kept for queries.
+ */
+void OvmsMetricsHistory::UpdateSelection()
+  {
+  m_generation = MyMetrics.m_generation;
+
+  for (auto it = m_series.begin(); it != m_series.end();)
+    {
+    MetricsHistorySeries* s = *it;
+    int i = MatchPattern(s->m_name.c_str());
+    if (i < 0)
+      {
+      Save(s);
+      m_size -= s->m_size;
+      delete s;
+      it = m_series.erase(it);
+      continue;
+      }
+    s->m_metric = NULL;
+    if (s->m_interval != m_intervals[i])
+      {
+      s->m_interval = m_intervals[i];
+      s->m_next = 0;
+      }
+    ++it;
+    }
+
+  if (m_patterns.empty())
+    return;
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL; m = m->m_next)
+    {
+    int i = MatchPattern(m->m_name);
+    if (i < 0)
+      continue;
+    MetricsHistorySeries* s = FindSeries(m->m_name);
+    if (!s)
+      {
+      s = new MetricsHistorySeries(m->m_name, m_intervals[i]);
+      m_series.push_back(s);
+      }
+    s->m_metric = m;
+    }
+  }
+
+void OvmsMetricsHistory::Ticker()
+  {
+    {
+    OvmsMutexLock lock(&m_mutex);
+
+    if (m_generation != MyMetrics.m_generation)
+      UpdateSelection();
+    if (m_series.empty())
+      return;
+
+    uint32_t now = time(NULL);
+    for (MetricsHistorySeries* s : m_series)
+      {
+      if (!s->m_metric || monotonictime < s->m_next)
+        continue;
+      s->m_next = monotonictime + s->m_interval;
+      if (!s->m_metric->IsDefined())
+        continue;
+      float value = s->m_metric->AsFloat(NAN);
+      if (isnan(value))
+        continue;   // not a numerical metric
+      Record(s, now, value);
+      }
+    LimitMemory();
+
+    if (m_flush <= 0 || monotonictime - m_lastflush < (uint32_t) m_flush)
+      return;
+    }
+
+  Flush();
+  }
+
+void OvmsMetricsHistory::Record(MetricsHistorySeries* s, uint32_t time, float value)
+  {
+  m_cnt_samples++;
+  s->m_samples++;
+  if (s->m_open)
+    {
+    MetricsHistoryBlock* b = s->m_blocks.back();
+    if (b->Append(time, value))
+      return;
+    size_t size = b->Size();
+    b->Seal();
+    s->m_size -= size - b->Size();
+    m_size -= size - b->Size();
+    }
+  MetricsHistoryBlock* b = new MetricsHistoryBlock(s->m_namehash, time, value);
+  s->m_blocks.push_back(b);
+  s->m_open = true;
+  s->m_unsaved++;
+  s->m_size += b->Size();
+  m_size += b->Size();
+  }
+
+/**
+ * LimitMemory: drop the oldest blocks until the memory budget is met
+ */
+void OvmsMetricsHistory::LimitMemory()
+  {
+  while (m_size > m_maxsize)
+    {
+    MetricsHistorySeries* oldest = NULL;
+    for (MetricsHistorySeries* s : m_series)
+      {
+      if (!s->m_blocks.empty() &&
+          (!oldest || s->m_blocks.front()->m_hdr.start < oldest->m_blocks.front()->m_hdr.start))
+        oldest = s;
+      }
+    if (!oldest)
+      break;
+    DropBlock(oldest);
+    }
+  }
+
+void OvmsMetricsHistory::DropBlock(MetricsHistorySeries* s)
+  {
+  MetricsHistoryBlock* b = s->m_blocks.front();
+  if (s->m_unsaved == s->m_blocks.size())
+    {
+    s->m_unsaved--;
+    s->m_partial = -1;
+    m_cnt_dropped++;
+    }
+  s->m_samples -= b->m_hdr.count;
+  s->m_size -= b->Size();
+  m_size -= b->Size();
+  s->m_blocks.pop_front();
+  delete b;
+  if (s->m_blocks.empty())
+    s->m_open = false;
+  }
+
+/**
+ * Flush: write new blocks of all series to the storage
+ */
+bool OvmsMetricsHistory::Flush()
+  {
+  OvmsMutexLock lock(&m_mutex);
+  m_lastflush = monotonictime;
+  bool ok = true;
+  for (MetricsHistorySeries* s : m_series)
+    ok = Save(s) && ok;
+  return ok;
+  }
+
+/**
+ * Save: append the unsaved blocks of a series to its file
+ *  The open block is written as well, its record is replaced on the next save.
+ */
+bool OvmsMetricsHistory::Save(MetricsHistorySeries* s)
+  {
+  if (s->m_unsaved == 0)
+    return true;
+  if (s->m_unsaved == 1 && s->m_open && s->m_partial >= 0 &&
+      s->m_blocks.back()->m_hdr.count == s->m_partial_count)
+    return true;
+
+  if (!path_exists(m_path) && mkpath(m_path) != 0)
+    {
+    ESP_LOGD(TAG, "Save: '%s' not available", m_path.c_str());
+    return false;
+    }
+
+  OvmsMutexLock filelock(&m_filemutex);
+  std::string path = FilePath(s->m_name);
+  FILE* fp = fopen(path.c_str(), "r+");
+  if (!fp)
+    fp = fopen(path.c_str(), "w");
+  if (!fp)
+    {
+    ESP_LOGE(TAG, "Save: cannot open '%s'", path.c_str());
+    m_cnt_errors++;
+    return false;
+    }
+
+  // continue at the open block record or append:
+  fseek(fp, 0, SEEK_END);
+  long offset = ftell(fp);
+  if (s->m_partial >= 0 && s->m_partial <= offset)
+    offset = s->m_partial;
+  long start = offset, partial = -1;
+  bool ok = (fseek(fp, offset, SEEK_SET) == 0);
+
+  for (size_t i = s->m_blocks.size() - s->m_unsaved; ok && i < s->m_blocks.size(); i++)
+    {
+    MetricsHistoryBlock* b = s->m_blocks[i];
+    metrics_history_header_t hdr = b->m_hdr;
+    if (s->m_open && i == s->m_blocks.size() - 1)
+      {
+      hdr.crc = crc32_le(0, b->m_data.data(), hdr.size);
+      partial = offset;
+      }
+    ok = (fwrite(&hdr, sizeof(hdr), 1, fp) == 1 &&
+          (hdr.size == 0 || fwrite(b->m_data.data(), hdr.size, 1, fp) == 1));
+    offset += sizeof(hdr) + hdr.size;
+    if (ok)
+      m_cnt_written++;
+    }
+  ok = (fclose(fp) == 0) && ok;
+
+  if (!ok)
+    {
+    ESP_LOGE(TAG, "Save: error writing '%s'", path.c_str());
+    m_cnt_errors++;
+    s->m_partial = start;     // rewrite from here
+    s->m_partial_count = 0;
+    return false;
+    }
+
+  s->m_unsaved = (partial >= 0) ? 1 : 0;
+  s->m_partial = partial;
+  s->m_partial_count = (partial >= 0) ? s->m_blocks.back()->m_hdr.count : 0;
+
+  if (m_filesize > 0 && offset > m_filesize)
+    {
+    long removed = Trim(path, m_filesize);
+    if (s->m_partial >= 0)
+      s->m_partial -= removed;
+    }
+  return true;
+  }
+
+/**
+ * Trim: drop the oldest records of a file to reduce it to 3/4 of the size limit
+ *  Returns the number of bytes removed.
+ */
+long OvmsMetricsHistory::Trim(const std::string &path, long size)
+  {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (!fp)
+    return 0;
+  fseek(fp, 0, SEEK_END);
+  long filesize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+  // find first record to keep, always keep the last one:
+  metrics_history_header_t hdr;
+  long keep = 0;
+  while (filesize - keep > size * 3 / 4 &&
+         fread(&hdr, sizeof(hdr), 1, fp) == 1 && hdr.magic == METRICS_HISTORY_MAGIC)
+    {
+    long next = keep + sizeof(hdr) + hdr.size;
+    if (next >= filesize || fseek(fp, next, SEEK_SET) != 0)
+      break;
+    keep = next;
+    }
+  if (keep == 0)
+    {
+    fclose(fp);
+    return 0;
+    }
+
+  // copy remaining records:
+  std::string tmppath = path + ".tmp";
+  FILE* out = fopen(tmppath.c_str(), "w");
+  bool ok = (out != NULL && fseek(fp, keep, SEEK_SET) == 0);
+  char buf[256];
+  size_t len;
+  while (ok && (len = fread(buf, 1, sizeof(buf), fp)) > 0)
+    ok = (fwrite(buf, 1, len, out) == len);
+  fclose(fp);
+  if (out)
+    ok = (fclose(out) == 0) && ok;
+  if (!ok || unlink(path.c_str()) != 0 || rename(tmppath.c_str(), path.c_str()) != 0)
+    {
+    ESP_LOGE(TAG, "Trim: error rewriting '%s'", path.c_str());
+    m_cnt_errors++;
+    unlink(tmppath.c_str());
+    return 0;
+    }
+
+  ESP_LOGD(TAG, "Trim: removed %ld bytes from '%s'", keep, path.c_str());
+  return keep;
+  }
+
+/**
+ * MetricsHistoryCollector: query time filter & step aggregation
+ */
+struct MetricsHistoryCollector
+  {
+  MetricsHistorySamples &samples;
+  uint32_t from, to, step;
+  size_t limit;
+  uint32_t bucket = 0;
+  double sum = 0;
+  int count = 0;
+
+  MetricsHistoryCollector(MetricsHistorySamples &s, uint32_t f, uint32_t t, uint32_t st, size_t l)
+    : samples(s), from(f), to(t), step(st), limit(l) {}
+
+  bool Emit()
+    {
+    if (samples.size() >= limit)
+      return false;
+    samples.push_back({ bucket, (float)(sum / count) });
+    sum = 0;
+    count = 0;
+    return true;
+    }
+
+  bool Add(uint32_t time, float value)
+    {
+    if (step == 0)
+      {
+      bucket = time;
+      sum = value;
+      count = 1;
+      return Emit();
+      }
+    uint32_t b = time - time % step;
+    if (count && b != bucket && !Emit())
+      return false;
+    bucket = b;
+    sum += value;
+    count++;
+    return true;
+    }
+
+  bool AddBlock(const metrics_history_header_t &hdr, const uint8_t* data)
+    {
+    MetricsHistoryReader reader(hdr, data);
+    uint32_t time;
+    float value;
+    while (reader.Next(time, value))
+      {
+      if (time > to)
+        break;
+      if (time >= from && !Add(time, value))
+        return false;
+      }
+    return true;
+    }
+
+  void Finish()
+    {
+    if (count)
+      Emit();
+    }
+  };
+
+/**
+ * Query: get samples of a metric in a time range
+ *
+ * @param from, to    UTC time range (inclusive)
+ * @param step        0 = raw samples, else average over step seconds (aligned to UTC)
+ * @param samples     result vector (samples are appended)
+ * @param limit       max samples to return
+ * @return            number of samples, -1 = metric not recorded
+ */
+int OvmsMetricsHistory::Query(const char* name, uint32_t from, uint32_t to, uint32_t step,
+  MetricsHistorySamples &samples, size_t limit /*=METRICS_HISTORY_QUERY_LIMIT*/)
+  {
+  // Copy the memory blocks in range (in the file record format) and release
+  //  the lock before reading the storage, so recording continues meanwhile:
+  std::string path;
+  uint32_t memstart = UINT32_MAX;
+  MetricsHistoryData memblocks;
+  bool recorded;
+    {
+    OvmsMutexLock lock(&m_mutex);
+    MetricsHistorySeries* s = FindSeries(name);
+    path = FilePath(name);
+    recorded = (s != NULL);
+    if (s && !s->m_blocks.empty())
+      memstart = s->m_blocks.front()->m_hdr.start;
+    for (size_t i = 0; s && i < s->m_blocks.size(); i++)
+      {
+      MetricsHistoryBlock* b = s->m_blocks[i];
+      if (b->m_hdr.start > to)
+        break;
+      if (b->m_hdr.end < from)
+        continue;
+      const uint8_t* hdr = (const uint8_t*) &b->m_hdr;
+      memblocks.insert(memblocks.end(), hdr, hdr + sizeof(b->m_hdr));
+      memblocks.insert(memblocks.end(), b->m_data.begin(), b->m_data.begin() + b->m_hdr.size);
+      }
+    }
+
+  MetricsHistoryCollector collector(samples, from, to, step, samples.size() + limit);
+  bool more = true;
+
+  // stored blocks preceding the memory blocks:
+  if (from < memstart || !recorded)
+    {
+    OvmsMutexLock filelock(&m_filemutex);
+    FILE* fp = fopen(path.c_str(), "r");
+    if (!fp && !recorded)
+      return -1;
+    if (fp)
+      {
+      metrics_history_header_t hdr;
+      MetricsHistoryData data;
+      while (more && fread(&hdr, sizeof(hdr), 1, fp) == 1 && hdr.magic == METRICS_HISTORY_MAGIC)
+        {
+        if (hdr.start >= memstart || hdr.start > to)
+          break;
+        if (hdr.end < from)
+          {
+          if (fseek(fp, hdr.size, SEEK_CUR) != 0)
+            break;
+          continue;
+          }
+        data.resize(hdr.size);
+        if (hdr.size > 0 && fread(data.data(), hdr.size, 1, fp) != 1)
+          break;
+        if (crc32_le(0, data.data(), hdr.size) != hdr.crc)
+          {
+          ESP_LOGW(TAG, "Query: invalid record in '%s'", path.c_str());
+          continue;
+          }
+        more = collector.AddBlock(hdr, data.data());
+        }
+      fclose(fp);
+      }
+    }
+
+  // memory blocks:
+  for (size_t pos = 0; more && pos < memblocks.size();)
+    {
+    metrics_history_header_t hdr;
+    memcpy(&hdr, &memblocks[pos], sizeof(hdr));   // records are not aligned
+    pos += sizeof(hdr);
+    more = collector.AddBlock(hdr, &memblocks[pos]);
+    pos += hdr.size;
+    }
+
+  if (more)
+    collector.Finish();
+  return samples.size();
+  }
+
+/**
+ * ResolveTime: convert a query time argument, 0 / negative = seconds before now
+ */
+uint32_t OvmsMetricsHistory::ResolveTime(long t)
+  {
+  if (t <= 0)
+    return time(NULL) + t;
+  return t;
+  }
+
+void OvmsMetricsHistory::Status(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  writer->printf("History: %d metrics, default interval %d sec, memory %u of %u bytes\n",
+    m_series.size(), m_interval, m_size, m_maxsize);
+  writer->printf("  storage: %s, flush interval %d sec, file limit %ld bytes\n",
+    m_path.c_str(), m_flush, m_filesize);
+  writer->printf("  %" PRIu32 " samples, %" PRIu32 " blocks written, %" PRIu32 " dropped unsaved, %" PRIu32 " errors\n",
+    m_cnt_samples, m_cnt_written, m_cnt_dropped, m_cnt_errors);
+  if (m_series.empty())
+    return;
+
+  writer->printf("\n%-32s %8s %8s %8s %6s  %s\n", "Metric", "Interval", "Samples", "Bytes", "Ratio", "Since");
+  for (MetricsHistorySeries* s : m_series)
+    {
+    char since[20] = "-";
+    size_t bytes = 0;
+    for (MetricsHistoryBlock* b : s->m_blocks)
+      bytes += sizeof(b->m_hdr) + b->m_hdr.size;
+    if (!s->m_blocks.empty())
+      {
+      time_t start = s->m_blocks.front()->m_hdr.start;
+      struct tm tm;
+      strftime(since, sizeof(since), "%Y-%m-%d %H:%M:%S", localtime_r(&start, &tm));
+      }
+    // ratio: raw sample size (32 bit time + 32 bit float) / encoded size
+    writer->printf("%-32s %8d %8" PRIu32 " %8u %6.1f  %s%s\n",
+      s->m_name.c_str(), s->m_interval, s->m_samples, bytes,
+      bytes ? (s->m_samples * 8.0 / bytes) : 0.0,
+      since, s->m_metric ? "" : " (not registered)");
+    }
+  }
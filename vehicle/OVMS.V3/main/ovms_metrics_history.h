@@ -0,0 +1,237 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OVMS_METRICS_HISTORY_H__
+#define __OVMS_METRICS_HISTORY_H__
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <stdint.h>
+#include "ovms.h"
+#include "ovms_metrics.h"
+#include "ovms_mutex.h"
+#include "ovms_command.h"
+
+/**
+ * Metrics history block encoding (Gorilla, Pelkonen et al., VLDB 2015):
+ *
+ *  A block holds a sequence of samples of one metric, time in UTC seconds,
+ *  value as the metric float (OvmsMetric::AsFloat()). The first sample is
+ *  stored in the block header, the following samples as a bit stream of:
+ *
+ *  Timestamp delta of delta D = (t[n] - t[n-1]) - (t[n-1] - t[n-2]):
+ *    '0'                   D = 0
+ *    '10'   +  7 bits      D = -63 … 64
+ *    '110'  +  9 bits      D = -255 … 256
+ *    '1110' + 12 bits      D = -2047 … 2048
+ *    '1111' + 32 bits      any other D
+ *  Value XOR X = bits(v[n]) ^ bits(v[n-1]):
+ *    '0'                   X = 0 (value unchanged)
+ *    '10'   + bits         meaningful bits of X fit into the previous window
+ *    '11'   + 5 bits leading zeros + 5 bits length-1 + meaningful bits
+ *
+ * A regularly sampled unchanged value needs 2 bits per sample. Blocks are
+ * self-contained and stored in the same format on the storage, so they can
+ * be dropped or loaded independently.
+ */
+
+#define METRICS_HISTORY_MAGIC         0x5453564f    // "OVST"
+#define METRICS_HISTORY_BLOCK_SIZE    256           // bit stream capacity [bytes]
+
+typedef struct
+  {
+  uint32_t magic;
+  uint32_t namehash;                    // metric name FNV-1a hash
+  uint32_t start;                       // time of first sample
+  uint32_t end;                         // time of last sample
+  uint16_t count;                       // sample count
+  uint16_t size;                        // bit stream size [bytes]
+  float first;                          // value of first sample
+  uint32_t crc;                         // CRC32 of the bit stream
+  } metrics_history_header_t;
+
+typedef std::vector<uint8_t, ExtRamAllocator<uint8_t>> MetricsHistoryData;
+
+struct MetricsHistorySample
+  {
+  uint32_t time;
+  float value;
+  };
+
+typedef std::vector<MetricsHistorySample, ExtRamAllocator<MetricsHistorySample>> MetricsHistorySamples;
+
+class MetricsHistoryBlock : public ExternalRamAllocated
+  {
+  public:
+    MetricsHistoryBlock(uint32_t namehash, uint32_t time, float value);
+
+  public:
+    bool Append(uint32_t time, float value);
+    void Seal();
+    size_t Size() { return sizeof(m_hdr) + m_data.capacity(); }
+
+  protected:
+    void PutBits(uint32_t bits, int count);
+
+  public:
+    metrics_history_header_t m_hdr;
+    MetricsHistoryData m_data;
+
+  protected:
+    // Encoder state:
+    uint32_t m_bits;                    // bit stream length
+    int32_t m_delta;                    // last time delta
+    uint32_t m_value;                   // last value bits
+    uint8_t m_leading;                  // last XOR window
+    uint8_t m_trailing;
+  };
+
+class MetricsHistoryReader
+  {
+  public:
+    MetricsHistoryReader(const metrics_history_header_t &hdr, const uint8_t* data);
+
+  public:
+    bool Next(uint32_t &time, float &value);
+
+  protected:
+    uint32_t GetBits(int count);
+
+  protected:
+    const metrics_history_header_t &m_hdr;
+    const uint8_t* m_data;
+    uint32_t m_pos;                     // bit position
+    uint32_t m_bitsize;
+    uint16_t m_index;                   // next sample index
+    uint32_t m_time;
+    int32_t m_delta;
+    uint32_t m_value;
+    uint8_t m_leading;
+    uint8_t m_trailing;
+  };
+
+/**
+ * OvmsMetricsHistory: compressed time series store for selected metrics
+ *
+ * - The metrics are selected by config (vehicle metrics.history, glob patterns
+ *   with optional ":<seconds>" sampling interval suffix), the default interval
+ *   is metrics.history.interval. Only numerical metrics are recorded.
+ * - Samples are encoded into blocks in PSRAM, limited in total by
+ *   metrics.history.size; the oldest blocks are dropped first.
+ * - Every metrics.history.flush seconds and on shutdown / SD unmount, new
+ *   blocks are appended to a file per metric in metrics.history.path. Files
+ *   are trimmed to metrics.history.filesize by dropping the oldest blocks.
+ * - Query() returns the samples of a time range from the files and the
+ *   memory blocks, optionally averaged over time steps.
+ */
+
+#define METRICS_HISTORY_DIR           "/store/.history"
+#define METRICS_HISTORY_INTERVAL      60            // default sampling interval [s]
+#define METRICS_HISTORY_SIZE          64            // memory budget [kB]
+#define METRICS_HISTORY_FLUSH         1800          // flush interval [s]
+#define METRICS_HISTORY_FILESIZE      32            // file size limit per metric [kB]
+#define METRICS_HISTORY_QUERY_LIMIT   10000         // max samples per query
+
+class MetricsHistorySeries : public ExternalRamAllocated
+  {
+  public:
+    MetricsHistorySeries(const char* name, int interval);
+    ~MetricsHistorySeries();
+
+  public:
+    std::string m_name;
+    uint32_t m_namehash;
+    OvmsMetric* m_metric;               // NULL = not registered
+    int m_interval;                     // sampling interval [s]
+    uint32_t m_next;                    // monotonictime of next sample
+    std::deque<MetricsHistoryBlock*> m_blocks;    // oldest first
+    bool m_open;                        // last block is open for samples
+    size_t m_unsaved;                   // number of blocks (at the end) not yet flushed
+    long m_partial;                     // file offset of open block record, -1 = none
+    uint16_t m_partial_count;           // … sample count written
+    size_t m_size;                      // memory blocks total size
+    uint32_t m_samples;                 // memory blocks total samples
+  };
+
+class OvmsMetricsHistory
+  {
+  public:
+    OvmsMetricsHistory();
+    ~OvmsMetricsHistory();
+
+  public:
+    void EventListener(const char* event, void* data);
+    int Query(const char* name, uint32_t from, uint32_t to, uint32_t step,
+      MetricsHistorySamples &samples, size_t limit=METRICS_HISTORY_QUERY_LIMIT);
+    bool Flush();
+    void Status(OvmsWriter* writer);
+    bool IsEnabled() { return !m_series.empty(); }
+    static uint32_t ResolveTime(long t);
+
+  protected:
+    void LoadConfig();
+    int MatchPattern(const char* name);
+    void UpdateSelection();
+    void Ticker();
+    void Record(MetricsHistorySeries* s, uint32_t time, float value);
+    void LimitMemory();
+    void DropBlock(MetricsHistorySeries* s);
+    bool Save(MetricsHistorySeries* s);
+    long Trim(const std::string &path, long size);
+    std::string FilePath(const std::string &name);
+    MetricsHistorySeries* FindSeries(const char* name);
+
+  protected:
+    OvmsMutex m_mutex;
+    OvmsMutex m_filemutex;                      // storage file access, nests inside m_mutex
+    std::vector<std::string> m_patterns;        // selection glob patterns
+    std::vector<int> m_intervals;               // … sampling intervals
+    std::vector<MetricsHistorySeries*> m_series;
+    unsigned int m_generation;                  // metrics generation of selection
+    int m_interval;                             // default sampling interval [s]
+    size_t m_maxsize;                           // memory budget [bytes]
+    int m_flush;                                // flush interval [s]
+    long m_filesize;                            // file size limit [bytes]
+    std::string m_path;                         // storage directory
+    size_t m_size;                              // memory blocks total size
+    uint32_t m_lastflush;                       // monotonictime of last flush
+
+  public:
+    // Statistics:
+    uint32_t m_cnt_samples;                     // samples recorded
+    uint32_t m_cnt_dropped;                     // blocks dropped from memory unsaved
+    uint32_t m_cnt_written;                     // blocks written
+    uint32_t m_cnt_errors;                      // storage errors
+  };
+
+extern OvmsMetricsHistory MyMetricsHistory;
+
+#endif //#ifndef __OVMS_METRICS_HISTORY_H__
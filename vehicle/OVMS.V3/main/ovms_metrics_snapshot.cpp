@@ -0,0 +1,590 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "metrics-snapshot";
+
+#include <stdio.h>
+#include <string.h>
+#include <sstream>
+#include <sys/stat.h>
+#include "rom/crc.h"
+#include "ovms.h"
+#include "ovms_metrics_snapshot.h"
+#include "ovms_config.h"
+#include "ovms_events.h"
+#include "ovms_utils.h"
+#include "glob_match.h"
+
+OvmsMetricsFlashStore MyMetricsFlashStore __attribute__ ((init_priority (1830)));
+
+////////////////////////////////////////////////////////////////////////////////
+// MetricsSnapshot: record encoding
+
+/**
+ * NameHash: FNV-1a 32 bit hash of the metric name
+ *  (stable across firmware builds, unlike std::hash)
+ */
+uint32_t MetricsSnapshot::NameHash(const char* name)
+  {
+  uint32_t hash = 2166136261u;
+  while (*name)
+    {
+    hash ^= (uint8_t) *name++;
+    hash *= 16777619u;
+    }
+  return hash;
+  }
+
+void MetricsSnapshot::AddValue(std::string &payload, uint32_t namehash, const std::string &value)
+  {
+  uint16_t len = value.size();
+  payload.append((const char*)&namehash, sizeof(namehash));
+  payload.append((const char*)&len, sizeof(len));
+  payload.append(value.data(), len);
+  }
+
+bool MetricsSnapshot::Write(const char* path, const std::string &payload, uint16_t count, uint32_t sequence)
+  {
+  metrics_snapshot_header_t hdr;
+  hdr.magic = METRICS_SNAPSHOT_MAGIC;
+  hdr.version = METRICS_SNAPSHOT_VERSION;
+  hdr.count = count;
+  hdr.sequence = sequence;
+  hdr.size = payload.size();
+  hdr.crc = crc32_le(0, (const uint8_t*)payload.data(), payload.size());
+
+  FILE* fp = fopen(path, "w");
+  if (!fp)
+    {
+    ESP_LOGE(TAG, "Write: cannot open '%s'", path);
+    return false;
+    }
+  bool ok = (fwrite(&hdr, sizeof(hdr), 1, fp) == 1 &&
+             (payload.empty() || fwrite(payload.data(), payload.size(), 1, fp) == 1));
+  ok = (fclose(fp) == 0) && ok;
+  if (!ok)
+    {
+    ESP_LOGE(TAG, "Write: error writing '%s'", path);
+    unlink(path);
+    }
+  return ok;
+  }
+
+bool MetricsSnapshot::Read(const char* path, MetricsSnapshotValues &values, uint32_t *sequence /*=NULL*/, uint32_t *crc /*=NULL*/)
+  {
+  FILE* fp = fopen(path, "r");
+  if (!fp)
+    return false;
+
+  metrics_snapshot_header_t hdr;
+  std::string payload;
+  bool ok = (fread(&hdr, sizeof(hdr), 1, fp) == 1 &&
+             hdr.magic == METRICS_SNAPSHOT_MAGIC &&
+             hdr.version == METRICS_SNAPSHOT_VERSION);
+  if (ok && hdr.size > 0)
+    {
+    payload.resize(hdr.size);
+    ok = (fread(&payload[0], hdr.size, 1, fp) == 1);
+    }
+  fclose(fp);
+
+  if (!ok || crc32_le(0, (const uint8_t*)payload.data(), payload.size()) != hdr.crc)
+    {
+    ESP_LOGW(TAG, "Read: '%s' invalid", path);
+    return false;
+    }
+
+  // decode entries:
+  const char *p = payload.data(), *end = p + payload.size();
+  for (int i = 0; i < hdr.count; i++)
+    {
+    uint32_t namehash;
+    uint16_t len;
+    if (p + sizeof(namehash) + sizeof(len) > end)
+      return false;
+    memcpy(&namehash, p, sizeof(namehash));
+    p += sizeof(namehash);
+    memcpy(&len, p, sizeof(len));
+    p += sizeof(len);
+    if (p + len > end)
+      return false;
+    values[namehash] = std::string(p, len);
+    p += len;
+    }
+
+  if (sequence) *sequence = hdr.sequence;
+  if (crc) *crc = hdr.crc;
+  return true;
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// OvmsMetricsFlashStore
+
+OvmsMetricsFlashStore::OvmsMetricsFlashStore()
+  {
+  ESP_LOGI(TAG, "Initialising METRICS flash store (1830)");
+
+  m_ready = false;
+  m_interval = METRICS_FLASH_INTERVAL;
+  m_generation = 0;
+  m_modifier = MyMetrics.RegisterModifier();
+  m_dirty = false;
+  m_lastsave = 0;
+  m_sequence = 0;
+  m_slot = -1;
+  m_crc = 0;
+
+  m_cnt_writes = 0;
+  m_cnt_unchanged = 0;
+  m_cnt_errors = 0;
+  m_cnt_restored = 0;
+  m_time_loaded = 0;
+  m_time_restored = 0;
+  m_time_live = 0;
+
+#ifdef bind
+  #undef bind  // Kludgy, but works
+#endif
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEventCallback(TAG, "config.mounted", std::bind(&OvmsMetricsFlashStore::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "config.changed", std::bind(&OvmsMetricsFlashStore::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", std::bind(&OvmsMetricsFlashStore::EventListener, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG, "system.shutdown", std::bind(&OvmsMetricsFlashStore::EventListener, this, _1, _2));
+  }
+
+OvmsMetricsFlashStore::~OvmsMetricsFlashStore()
+  {
+  }
+
+void OvmsMetricsFlashStore::EventListener(const char* event, void* data)
+  {
+  if (strcmp(event, "ticker.1") == 0)
+    {
+    Ticker();
+    }
+  else if (strcmp(event, "config.mounted") == 0)
+    {
+    LoadConfig();
+    Load();
+    }
+  else if (strcmp(event, "config.changed") == 0)
+    {
+    OvmsConfigParam* param = (OvmsConfigParam*) data;
+    if (param && param->GetName() == "vehicle")
+      LoadConfig();
+    }
+  else if (strcmp(event, "system.shutdown") == 0)
+    {
+    Save(true);
+    }
+  }
+
+std::string OvmsMetricsFlashStore::SlotPath(int slot)
+  {
+  char path[40];
+  snprintf(path, sizeof(path), METRICS_FLASH_DIR "/flash%d.bin", slot);
+  return std::string(path);
+  }
+
+void OvmsMetricsFlashStore::LoadConfig()
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  std::vector<std::string> patterns;
+  std::istringstream list(MyConfig.GetParamValue("vehicle", "metrics.flash", METRICS_FLASH_DEFAULT));
+  std::string pattern;
+  while (std::getline(list, pattern, ','))
+    {
+    trim(pattern);
+    if (!pattern.empty())
+      patterns.push_back(pattern);
+    }
+
+  m_interval = MyConfig.GetParamValueInt("vehicle", "metrics.flash.interval", METRICS_FLASH_INTERVAL);
+  if (m_interval < 10)
+    m_interval = 10;
+
+  if (patterns != m_patterns)
+    {
+    m_patterns = patterns;
+    m_generation = MyMetrics.m_generation - 1;  // force selection update
+    }
+  }
+
+/**
+ * Load: read the newest valid record into the pending set
+ */
+void OvmsMetricsFlashStore::Load()
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  MetricsSnapshotValues values;
+  for (int slot = 0; slot < METRICS_FLASH_SLOTS; slot++)
+    {
+    MetricsSnapshotValues slotvalues;
+    uint32_t sequence, crc;
+    if (MetricsSnapshot::Read(SlotPath(slot).c_str(), slotvalues, &sequence, &crc))
+      {
+      if (m_slot < 0 || sequence > m_sequence)
+        {
+        values.swap(slotvalues);
+        m_slot = slot;
+        m_sequence = sequence;
+        m_crc = crc;
+        }
+      }
+    else if (path_exists(SlotPath(slot)))
+      {
+      m_cnt_errors++;
+      }
+    }
+
+  m_pending.swap(values);
+  m_time_loaded = esp_log_timestamp();
+  m_ready = true;
+  ESP_LOGI(TAG, "Loaded %d metrics from slot %d sequence %" PRIu32,
+    m_pending.size(), m_slot, m_sequence);
+
+  // restore registered metrics now:
+  UpdateSelection();
+  }
+
+/**
+ * UpdateSelection: apply patterns to registered metrics, restore pending values
+ */
+void OvmsMetricsFlashStore::UpdateSelection()
+  {
+  m_generation = MyMetrics.m_generation;
+  m_selection.clear();
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL; m = m->m_next)
+    {
+    for (auto &pattern : m_patterns)
+      {
+      if (glob_match(pattern.c_str(), m->m_name))
+        {
+        m_selection.push_back(m);
+        break;
+        }
+      }
+    }
+
+  // drop deregistered metrics from the live data watch:
+  std::set<OvmsMetric*> awaiting;
+  for (OvmsMetric* m : m_selection)
+    {
+    if (m_awaiting.count(m))
+      awaiting.insert(m);
+    }
+  m_awaiting.swap(awaiting);
+
+  // lazy restore:
+  if (m_pending.empty())
+    return;
+  for (OvmsMetric* m : m_selection)
+    {
+    auto it = m_pending.find(MetricsSnapshot::NameHash(m->m_name));
+    if (it == m_pending.end())
+      continue;
+    if (!m->IsDefined() && m->SetValue(it->second))
+      {
+      m->SetStale(true);
+      m->ClearModified(m_modifier);
+      m_awaiting.insert(m);
+      m_cnt_restored++;
+      m_time_restored = esp_log_timestamp();
+      m_time_live = 0;
+      ESP_LOGD(TAG, "Restored %s = %s", m->m_name, it->second.c_str());
+      }
+    m_pending.erase(it);
+    }
+  }
+
+void OvmsMetricsFlashStore::Ticker()
+  {
+  if (!m_ready)
+    return;
+
+    {
+    OvmsMutexLock lock(&m_mutex);
+
+    if (m_generation != MyMetrics.m_generation)
+      UpdateSelection();
+
+    // collect changes:
+    for (OvmsMetric* m : m_selection)
+      {
+      if (m->IsModifiedAndClear(m_modifier))
+        {
+        m_dirty = true;
+        if (m_awaiting.erase(m) && m_awaiting.empty() && m_time_restored)
+          {
+          m_time_live = esp_log_timestamp();
+          ESP_LOGI(TAG, "All restored metrics updated by live data after %" PRIu32 " ms",
+            m_time_live - m_time_loaded);
+          }
+        }
+      }
+
+    if (!m_dirty || monotonictime - m_lastsave < (uint32_t) m_interval)
+      return;
+    }
+
+  Save();
+  }
+
+/**
+ * Save: write a new record if the payload has changed
+ *  (force: ignore interval & dirty state)
+ */
+bool OvmsMetricsFlashStore::Save(bool force /*=false*/)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  if (!m_ready)
+    return false;
+  if (!force && !m_dirty)
+    return true;
+
+  m_lastsave = monotonictime;
+  m_dirty = false;
+
+  // encode selected metrics and values still pending restore:
+  std::string payload;
+  uint16_t count = 0;
+  for (OvmsMetric* m : m_selection)
+    {
+    if (!m->IsDefined())
+      continue;
+    std::string value = m->AsString("", Other);
+    if (value.size() > UINT16_MAX)
+      continue;
+    MetricsSnapshot::AddValue(payload, MetricsSnapshot::NameHash(m->m_name), value);
+    count++;
+    }
+  for (auto &kv : m_pending)
+    {
+    MetricsSnapshot::AddValue(payload, kv.first, kv.second);
+    count++;
+    }
+
+  uint32_t crc = crc32_le(0, (const uint8_t*)payload.data(), payload.size());
+  if (m_slot >= 0 && crc == m_crc)
+    {
+    m_cnt_unchanged++;
+    return true;
+    }
+
+  if (!path_exists(METRICS_FLASH_DIR) && mkpath(METRICS_FLASH_DIR) != 0)
+    {
+    m_cnt_errors++;
+    return false;
+    }
+
+  int slot = (m_slot + 1) % METRICS_FLASH_SLOTS;
+  if (!MetricsSnapshot::Write(SlotPath(slot).c_str(), payload, count, m_sequence + 1))
+    {
+    m_cnt_errors++;
+    return false;
+    }
+
+  m_slot = slot;
+  m_sequence++;
+  m_crc = crc;
+  m_cnt_writes++;
+  ESP_LOGD(TAG, "Saved %u metrics (%u bytes) to slot %d sequence %" PRIu32,
+    count, payload.size(), m_slot, m_sequence);
+  return true;
+  }
+
+void OvmsMetricsFlashStore::Status(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  writer->printf("Flash tier: %d metrics selected, interval %d sec, patterns:",
+    m_selection.size(), m_interval);
+  for (auto &pattern : m_patterns)
+    writer->printf(" %s", pattern.c_str());
+  writer->puts("");
+  if (!m_ready)
+    {
+    writer->puts("  /store not mounted");
+    return;
+    }
+  writer->printf("  record: slot %d, sequence %" PRIu32 ", %s\n",
+    m_slot, m_sequence, m_dirty ? "changes pending" : "up to date");
+  writer->printf("  %" PRIu32 " writes, %" PRIu32 " unchanged, %" PRIu32 " errors\n",
+    m_cnt_writes, m_cnt_unchanged, m_cnt_errors);
+  writer->printf("  %" PRIu32 " metrics restored, %d pending registration, %d awaiting live data\n",
+    m_cnt_restored, m_pending.size(), m_awaiting.size());
+  writer->printf("  boot timing: loaded %" PRIu32 " ms, restored %" PRIu32 " ms",
+    m_time_loaded, m_time_restored);
+  if (m_time_live)
+    writer->printf(", live data complete %" PRIu32 " ms\n", m_time_live);
+  else
+    writer->puts(", live data incomplete");
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// OvmsMetricsSnapshot
+
+OvmsMetricsSnapshot::OvmsMetricsSnapshot(const char* owner, const char* path, const char* patterns,
+  const char* events /*=METRICS_SNAPSHOT_EVENTS*/)
+  {
+  m_caller = std::string(owner) + ".snapshot";
+  m_path = path;
+  m_sequence = 0;
+
+  std::istringstream list(patterns);
+  std::string pattern;
+  while (std::getline(list, pattern, ','))
+    {
+    trim(pattern);
+    if (pattern.empty())
+      continue;
+    if (pattern[0] == '!')
+      m_exclude.push_back(pattern.substr(1));
+    else
+      m_include.push_back(pattern);
+    }
+
+#ifdef bind
+  #undef bind  // Kludgy, but works
+#endif
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  std::istringstream evlist(events ? events : "");
+  std::string event;
+  while (std::getline(evlist, event, ','))
+    {
+    trim(event);
+    if (!event.empty())
+      MyEvents.RegisterEvent(m_caller, event, std::bind(&OvmsMetricsSnapshot::EventListener, this, _1, _2));
+    }
+  }
+
+OvmsMetricsSnapshot::~OvmsMetricsSnapshot()
+  {
+  MyEvents.DeregisterEvent(m_caller);
+  }
+
+void OvmsMetricsSnapshot::EventListener(std::string event, void* data)
+  {
+  Save();
+  }
+
+bool OvmsMetricsSnapshot::IsSelected(const char* name)
+  {
+  for (auto &pattern : m_exclude)
+    {
+    if (glob_match(pattern.c_str(), name))
+      return false;
+    }
+  for (auto &pattern : m_include)
+    {
+    if (glob_match(pattern.c_str(), name))
+      return true;
+    }
+  return false;
+  }
+
+/**
+ * Save: write the defined selected metrics into the snapshot file
+ */
+bool OvmsMetricsSnapshot::Save()
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  std::string dir = m_path.substr(0, m_path.rfind('/'));
+  if (!dir.empty() && !path_exists(dir) && mkpath(dir) != 0)
+    {
+    ESP_LOGD(TAG, "Save %s: directory not available", m_path.c_str());
+    return false;
+    }
+
+  std::string payload;
+  uint16_t count = 0;
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL && count < UINT16_MAX; m = m->m_next)
+    {
+    if (!m->IsDefined() || !IsSelected(m->m_name))
+      continue;
+    std::string value = m->AsString("", Other);
+    if (value.size() > UINT16_MAX)
+      continue;
+    MetricsSnapshot::AddValue(payload, MetricsSnapshot::NameHash(m->m_name), value);
+    count++;
+    }
+
+  // write & replace:
+  std::string tmppath = m_path + ".tmp";
+  if (!MetricsSnapshot::Write(tmppath.c_str(), payload, count, m_sequence + 1))
+    return false;
+  unlink(m_path.c_str());
+  if (rename(tmppath.c_str(), m_path.c_str()) != 0)
+    {
+    ESP_LOGE(TAG, "Save %s: rename failed", m_path.c_str());
+    return false;
+    }
+
+  m_sequence++;
+  ESP_LOGD(TAG, "Saved %u metrics (%u bytes) to %s", count, payload.size(), m_path.c_str());
+  return true;
+  }
+
+/**
+ * Restore: set the selected metrics to the snapshot values
+ *  (stale: mark restored metrics as stale until updated by live data)
+ *  Returns the number of metrics restored, -1 if no valid snapshot exists.
+ */
+int OvmsMetricsSnapshot::Restore(bool stale /*=false*/)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  MetricsSnapshotValues values;
+  if (!MetricsSnapshot::Read(m_path.c_str(), values, &m_sequence))
+    return -1;
+
+  int restored = 0;
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL && !values.empty(); m = m->m_next)
+    {
+    auto it = values.find(MetricsSnapshot::NameHash(m->m_name));
+    if (it == values.end())
+      continue;
+    if (IsSelected(m->m_name) && m->SetValue(it->second))
+      {
+      if (stale)
+        m->SetStale(true);
+      restored++;
+      }
+    values.erase(it);
+    }
+
+  ESP_LOGI(TAG, "Restored %d metrics from %s", restored, m_path.c_str());
+  return restored;
+  }
@@ -0,0 +1,197 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OVMS_METRICS_SNAPSHOT_H__
+#define __OVMS_METRICS_SNAPSHOT_H__
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <set>
+#include <stdint.h>
+#include "ovms_metrics.h"
+#include "ovms_mutex.h"
+#include "ovms_command.h"
+
+/**
+ * Metrics snapshot record format (little endian):
+ *
+ *  Header (metrics_snapshot_header_t):
+ *    magic, format version, entry count, sequence number, payload size, payload CRC32
+ *  Payload: <count> entries of:
+ *    uint32_t  name hash (FNV-1a 32 bit, see MetricsSnapshot::NameHash())
+ *    uint16_t  value length
+ *    char[]    value (native unit string representation, OvmsMetric::AsString())
+ *
+ * The string representation covers all metric types including strings,
+ * vectors & 64 bit values, and keeps the record independent of the metric
+ * class layout.
+ */
+
+#define METRICS_SNAPSHOT_MAGIC        0x534d564f    // "OVMS"
+#define METRICS_SNAPSHOT_VERSION      1
+
+typedef struct
+  {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t sequence;
+  uint32_t size;
+  uint32_t crc;
+  } metrics_snapshot_header_t;
+
+typedef std::unordered_map<uint32_t, std::string> MetricsSnapshotValues;   // name hash index
+
+class MetricsSnapshot
+  {
+  public:
+    static uint32_t NameHash(const char* name);
+    static void AddValue(std::string &payload, uint32_t namehash, const std::string &value);
+    static bool Write(const char* path, const std::string &payload, uint16_t count, uint32_t sequence);
+    static bool Read(const char* path, MetricsSnapshotValues &values, uint32_t *sequence=NULL, uint32_t *crc=NULL);
+  };
+
+/**
+ * OvmsMetricsFlashStore: second persistence tier for metrics
+ *
+ * The RTC memory persistence (pmetrics) survives reboots & crashes but
+ * not a power loss, and can only hold 100 32 bit values. The flash tier
+ * stores the metrics selected by config (vehicle metrics.flash, glob
+ * patterns) in a single snapshot record on /store.
+ *
+ * - Changes are collected by a metrics modifier and written in batches,
+ *   at most every metrics.flash.interval seconds and on shutdown.
+ * - Records are written alternating into two slots, a record is only
+ *   written if the payload has changed (CRC), to minimize flash wear.
+ * - On startup, the newest valid record is loaded into a pending set.
+ *   Metrics are restored lazily as they get registered (i.e. also for
+ *   vehicle modules loaded later), if they have not been set already.
+ *   Restored values are marked stale until updated by live data.
+ */
+
+#define METRICS_FLASH_DIR             "/store/.metrics"
+#define METRICS_FLASH_SLOTS           2
+#define METRICS_FLASH_DEFAULT         "v.b.soh,v.b.cac,v.b.c.*"
+#define METRICS_FLASH_INTERVAL        300
+
+class OvmsMetricsFlashStore
+  {
+  public:
+    OvmsMetricsFlashStore();
+    ~OvmsMetricsFlashStore();
+
+  public:
+    void EventListener(const char* event, void* data);
+    bool Save(bool force=false);
+    void Status(OvmsWriter* writer);
+
+  protected:
+    void LoadConfig();
+    void Load();
+    void UpdateSelection();
+    void Ticker();
+    std::string SlotPath(int slot);
+
+  protected:
+    OvmsMutex m_mutex;
+    bool m_ready;                           // /store mounted & config loaded
+    std::vector<std::string> m_patterns;    // selection glob patterns
+    int m_interval;                         // min seconds between writes
+    std::vector<OvmsMetric*> m_selection;   // selected metrics
+    unsigned int m_generation;              // metrics generation of selection
+    size_t m_modifier;                      // metrics modifier for change detection
+    MetricsSnapshotValues m_pending;        // loaded values not yet restored
+    std::set<OvmsMetric*> m_awaiting;       // restored metrics awaiting live data
+    bool m_dirty;
+    uint32_t m_lastsave;                    // monotonictime of last save check
+    uint32_t m_sequence;                    // sequence of last record
+    int m_slot;                             // slot of last record
+    uint32_t m_crc;                         // payload CRC of last record
+
+  public:
+    // Statistics:
+    uint32_t m_cnt_writes;                  // records written
+    uint32_t m_cnt_unchanged;               // writes skipped (unchanged)
+    uint32_t m_cnt_errors;                  // read/write errors
+    uint32_t m_cnt_restored;                // metrics restored
+    uint32_t m_time_loaded;                 // ms after boot: record loaded
+    uint32_t m_time_restored;               // ms after boot: last metric restored
+    uint32_t m_time_live;                   // ms after boot: all restored metrics updated live
+  };
+
+extern OvmsMetricsFlashStore MyMetricsFlashStore;
+
+/**
+ * OvmsMetricsSnapshot: event driven metrics snapshot file for vehicle modules
+ *
+ * Replaces ad hoc SaveStatus() / RestoreStatus() text dumps by a snapshot
+ * record (see above) of the metrics selected by a glob pattern list.
+ * Patterns prefixed by '!' exclude matching metrics, e.g. "*,!m.*,!s.*".
+ *
+ * - The snapshot is saved automatically on the events given (comma separated
+ *   list, default "vehicle.off,system.shutdown"), or explicitly by Save().
+ * - Restore() loads the record into a name hash index and applies it in a
+ *   single pass over the registered metrics.
+ * - Files are replaced atomically, a missing or corrupted file is ignored.
+ *
+ * Usage example (vehicle module):
+ *   m_snapshot = new OvmsMetricsSnapshot(TAG, "/sd/usr/mycar.bin", "v.b.*,v.c.*");
+ *   …
+ *   m_snapshot->Restore();
+ */
+
+#define METRICS_SNAPSHOT_EVENTS       "vehicle.off,system.shutdown"
+
+class OvmsMetricsSnapshot
+  {
+  public:
+    OvmsMetricsSnapshot(const char* owner, const char* path, const char* patterns,
+      const char* events=METRICS_SNAPSHOT_EVENTS);
+    ~OvmsMetricsSnapshot();
+
+  public:
+    bool Save();
+    int Restore(bool stale=false);
+
+  protected:
+    void EventListener(std::string event, void* data);
+    bool IsSelected(const char* name);
+
+  protected:
+    OvmsMutex m_mutex;
+    std::string m_caller;                   // event listener registration name
+    std::string m_path;
+    std::vector<std::string> m_include;     // selection glob patterns
+    std::vector<std::string> m_exclude;     // … exclusion patterns
+    uint32_t m_sequence;                    // sequence of last record
+  };
+
+#endif //#ifndef __OVMS_METRICS_SNAPSHOT_H__
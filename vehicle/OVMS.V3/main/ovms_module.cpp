@@ -924,8 +924,8 @@ static void module_trigger_twdt(int verbosity, OvmsWriter* writer, OvmsCommand*
   {
   ESP_LOGI(TAG,"Triggering task watchdog (on command)");
   // trigger twdt on event task by blocking all events:
-  static auto covid19 = [](std::string event, void* data) { vTaskDelay(portMAX_DELAY); };
-  MyEvents.RegisterEvent(TAG, "ticker.1", covid19);
+  static auto covid19 = [](const char* event, void* data) { vTaskDelay(portMAX_DELAY); };
+  MyEvents.RegisterEventCallback(TAG, "ticker.1", covid19);
   writer->puts(
     "Task watchdog will be triggered in " STR(CONFIG_TASK_WDT_TIMEOUT_S) " seconds.\n"
     "Note: important events will cause reset as soon as queue is full.");
@@ -1152,16 +1152,16 @@ static void module_factory_reset(int verbosity, OvmsWriter* writer, OvmsCommand*
     }
   }
 
-static void module_eventhandler(std::string event, void* data)
+static void module_eventhandler(const char* event, void* data)
   {
-  if (event == "ticker.300")
+  if (strcmp(event, "ticker.300") == 0)
     {
     if (MyConfig.GetParamValueBool("module", "debug.tasks", false))
       module_tasks_data(0, NULL, NULL, 0, NULL);
     }
 
 #ifdef CONFIG_OVMS_COMP_SDCARD
-  else if (event == "sd.mounted")
+  else if (strcmp(event, "sd.mounted") == 0)
     {
     if (unlink("/sd/factoryreset.txt") == 0)
       {
@@ -1169,7 +1169,7 @@ static void module_eventhandler(std::string event, void* data)
       module_perform_factoryreset(NULL);
       }
     }
-  else if (event == "ticker.1")
+  else if (strcmp(event, "ticker.1") == 0)
     {
     static int module_sw2_pushcnt = 0;
     // SW2 is connected to SD_DATA0 so can be 0 due to SD card activity.
@@ -1223,10 +1223,10 @@ class OvmsModuleInit
 #endif
 
 #ifdef CONFIG_OVMS_COMP_SDCARD
-    MyEvents.RegisterEvent(TAG, "sd.mounted", module_eventhandler);
-    MyEvents.RegisterEvent(TAG, "ticker.1", module_eventhandler);
+    MyEvents.RegisterEventCallback(TAG, "sd.mounted", module_eventhandler);
+    MyEvents.RegisterEventCallback(TAG, "ticker.1", module_eventhandler);
 #endif //CONFIG_OVMS_COMP_SDCARD
-    MyEvents.RegisterEvent(TAG, "ticker.300", module_eventhandler);
+    MyEvents.RegisterEventCallback(TAG, "ticker.300", module_eventhandler);
 
     OvmsCommand* cmd_module = MyCommandApp.RegisterCommand("module","MODULE framework");
     cmd_module->RegisterCommand("memory","Show module memory usage",module_memory,"[<task names or ids>|*|=]",0,TASKLIST);
@@ -33,6 +33,9 @@ static const char *TAG = "netmanager";
 
 #include <string.h>
 #include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <esp_timer.h>
 #include <lwip/tcpip.h>
 #include <lwip/ip_addr.h>
 #include <lwip/netif.h>
@@ -56,6 +59,9 @@ static const char *TAG = "netmanager";
 #ifndef CONFIG_OVMS_NETMAN_TASK_PRIORITY
 #define CONFIG_OVMS_NETMAN_TASK_PRIORITY 5
 #endif
+#ifndef CONFIG_OVMS_NETMAN_POLL_TIMEOUT
+#define CONFIG_OVMS_NETMAN_POLL_TIMEOUT 1000
+#endif
 
 OvmsNetManager MyNetManager __attribute__ ((init_priority (8999)));
 
@@ -338,6 +344,52 @@ void network_connections(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, in
     }
   }
 
+void network_latency(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (!MyNetManager.MongooseRunning())
+    {
+    writer->puts("ERROR: Mongoose task not running");
+    return;
+    }
+  if (MyNetManager.IsNetManagerTask())
+    {
+    writer->puts("ERROR: cannot run from the network task");
+    return;
+    }
+
+  // Echo no-op jobs through the netman task to measure the job round trip:
+  int count = (argc > 0) ? atoi(argv[0]) : 10;
+  if (count < 1) count = 1;
+  static netman_job_t job;
+  uint32_t us, us_min = UINT32_MAX, us_max = 0;
+  uint64_t us_sum = 0;
+  int done = 0;
+  for (int i = 0; i < count; i++)
+    {
+    memset(&job, 0, sizeof(job));
+    job.cmd = nmc_none;
+    int64_t start = esp_timer_get_time();
+    if (!MyNetManager.ExecuteJob(&job, pdMS_TO_TICKS(5000)))
+      {
+      writer->puts("ERROR: job failed");
+      break;
+      }
+    us = esp_timer_get_time() - start;
+    if (us < us_min) us_min = us;
+    if (us > us_max) us_max = us;
+    us_sum += us;
+    done++;
+    // let the netman task go back to polling:
+    vTaskDelay(pdMS_TO_TICKS(20));
+    }
+  if (done)
+    {
+    writer->printf("Job round trip: %d samples, min %" PRIu32 " us, avg %" PRIu32 " us, max %" PRIu32 " us\n",
+      done, us_min, (uint32_t)(us_sum / done), us_max);
+    }
+  MyNetManager.ShowMongooseWakeup(writer);
+  }
+
 #endif // CONFIG_OVMS_SC_GPL_MONGOOSE
 
 OvmsNetManager::OvmsNetManager()
@@ -365,6 +417,7 @@ OvmsNetManager::OvmsNetManager()
   m_mongoose_task = 0;
   m_mongoose_running = false;
   m_jobqueue = xQueueCreate(CONFIG_OVMS_HW_NETMANAGER_QUEUE_SIZE, sizeof(netman_job_t*));
+  m_wakeup_conn = NULL;
 #endif //#ifdef CONFIG_OVMS_SC_GPL_MONGOOSE
 
   // Register our commands
@@ -378,6 +431,7 @@ OvmsNetManager::OvmsNetManager()
   cmd_network->RegisterCommand("list", "List network connections", network_connections);
   cmd_network->RegisterCommand("close", "Close network connection(s)", network_connections, "<id>\nUse ID from connection list / 0 to close all", 1, 1);
   cmd_network->RegisterCommand("cleanup", "Close orphaned network connections", network_connections);
+  cmd_network->RegisterCommand("latency", "Measure network task job latency", network_latency, "[<count>]", 0, 1);
 #endif // CONFIG_OVMS_SC_GPL_MONGOOSE
 
   // Register our events
@@ -915,6 +969,12 @@ void OvmsNetManager::MongooseTask()
   // Initialise the mongoose manager
   ESP_LOGD(TAG, "MongooseTask starting");
   mg_mgr_init(&m_mongoose_mgr, NULL);
+  int poll_timeout = CONFIG_OVMS_NETMAN_POLL_TIMEOUT;
+  if (!StartMongooseWakeup())
+    {
+    ESP_LOGW(TAG, "MongooseTask: no wakeup channel, falling back to 250 ms polling");
+    poll_timeout = 250;
+    }
   MyEvents.SignalEvent("network.mgr.init",NULL);
 
   m_mongoose_running = true;
@@ -923,7 +983,7 @@ void OvmsNetManager::MongooseTask()
   while (m_mongoose_running)
     {
     // poll interfaces:
-    if (mg_mgr_poll(&m_mongoose_mgr, 250) == 0)
+    if (mg_mgr_poll(&m_mongoose_mgr, poll_timeout) == 0)
       {
       ESP_LOGD(TAG, "MongooseTask: no interfaces available => exit");
       break;
@@ -946,6 +1006,8 @@ void OvmsNetManager::MongooseTask()
   // Shutdown cleanly
   ESP_LOGD(TAG, "MongooseTask stopping");
   MyEvents.SignalEvent("network.mgr.stop",NULL);
+  m_wakeup.Detach();
+  m_wakeup_conn = NULL;
   mg_mgr_free(&m_mongoose_mgr);
   m_mongoose_task = NULL;
   vTaskDelete(NULL);
@@ -984,6 +1046,66 @@ void OvmsNetManager::StopMongooseTask()
     m_mongoose_running = false;
   }
 
+/**
+ * StartMongooseWakeup: create the wake-up channel
+ *  Jobs, websocket transmissions etc. queued from other tasks would otherwise
+ *  wait for the poll timeout before being processed.
+ */
+bool OvmsNetManager::StartMongooseWakeup()
+  {
+  int sock = m_wakeup.Open();
+  if (sock < 0)
+    return false;
+
+  m_wakeup_conn = mg_add_sock(&m_mongoose_mgr, sock, MongooseWakeupHandler);
+  if (!m_wakeup_conn)
+    {
+    ESP_LOGE(TAG, "StartMongooseWakeup: mg_add_sock failed");
+    m_wakeup.Detach();
+    closesocket(sock);
+    return false;
+    }
+  return true;
+  }
+
+void OvmsNetManager::MongooseWakeupHandler(struct mg_connection *nc, int ev, void *p)
+  {
+  if (ev == MG_EV_RECV)
+    {
+    // Clear the flag first, so a wakeup sent during the job processing isn't lost:
+    MyNetManager.m_wakeup.Received();
+    mbuf_remove(&nc->recv_mbuf, nc->recv_mbuf.len);
+    }
+  else if (ev == MG_EV_CLOSE && nc == MyNetManager.m_wakeup_conn)
+    {
+    // mongoose closes the socket after this event:
+    MyNetManager.m_wakeup.Detach();
+    MyNetManager.m_wakeup_conn = NULL;
+    }
+  }
+
+/**
+ * MongooseWakeup: let the network task return from mg_mgr_poll() now
+ *  Call after queueing work for the network task from another task, i.e.
+ *  jobs, mg_send() via thread safe mbufs, or requests handled on MG_EV_POLL.
+ *  Wakeups are coalesced until the network task has received the pending one.
+ */
+void OvmsNetManager::MongooseWakeup()
+  {
+  if (xTaskGetCurrentTaskHandle() == m_mongoose_task)
+    return;
+  m_wakeup.Send();
+  }
+
+void OvmsNetManager::ShowMongooseWakeup(OvmsWriter* writer)
+  {
+  if (!m_wakeup.IsOpen())
+    writer->printf("Wakeup channel: inactive, poll timeout 250 ms\n");
+  else
+    writer->printf("Wakeup channel: port %u, %" PRIu32 " sent, %" PRIu32 " received, poll timeout %d ms\n",
+      m_wakeup.GetPort(), m_wakeup.GetSent(), m_wakeup.GetReceived(), CONFIG_OVMS_NETMAN_POLL_TIMEOUT);
+  }
+
 void OvmsNetManager::ProcessJobs()
   {
   netman_job_t* job;
@@ -1029,6 +1151,7 @@ bool OvmsNetManager::ExecuteJob(netman_job_t* job, TickType_t timeout /*=portMAX
     ESP_LOGW(TAG, "ExecuteJob: cmd %d: queue overflow", job->cmd);
     return false;
     }
+  MongooseWakeup();
   if (timeout && ulTaskNotifyTake(pdTRUE, timeout) == 0)
     {
     // try to prevent delayed processing (cannot stop if already started):
@@ -1060,7 +1183,7 @@ int OvmsNetManager::ListConnections(int verbosity, OvmsWriter* writer)
   writer->printf("ID        Flags     Handler   Local                  Remote\n");
   for (c = mg_next(&m_mongoose_mgr, NULL); c; c = mg_next(&m_mongoose_mgr, c))
     {
-    if (c->flags & MG_F_LISTENING)
+    if ((c->flags & MG_F_LISTENING) || c == m_wakeup_conn)
       continue;
     mg_conn_addr_to_str(c, local, sizeof(local), MG_SOCK_STRINGIFY_IP|MG_SOCK_STRINGIFY_PORT);
     mg_conn_addr_to_str(c, remote, sizeof(remote), MG_SOCK_STRINGIFY_IP|MG_SOCK_STRINGIFY_PORT|MG_SOCK_STRINGIFY_REMOTE);
@@ -1078,7 +1201,7 @@ int OvmsNetManager::CloseConnection(uint32_t id)
   int cnt = 0;
   for (c = mg_next(&m_mongoose_mgr, NULL); c; c = mg_next(&m_mongoose_mgr, c))
     {
-    if (c->flags & MG_F_LISTENING)
+    if ((c->flags & MG_F_LISTENING) || c == m_wakeup_conn)
       continue;
     if (id == 0 || c == (mg_connection*)id)
       {
@@ -1129,7 +1252,7 @@ int OvmsNetManager::CleanupConnections()
 
   for (c = mg_next(&m_mongoose_mgr, NULL); c; c = mg_next(&m_mongoose_mgr, c))
     {
-    if (c->flags & MG_F_LISTENING)
+    if ((c->flags & MG_F_LISTENING) || c == m_wakeup_conn)
       continue;
 
     // get local address:
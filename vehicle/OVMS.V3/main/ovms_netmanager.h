@@ -52,8 +52,10 @@ extern "C"
 #include "ovms_semaphore.h"
 
 #ifdef CONFIG_OVMS_SC_GPL_MONGOOSE
+#include <atomic>
 #define MG_LOCALS 1
 #include "mongoose.h"
+#include "ovms_wakeup.h"
 
 typedef enum
   {
@@ -164,6 +166,14 @@ class OvmsNetManager
     bool m_mongoose_running;
     QueueHandle_t m_jobqueue;
 
+  protected:
+    // Wake-up channel: a loopback UDP socket polled by mongoose, a datagram
+    // sent to it lets mg_mgr_poll() return immediately.
+    bool StartMongooseWakeup();
+    static void MongooseWakeupHandler(struct mg_connection *nc, int ev, void *p);
+    OvmsWakeupChannel m_wakeup;
+    struct mg_connection* m_wakeup_conn;
+
   public:
     void MongooseTask();
     TaskHandle_t GetMongooseTaskHandle() { return m_mongoose_task; }
@@ -171,6 +181,8 @@ class OvmsNetManager
     bool MongooseRunning();
     void ProcessJobs();
     bool ExecuteJob(netman_job_t* job, TickType_t timeout=portMAX_DELAY);
+    void MongooseWakeup();
+    void ShowMongooseWakeup(OvmsWriter* writer);
     void ScheduleCleanup();
     int ListConnections(int verbosity, OvmsWriter* writer);
     int CloseConnection(uint32_t id);
@@ -146,7 +146,7 @@ OvmsTime::OvmsTime()
   using std::placeholders::_2;
   MyEvents.RegisterEvent(TAG,"system.start", std::bind(&OvmsTime::EventSystemStart, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"config.changed", std::bind(&OvmsTime::EventConfigChanged, this, _1, _2));
-  MyEvents.RegisterEvent(TAG,"ticker.60", std::bind(&OvmsTime::EventTicker60, this, _1, _2));
+  MyEvents.RegisterEventCallback(TAG,"ticker.60", std::bind(&OvmsTime::EventTicker60, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"network.up", std::bind(&OvmsTime::EventNetUp, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"network.down", std::bind(&OvmsTime::EventNetDown, this, _1, _2));
   MyEvents.RegisterEvent(TAG,"network.reconfigured", std::bind(&OvmsTime::EventNetReconfigured, this, _1, _2));
@@ -175,7 +175,7 @@ void OvmsTime::EventSystemStart(std::string event, void* data)
   tzset();
   }
 
-void OvmsTime::EventTicker60(std::string event, void* data)
+void OvmsTime::EventTicker60(const char* event, void* data)
   {
   // Refresh SNTP, if possible
   if (sntp_enabled() && MyNetManager.m_connected_any)
@@ -0,0 +1,139 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "wakeup";
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ovms_wakeup.h"
+
+OvmsWakeupChannel::OvmsWakeupChannel()
+  {
+  m_sock = -1;
+  m_senders = 0;
+  m_pending = false;
+  memset(&m_addr, 0, sizeof(m_addr));
+  m_sent = 0;
+  m_received = 0;
+  }
+
+OvmsWakeupChannel::~OvmsWakeupChannel()
+  {
+  }
+
+/**
+ * Open: create the socket, bound to a free loopback port
+ *  Returns the socket, or -1 on error. The caller owns the socket.
+ */
+int OvmsWakeupChannel::Open()
+  {
+  int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if (sock < 0)
+    {
+    ESP_LOGE(TAG, "Open: socket failed, errno=%d", errno);
+    return -1;
+    }
+
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+      getsockname(sock, (struct sockaddr*)&addr, &len) != 0)
+    {
+    ESP_LOGE(TAG, "Open: bind failed, errno=%d", errno);
+    close(sock);
+    return -1;
+    }
+  fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+
+  m_addr = addr;
+  m_pending = false;
+  m_sock.store(sock);
+  ESP_LOGD(TAG, "Open: listening on port %u", ntohs(addr.sin_port));
+  return sock;
+  }
+
+/**
+ * Detach: stop sending, to be called by the owner before closing the socket
+ *  On return, no Send() call uses the socket anymore.
+ */
+void OvmsWakeupChannel::Detach()
+  {
+  if (m_sock.exchange(-1) < 0)
+    return;
+  // Send() increments m_senders before reading m_sock, so any sender still
+  // holding the old descriptor is counted here:
+  while (m_senders.load() != 0)
+    vTaskDelay(1);
+  }
+
+/**
+ * Send: wake up the owner task, called from other tasks
+ *  Returns true if a datagram has been sent, false if coalesced or closed.
+ */
+bool OvmsWakeupChannel::Send()
+  {
+  bool sent = false;
+  m_senders.fetch_add(1);
+  int sock = m_sock.load();
+  if (sock >= 0 && !m_pending.exchange(true))
+    {
+    uint8_t dummy = 0;
+    if (sendto(sock, &dummy, 1, 0, (struct sockaddr*)&m_addr, sizeof(m_addr)) == 1)
+      {
+      m_sent++;
+      sent = true;
+      }
+    else
+      m_pending = false;
+    }
+  m_senders.fetch_sub(1);
+  return sent;
+  }
+
+/**
+ * Received: the owner got a datagram, call once per datagram read
+ *  Clears the pending flag before the owner processes the work, so a wakeup
+ *  sent meanwhile isn't lost.
+ */
+void OvmsWakeupChannel::Received()
+  {
+  m_pending = false;
+  m_received++;
+  }
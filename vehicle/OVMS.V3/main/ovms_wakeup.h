@@ -0,0 +1,77 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OVMS_WAKEUP_H__
+#define __OVMS_WAKEUP_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <netinet/in.h>
+
+/**
+ * OvmsWakeupChannel: loopback UDP socket to wake up a task blocking in select()
+ *
+ *  The owner task creates the socket by Open() and adds it to its select() set
+ *  (e.g. via mg_add_sock()), other tasks call Send() to make the select() return.
+ *  The socket sends to itself, so the channel only needs one socket. Wakeups are
+ *  coalesced until the owner has called Received().
+ *
+ *  The owner must call Detach() before closing the socket: Send() reads the
+ *  socket once, Detach() swaps it to -1 and waits for senders still using the
+ *  old descriptor, so a datagram can never go to a socket reusing the number.
+ */
+class OvmsWakeupChannel
+  {
+  public:
+    OvmsWakeupChannel();
+    ~OvmsWakeupChannel();
+
+  public:
+    int Open();
+    void Detach();
+    bool Send();
+    void Received();
+
+  public:
+    bool IsOpen() { return m_sock.load() >= 0; }
+    uint16_t GetPort() { return ntohs(m_addr.sin_port); }
+    uint32_t GetSent() { return m_sent.load(); }
+    uint32_t GetReceived() { return m_received.load(); }
+
+  protected:
+    std::atomic<int>      m_sock;
+    std::atomic<int>      m_senders;      // Send() calls using m_sock
+    std::atomic<bool>     m_pending;      // Datagram sent, not yet received
+    struct sockaddr_in    m_addr;
+    std::atomic<uint32_t> m_sent;
+    std::atomic<uint32_t> m_received;
+  };
+
+#endif //#ifndef __OVMS_WAKEUP_H__
@@ -0,0 +1,88 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Minimal host test support
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+// Host tests compile framework independent parts of the firmware with the
+// native compiler, see the Makefile. Each test is a program returning 0 on
+// success; benchmarks print their results.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static int host_test_failures = 0;
+static int host_test_checks = 0;
+
+#define CHECK(cond) \
+  do { \
+    host_test_checks++; \
+    if (!(cond)) \
+      { \
+      host_test_failures++; \
+      if (host_test_failures <= 20) \
+        fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+      } \
+  } while (0)
+
+#define CHECKF(cond, ...) \
+  do { \
+    host_test_checks++; \
+    if (!(cond)) \
+      { \
+      host_test_failures++; \
+      if (host_test_failures <= 20) \
+        { \
+        fprintf(stderr, "%s:%d: CHECK failed: %s: ", __FILE__, __LINE__, #cond); \
+        fprintf(stderr, __VA_ARGS__); \
+        fputc('\n', stderr); \
+        } \
+      } \
+  } while (0)
+
+static inline int host_test_result(const char* name)
+  {
+  printf("%s: %d checks, %d failed\n", name, host_test_checks, host_test_failures);
+  return host_test_failures ? 1 : 0;
+  }
+
+// Monotonic time [µs] for benchmarks:
+static inline double host_test_us()
+  {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+// Deterministic pseudo random numbers (xorshift32):
+static inline uint32_t host_test_rand(uint32_t &state)
+  {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+  }
+
+#endif //#ifndef __HOST_TEST_H__
@@ -0,0 +1,83 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: FreeRTOS API on POSIX threads (see host_freertos.cpp)
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef TickType_t portTickType;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  1
+#define pdFAIL                  0
+#define errQUEUE_EMPTY          0
+#define errQUEUE_FULL           0
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS      1
+#define portTICK_RATE_MS        portTICK_PERIOD_MS
+#define configTICK_RATE_HZ      1000
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define configASSERT(x)         assert(x)
+#define portYIELD()             host_yield()
+#define portYIELD_FROM_ISR()
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+// newlib <sys/cdefs.h> provides the C11 keyword to C++:
+#if defined(__cplusplus) && !defined(_Alignas)
+#define _Alignas(x)             alignas(x)
+#endif
+
+// Critical sections: one global recursive lock
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+#define portENTER_CRITICAL(mux)         host_enter_critical()
+#define portEXIT_CRITICAL(mux)          host_exit_critical()
+#define portENTER_CRITICAL_ISR(mux)     host_enter_critical()
+#define portEXIT_CRITICAL_ISR(mux)      host_exit_critical()
+#define taskENTER_CRITICAL(mux)         host_enter_critical()
+#define taskEXIT_CRITICAL(mux)          host_exit_critical()
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void host_enter_critical(void);
+void host_exit_critical(void);
+void host_yield(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif //#ifndef __HOST_FREERTOS_H__
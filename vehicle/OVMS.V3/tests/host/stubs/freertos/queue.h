@@ -0,0 +1,58 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: FreeRTOS queues
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_FREERTOS_QUEUE_H__
+#define __HOST_FREERTOS_QUEUE_H__
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_queue* QueueHandle_t;
+typedef QueueHandle_t xQueueHandle;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemsize);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueGenericSend(QueueHandle_t queue, const void* item, TickType_t ticks, int front);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks);
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticks);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+#define xQueueSend(q,i,t)                   xQueueGenericSend(q,i,t,0)
+#define xQueueSendToBack(q,i,t)             xQueueGenericSend(q,i,t,0)
+#define xQueueSendToFront(q,i,t)            xQueueGenericSend(q,i,t,1)
+#define xQueueSendFromISR(q,i,w)            xQueueGenericSend(q,i,0,0)
+#define xQueueSendToBackFromISR(q,i,w)      xQueueGenericSend(q,i,0,0)
+#define xQueueReceiveFromISR(q,i,w)         xQueueReceive(q,i,0)
+#define uxQueueMessagesWaitingFromISR(q)    uxQueueMessagesWaiting(q)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //#ifndef __HOST_FREERTOS_QUEUE_H__
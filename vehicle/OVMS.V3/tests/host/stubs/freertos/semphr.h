@@ -0,0 +1,62 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: FreeRTOS semaphores & mutexes
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_FREERTOS_SEMPHR_H__
+#define __HOST_FREERTOS_SEMPHR_H__
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+typedef SemaphoreHandle_t xSemaphoreHandle;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Mutexes are owned by the taking task, binary & counting semaphores are not:
+SemaphoreHandle_t host_semaphore_create(int kind, UBaseType_t max, UBaseType_t initial);
+BaseType_t host_semaphore_take(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t host_semaphore_give(SemaphoreHandle_t sem);
+TaskHandle_t host_semaphore_holder(SemaphoreHandle_t sem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define xSemaphoreCreateMutex()             host_semaphore_create(1, 1, 1)
+#define xSemaphoreCreateRecursiveMutex()    host_semaphore_create(2, 1, 1)
+#define xSemaphoreCreateBinary()            host_semaphore_create(0, 1, 0)
+#define xSemaphoreCreateCounting(m,i)       host_semaphore_create(0, m, i)
+#define xSemaphoreTake(s,t)                 host_semaphore_take(s,t)
+#define xSemaphoreGive(s)                   host_semaphore_give(s)
+#define xSemaphoreTakeRecursive(s,t)        host_semaphore_take(s,t)
+#define xSemaphoreGiveRecursive(s)          host_semaphore_give(s)
+#define xSemaphoreGiveFromISR(s,w)          host_semaphore_give(s)
+#define xSemaphoreGetMutexHolder(s)         host_semaphore_holder(s)
+#define vSemaphoreDelete(s)                 vQueueDelete(s)
+#define uxSemaphoreGetCount(s)              uxQueueMessagesWaiting(s)
+
+#endif //#ifndef __HOST_FREERTOS_SEMPHR_H__
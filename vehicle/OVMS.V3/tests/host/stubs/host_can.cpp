@@ -0,0 +1,258 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: CAN bus base class
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+// canbus is a null device here: tests derive their bus models from it and
+// override Write(). MyCan dispatches received frames & TX results to the
+// registered callbacks on its rx task like the framework does, without
+// commands, logging and playback.
+
+#include <string.h>
+#include "can.h"
+
+pcpapp MyPcpApp __attribute__ ((init_priority (4000)));
+can MyCan __attribute__ ((init_priority (4510)));
+
+////////////////////////////////////////////////////////////////////////
+// Power control
+////////////////////////////////////////////////////////////////////////
+
+pcpapp::pcpapp() {}
+pcpapp::~pcpapp() {}
+void pcpapp::Register(const char* name, pcp* device) { m_map[name] = device; }
+void pcpapp::Deregister(const char* name) { m_map.erase(name); }
+
+pcp* pcpapp::FindDeviceByName(const char* name)
+  {
+  auto iter = m_map.find(name);
+  return (iter != m_map.end()) ? iter->second : NULL;
+  }
+
+pcp::pcp(const char* name) : m_name(name), m_powermode(On) { MyPcpApp.Register(name, this); }
+pcp::~pcp() { MyPcpApp.Deregister(m_name); }
+void pcp::SetPowerMode(PowerMode powermode) { m_powermode = powermode; }
+const char* pcp::GetName() { return m_name; }
+PowerMode pcp::GetPowerMode() { return m_powermode; }
+
+
+////////////////////////////////////////////////////////////////////////
+// CAN
+////////////////////////////////////////////////////////////////////////
+
+esp_err_t CAN_frame_t::Write(canbus* bus, TickType_t maxqueuewait)
+  {
+  if (!bus) bus = origin;
+  return bus ? bus->Write(this, maxqueuewait) : ESP_FAIL;
+  }
+
+canbus::canbus(const char* name) : pcp(name)
+  {
+  m_speed = CAN_SPEED_500KBPS;
+  m_mode = CAN_MODE_ACTIVE;
+  memset(&m_status, 0, sizeof(m_status));
+  memset(&m_tx_frame, 0, sizeof(m_tx_frame));
+  m_status_chksum = 0;
+  m_watchdog_timer = 0;
+  m_state = 0;
+  m_txqueue = NULL;
+  m_busnumber = name[strlen(name)-1] - '1';
+  m_dbcfile = NULL;
+  m_acceptance_enabled = false;
+  m_acceptance_active = false;
+  }
+
+canbus::~canbus() {}
+esp_err_t canbus::Start(CAN_mode_t mode, CAN_speed_t speed) { m_mode = mode; m_speed = speed; return ESP_OK; }
+esp_err_t canbus::Start(CAN_mode_t mode, CAN_speed_t speed, dbcfile *dbcfile) { return Start(mode, speed); }
+esp_err_t canbus::Stop() { m_mode = CAN_MODE_OFF; return ESP_OK; }
+esp_err_t canbus::Reset() { return ESP_OK; }
+void canbus::ClearStatus() { memset(&m_status, 0, sizeof(m_status)); }
+esp_err_t canbus::ViewRegisters() { return ESP_ERR_NOT_SUPPORTED; }
+esp_err_t canbus::WriteReg(uint8_t reg, uint8_t value) { return ESP_ERR_NOT_SUPPORTED; }
+esp_err_t canbus::Write(const CAN_frame_t* p_frame, TickType_t maxqueuewait) { return ESP_OK; }
+esp_err_t canbus::WriteExtended(uint32_t id, uint8_t length, uint8_t *data, TickType_t maxqueuewait)
+  {
+  CAN_frame_t frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.origin = this;
+  frame.FIR.B.DLC = length;
+  frame.FIR.B.FF = CAN_frame_ext;
+  frame.MsgID = id;
+  memcpy(frame.data.u8, data, length);
+  return this->Write(&frame, maxqueuewait);
+  }
+esp_err_t canbus::WriteStandard(uint16_t id, uint8_t length, uint8_t *data, TickType_t maxqueuewait)
+  {
+  CAN_frame_t frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.origin = this;
+  frame.FIR.B.DLC = length;
+  frame.FIR.B.FF = CAN_frame_std;
+  frame.MsgID = id;
+  memcpy(frame.data.u8, data, length);
+  return this->Write(&frame, maxqueuewait);
+  }
+esp_err_t canbus::QueueWrite(const CAN_frame_t* p_frame, TickType_t maxqueuewait) { return ESP_QUEUED; }
+bool canbus::AsynchronousInterruptHandler(CAN_frame_t* frame, uint32_t* framesReceived) { return false; }
+
+void canbus::TxCallback(CAN_frame_t* frame, bool success)
+  {
+  if (success)
+    m_status.packets_tx++;
+  else
+    m_status.tx_fails++;
+  MyCan.ExecuteCallbacks(frame, true, success);
+  if (success)
+    MyCan.NotifyListeners(frame, true);
+  }
+void canbus::BusTicker10(const char* event, void* data) {}
+
+void canbus::AddAcceptance(const char* caller, uint32_t id_from, uint32_t id_to, bool extended)
+  {
+  OvmsMutexLock lock(&m_acceptance_mutex);
+  m_acceptance[caller].push_back({ id_from, id_to, extended });
+  }
+
+void canbus::SetAcceptance(const char* caller, const CAN_acceptance_list_t &list)
+  {
+  OvmsMutexLock lock(&m_acceptance_mutex);
+  if (list.empty())
+    m_acceptance.erase(caller);
+  else
+    m_acceptance[caller] = list;
+  }
+
+void canbus::RemoveAcceptance(const char* caller)
+  {
+  OvmsMutexLock lock(&m_acceptance_mutex);
+  m_acceptance.erase(caller);
+  }
+
+float canbus::AcceptanceCoverage(bool extended) { return 1; }
+esp_err_t canbus::SetAcceptanceFilter(const CAN_acceptance_list_t* list) { return ESP_ERR_NOT_SUPPORTED; }
+
+
+////////////////////////////////////////////////////////////////////////
+// CAN system: rx task & callbacks
+////////////////////////////////////////////////////////////////////////
+
+void can::CAN_rxtask(void *pvParameters)
+  {
+  can *me = (can*)pvParameters;
+  CAN_queue_msg_t msg;
+  while (true)
+    {
+    if (xQueueReceive(me->m_rxqueue, &msg, portMAX_DELAY) != pdTRUE)
+      continue;
+    switch (msg.type)
+      {
+      case CAN_frame:
+        me->IncomingFrame(&msg.body.frame);
+        break;
+      case CAN_txcallback:
+        msg.body.bus->TxCallback(&msg.body.frame, true);
+        break;
+      case CAN_txfailedcallback:
+        msg.body.bus->TxCallback(&msg.body.frame, false);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+can::can()
+  {
+  m_logger_id = 1;
+  m_player_id = 1;
+  for (int k = 0; k < CAN_MAXBUSES; k++)
+    m_buslist[k] = NULL;
+  m_rxqueue = xQueueCreate(CONFIG_OVMS_HW_CAN_RX_QUEUE_SIZE, sizeof(CAN_queue_msg_t));
+  xTaskCreatePinnedToCore(CAN_rxtask, "OVMS CanRx", 2*2048, (void*)this, 23, &m_rxtask, CORE(0));
+  m_ring.SetWriter(m_rxtask);
+  }
+
+can::~can() {}
+
+void can::IncomingFrame(CAN_frame_t* p_frame)
+  {
+  if (xTaskGetCurrentTaskHandle() != m_rxtask)
+    {
+    CAN_queue_msg_t msg;
+    msg.type = CAN_frame;
+    msg.body.frame = *p_frame;
+    if (xQueueSend(m_rxqueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE)
+      p_frame->origin->m_status.rxbuf_overflow++;
+    return;
+    }
+  p_frame->origin->m_status.packets_rx++;
+  ExecuteCallbacks(p_frame, false, true);
+  NotifyListeners(p_frame, false);
+  }
+
+void can::NotifyListeners(const CAN_frame_t* frame, bool tx)
+  {
+  m_ring.Write(tx ? CAN_LogFrame_TX : CAN_LogFrame_RX, frame);
+  }
+
+void can::RegisterCallback(const char* caller, CanFrameCallback callback, bool txfeedback)
+  {
+  if (txfeedback)
+    m_txcallbacks.push_back(new CanFrameCallbackEntry(caller, callback));
+  else
+    m_rxcallbacks.push_back(new CanFrameCallbackEntry(caller, callback));
+  }
+
+void can::DeregisterCallback(const char* caller)
+  {
+  m_rxcallbacks.remove_if([caller](CanFrameCallbackEntry* entry){ return strcmp(entry->m_caller, caller)==0; });
+  m_txcallbacks.remove_if([caller](CanFrameCallbackEntry* entry){ return strcmp(entry->m_caller, caller)==0; });
+  }
+
+int can::ExecuteCallbacks(const CAN_frame_t* frame, bool tx, bool success)
+  {
+  int cnt = 0;
+  if (tx)
+    {
+    if (frame->callback)
+      {
+      (*(frame->callback))(frame, success);
+      cnt++;
+      }
+    for (auto entry : m_txcallbacks)
+      {
+      entry->m_callback(frame, success);
+      cnt++;
+      }
+    }
+  else
+    {
+    for (auto entry : m_rxcallbacks)
+      {
+      entry->m_callback(frame, success);
+      cnt++;
+      }
+    }
+  return cnt;
+  }
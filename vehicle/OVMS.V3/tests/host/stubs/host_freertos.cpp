@@ -0,0 +1,659 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: FreeRTOS API on POSIX threads
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+// Tasks are threads, ticks are milliseconds of CLOCK_MONOTONIC. Priorities and
+// core affinities are ignored. vTaskDelete() & vTaskSuspend() only support the
+// calling task. Timer callbacks run on a timer service thread started on the
+// first timer use.
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <deque>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+
+struct host_task
+  {
+  pthread_t thread;
+  char name[32];
+  TaskFunction_t fn;
+  void* param;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  uint32_t notify_value;
+  bool notify_pending;
+  };
+
+struct host_queue
+  {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int kind;                     // -1 = queue, 0 = semaphore, 1 = mutex, 2 = recursive mutex
+  // queue:
+  size_t itemsize;
+  size_t length;
+  size_t head;
+  size_t count;
+  std::vector<uint8_t> data;
+  // semaphore:
+  UBaseType_t max;
+  UBaseType_t avail;
+  TaskHandle_t owner;
+  int depth;
+  };
+
+static thread_local host_task* s_current = NULL;
+static pthread_mutex_t s_critical;
+static pthread_condattr_t s_condattr;       // conditions use CLOCK_MONOTONIC
+static pthread_once_t s_once = PTHREAD_ONCE_INIT;
+static struct timespec s_start;
+
+static void host_init()
+  {
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&s_critical, &attr);
+  pthread_condattr_init(&s_condattr);
+  pthread_condattr_setclock(&s_condattr, CLOCK_MONOTONIC);
+  clock_gettime(CLOCK_MONOTONIC, &s_start);
+  }
+
+static host_task* host_task_new(const char* name)
+  {
+  pthread_once(&s_once, host_init);
+  host_task* t = new host_task();
+  strncpy(t->name, name, sizeof(t->name)-1);
+  pthread_mutex_init(&t->mutex, NULL);
+  pthread_cond_init(&t->cond, &s_condattr);
+  return t;
+  }
+
+static void host_deadline(TickType_t ticks, struct timespec &ts)
+  {
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ts.tv_sec += ticks / 1000;
+  ts.tv_nsec += (ticks % 1000) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L)
+    {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+    }
+  }
+
+// Wait on cond until pred() or timeout, mutex locked:
+template <class PRED> static bool host_wait(pthread_cond_t* cond, pthread_mutex_t* mutex, TickType_t ticks, PRED pred)
+  {
+  if (pred())
+    return true;
+  if (ticks == 0)
+    return false;
+  struct timespec ts;
+  if (ticks != portMAX_DELAY)
+    host_deadline(ticks, ts);
+  while (!pred())
+    {
+    if (ticks == portMAX_DELAY)
+      pthread_cond_wait(cond, mutex);
+    else if (pthread_cond_timedwait(cond, mutex, &ts) != 0)
+      return pred();
+    }
+  return true;
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Critical sections
+////////////////////////////////////////////////////////////////////////
+
+extern "C" void host_enter_critical(void)
+  {
+  pthread_once(&s_once, host_init);
+  pthread_mutex_lock(&s_critical);
+  }
+
+extern "C" void host_exit_critical(void)
+  {
+  pthread_mutex_unlock(&s_critical);
+  }
+
+extern "C" void host_yield(void)
+  {
+  sched_yield();
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Tasks
+////////////////////////////////////////////////////////////////////////
+
+static void* host_task_run(void* arg)
+  {
+  host_task* t = (host_task*) arg;
+  s_current = t;
+  t->fn(t->param);
+  return NULL;
+  }
+
+extern "C" BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack,
+  void* param, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core)
+  {
+  host_task* t = host_task_new(name);
+  t->fn = fn;
+  t->param = param;
+  if (handle)
+    *handle = t;
+  if (pthread_create(&t->thread, NULL, host_task_run, t) != 0)
+    return pdFAIL;
+  pthread_detach(t->thread);
+  return pdPASS;
+  }
+
+extern "C" BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack,
+  void* param, UBaseType_t prio, TaskHandle_t* handle)
+  {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, prio, handle, tskNO_AFFINITY);
+  }
+
+extern "C" void vTaskDelete(TaskHandle_t task)
+  {
+  if (task == NULL || task == s_current)
+    pthread_exit(NULL);
+  // deleting other tasks is not supported
+  }
+
+extern "C" void vTaskDelay(TickType_t ticks)
+  {
+  struct timespec ts;
+  ts.tv_sec = ticks / 1000;
+  ts.tv_nsec = (ticks % 1000) * 1000000L;
+  if (ticks == 0)
+    sched_yield();
+  else
+    nanosleep(&ts, NULL);
+  }
+
+extern "C" void vTaskSuspend(TaskHandle_t task)
+  {
+  if (task && task != s_current)
+    return;   // suspending other tasks is not supported
+  pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+  pthread_mutex_lock(&mutex);
+  while (true)
+    pthread_cond_wait(&cond, &mutex);
+  }
+
+extern "C" TickType_t xTaskGetTickCount(void)
+  {
+  pthread_once(&s_once, host_init);
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (TickType_t)((ts.tv_sec - s_start.tv_sec) * 1000 + (ts.tv_nsec - s_start.tv_nsec) / 1000000);
+  }
+
+extern "C" TickType_t xTaskGetTickCountFromISR(void)
+  {
+  return xTaskGetTickCount();
+  }
+
+extern "C" TaskHandle_t xTaskGetCurrentTaskHandle(void)
+  {
+  if (!s_current)
+    {
+    // thread not created by xTaskCreate, e.g. main():
+    s_current = host_task_new("main");
+    s_current->thread = pthread_self();
+    }
+  return s_current;
+  }
+
+extern "C" const char* pcTaskGetTaskName(TaskHandle_t task)
+  {
+  if (!task)
+    task = xTaskGetCurrentTaskHandle();
+  return task->name;
+  }
+
+extern "C" UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+  {
+  return 1024;
+  }
+
+extern "C" BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+  {
+  BaseType_t res = pdPASS;
+  pthread_mutex_lock(&task->mutex);
+  switch (action)
+    {
+    case eSetBits:                    task->notify_value |= value; break;
+    case eIncrement:                  task->notify_value++; break;
+    case eSetValueWithOverwrite:      task->notify_value = value; break;
+    case eSetValueWithoutOverwrite:
+      if (task->notify_pending)
+        res = pdFAIL;
+      else
+        task->notify_value = value;
+      break;
+    default:                          break;
+    }
+  task->notify_pending = true;
+  pthread_cond_broadcast(&task->cond);
+  pthread_mutex_unlock(&task->mutex);
+  return res;
+  }
+
+extern "C" BaseType_t xTaskNotifyGive(TaskHandle_t task)
+  {
+  return xTaskNotify(task, 0, eIncrement);
+  }
+
+extern "C" uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+  {
+  host_task* t = xTaskGetCurrentTaskHandle();
+  pthread_mutex_lock(&t->mutex);
+  host_wait(&t->cond, &t->mutex, ticks, [t]() { return t->notify_value != 0; });
+  uint32_t value = t->notify_value;
+  if (value)
+    t->notify_value = clear ? 0 : value - 1;
+  t->notify_pending = false;
+  pthread_mutex_unlock(&t->mutex);
+  return value;
+  }
+
+extern "C" BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* value, TickType_t ticks)
+  {
+  host_task* t = xTaskGetCurrentTaskHandle();
+  pthread_mutex_lock(&t->mutex);
+  if (!t->notify_pending)
+    t->notify_value &= ~clear_on_entry;
+  bool got = host_wait(&t->cond, &t->mutex, ticks, [t]() { return t->notify_pending; });
+  if (value)
+    *value = t->notify_value;
+  if (got)
+    {
+    t->notify_value &= ~clear_on_exit;
+    t->notify_pending = false;
+    }
+  pthread_mutex_unlock(&t->mutex);
+  return got ? pdTRUE : pdFALSE;
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Queues & semaphores
+////////////////////////////////////////////////////////////////////////
+
+static host_queue* host_queue_new(int kind)
+  {
+  pthread_once(&s_once, host_init);
+  host_queue* q = new host_queue();
+  pthread_mutex_init(&q->mutex, NULL);
+  pthread_cond_init(&q->cond, &s_condattr);
+  q->kind = kind;
+  return q;
+  }
+
+extern "C" QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemsize)
+  {
+  host_queue* q = host_queue_new(-1);
+  q->itemsize = itemsize;
+  q->length = length;
+  q->data.resize(length * itemsize);
+  return q;
+  }
+
+extern "C" void vQueueDelete(QueueHandle_t q)
+  {
+  if (!q) return;
+  pthread_cond_destroy(&q->cond);
+  pthread_mutex_destroy(&q->mutex);
+  delete q;
+  }
+
+extern "C" BaseType_t xQueueGenericSend(QueueHandle_t q, const void* item, TickType_t ticks, int front)
+  {
+  pthread_mutex_lock(&q->mutex);
+  if (!host_wait(&q->cond, &q->mutex, ticks, [q]() { return q->count < q->length; }))
+    {
+    pthread_mutex_unlock(&q->mutex);
+    return pdFAIL;
+    }
+  size_t pos;
+  if (front)
+    {
+    q->head = (q->head + q->length - 1) % q->length;
+    pos = q->head;
+    }
+  else
+    pos = (q->head + q->count) % q->length;
+  memcpy(&q->data[pos * q->itemsize], item, q->itemsize);
+  q->count++;
+  pthread_cond_broadcast(&q->cond);
+  pthread_mutex_unlock(&q->mutex);
+  return pdPASS;
+  }
+
+static BaseType_t host_queue_get(QueueHandle_t q, void* item, TickType_t ticks, bool remove)
+  {
+  pthread_mutex_lock(&q->mutex);
+  if (!host_wait(&q->cond, &q->mutex, ticks, [q]() { return q->count > 0; }))
+    {
+    pthread_mutex_unlock(&q->mutex);
+    return pdFAIL;
+    }
+  memcpy(item, &q->data[q->head * q->itemsize], q->itemsize);
+  if (remove)
+    {
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    pthread_cond_broadcast(&q->cond);
+    }
+  pthread_mutex_unlock(&q->mutex);
+  return pdPASS;
+  }
+
+extern "C" BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t ticks)
+  {
+  return host_queue_get(q, item, ticks, true);
+  }
+
+extern "C" BaseType_t xQueuePeek(QueueHandle_t q, void* item, TickType_t ticks)
+  {
+  return host_queue_get(q, item, ticks, false);
+  }
+
+extern "C" BaseType_t xQueueReset(QueueHandle_t q)
+  {
+  pthread_mutex_lock(&q->mutex);
+  q->head = 0;
+  q->count = 0;
+  pthread_cond_broadcast(&q->cond);
+  pthread_mutex_unlock(&q->mutex);
+  return pdPASS;
+  }
+
+extern "C" UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+  {
+  pthread_mutex_lock(&q->mutex);
+  UBaseType_t n = (q->kind < 0) ? q->count : q->avail;
+  pthread_mutex_unlock(&q->mutex);
+  return n;
+  }
+
+extern "C" UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q)
+  {
+  pthread_mutex_lock(&q->mutex);
+  UBaseType_t n = q->length - q->count;
+  pthread_mutex_unlock(&q->mutex);
+  return n;
+  }
+
+extern "C" SemaphoreHandle_t host_semaphore_create(int kind, UBaseType_t max, UBaseType_t initial)
+  {
+  host_queue* q = host_queue_new(kind);
+  q->max = max;
+  q->avail = initial;
+  return q;
+  }
+
+extern "C" BaseType_t host_semaphore_take(SemaphoreHandle_t q, TickType_t ticks)
+  {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  pthread_mutex_lock(&q->mutex);
+  if (q->kind == 2 && q->owner == self)
+    {
+    q->depth++;
+    pthread_mutex_unlock(&q->mutex);
+    return pdPASS;
+    }
+  if (!host_wait(&q->cond, &q->mutex, ticks, [q]() { return q->avail > 0; }))
+    {
+    pthread_mutex_unlock(&q->mutex);
+    return pdFAIL;
+    }
+  q->avail--;
+  if (q->kind > 0)
+    {
+    q->owner = self;
+    q->depth = 1;
+    }
+  pthread_mutex_unlock(&q->mutex);
+  return pdPASS;
+  }
+
+extern "C" BaseType_t host_semaphore_give(SemaphoreHandle_t q)
+  {
+  pthread_mutex_lock(&q->mutex);
+  if (q->kind > 0)
+    {
+    if (q->owner != xTaskGetCurrentTaskHandle())
+      {
+      pthread_mutex_unlock(&q->mutex);
+      return pdFAIL;
+      }
+    if (--q->depth > 0)
+      {
+      pthread_mutex_unlock(&q->mutex);
+      return pdPASS;
+      }
+    q->owner = NULL;
+    }
+  if (q->avail >= q->max)
+    {
+    pthread_mutex_unlock(&q->mutex);
+    return pdFAIL;
+    }
+  q->avail++;
+  pthread_cond_broadcast(&q->cond);
+  pthread_mutex_unlock(&q->mutex);
+  return pdPASS;
+  }
+
+extern "C" TaskHandle_t host_semaphore_holder(SemaphoreHandle_t q)
+  {
+  pthread_mutex_lock(&q->mutex);
+  TaskHandle_t owner = q->owner;
+  pthread_mutex_unlock(&q->mutex);
+  return owner;
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Software timers
+////////////////////////////////////////////////////////////////////////
+
+struct host_timer
+  {
+  char name[32];
+  TickType_t period;
+  bool autoreload;
+  void* id;
+  TimerCallbackFunction_t callback;
+  bool active;
+  TickType_t expiry;
+  };
+
+struct host_pended_call
+  {
+  PendedFunction_t fn;
+  void* param1;
+  uint32_t param2;
+  };
+
+static pthread_mutex_t s_timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_timer_cond;
+static pthread_once_t s_timer_once = PTHREAD_ONCE_INIT;
+static std::vector<host_timer*> s_timers;
+static std::deque<host_pended_call> s_pended;
+
+static void host_timer_task(void* param)
+  {
+  pthread_mutex_lock(&s_timer_mutex);
+  while (true)
+    {
+    // pended calls first, then due timers, each called unlocked:
+    if (!s_pended.empty())
+      {
+      host_pended_call call = s_pended.front();
+      s_pended.pop_front();
+      pthread_mutex_unlock(&s_timer_mutex);
+      call.fn(call.param1, call.param2);
+      pthread_mutex_lock(&s_timer_mutex);
+      continue;
+      }
+    TickType_t now = xTaskGetTickCount();
+    host_timer* due = NULL;
+    TickType_t wait = portMAX_DELAY;
+    for (host_timer* t : s_timers)
+      {
+      if (!t->active)
+        continue;
+      int32_t left = (int32_t)(t->expiry - now);
+      if (left <= 0)
+        {
+        due = t;
+        break;
+        }
+      if ((TickType_t)left < wait)
+        wait = left;
+      }
+    if (due)
+      {
+      if (due->autoreload)
+        due->expiry += due->period;
+      else
+        due->active = false;
+      TimerCallbackFunction_t callback = due->callback;
+      pthread_mutex_unlock(&s_timer_mutex);
+      callback(due);
+      pthread_mutex_lock(&s_timer_mutex);
+      continue;
+      }
+    if (wait == portMAX_DELAY)
+      pthread_cond_wait(&s_timer_cond, &s_timer_mutex);
+    else
+      {
+      struct timespec ts;
+      host_deadline(wait, ts);
+      pthread_cond_timedwait(&s_timer_cond, &s_timer_mutex, &ts);
+      }
+    }
+  }
+
+static void host_timer_init()
+  {
+  pthread_once(&s_once, host_init);
+  pthread_cond_init(&s_timer_cond, &s_condattr);
+  xTaskCreate(host_timer_task, "Tmr Svc", 4096, NULL, 1, NULL);
+  }
+
+static BaseType_t host_timer_update(TimerHandle_t timer, bool active, TickType_t period)
+  {
+  pthread_mutex_lock(&s_timer_mutex);
+  if (period)
+    timer->period = period;
+  timer->active = active;
+  timer->expiry = xTaskGetTickCount() + timer->period;
+  pthread_cond_broadcast(&s_timer_cond);
+  pthread_mutex_unlock(&s_timer_mutex);
+  return pdPASS;
+  }
+
+extern "C" TimerHandle_t xTimerCreate(const char* name, TickType_t period, UBaseType_t autoreload,
+  void* id, TimerCallbackFunction_t callback)
+  {
+  pthread_once(&s_timer_once, host_timer_init);
+  host_timer* t = new host_timer();
+  strncpy(t->name, name, sizeof(t->name)-1);
+  t->period = period;
+  t->autoreload = autoreload;
+  t->id = id;
+  t->callback = callback;
+  pthread_mutex_lock(&s_timer_mutex);
+  s_timers.push_back(t);
+  pthread_mutex_unlock(&s_timer_mutex);
+  return t;
+  }
+
+extern "C" BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks)
+  {
+  return host_timer_update(timer, true, 0);
+  }
+
+extern "C" BaseType_t xTimerStop(TimerHandle_t timer, TickType_t ticks)
+  {
+  return host_timer_update(timer, false, 0);
+  }
+
+extern "C" BaseType_t xTimerReset(TimerHandle_t timer, TickType_t ticks)
+  {
+  return host_timer_update(timer, true, 0);
+  }
+
+extern "C" BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t ticks)
+  {
+  return host_timer_update(timer, true, period);
+  }
+
+/**
+ * xTimerDelete: the timer object is kept, a callback may still be running
+ */
+extern "C" BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks)
+  {
+  pthread_mutex_lock(&s_timer_mutex);
+  timer->active = false;
+  pthread_mutex_unlock(&s_timer_mutex);
+  return pdPASS;
+  }
+
+extern "C" BaseType_t xTimerIsTimerActive(TimerHandle_t timer)
+  {
+  pthread_mutex_lock(&s_timer_mutex);
+  bool active = timer->active;
+  pthread_mutex_unlock(&s_timer_mutex);
+  return active ? pdTRUE : pdFALSE;
+  }
+
+extern "C" void* pvTimerGetTimerID(TimerHandle_t timer)
+  {
+  return timer->id;
+  }
+
+extern "C" BaseType_t xTimerPendFunctionCall(PendedFunction_t fn, void* param1, uint32_t param2, TickType_t ticks)
+  {
+  pthread_once(&s_timer_once, host_timer_init);
+  pthread_mutex_lock(&s_timer_mutex);
+  s_pended.push_back({ fn, param1, param2 });
+  pthread_cond_broadcast(&s_timer_cond);
+  pthread_mutex_unlock(&s_timer_mutex);
+  return pdPASS;
+  }
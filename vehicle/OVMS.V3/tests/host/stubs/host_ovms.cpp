@@ -0,0 +1,225 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: framework globals
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+// Framework parts the sources under test link against.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <memory>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ovms.h"
+#include "ovms_malloc.h"
+#include "ovms_command.h"
+#include "ovms_boot.h"
+#include "ovms_events.h"
+#include "ovms_config.h"
+#include "ovms_notify.h"
+#include "ovms_metrics.h"
+#include "metrics_standard.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "ovms_utils.h"
+#include "ovms_time.h"
+#include "esp_system.h"
+#include "rom/crc.h"
+
+int host_log_level = 0;
+uint32_t monotonictime = 0;
+// Initialisation order as in the firmware:
+OvmsCommandApp MyCommandApp __attribute__ ((init_priority (1010)));
+Boot MyBoot __attribute__ ((init_priority (1100)));
+OvmsEvents MyEvents __attribute__ ((init_priority (1200)));
+OvmsConfig MyConfig __attribute__ ((init_priority (1400)));
+OvmsTime MyTime __attribute__ ((init_priority (1500)));
+OvmsMetrics MyMetrics __attribute__ ((init_priority (1800)));
+MetricsStandard StdMetrics __attribute__ ((init_priority (1810)));
+OvmsNotify MyNotify __attribute__ ((init_priority (1820)));
+
+
+////////////////////////////////////////////////////////////////////////
+// Logging
+////////////////////////////////////////////////////////////////////////
+
+extern "C" void esp_log_write(esp_log_level_t level, const char* tag, const char* format, ...)
+  {
+  if ((int)level > host_log_level)
+    return;
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  }
+
+extern "C" uint32_t esp_log_timestamp(void)
+  {
+  return esp_timer_get_time() / 1000;
+  }
+
+extern "C" void esp_log_buffer_hexdump_internal(const char* tag, const void* buffer, uint16_t buff_len,
+  esp_log_level_t level)
+  {
+  if ((int)level > host_log_level)
+    return;
+  const uint8_t* p = (const uint8_t*) buffer;
+  for (int i = 0; i < buff_len; i++)
+    fprintf(stderr, "%02x%c", p[i], ((i & 15) == 15 || i == buff_len-1) ? '\n' : ' ');
+  }
+
+extern "C" void esp_log_level_set(const char* tag, esp_log_level_t level)
+  {
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Memory
+////////////////////////////////////////////////////////////////////////
+
+extern "C" void* ExternalRamMalloc(size_t sz) { return malloc(sz); }
+extern "C" void* ExternalRamCalloc(size_t count, size_t size) { return calloc(count, size); }
+extern "C" void* ExternalRamRealloc(void *ptr, size_t size) { return realloc(ptr, size); }
+extern "C" void* InternalRamMalloc(size_t sz) { return malloc(sz); }
+extern "C" void* InternalRamCalloc(size_t count, size_t size) { return calloc(count, size); }
+extern "C" void* InternalRamRealloc(void *ptr, size_t size) { return realloc(ptr, size); }
+
+void* ExternalRamAllocated::operator new(std::size_t sz) { return ::operator new(sz); }
+void* ExternalRamAllocated::operator new[](std::size_t sz) { return ::operator new[](sz); }
+void* InternalRamAllocated::operator new(std::size_t sz) { return ::operator new(sz); }
+void* InternalRamAllocated::operator new[](std::size_t sz) { return ::operator new[](sz); }
+
+
+////////////////////////////////////////////////////////////////////////
+// Timer
+////////////////////////////////////////////////////////////////////////
+
+static int64_t host_clock()
+  {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+  }
+
+static int64_t (*s_clock)(void) = host_clock;
+
+extern "C" int64_t esp_timer_get_time(void)
+  {
+  return s_clock();
+  }
+
+extern "C" void host_timer_set(int64_t (*clock)(void))
+  {
+  s_clock = clock ? clock : host_clock;
+  }
+
+extern "C" uint32_t esp_random(void)
+  {
+  static uint32_t s_random = 0x3c6ef372;
+  uint32_t x = __atomic_load_n(&s_random, __ATOMIC_RELAXED);
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  __atomic_store_n(&s_random, x, __ATOMIC_RELAXED);
+  return x;
+  }
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+// Utilities
+////////////////////////////////////////////////////////////////////////
+
+int mkpath(std::string path, mode_t mode)
+  {
+  for (size_t pos = 1; pos != std::string::npos; )
+    {
+    pos = path.find('/', pos + 1);
+    std::string dir = path.substr(0, pos);
+    if (mkdir(dir.c_str(), mode ? mode : 0775) != 0 && !path_exists(dir))
+      return -1;
+    }
+  return 0;
+  }
+
+bool path_exists(const std::string path)
+  {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0;
+  }
+
+std::string string_format(const char * fmt_str, ...)
+  {
+  va_list ap;
+  char *fp = NULL;
+  va_start(ap, fmt_str);
+  int ret = vasprintf(&fp, fmt_str, ap);
+  va_end(ap);
+  std::unique_ptr<char[], void(*)(void*)> formatted(fp, free);
+  return (ret >= 0) ? std::string(formatted.get()) : "";
+  }
+
+size_t FormatHexDump(char** bufferp, const char* data, size_t rlength, size_t colsize /*=16*/)
+  {
+  if (rlength == 0)
+    return 0;
+  if (!*bufferp)
+    *bufferp = (char*) ExternalRamMalloc(colsize*4 + 4);
+  char *p = *bufferp;
+  for (size_t k = 0; k < colsize; k++, p += 3)
+    {
+    if (k < rlength)
+      sprintf(p, "%2.2x ", (uint8_t)data[k]);
+    else
+      sprintf(p, "   ");
+    }
+  sprintf(p, "| ");
+  p += 2;
+  for (size_t k = 0; k < colsize; k++)
+    *p++ = (k < rlength) ? (isprint((uint8_t)data[k]) ? data[k] : '.') : ' ';
+  *p = 0;
+  return (rlength > colsize) ? rlength - colsize : 0;
+  }
+
+timer_util_t::~timer_util_t()
+  {
+  if (m_cb)
+    m_cb(m_start, getTime());
+  }
+
+extern "C" uint32_t crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+  {
+  crc = ~crc;
+  while (len--)
+    {
+    crc ^= *buf++;
+    for (int i = 0; i < 8; i++)
+      crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+    }
+  return ~crc;
+  }
@@ -0,0 +1,82 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: standard metrics
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_METRICS_STANDARD_H__
+#define __HOST_METRICS_STANDARD_H__
+
+#include "ovms_metrics.h"
+
+// Subset of the standard metrics used by host built sources:
+class MetricsStandard
+  {
+  public:
+    MetricsStandard()
+      {
+      ms_v_bat_energy_used = new OvmsMetricFloat("v.b.energy.used", 0, kWh);
+      ms_v_bat_energy_recd = new OvmsMetricFloat("v.b.energy.recd", 0, kWh);
+      ms_v_bat_energy_used_total = new OvmsMetricFloat("v.b.energy.used.total", 0, kWh);
+      ms_v_bat_energy_recd_total = new OvmsMetricFloat("v.b.energy.recd.total", 0, kWh);
+      ms_v_bat_coulomb_used = new OvmsMetricFloat("v.b.coulomb.used", 0, AmpHours);
+      ms_v_bat_coulomb_recd = new OvmsMetricFloat("v.b.coulomb.recd", 0, AmpHours);
+      ms_v_bat_coulomb_used_total = new OvmsMetricFloat("v.b.coulomb.used.total", 0, AmpHours);
+      ms_v_bat_coulomb_recd_total = new OvmsMetricFloat("v.b.coulomb.recd.total", 0, AmpHours);
+      ms_v_pos_gpslock = new OvmsMetricBool("v.p.gpslock");
+      ms_v_pos_gpsmode = new OvmsMetricString("v.p.gpsmode");
+      ms_v_pos_gpshdop = new OvmsMetricFloat("v.p.gpshdop", 0, Native);
+      ms_v_pos_satcount = new OvmsMetricInt("v.p.satcount");
+      ms_v_pos_gpssq = new OvmsMetricInt("v.p.gpssq", 0, Percentage);
+      ms_v_pos_gpstime = new OvmsMetricInt64("v.p.gpstime", 0, DateLocal);
+      ms_v_pos_latitude = new OvmsMetricFloat("v.p.latitude", 0, Degrees);
+      ms_v_pos_longitude = new OvmsMetricFloat("v.p.longitude", 0, Degrees);
+      ms_v_pos_direction = new OvmsMetricFloat("v.p.direction", 0, Degrees);
+      ms_v_pos_altitude = new OvmsMetricFloat("v.p.altitude", 0, Meters);
+      ms_v_pos_gpsspeed = new OvmsMetricFloat("v.p.gpsspeed", 0, Kph);
+      }
+
+  public:
+    OvmsMetricFloat*  ms_v_bat_energy_used;
+    OvmsMetricFloat*  ms_v_bat_energy_recd;
+    OvmsMetricFloat*  ms_v_bat_energy_used_total;
+    OvmsMetricFloat*  ms_v_bat_energy_recd_total;
+    OvmsMetricFloat*  ms_v_bat_coulomb_used;
+    OvmsMetricFloat*  ms_v_bat_coulomb_recd;
+    OvmsMetricFloat*  ms_v_bat_coulomb_used_total;
+    OvmsMetricFloat*  ms_v_bat_coulomb_recd_total;
+    OvmsMetricBool*   ms_v_pos_gpslock;
+    OvmsMetricString* ms_v_pos_gpsmode;
+    OvmsMetricFloat*  ms_v_pos_gpshdop;
+    OvmsMetricInt*    ms_v_pos_satcount;
+    OvmsMetricInt*    ms_v_pos_gpssq;
+    OvmsMetricInt64*  ms_v_pos_gpstime;
+    OvmsMetricFloat*  ms_v_pos_latitude;
+    OvmsMetricFloat*  ms_v_pos_longitude;
+    OvmsMetricFloat*  ms_v_pos_direction;
+    OvmsMetricFloat*  ms_v_pos_altitude;
+    OvmsMetricFloat*  ms_v_pos_gpsspeed;
+  };
+
+extern MetricsStandard StdMetrics;
+
+#endif //#ifndef __HOST_METRICS_STANDARD_H__
@@ -0,0 +1,118 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: command framework
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_COMMAND_H__
+#define __HOST_OVMS_COMMAND_H__
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include <functional>
+#include "ovms.h"
+
+#define COMMAND_RESULT_MINIMAL    140
+#define COMMAND_RESULT_SMS        160
+#define COMMAND_RESULT_NORMAL     1024
+#define COMMAND_RESULT_VERBOSE    65535
+
+struct CompareCharPtr
+  {
+  bool operator()(const char* a, const char* b) const { return strcmp(a, b) < 0; }
+  };
+
+// Writer collecting the output in a string:
+class OvmsWriter
+  {
+  public:
+    virtual ~OvmsWriter() {}
+    virtual int puts(const char* s) { m_output += s; m_output += '\n'; return 0; }
+    virtual int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)))
+      {
+      char buf[1024];
+      va_list args;
+      va_start(args, fmt);
+      int n = vsnprintf(buf, sizeof(buf), fmt, args);
+      va_end(args);
+      m_output += buf;
+      return n;
+      }
+    virtual ssize_t write(const void* buf, size_t size) { m_output.append((const char*)buf, size); return size; }
+
+  public:
+    std::string m_output;
+  };
+
+class OvmsCommand;
+typedef std::function<void(int, OvmsWriter*, OvmsCommand*, int, const char* const*)> OvmsCommandExecuteCallback_t;
+typedef std::function<int(OvmsWriter*, OvmsCommand*, int, const char* const*, bool)> OvmsCommandValidateCallback_t;
+
+// Command tree, commands are registered but not parsed or executed:
+class OvmsCommand
+  {
+  public:
+    OvmsCommand(const char* name, const char* title, OvmsCommandExecuteCallback_t execute)
+      : m_name(name), m_title(title), m_execute(execute) {}
+    virtual ~OvmsCommand()
+      {
+      for (auto &child : m_children)
+        delete child.second;
+      }
+
+  public:
+    OvmsCommand* RegisterCommand(const char* name, const char* title,
+                                 OvmsCommandExecuteCallback_t execute = NULL,
+                                 const char *usage = "", int min = 0, int max = 0, bool secure = true,
+                                 OvmsCommandValidateCallback_t validate = NULL)
+      {
+      OvmsCommand* &cmd = m_children[name];
+      if (!cmd)
+        cmd = new OvmsCommand(name, title, execute);
+      return cmd;
+      }
+    OvmsCommand* FindCommand(const char* name)
+      {
+      auto it = m_children.find(name);
+      return (it == m_children.end()) ? NULL : it->second;
+      }
+    const char* GetName() { return m_name.c_str(); }
+
+  public:
+    std::string m_name;
+    std::string m_title;
+    OvmsCommandExecuteCallback_t m_execute;
+    std::map<std::string, OvmsCommand*> m_children;
+  };
+
+class OvmsCommandApp : public OvmsCommand
+  {
+  public:
+    OvmsCommandApp() : OvmsCommand("", "", NULL) {}
+  };
+
+extern OvmsCommandApp MyCommandApp;
+
+#endif //#ifndef __HOST_OVMS_COMMAND_H__
@@ -0,0 +1,88 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: configuration store
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_CONFIG_H__
+#define __HOST_OVMS_CONFIG_H__
+
+#include <stdlib.h>
+#include <string>
+#include <map>
+
+class OvmsConfigParam
+  {
+  public:
+    OvmsConfigParam(std::string name) : m_name(name) {}
+    std::string GetName() { return m_name; }
+
+  public:
+    std::string m_name;
+  };
+
+// In memory parameter store, always mounted:
+class OvmsConfig
+  {
+  public:
+    void RegisterParam(std::string name, std::string title, bool writable=true, bool readable=true) {}
+    bool ismounted() { return true; }
+    std::string GetParamValue(std::string param, std::string instance, std::string defvalue = "")
+      {
+      auto it = m_values.find(param + "/" + instance);
+      return (it == m_values.end()) ? defvalue : it->second;
+      }
+    int GetParamValueInt(std::string param, std::string instance, int defvalue = 0)
+      {
+      std::string v = GetParamValue(param, instance);
+      return v.empty() ? defvalue : atoi(v.c_str());
+      }
+    float GetParamValueFloat(std::string param, std::string instance, float defvalue = 0)
+      {
+      std::string v = GetParamValue(param, instance);
+      return v.empty() ? defvalue : atof(v.c_str());
+      }
+    bool GetParamValueBool(std::string param, std::string instance, bool defvalue = false)
+      {
+      std::string v = GetParamValue(param, instance);
+      return v.empty() ? defvalue : (v == "yes" || v == "1" || v == "true");
+      }
+    void SetParamValue(std::string param, std::string instance, std::string value)
+      {
+      m_values[param + "/" + instance] = value;
+      }
+    void SetParamValueInt(std::string param, std::string instance, int value)
+      {
+      SetParamValue(param, instance, std::to_string(value));
+      }
+    void SetParamValueBool(std::string param, std::string instance, bool value)
+      {
+      SetParamValue(param, instance, value ? "yes" : "no");
+      }
+
+  public:
+    std::map<std::string, std::string> m_values;
+  };
+
+extern OvmsConfig MyConfig;
+
+#endif //#ifndef __HOST_OVMS_CONFIG_H__
@@ -0,0 +1,62 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: events
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_EVENTS_H__
+#define __HOST_OVMS_EVENTS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <functional>
+
+typedef uint16_t event_id_t;
+#define EVENT_ID_NONE             0xffff
+
+typedef std::function<void(const char*,void*)> EventNameCallback;
+typedef std::function<void(std::string,void*)> EventCallback;
+typedef void (*event_signal_done_fn)(const char* event, void* data);
+
+// Signals are counted, listeners are not called:
+class OvmsEvents
+  {
+  public:
+    void RegisterEvent(std::string caller, std::string event, EventCallback callback) {}
+    void RegisterEventCallback(std::string caller, std::string event, EventNameCallback callback) {}
+    void DeregisterEvent(std::string caller) {}
+    void SignalEvent(std::string event, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0)
+      { m_signals++; if (callback) callback(event.c_str(), data); }
+    void SignalEvent(std::string event, void* data, size_t length, uint32_t delay_ms = 0) { m_signals++; }
+    void SignalEvent(event_id_t id, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0)
+      { m_signals++; if (callback) callback("", data); }
+    void SignalEvent(event_id_t id, void* data, size_t length, uint32_t delay_ms = 0) { m_signals++; }
+    event_id_t GetEventId(const std::string& event, bool create=true) { return EVENT_ID_NONE; }
+
+  public:
+    int m_signals = 0;
+  };
+
+extern OvmsEvents MyEvents;
+
+#endif //#ifndef __HOST_OVMS_EVENTS_H__
@@ -0,0 +1,219 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: metrics
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_METRICS_H__
+#define __HOST_OVMS_METRICS_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include <set>
+#include <mutex>
+#include "ovms.h"
+
+#define SM_STALE_NONE     0
+#define SM_STALE_MIN      10
+#define SM_STALE_MID      120
+#define SM_STALE_HIGH     3600
+#define SM_STALE_MAX      65535
+
+typedef enum
+  {
+  Other = 0,
+  Volts, Amps, Celcius, kW, kWh, AmpHours, Percentage, Native,
+  Kph, Degrees, Meters, DateLocal, Permille,
+  } metric_unit_t;
+
+typedef enum
+  {
+  GrpNone = 0, GrpRatio = 14,
+  } metric_group_t;
+
+// Ratios only, user units are the defaults:
+static inline float UnitConvert(metric_unit_t from, metric_unit_t to, float value)
+  {
+  if (from == Permille && to == Percentage)
+    return value / 10;
+  if (from == Percentage && to == Permille)
+    return value * 10;
+  return value;
+  }
+static inline metric_unit_t OvmsMetricGetUserUnit(metric_group_t group, metric_unit_t defaultUnit = Native)
+  {
+  return defaultUnit;
+  }
+static inline const char* OvmsMetricUnitLabel(metric_unit_t units)
+  {
+  return (units == Percentage) ? "%" : (units == Permille) ? "‰" : "";
+  }
+
+class OvmsMetric;
+
+// Registry of the metrics created:
+class OvmsMetrics
+  {
+  public:
+    OvmsMetrics() : m_first(NULL), m_generation(0) {}
+
+  public:
+    OvmsMetric* Find(const char* name)
+      {
+      auto it = m_metrics.find(name);
+      return (it == m_metrics.end()) ? NULL : it->second;
+      }
+    bool HasNamedListener(const std::string &name)
+      {
+      std::lock_guard<std::mutex> lock(m_listened_mutex);
+      return m_listened.count(name) != 0;
+      }
+    void SetNamedListener(const std::string &name, bool listened)
+      {
+      std::lock_guard<std::mutex> lock(m_listened_mutex);
+      if (listened) m_listened.insert(name); else m_listened.erase(name);
+      }
+
+  public:
+    std::map<std::string, OvmsMetric*> m_metrics;
+    std::set<std::string> m_listened;   // metrics reported to have listeners
+    std::mutex m_listened_mutex;
+    OvmsMetric* m_first;            // list in registration order, newest first
+    unsigned int m_generation;      // incremented on list changes
+  };
+
+extern OvmsMetrics MyMetrics;
+
+class OvmsMetric
+  {
+  public:
+    OvmsMetric(const char* name, uint16_t autostale=0, metric_unit_t units=Other)
+      : m_name(name), m_units(units), m_defined(false), m_stale(false), m_modified(0)
+      {
+      MyMetrics.m_metrics[name] = this;
+      m_next = MyMetrics.m_first;
+      MyMetrics.m_first = this;
+      MyMetrics.m_generation++;
+      }
+    virtual ~OvmsMetric()
+      {
+      MyMetrics.m_metrics.erase(m_name);
+      for (OvmsMetric** p = &MyMetrics.m_first; *p; p = &(*p)->m_next)
+        {
+        if (*p == this)
+          {
+          *p = m_next;
+          break;
+          }
+        }
+      MyMetrics.m_generation++;
+      }
+
+  public:
+    bool IsDefined() { return m_defined; }
+    void SetModified(bool changed=true) { m_defined = true; m_stale = false; if (changed) m_modified++; }
+    void SetStale(bool stale) { m_stale = stale; }
+    bool IsStale() { return m_stale; }
+    virtual std::string AsString(const char* defvalue = "") = 0;
+    virtual float AsFloat(float defvalue = 0) = 0;
+
+  public:
+    const char* m_name;
+    OvmsMetric* m_next;
+    metric_unit_t m_units;
+    bool m_defined;
+    bool m_stale;
+    uint32_t m_modified;            // Changes counted
+  };
+
+template <class T> class OvmsMetricValue : public OvmsMetric
+  {
+  public:
+    OvmsMetricValue(const char* name, uint16_t autostale=0, metric_unit_t units=Other)
+      : OvmsMetric(name, autostale, units), m_value() {}
+
+  public:
+    bool SetValue(T value, metric_unit_t units=Other)
+      {
+      bool changed = !m_defined || !(m_value == value);
+      m_value = value;
+      SetModified(changed);
+      return changed;
+      }
+    T Value() { return m_value; }
+    void operator=(T value) { SetValue(value); }
+
+  public:
+    T m_value;
+  };
+
+class OvmsMetricInt : public OvmsMetricValue<int>
+  {
+  public:
+    using OvmsMetricValue<int>::OvmsMetricValue;
+    using OvmsMetricValue<int>::operator=;
+    int AsInt(int defvalue = 0, metric_unit_t units=Other) { return m_defined ? m_value : defvalue; }
+    std::string AsString(const char* defvalue = "") override { return m_defined ? std::to_string(m_value) : defvalue; }
+    float AsFloat(float defvalue = 0) override { return m_defined ? m_value : defvalue; }
+  };
+
+class OvmsMetricBool : public OvmsMetricValue<bool>
+  {
+  public:
+    using OvmsMetricValue<bool>::OvmsMetricValue;
+    using OvmsMetricValue<bool>::operator=;
+    bool AsBool(bool defvalue = false) { return m_defined ? m_value : defvalue; }
+    std::string AsString(const char* defvalue = "") override { return m_defined ? (m_value ? "yes" : "no") : defvalue; }
+    float AsFloat(float defvalue = 0) override { return m_defined ? m_value : defvalue; }
+  };
+
+class OvmsMetricInt64 : public OvmsMetricValue<int64_t>
+  {
+  public:
+    using OvmsMetricValue<int64_t>::OvmsMetricValue;
+    using OvmsMetricValue<int64_t>::operator=;
+    int64_t AsInt(int64_t defvalue = 0, metric_unit_t units=Other) { return m_defined ? m_value : defvalue; }
+    std::string AsString(const char* defvalue = "") override { return m_defined ? std::to_string(m_value) : defvalue; }
+    float AsFloat(float defvalue = 0) override { return m_defined ? m_value : defvalue; }
+  };
+
+class OvmsMetricFloat : public OvmsMetricValue<float>
+  {
+  public:
+    using OvmsMetricValue<float>::OvmsMetricValue;
+    using OvmsMetricValue<float>::operator=;
+    std::string AsString(const char* defvalue = "") override { return m_defined ? std::to_string(m_value) : defvalue; }
+    float AsFloat(float defvalue = 0) override { return m_defined ? m_value : defvalue; }
+  };
+
+class OvmsMetricString : public OvmsMetricValue<std::string>
+  {
+  public:
+    using OvmsMetricValue<std::string>::OvmsMetricValue;
+    using OvmsMetricValue<std::string>::operator=;
+    std::string AsString(const char* defvalue = "") override { return m_defined ? m_value : defvalue; }
+    float AsFloat(float defvalue = 0) override { return m_defined ? atof(m_value.c_str()) : defvalue; }
+  };
+
+#endif //#ifndef __HOST_OVMS_METRICS_H__
@@ -0,0 +1,46 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: time provider
+;
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_TIME_H__
+#define __HOST_OVMS_TIME_H__
+
+#include <time.h>
+#include <sys/time.h>
+
+// Records the last time set:
+class OvmsTime
+  {
+  public:
+    void Set(const char* provider, int stratum, bool trusted, time_t tim, suseconds_t timu=0)
+      { m_sets++; m_time = tim; }
+
+  public:
+    int m_sets = 0;
+    time_t m_time = 0;
+  };
+
+extern OvmsTime MyTime;
+
+#endif //#ifndef __HOST_OVMS_TIME_H__
@@ -0,0 +1,36 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: utilities
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_OVMS_UTILS_H__
+#define __HOST_OVMS_UTILS_H__
+
+// The framework utilities are header based, only some system & esp_timer.h
+// includes are provided by other framework headers on the device. mkpath() & path_exists()
+// are implemented in host_ovms.cpp, the remaining functions by ovms_utils.cpp.
+#include <sys/types.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "../../../main/ovms_utils.h"
+
+#endif //#ifndef __HOST_OVMS_UTILS_H__
@@ -0,0 +1,35 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: configuration
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_SDKCONFIG_H__
+#define __HOST_SDKCONFIG_H__
+
+// Only what the sources under test need, values as in support/sdkconfig.default.hw31:
+#define CONFIG_OVMS_HW_CAN_RING_SIZE 128
+#define CONFIG_OVMS_HW_CAN_RX_QUEUE_SIZE 60
+#define CONFIG_OVMS_HW_CAN_TX_QUEUE_SIZE 30
+#define CONFIG_OVMS_VEHICLE_CAN_RX_QUEUE_SIZE 60
+#define CONFIG_OVMS_VEHICLE_RXTASK_STACK 8192
+
+#endif //#ifndef __HOST_SDKCONFIG_H__
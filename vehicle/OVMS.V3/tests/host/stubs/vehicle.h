@@ -0,0 +1,45 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test stub: vehicle framework (poller part only)
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __HOST_VEHICLE_H__
+#define __HOST_VEHICLE_H__
+
+// The poller sources include vehicle.h for the poller declarations only:
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include "can.h"
+#include "ovms_events.h"
+#include "ovms_config.h"
+#include "ovms_metrics.h"
+#include "ovms_command.h"
+#include "metrics_standard.h"
+#include "ovms_mutex.h"
+#include "ovms_semaphore.h"
+#include "freertos/timers.h"
+#include "vehicle_common.h"
+#include "vehicle_poller.h"
+
+#endif //#ifndef __HOST_VEHICLE_H__
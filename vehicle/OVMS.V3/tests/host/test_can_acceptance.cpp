@@ -0,0 +1,215 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test: CAN acceptance filter calculation vs. controller register models
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "can_acceptance.h"
+
+// The register models below follow the data sheets and work on the register
+// bytes as the drivers write them, independent of the calculation code.
+
+struct frame_t
+  {
+  uint32_t id;
+  bool extended;
+  bool rtr;
+  uint8_t data[2];
+  };
+
+/**
+ * MCP2515 (data sheet section 4.5): the frame is received if it matches any
+ *  filter of a buffer under the buffer's mask. For standard frames, EID15-8 and
+ *  EID7-0 apply to data bytes 0 and 1.
+ */
+static bool mcp2515_model(const CAN_mcp2515_filter_t &f, const frame_t &fr)
+  {
+  for (int n = 0; n < 6; n++)
+    {
+    uint8_t m[4], r[4];
+    canacceptance::EncodeMCP2515(f.mask[(n < 2) ? 0 : 1], false, m);
+    canacceptance::EncodeMCP2515(f.filter[n], f.extended[n], r);
+    bool exide = r[1] & 0x08;
+    if (exide != fr.extended)
+      continue;
+    uint8_t v[4];
+    if (fr.extended)
+      {
+      v[0] = fr.id >> 21;
+      v[1] = ((fr.id >> 13) & 0xe0) | ((fr.id >> 16) & 0x03);
+      v[2] = fr.id >> 8;
+      v[3] = fr.id;
+      }
+    else
+      {
+      v[0] = fr.id >> 3;
+      v[1] = (fr.id << 5) & 0xe0;
+      v[2] = fr.data[0];
+      v[3] = fr.data[1];
+      m[1] &= 0xe0;       // EID17-16 not compared
+      }
+    bool match = true;
+    for (int i = 0; i < 4; i++)
+      match &= ((v[i] ^ r[i]) & m[i] & (i == 1 ? 0xe3 : 0xff)) == 0;
+    if (match)
+      return true;
+    }
+  return false;
+  }
+
+/**
+ * SJA1000 / ESP32 TWAI (SJA1000 data sheet section 6.4.15): AMR bits set = don't care
+ */
+static bool sja_cmp(uint8_t value, const CAN_sja1000_filter_t &f, int reg, uint8_t bits)
+  {
+  return ((value ^ f.code[reg]) & ~f.mask[reg] & bits) == 0;
+  }
+
+static bool sja1000_model(const CAN_sja1000_filter_t &f, const frame_t &fr)
+  {
+  if (!f.dual)
+    {
+    if (fr.extended)
+      return sja_cmp(fr.id >> 21, f, 0, 0xff)
+          && sja_cmp(fr.id >> 13, f, 1, 0xff)
+          && sja_cmp(fr.id >> 5, f, 2, 0xff)
+          && sja_cmp(((fr.id << 3) & 0xf8) | (fr.rtr ? 0x04 : 0), f, 3, 0xfc);
+    return sja_cmp(fr.id >> 3, f, 0, 0xff)
+        && sja_cmp(((fr.id << 5) & 0xe0) | (fr.rtr ? 0x10 : 0), f, 1, 0xf0)
+        && sja_cmp(fr.data[0], f, 2, 0xff)
+        && sja_cmp(fr.data[1], f, 3, 0xff);
+    }
+  if (fr.extended)
+    return (sja_cmp(fr.id >> 21, f, 0, 0xff) && sja_cmp(fr.id >> 13, f, 1, 0xff))
+        || (sja_cmp(fr.id >> 21, f, 2, 0xff) && sja_cmp(fr.id >> 13, f, 3, 0xff));
+  bool f1 = sja_cmp(fr.id >> 3, f, 0, 0xff)
+         && sja_cmp(((fr.id << 5) & 0xe0) | (fr.rtr ? 0x10 : 0) | (fr.data[0] >> 4), f, 1, 0xff)
+         && sja_cmp(fr.data[0] & 0x0f, f, 3, 0x0f);
+  bool f2 = sja_cmp(fr.id >> 3, f, 2, 0xff)
+         && sja_cmp(((fr.id << 5) & 0xe0) | (fr.rtr ? 0x10 : 0), f, 3, 0xf0);
+  return f1 || f2;
+  }
+
+static uint32_t rnd = 2463534242u;
+
+// All IDs of the list must pass the hardware for any data; Match() must never
+// claim a frame passes that the hardware may reject.
+static void check_list(const CAN_acceptance_list_t &list)
+  {
+  CAN_mcp2515_filter_t mcp;
+  CAN_sja1000_filter_t sja;
+  memset(&mcp, 0, sizeof(mcp));
+  memset(&sja, 0, sizeof(sja));
+  CHECK(canacceptance::CalcMCP2515(list, mcp) == !list.empty());
+  CHECK(canacceptance::CalcSJA1000(list, sja) == !list.empty());
+  if (list.empty())
+    return;
+
+  for (const CAN_acceptance_t &acc : list)
+    {
+    uint32_t max = acc.extended ? 0x1fffffff : 0x7ff;
+    uint32_t to = (acc.id_to > max) ? max : acc.id_to;
+    uint64_t span = (uint64_t)to - acc.id_from + 1;
+    int samples = (span > 512) ? 512 : (int)span;
+    for (int s = 0; s < samples; s++)
+      {
+      frame_t fr;
+      fr.id = (span > 512) ? acc.id_from + host_test_rand(rnd) % span : acc.id_from + s;
+      if (s == samples-1) fr.id = to;
+      fr.extended = acc.extended;
+      fr.rtr = false;
+      fr.data[0] = host_test_rand(rnd);
+      fr.data[1] = host_test_rand(rnd);
+      CHECKF(mcp2515_model(mcp, fr), "MCP2515 rejects %s ID %x", fr.extended ? "ext" : "std", fr.id);
+      CHECKF(sja1000_model(sja, fr), "SJA1000 rejects %s ID %x", fr.extended ? "ext" : "std", fr.id);
+      CHECK(canacceptance::MatchMCP2515(mcp, fr.id, fr.extended));
+      CHECK(canacceptance::MatchSJA1000(sja, fr.id, fr.extended));
+      }
+    }
+
+  // Match() vs. model on random frames & data:
+  for (int s = 0; s < 4096; s++)
+    {
+    frame_t fr;
+    fr.extended = (s & 1);
+    fr.id = host_test_rand(rnd) & (fr.extended ? 0x1fffffff : 0x7ff);
+    fr.rtr = false;
+    bool mcp_any = true, sja_any = true;
+    for (int d = 0; d < 4; d++)
+      {
+      fr.data[0] = host_test_rand(rnd);
+      fr.data[1] = host_test_rand(rnd);
+      mcp_any &= mcp2515_model(mcp, fr);
+      sja_any &= sja1000_model(sja, fr);
+      }
+    if (canacceptance::MatchMCP2515(mcp, fr.id, fr.extended))
+      CHECKF(mcp_any, "MCP2515 Match() accepts %x, hardware may not", fr.id);
+    if (canacceptance::MatchSJA1000(sja, fr.id, fr.extended))
+      CHECKF(sja_any, "SJA1000 Match() accepts %x, hardware may not", fr.id);
+    }
+
+  // Equal():
+  CAN_mcp2515_filter_t mcp2;
+  CAN_sja1000_filter_t sja2;
+  memset(&mcp2, 0, sizeof(mcp2));
+  memset(&sja2, 0, sizeof(sja2));
+  canacceptance::CalcMCP2515(list, mcp2);
+  canacceptance::CalcSJA1000(list, sja2);
+  CHECK(canacceptance::EqualMCP2515(mcp, mcp2));
+  CHECK(canacceptance::EqualSJA1000(sja, sja2));
+  }
+
+int main()
+  {
+  // fixed cases: single IDs, typical OBD ranges, mixed types, full ranges:
+  check_list({});
+  check_list({ { 0x7e8, 0x7e8, false } });
+  check_list({ { 0x7e8, 0x7ef, false } });
+  check_list({ { 0x18daf100, 0x18daf1ff, true } });
+  check_list({ { 0x7e8, 0x7ef, false }, { 0x18daf100, 0x18daf1ff, true } });
+  check_list({ { 0x100, 0x1ff, false }, { 0x3c0, 0x3c7, false }, { 0x55b, 0x55b, false },
+               { 0x5bc, 0x5bc, false }, { 0x5bf, 0x5bf, false }, { 0x7bb, 0x7bb, false },
+               { 0x7ec, 0x7ec, false } });
+  check_list({ { 0, 0x7ff, false } });
+  check_list({ { 0, 0x1fffffff, true } });
+  check_list({ { 0x7ff, 0xffffffff, false } });
+
+  // random lists:
+  for (int n = 0; n < 300; n++)
+    {
+    CAN_acceptance_list_t list;
+    int cnt = 1 + host_test_rand(rnd) % 12;
+    for (int i = 0; i < cnt; i++)
+      {
+      CAN_acceptance_t acc;
+      acc.extended = (n % 3 == 0) ? (host_test_rand(rnd) & 1) : (n % 3 == 1);
+      uint32_t max = acc.extended ? 0x1fffffff : 0x7ff;
+      acc.id_from = host_test_rand(rnd) & max;
+      acc.id_to = acc.id_from + ((host_test_rand(rnd) & 3) ? host_test_rand(rnd) % 16 : host_test_rand(rnd) % 512);
+      list.push_back(acc);
+      }
+    check_list(list);
+    }
+
+  return host_test_result("can_acceptance");
+  }
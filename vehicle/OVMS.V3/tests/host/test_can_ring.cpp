@@ -0,0 +1,364 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: CAN frame broadcast ring
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_can_ring          3 readers + a registering/deregistering reader vs. one writer
+//   test_can_ring bench    writer cost per frame: ring vs. per consumer queues
+//
+// Run with sanitizers, e.g.:
+//   CXXFLAGS="-O1 -g -fsanitize=thread" make build/test_can_ring
+//   CXXFLAGS="-O1 -g -fsanitize=address,undefined" make build/test_can_ring
+//     (ASAN_OPTIONS=detect_leaks=0: task setups are leaked, see host_freertos.cpp)
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <atomic>
+#include "host_test.h"
+#include "can.h"
+
+static std::atomic<bool> s_done;
+
+static void make_frame(uint32_t seq, CAN_frame_t &frame, CAN_log_type_t &type)
+  {
+  memset(&frame, 0, sizeof(frame));
+  frame.FIR.B.FF = CAN_frame_std;
+  frame.FIR.B.DLC = 8;
+  frame.MsgID = seq & 0x7ff;
+  frame.data.u32[0] = seq;
+  frame.data.u32[1] = ~seq;
+  type = (seq % 7 == 0) ? CAN_LogFrame_TX : CAN_LogFrame_RX;
+  }
+
+// Frame content consistency: detects torn copies
+static bool frame_ok(const CAN_log_message_t &msg)
+  {
+  uint32_t seq = msg.frame.data.u32[0];
+  return msg.frame.data.u32[1] == ~seq
+    && msg.frame.MsgID == (seq & 0x7ff)
+    && msg.type == ((seq % 7 == 0) ? CAN_LogFrame_TX : CAN_LogFrame_RX);
+  }
+
+
+/**
+ * Consistency test
+ *  The writer writes frame sequence numbers 0…count-1, readers verify content,
+ *  order and that read + lost covers all frames written while registered.
+ */
+struct writer_t
+  {
+  canring*            ring;
+  uint32_t            count;
+  TaskHandle_t        task;
+  std::atomic<bool>   ready;
+  };
+
+struct reader_t
+  {
+  reader_t(const char* name) : rd(name, true) {}
+  canring_reader      rd;
+  int                 pause;          // sleep every n frames, 0 = never
+  int                 sleep;          // [µs]
+  uint32_t            next;
+  uint32_t            gaps;           // frames skipped in the sequence
+  uint32_t            torn;
+  uint32_t            reordered;
+  std::atomic<bool>   finished;
+  };
+
+struct churn_t
+  {
+  canring*            ring;
+  uint32_t            registrations;
+  uint32_t            frames;
+  uint32_t            torn;
+  uint32_t            reordered;
+  uint32_t            txseen;
+  std::atomic<bool>   finished;
+  };
+
+static void writer_task(void* param)
+  {
+  writer_t* w = (writer_t*) param;
+  w->ring->SetWriter(xTaskGetCurrentTaskHandle());
+  w->ready = true;
+  CAN_frame_t frame;
+  CAN_log_type_t type;
+  for (uint32_t seq = 0; seq < w->count; seq++)
+    {
+    make_frame(seq, frame, type);
+    w->ring->Write(type, &frame);
+    // pace to ~1M frames/s, so the fast reader can keep up most of the time:
+    if ((seq & 127) == 0)
+      usleep(50);
+    }
+  s_done = true;
+  vTaskDelete(NULL);
+  }
+
+static void reader_check(reader_t* r, const CAN_log_message_t &msg)
+  {
+  if (!frame_ok(msg))
+    r->torn++;
+  uint32_t seq = msg.frame.data.u32[0];
+  if (seq < r->next)
+    r->reordered++;
+  else
+    r->gaps += seq - r->next;
+  r->next = seq + 1;
+  }
+
+static void reader_task(void* param)
+  {
+  reader_t* r = (reader_t*) param;
+  CAN_log_message_t msg;
+  uint32_t n = 0;
+  while (true)
+    {
+    if (r->rd.Read(&msg, 20))
+      {
+      reader_check(r, msg);
+      if (r->pause && (++n % r->pause) == 0)
+        usleep(r->sleep);
+      }
+    else if (s_done)
+      {
+      while (r->rd.Read(&msg, 0))
+        reader_check(r, msg);
+      break;
+      }
+    }
+  r->finished = true;
+  vTaskDelete(NULL);
+  }
+
+static void churn_task(void* param)
+  {
+  churn_t* c = (churn_t*) param;
+  CAN_log_message_t msg;
+  while (!s_done)
+    {
+    canring_reader rd("churn");
+    if (!c->ring->AddReader(&rd))
+      continue;
+    c->registrations++;
+    uint32_t next = 0;
+    bool first = true;
+    int n = (c->registrations % 5);
+    while (n-- > 0 && rd.Read(&msg, 1))
+      {
+      if (!frame_ok(msg))
+        c->torn++;
+      if (msg.type == CAN_LogFrame_TX)
+        c->txseen++;
+      uint32_t seq = msg.frame.data.u32[0];
+      if (!first && seq < next)
+        c->reordered++;
+      next = seq + 1;
+      first = false;
+      c->frames++;
+      }
+    // destructor deregisters
+    }
+  c->finished = true;
+  vTaskDelete(NULL);
+  }
+
+static void test_consistency(uint32_t count)
+  {
+  canring* ring = new canring();
+  s_done = false;
+
+  // readers: fast, occasionally pausing, slow
+  static const int pauses[3] = { 0, 4096, 16 };
+  static const int sleeps[3] = { 0, 200, 200 };
+  reader_t* readers[3];
+  for (int i = 0; i < 3; i++)
+    {
+    readers[i] = new reader_t("test");
+    readers[i]->pause = pauses[i];
+    readers[i]->sleep = sleeps[i];
+    readers[i]->next = 0;
+    readers[i]->gaps = readers[i]->torn = readers[i]->reordered = 0;
+    readers[i]->finished = false;
+    CHECK(ring->AddReader(&readers[i]->rd));
+    CHECK(ring->AddReader(&readers[i]->rd));   // no double registration
+    xTaskCreate(reader_task, "reader", 4096, readers[i], 5, NULL);
+    }
+
+  churn_t* churn = new churn_t();
+  churn->ring = ring;
+  churn->finished = false;
+  xTaskCreate(churn_task, "churn", 4096, churn, 5, NULL);
+
+  writer_t* w = new writer_t();
+  w->ring = ring;
+  w->count = count;
+  w->ready = false;
+  xTaskCreate(writer_task, "writer", 4096, w, 5, &w->task);
+
+  for (int i = 0; i < 3; i++)
+    while (!readers[i]->finished) usleep(1000);
+  while (!churn->finished) usleep(1000);
+
+  for (int i = 0; i < 3; i++)
+    {
+    reader_t* r = readers[i];
+    CHECKF(r->torn == 0, "reader %d: %u torn", i, r->torn);
+    CHECKF(r->reordered == 0, "reader %d: %u reordered", i, r->reordered);
+    CHECKF(r->rd.GetRead() + r->rd.GetLost() == count, "reader %d: read %u + lost %u != %u",
+      i, r->rd.GetRead(), r->rd.GetLost(), count);
+    // frames after the last one read are gaps not seen by the reader:
+    CHECKF(r->gaps + (count - r->next) == r->rd.GetLost(), "reader %d: gaps %u, lost %u",
+      i, r->gaps + (count - r->next), r->rd.GetLost());
+    }
+  CHECKF(churn->torn == 0, "churn: %u torn", churn->torn);
+  CHECKF(churn->reordered == 0, "churn: %u reordered", churn->reordered);
+  CHECKF(churn->txseen == 0, "churn: %u tx frames without txfeedback", churn->txseen);
+  CHECK(churn->registrations > 0);
+  printf("canring: %u frames, readers read %u / %u / %u, lost %u / %u / %u; "
+    "churn reader: %u registrations, %u frames\n", count,
+    readers[0]->rd.GetRead(), readers[1]->rd.GetRead(), readers[2]->rd.GetRead(),
+    readers[0]->rd.GetLost(), readers[1]->rd.GetLost(), readers[2]->rd.GetLost(),
+    churn->registrations, churn->frames);
+
+  // deregistered readers no longer count:
+  for (int i = 0; i < 3; i++)
+    {
+    ring->RemoveReader(&readers[i]->rd);
+    CHECK(!readers[i]->rd.IsRegistered());
+    }
+  // tasks have ended, the setup is leaked (see host_freertos.cpp)
+  }
+
+
+/**
+ * Benchmark: writer cost per frame with n consumers
+ *  - ring: canring::Write(), readers block in Read()
+ *  - queues: the former scheme, one xQueueSend(…, 0) of the log message per
+ *    consumer queue, consumers block in xQueueReceive()
+ */
+struct bench_reader_t
+  {
+  canring_reader*     rd;
+  QueueHandle_t       queue;
+  std::atomic<bool>   finished;
+  };
+
+static void bench_ring_reader(void* param)
+  {
+  bench_reader_t* r = (bench_reader_t*) param;
+  CAN_log_message_t msg;
+  while (r->rd->Read(&msg, 20) || !s_done) ;
+  r->finished = true;
+  vTaskDelete(NULL);
+  }
+
+static void bench_queue_reader(void* param)
+  {
+  bench_reader_t* r = (bench_reader_t*) param;
+  CAN_log_message_t msg;
+  while (xQueueReceive(r->queue, &msg, 20) == pdPASS || !s_done) ;
+  r->finished = true;
+  vTaskDelete(NULL);
+  }
+
+static double bench_ring(int readers, uint32_t count)
+  {
+  canring* ring = new canring();
+  ring->SetWriter(xTaskGetCurrentTaskHandle());
+  bench_reader_t* r = new bench_reader_t[readers];
+  s_done = false;
+  for (int i = 0; i < readers; i++)
+    {
+    r[i].rd = new canring_reader("bench");
+    r[i].finished = false;
+    ring->AddReader(r[i].rd);
+    xTaskCreate(bench_ring_reader, "reader", 4096, &r[i], 5, NULL);
+    }
+  CAN_frame_t frame;
+  CAN_log_type_t type;
+  double t0 = host_test_us();
+  for (uint32_t seq = 0; seq < count; seq++)
+    {
+    make_frame(seq, frame, type);
+    ring->Write(type, &frame);
+    }
+  double ns = (host_test_us() - t0) * 1000 / count;
+  s_done = true;
+  for (int i = 0; i < readers; i++)
+    while (!r[i].finished) usleep(1000);
+  return ns;
+  }
+
+static double bench_queues(int readers, uint32_t count)
+  {
+  bench_reader_t* r = new bench_reader_t[readers];
+  s_done = false;
+  for (int i = 0; i < readers; i++)
+    {
+    r[i].queue = xQueueCreate(CONFIG_OVMS_HW_CAN_RING_SIZE, sizeof(CAN_log_message_t));
+    r[i].finished = false;
+    xTaskCreate(bench_queue_reader, "reader", 4096, &r[i], 5, NULL);
+    }
+  CAN_frame_t frame;
+  CAN_log_message_t msg;
+  double t0 = host_test_us();
+  for (uint32_t seq = 0; seq < count; seq++)
+    {
+    make_frame(seq, frame, msg.type);
+    for (int i = 0; i < readers; i++)
+      {
+      gettimeofday(&msg.timestamp, NULL);
+      msg.frame = frame;
+      xQueueSend(r[i].queue, &msg, 0);
+      }
+    }
+  double ns = (host_test_us() - t0) * 1000 / count;
+  s_done = true;
+  for (int i = 0; i < readers; i++)
+    while (!r[i].finished) usleep(1000);
+  return ns;
+  }
+
+static void bench()
+  {
+  const uint32_t count = 1000000;
+  printf("writer cost per frame [ns], %u frames:\n", count);
+  printf("  readers      ring    queues\n");
+  for (int readers = 1; readers <= 5; readers += 2)
+    {
+    double ring = bench_ring(readers, count);
+    double queues = bench_queues(readers, count);
+    printf("  %7d  %8.0f  %8.0f\n", readers, ring, queues);
+    }
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    test_consistency(2000000);
+  return host_test_result((argc > 1) ? "bench_can_ring" : "test_can_ring");
+  }
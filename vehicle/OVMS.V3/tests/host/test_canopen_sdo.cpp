@@ -0,0 +1,699 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: CANopen SDO transfers against a simulated node
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+// Runs the CANopen worker & client on the FreeRTOS host stubs against SDO
+// servers simulated on a serialized CAN bus model.
+//   test_canopen_sdo           protocol checks (frame time 0)
+//   test_canopen_sdo bench     throughput & concurrency at 500 kbit/s
+
+#include <string.h>
+#include <vector>
+#include <map>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include "host_test.h"
+#include "canopen.h"
+
+#define SDO_ABORT_INVALIDCMD    0x05040001
+#define SDO_ABORT_SEQNO         0x05040003
+#define SDO_ABORT_CRC           0x05040004
+#define SDO_ABORT_TOGGLE        0x05030000
+#define SDO_ABORT_NOOBJECT      0x06020000
+
+// The framework parts of the CANopen master used by the worker:
+CANopen::CANopen() : m_rxreader("canopen")
+  {
+  m_rxtask = NULL;
+  memset(m_worker, 0, sizeof(m_worker));
+  m_workercnt = 0;
+  }
+CANopen::~CANopen() {}
+CANopenWorker* CANopen::Start(canbus* bus) { return NULL; }
+const std::string CANopen::GetStateName(const CANopenNMTState_t state) { return "state"; }
+const std::string CANopen::GetResultString(const CANopenJob& job) { return "result"; }
+CANopen MyCANopen;
+
+static uint16_t crc16(const uint8_t* data, size_t len)
+  {
+  uint16_t crc = 0;
+  while (len--)
+    {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (int i = 0; i < 8; i++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  return crc;
+  }
+
+static int64_t now_us()
+  {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+
+class SimNode;
+
+/**
+ * SimBus: serializes all frames with a fixed frame time, delivers requests
+ *  to the simulated nodes and responses to the CANopen worker from a bus task.
+ */
+class SimBus : public canbus
+  {
+  public:
+    SimBus(int frametime_us) : canbus("can1")
+      {
+      m_frametime = frametime_us;
+      m_free = 0;
+      m_seq = 0;
+      m_frames = 0;
+      m_worker = NULL;
+      memset(m_node, 0, sizeof(m_node));
+      m_stop = false;
+      m_thread = std::thread(&SimBus::Run, this);
+      }
+    ~SimBus()
+      {
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        }
+      m_cond.notify_all();
+      m_thread.join();
+      }
+
+  public:
+    esp_err_t Write(const CAN_frame_t* p_frame, TickType_t maxqueuewait=0) override
+      {
+      Schedule(*p_frame, now_us(), true);
+      return ESP_OK;
+      }
+    void Schedule(const CAN_frame_t& frame, int64_t time, bool transmit=false)
+      {
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (transmit)
+          time = Transmit(time);
+        m_events.push({ time, m_seq++, transmit, frame });
+        }
+      m_cond.notify_all();
+      }
+
+  private:
+    struct event_t
+      {
+      int64_t time;
+      uint64_t seq;
+      bool deliver;                   // false = node transmit request
+      CAN_frame_t frame;
+      bool operator<(const event_t& b) const
+        { return (time != b.time) ? time > b.time : seq > b.seq; }
+      };
+    int64_t Transmit(int64_t time)
+      {
+      m_free = std::max(time, m_free) + m_frametime;
+      m_frames++;
+      return m_free;
+      }
+    void Run();
+
+  public:
+    int m_frametime;
+    std::atomic<int> m_frames;
+    CANopenWorker* m_worker;
+    SimNode* m_node[128];
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::priority_queue<event_t> m_events;
+    int64_t m_free;
+    uint64_t m_seq;
+    bool m_stop;
+    std::thread m_thread;
+  };
+
+
+/**
+ * SimNode: SDO server with expedited, segmented and block protocols.
+ *  All state is handled in the bus task.
+ */
+class SimNode
+  {
+  public:
+    SimNode(SimBus* bus, uint8_t nodeid, int latency_us, bool blocks=true)
+      {
+      m_bus = bus;
+      m_nodeid = nodeid;
+      m_latency = latency_us;
+      m_blocks = blocks;
+      m_blksize = 16;
+      m_drop_upload = m_drop_download = 0;
+      m_corrupt_crc = m_corrupt_data = false;
+      m_state = Idle;
+      bus->m_node[nodeid] = this;
+      }
+
+  public:
+    std::vector<uint8_t>& Object(uint16_t index, uint8_t subindex)
+      {
+      return m_od[(index << 8) | subindex];
+      }
+    void Receive(const CAN_frame_t& frame, int64_t time);
+
+  private:
+    enum state_t { Idle, UploadSeg, DownloadSeg, BlockUploadInit, BlockUpload, BlockUploadEnd,
+      BlockDownload, BlockDownloadEnd };
+    void Respond(const uint8_t* data, int64_t time)
+      {
+      CAN_frame_t frame;
+      memset(&frame, 0, sizeof(frame));
+      frame.origin = m_bus;
+      frame.FIR.B.DLC = 8;
+      frame.MsgID = 0x580 + m_nodeid;
+      memcpy(frame.data.u8, data, 8);
+      m_bus->Schedule(frame, time + m_latency);
+      }
+    void Respond(uint8_t control, uint32_t data, int64_t time)
+      {
+      uint8_t b[8] = { control, (uint8_t)m_index, (uint8_t)(m_index >> 8), m_subindex,
+        (uint8_t)data, (uint8_t)(data >> 8), (uint8_t)(data >> 16), (uint8_t)(data >> 24) };
+      Respond(b, time);
+      }
+    void Abort(uint32_t code, int64_t time)
+      {
+      Respond(0x80, code, time);
+      m_state = Idle;
+      }
+    void InitUpload(int64_t time);
+    void SendSegment(int64_t time);
+    void SendBlock(int64_t time);
+
+  public:
+    std::map<uint32_t, std::vector<uint8_t>> m_od;
+    bool m_blocks;                    // block protocol support
+    uint8_t m_blksize;                // download block size requested
+    uint8_t m_drop_upload;            // fault injection: skip sending this seqno once
+    uint8_t m_drop_download;          // fault injection: ignore this seqno once
+    bool m_corrupt_crc;               // fault injection: send wrong upload CRC once
+    bool m_corrupt_data;              // fault injection: corrupt download data once
+
+  private:
+    SimBus* m_bus;
+    uint8_t m_nodeid;
+    int m_latency;
+    state_t m_state;
+    uint16_t m_index;
+    uint8_t m_subindex;
+    std::vector<uint8_t> m_data;
+    size_t m_pos, m_blockstart;
+    uint8_t m_toggle, m_seqno, m_upblksize;
+  };
+
+void SimBus::Run()
+  {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop)
+    {
+    if (m_events.empty())
+      {
+      m_cond.wait(lock);
+      continue;
+      }
+    event_t ev = m_events.top();
+    if (ev.time > now_us())
+      {
+      m_cond.wait_until(lock, std::chrono::steady_clock::time_point(std::chrono::microseconds(ev.time)));
+      continue;
+      }
+    m_events.pop();
+    if (!ev.deliver)
+      {
+      // node transmission: queue on the bus
+      ev.time = Transmit(ev.time);
+      ev.deliver = true;
+      ev.seq = m_seq++;
+      m_events.push(ev);
+      continue;
+      }
+    lock.unlock();
+    uint32_t id = ev.frame.MsgID;
+    if (id >= 0x600 && id < 0x680 && m_node[id - 0x600])
+      m_node[id - 0x600]->Receive(ev.frame, ev.time);
+    else if (m_worker)
+      m_worker->IncomingFrame(&ev.frame);
+    lock.lock();
+    }
+  }
+
+void SimNode::InitUpload(int64_t time)
+  {
+  m_toggle = 0;
+  m_pos = 0;
+  if (m_data.size() <= 4)
+    {
+    uint8_t b[8] = { (uint8_t)(0x43 | ((4 - m_data.size()) << 2)), (uint8_t)m_index, (uint8_t)(m_index >> 8), m_subindex };
+    memcpy(b+4, m_data.data(), m_data.size());
+    Respond(b, time);
+    m_state = Idle;
+    }
+  else
+    {
+    Respond(0x41, m_data.size(), time);
+    m_state = UploadSeg;
+    }
+  }
+
+void SimNode::SendSegment(int64_t time)
+  {
+  uint8_t b[8] = { 0 };
+  size_t n = std::min<size_t>(7, m_data.size() - m_pos);
+  bool last = (m_pos + n >= m_data.size());
+  b[0] = m_toggle | ((7 - n) << 1) | (last ? 1 : 0);
+  memcpy(b+1, m_data.data() + m_pos, n);
+  m_pos += n;
+  m_toggle ^= 0x10;
+  Respond(b, time);
+  if (last)
+    m_state = Idle;
+  }
+
+void SimNode::SendBlock(int64_t time)
+  {
+  m_blockstart = m_pos;
+  size_t pos = m_pos;
+  for (uint8_t seqno = 1; seqno <= m_upblksize && pos < m_data.size(); seqno++)
+    {
+    uint8_t b[8] = { 0 };
+    size_t n = std::min<size_t>(7, m_data.size() - pos);
+    memcpy(b+1, m_data.data() + pos, n);
+    pos += n;
+    b[0] = seqno | ((pos >= m_data.size()) ? 0x80 : 0);
+    if (seqno == m_drop_upload)
+      m_drop_upload = 0;
+    else
+      Respond(b, time);
+    }
+  }
+
+void SimNode::Receive(const CAN_frame_t& frame, int64_t time)
+  {
+  const uint8_t* r = frame.data.u8;
+  uint8_t c = r[0];
+
+  if (m_state == BlockDownload)
+    {
+    uint8_t seqno = c & 0x7f;
+    if (seqno == 0)
+      {
+      m_state = Idle; // abort
+      return;
+      }
+    if (seqno == m_drop_download)
+      m_drop_download = 0;
+    else if (seqno == m_seqno + 1)
+      {
+      m_seqno = seqno;
+      m_data.insert(m_data.end(), r+1, r+8);
+      if (m_corrupt_data)
+        {
+        m_data.back() ^= 0x55;
+        m_corrupt_data = false;
+        }
+      if (c & 0x80)
+        m_state = BlockDownloadEnd;
+      }
+    if (seqno == m_blksize || (c & 0x80))
+      {
+      uint8_t b[8] = { 0xa2, m_seqno, m_blksize };
+      Respond(b, time);
+      m_seqno = 0;
+      }
+    return;
+    }
+
+  switch (c & 0xe0)
+    {
+    case 0x80: // abort
+      m_state = Idle;
+      return;
+    case 0x40: // init upload
+    case 0xa0: // block upload
+      if ((c & 0xe0) == 0xa0 && (c & 0x03) != 0)
+        break;
+      m_index = r[1] | (r[2] << 8);
+      m_subindex = r[3];
+      if (!m_od.count((m_index << 8) | m_subindex))
+        return Abort(SDO_ABORT_NOOBJECT, time);
+      m_data = Object(m_index, m_subindex);
+      if ((c & 0xe0) == 0x40)
+        return InitUpload(time);
+      if (!m_blocks)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      if (r[5] && m_data.size() <= r[5])
+        return InitUpload(time); // protocol switch
+      m_upblksize = r[4];
+      m_pos = 0;
+      m_state = BlockUploadInit;
+      return Respond(0xc6, m_data.size(), time);
+    case 0x60: // upload segment
+      if (m_state != UploadSeg)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      if ((c & 0x10) != m_toggle)
+        return Abort(SDO_ABORT_TOGGLE, time);
+      return SendSegment(time);
+    case 0x20: // init download
+      m_index = r[1] | (r[2] << 8);
+      m_subindex = r[3];
+      if (c & 0x02)
+        {
+        size_t n = (c & 0x01) ? 4 - ((c >> 2) & 3) : 4;
+        Object(m_index, m_subindex).assign(r+4, r+4+n);
+        m_state = Idle;
+        }
+      else
+        {
+        m_data.clear();
+        m_toggle = 0;
+        m_state = DownloadSeg;
+        }
+      return Respond(0x60, 0, time);
+    case 0x00: // download segment
+      {
+      if (m_state != DownloadSeg)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      if ((c & 0x10) != m_toggle)
+        return Abort(SDO_ABORT_TOGGLE, time);
+      size_t n = 7 - ((c >> 1) & 7);
+      m_data.insert(m_data.end(), r+1, r+1+n);
+      uint8_t b[8] = { (uint8_t)(0x20 | m_toggle) };
+      m_toggle ^= 0x10;
+      if (c & 0x01)
+        {
+        Object(m_index, m_subindex) = m_data;
+        m_state = Idle;
+        }
+      return Respond(b, time);
+      }
+    case 0xc0: // block download
+      if ((c & 0x01) == 0)
+        {
+        if (!m_blocks)
+          return Abort(SDO_ABORT_INVALIDCMD, time);
+        m_index = r[1] | (r[2] << 8);
+        m_subindex = r[3];
+        m_data.clear();
+        m_seqno = 0;
+        m_state = BlockDownload;
+        return Respond(0xa4, m_blksize, time);
+        }
+      if (m_state != BlockDownloadEnd)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      m_data.resize(m_data.size() - ((c >> 2) & 7));
+      if (crc16(m_data.data(), m_data.size()) != (r[1] | (r[2] << 8)))
+        return Abort(SDO_ABORT_CRC, time);
+      Object(m_index, m_subindex) = m_data;
+      m_state = Idle;
+      return Respond(0xa1, 0, time);
+    }
+
+  // block upload sub commands:
+  switch (c & 0x03)
+    {
+    case 3: // start
+      if (m_state != BlockUploadInit && m_state != BlockUpload)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      if (m_state == BlockUploadInit)
+        m_blockstart = 0;
+      m_state = BlockUpload;
+      m_pos = m_blockstart;
+      return SendBlock(time);
+    case 2: // acknowledge
+      if (m_state != BlockUpload)
+        return Abort(SDO_ABORT_INVALIDCMD, time);
+      if (r[1] > m_upblksize)
+        return Abort(SDO_ABORT_SEQNO, time);
+      m_pos = std::min<size_t>(m_blockstart + r[1] * 7, m_data.size());
+      m_upblksize = r[2];
+      if (m_pos < m_data.size())
+        return SendBlock(time);
+      else
+        {
+        uint16_t crc = crc16(m_data.data(), m_data.size());
+        if (m_corrupt_crc)
+          {
+          crc ^= 1;
+          m_corrupt_crc = false;
+          }
+        uint8_t b[8] = { (uint8_t)(0xc1 | (((7 - m_data.size() % 7) % 7) << 2)), (uint8_t)crc, (uint8_t)(crc >> 8) };
+        m_state = BlockUploadEnd;
+        return Respond(b, time);
+        }
+    case 1: // end confirmation
+      m_state = Idle;
+      return;
+    default:
+      return Abort(SDO_ABORT_INVALIDCMD, time);
+    }
+  }
+
+
+/**
+ * Test setup: bus, worker & client
+ *  The host stubs cannot delete other tasks, so setups are created on the
+ *  heap and left running.
+ */
+struct SimSetup
+  {
+  SimBus bus;
+  CANopenWorker worker;
+  CANopenClient client;
+  SimSetup(int frametime_us) : bus(frametime_us), worker(&bus), client(&worker)
+    {
+    bus.m_worker = &worker;
+    }
+  };
+
+static std::vector<uint8_t> pattern(size_t size, uint32_t seed)
+  {
+  std::vector<uint8_t> v(size);
+  for (size_t i = 0; i < size; i++)
+    v[i] = host_test_rand(seed);
+  return v;
+  }
+
+static CANopenResult_t read_sdo(CANopenClient& client, uint8_t nodeid, uint16_t index, std::vector<uint8_t>& buf,
+  size_t bufsize, CANopenJob* pjob=NULL)
+  {
+  CANopenJob job;
+  buf.assign(bufsize + 8, 0xee);
+  CANopenResult_t res = client.ReadSDO(job, nodeid, index, 0, buf.data(), bufsize);
+  for (size_t i = bufsize; i < buf.size(); i++)
+    CHECKF(buf[i] == 0xee, "read beyond buffer at %zu", i);
+  buf.resize(job.sdo.xfersize);
+  if (pjob) *pjob = job;
+  return res;
+  }
+
+static CANopenResult_t write_sdo(CANopenClient& client, uint8_t nodeid, uint16_t index, std::vector<uint8_t>& data)
+  {
+  CANopenJob job;
+  return client.WriteSDO(job, nodeid, index, 0, data.data(), data.size());
+  }
+
+static void test_sizes()
+  {
+  SimSetup& s = *new SimSetup(0);
+  SimNode& node = *new SimNode(&s.bus, 1, 0);
+  for (int blksize : { 0, 16, 5 })
+    {
+    s.client.SetBlockTransfer(blksize);
+    for (size_t size = 1; size <= 300; size++)
+      {
+      std::vector<uint8_t> data = pattern(size, size * 7 + blksize), buf;
+      node.Object(0x2000, 0) = data;
+      CHECKF(read_sdo(s.client, 1, 0x2000, buf, size) == COR_OK, "read size %zu blksize %d", size, blksize);
+      CHECKF(buf == data, "read data size %zu blksize %d", size, blksize);
+
+      data = pattern(size, size * 11 + blksize);
+      CHECKF(write_sdo(s.client, 1, 0x2001, data) == COR_OK, "write size %zu blksize %d", size, blksize);
+      CHECKF(node.Object(0x2001, 0) == data, "write data size %zu blksize %d", size, blksize);
+      }
+    }
+  }
+
+static void test_fallback()
+  {
+  SimSetup& s = *new SimSetup(0);
+  SimNode& node = *new SimNode(&s.bus, 1, 0, false);
+  s.client.SetBlockTransfer(16);
+  for (size_t size : { 3, 30, 300 })
+    {
+    std::vector<uint8_t> data = pattern(size, size), buf;
+    node.Object(0x2000, 0) = data;
+    CHECKF(read_sdo(s.client, 1, 0x2000, buf, size) == COR_OK, "fallback read size %zu", size);
+    CHECK(buf == data);
+    CHECKF(write_sdo(s.client, 1, 0x2001, data) == COR_OK, "fallback write size %zu", size);
+    CHECK(node.Object(0x2001, 0) == data);
+    }
+  }
+
+static void test_faults()
+  {
+  SimSetup& s = *new SimSetup(0);
+  SimNode& node = *new SimNode(&s.bus, 1, 0);
+  s.client.SetBlockTransfer(16);
+  std::vector<uint8_t> data = pattern(300, 1), buf;
+  node.Object(0x2000, 0) = data;
+
+  // lost upload segments, mid block & end of block (recovered after timeout):
+  for (uint8_t seqno : { 5, 16 })
+    {
+    node.m_drop_upload = seqno;
+    CHECKF(read_sdo(s.client, 1, 0x2000, buf, data.size()) == COR_OK, "lost upload segment %d", seqno);
+    CHECK(buf == data);
+    CHECK(node.m_drop_upload == 0);
+    }
+
+  // lost download segments:
+  for (uint8_t seqno : { 5, 16 })
+    {
+    node.m_drop_download = seqno;
+    CHECKF(write_sdo(s.client, 1, 0x2001, data) == COR_OK, "lost download segment %d", seqno);
+    CHECK(node.Object(0x2001, 0) == data);
+    CHECK(node.m_drop_download == 0);
+    }
+
+  // CRC errors:
+  node.m_corrupt_crc = true;
+  CHECK(read_sdo(s.client, 1, 0x2000, buf, data.size()) == COR_ERR_SDO_CRC);
+  node.m_corrupt_data = true;
+  node.Object(0x2001, 0).clear();
+  CHECK(write_sdo(s.client, 1, 0x2001, data) == COR_ERR_SDO_CRC);
+  CHECK(node.Object(0x2001, 0).empty());
+
+  // buffer overflow, all protocols (expedited, segmented, block):
+  for (int blksize : { 0, 16 })
+    {
+    s.client.SetBlockTransfer(blksize);
+    for (size_t size : { 4, 100, 300 })
+      {
+      node.Object(0x2002, 0) = pattern(size, size);
+      CANopenJob job;
+      CHECKF(read_sdo(s.client, 1, 0x2002, buf, size - 1, &job) == COR_ERR_BufferTooSmall,
+        "overflow size %zu blksize %d", size, blksize);
+      CHECK(job.sdo.xfersize == size - 1);
+      // node must be usable again:
+      CHECK(read_sdo(s.client, 1, 0x2000, buf, data.size()) == COR_OK);
+      CHECK(buf == data);
+      }
+    }
+
+  // unknown object:
+  CANopenJob job;
+  CHECK(read_sdo(s.client, 1, 0x3000, buf, 10, &job) == COR_ERR_SDO_Access);
+  CHECK(job.sdo.error == SDO_ABORT_NOOBJECT);
+  }
+
+
+/**
+ * Benchmarks
+ */
+
+static void bench_throughput()
+  {
+  printf("1 KiB read / write at 500 kbit/s (250 us/frame), segmented vs block (16):\n");
+  for (int latency : { 0, 500, 2000, 5000 })
+    {
+    SimSetup& s = *new SimSetup(250);
+    SimNode& node = *new SimNode(&s.bus, 1, latency);
+    std::vector<uint8_t> data = pattern(1024, 1), buf;
+    node.Object(0x2000, 0) = data;
+    double kbs[2][2];
+    int frames[2][2];
+    for (int mode = 0; mode < 2; mode++)
+      {
+      s.client.SetBlockTransfer(mode ? 16 : 0);
+      for (int dir = 0; dir < 2; dir++)
+        {
+        int f0 = s.bus.m_frames;
+        double t0 = host_test_us();
+        CANopenResult_t res = dir ? write_sdo(s.client, 1, 0x2001, data) : read_sdo(s.client, 1, 0x2000, buf, 1024);
+        double t = host_test_us() - t0;
+        CHECK(res == COR_OK);
+        kbs[mode][dir] = 1024 / t * 1e3;
+        frames[mode][dir] = s.bus.m_frames - f0;
+        }
+      }
+    printf("  node latency %4.1f ms: read %5.1f -> %5.1f kB/s (%d -> %d frames), "
+      "write %5.1f -> %5.1f kB/s (%d -> %d frames)\n", latency / 1000.0,
+      kbs[0][0], kbs[1][0], frames[0][0], frames[1][0], kbs[0][1], kbs[1][1], frames[0][1], frames[1][1]);
+    }
+  }
+
+static void bench_concurrency()
+  {
+  SimSetup& s = *new SimSetup(250);
+  SimNode& slow = *new SimNode(&s.bus, 1, 10000);
+  SimNode& fast = *new SimNode(&s.bus, 2, 200);
+  slow.Object(0x2000, 0) = pattern(64, 1);
+  fast.Object(0x2000, 0) = pattern(64, 2);
+  CANopenClient slowclient(&s.worker);
+  double t0 = host_test_us(), tfast = 0, tslow = 0;
+  std::thread slowthread([&]()
+    {
+    std::vector<uint8_t> buf;
+    for (int i = 0; i < 20; i++)
+      CHECK(read_sdo(slowclient, 1, 0x2000, buf, 64) == COR_OK);
+    tslow = host_test_us() - t0;
+    });
+  std::vector<uint8_t> buf;
+  for (int i = 0; i < 20; i++)
+    CHECK(read_sdo(s.client, 2, 0x2000, buf, 64) == COR_OK);
+  tfast = host_test_us() - t0;
+  slowthread.join();
+  printf("20 x 64 byte reads each, slow node (10 ms) & fast node (0.2 ms) in parallel, %d worker%s:\n"
+    "  fast node done after %.0f ms, slow node after %.0f ms\n",
+    CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS, (CONFIG_OVMS_COMP_CANOPEN_WRK_TASKS > 1) ? "s" : "",
+    tfast / 1000, tslow / 1000);
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+    if (argc < 3 || strcmp(argv[2], "concurrency") != 0)
+      bench_throughput();
+    bench_concurrency();
+    return host_test_result("bench_canopen_sdo");
+    }
+  test_sizes();
+  test_fallback();
+  test_faults();
+  return host_test_result("test_canopen_sdo");
+  }
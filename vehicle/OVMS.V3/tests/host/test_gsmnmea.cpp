@@ -0,0 +1,517 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: NMEA sentence parser
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_gsmnmea         decoding, publish on change, fuzzing, heap use
+//   test_gsmnmea bench   time & allocations per sentence, in place vs. former std::string parser
+//
+// Fuzzing feeds each sentence from an exactly sized heap buffer, build with
+// CXXFLAGS="-O1 -g -fsanitize=address" to detect reads beyond the sentence.
+
+#include <math.h>
+#include <string.h>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "host_test.h"
+#include "esp_timer.h"
+#include "ovms_config.h"
+#include "ovms_events.h"
+#include "ovms_time.h"
+#include "ovms_utils.h"
+#include "metrics_standard.h"
+#include "gsmnmea.h"
+
+////////////////////////////////////////////////////////////////////////
+// Heap allocation counter
+////////////////////////////////////////////////////////////////////////
+
+static size_t s_allocs = 0;
+
+void* operator new(std::size_t sz)
+  {
+  s_allocs++;
+  void* p = malloc(sz ? sz : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+  }
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, std::size_t) noexcept { free(p); }
+
+
+////////////////////////////////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////////////////////////////////
+
+static int64_t s_now = 1000000;   // [µs]
+static int64_t test_clock() { return s_now; }
+
+static std::string nmea(const std::string& body)
+  {
+  unsigned char chk = 0;
+  for (char c : body)
+    chk ^= (unsigned char)c;
+  char tail[8];
+  snprintf(tail, sizeof(tail), "*%02X", chk);
+  return "$" + body + tail;
+  }
+
+static void feed(GsmNMEA& gps, const std::string& s)
+  {
+  // exactly sized, not terminated:
+  char* buf = (char*) malloc(s.size() ? s.size() : 1);
+  memcpy(buf, s.data(), s.size());
+  gps.IncomingLine(buf, s.size());
+  free(buf);
+  }
+
+static double drand(uint32_t &rnd)
+  {
+  return (host_test_rand(rnd) & 0xffffff) / (double)0x1000000;
+  }
+
+// NMEA ddmm.mmmmmm / dddmm.mmmmmm from degrees:
+static std::string nmea_deg(double deg, bool lon)
+  {
+  double a = fabs(deg);
+  int d = (int)a;
+  char buf[32];
+  snprintf(buf, sizeof(buf), lon ? "%03d%09.6f" : "%02d%09.6f", d, (a - d) * 60);
+  return buf;
+  }
+
+static std::string gns(double lat, double lon, const char* mode="AA", int sat=12, double hdop=0.9, double alt=321.3)
+  {
+  char buf[128];
+  snprintf(buf, sizeof(buf), "GNGNS,085320.0,%s,%c,%s,%c,%s,%d,%.1f,%.1f,47.0,,",
+    nmea_deg(lat, false).c_str(), lat < 0 ? 'S' : 'N', nmea_deg(lon, true).c_str(), lon < 0 ? 'W' : 'E',
+    mode, sat, hdop, alt);
+  return nmea(buf);
+  }
+
+static std::string rmc(const char* time, double knots, double dir, const char* date="101223")
+  {
+  char buf[128];
+  snprintf(buf, sizeof(buf), "GPRMC,%s,A,5118.138139,N,00723.398844,E,%.1f,%.1f,%s,,,A", time, knots, dir, date);
+  return nmea(buf);
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Former parser (std::string copies, istringstream, atof), for the benchmark
+////////////////////////////////////////////////////////////////////////
+
+static float former_gps2latlon(const char *gpscoord)
+  {
+  double f;
+  long d;
+  f = atof(gpscoord);
+  d = (long) (f / 100);
+  f = d + (f - (d * 100)) / 60;
+  return (float) f;
+  }
+
+static bool former_cksum(const std::string line)
+  {
+  const char *cp = line.c_str();
+  if (*cp != '$')
+    return 0;
+  ++cp;
+  const char *ep = strchr(cp, '*');
+  if (ep == NULL)
+    return 0;
+  unsigned char chk = 0;
+  while (cp < ep)
+    chk ^= (const unsigned char)*cp++;
+  unsigned char chk2 = (unsigned char)strtoul(ep + 1, NULL, 16);
+  return (chk == chk2);
+  }
+
+static void former_incoming_line(const std::string line)
+  {
+  std::istringstream sentence(line);
+  std::string token;
+
+  if (!std::getline(sentence, token, ','))
+    return;
+  if (token.length() < 6 || token[0] != '$')
+    return;
+  if (!former_cksum(line))
+    return;
+
+  if (token.substr(3) == "GNS")
+    {
+    float lat=0, lon=0, alt=0, hdop=0;
+    char ns=0, ew=0;
+    char mode[3] = {0,0,0};
+    int satcnt=0;
+    if (std::getline(sentence, token, ',')) {;}
+    if (std::getline(sentence, token, ',')) lat = former_gps2latlon(token.c_str());
+    if (std::getline(sentence, token, ',')) ns = token[0];
+    if (std::getline(sentence, token, ',')) lon = former_gps2latlon(token.c_str());
+    if (std::getline(sentence, token, ',')) ew = token[0];
+    if (std::getline(sentence, token, ',')) { mode[0] = token[0]; mode[1] = token[1]; }
+    if (std::getline(sentence, token, ',')) satcnt = atoi(token.c_str());
+    if (std::getline(sentence, token, ',')) hdop = atof(token.c_str());
+    if (std::getline(sentence, token, ',')) alt = atof(token.c_str());
+    if (!ns || !ew || !mode[0])
+      return;
+    if (ns == 'S') lat = -lat;
+    if (ew == 'W') lon = -lon;
+    bool gpslock = (mode[0] != 'N' || mode[1] != 'N');
+    *StdMetrics.ms_v_pos_gpsmode = (std::string) mode;
+    *StdMetrics.ms_v_pos_satcount = (int) satcnt;
+    *StdMetrics.ms_v_pos_gpshdop = (float) hdop;
+    *StdMetrics.ms_v_pos_gpssq = (int) LIMIT_MAX(gpslock * LIMIT_MIN(satcnt-1,0) / LIMIT_MIN(hdop,0.1) * 10, 100);
+    if (gpslock)
+      {
+      *StdMetrics.ms_v_pos_latitude = (float) lat;
+      *StdMetrics.ms_v_pos_longitude = (float) lon;
+      *StdMetrics.ms_v_pos_altitude = (float) alt;
+      *StdMetrics.ms_v_pos_gpstime = (int64_t) time(NULL);
+      }
+    if (gpslock != StdMetrics.ms_v_pos_gpslock->AsBool())
+      *StdMetrics.ms_v_pos_gpslock = (bool) gpslock;
+    }
+  else if (token.substr(3) == "RMC")
+    {
+    char date[7] = {0}, time[7] = {0};
+    float direction=0, speed=0;
+    bool speedok = false, directionok = false;
+    if (std::getline(sentence, token, ',')) strncpy(time, token.c_str(), 6);
+    for (int i = 0; i < 5; i++)
+      std::getline(sentence, token, ',');
+    if (std::getline(sentence, token, ','))
+      {
+      speedok = !token.empty();
+      if (speedok) speed = atof(token.c_str()) * 1.852;
+      }
+    if (std::getline(sentence, token, ','))
+      {
+      directionok = !token.empty();
+      if (directionok) direction = atof(token.c_str());
+      }
+    if (std::getline(sentence, token, ',')) strncpy(date, token.c_str(), 6);
+    if (!date[0] || !time[0])
+      return;
+    if (directionok) *StdMetrics.ms_v_pos_direction = (float) direction;
+    if (speedok) *StdMetrics.ms_v_pos_gpsspeed = speed;
+    }
+  }
+
+
+////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////
+
+static void test_decode()
+  {
+  GsmNMEA gps(NULL, 1, 2);
+  MyConfig.SetParamValue("modem", "enable.gpstime", "yes");
+  gps.Startup();
+
+  feed(gps, nmea("GNGNS,085320.0,5118.138139,N,00723.398844,E,AA,12,0.9,321.3,47.0,,"));
+  CHECK(gps.m_count_sentences == 1 && gps.m_count_errors == 0);
+  CHECKF(fabs(StdMetrics.ms_v_pos_latitude->AsFloat() - 51.30230232) < 1e-5, "lat %f", StdMetrics.ms_v_pos_latitude->AsFloat());
+  CHECKF(fabs(StdMetrics.ms_v_pos_longitude->AsFloat() - 7.38998073) < 1e-5, "lon %f", StdMetrics.ms_v_pos_longitude->AsFloat());
+  CHECK(fabsf(StdMetrics.ms_v_pos_altitude->AsFloat() - 321.3f) < 1e-4);
+  CHECK(fabsf(StdMetrics.ms_v_pos_gpshdop->AsFloat() - 0.9f) < 1e-6);
+  CHECK(StdMetrics.ms_v_pos_satcount->AsInt() == 12);
+  CHECK(StdMetrics.ms_v_pos_gpsmode->AsString() == "AA");
+  CHECK(StdMetrics.ms_v_pos_gpslock->AsBool());
+  CHECK(StdMetrics.ms_v_pos_gpssq->AsInt() == 100);
+
+  // south / west, 6 satellites at HDOP 1.0 → SQ 50:
+  s_now += 1000000;
+  feed(gps, gns(-33.8688, -151.2093, "AN", 6, 1.0, -12.5));
+  CHECK(fabs(StdMetrics.ms_v_pos_latitude->AsFloat() + 33.8688) < 1e-5);
+  CHECK(fabs(StdMetrics.ms_v_pos_longitude->AsFloat() + 151.2093) < 1e-5);
+  CHECK(fabsf(StdMetrics.ms_v_pos_altitude->AsFloat() + 12.5f) < 1e-4);
+  CHECK(StdMetrics.ms_v_pos_gpssq->AsInt() == 50);
+
+  // no fix: lock lost, position kept:
+  s_now += 1000000;
+  feed(gps, nmea("GNGNS,085321.0,,N,,E,NN,0,99.9,,,,"));
+  CHECK(!StdMetrics.ms_v_pos_gpslock->AsBool());
+  CHECK(StdMetrics.ms_v_pos_gpssq->AsInt() == 0);
+  CHECK(fabs(StdMetrics.ms_v_pos_latitude->AsFloat() + 33.8688) < 1e-5);
+
+  // out of range positions are rejected:
+  s_now += 1000000;
+  uint32_t mod = StdMetrics.ms_v_pos_latitude->m_modified;
+  feed(gps, nmea("GNGNS,085322.0,9130.000000,N,00723.398844,E,AA,12,0.9,321.3,47.0,,"));
+  feed(gps, nmea("GNGNS,085322.0,5118.138139,N,18030.000000,E,AA,12,0.9,321.3,47.0,,"));
+  feed(gps, nmea("GNGNS,085322.0,5161.000000,N,00723.398844,E,AA,12,0.9,321.3,47.0,,"));
+  CHECK(StdMetrics.ms_v_pos_latitude->m_modified == mod);
+  CHECK(!StdMetrics.ms_v_pos_gpslock->AsBool());
+
+  // RMC: speed, direction, time:
+  feed(gps, rmc("085320.0", 10.0, 265.5));
+  CHECKF(fabsf(StdMetrics.ms_v_pos_gpsspeed->AsFloat() - 18.52f) < 1e-4, "speed %f", StdMetrics.ms_v_pos_gpsspeed->AsFloat());
+  CHECK(fabsf(StdMetrics.ms_v_pos_direction->AsFloat() - 265.5f) < 1e-4);
+  CHECKF(MyTime.m_time == 1702198400, "time %ld", (long)MyTime.m_time);   // 2023-12-10 08:53:20 UTC
+
+  // time is only set when the second changes:
+  int sets = MyTime.m_sets;
+  feed(gps, rmc("085320.5", 10.0, 265.5));
+  feed(gps, rmc("085320.9", 10.0, 265.5));
+  CHECK(MyTime.m_sets == sets);
+  feed(gps, rmc("085321.0", 10.0, 265.5));
+  CHECK(MyTime.m_sets == sets + 1 && MyTime.m_time == 1702198401);
+
+  // checksums: lower case hex accepted, mismatch & missing rejected:
+  uint32_t errors = gps.m_count_errors;
+  std::string s = nmea("GPRMC,085322.0,A,5118.138139,N,00723.398844,E,0.0,10.0,101223,,,A");
+  for (char &c : s) c = (c >= 'A' && c <= 'F' && &c > &s[s.size()-3]) ? c + 32 : c;
+  feed(gps, s);
+  CHECK(gps.m_count_errors == errors);
+  s[s.size()-1] = (s[s.size()-1] == '0') ? '1' : '0';
+  feed(gps, s);
+  feed(gps, "$GPRMC,085322.0,A,5118.138139,N,00723.398844,E,0.0,10.0,101217,,,A");
+  feed(gps, "$GPRMC,085322.0,A*4");
+  CHECK(gps.m_count_errors == errors + 3);
+
+  gps.Shutdown();
+  MyConfig.SetParamValue("modem", "enable.gpstime", "no");
+  }
+
+/**
+ * 10 Hz fix rate: jitter below the thresholds publishes about once per second,
+ *  significant moves immediately
+ */
+static void test_publish()
+  {
+  GsmNMEA gps(NULL, 1, 2);
+  gps.Startup();
+  uint32_t rnd = 0x0badf00d;
+  OvmsMetric* lat = StdMetrics.ms_v_pos_latitude;
+  OvmsMetric* speed = StdMetrics.ms_v_pos_gpsspeed;
+
+  // 10 s parked, ±0.3 m jitter:
+  feed(gps, gns(48.1, 11.5));
+  uint32_t skipped = gps.m_count_skipped;
+  for (int i = 0; i < 100; i++)
+    {
+    s_now += 100000;
+    feed(gps, gns(48.1 + (drand(rnd) - 0.5) * 0.000005, 11.5));
+    }
+  uint32_t pubs = 100 - (gps.m_count_skipped - skipped);
+  CHECKF(pubs >= 9 && pubs <= 12, "%u GNS published in 10 s parked", pubs);
+
+  // driving 50 km/h = 1.4 m per fix:
+  skipped = gps.m_count_skipped;
+  uint32_t mod = lat->m_modified;
+  for (int i = 1; i <= 100; i++)
+    {
+    s_now += 100000;
+    feed(gps, gns(48.1 + i * 0.0000125, 11.5));
+    }
+  CHECKF(gps.m_count_skipped == skipped, "%u GNS skipped in 10 s driving", gps.m_count_skipped - skipped);
+  CHECKF(lat->m_modified - mod == 100, "%u position updates in 10 s driving", lat->m_modified - mod);
+
+  // satellite count & mode changes publish immediately:
+  s_now += 100000;
+  mod = StdMetrics.ms_v_pos_satcount->m_modified;
+  feed(gps, gns(48.1 + 100 * 0.0000125, 11.5, "AA", 11));
+  CHECK(StdMetrics.ms_v_pos_satcount->m_modified == mod + 1);
+  s_now += 100000;
+  feed(gps, gns(48.1 + 100 * 0.0000125, 11.5, "DA", 11));
+  CHECK(StdMetrics.ms_v_pos_gpsmode->AsString() == "DA");
+
+  // RMC speed: 0.1 kn noise skipped, 1 kn change published:
+  feed(gps, rmc("090000.0", 20.0, 90.0));
+  mod = speed->m_modified;
+  for (int i = 0; i < 5; i++)
+    {
+    s_now += 100000;
+    feed(gps, rmc("090000.0", 20.0 + (i & 1) * 0.1, 90.0));
+    }
+  CHECK(speed->m_modified == mod);
+  feed(gps, rmc("090001.0", 21.0, 90.0));
+  CHECK(speed->m_modified == mod + 1);
+  // direction wraps at 360°:
+  feed(gps, rmc("090001.0", 21.0, 359.5));
+  feed(gps, rmc("090001.0", 21.0, 0.2));
+  CHECK(fabsf(StdMetrics.ms_v_pos_direction->AsFloat() - 359.5f) < 1e-4);
+  gps.Shutdown();
+  }
+
+/**
+ * Fuzzing: mutated sentences, checksum recomputed for most of them so the
+ *  field parsers see the garbage
+ */
+static void test_fuzz(int rounds)
+  {
+  GsmNMEA gps(NULL, 1, 2);
+  MyConfig.SetParamValue("modem", "enable.gpstime", "yes");
+  gps.Startup();
+  uint32_t rnd = 0xf0221e55;
+  static const char alphabet[] = "$*,.-+0123456789ABCDEFNSEWAGPRMCNS \r\n\x01\xff";
+  int range_errors = 0;
+
+  for (int r = 0; r < rounds; r++)
+    {
+    std::string body;
+    switch (host_test_rand(rnd) % 3)
+      {
+      case 0:
+        body = gns(180 * drand(rnd) - 90, 360 * drand(rnd) - 180).substr(1);
+        break;
+      case 1:
+        body = rmc("123456.0", 100 * drand(rnd), 360 * drand(rnd)).substr(1);
+        break;
+      default:
+        body = "GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39";
+        break;
+      }
+    body = body.substr(0, body.rfind('*'));
+
+    int mutations = 1 + host_test_rand(rnd) % 4;
+    for (int m = 0; m < mutations; m++)
+      {
+      size_t pos = body.empty() ? 0 : host_test_rand(rnd) % body.size();
+      char c = alphabet[host_test_rand(rnd) % (sizeof(alphabet) - 1)];
+      switch (host_test_rand(rnd) % 6)
+        {
+        case 0: if (!body.empty()) body[pos] = c; break;
+        case 1: body.insert(pos, 1, c); break;
+        case 2: if (!body.empty()) body.erase(pos, 1); break;
+        case 3: body.resize(pos); break;
+        case 4: body.insert(pos, std::string(1 + host_test_rand(rnd) % 30, (c & 1) ? '9' : ',')); break;
+        case 5: body.insert(pos, "."); break;
+        }
+      }
+
+    std::string s;
+    switch (host_test_rand(rnd) % 10)
+      {
+      case 0:  s = "$" + body; break;                                  // no checksum
+      case 1:  s = "$" + body + "*" + body.substr(0, host_test_rand(rnd) % 3); break;
+      case 2:  s = body; break;                                        // no '$'
+      default: s = nmea(body); break;
+      }
+    feed(gps, s);
+
+    float lat = StdMetrics.ms_v_pos_latitude->AsFloat();
+    float lon = StdMetrics.ms_v_pos_longitude->AsFloat();
+    if (!(lat >= -90 && lat <= 90 && lon >= -180 && lon <= 180))
+      range_errors++;
+    }
+
+  CHECKF(range_errors == 0, "%d positions out of range", range_errors);
+  CHECK(gps.m_count_sentences + gps.m_count_errors <= (uint32_t)rounds);
+  CHECK(gps.m_count_sentences > (uint32_t)rounds / 2);
+  CHECK(gps.m_count_errors > 0);
+  printf("fuzz: %d sentences, %u parsed, %u invalid, %u unchanged\n", rounds,
+    gps.m_count_sentences, gps.m_count_errors, gps.m_count_skipped);
+  gps.Shutdown();
+  MyConfig.SetParamValue("modem", "enable.gpstime", "no");
+  }
+
+/**
+ * 10 Hz stream of GNS + RMC pairs, 50 km/h with jitter
+ */
+static void gen_stream(int count, std::vector<std::string> &stream)
+  {
+  uint32_t rnd = 0x51ea4a1;
+  for (int i = 0; i < count; i++)
+    {
+    char time[16];
+    snprintf(time, sizeof(time), "%02d%02d%02d.%d", 8 + i / 36000 % 10, i / 600 % 60, i / 10 % 60, i % 10);
+    stream.push_back(gns(51.3 + i * 0.0000125 + (drand(rnd) - 0.5) * 0.000003, 7.39, "AA", 12));
+    stream.push_back(rmc(time, 27.0 + (drand(rnd) - 0.5) * 0.2, 12.0 + (drand(rnd) - 0.5) * 0.5));
+    }
+  }
+
+static void test_heap()
+  {
+  GsmNMEA gps(NULL, 1, 2);
+  gps.Startup();
+  std::vector<std::string> stream;
+  gen_stream(500, stream);
+  for (size_t i = 0; i < 20; i++)
+    gps.IncomingLine(stream[i].data(), stream[i].size());
+  size_t allocs = s_allocs;
+  for (size_t i = 20; i < stream.size(); i++)
+    {
+    s_now += 50000;
+    gps.IncomingLine(stream[i].data(), stream[i].size());
+    }
+  CHECKF(s_allocs == allocs, "%zu heap allocations for %zu sentences", s_allocs - allocs, stream.size() - 20);
+  gps.Shutdown();
+  }
+
+static void bench()
+  {
+  GsmNMEA gps(NULL, 1, 2);
+  gps.Startup();
+  std::vector<std::string> stream;
+  gen_stream(5000, stream);
+  host_timer_set(NULL);
+
+  printf("per sentence, 10 Hz GNS + RMC stream at 50 km/h:\n"
+    "                 time [ns]  allocations  metric changes\n");
+  for (int former = 0; former <= 1; former++)
+    {
+    uint32_t mods = 0;
+    for (OvmsMetric* m = MyMetrics.m_first; m; m = m->m_next)
+      mods -= m->m_modified;
+    size_t allocs = s_allocs;
+    double t0 = host_test_us();
+    const int rounds = 20;
+    for (int r = 0; r < rounds; r++)
+      {
+      for (const std::string& s : stream)
+        {
+        if (former)
+          former_incoming_line(s);
+        else
+          gps.IncomingLine(s.data(), s.size());
+        }
+      }
+    double t1 = host_test_us();
+    for (OvmsMetric* m = MyMetrics.m_first; m; m = m->m_next)
+      mods += m->m_modified;
+    double n = (double)rounds * stream.size();
+    printf("  %-12s  %10.0f  %11.1f  %14.2f\n", former ? "former" : "in place",
+      (t1 - t0) * 1000 / n, (s_allocs - allocs) / n, mods / n);
+    }
+  gps.Shutdown();
+  }
+
+int main(int argc, char* argv[])
+  {
+  host_timer_set(test_clock);
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_decode();
+    test_publish();
+    test_fuzz(300000);
+    test_heap();
+    }
+  return host_test_result((argc > 1) ? "bench_gsmnmea" : "test_gsmnmea");
+  }
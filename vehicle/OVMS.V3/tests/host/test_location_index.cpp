@@ -0,0 +1,306 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: location spatial index
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_location_index         index vs. full scan, leave/enter order, rebuild vs. update tasks
+//   test_location_index bench   update & rebuild time for 100…10000 locations
+
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "host_test.h"
+#include "ovms_location_index.h"
+
+/**
+ * TestArea: records the enter/leave transitions like OvmsLocation raises its events
+ */
+class TestArea : public OvmsLocationArea
+  {
+  public:
+    bool SetInLocation(bool inlocation)
+      {
+      if (inlocation != m_inlocation)
+        {
+        if (inlocation) m_enters++; else m_leaves++;
+        if (s_log) s_log->push_back(inlocation ? 1 : -1);
+        }
+      m_inlocation = inlocation;
+      return m_inlocation;
+      }
+
+  public:
+    int m_enters = 0;
+    int m_leaves = 0;
+    static std::vector<int>* s_log;
+  };
+
+std::vector<int>* TestArea::s_log = NULL;
+
+static double drand(uint32_t &rnd)
+  {
+  return (host_test_rand(rnd) & 0xffffff) / (double)0x1000000;
+  }
+
+/**
+ * Location sets: mostly 50…500 m radius within a 1° square around the center,
+ *  some of 20…100 km (wide), a few crossing the date line.
+ */
+static void gen_areas(uint32_t &rnd, int count, double lat, double lon, std::vector<TestArea*> &areas)
+  {
+  for (int i = 0; i < count; i++)
+    {
+    TestArea* a = new TestArea();
+    int kind = host_test_rand(rnd) % 100;
+    if (kind < 2)
+      {
+      a->m_latitude = lat + drand(rnd) - 0.5;
+      a->m_longitude = (kind == 0) ? 179.999 : -179.999;
+      a->m_radius = 200;
+      }
+    else if (kind < 5)
+      {
+      a->m_latitude = lat + 2 * drand(rnd) - 1;
+      a->m_longitude = lon + 2 * drand(rnd) - 1;
+      a->m_radius = 20000 + 80000 * drand(rnd);
+      }
+    else
+      {
+      a->m_latitude = lat + drand(rnd) - 0.5;
+      a->m_longitude = lon + drand(rnd) - 0.5;
+      a->m_radius = 50 + 450 * drand(rnd);
+      }
+    areas.push_back(a);
+    }
+  }
+
+static void build(OvmsLocationIndex &index, std::vector<TestArea*> &areas, int hysteresis)
+  {
+  index.Clear(hysteresis);
+  for (TestArea* a : areas)
+    index.Add(a);
+  }
+
+/**
+ * Index update vs. full scan of a copy of the location set along a random drive
+ */
+static void test_scan(double lat, double lon)
+  {
+  uint32_t rnd = 0x5eed1234;
+  std::vector<TestArea*> areas, ref;
+  gen_areas(rnd, 3000, lat, lon, areas);
+  for (TestArea* a : areas)
+    ref.push_back(new TestArea(*a));
+  OvmsLocationIndex index;
+  build(index, areas, 20);
+  CHECK(!index.m_grid.empty() && !index.m_wide.empty());
+
+  std::vector<int> log;
+  double plat = lat, plon = lon;
+  int entered = 0, mismatches = 0, maxactive = 0;
+  for (int step = 0; step < 20000; step++)
+    {
+    // drive in 0…60 m steps, jitter ±10 m, occasional jump:
+    if (step % 5000 == 4999)
+      {
+      plat = lat + drand(rnd) - 0.5;
+      plon = (step == 9999) ? 179.9995 : lon + drand(rnd) - 0.5;
+      }
+    plat += (drand(rnd) - 0.5) * 0.0008;
+    plon += (drand(rnd) - 0.5) * 0.0008;
+
+    log.clear();
+    TestArea::s_log = &log;
+    index.Update(plat, plon);
+    TestArea::s_log = NULL;
+    for (TestArea* r : ref)
+      r->IsInLocation(plat, plon, 20);
+
+    for (size_t i = 0; i < areas.size(); i++)
+      {
+      if (areas[i]->m_inlocation != ref[i]->m_inlocation)
+        mismatches++;
+      }
+    CHECKF(index.m_active.size() <= areas.size(), "active %zu", index.m_active.size());
+    maxactive = std::max(maxactive, (int)index.m_active.size());
+    // all leave events precede the enter events:
+    for (size_t i = 1; i < log.size(); i++)
+      CHECKF(!(log[i-1] == 1 && log[i] == -1), "step %d: enter before leave", step);
+    for (int e : log)
+      if (e == 1) entered++;
+    }
+  CHECKF(mismatches == 0, "%d state mismatches vs. full scan", mismatches);
+  CHECKF(entered > 100, "only %d enter events", entered);
+  CHECK(maxactive > 1);
+
+  // same transitions as the full scan:
+  for (size_t i = 0; i < areas.size(); i++)
+    {
+    CHECKF(areas[i]->m_enters == ref[i]->m_enters && areas[i]->m_leaves == ref[i]->m_leaves,
+      "area %zu: %d/%d transitions, full scan %d/%d", i,
+      areas[i]->m_enters, areas[i]->m_leaves, ref[i]->m_enters, ref[i]->m_leaves);
+    }
+
+  for (TestArea* a : areas) delete a;
+  for (TestArea* r : ref) delete r;
+  }
+
+/**
+ * Hysteresis: enter at the radius, leave beyond radius + hysteresis only
+ */
+static void test_hysteresis()
+  {
+  TestArea a;
+  a.m_latitude = 48.0f;
+  a.m_longitude = 11.0f;
+  a.m_radius = 100;
+  std::vector<TestArea*> areas = { &a };
+  OvmsLocationIndex index;
+  build(index, areas, 30);
+  double m = 1 / 111194.9;  // degrees per meter (latitude)
+  index.Update(48.0 + 105 * m, 11.0);
+  CHECK(!a.m_inlocation);
+  index.Update(48.0 + 95 * m, 11.0);
+  CHECK(a.m_inlocation && a.m_enters == 1);
+  index.Update(48.0 + 125 * m, 11.0);
+  CHECK(a.m_inlocation);
+  index.Update(48.0 + 135 * m, 11.0);
+  CHECK(!a.m_inlocation && a.m_leaves == 1);
+  // far jump out of the cell while active:
+  index.Update(48.0 + 95 * m, 11.0);
+  index.Update(10.0, 11.0);
+  CHECK(!a.m_inlocation && a.m_leaves == 2);
+  CHECK(index.m_active.empty());
+  }
+
+/**
+ * Rebuild vs. update tasks: the config task replaces locations (deletes the
+ *  old objects) under the index lock, like ReloadMap(), while the GPS task
+ *  updates. Run with -fsanitize=address or thread to detect races.
+ */
+static void test_concurrency()
+  {
+  OvmsLocationIndex index;
+  std::vector<TestArea*> areas;
+  uint32_t rnd = 0x77aa55cc;
+  gen_areas(rnd, 2000, 48.0, 11.0, areas);
+  build(index, areas, 20);
+
+  std::atomic<bool> stop(false);
+  std::atomic<int> updates(0);
+  std::thread gps([&]()
+    {
+    uint32_t rnd = 0x1234abcd;
+    while (!stop)
+      {
+      index.Update(48.0 + drand(rnd) - 0.5, 11.0 + drand(rnd) - 0.5);
+      updates++;
+      }
+    });
+
+  int rebuilds = 0;
+  for (; rebuilds < 200; rebuilds++)
+    {
+    OvmsRecMutexLock lock(&index.m_lock);
+    for (int i = 0; i < 100; i++)
+      {
+      size_t k = host_test_rand(rnd) % areas.size();
+      delete areas[k];
+      areas[k] = new TestArea();
+      areas[k]->m_latitude = 48.0 + drand(rnd) - 0.5;
+      areas[k]->m_longitude = 11.0 + drand(rnd) - 0.5;
+      areas[k]->m_radius = 50 + 450 * drand(rnd);
+      }
+    build(index, areas, rebuilds % 50);
+    }
+  stop = true;
+  gps.join();
+  CHECK(updates > 0);
+
+  // active list consistent with the location states:
+  index.Update(48.0, 11.0);
+  int active = 0;
+  for (TestArea* a : areas)
+    if (a->m_inlocation) active++;
+  CHECKF(active == (int)index.m_active.size(), "%d active, %zu listed", active, index.m_active.size());
+  printf("concurrency: %d rebuilds, %d updates\n", rebuilds, updates.load());
+  for (TestArea* a : areas) delete a;
+  }
+
+static void bench()
+  {
+  static const int counts[] = { 100, 1000, 10000 };
+  printf("time per position update [us], locations within 1° x 1°, 3%% wide:\n"
+    "  locations    index  full scan  checked  rebuild [ms]\n");
+  for (int count : counts)
+    {
+    uint32_t rnd = 0xbe4c0001;
+    std::vector<TestArea*> areas;
+    gen_areas(rnd, count, 48.0, 11.0, areas);
+    OvmsLocationIndex index;
+    double t0 = host_test_us();
+    build(index, areas, 20);
+    double t1 = host_test_us();
+
+    const int rounds = 20000;
+    uint32_t prnd = 0x600d;
+    double plat = 48.0, plon = 11.0;
+    long checked = 0;
+    double t2 = host_test_us();
+    for (int r = 0; r < rounds; r++)
+      {
+      plat += (drand(prnd) - 0.5) * 0.0008;
+      plon += (drand(prnd) - 0.5) * 0.0008;
+      index.Update(plat, plon);
+      checked += index.m_checked;
+      }
+    double t3 = host_test_us();
+    plat = 48.0, plon = 11.0;
+    prnd = 0x600d;
+    for (int r = 0; r < rounds; r++)
+      {
+      plat += (drand(prnd) - 0.5) * 0.0008;
+      plon += (drand(prnd) - 0.5) * 0.0008;
+      for (TestArea* a : areas)
+        a->IsInLocation(plat, plon, 20);
+      }
+    double t4 = host_test_us();
+    printf("  %9d  %7.2f  %9.2f  %7.1f  %12.2f\n", count, (t3 - t2) / rounds, (t4 - t3) / rounds,
+      (double)checked / rounds, (t1 - t0) / 1000);
+    for (TestArea* a : areas) delete a;
+    }
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_hysteresis();
+    test_scan(48.0, 11.0);
+    test_scan(-33.9, 151.2);
+    test_concurrency();
+    }
+  return host_test_result((argc > 1) ? "bench_location_index" : "test_location_index");
+  }
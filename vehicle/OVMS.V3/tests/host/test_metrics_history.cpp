@@ -0,0 +1,443 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: metrics history encoding, storage & queries
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_metrics_history         codec round trips, queries vs. reference
+//   test_metrics_history bench   compression ratios & query times
+
+#include <math.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include "host_test.h"
+#include "ovms_metrics_history.h"
+#include "ovms_config.h"
+
+// Access to the recording internals normally driven by the ticker:
+class TestHistory : public OvmsMetricsHistory
+  {
+  public:
+    using OvmsMetricsHistory::LoadConfig;
+    using OvmsMetricsHistory::UpdateSelection;
+    using OvmsMetricsHistory::FindSeries;
+    using OvmsMetricsHistory::Record;
+    using OvmsMetricsHistory::LimitMemory;
+    using OvmsMetricsHistory::FilePath;
+    using OvmsMetricsHistory::m_mutex;
+  };
+
+static std::string s_dir;
+
+static uint32_t bits(float v)
+  {
+  uint32_t b;
+  memcpy(&b, &v, sizeof(b));
+  return b;
+  }
+
+static float frand(uint32_t &rnd)
+  {
+  return (host_test_rand(rnd) & 0xffffff) / (float)0x1000000;
+  }
+
+static void configure(const char* metrics, int size_kb, int filesize_kb)
+  {
+  static int n = 0;
+  char path[200];
+  snprintf(path, sizeof(path), "%s/%d", s_dir.c_str(), ++n);
+  MyConfig.SetParamValue("vehicle", "metrics.history", metrics);
+  MyConfig.SetParamValue("vehicle", "metrics.history.path", path);
+  MyConfig.SetParamValue("vehicle", "metrics.history.size", std::to_string(size_kb));
+  MyConfig.SetParamValue("vehicle", "metrics.history.filesize", std::to_string(filesize_kb));
+  }
+
+
+/**
+ * Encode / decode round trips, bit exact
+ */
+static void test_codec()
+  {
+  uint32_t rnd = 1;
+  for (int round = 0; round < 3000; round++)
+    {
+    int mode = round % 4;
+    std::vector<std::pair<uint32_t,uint32_t>> in;
+    uint32_t time = 1600000000 + host_test_rand(rnd) % 1000;
+    float value = frand(rnd) * 100;
+    MetricsHistoryBlock block(0, time, value);
+    in.push_back({ time, bits(value) });
+    while (1)
+      {
+      switch (mode)
+        {
+        case 0:   // regular interval, slowly changing value
+          time += 60;
+          if (host_test_rand(rnd) % 4 == 0)
+            value += 0.1f;
+          break;
+        case 1:   // jittered interval, random bit patterns (incl. NaN, Inf, denormals)
+          time += 10 + host_test_rand(rnd) % 3;
+          value = 0;
+          { uint32_t b = host_test_rand(rnd); memcpy(&value, &b, sizeof(value)); }
+          break;
+        case 2:   // large & irregular timestamp jumps, duplicate times
+          {
+          uint32_t r = host_test_rand(rnd);
+          time += (r % 5 == 0) ? 0 : (r % 5 == 1) ? (host_test_rand(rnd) % 0x1000000) : (r % 3000);
+          value = frand(rnd) * 1000 - 500;
+          break;
+          }
+        default:  // mixed
+          time += (host_test_rand(rnd) % 2) ? 1 : 300;
+          value = (host_test_rand(rnd) % 2) ? value : roundf(frand(rnd) * 100) / 10;
+          break;
+        }
+      if (!block.Append(time, value))
+        break;
+      in.push_back({ time, bits(value) });
+      }
+    if (round % 2)
+      block.Seal();
+    CHECK(block.m_hdr.count == in.size());
+
+    MetricsHistoryReader reader(block.m_hdr, block.m_data.data());
+    uint32_t t;
+    float v;
+    size_t n = 0;
+    while (reader.Next(t, v) && n < in.size())
+      {
+      CHECKF(t == in[n].first && bits(v) == in[n].second,
+        "round %d sample %zu: %u/%08x, expected %u/%08x", round, n, t, bits(v), in[n].first, in[n].second);
+      n++;
+      }
+    CHECKF(n == in.size(), "round %d: decoded %zu of %zu", round, n, in.size());
+    }
+
+  // a truncated bit stream must end the decoding, not run off the buffer:
+  MetricsHistoryBlock block(0, 1000, 1.0f);
+  for (uint32_t t = 1001; block.Append(t, t * 0.37f); t += 7);
+  block.Seal();
+  metrics_history_header_t hdr = block.m_hdr;
+  hdr.size /= 2;
+  MetricsHistoryReader reader(hdr, block.m_data.data());
+  uint32_t t;
+  float v;
+  int n = 0;
+  while (reader.Next(t, v))
+    n++;
+  CHECK(n > 1 && n < block.m_hdr.count);
+  }
+
+
+/**
+ * Queries over file & memory blocks vs. reference
+ */
+static float signal(uint32_t t)
+  {
+  return roundf(500 + 300 * sinf(t / 5000.0f)) / 10;
+  }
+
+static void reference(uint32_t from, uint32_t to, uint32_t step, uint32_t t0, uint32_t interval, uint32_t tn,
+  MetricsHistorySamples &out)
+  {
+  uint32_t bucket = 0;
+  double sum = 0;
+  int count = 0;
+  for (uint32_t t = t0; t <= tn; t += interval)
+    {
+    if (t < from || t > to)
+      continue;
+    uint32_t b = step ? t - t % step : t;
+    if (count && (!step || b != bucket))
+      {
+      out.push_back({ bucket, (float)(sum / count) });
+      sum = 0;
+      count = 0;
+      }
+    bucket = b;
+    sum += signal(t);
+    count++;
+    }
+  if (count)
+    out.push_back({ bucket, (float)(sum / count) });
+  }
+
+static bool same(const MetricsHistorySamples &a, const MetricsHistorySamples &b)
+  {
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); i++)
+    {
+    if (a[i].time != b[i].time || bits(a[i].value) != bits(b[i].value))
+      return false;
+    }
+  return true;
+  }
+
+static void test_query()
+  {
+  configure("test.q*", 4, 1024);
+  TestHistory h;
+  OvmsMetricFloat metric("test.q1");
+  h.LoadConfig();
+  h.UpdateSelection();
+  MetricsHistorySeries* s = h.FindSeries("test.q1");
+  CHECK(s != NULL);
+  if (!s) return;
+
+  const uint32_t t0 = 1700000000, interval = 10, count = 20000;
+  uint32_t tn = t0;
+  for (uint32_t i = 0; i < count; i++)
+    {
+    tn = t0 + i * interval;
+    h.Record(s, tn, signal(tn));
+    if (i % 997 == 0)
+      {
+      CHECK(h.Flush());
+      h.LimitMemory();
+      }
+    }
+  CHECK(h.m_cnt_dropped == 0);
+  CHECK(h.m_cnt_errors == 0);
+  CHECK(!s->m_blocks.empty() && s->m_blocks.front()->m_hdr.start > t0);   // file & memory in use
+
+  MetricsHistorySamples result, ref;
+  CHECK(h.Query("test.q1", 0, UINT32_MAX, 0, result, 100000) == (int)count);
+  reference(0, UINT32_MAX, 0, t0, interval, tn, ref);
+  CHECK(same(result, ref));
+
+  uint32_t rnd = 7;
+  for (int i = 0; i < 300; i++)
+    {
+    uint32_t from = t0 - 100 + host_test_rand(rnd) % (tn - t0 + 200);
+    uint32_t to = from + host_test_rand(rnd) % 50000;
+    uint32_t step = (i % 3 == 0) ? 0 : (i % 3 == 1) ? 60 : 3600;
+    result.clear();
+    ref.clear();
+    h.Query("test.q1", from, to, step, result, 100000);
+    reference(from, to, step, t0, interval, tn, ref);
+    CHECKF(same(result, ref), "query %u..%u step %u: %zu samples, expected %zu", from, to, step,
+      result.size(), ref.size());
+    }
+
+  // limit:
+  result.clear();
+  CHECK(h.Query("test.q1", 0, UINT32_MAX, 0, result, 100) == 100);
+  CHECK(result.size() == 100 && result[0].time == t0);
+
+  // unknown series:
+  result.clear();
+  CHECK(h.Query("test.none", 0, UINT32_MAX, 0, result) == -1);
+
+  // stored series without memory blocks (i.e. after a reboot):
+  h.Flush();
+  TestHistory h2;
+  h2.LoadConfig();
+  result.clear();
+  ref.clear();
+  CHECK(h2.Query("test.q1", 0, UINT32_MAX, 0, result, 100000) == (int)count);
+  reference(0, UINT32_MAX, 0, t0, interval, tn, ref);
+  CHECK(same(result, ref));
+  }
+
+
+/**
+ * Queries concurrent to recording, flushing & file trimming
+ */
+static void test_concurrency()
+  {
+  configure("test.c*", 2, 8);
+  TestHistory h;
+  OvmsMetricFloat metric("test.c1");
+  h.LoadConfig();
+  h.UpdateSelection();
+  MetricsHistorySeries* s = h.FindSeries("test.c1");
+  CHECK(s != NULL);
+  if (!s) return;
+
+  const uint32_t t0 = 1700000000;
+  std::atomic<bool> done(false);
+  std::atomic<int> queries(0);
+  std::thread reader([&]()
+    {
+    while (!done)
+      {
+      MetricsHistorySamples result;
+      h.Query("test.c1", 0, UINT32_MAX, 0, result, 100000);
+      bool ok = true;
+      for (size_t i = 0; i < result.size(); i++)
+        {
+        ok = ok && bits(result[i].value) == bits(signal(result[i].time));
+        ok = ok && (i == 0 || result[i].time == result[i-1].time + 10);
+        }
+      CHECKF(ok, "inconsistent query result, %zu samples", result.size());
+      queries++;
+      }
+    });
+  for (uint32_t i = 0; i < 30000 || queries < 100; i++)
+    {
+    uint32_t t = t0 + i * 10;
+      {
+      OvmsMutexLock lock(&h.m_mutex);
+      h.Record(s, t, signal(t));
+      h.LimitMemory();
+      }
+    if (i % 500 == 0)
+      CHECK(h.Flush());
+    }
+  done = true;
+  reader.join();
+  CHECK(h.m_cnt_errors == 0);
+  }
+
+
+/**
+ * Benchmark: compression ratios of synthetic signals, query times
+ */
+static void bench_signal(const char* name, uint32_t interval, std::function<float(uint32_t, uint32_t&)> fn)
+  {
+  const int count = 20000;
+  uint32_t rnd = 1;
+  uint32_t time = 1700000000;
+  size_t bytes = 0;
+  MetricsHistoryBlock* block = new MetricsHistoryBlock(0, time, fn(0, rnd));
+  for (int i = 1; i < count; i++)
+    {
+    time += interval;
+    float value = fn(i * interval, rnd);
+    if (!block->Append(time, value))
+      {
+      block->Seal();
+      bytes += sizeof(block->m_hdr) + block->m_hdr.size;
+      delete block;
+      block = new MetricsHistoryBlock(0, time, value);
+      }
+    }
+  block->Seal();
+  bytes += sizeof(block->m_hdr) + block->m_hdr.size;
+  delete block;
+  printf("  %-30s %5.1fx %5.1f bits/sample\n", name, count * 8.0 / bytes, bytes * 8.0 / count);
+  }
+
+static void bench_query()
+  {
+  configure("bench.*", 16, 0);
+  TestHistory h;
+  OvmsMetricFloat metric("bench.v");
+  h.LoadConfig();
+  h.UpdateSelection();
+  MetricsHistorySeries* s = h.FindSeries("bench.v");
+  uint32_t rnd = 1, t = 1700000000, t0 = t;
+  struct stat st;
+  st.st_size = 0;
+  for (int i = 0; st.st_size < 64 * 1024; i++, t += 10)
+    {
+    h.Record(s, t, roundf((380 + 10 * sinf(t / 20000.0f) + frand(rnd) * 0.04f) * 100) / 100);
+    if (i % 1000 == 999)
+      {
+      h.Flush();
+      h.LimitMemory();
+      stat(h.FilePath("bench.v").c_str(), &st);
+      }
+    }
+  h.LimitMemory();
+  t -= 10;
+  printf("Query times (%ld byte file, %zu bytes / %" PRIu32 " samples in memory, host file cache):\n",
+    (long)st.st_size, s->m_size, s->m_samples);
+
+  struct { const char* name; uint32_t from, to, step; } q[] = {
+    { "3600 samples from memory", t - 36000 + 10, t, 0 },
+    { "3600 samples from file", t0, t0 + 36000 - 10, 0 },
+    { "full range", 0, UINT32_MAX, 0 },
+    { "full range, 5 minute averages", 0, UINT32_MAX, 300 },
+    };
+  for (auto &qq : q)
+    {
+    MetricsHistorySamples result;
+    double start = host_test_us();
+    const int repeat = 50;
+    for (int i = 0; i < repeat; i++)
+      {
+      result.clear();
+      h.Query("bench.v", qq.from, qq.to, qq.step, result, 100000);
+      }
+    printf("  %-30s %6zu samples %7.2f ms\n", qq.name, result.size(), (host_test_us() - start) / repeat / 1000);
+    }
+  }
+
+static void bench()
+  {
+  printf("Compression (raw = 8 bytes per sample):\n");
+  bench_signal("SOC 60s, 0.1% steps", 60, [](uint32_t t, uint32_t &rnd)
+    {
+    // discharge 90 -> 20 % at 0.05 %/min, charge at 0.5 %/min:
+    float phase = fmodf(t / 60.0f, 1400 + 140);
+    float soc = (phase < 1400) ? 90 - phase * 0.05f : 20 + (phase - 1400) * 0.5f;
+    return roundf(soc * 10) / 10;
+    });
+  bench_signal("SOC 60s, parked", 60, [](uint32_t t, uint32_t &rnd)
+    {
+    return roundf((75.0f - t / 86400.0f * 0.5f) * 10) / 10;
+    });
+  bench_signal("temperature 60s, integer", 60, [](uint32_t t, uint32_t &rnd)
+    {
+    return roundf(20 + 8 * sinf(t * 2 * M_PI / 86400) + frand(rnd) - 0.5f);
+    });
+  bench_signal("voltage 10s, 0.01 V noise", 10, [](uint32_t t, uint32_t &rnd)
+    {
+    return roundf((380 + 10 * sinf(t / 20000.0f) + frand(rnd) * 0.04f) * 100) / 100;
+    });
+  bench_signal("speed 1s, 0.1 km/h noise", 1, [](uint32_t t, uint32_t &rnd)
+    {
+    return roundf(fmaxf(0, 50 + 30 * sinf(t / 60.0f) + frand(rnd) * 0.6f - 0.3f) * 10) / 10;
+    });
+  bench_signal("power 1s, float noise", 1, [](uint32_t t, uint32_t &rnd)
+    {
+    return 15 + 10 * sinf(t / 30.0f) + frand(rnd) - 0.5f;
+    });
+  bench_query();
+  }
+
+int main(int argc, char* argv[])
+  {
+  char dir[] = "/tmp/ovms-history-XXXXXX";
+  if (!mkdtemp(dir))
+    return 2;
+  s_dir = dir;
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_codec();
+    test_query();
+    test_concurrency();
+    }
+  std::string cmd = "rm -rf " + s_dir;
+  if (system(cmd.c_str()) != 0)
+    fprintf(stderr, "cannot remove %s\n", dir);
+  return host_test_result((argc > 1) ? "bench_metrics_history" : "test_metrics_history");
+  }
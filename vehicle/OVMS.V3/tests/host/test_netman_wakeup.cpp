@@ -0,0 +1,314 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: network task wake-up channel
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_netman_wakeup         job latency, coalescing, Detach() vs. concurrent senders
+//   test_netman_wakeup bench   job latency with & without wake-up, select() timeout 250 ms
+//
+// The network task is modelled by a select() loop on the wake-up socket, like
+// mg_mgr_poll() does. sendto/socket/close are wrapped (see the Makefile) to detect
+// datagrams sent on a descriptor after it has been closed.
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "host_test.h"
+#include "ovms_wakeup.h"
+
+////////////////////////////////////////////////////////////////////////
+// Descriptor use after close detection
+////////////////////////////////////////////////////////////////////////
+
+#define MAXFD 1024
+static std::atomic<bool> s_closed[MAXFD];
+static std::atomic<uint32_t> s_closes[MAXFD];
+static std::atomic<uint32_t> s_sent_closed;
+static std::atomic<int> s_sendto_delay;     // [µs] preemption before the send
+
+extern "C"
+  {
+  int __real_socket(int domain, int type, int protocol);
+  int __real_close(int fd);
+  ssize_t __real_sendto(int fd, const void* buf, size_t len, int flags, const struct sockaddr* addr, socklen_t alen);
+
+  int __wrap_socket(int domain, int type, int protocol)
+    {
+    int fd = __real_socket(domain, type, protocol);
+    if (fd >= 0 && fd < MAXFD)
+      s_closed[fd] = false;
+    return fd;
+    }
+
+  int __wrap_close(int fd)
+    {
+    if (fd >= 0 && fd < MAXFD)
+      {
+      s_closed[fd] = true;
+      s_closes[fd]++;
+      }
+    return __real_close(fd);
+    }
+
+  ssize_t __wrap_sendto(int fd, const void* buf, size_t len, int flags, const struct sockaddr* addr, socklen_t alen)
+    {
+    if (fd < 0 || fd >= MAXFD)
+      return __real_sendto(fd, buf, len, flags, addr, alen);
+    uint32_t closes = s_closes[fd];
+    bool closed = s_closed[fd];
+    if (s_sendto_delay)
+      usleep(s_sendto_delay);
+    // closed before or while we were preempted:
+    if (closed || s_closes[fd] != closes)
+      s_sent_closed++;
+    return __real_sendto(fd, buf, len, flags, addr, alen);
+    }
+  };
+
+
+////////////////////////////////////////////////////////////////////////
+// Network task model
+////////////////////////////////////////////////////////////////////////
+
+struct netloop_t
+  {
+  OvmsWakeupChannel       wakeup;
+  int                     sock;
+  bool                    use_wakeup;
+  std::atomic<bool>       running;
+  std::mutex              mutex;
+  std::deque<double>      jobs;           // queue times [µs]
+  std::vector<double>     latencies;      // [µs]
+  uint32_t                polls;
+  };
+
+static void netloop_run(netloop_t* n)
+  {
+  while (n->running)
+    {
+    fd_set rd;
+    FD_ZERO(&rd);
+    FD_SET(n->sock, &rd);
+    struct timeval tv = { 0, 250000 };
+    int res = select(n->sock + 1, &rd, NULL, NULL, &tv);
+    n->polls++;
+    if (res > 0 && FD_ISSET(n->sock, &rd))
+      {
+      // mongoose: one MG_EV_RECV per datagram
+      uint8_t buf[16];
+      while (recv(n->sock, buf, sizeof(buf), 0) > 0)
+        n->wakeup.Received();
+      }
+    // ProcessJobs():
+    std::lock_guard<std::mutex> lock(n->mutex);
+    double now = host_test_us();
+    while (!n->jobs.empty())
+      {
+      n->latencies.push_back(now - n->jobs.front());
+      n->jobs.pop_front();
+      }
+    }
+  }
+
+static void queue_job(netloop_t* n)
+  {
+    {
+    std::lock_guard<std::mutex> lock(n->mutex);
+    n->jobs.push_back(host_test_us());
+    }
+  if (n->use_wakeup)
+    n->wakeup.Send();
+  }
+
+static double percentile(std::vector<double> v, double p)
+  {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+  }
+
+/**
+ * run_latency: senders queue jobs at random intervals of 0…max_gap_ms
+ */
+static void run_latency(bool use_wakeup, int senders, int jobs, int max_gap_ms, std::vector<double> &lat,
+  uint32_t &sent, uint32_t &received, uint32_t &polls)
+  {
+  netloop_t* n = new netloop_t();
+  n->sock = n->wakeup.Open();
+  CHECK(n->sock >= 0);
+  CHECK(n->wakeup.IsOpen() && n->wakeup.GetPort() != 0);
+  n->use_wakeup = use_wakeup;
+  n->running = true;
+  n->polls = 0;
+  std::thread loop(netloop_run, n);
+
+  std::vector<std::thread> threads;
+  for (int s = 0; s < senders; s++)
+    {
+    threads.emplace_back([n, s, jobs, max_gap_ms]()
+      {
+      uint32_t rnd = 0x9e3779b9 * (s + 1);
+      for (int j = 0; j < jobs; j++)
+        {
+        usleep((host_test_rand(rnd) % (max_gap_ms * 1000 + 1)));
+        queue_job(n);
+        }
+      });
+    }
+  for (auto &t : threads)
+    t.join();
+
+  // wait for the last jobs:
+  for (int i = 0; i < 100; i++)
+    {
+      {
+      std::lock_guard<std::mutex> lock(n->mutex);
+      if (n->jobs.empty()) break;
+      }
+    usleep(10000);
+    }
+  n->running = false;
+  n->wakeup.Send();
+  loop.join();
+  n->wakeup.Detach();
+  close(n->sock);
+  CHECK(!n->wakeup.IsOpen());
+
+  lat = n->latencies;
+  sent = n->wakeup.GetSent();
+  received = n->wakeup.GetReceived();
+  polls = n->polls;
+  delete n;
+  }
+
+static void test_latency()
+  {
+  std::vector<double> lat;
+  uint32_t sent, received, polls;
+  run_latency(true, 4, 100, 5, lat, sent, received, polls);
+  CHECKF(lat.size() == 400, "%zu jobs processed", lat.size());
+  double median = percentile(lat, 0.5), p99 = percentile(lat, 0.99);
+  CHECKF(median < 5000, "median latency %.0f us", median);
+  CHECKF(p99 < 50000, "p99 latency %.0f us", p99);
+  // coalesced: at most one datagram per job, none lost:
+  CHECKF(sent <= 401, "sent %u", sent);
+  CHECKF(received <= sent && received + 1 >= sent, "sent %u, received %u", sent, received);
+  }
+
+/**
+ * Detach() vs. senders: the owner repeatedly opens, detaches & closes the
+ *  channel and immediately reuses the descriptor number, while senders keep
+ *  calling Send(). No datagram may be sent on a closed descriptor.
+ */
+static void test_detach(int rounds)
+  {
+  OvmsWakeupChannel* ch = new OvmsWakeupChannel();
+  std::atomic<bool> stop(false);
+  std::atomic<uint32_t> calls(0);
+  s_sent_closed = 0;
+  s_sendto_delay = 20;
+
+  CHECK(!ch->Send());     // not open yet
+  std::vector<std::thread> threads;
+  for (int s = 0; s < 2; s++)
+    {
+    threads.emplace_back([ch, &stop, &calls]()
+      {
+      while (!stop)
+        {
+        ch->Send();
+        calls++;
+        sched_yield();
+        }
+      });
+    }
+
+  uint32_t reused = 0;
+  for (int r = 0; r < rounds; r++)
+    {
+    int sock = ch->Open();
+    CHECK(sock >= 0);
+    // let senders catch the socket, then drain so they keep sending:
+    for (int i = 0; i < 3; i++)
+      {
+      usleep(20);
+      uint8_t buf[16];
+      while (recv(sock, buf, sizeof(buf), 0) > 0)
+        ch->Received();
+      }
+    // a sender is likely to be within sendto() now:
+    ch->Received();
+    usleep(5);
+    ch->Detach();
+    close(sock);
+    // the next socket (victim) reuses the descriptor number:
+    int victim = socket(AF_INET, SOCK_DGRAM, 0);
+    if (victim == sock) reused++;
+    usleep(5);
+    close(victim);
+    }
+
+  stop = true;
+  for (auto &t : threads)
+    t.join();
+  s_sendto_delay = 0;
+  CHECKF(s_sent_closed == 0, "%u datagrams sent on closed descriptors", s_sent_closed.load());
+  CHECK(reused > 0);
+  CHECK(ch->GetSent() > 0);
+  printf("detach: %d rounds, %u send calls, %u datagrams, %u descriptor reuses\n",
+    rounds, calls.load(), ch->GetSent(), reused);
+  delete ch;
+  }
+
+static void bench()
+  {
+  printf("job latency, 4 senders x 200 jobs at 0…50 ms intervals, select() timeout 250 ms:\n");
+  printf("                  median       p90       p99       max   polls  datagrams\n");
+  for (int w = 1; w >= 0; w--)
+    {
+    std::vector<double> lat;
+    uint32_t sent, received, polls;
+    run_latency(w, 4, 200, 50, lat, sent, received, polls);
+    printf("  %-12s %8.2f ms %6.2f ms %6.2f ms %6.2f ms  %6u  %9u\n", w ? "wakeup" : "poll only",
+      percentile(lat, 0.5) / 1000, percentile(lat, 0.9) / 1000, percentile(lat, 0.99) / 1000,
+      percentile(lat, 1) / 1000, polls, sent);
+    }
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_latency();
+    test_detach(300);
+    }
+  return host_test_result((argc > 1) ? "bench_netman_wakeup" : "test_netman_wakeup");
+  }
@@ -0,0 +1,458 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: poller pipelining on virtual ECUs
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_poller_sim         serial vs. pipelined cycle time, ISO-TP & VWTP transfers, frame loss, scheduling,
+//                           broadcast collect mode, multi DID requests
+//   test_poller_sim bench   cycle time, success rate & CPU per reply by pipelining depth & latency
+//
+// Runs the poller task, ticker & the virtual ECU simulator (poller sim) on
+// the host FreeRTOS stand-ins. The poll ticker runs at 25 ms with 10 secondary
+// ticks, so the benchmark list is polled every 250 ms.
+
+#include <string.h>
+#include <unistd.h>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "host_test.h"
+#include "vehicle_poller.h"
+#include "vehicle_poller_sim.h"
+
+static canbus s_can1("can1");
+
+#define TICK_MS     25
+#define TICKS       10
+#define RUN_MS      (TICK_MS * TICKS)
+
+struct simresult_t
+  {
+  uint32_t sent, replies, errors, timeouts, corrupt;
+  uint32_t cycles, overruns;
+  double cycle_avg;                 // [ms]
+  uint32_t cycle_max;               // [ms]
+  double cpu_per_reply;             // [us]
+  };
+
+static pollersim_ecu_t ecu(uint32_t txid, uint32_t rxid, uint8_t protocol, uint16_t size,
+  uint16_t latency, uint16_t jitter=0, uint8_t loss=0)
+  {
+  pollersim_ecu_t e = {};
+  e.bus = &s_can1;
+  e.txid = txid;
+  e.rxid = rxid;
+  e.protocol = protocol;
+  e.size = size;
+  e.latency = latency;
+  e.jitter = jitter;
+  e.loss = loss;
+  return e;
+  }
+
+static void add_isotp_ecus(int count, uint16_t size, uint16_t latency, uint16_t jitter=0, uint8_t loss=0)
+  {
+  for (int i = 0; i < count; i++)
+    CHECK(MyPollerSim.AddEcu(ecu(0x7e0 + i, 0x7e8 + i, ISOTP_STD, size, latency, jitter, loss)) == NULL);
+  }
+
+/**
+ * run_bench: poll <pids> DIDs of each virtual ECU with <pipeline> concurrent
+ *  requests every <interval> x 250 ms, skip the first run, measure <runs> runs (>= 2)
+ */
+static simresult_t run_bench(int pipeline, int pids, int runs, int interval=1)
+  {
+  simresult_t res = {};
+  MyPollers.PollSetPipelining(pipeline);
+  const char* error = MyPollerSim.StartBench(1, pids, interval, runs);
+  CHECKF(error == NULL, "StartBench: %s", error);
+  if (error)
+    return res;
+  std::shared_ptr<PollerSimBench> bench = MyPollerSim.GetBench();
+
+  // the statistics reset applies at the start of the next run:
+  int wait = 0, timeout = (runs + 2) * interval * RUN_MS * 4;
+  while (bench->m_cycles < 1 && wait < timeout)
+    usleep(1000), wait++;
+  MyPollerSim.ResetStats();
+  while (bench->m_cycles < (uint32_t)runs && wait < timeout)
+    usleep(1000), wait++;
+  MyPollerSim.StopBench();
+
+  res.sent = bench->m_sent;
+  res.replies = bench->m_replies;
+  res.errors = bench->m_errors;
+  res.timeouts = bench->m_timeouts;
+  res.corrupt = bench->m_corrupt;
+  res.cycles = bench->m_cycles;
+  res.overruns = bench->m_overruns;
+  res.cycle_avg = res.cycles ? (double)bench->m_cycle_sum / res.cycles : 0;
+  res.cycle_max = bench->m_cycle_max;
+  res.cpu_per_reply = res.replies ? (double)MyPollerSim.GetCpuTime() / res.replies : 0;
+  CHECKF(res.cycles >= (uint32_t)runs, "pipeline %d: %u runs finished", pipeline, res.cycles);
+  return res;
+  }
+
+/**
+ * Pipelining: four ECUs answering after 20 ms. Serial polling takes the sum
+ *  of the latencies per run, with four slots the ECUs are polled concurrently.
+ *  The list holds two consecutive entries per ECU, so the poller needs to
+ *  fetch ahead of the second entry for a busy ECU to keep all four busy.
+ */
+static void test_pipelining()
+  {
+  MyPollerSim.Clear();
+  add_isotp_ecus(4, 4, 20);
+  simresult_t serial = run_bench(1, 2, 4);
+  simresult_t piped = run_bench(4, 2, 4);
+
+  for (simresult_t* r : { &serial, &piped })
+    {
+    CHECKF(r->replies == r->sent && r->errors == 0 && r->corrupt == 0,
+      "sent %u, replies %u, errors %u, invalid %u", r->sent, r->replies, r->errors, r->corrupt);
+    CHECKF(r->overruns == 0, "%u overruns", r->overruns);
+    }
+  // serial: 8 requests x 20 ms, pipelined: 2 x 20 ms:
+  CHECKF(serial.cycle_avg >= 160, "serial cycle %.1f ms", serial.cycle_avg);
+  CHECKF(piped.cycle_avg < serial.cycle_avg / 3, "pipelined cycle %.1f ms, serial %.1f ms",
+    piped.cycle_avg, serial.cycle_avg);
+  }
+
+/**
+ * Transfers: single & multi frame responses from ISO-TP standard, extended
+ *  addressing & 29 bit ECUs and a VWTP 2.0 ECU, polled concurrently.
+ *  The flow control separation time is lowered from 25 to 1 ms, so a run
+ *  fits into the poll interval.
+ */
+static void test_transfers()
+  {
+  MyPollerSim.Clear();
+  MyPollers.PollSetResponseSeparationTime(1);
+  CHECK(MyPollerSim.AddEcu(ecu(0x7e0, 0x7e8, ISOTP_STD, 4, 5)) == NULL);
+  CHECK(MyPollerSim.AddEcu(ecu(0x7e1, 0x7e9, ISOTP_STD, 200, 5, 5)) == NULL);
+  CHECK(MyPollerSim.AddEcu(ecu(0x6f140, 0x6f1, ISOTP_EXTADR, 30, 5)) == NULL);
+  CHECK(MyPollerSim.AddEcu(ecu(0x18da10f1, 0x18daf110, ISOTP_EXTFRAME, 60, 5)) == NULL);
+  CHECK(MyPollerSim.AddEcu(ecu(0x200, 0x01, VWTP_20, 40, 5)) == NULL);
+  simresult_t r = run_bench(4, 3, 3);
+  MyPollers.PollSetResponseSeparationTime(25);
+  CHECKF(r.sent > 0 && r.replies == r.sent && r.errors == 0 && r.corrupt == 0,
+    "sent %u, replies %u, errors %u, invalid %u", r.sent, r.replies, r.errors, r.corrupt);
+  }
+
+/**
+ * Frame loss: lost responses time out, the poller proceeds with the next
+ *  requests, no response is assigned to the wrong request
+ */
+static void test_loss()
+  {
+  MyPollerSim.Clear();
+  add_isotp_ecus(3, 20, 5, 5, 10);
+  simresult_t r = run_bench(3, 4, 6);
+  CHECKF(r.corrupt == 0, "%u invalid responses", r.corrupt);
+  CHECKF(r.replies > 0 && r.replies < r.sent, "sent %u, replies %u", r.sent, r.replies);
+  CHECKF(r.timeouts > 0 && r.replies + r.errors == r.sent, "sent %u, replies %u, errors %u (timeouts %u)",
+    r.sent, r.replies, r.errors, r.timeouts);
+  }
+
+/**
+ * ListSeries: a poll list on the virtual ECUs recording the replies per PID
+ *  and responding ECU, validating the response data (see OvmsPollerSim)
+ */
+class ListSeries : public OvmsPoller::StandardPollSeries
+  {
+  public:
+    ListSeries(OvmsPoller* poller, const std::vector<OvmsPoller::poll_pid_t> &list)
+      : OvmsPoller::StandardPollSeries(poller), m_list(list)
+      {
+      OvmsPoller::poll_pid_t end = POLL_LIST_END;
+      m_list.push_back(end);
+      PollSetPidList(1, m_list.data());
+      }
+    void IncomingPacket(const OvmsPoller::poll_job_t& job, uint8_t* data, uint8_t length) override
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (int i = 0; i < length; i++)
+        {
+        if (data[i] != (uint8_t)(job.pid + job.mloffset + i))
+          {
+          m_corrupt++;
+          break;
+          }
+        }
+      if (job.mlremain != 0)
+        return;
+      m_replies.push_back(job.pid);
+      m_responders[job.moduleid_rec]++;
+      }
+    void IncomingError(const OvmsPoller::poll_job_t& job, uint16_t code) override
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_errors.push_back(std::make_pair(job.pid, code));
+      }
+    std::vector<uint16_t> Replies()
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_replies;
+      }
+    std::map<uint32_t, int> Responders()
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_responders;
+      }
+    int Errors(uint16_t pid, uint16_t code)
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      int count = 0;
+      for (auto &e : m_errors)
+        if (e.first == pid && e.second == code) count++;
+      return count;
+      }
+    size_t Errors()
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_errors.size();
+      }
+    int Corrupt()
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_corrupt;
+      }
+    int Count(uint16_t pid)
+      {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      int count = 0;
+      for (uint16_t p : m_replies)
+        if (p == pid) count++;
+      return count;
+      }
+
+  protected:
+    std::vector<OvmsPoller::poll_pid_t> m_list;
+    std::mutex m_mutex;
+    std::vector<uint16_t> m_replies;
+    std::vector<std::pair<uint16_t, uint16_t>> m_errors;  // PID & code
+    std::map<uint32_t, int> m_responders;   // complete replies per response ID
+    int m_corrupt = 0;
+  };
+
+static OvmsPoller* bus_poller()
+  {
+  if (!MyPollers.GetBus(1))
+    MyPollers.RegisterCanBus(1, CAN_MODE_LISTEN, CAN_SPEED_500KBPS, NULL, false);
+  return MyPollers.GetPoller(&s_can1, true);
+  }
+
+static OvmsPoller::poll_pid_t list_entry(uint16_t pid, uint16_t polltime,
+  uint32_t txid=0x7e0, uint32_t rxid=0x7e8, uint8_t protocol=ISOTP_STD)
+  {
+  OvmsPoller::poll_pid_t entry = {};
+  entry.txmoduleid = txid;
+  entry.rxmoduleid = rxid;
+  entry.type = VEHICLE_POLL_TYPE_READDATA;
+  entry.pid = pid;
+  for (int i = 0; i < VEHICLE_POLL_NSTATES; i++)
+    entry.polltime[i] = polltime;
+  entry.protocol = protocol;
+  return entry;
+  }
+
+/**
+ * Scheduling: sub-second entries are polled at their own interval, also
+ *  between runs, hinted priorities go first, on demand entries are only
+ *  polled while one of their metrics has a named listener.
+ */
+static void test_schedule()
+  {
+  MyPollerSim.Clear();
+  add_isotp_ecus(1, 4, 2);
+  MyPollers.PollSetPipelining(1);
+  MyPollers.PollSetPidHint(0x7e0, VEHICLE_POLL_TYPE_READDATA, 0xF003, 10);
+  MyPollers.PollSetPidHint(0x7e0, VEHICLE_POLL_TYPE_READDATA, 0xF004, 0, { "v.test.ondemand" });
+  auto series = std::make_shared<ListSeries>(bus_poller(),
+    std::vector<OvmsPoller::poll_pid_t>({ list_entry(0xF001, 1), list_entry(0xF002, POLL_MS(50)),
+    list_entry(0xF003, 1), list_entry(0xF004, 1) }));
+  MyPollers.PollRequest(&s_can1, "test", series);
+  usleep(1000 * 1000);
+
+  // tick based entries: once per run, the hinted entry first:
+  std::vector<uint16_t> replies = series->Replies();
+  std::vector<uint16_t> ticked;
+  for (uint16_t pid : replies)
+    if (pid != 0xF002) ticked.push_back(pid);
+  CHECKF(ticked.size() >= 6 && ticked[0] == 0xF003 && ticked[1] == 0xF001,
+    "%zu replies, first %X %X", ticked.size(), ticked.size() > 0 ? ticked[0] : 0, ticked.size() > 1 ? ticked[1] : 0);
+  int runs = series->Count(0xF001);
+  CHECKF(runs >= 3 && runs <= 5 && series->Count(0xF003) == runs, "%d runs, hinted %d", runs, series->Count(0xF003));
+  // 50 ms entry, about 20 times per second:
+  int fast = series->Count(0xF002);
+  CHECKF(fast >= 15 && fast <= 22, "50 ms entry polled %d times in 1 s", fast);
+  // on demand:
+  CHECKF(series->Count(0xF004) == 0, "on demand entry polled %d times without listener", series->Count(0xF004));
+  MyMetrics.SetNamedListener("v.test.ondemand", true);
+  usleep(600 * 1000);
+  CHECK(series->Count(0xF004) >= 1);
+  MyMetrics.SetNamedListener("v.test.ondemand", false);
+
+  MyPollers.PollRemove(&s_can1, "test");
+  MyPollers.PollClearPidHints();
+  }
+
+/**
+ * Broadcast collect mode: three ECUs send interleaved multi frame responses
+ *  to a broadcast, each is reassembled per ECU. Without ISOTP_COLLECT the
+ *  broadcast ends with the first complete response.
+ */
+static void run_collect(uint8_t protocol, uint32_t txid, uint32_t ecu_txid, uint32_t ecu_txstep, uint32_t ecu_rxid)
+  {
+  MyPollerSim.Clear();
+  for (int i = 0; i < 3; i++)
+    CHECK(MyPollerSim.AddEcu(ecu(ecu_txid + i * ecu_txstep, ecu_rxid + i, protocol, 40, 5, 10)) == NULL);
+  MyPollers.PollSetResponseSeparationTime(1);
+  for (uint8_t collect : { ISOTP_COLLECT, 0 })
+    {
+    auto series = std::make_shared<ListSeries>(bus_poller(),
+      std::vector<OvmsPoller::poll_pid_t>({ list_entry(0xF010, 1, txid, 0, protocol | collect) }));
+    MyPollers.PollRequest(&s_can1, "test", series);
+    usleep(1000 * 1000);
+    MyPollers.PollRemove(&s_can1, "test");
+    usleep(300 * 1000);
+
+    std::map<uint32_t, int> responders = series->Responders();
+    int runs = series->Count(0xF010);
+    CHECKF(series->Corrupt() == 0, "%d invalid response frames", series->Corrupt());
+    if (collect)
+      {
+      CHECKF(responders.size() == 3, "%zu of 3 ECUs collected", responders.size());
+      for (auto &r : responders)
+        CHECKF(r.first >= ecu_rxid && r.first < ecu_rxid + 3 && r.second >= 3,
+          "ECU %X: %d of %d replies", (unsigned)r.first, r.second, runs);
+      }
+    else
+      {
+      CHECKF(runs >= 3 && runs <= 5, "%d replies in 4 runs", runs);
+      }
+    }
+  MyPollers.PollSetResponseSeparationTime(25);
+  }
+
+static void test_collect()
+  {
+  run_collect(ISOTP_STD, 0x7df, 0x7e0, 1, 0x7e8);
+  run_collect(ISOTP_EXTFRAME, 0x18db33f1, 0x18da10f1, 0x100, 0x18daf110);
+  }
+
+/**
+ * Multi DID requests: an ECU rejecting them as too long halves the limit,
+ *  "requestOutOfRange" doesn't. The DIDs are read singly then. A timeout
+ *  is reported for each DID of the request.
+ */
+static std::shared_ptr<ListSeries> run_batch(uint8_t maxdids, uint8_t nrc)
+  {
+  MyPollerSim.Clear();
+  pollersim_ecu_t e = ecu(0x7e0, 0x7e8, ISOTP_STD, 4, 5);
+  e.maxdids = maxdids;
+  e.batchnrc = nrc;
+  CHECK(MyPollerSim.AddEcu(e) == NULL);
+  MyPollers.PollSetBatching(0x7e0, 4);
+  std::vector<OvmsPoller::poll_pid_t> list;
+  for (uint16_t did = 0xF020; did < 0xF024; did++)
+    list.push_back(list_entry(did, 1));
+  auto series = std::make_shared<ListSeries>(bus_poller(), list);
+  MyPollers.PollRequest(&s_can1, "test", series);
+  usleep(1000 * 1000);
+  return series;
+  }
+
+static void test_batch()
+  {
+  // requestOutOfRange: limit kept, DIDs read singly in every second run:
+  auto series = run_batch(1, UDS_RESP_NRC_ROOR);
+  MyPollers.PollRemove(&s_can1, "test");
+  CHECKF(MyPollers.PollBatchLimit(0x7e0) == 4, "limit %u after NRC 31", MyPollers.PollBatchLimit(0x7e0));
+  for (uint16_t did = 0xF020; did < 0xF024; did++)
+    CHECKF(series->Count(did) >= 2, "DID %X: %d replies", did, series->Count(did));
+  CHECKF(series->Errors() == 0, "%zu errors", series->Errors());
+
+  // incorrectMessageLengthOrInvalidFormat: limit halved
+  series = run_batch(1, 0);
+  MyPollers.PollRemove(&s_can1, "test");
+  CHECKF(MyPollers.PollBatchLimit(0x7e0) < 4, "limit %u after NRC 13", MyPollers.PollBatchLimit(0x7e0));
+
+  // timeout after the DID lengths have been learned:
+  MyPollers.PollClearBatching();
+  series = run_batch(4, 0);
+  CHECKF(MyPollers.PollBatchLimit(0x7e0) == 4, "limit %u", MyPollers.PollBatchLimit(0x7e0));
+  pollersim_ecu_t e = ecu(0x7e0, 0x7e8, ISOTP_STD, 4, 5, 0, 100);
+  e.maxdids = 4;
+  CHECK(MyPollerSim.AddEcu(e) == NULL);
+  usleep(1500 * 1000);
+  MyPollers.PollRemove(&s_can1, "test");
+  for (uint16_t did = 0xF020; did < 0xF024; did++)
+    CHECKF(series->Errors(did, (uint16_t)POLLSINGLE_TIMEOUT) >= 1, "DID %X: %d timeouts reported",
+      did, series->Errors(did, (uint16_t)POLLSINGLE_TIMEOUT));
+  MyPollers.PollClearBatching();
+  }
+
+static void bench()
+  {
+  static const struct { uint16_t latency, jitter; uint8_t loss; } cases[] =
+    { { 10, 0, 0 }, { 20, 10, 0 }, { 20, 10, 5 } };
+  printf("6 ISO-TP ECUs x 3 DIDs, single frame responses, polled every %d ms, 5 runs each:\n"
+    "  latency  loss  pipeline  cycle avg/max [ms]  success  timeouts  CPU/reply [us]\n", 4 * RUN_MS);
+  for (auto &c : cases)
+    {
+    MyPollerSim.Clear();
+    add_isotp_ecus(6, 4, c.latency, c.jitter, c.loss);
+    for (int pipeline : { 1, 2, 4, 6 })
+      {
+      simresult_t r = run_bench(pipeline, 3, 5, 4);
+      printf("  %3u±%-3u  %3u%%  %8d  %10.1f / %-5u  %6.1f%%  %8u  %14.1f\n",
+        c.latency, c.jitter, c.loss, pipeline, r.cycle_avg, r.cycle_max,
+        r.sent ? (double)r.replies * 100 / r.sent : 0, r.timeouts, r.cpu_per_reply);
+      }
+    }
+  }
+
+int main(int argc, char* argv[])
+  {
+  MyPollers.PollSetTicker(TICK_MS, TICKS);
+  MyPollers.Ready(true);
+  MyPollers.CheckStartPollTask(true);
+  MyPollers.PollSetThrottling(0);
+
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_pipelining();
+    test_transfers();
+    test_loss();
+    test_schedule();
+    test_collect();
+    test_batch();
+    }
+  MyPollerSim.Clear();
+  int res = host_test_result((argc > 1) ? "bench_poller_sim" : "test_poller_sim");
+  // The poller, simulator & timer tasks keep running, skip the static destructors:
+  fflush(stdout);
+  _exit(res);
+  }
@@ -0,0 +1,248 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: BMS cell statistics
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_vehicle_bms_stats         single pass statistics vs. exact & former formulas
+//   test_vehicle_bms_stats bench   deviations & time per series, single vs. former two pass
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include "host_test.h"
+#include "vehicle_bms_stats.h"
+
+/**
+ * Exact reference: two pass, long double, squares of the deviations
+ */
+static void exact_cell_stats(const float* values, int count, bms_cell_stats_t &res)
+  {
+  long double sum = 0, sqrsum = 0, sumn = 0, sumd = 0;
+  float min = values[0], max = values[0];
+  for (int i = 0; i < count; i++)
+    {
+    sum += values[i];
+    min = fminf(min, values[i]);
+    max = fmaxf(max, values[i]);
+    }
+  long double avg = sum / count;
+  for (int i = 0; i < count; i++)
+    {
+    long double d = values[i] - avg, p = i - (count / 2 - 0.5L);
+    sqrsum += d * d;
+    sumn += p * d;
+    sumd += p * p;
+    }
+  res.min = min;
+  res.max = max;
+  res.avg = avg;
+  res.stddev = sqrtl(sqrsum / count);
+  res.grad = (sumd > 0) ? (double)(sumn / sumd * count) : 0;
+  }
+
+/**
+ * Former formulas: two pass, double sums of float squares (cancellation),
+ *  min/max initialization with 0 = unset
+ */
+static void ref_cell_stats(const float* values, int count, bms_cell_stats_t &res)
+  {
+  double sum=0, sqrsum=0, avg, stddev=0;
+  float min=0, max=0;
+  for (int i=0; i<count; i++)
+    {
+    sum += values[i];
+    sqrsum += values[i] * values[i];
+    if (min==0 || values[i]<min)
+      min = values[i];
+    if (max==0 || values[i]>max)
+      max = values[i];
+    }
+  avg = sum / count;
+  stddev = sqrt(fmax((sqrsum / count) - avg * avg, 0));
+
+  double sumn = 0, sumd = 0;
+  for (int i=0; i<count; i++)
+    {
+    sumn += (i - (count / 2 - 0.5)) * (values[i] - avg);
+    sumd += (i - (count / 2 - 0.5)) * (i - (count / 2 - 0.5));
+    }
+  res.min = min;
+  res.max = max;
+  res.avg = avg;
+  res.stddev = stddev;
+  res.grad = (sumn / sumd) * count;
+  }
+
+static float frand(uint32_t &rnd)
+  {
+  return (host_test_rand(rnd) & 0xffffff) / (float)0x1000000;
+  }
+
+/**
+ * Cell series generators:
+ *  - voltages: 3.0…4.2 V level, ±20 mV noise, pack gradient up to ±50 mV, one weak cell
+ *  - temperatures: -20…50 °C level, ±3 °C noise, pack gradient up to ±10 °C
+ */
+static void gen_voltages(uint32_t &rnd, int count, float* v)
+  {
+  float level = 3.0f + 1.2f * frand(rnd);
+  float grad = 0.1f * (frand(rnd) - 0.5f);
+  int weak = host_test_rand(rnd) % count;
+  for (int i = 0; i < count; i++)
+    v[i] = roundf((level + grad * i / count + 0.04f * (frand(rnd) - 0.5f)) * 1000) / 1000;
+  v[weak] -= 0.1f;
+  }
+
+static void gen_temperatures(uint32_t &rnd, int count, float* v)
+  {
+  float level = -20 + 70 * frand(rnd);
+  float grad = 20 * (frand(rnd) - 0.5f);
+  for (int i = 0; i < count; i++)
+    v[i] = roundf((level + grad * i / count + 6 * (frand(rnd) - 0.5f)) * 10) / 10;
+  }
+
+struct maxdiff_t
+  {
+  double avg, stddev, grad;
+  void update(const bms_cell_stats_t &a, const bms_cell_stats_t &b)
+    {
+    avg = fmax(avg, fabs(a.avg - b.avg));
+    stddev = fmax(stddev, fabs(a.stddev - b.stddev));
+    grad = fmax(grad, fabs(a.grad - b.grad));
+    }
+  };
+
+static void compare(const float* v, int count, double tol, maxdiff_t &single, maxdiff_t &former)
+  {
+  bms_cell_stats_t s, e, r;
+  bms_cell_stats(v, count, s);
+  exact_cell_stats(v, count, e);
+  CHECKF(s.min == e.min, "n=%d min %f / %f", count, s.min, e.min);
+  CHECKF(s.max == e.max, "n=%d max %f / %f", count, s.max, e.max);
+  CHECKF(fabs(s.avg - e.avg) <= tol, "n=%d avg %.7f / %.7f", count, s.avg, e.avg);
+  CHECKF(fabs(s.stddev - e.stddev) <= tol, "n=%d stddev %.7f / %.7f", count, s.stddev, e.stddev);
+  CHECKF(fabs(s.grad - e.grad) <= tol * 10, "n=%d grad %.7f / %.7f", count, s.grad, e.grad);
+  single.update(s, e);
+  if (count > 1)
+    {
+    ref_cell_stats(v, count, r);
+    former.update(r, e);
+    }
+  }
+
+static void test_stats(bool verbose)
+  {
+  uint32_t rnd = 0x2468ace1;
+  float v[400];
+  maxdiff_t sv = { 0, 0, 0 }, st = { 0, 0, 0 }, fv = { 0, 0, 0 }, ft = { 0, 0, 0 };
+
+  // voltages are published with 5 decimals, temperatures with 2:
+  for (int count = 1; count <= 400; count++)
+    {
+    for (int k = 0; k < 20; k++)
+      {
+      gen_voltages(rnd, count, v);
+      compare(v, count, 1e-6, sv, fv);
+      gen_temperatures(rnd, count, v);
+      compare(v, count, 1e-4, st, ft);
+      }
+    }
+
+  // constant series: no deviation, no gradient
+  for (int count = 1; count <= 400; count += 7)
+    {
+    for (int i = 0; i < count; i++)
+      v[i] = 3.913f;
+    bms_cell_stats_t s;
+    bms_cell_stats(v, count, s);
+    CHECK(s.stddev == 0 && s.grad == 0);
+    CHECK(s.min == 3.913f && s.max == 3.913f && (float)s.avg == 3.913f);
+    }
+
+  // exact linear series: gradient = pack span (ramp of 1 mV per cell):
+  for (int count = 2; count <= 400; count += 2)
+    {
+    for (int i = 0; i < count; i++)
+      v[i] = 3.7f + 0.001f * i;
+    bms_cell_stats_t s;
+    bms_cell_stats(v, count, s);
+    CHECKF(fabs(s.grad - 0.001 * count) < 1e-5, "n=%d grad %f", count, s.grad);
+    }
+
+  // zero crossing temperatures: min & max independent of 0 values
+  float t[5] = { 0, 5, -3, 0, 2 };
+  bms_cell_stats_t s;
+  bms_cell_stats(t, 5, s);
+  CHECK(s.min == -3 && s.max == 5);
+
+  if (verbose)
+    {
+    printf("max deviation from the exact values, 1…400 cells:\n"
+      "                            avg       stddev    grad\n");
+    printf("  voltages [V]    single   %-8.2g  %-8.2g  %-8.2g\n", sv.avg, sv.stddev, sv.grad);
+    printf("                  former   %-8.2g  %-8.2g  %-8.2g\n", fv.avg, fv.stddev, fv.grad);
+    printf("  temps [°C]      single   %-8.2g  %-8.2g  %-8.2g\n", st.avg, st.stddev, st.grad);
+    printf("                  former   %-8.2g  %-8.2g  %-8.2g\n", ft.avg, ft.stddev, ft.grad);
+    }
+  }
+
+static void bench()
+  {
+  test_stats(true);
+  uint32_t rnd = 0x13579bdf;
+  static const int counts[] = { 16, 96, 192, 400 };
+  printf("time per series [ns]:\n  cells   single  two pass\n");
+  for (int c : counts)
+    {
+    std::vector<float> v(c);
+    gen_voltages(rnd, c, v.data());
+    const int rounds = 2000000 / c;
+    bms_cell_stats_t s;
+    double sink = 0;
+    double t0 = host_test_us();
+    for (int r = 0; r < rounds; r++)
+      {
+      v[r % c] += 1e-6f;
+      bms_cell_stats(v.data(), c, s);
+      sink += s.grad;
+      }
+    double t1 = host_test_us();
+    for (int r = 0; r < rounds; r++)
+      {
+      v[r % c] += 1e-6f;
+      ref_cell_stats(v.data(), c, s);
+      sink += s.grad;
+      }
+    double t2 = host_test_us();
+    printf("  %5d  %7.0f  %8.0f%s\n", c, (t1 - t0) * 1000 / rounds, (t2 - t1) * 1000 / rounds,
+      (sink == 12345) ? " " : "");
+    }
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    test_stats(false);
+  return host_test_result((argc > 1) ? "bench_vehicle_bms_stats" : "test_vehicle_bms_stats");
+  }
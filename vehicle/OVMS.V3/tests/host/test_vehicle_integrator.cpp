@@ -0,0 +1,327 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;
+;    Host test & benchmark: battery energy & charge integrator
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+//   test_vehicle_integrator        segment split, gaps, publishing, 10 min drive cycle
+//   test_vehicle_integrator bench  1 h drive cycle: integrator & 1 Hz sampling vs. reference
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "metrics_standard.h"
+#include "vehicle_integrator.h"
+
+// Access to the accumulators:
+class TestIntegrator : public OvmsBatteryIntegrator
+  {
+  public:
+    using OvmsBatteryIntegrator::m_energy_used;
+    using OvmsBatteryIntegrator::m_energy_recd;
+    using OvmsBatteryIntegrator::m_charge_used;
+    using OvmsBatteryIntegrator::m_charge_recd;
+  };
+
+static void reset_metrics()
+  {
+  OvmsMetricFloat* m[8] =
+    {
+    StdMetrics.ms_v_bat_energy_used, StdMetrics.ms_v_bat_energy_recd,
+    StdMetrics.ms_v_bat_energy_used_total, StdMetrics.ms_v_bat_energy_recd_total,
+    StdMetrics.ms_v_bat_coulomb_used, StdMetrics.ms_v_bat_coulomb_recd,
+    StdMetrics.ms_v_bat_coulomb_used_total, StdMetrics.ms_v_bat_coulomb_recd_total,
+    };
+  for (int i = 0; i < 8; i++)
+    m[i]->SetValue(0);
+  }
+
+static bool near(double a, double b, double tol)
+  {
+  return fabs(a - b) <= tol;
+  }
+
+
+/**
+ * Segment integration: exact trapezoids & zero crossing split
+ */
+static void test_segments()
+  {
+  // 100 V, +10 A → -10 A over 1 s: crossing at 0.5 s, 250 J / 2.5 C each way
+  TestIntegrator a;
+  a.Feed(100, 10, 1000000);
+  a.Feed(100, -10, 2000000);
+  CHECK(a.m_energy_used == 250000000);
+  CHECK(a.m_energy_recd == 250000000);
+  CHECK(a.m_charge_used == 2500000);
+  CHECK(a.m_charge_recd == 2500000);
+
+  // asymmetric crossing: +30 A → -10 A over 1 s, crossing at 0.75 s
+  TestIntegrator b;
+  b.Feed(100, 30, 1000000);
+  b.Feed(100, -10, 2000000);
+  CHECK(b.m_charge_used == 11250000);       // 30 * 0.75 / 2
+  CHECK(b.m_charge_recd == 1250000);        // 10 * 0.25 / 2
+  CHECK(llabs(b.m_energy_used - 1125000000) <= 64);   // float segment area: 1 ulp
+  CHECK(b.m_energy_recd == 125000000);
+
+  // no crossing: 10 A → 30 A over 0.5 s = 10 C, 1 kJ
+  TestIntegrator c;
+  c.Feed(100, 10, 1000000);
+  c.Feed(100, 30, 1500000);
+  CHECK(c.m_charge_used == 10000000);
+  CHECK(c.m_energy_used == 1000000000);
+  CHECK(c.m_charge_recd == 0 && c.m_energy_recd == 0);
+
+  // voltage sign does not matter for the charge split:
+  TestIntegrator d;
+  d.Feed(0, -20, 1000000);
+  d.Feed(0, -20, 2000000);
+  CHECK(d.m_charge_recd == 20000000);
+  CHECK(d.m_energy_used == 0 && d.m_energy_recd == 0);
+  }
+
+/**
+ * Gaps, time warps & restarts suspend integration
+ */
+static void test_gaps()
+  {
+  TestIntegrator a;
+  a.SetMaxGap(2000);
+  a.Feed(100, 10, 1000000);
+  a.Feed(100, 10, 3000000);                 // 2 s: integrated
+  CHECK(a.m_charge_used == 20000000);
+  CHECK(a.GetGaps() == 0);
+  a.Feed(100, 10, 5000001);                 // > 2 s: skipped
+  CHECK(a.m_charge_used == 20000000);
+  CHECK(a.GetGaps() == 1);
+  a.Feed(100, 10, 6000001);                 // continues from the gap sample
+  CHECK(a.m_charge_used == 30000000);
+  a.Feed(100, 10, 5000000);                 // time warp: skipped
+  CHECK(a.m_charge_used == 30000000);
+  CHECK(a.GetGaps() == 2);
+  a.Feed(100, 10, 5000000);                 // dt = 0: nothing
+  CHECK(a.m_charge_used == 30000000);
+  a.Restart();
+  a.Feed(100, 10, 5500000);                 // restart: no gap counted
+  CHECK(a.m_charge_used == 30000000);
+  CHECK(a.GetGaps() == 2);
+  a.Feed(100, 10, 6000000);
+  CHECK(a.m_charge_used == 35000000);
+  CHECK(a.GetSamples() == 8);
+  }
+
+/**
+ * Publishing: metric increments, trip resets, mask, no float drift
+ */
+static void test_publish()
+  {
+  reset_metrics();
+  TestIntegrator a;
+  a.Publish();                              // no samples: metrics untouched
+  CHECK(StdMetrics.ms_v_bat_energy_used->AsFloat() == 0);
+
+  // 100 V 36 A for 1000 s = 1 kWh / 10 Ah, published every second:
+  int64_t t = 1000000;
+  for (int i = 0; i <= 1000; i++, t += 1000000)
+    {
+    a.Feed(100, 36, t);
+    a.Publish();
+    }
+  CHECK(near(StdMetrics.ms_v_bat_energy_used->AsFloat(), 1.0, 1e-6));
+  CHECK(near(StdMetrics.ms_v_bat_energy_used_total->AsFloat(), 1.0, 1e-6));
+  CHECK(near(StdMetrics.ms_v_bat_coulomb_used->AsFloat(), 10.0, 1e-5));
+  CHECK(near(StdMetrics.ms_v_bat_coulomb_used_total->AsFloat(), 10.0, 1e-5));
+  CHECK(StdMetrics.ms_v_bat_energy_recd->AsFloat() == 0);
+
+  // trip reset by the vehicle module, total restored to a stored value:
+  StdMetrics.ms_v_bat_energy_used->SetValue(0);
+  StdMetrics.ms_v_bat_energy_used_total->SetValue(1234.5f);
+  for (int i = 0; i < 500; i++)
+    {
+    a.Feed(100, 36, t);
+    a.Publish();
+    t += 1000000;
+    }
+  CHECK(near(StdMetrics.ms_v_bat_energy_used->AsFloat(), 0.5, 1e-6));
+  CHECK(near(StdMetrics.ms_v_bat_energy_used_total->AsFloat(), 1235.0, 1e-4));
+  CHECK(near(StdMetrics.ms_v_bat_coulomb_used->AsFloat(), 15.0, 1e-5));
+
+  // mask: only charge totals
+  reset_metrics();
+  TestIntegrator b;
+  b.SetPublish(INTEGRATOR_CHARGE_TOTAL);
+  b.Feed(100, 36, 1000000);
+  b.Feed(100, 36, 2000000);
+  b.Publish();
+  CHECK(StdMetrics.ms_v_bat_energy_used->AsFloat() == 0);
+  CHECK(StdMetrics.ms_v_bat_coulomb_used->AsFloat() == 0);
+  CHECK(near(StdMetrics.ms_v_bat_coulomb_used_total->AsFloat(), 0.01, 1e-8));
+
+  // 10 h at 1 Hz: adding each 1 Wh increment to the float metric would round
+  // at every step, the rebased publish rounds once:
+  reset_metrics();
+  TestIntegrator c;
+  t = 1000000;
+  for (int i = 0; i <= 36000; i++, t += 1000000)
+    {
+    c.Feed(100, 36, t);
+    c.Publish();
+    }
+  CHECK(near(StdMetrics.ms_v_bat_energy_used->AsFloat(), 36.0, 4e-6));
+  CHECK(near(StdMetrics.ms_v_bat_coulomb_used->AsFloat(), 360.0, 4e-5));
+  }
+
+
+/**
+ * Synthetic drive cycle
+ *  - cruise current 10…60 A, 60 s standstill (3 A) every 10 min
+ *  - every 20.3 s (not in phase with 1 Hz polls) a 0.35 s acceleration peak
+ *    (+260 A) and a 0.5 s regen peak (-200 A, crossing zero twice)
+ *  - pack voltage 395 V with 90 mΩ internal resistance
+ */
+static double cycle_current(double t)
+  {
+  if (fmod(t, 600) >= 540)
+    return 3;
+  double i = 35 + 25 * sin(2 * M_PI * t / 97);
+  double p = fmod(t, 20.3);
+  if (p >= 3 && p < 3.35)
+    i += 260 * sin(M_PI * (p - 3) / 0.35);
+  else if (p >= 12 && p < 12.5)
+    i -= 200 * sin(M_PI * (p - 12) / 0.5);
+  return i;
+  }
+
+static inline double cycle_voltage(double i)
+  {
+  return 395 - 0.09 * i;
+  }
+
+struct cycle_result_t
+  {
+  double ref_eu, ref_er, ref_cu, ref_cr;    // reference [J / C]
+  double int_eu, int_er, int_cu, int_cr;    // integrator
+  double hz_eu, hz_er, hz_cu, hz_cr;        // 1 Hz rectangles
+  uint32_t samples, gaps;
+  double feed_us;
+  };
+
+static double pct(double v, double ref)
+  {
+  return (v - ref) / ref * 100;
+  }
+
+/**
+ * run_cycle: duration [s], reference step [µs]
+ *  Frames every 10 ms ±1 ms jitter, 2% lost, one 5 s dropout during a standstill.
+ */
+static void run_cycle(double duration, double step_us, cycle_result_t &r)
+  {
+  memset(&r, 0, sizeof(r));
+
+  // reference: midpoint rule, split by sign per step
+  double h = step_us / 1e6;
+  for (double t = h / 2; t < duration; t += h)
+    {
+    double i = cycle_current(t);
+    double p = cycle_voltage(i) * i;
+    if (p > 0) r.ref_eu += p * h; else r.ref_er -= p * h;
+    if (i > 0) r.ref_cu += i * h; else r.ref_cr -= i * h;
+    }
+
+  // integrator fed by the frame stream, sample times offset by 1 s (0 = now):
+  const double drop_from = 1800 + 545, drop_to = drop_from + 5;
+  TestIntegrator a;
+  uint32_t rnd = 0x12345678;
+  double feed_us = 0;
+  for (int k = 0; ; k++)
+    {
+    double t = k * 0.01 + ((int)(host_test_rand(rnd) % 2001) - 1000) * 1e-6;
+    if (t < 0) t = 0;
+    if (t > duration) break;
+    if (host_test_rand(rnd) % 100 < 2) continue;
+    if (t >= drop_from && t < drop_to) continue;
+    double i = cycle_current(t);
+    int64_t ts = 1000000 + (int64_t)llround(t * 1e6);
+    double t0 = host_test_us();
+    a.Feed(cycle_voltage(i), i, ts);
+    feed_us += host_test_us() - t0;
+    }
+  r.int_eu = a.m_energy_used / 1e6;
+  r.int_er = a.m_energy_recd / 1e6;
+  r.int_cu = a.m_charge_used / 1e6;
+  r.int_cr = a.m_charge_recd / 1e6;
+  r.samples = a.GetSamples();
+  r.gaps = a.GetGaps();
+  r.feed_us = feed_us / r.samples;
+
+  // 1 Hz polling of the power & current values as done before:
+  for (int s = 0; s < (int)duration; s++)
+    {
+    double i = cycle_current(s);
+    double p = cycle_voltage(i) * i;
+    if (p > 0) r.hz_eu += p; else r.hz_er -= p;
+    if (i > 0) r.hz_cu += i; else r.hz_cr -= i;
+    }
+  }
+
+static void test_cycle()
+  {
+  cycle_result_t r;
+  run_cycle(600, 10, r);
+  CHECKF(fabs(pct(r.int_eu, r.ref_eu)) < 0.2, "energy used %+.3f%%", pct(r.int_eu, r.ref_eu));
+  CHECKF(fabs(pct(r.int_er, r.ref_er)) < 0.2, "energy recd %+.3f%%", pct(r.int_er, r.ref_er));
+  CHECKF(fabs(pct(r.int_cu, r.ref_cu)) < 0.2, "charge used %+.3f%%", pct(r.int_cu, r.ref_cu));
+  CHECKF(fabs(pct(r.int_cr, r.ref_cr)) < 0.2, "charge recd %+.3f%%", pct(r.int_cr, r.ref_cr));
+  CHECK(r.gaps == 0);
+  }
+
+static void bench()
+  {
+  cycle_result_t r;
+  run_cycle(3600, 10, r);
+  CHECK(r.gaps == 1);
+  printf("1 h drive cycle, reference step 10 us:\n");
+  printf("  reference:  energy used %.4f kWh, recd %.4f kWh, charge used %.3f Ah, recd %.3f Ah\n",
+    r.ref_eu / 3.6e6, r.ref_er / 3.6e6, r.ref_cu / 3600, r.ref_cr / 3600);
+  printf("  integrator: energy used %+.3f%%, recd %+.3f%%, charge used %+.3f%%, recd %+.3f%%"
+    " (%u samples, %u gaps, %.3f us/feed)\n",
+    pct(r.int_eu, r.ref_eu), pct(r.int_er, r.ref_er), pct(r.int_cu, r.ref_cu), pct(r.int_cr, r.ref_cr),
+    r.samples, r.gaps, r.feed_us);
+  printf("  1 Hz:       energy used %+.3f%%, recd %+.3f%%, charge used %+.3f%%, recd %+.3f%%\n",
+    pct(r.hz_eu, r.ref_eu), pct(r.hz_er, r.ref_er), pct(r.hz_cu, r.ref_cu), pct(r.hz_cr, r.ref_cr));
+  }
+
+int main(int argc, char* argv[])
+  {
+  if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    bench();
+  else
+    {
+    test_segments();
+    test_gaps();
+    test_publish();
+    test_cycle();
+    }
+  return host_test_result((argc > 1) ? "bench_vehicle_integrator" : "test_vehicle_integrator");
+  }